@@ -0,0 +1,39 @@
+// Copyright (C) 2020-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+
+#include "arm_async_infer_request.hpp"
+#include "arm_itt.hpp"
+
+using namespace ArmPlugin;
+
+ArmAsyncInferRequest::ArmAsyncInferRequest(const ArmInferRequest::Ptr& inferRequest,
+                                           const InferenceEngine::ITaskExecutor::Ptr& ioExecutor,
+                                           const InferenceEngine::ITaskExecutor::Ptr& executeExecutor,
+                                           const InferenceEngine::ITaskExecutor::Ptr& callbackExecutor) :
+    AsyncInferRequestThreadSafeDefault(inferRequest, ioExecutor, callbackExecutor),
+    _inferRequest{inferRequest} {
+    // Three stage pipeline over two executors: the I/O stages of one request
+    // overlap the layer execution of another, so the blob conversion and copy
+    // time disappears from the per frame latency of a saturated pipeline
+    _pipeline = {{ioExecutor,
+                  [this] {
+                      OV_ITT_SCOPED_TASK(Itt::Domains::ArmPlugin, "ArmAsyncInferRequest::Preprocessing");
+                      _inferRequest->InferPreprocess();
+                  }},
+                 {executeExecutor,
+                  [this] {
+                      OV_ITT_SCOPED_TASK(Itt::Domains::ArmPlugin, "ArmAsyncInferRequest::Execute");
+                      _inferRequest->InferExecute();
+                  }},
+                 {ioExecutor,
+                  [this] {
+                      OV_ITT_SCOPED_TASK(Itt::Domains::ArmPlugin, "ArmAsyncInferRequest::Postprocessing");
+                      _inferRequest->InferPostprocess();
+                  }}};
+}
+
+void ArmAsyncInferRequest::Infer_ThreadUnsafe() {
+    StartAsync_ThreadUnsafe();
+}
@@ -0,0 +1,26 @@
+// Copyright (C) 2020-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+
+#pragma once
+
+#include <cpp_interfaces/impl/ie_infer_async_request_thread_safe_default.hpp>
+
+#include "arm_infer_request.hpp"
+
+namespace ArmPlugin {
+
+struct ArmAsyncInferRequest : public InferenceEngine::AsyncInferRequestThreadSafeDefault {
+    ArmAsyncInferRequest(const ArmInferRequest::Ptr& inferRequest,
+                         const InferenceEngine::ITaskExecutor::Ptr& ioExecutor,
+                         const InferenceEngine::ITaskExecutor::Ptr& executeExecutor,
+                         const InferenceEngine::ITaskExecutor::Ptr& callbackExecutor);
+
+    void Infer_ThreadUnsafe() override;
+
+private:
+    ArmInferRequest::Ptr _inferRequest;
+};
+
+}  // namespace ArmPlugin
@@ -28,8 +28,9 @@ Configuration::Configuration(const ConfigMap& config, const Configuration& defau
         const auto& value = c.second;
         if ((streamExecutorConfigKeys.end() !=
              std::find(std::begin(streamExecutorConfigKeys), std::end(streamExecutorConfigKeys), key))) {
+            // Streams and thread binding keys work the way CPU plugin streams
+            // do; in particular CPU_BIND_THREAD pins each stream's threads
             _streamsExecutorConfig.SetConfig(key, value);
-            _streamsExecutorConfig._threadBindingType = InferenceEngine::IStreamsExecutor::NONE;
         } else if (ov::enable_profiling == key) {
             _perfCount = (CONFIG_VALUE(YES) == value);
         } else if (CONFIG_KEY(EXCLUSIVE_ASYNC_REQUESTS) == key) {
@@ -40,6 +41,40 @@ Configuration::Configuration(const ConfigMap& config, const Configuration& defau
             _lpt = (CONFIG_VALUE(YES) == value);
         } else if (CONFIG_KEY_INTERNAL(DUMP_GRAPH) == key) {
             _dump = (CONFIG_VALUE(YES) == value);
+        } else if (CONFIG_KEY_INTERNAL(ENFORCE_FP16) == key) {
+            _fp16 = (CONFIG_VALUE(YES) == value);
+        } else if (CONFIG_KEY_INTERNAL(FAST_MATH) == key) {
+            _fastMath = (CONFIG_VALUE(YES) == value);
+        } else if (CONFIG_KEY_INTERNAL(NHWC_LAYOUT) == key) {
+            _nhwc = (CONFIG_VALUE(YES) == value);
+        } else if (CONFIG_KEY_INTERNAL(BATCH_SPLIT) == key) {
+            try {
+                _batchSplit = std::stoi(value);
+            } catch (...) {
+                _batchSplit = 0;
+            }
+            if (_batchSplit < 1) {
+                IE_THROW() << "Wrong value for property key " << CONFIG_KEY_INTERNAL(BATCH_SPLIT) << ": " << value;
+            }
+        } else if (CONFIG_KEY_INTERNAL(PMU_COUNTERS) == key) {
+            _pmuCounters = (CONFIG_VALUE(YES) == value);
+        } else if (CONFIG_KEY_INTERNAL(CONV_METHOD_TUNING) == key) {
+            _convMethodTuning = (CONFIG_VALUE(YES) == value);
+        } else if (CONFIG_KEY_INTERNAL(CONV_METHOD_CACHE_FILE) == key) {
+            _convMethodCacheFile = value;
+        } else if (CONFIG_KEY_INTERNAL(TRACE_EXPORT_FILE) == key) {
+            _traceExportFile = value;
+        } else if (CONFIG_KEY_INTERNAL(WEIGHTS_COMPRESSION) == key) {
+            _weightsCompression = (CONFIG_VALUE(YES) == value);
+        } else if (CONFIG_KEY_INTERNAL(DYNAMIC_SHAPE_CACHE) == key) {
+            try {
+                _dynamicShapeCacheCapacity = std::stoi(value);
+            } catch (...) {
+                _dynamicShapeCacheCapacity = -1;
+            }
+            if (_dynamicShapeCacheCapacity < 0) {
+                IE_THROW() << "Wrong value for property key " << CONFIG_KEY_INTERNAL(DYNAMIC_SHAPE_CACHE) << ": " << value;
+            }
         } else if (CONFIG_KEY(PERFORMANCE_HINT) == key) {
                 if (value == "THROUGHPUT") {
                     _perfHint = ov::hint::PerformanceMode::THROUGHPUT;
@@ -69,6 +104,26 @@ InferenceEngine::Parameter Configuration::Get(const std::string& name) const {
         return {_lpt};
     } else if (name == CONFIG_KEY_INTERNAL(DUMP_GRAPH)) {
         return {_dump};
+    } else if (name == CONFIG_KEY_INTERNAL(ENFORCE_FP16)) {
+        return {_fp16};
+    } else if (name == CONFIG_KEY_INTERNAL(FAST_MATH)) {
+        return {_fastMath};
+    } else if (name == CONFIG_KEY_INTERNAL(NHWC_LAYOUT)) {
+        return {_nhwc};
+    } else if (name == CONFIG_KEY_INTERNAL(BATCH_SPLIT)) {
+        return {_batchSplit};
+    } else if (name == CONFIG_KEY_INTERNAL(PMU_COUNTERS)) {
+        return {_pmuCounters};
+    } else if (name == CONFIG_KEY_INTERNAL(CONV_METHOD_TUNING)) {
+        return {_convMethodTuning};
+    } else if (name == CONFIG_KEY_INTERNAL(CONV_METHOD_CACHE_FILE)) {
+        return {_convMethodCacheFile};
+    } else if (name == CONFIG_KEY_INTERNAL(TRACE_EXPORT_FILE)) {
+        return {_traceExportFile};
+    } else if (name == CONFIG_KEY_INTERNAL(WEIGHTS_COMPRESSION)) {
+        return {_weightsCompression};
+    } else if (name == CONFIG_KEY_INTERNAL(DYNAMIC_SHAPE_CACHE)) {
+        return {_dynamicShapeCacheCapacity};
     } else if (name == CONFIG_KEY(PERFORMANCE_HINT)) {
         return {_perfHint};
     }  else {
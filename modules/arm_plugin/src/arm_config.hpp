@@ -15,6 +15,18 @@ namespace InferenceEngine {
 namespace PluginConfigInternalParams {
 DECLARE_CONFIG_KEY(USE_REF_IMPL);
 DECLARE_CONFIG_KEY(DUMP_GRAPH);
+DECLARE_CONFIG_KEY(ENFORCE_FP16);
+DECLARE_CONFIG_KEY(FAST_MATH);
+DECLARE_CONFIG_KEY(NHWC_LAYOUT);
+DECLARE_CONFIG_KEY(BATCH_SPLIT);
+DECLARE_CONFIG_KEY(PMU_COUNTERS);
+DECLARE_CONFIG_KEY(CONV_METHOD_TUNING);
+DECLARE_CONFIG_KEY(CONV_METHOD_CACHE_FILE);
+DECLARE_CONFIG_KEY(DYNAMIC_SHAPE_CACHE);
+DECLARE_CONFIG_KEY(MEMORY_FOOTPRINT);
+DECLARE_CONFIG_KEY(TRACE_EXPORT_FILE);
+DECLARE_CONFIG_KEY(EVENT_COUNTERS);
+DECLARE_CONFIG_KEY(WEIGHTS_COMPRESSION);
 }  // namespace PluginConfigInternalParams
 }  // namespace InferenceEngine
 
@@ -40,6 +52,44 @@ struct Configuration {
     bool _ref                    = true;
     bool _lpt                    = false;
     bool _dump                   = false;
+    // Runs fp32 graphs on the fp16 ACL kernels of armv8.2+ cores; built only
+    // with __ARM_FEATURE_FP16_VECTOR_ARITHMETIC, ignored otherwise
+    bool _fp16                   = false;
+    // Enables the ACL fast_math mode: convolution and GEMM dispatch bf16
+    // dot-product kernels on cores with the BF16 extension; a node opts out
+    // via a "DisableFastMath" rt_info entry
+    bool _fastMath               = false;
+    // Moves the convolutional backbone to NHWC tensors, where ACL's NEON
+    // kernels are fastest, with permutes only on the region boundaries
+    bool _nhwc                   = false;
+    // Number of replicated layer pipelines an infer request partitions its
+    // batch across; ACL kernel parallelism saturates well below high core
+    // counts, so several smaller-batch replicas scale further than one pipeline
+    int  _batchSplit             = 1;
+    // Samples hardware counters (cycles, instructions, LLC misses) around every
+    // layer run and reports the derived IPC and bytes/cycle next to the wall
+    // time, telling compute-bound layers from memory-bound ones
+    bool _pmuCounters            = false;
+    // Times the candidate ACL convolution algorithms (GEMM, Winograd, direct)
+    // per layer at LoadNetwork and dispatches the fastest one instead of
+    // trusting ACL's static shape heuristics
+    bool _convMethodTuning       = false;
+    // Where the tuning winners persist, keyed by layer signature and CPU part
+    // number; empty keeps them in-process only
+    std::string _convMethodCacheFile;
+    // Accepts networks with dynamic input shapes: the transformation pipeline
+    // and the layer pipelines are built per concrete input signature and kept
+    // in an LRU cache of this capacity, so a padded-to-maximum input can run
+    // at its real length instead; 0 keeps the static-shapes-only behaviour
+    int  _dynamicShapeCacheCapacity = 0;
+    // Stores large conv/matmul weights as int8 with per-output-channel scales
+    // and a runtime dequantize, cutting the at-rest weight memory to a quarter
+    // on devices where the fp32 model does not fit; compute stays fp32
+    bool _weightsCompression     = false;
+    // Chrome tracing (Perfetto) JSON file the layer and stage spans of every
+    // inference are streamed into, keeping the ordering and thread placement
+    // the averaged performance counters lose; empty disables the trace
+    std::string _traceExportFile;
     ov::hint::PerformanceMode _perfHint = ov::hint::PerformanceMode::UNDEFINED;
     mutable InferenceEngine::IStreamsExecutor::Config _streamsExecutorConfig;
 };
@@ -0,0 +1,211 @@
+// Copyright (C) 2020-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+
+#include "arm_conv_method_cache.hpp"
+
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <memory>
+#include <sstream>
+#include <vector>
+
+#include <arm_compute/runtime/Tensor.h>
+#include <arm_compute/runtime/NEON/functions/NEDirectConvolutionLayer.h>
+#include <arm_compute/runtime/NEON/functions/NEGEMMConvolutionLayer.h>
+#include <arm_compute/runtime/NEON/functions/NEWinogradConvolutionLayer.h>
+
+using namespace ArmPlugin;
+
+namespace {
+// The MIDR part number (e.g. 0xd0c for Neoverse-N1, 0xd40 for Neoverse-V1):
+// the same layer shape picks different winners on different cores, so the
+// part number is folded into the cache key
+std::string CpuPartNumber() {
+    static const std::string part = [] {
+        std::ifstream cpuinfo{"/proc/cpuinfo"};
+        std::string line;
+        while (std::getline(cpuinfo, line)) {
+            auto pos = line.find("CPU part");
+            if (pos != std::string::npos) {
+                pos = line.find(':', pos);
+                if (pos != std::string::npos) {
+                    auto value = line.substr(pos + 1);
+                    value.erase(0, value.find_first_not_of(" \t"));
+                    return value;
+                }
+            }
+        }
+        return std::string{"unknown"};
+    }();
+    return part;
+}
+
+void AppendShape(std::ostringstream& key, const arm_compute::TensorShape& shape) {
+    for (std::size_t d = 0; d < shape.num_dimensions(); ++d) {
+        if (d != 0) key << 'x';
+        key << shape[d];
+    }
+}
+
+std::string MakeKey(const arm_compute::ITensorInfo* input,
+                    const arm_compute::ITensorInfo* weights,
+                    const arm_compute::ITensorInfo* output,
+                    const arm_compute::PadStrideInfo& conv_info,
+                    const arm_compute::Size2D& dilation,
+                    const arm_compute::ActivationLayerInfo& act_info,
+                    const bool enable_fast_math) {
+    std::ostringstream key;
+    key << CpuPartNumber()
+        << "_t" << static_cast<int>(input->data_type())
+        << "_l" << static_cast<int>(input->data_layout())
+        << "_i";
+    AppendShape(key, input->tensor_shape());
+    key << "_w";
+    AppendShape(key, weights->tensor_shape());
+    key << "_o";
+    AppendShape(key, output->tensor_shape());
+    key << "_s" << conv_info.stride().first << 'x' << conv_info.stride().second
+        << "_p" << conv_info.pad_left() << 'x' << conv_info.pad_right()
+        << 'x' << conv_info.pad_top() << 'x' << conv_info.pad_bottom()
+        << "_d" << dilation.x() << 'x' << dilation.y()
+        << "_a" << static_cast<int>(act_info.activation())
+        << "_f" << (enable_fast_math ? 1 : 0);
+    return key.str();
+}
+
+const char* MethodName(const ConvMethod method) {
+    switch (method) {
+        case ConvMethod::Gemm:     return "gemm";
+        case ConvMethod::Winograd: return "winograd";
+        case ConvMethod::Direct:   return "direct";
+        default:                   return "auto";
+    }
+}
+
+ConvMethod MethodFromName(const std::string& name) {
+    if (name == "gemm")     return ConvMethod::Gemm;
+    if (name == "winograd") return ConvMethod::Winograd;
+    if (name == "direct")   return ConvMethod::Direct;
+    return ConvMethod::Auto;
+}
+
+struct BenchmarkTensor {
+    explicit BenchmarkTensor(const arm_compute::ITensorInfo* info) {
+        if (info != nullptr) {
+            _tensor.allocator()->init(arm_compute::TensorInfo{*info});
+            _tensor.allocator()->allocate();
+            std::memset(_tensor.buffer(), 0, _tensor.info()->total_size());
+        }
+    }
+    arm_compute::Tensor* get() {
+        return _tensor.buffer() != nullptr ? &_tensor : nullptr;
+    }
+    arm_compute::Tensor _tensor;
+};
+
+double TimeFunction(arm_compute::IFunction& function) {
+    // The first run includes the lazy packing done in prepare(); the timed
+    // runs see the same steady state an infer request would
+    function.run();
+    auto best = std::numeric_limits<double>::max();
+    for (int i = 0; i < 3; ++i) {
+        const auto start = std::chrono::steady_clock::now();
+        function.run();
+        const auto stop = std::chrono::steady_clock::now();
+        best = std::min(best, std::chrono::duration<double, std::micro>{stop - start}.count());
+    }
+    return best;
+}
+
+ConvMethod Benchmark(const arm_compute::ITensorInfo* input,
+                     const arm_compute::ITensorInfo* weights,
+                     const arm_compute::ITensorInfo* biases,
+                     const arm_compute::ITensorInfo* output,
+                     const arm_compute::PadStrideInfo& conv_info,
+                     const arm_compute::Size2D& dilation,
+                     const arm_compute::ActivationLayerInfo& act_info,
+                     const bool enable_fast_math) {
+    BenchmarkTensor src{input}, wei{weights}, bia{biases}, dst{output};
+
+    auto winner = ConvMethod::Auto;
+    auto bestTime = std::numeric_limits<double>::max();
+    auto consider = [&](const ConvMethod method, const double time) {
+        if (time < bestTime) {
+            bestTime = time;
+            winner = method;
+        }
+    };
+
+    if (bool(arm_compute::NEGEMMConvolutionLayer::validate(input, weights, biases, output,
+                                                           conv_info, arm_compute::WeightsInfo{}, dilation, act_info, enable_fast_math))) {
+        arm_compute::NEGEMMConvolutionLayer conv;
+        conv.configure(src.get(), wei.get(), bia.get(), dst.get(),
+                       conv_info, arm_compute::WeightsInfo{}, dilation, act_info, enable_fast_math);
+        consider(ConvMethod::Gemm, TimeFunction(conv));
+    }
+    if (dilation == arm_compute::Size2D(1U, 1U) &&
+        bool(arm_compute::NEWinogradConvolutionLayer::validate(input, weights, biases, output,
+                                                               conv_info, act_info, enable_fast_math))) {
+        arm_compute::NEWinogradConvolutionLayer conv;
+        conv.configure(src.get(), wei.get(), bia.get(), dst.get(), conv_info, act_info, enable_fast_math);
+        consider(ConvMethod::Winograd, TimeFunction(conv));
+    }
+    if (dilation == arm_compute::Size2D(1U, 1U) &&
+        bool(arm_compute::NEDirectConvolutionLayer::validate(input, weights, biases, output, conv_info, act_info))) {
+        arm_compute::NEDirectConvolutionLayer conv;
+        conv.configure(src.get(), wei.get(), bia.get(), dst.get(), conv_info, act_info);
+        consider(ConvMethod::Direct, TimeFunction(conv));
+    }
+    return winner;
+}
+}  // namespace
+
+ConvMethodCache& ConvMethodCache::Instance() {
+    static ConvMethodCache instance;
+    return instance;
+}
+
+void ConvMethodCache::LoadFile(const std::string& cacheFile) {
+    std::ifstream file{cacheFile};
+    std::string key, method;
+    while (file >> key >> method) {
+        _methods.emplace(key, MethodFromName(method));
+    }
+}
+
+void ConvMethodCache::SaveFile(const std::string& cacheFile) const {
+    std::ofstream file{cacheFile, std::ios::trunc};
+    for (auto&& entry : _methods) {
+        file << entry.first << ' ' << MethodName(entry.second) << '\n';
+    }
+}
+
+ConvMethod ConvMethodCache::Select(const arm_compute::ITensorInfo* input,
+                                   const arm_compute::ITensorInfo* weights,
+                                   const arm_compute::ITensorInfo* biases,
+                                   const arm_compute::ITensorInfo* output,
+                                   const arm_compute::PadStrideInfo& conv_info,
+                                   const arm_compute::Size2D& dilation,
+                                   const arm_compute::ActivationLayerInfo& act_info,
+                                   const bool enable_fast_math,
+                                   const std::string& cacheFile) {
+    const auto key = MakeKey(input, weights, output, conv_info, dilation, act_info, enable_fast_math);
+    std::lock_guard<std::mutex> lock{_mutex};
+    if (!cacheFile.empty() && _loadedFiles.emplace(cacheFile).second) {
+        LoadFile(cacheFile);
+    }
+    auto it = _methods.find(key);
+    if (it != _methods.end()) {
+        return it->second;
+    }
+    const auto method = Benchmark(input, weights, biases, output, conv_info, dilation, act_info, enable_fast_math);
+    _methods.emplace(key, method);
+    if (!cacheFile.empty()) {
+        SaveFile(cacheFile);
+    }
+    return method;
+}
@@ -0,0 +1,64 @@
+// Copyright (C) 2020-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+
+#include <arm_compute/core/TensorInfo.h>
+#include <arm_compute/core/Types.h>
+
+namespace ArmPlugin {
+
+// The ACL convolution algorithm forced for a layer; Auto leaves the choice
+// to NEConvolutionLayer's static heuristics
+enum class ConvMethod {
+    Auto,
+    Gemm,
+    Winograd,
+    Direct,
+};
+
+/**
+ * Benchmark-at-load selection of the ACL convolution algorithm: ACL's static
+ * heuristics pick between GEMM, Winograd and direct kernels from shape rules
+ * that are wrong for some layer shapes depending on the core, so with the
+ * CONV_METHOD_TUNING config key each convolution is timed once on every
+ * candidate and the fastest one is dispatched. Winners are keyed by the layer
+ * signature and the CPU part number and persist in the file named by
+ * CONV_METHOD_CACHE_FILE, so later loads (and other processes on the same
+ * part) skip the benchmark
+ */
+class ConvMethodCache {
+public:
+    static ConvMethodCache& Instance();
+
+    ConvMethodCache(const ConvMethodCache&) = delete;
+    ConvMethodCache& operator=(const ConvMethodCache&) = delete;
+
+    ConvMethod Select(const arm_compute::ITensorInfo* input,
+                      const arm_compute::ITensorInfo* weights,
+                      const arm_compute::ITensorInfo* biases,
+                      const arm_compute::ITensorInfo* output,
+                      const arm_compute::PadStrideInfo& conv_info,
+                      const arm_compute::Size2D& dilation,
+                      const arm_compute::ActivationLayerInfo& act_info,
+                      bool enable_fast_math,
+                      const std::string& cacheFile);
+
+private:
+    ConvMethodCache() = default;
+
+    void LoadFile(const std::string& cacheFile);
+    void SaveFile(const std::string& cacheFile) const;
+
+    std::mutex                                  _mutex;
+    std::unordered_set<std::string>             _loadedFiles;
+    std::unordered_map<std::string, ConvMethod> _methods;
+};
+
+}  // namespace ArmPlugin
@@ -2,9 +2,13 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <cstring>
+
 #include <ie_algorithm.hpp>
+#include <ie_parallel.hpp>
 
 #include "arm_converter/arm_converter.hpp"
+#include "arm_node_validate_cache.hpp"
 #include "opset/opset.hpp"
 
 using namespace InferenceEngine::details;
@@ -43,12 +47,45 @@ std::size_t AxisCast(const std::size_t axis, const std::size_t shapeSize) {
     return shapeSize - axis - 1;
 }
 
-Converter::Converter(const std::shared_ptr<const ov::Model> model, const Configuration& cfg) :
-    _model{model}, _cfg{cfg} {
+void RepackTensorData(const arm_compute::ITensor& src, arm_compute::ITensor& dst) {
+    const auto* srcInfo = src.info();
+    const auto* dstInfo = dst.info();
+    const auto& shape = srcInfo->tensor_shape();
+    const std::size_t rowBytes = shape[0] * srcInfo->element_size();
+    std::size_t rows = 1;
+    for (std::size_t dim = 1; dim < shape.num_dimensions(); ++dim) {
+        rows *= shape[dim];
+    }
+    const auto& srcStrides = srcInfo->strides_in_bytes();
+    const auto& dstStrides = dstInfo->strides_in_bytes();
+    const auto* srcBase = src.buffer() + srcInfo->offset_first_element_in_bytes();
+    auto* dstBase = dst.buffer() + dstInfo->offset_first_element_in_bytes();
+    const auto numChunks = std::min<std::size_t>(rows, static_cast<std::size_t>(parallel_get_max_threads()));
+    InferenceEngine::parallel_for(numChunks, [&] (int chunk) {
+        for (std::size_t row = rows * chunk / numChunks; row < rows * (chunk + 1) / numChunks; ++row) {
+            std::size_t srcOffset = 0;
+            std::size_t dstOffset = 0;
+            std::size_t index = row;
+            for (std::size_t dim = 1; dim < shape.num_dimensions(); ++dim) {
+                const auto coord = index % shape[dim];
+                index /= shape[dim];
+                srcOffset += coord * srcStrides[dim];
+                dstOffset += coord * dstStrides[dim];
+            }
+            std::memcpy(dstBase + dstOffset, srcBase + srcOffset, rowBytes);
+        }
+    });
+}
+
+Converter::Converter(const std::shared_ptr<const ov::Model> model, const Configuration& cfg,
+                     const WeightsSharing::Ptr& weightsSharing) :
+    _model{model}, _cfg{cfg}, _weightsSharing{weightsSharing} {
     Register<opset::Parameter>();
     Register<opset::Constant>();
     Register<opset::ArmConvolution>();
+    Register<opset::ArmConvolutionNHWC>();
     Register<opset::ArmGroupConvolution>();
+    Register<opset::ArmDepthwiseSeparableConvolution>();
     Register<opset::v1::ArmAvgPool>();
     Register<opset::v1::ArmMaxPool>();
     Register<opset::Add>();
@@ -98,6 +135,8 @@ Converter::Converter(const std::shared_ptr<const ov::Model> model, const Configu
     Register<opset::ReduceProd>();
     Register<opset::ReduceMin>();
     Register<opset::ReduceMax>();
+    Register<opset::ReduceL1>();
+    Register<opset::ReduceL2>();
     Register<opset::ArmInterpolate>();
     Register<opset::ArmMVN>();
     Register<opset::ArmNormalizeL2>();
@@ -117,6 +156,8 @@ Converter::Converter(const std::shared_ptr<const ov::Model> model, const Configu
     Register<opset::ArmConcat>();
     Register<opset::ArmGather>();
     Register<opset::ArmFFT>();
+    Register<opset::ArmFFTConvolution>();
+    Register<opset::ArmCompareSelect>();
     Register<opset::ArmQuantize>();
     Register<opset::ArmDequantize>();
     if (_cfg._ref) {
@@ -201,12 +242,21 @@ Converter::Converter(const std::shared_ptr<const ov::Model> model, const Configu
         }
         if (!ngraph::op::is_output(node)) {
             for (auto&& output : node->outputs()) {
-                std::unique_ptr<arm_compute::Tensor> tensor(new arm_compute::Tensor);
                 auto tensorShape = ShapeCast(output.get_partial_shape().get_max_shape());
                 auto outputDataType = output.get_element_type();
                 auto quantizedOutput = (outputDataType == ngraph::element::u8 || outputDataType == ngraph::element::i8);
                 arm_compute::TensorInfo tensorInfo;
-                if (quantizedOutput && _cfg._lpt) {
+                auto itWeightsQI = node->get_rt_info().find("WeightsQuantizationInfo");
+                if (itWeightsQI != node->get_rt_info().end()) {
+                    // Compressed weights constant (see CompressWeights): typed
+                    // as symmetric int8 so NEDequantizationLayer dispatches the
+                    // per-channel or per-tensor kernel from the scales
+                    const auto& weightsQI = itWeightsQI->second.as<arm_compute::QuantizationInfo>();
+                    tensorInfo = {tensorShape, 1,
+                                  (weightsQI.scale().size() > 1) ? arm_compute::DataType::QSYMM8_PER_CHANNEL
+                                                                 : arm_compute::DataType::QSYMM8,
+                                  weightsQI};
+                } else if (quantizedOutput && _cfg._lpt) {
                     arm_compute::DataType dataType;
                     switch (outputDataType) {
                         case ngraph::element::Type_t::u8 : dataType = arm_compute::DataType::QASYMM8; break;
@@ -217,13 +267,143 @@ Converter::Converter(const std::shared_ptr<const ov::Model> model, const Configu
                 } else {
                     tensorInfo = {tensorShape, 1, DataTypeCast(output.get_element_type())};
                 }
-                tensor->allocator()->init(tensorInfo);
+                if (node->get_rt_info().count("DataLayoutNHWC") != 0) {
+                    // The tensor physically holds NHWC data (see ConvertLayoutNHWC),
+                    // so ACL dispatches its NHWC kernel variants
+                    tensorInfo.set_data_layout(arm_compute::DataLayout::NHWC);
+                }
+                std::shared_ptr<arm_compute::Tensor> tensor;
+                if ((_weightsSharing != nullptr) && ngraph::op::is_constant(node)) {
+                    // Constant tensors are owned by the network and shared read-only
+                    // by all its infer requests
+                    std::lock_guard<std::mutex> lock{_weightsSharing->_mutex};
+                    auto& sharedTensor = _weightsSharing->_constants[node->get_instance_id()];
+                    if (sharedTensor == nullptr) {
+                        sharedTensor = std::make_shared<arm_compute::Tensor>();
+                        sharedTensor->allocator()->init(tensorInfo);
+                    }
+                    tensor = sharedTensor;
+                } else {
+                    tensor = std::make_shared<arm_compute::Tensor>();
+                    tensor->allocator()->init(tensorInfo);
+                }
                 layer._outputs.emplace(output, Tensor{std::move(tensor)});
             }
         }
     }
 }
 
+// A slice along the axis is a single contiguous byte range (and a subtensor
+// view of it has dense strides) only when every dimension before the axis is 1
+static bool isContiguousSlice(const ngraph::Shape& shape, const std::size_t axis) {
+    for (std::size_t i = 0; i < axis; ++i) {
+        if (shape[i] != 1) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void Converter::SetupZeroCopyViews() {
+    auto tensorOf = [&] (const ngraph::Output<ngraph::Node>& output) -> Tensor& {
+        return _layers.at(output.get_node()->get_instance_id())._outputs.at(output);
+    };
+    auto feedsNetworkOutput = [] (const ngraph::Output<ngraph::Node>& output) {
+        auto targetInputs = output.get_target_inputs();
+        return std::any_of(std::begin(targetInputs), std::end(targetInputs), [] (auto& targetInput) {
+            return ngraph::op::is_output(targetInput.get_node());
+        });
+    };
+    // A view may only replace an output the plugin fully controls: not a
+    // parameter or constant, not read by a Result, not produced by another
+    // zero-copy node and not viewed already (no chained views)
+    auto viewable = [&] (const ngraph::Output<ngraph::Node>& output) {
+        auto node = output.get_node();
+        return !ngraph::op::is_constant(node) && !ngraph::op::is_parameter(node) &&
+               !feedsNetworkOutput(output) &&
+               (_zeroCopyNodes.count(node->get_instance_id()) == 0) &&
+               (tensorOf(output)._view == nullptr);
+    };
+    for (auto&& node : _model->get_ordered_ops()) {
+        if (auto concat = ov::as_type_ptr<opset::ArmConcat>(node)) {
+            const auto& outputShape = concat->get_output_shape(0);
+            auto axis = concat->get_axis();
+            if (axis < 0) {
+                axis += outputShape.size();
+            }
+            if ((concat->get_input_size() < 2) || !isContiguousSlice(outputShape, axis)) {
+                continue;
+            }
+            bool eligible = (tensorOf(concat->output(0))._view == nullptr);
+            for (auto&& input : concat->inputs()) {
+                auto source = input.get_source_output();
+                eligible = eligible && (source.get_target_inputs().size() == 1) && viewable(source);
+            }
+            if (!eligible) {
+                continue;
+            }
+            auto& parent = tensorOf(concat->output(0));
+            const auto aclAxis = AxisCast(axis, outputShape.size());
+            // A network output tensor imports the user blob every inference
+            // instead of being pool managed, so the producers writing into it
+            // through their views need no lifetime bookkeeping for it
+            const bool isNetworkOutput = feedsNetworkOutput(concat->output(0));
+            std::size_t offset = 0;
+            for (auto&& input : concat->inputs()) {
+                auto source = input.get_source_output();
+                arm_compute::Coordinates coords;
+                coords.set_num_dimensions(outputShape.size());
+                coords.set(aclAxis, static_cast<int>(offset));
+                tensorOf(source)._view = std::make_shared<arm_compute::SubTensor>(
+                    parent._tensor.get(), ShapeCast(input.get_shape()), coords);
+                if (!isNetworkOutput) {
+                    _viewParents.emplace(source, concat->output(0));
+                }
+                offset += input.get_shape()[axis];
+            }
+            _zeroCopyNodes.emplace(concat->get_instance_id());
+        } else if (auto split = ov::as_type_ptr<opset::ArmSplit>(node)) {
+            if (split->get_output_size() < 2) {
+                continue;
+            }
+            const auto& inputShape = split->get_input_shape(0);
+            auto axis = static_cast<std::int64_t>(safe_cast<opset::Constant>(
+                split->input_value(1).get_node())->cast_vector<std::int32_t>()[0]);
+            if (axis < 0) {
+                axis += inputShape.size();
+            }
+            if (!isContiguousSlice(inputShape, axis)) {
+                continue;
+            }
+            auto source = split->input_value(0);
+            bool eligible = viewable(source);
+            for (auto&& output : split->outputs()) {
+                eligible = eligible && !feedsNetworkOutput(output);
+            }
+            if (!eligible) {
+                continue;
+            }
+            auto& parent = tensorOf(source);
+            const auto aclAxis = AxisCast(axis, inputShape.size());
+            std::size_t offset = 0;
+            std::size_t extraRefs = 0;
+            for (auto&& output : split->outputs()) {
+                arm_compute::Coordinates coords;
+                coords.set_num_dimensions(inputShape.size());
+                coords.set(aclAxis, static_cast<int>(offset));
+                tensorOf(output)._view = std::make_shared<arm_compute::SubTensor>(
+                    parent._tensor.get(), ShapeCast(output.get_shape()), coords);
+                _viewSources.emplace(output, source);
+                offset += output.get_shape()[axis];
+                extraRefs += output.get_target_inputs().size();
+            }
+            // The source has to stay alive until the last reader of any slice
+            _viewExtraRefs[source] += extraRefs;
+            _zeroCopyNodes.emplace(split->get_instance_id());
+        }
+    }
+}
+
 Layer::Map Converter::Configure(const std::shared_ptr<arm_compute::IMemoryManager>& memoryManager,
                                 arm_compute::MemoryGroup& memoryGroup) {
     auto orderedOps = _model->get_ordered_ops();
@@ -236,63 +416,134 @@ Layer::Map Converter::Configure(const std::shared_ptr<arm_compute::IMemoryManage
     if (!unsupported.empty()) {
         IE_THROW() << "Arm Plugin: Nodes from " << _model->get_friendly_name() << " are not supported by plugin:\n" << unsupported;
     }
-    for (const auto& node : orderedOps) {
+    SetupZeroCopyViews();
+    // Conversion creation and validation (the expensive ACL kernel selection
+    // checks) are independent per node, so they run in parallel; the configure
+    // pass below stays sequential since memory lifetime registration and
+    // padding backpropagation depend on the topological order
+    std::vector<std::string> errors(orderedOps.size());
+    InferenceEngine::parallel_for(orderedOps.size(), [&] (std::size_t opId) {
+        const auto& node = orderedOps[opId];
+        if (_zeroCopyNodes.count(node->get_instance_id()) != 0) {
+            return;
+        }
         Conversion::Ptr conversion;
         try {
             conversion = _conversions.at(node->get_type_info())(*node);
         } catch(std::exception& e) {
-            unsupported += ("\t" + node->get_friendly_name() +
+            errors[opId] = ("\t" + node->get_friendly_name() +
                 " (" + node->get_type_name() + '.' + node->get_type_info().version_id + ")- " + e.what() + ";\n");
+            return;
         }
         if (conversion != nullptr) {
-            auto status = conversion->Validate();
+            // Structurally identical layers of repeated blocks share one verdict
+            auto status = NodeValidateCache::Instance().Validate(
+                *node, _cfg._fastMath ? "fm" : "", [&] { return conversion->Validate(); });
             if (status.error_code() != arm_compute::ErrorCode::OK) {
-                unsupported += ("\t" + node->get_friendly_name() +
+                errors[opId] = ("\t" + node->get_friendly_name() +
                     " (" + node->get_type_name() + '.' + node->get_type_info().version_id + ")- " + status.error_description() + ";\n");
             }
         }
+    });
+    for (auto&& error : errors) {
+        unsupported += error;
     }
     if (!unsupported.empty()) {
         IE_THROW() << "Arm Plugin: Nodes from " << _model->get_friendly_name() << " are not supported:\n" << unsupported;
     }
     std::map<ngraph::Output<ngraph::Node>, std::size_t> counter;
+    // A split source is referenced not only by its direct consumers but also by
+    // every consumer of the views borrowing its storage
+    auto initialRefs = [&] (const ngraph::Output<ngraph::Node>& output) {
+        auto refs = output.get_target_inputs().size();
+        auto itExtra = _viewExtraRefs.find(output);
+        if (itExtra != _viewExtraRefs.end()) {
+            refs += itExtra->second;
+        }
+        return refs;
+    };
     for (auto&& node : orderedOps) {
         const auto& nodeID = node->get_instance_id();
         if (ngraph::op::is_constant(node)) {
             auto constNode = safe_cast<opset::Constant>(node);
-            _layers.at(nodeID)._outputs.begin()->second._tensor->allocator()->import_memory(const_cast<void*>(constNode->get_data_ptr()));
+            auto& tensor = _layers.at(nodeID)._outputs.begin()->second._tensor;
+            // A shared constant tensor is already imported by the request created first
+            if (tensor->buffer() == nullptr) {
+                tensor->allocator()->import_memory(const_cast<void*>(constNode->get_data_ptr()));
+            }
         } else if (!ngraph::op::is_parameter(node) && !ngraph::op::is_output(node)) {
-            auto conversion = _conversions.at(node->get_type_info())(*node);
+            auto conversion = (_zeroCopyNodes.count(nodeID) != 0) ? Conversion::Ptr{}
+                                                                  : _conversions.at(node->get_type_info())(*node);
+            for (auto&& output : node->outputs()) {
+                // A concat destination written through views starts its lifetime
+                // at its first producer rather than at the concat node itself
+                auto itParent = _viewParents.find(output);
+                if (itParent != _viewParents.end()) {
+                    const auto& parentOutput = itParent->second;
+                    if (counter.emplace(parentOutput, initialRefs(parentOutput)).second) {
+                        memoryGroup.manage(_layers.at(parentOutput.get_node()->get_instance_id())._outputs.at(parentOutput)._tensor.get());
+                    }
+                }
+            }
             for (auto&& output : node->outputs()) {
                 auto targetInputs = output.get_target_inputs();
                 bool isNetworkOutput = std::any_of(std::begin(targetInputs), std::end(targetInputs), [] (auto& targetInput) {
                     return ngraph::op::is_output(targetInput.get_node());
                 });
-                if (!isNetworkOutput) {
-                    counter.emplace(output, targetInputs.size());
-                    memoryGroup.manage(_layers.at(nodeID)._outputs.at(output)._tensor.get());
+                auto& tensor = _layers.at(nodeID)._outputs.at(output);
+                // An output bound as a view allocates nothing; a concat
+                // destination may already be managed at its first producer
+                if (!isNetworkOutput && (tensor._view == nullptr)) {
+                    if (counter.emplace(output, initialRefs(output)).second) {
+                        memoryGroup.manage(tensor._tensor.get());
+                    }
                 }
             }
             if (conversion != nullptr) {
                 _layers.at(nodeID)._execType = conversion->ExecType();
-                conversion->Configure(memoryManager);
+                conversion->Configure(memoryManager,
+                                      (_weightsSharing != nullptr) ? _weightsSharing->_weightsManager.get() : nullptr);
+                auto& function = _layers.at(nodeID)._function;
+                // Pack/reorder constant weights now, rather than on the first run()
+                // of every request: the copy packed by the request created first is
+                // shared through the weights manager with all the others
+                if ((function != nullptr) && (_weightsSharing != nullptr)) {
+                    auto inputs = node->inputs();
+                    auto constantWeights = (inputs.size() > 1) &&
+                        std::all_of(std::next(inputs.begin()), inputs.end(), [] (auto& input) {
+                            return ngraph::op::is_constant(input.get_source_output().get_node());
+                        });
+                    if (constantWeights) {
+                        function->prepare();
+                    }
+                }
             }
 
             for (auto&& input : node->inputs()) {
                 auto tensor = _layers.at(input.get_node()->get_instance_id())._inputs.at(input);
+                // Managed on the broad has_padding predicate, not NeedsRepack: a
+                // later-configured consumer may still stride the data by extending
+                // the padding, and then the shadow has to exist. An unused shadow
+                // costs a pool slot but never a copy
                 if (tensor->_tensor->info()->has_padding() && (tensor->_notPaddedTensor != nullptr)) {
                     tensor->_notPaddedTensor->allocator()->init({tensor->_tensor->info()->tensor_shape(), 1, tensor->_tensor->info()->data_type()});
                     memoryGroup.manage(tensor->_notPaddedTensor.get());
                 }
             }
             for (auto&& input : node->inputs()) {
-                auto tensor = _layers.at(input.get_node()->get_instance_id())._inputs.at(input);
-                auto itCounter = counter.find(input.get_source_output());
+                auto sourceOutput = input.get_source_output();
+                // A consumer of a split view keeps the split's source alive
+                auto itRedirect = _viewSources.find(sourceOutput);
+                if (itRedirect != _viewSources.end()) {
+                    sourceOutput = itRedirect->second;
+                }
+                auto itCounter = counter.find(sourceOutput);
                 if (itCounter != counter.end()) {
                     if ((--(itCounter->second)) == 0) {
-                        tensor->_tensor->allocator()->allocate();
-                        if (tensor->_tensor->info()->has_padding() && (tensor->_notPaddedTensor != nullptr)) {
-                            tensor->_notPaddedTensor->allocator()->allocate();
+                        auto& tensor = _layers.at(sourceOutput.get_node()->get_instance_id())._outputs.at(sourceOutput);
+                        tensor._tensor->allocator()->allocate();
+                        if (tensor._tensor->info()->has_padding() && (tensor._notPaddedTensor != nullptr)) {
+                            tensor._notPaddedTensor->allocator()->allocate();
                         }
                         counter.erase(itCounter);
                     }
@@ -303,6 +554,19 @@ Layer::Map Converter::Configure(const std::shared_ptr<arm_compute::IMemoryManage
     return std::move(_layers);
 }
 
+void Converter::MaterializeConstants() {
+    IE_ASSERT(_weightsSharing != nullptr);
+    for (auto&& node : _model->get_ordered_ops()) {
+        if (ngraph::op::is_constant(node)) {
+            auto constNode = safe_cast<opset::Constant>(node);
+            auto& tensor = _layers.at(node->get_instance_id())._outputs.begin()->second._tensor;
+            if (tensor->buffer() == nullptr) {
+                tensor->allocator()->import_memory(const_cast<void*>(constNode->get_data_ptr()));
+            }
+        }
+    }
+}
+
 template<> Converter::Conversion::Ptr Converter::Convert(const opset::Parameter& node) {
     return {};
 }
@@ -7,12 +7,20 @@
 #include <openvino/util/pp.hpp>
 #include <ie_common.h>
 #include <ie_algorithm.hpp>
+#include <ie_parallel.hpp>
 #include <ngraph/function.hpp>
 
 #include <arm_compute/runtime/IFunction.h>
+#include <arm_compute/runtime/IWeightsManager.h>
 #include <arm_compute/runtime/Tensor.h>
+#include <arm_compute/runtime/SubTensor.h>
+
+#include <mutex>
+#include <unordered_map>
+#include <unordered_set>
 
 #include "arm_config.hpp"
+#include "arm_converter/arm_scratch_arena.hpp"
 #include "opset/opset.hpp"
 
 
@@ -69,10 +77,57 @@ struct Output : ngraph::Output<ngraph::Node> {
 };
 
 struct Tensor {
-    std::unique_ptr<arm_compute::Tensor>    _tensor;
+    // shared_ptr, so the constant (weight) tensors can be owned by the network
+    // and referenced by every infer request; intermediate tensors stay unshared
+    std::shared_ptr<arm_compute::Tensor>    _tensor;
     std::unique_ptr<arm_compute::Tensor>    _notPaddedTensor;
+    // Zero-copy Concat/Split: a view into another tensor's allocation; when it
+    // is set kernels are configured on the view and _tensor owns no storage
+    std::shared_ptr<arm_compute::SubTensor> _view;
 };
 
+// The tensor a kernel has to be configured on: the subtensor view when the
+// output is bound into another allocation, the own tensor otherwise
+inline arm_compute::ITensor* EffectiveTensor(const Tensor& tensor) {
+    if (tensor._view != nullptr) {
+        return tensor._view.get();
+    }
+    return tensor._tensor.get();
+}
+
+// Whether a padded tensor still stores its elements densely: padding that only
+// trails the data (e.g. bottom rows requested for vector overruns) extends the
+// allocation without striding it, so reference implementations can run on the
+// buffer directly
+inline bool HasDenseData(const arm_compute::ITensorInfo* info) {
+    if (info->offset_first_element_in_bytes() != 0) {
+        return false;
+    }
+    const auto& shape = info->tensor_shape();
+    const auto& strides = info->strides_in_bytes();
+    std::size_t denseStride = info->element_size();
+    for (std::size_t dim = 0; dim < shape.num_dimensions(); ++dim) {
+        if (strides[dim] != denseStride) {
+            return false;
+        }
+        denseStride *= shape[dim];
+    }
+    return true;
+}
+
+// A reference argument needs the dense shadow tensor only when the padding
+// actually strides the data
+inline bool NeedsRepack(const arm_compute::ITensorInfo* info) {
+    return info->has_padding() && !HasDenseData(info);
+}
+
+/**
+ * Repacks between a padded ACL tensor and its dense shadow with row-level
+ * memcpy chunks split across the inference thread pool, instead of the
+ * single-threaded element-wise copy_from
+ */
+void RepackTensorData(const arm_compute::ITensor& src, arm_compute::ITensor& dst);
+
 template<typename Arg>
 struct Argument {
     operator Arg() {
@@ -95,10 +150,10 @@ struct Argument<Tensor*> {
     }
     template<typename T, typename = std::enable_if_t<std::is_arithmetic<T>::value || std::is_same<ngraph::float16, T>::value>>
     operator T*() {
-        if (_tensor->_tensor->info()->has_padding()) {
+        if (NeedsRepack(_tensor->_tensor->info())) {
             return static_cast<T*>(static_cast<void*>(_tensor->_notPaddedTensor->buffer()));
         } else {
-            return static_cast<T*>(static_cast<void*>(_tensor->_tensor->buffer()));
+            return static_cast<T*>(static_cast<void*>(EffectiveTensor(*_tensor)->buffer()));
         }
     }
 
@@ -155,19 +210,99 @@ static std::size_t GetNodeId(const std::vector<ngraph::Output<const ngraph::Node
     return outputs.front().get_node()->get_instance_id();
 }
 
-template<typename ACFunction, bool Flag>
+template<typename Callable, typename... Arguments>
+void RunReferenceSlices(Callable& callable, const std::size_t total, Arguments ... args) {
+    const auto num_chunks = std::min<std::size_t>(total, static_cast<std::size_t>(parallel_get_max_threads()));
+    if (num_chunks <= 1) {
+        callable(std::size_t{0}, total, args...);
+        return;
+    }
+    InferenceEngine::parallel_for(num_chunks, [&] (int chunk) {
+        callable(total * chunk / num_chunks, total * (chunk + 1) / num_chunks, args...);
+    });
+}
+
+template<typename Callable, typename Signature>
+struct ParallelReferenceImpl;
+
+template<typename Callable, typename ClassType, typename ReturnType, typename... Arguments>
+struct ParallelReferenceImpl<Callable, ReturnType(ClassType::*)(std::size_t, std::size_t, Arguments...) const> {
+    void operator()(Arguments ... args) {
+        RunReferenceSlices(_callable, _total, args...);
+    }
+    std::decay_t<Callable>  _callable;
+    std::size_t             _total;
+};
+
+template<typename Callable, typename ClassType, typename ReturnType, typename... Arguments>
+struct ParallelReferenceImpl<Callable, ReturnType(ClassType::*)(std::size_t, std::size_t, Arguments...)> {
+    void operator()(Arguments ... args) {
+        RunReferenceSlices(_callable, _total, args...);
+    }
+    std::decay_t<Callable>  _callable;
+    std::size_t             _total;
+};
+
+template<typename Callable, typename ReturnType, typename... Arguments>
+struct ParallelReferenceImpl<Callable, ReturnType(*)(std::size_t, std::size_t, Arguments...)> {
+    void operator()(Arguments ... args) {
+        RunReferenceSlices(_callable, _total, args...);
+    }
+    std::decay_t<Callable>  _callable;
+    std::size_t             _total;
+};
+
+template<typename Callable, typename = void>
+struct ParallelReferenceSignature {
+    using type = decltype(&std::decay_t<Callable>::operator());
+};
+template<typename Callable>
+struct ParallelReferenceSignature<Callable, std::enable_if_t<std::is_pointer<std::decay_t<Callable>>::value>> {
+    using type = std::decay_t<Callable>;
+};
+
+template<typename Callable>
+using ParallelReference = ParallelReferenceImpl<Callable, typename ParallelReferenceSignature<Callable>::type>;
+
+/**
+ * Wraps a range-aware reference implementation so its work is split in
+ * contiguous chunks of [0, total) across the inference thread pool - the same
+ * pool IEScheduler::run_workloads dispatches ACL workloads on - instead of
+ * running on a single thread while the other cores idle. The callable must
+ * take (begin, end) as its two leading parameters, followed by the usual
+ * converter arguments, and must only touch the output slice [begin, end); the
+ * wrapper then exposes the trailing parameters as its own signature, so it
+ * drops into MakeConversion and CallSwitch exactly like the plain reference
+ * function it replaces.
+ */
+template<typename Callable>
+auto MakeParallelReference(const std::size_t total, Callable&& callable) {
+    return ParallelReference<Callable>{std::forward<Callable>(callable), total};
+}
+
+template<typename ACFunction, bool HasWeightsManager, bool HasMemoryManager>
 struct MakeFunction;
 
+template<typename ACFunction, bool HasMemoryManager>
+struct MakeFunction<ACFunction, true, HasMemoryManager> {
+    static auto Make(const std::shared_ptr<arm_compute::IMemoryManager>& memoryManager,
+                     arm_compute::IWeightsManager* weightsManager) {
+        return std::make_unique<ACFunction>(memoryManager, weightsManager);
+    }
+};
+
 template<typename ACFunction>
-struct MakeFunction<ACFunction, true> {
-    static auto Make(const std::shared_ptr<arm_compute::IMemoryManager>& memoryManager) {
+struct MakeFunction<ACFunction, false, true> {
+    static auto Make(const std::shared_ptr<arm_compute::IMemoryManager>& memoryManager,
+                     arm_compute::IWeightsManager*) {
         return std::make_unique<ACFunction>(memoryManager);
     }
 };
 
 template<typename ACFunction>
-struct MakeFunction<ACFunction, false> {
-    static auto Make(const std::shared_ptr<arm_compute::IMemoryManager>&) {
+struct MakeFunction<ACFunction, false, false> {
+    static auto Make(const std::shared_ptr<arm_compute::IMemoryManager>&,
+                     arm_compute::IWeightsManager*) {
         return std::make_unique<ACFunction>();
     }
 };
@@ -177,7 +312,8 @@ struct Converter {
         using Ptr = std::unique_ptr<Conversion>;
         virtual ~Conversion() = default;
         virtual arm_compute::Status Validate() = 0;
-        virtual void Configure(const std::shared_ptr<arm_compute::IMemoryManager>&) = 0;
+        virtual void Configure(const std::shared_ptr<arm_compute::IMemoryManager>&,
+                               arm_compute::IWeightsManager* weightsManager) = 0;
         virtual std::string ExecType() const = 0;
     };
     template<typename ACFunction, typename... Args>
@@ -212,14 +348,17 @@ struct Converter {
         }
 
         template<std::size_t... I>
-        void ConfigureImpl(const std::shared_ptr<arm_compute::IMemoryManager>& memoryManager, std::index_sequence<I...>) {
+        void ConfigureImpl(const std::shared_ptr<arm_compute::IMemoryManager>& memoryManager,
+                           arm_compute::IWeightsManager* weightsManager, std::index_sequence<I...>) {
             auto function = MakeFunction<ACFunction,
-                std::is_constructible<ACFunction, std::shared_ptr<arm_compute::IMemoryManager>>::value>::Make(memoryManager);
+                std::is_constructible<ACFunction, std::shared_ptr<arm_compute::IMemoryManager>, arm_compute::IWeightsManager*>::value,
+                std::is_constructible<ACFunction, std::shared_ptr<arm_compute::IMemoryManager>>::value>::Make(memoryManager, weightsManager);
             function->configure(MakeConversionArg(std::get<I>(_args))...);
             _converter._layers.at(GetNodeId(std::get<0>(_args)))._function = std::move(function);
         }
-        void Configure(const std::shared_ptr<arm_compute::IMemoryManager>& memoryManager) override {
-            ConfigureImpl(memoryManager, std::make_index_sequence<sizeof...(Args)>{});
+        void Configure(const std::shared_ptr<arm_compute::IMemoryManager>& memoryManager,
+                       arm_compute::IWeightsManager* weightsManager) override {
+            ConfigureImpl(memoryManager, weightsManager, std::make_index_sequence<sizeof...(Args)>{});
         }
         Converter&                          _converter;
         std::tuple<std::decay_t<Args>...>   _args;
@@ -254,11 +393,11 @@ struct Converter {
             void CopyArgument(ArgumentType, T&&) {}
 
             void CopyArgument(ArgumentType type, Argument<Tensor*>& tensorArgument) {
-                if (tensorArgument._tensor->_tensor->info()->has_padding()) {
+                if (NeedsRepack(tensorArgument._tensor->_tensor->info())) {
                     if (tensorArgument._type == type) {
                         switch (type) {
-                        case ArgumentType::Input  : tensorArgument._tensor->_notPaddedTensor->copy_from(*(tensorArgument._tensor->_tensor)); break;
-                        case ArgumentType::Output : tensorArgument._tensor->_tensor->copy_from(*(tensorArgument._tensor->_notPaddedTensor)); break;
+                        case ArgumentType::Input  : RepackTensorData(*(tensorArgument._tensor->_tensor), *(tensorArgument._tensor->_notPaddedTensor)); break;
+                        case ArgumentType::Output : RepackTensorData(*(tensorArgument._tensor->_notPaddedTensor), *(tensorArgument._tensor->_tensor)); break;
                         }
                     }
                 }
@@ -274,14 +413,14 @@ struct Converter {
                                                     hostsArgument._hosts[i]->get_shape(),
                                                     tensor_ptr);
                     }
-                    if (hostsArgument._tensors[i]->_tensor->info()->has_padding()) {
+                    if (NeedsRepack(hostsArgument._tensors[i]->_tensor->info())) {
                         if (hostsArgument._type == type) {
                             switch (type) {
                             case ArgumentType::Input  :
-                                hostsArgument._tensors[i]->_notPaddedTensor->copy_from(*(hostsArgument._tensors[i]->_tensor));
+                                RepackTensorData(*(hostsArgument._tensors[i]->_tensor), *(hostsArgument._tensors[i]->_notPaddedTensor));
                                 break;
                             case ArgumentType::Output :
-                                hostsArgument._tensors[i]->_tensor->copy_from(*(hostsArgument._tensors[i]->_notPaddedTensor));
+                                RepackTensorData(*(hostsArgument._tensors[i]->_notPaddedTensor), *(hostsArgument._tensors[i]->_tensor));
                                 break;
                             }
                         }
@@ -386,7 +525,8 @@ struct Converter {
             auto function = makeCallableFunction(_callable, MakeArgument<I>(std::get<I>(_args))...);
             _converter._layers.at(GetNodeId(std::get<0>(_args)))._function = std::move(function);
         }
-        void Configure(const std::shared_ptr<arm_compute::IMemoryManager>&) override {
+        void Configure(const std::shared_ptr<arm_compute::IMemoryManager>&,
+                       arm_compute::IWeightsManager*) override {
             ConfigureImpl(std::make_index_sequence<sizeof...(Args)>{});
         }
 
@@ -400,14 +540,53 @@ struct Converter {
         return std::make_unique<ConversionCallableImpl<Callable, Args...>>(*this, std::forward<Callable>(callable), std::forward<Args>(args)...);
     }
 
-    Converter(const std::shared_ptr<const ov::Model> model, const Configuration& cfg);
+    /**
+     * LoadNetwork-lifetime state shared by every infer request of a network: the
+     * constant (weight) tensors imported once from the model, and the ACL weights
+     * manager owning their packed/reordered copies. The first request to prepare
+     * a function packs the weights, all the others reuse them read-only
+     */
+    struct WeightsSharing {
+        using Ptr = std::shared_ptr<WeightsSharing>;
+        std::shared_ptr<arm_compute::IWeightsManager>                           _weightsManager
+                                                            = std::make_shared<arm_compute::IWeightsManager>();
+        std::mutex                                                              _mutex;
+        std::unordered_map<std::size_t, std::shared_ptr<arm_compute::Tensor>>   _constants;
+    };
+
+    Converter(const std::shared_ptr<const ov::Model> model, const Configuration& cfg,
+              const WeightsSharing::Ptr& weightsSharing = nullptr);
 
     Layer::Map Configure(const std::shared_ptr<arm_compute::IMemoryManager>& memoryManager,
                          arm_compute::MemoryGroup& memoryGroup);
 
+    /**
+     * Imports the model's constant data into the shared constant tensors at
+     * LoadNetwork time, so infer requests only allocate the mutable and
+     * intermediate tensors through their memory managers
+     */
+    void MaterializeConstants();
+
+    /**
+     * Binds eligible Concat inputs and Split outputs as subtensor views into the
+     * destination/source allocation, so the producers write (readers read) the
+     * concatenated data in place and the copying kernels are dropped. Only
+     * contiguous slices are bound: every dimension before the axis must be 1
+     */
+    void SetupZeroCopyViews();
+
     template<typename NodeType>
     Conversion::Ptr Convert(const NodeType& node);
 
+    /**
+     * Whether the ACL fast_math mode (bf16 dot-product kernels on cores with the
+     * BF16 extension) may be enabled for this node: requires the FAST_MATH config
+     * key and no "DisableFastMath" entry in the node's rt_info (per-layer opt-out)
+     */
+    bool FastMathAllowed(const ngraph::Node& node) const {
+        return _cfg._fastMath && (node.get_rt_info().count("DisableFastMath") == 0);
+    }
+
     using ConvertFn = std::function<Conversion::Ptr(const ngraph::Node&)>;
     template<typename NodeType>
     void Register() {
@@ -420,18 +599,34 @@ struct Converter {
     }
 
     const Configuration                             _cfg;
+    WeightsSharing::Ptr                             _weightsSharing;
+    // Per-request scratch for reference-fallback temporaries: passed to the
+    // callables as an ordinary argument, whose stored copy keeps it alive for
+    // the lifetime of the configured functions
+    ScratchArena::Ptr                               _scratch = std::make_shared<ScratchArena>();
     std::map<ngraph::Node::type_info_t, ConvertFn>  _conversions;
     std::shared_ptr<const ov::Model>                _model;
     Layer::Map                                      _layers;
+    // Concat/Split nodes whose data movement is performed through subtensor
+    // views; they get no conversion and no function to run
+    std::unordered_set<std::size_t>                                     _zeroCopyNodes;
+    // Split output -> split source: a consumer of a borrowed view has to keep
+    // the original allocation alive instead of the view's tensor
+    std::map<ngraph::Output<ngraph::Node>, ngraph::Output<ngraph::Node>> _viewSources;
+    // Producer output -> concat destination: the destination's lifetime starts
+    // at its first producer, which already writes into it through the view
+    std::map<ngraph::Output<ngraph::Node>, ngraph::Output<ngraph::Node>> _viewParents;
+    // References added to a split source for the consumers of its views
+    std::map<ngraph::Output<ngraph::Node>, std::size_t>                  _viewExtraRefs;
 };
 
 template<>
 struct ConversionArg<ngraph::Input<const ngraph::Node>&> {
     operator arm_compute::ITensorInfo*() {
-        return _converter._layers.at(_input.get_node()->get_instance_id())._inputs.at(_input)->_tensor->info();
+        return EffectiveTensor(*(_converter._layers.at(_input.get_node()->get_instance_id())._inputs.at(_input)))->info();
     }
     operator arm_compute::ITensor*() {
-        return _converter._layers.at(_input.get_node()->get_instance_id())._inputs.at(_input)->_tensor.get();
+        return EffectiveTensor(*(_converter._layers.at(_input.get_node()->get_instance_id())._inputs.at(_input)));
     }
     Converter&                    _converter;
     ngraph::Input<const ngraph::Node>&  _input;
@@ -440,10 +635,10 @@ struct ConversionArg<ngraph::Input<const ngraph::Node>&> {
 template<>
 struct ConversionArg<ngraph::Output<const ngraph::Node>&> {
     operator arm_compute::ITensorInfo*() {
-        return _converter._layers.at(_output.get_node()->get_instance_id())._outputs.at(_output)._tensor->info();
+        return EffectiveTensor(_converter._layers.at(_output.get_node()->get_instance_id())._outputs.at(_output))->info();
     }
     operator arm_compute::ITensor*() {
-        return _converter._layers.at(_output.get_node()->get_instance_id())._outputs.at(_output)._tensor.get();
+        return EffectiveTensor(_converter._layers.at(_output.get_node()->get_instance_id())._outputs.at(_output));
     }
     Converter&                    _converter;
     ngraph::Output<const ngraph::Node>&  _output;
@@ -454,14 +649,14 @@ struct ConversionArg<std::vector<ngraph::Input<const ngraph::Node>>&> {
     operator std::vector<const arm_compute::ITensorInfo*>() const {
         std::vector<const arm_compute::ITensorInfo*> infos;
         for (auto&& input : _inputs) {
-            infos.emplace_back(_converter._layers.at(input.get_node()->get_instance_id())._inputs.at(input)->_tensor->info());
+            infos.emplace_back(EffectiveTensor(*(_converter._layers.at(input.get_node()->get_instance_id())._inputs.at(input)))->info());
         }
         return infos;
     }
     operator std::vector<const arm_compute::ITensor*>() const {
         std::vector<const arm_compute::ITensor*> tensors;
         for (auto&& input : _inputs) {
-            tensors.emplace_back(_converter._layers.at(input.get_node()->get_instance_id())._inputs.at(input)->_tensor.get());
+            tensors.emplace_back(EffectiveTensor(*(_converter._layers.at(input.get_node()->get_instance_id())._inputs.at(input))));
         }
         return tensors;
     }
@@ -473,14 +668,14 @@ struct ConversionArg<std::vector<ngraph::Output<const ngraph::Node>>&> {
     operator std::vector<arm_compute::ITensorInfo*>() const {
         std::vector<arm_compute::ITensorInfo*> infos;
         for (auto&& output : _outputs) {
-            infos.emplace_back(_converter._layers.at(output.get_node()->get_instance_id())._outputs.at(output)._tensor->info());
+            infos.emplace_back(EffectiveTensor(_converter._layers.at(output.get_node()->get_instance_id())._outputs.at(output))->info());
         }
         return infos;
     }
     operator std::vector<arm_compute::ITensor*>() const {
         std::vector<arm_compute::ITensor*> tensors;
         for (auto&& output : _outputs) {
-            tensors.emplace_back(_converter._layers.at(output.get_node()->get_instance_id())._outputs.at(output)._tensor.get());
+            tensors.emplace_back(EffectiveTensor(_converter._layers.at(output.get_node()->get_instance_id())._outputs.at(output)));
         }
         return tensors;
     }
@@ -16,6 +16,7 @@
 #include <ngraph/runtime/reference/tan.hpp>
 #include <ngraph/runtime/reference/tanh.hpp>
 #include "arm_converter/arm_converter.hpp"
+#include "arm_converter/arm_neon_math.hpp"
 
 namespace ArmPlugin {
 template<> Converter::Conversion::Ptr Converter::Convert(const opset::Acos& node) {
@@ -113,6 +114,13 @@ template<> Converter::Conversion::Ptr Converter::Convert(const opset::Tan& node)
 }
 
 template<> Converter::Conversion::Ptr Converter::Convert(const opset::Erf& node) {
+#if defined(__aarch64__)
+    if (node.get_input_element_type(0) == ngraph::element::f32) {
+        return MakeConversion(MakeParallelReference(ngraph::shape_size(node.get_output_shape(0)), neon::erf_f32),
+                              node.input(0),
+                              node.output(0));
+    }
+#endif
     auto make = [&] (auto refFunction) {
         return this->MakeConversion(refFunction, node.input(0), node.output(0), ngraph::shape_size(node.get_output_shape(0)));
     };
@@ -4,8 +4,21 @@
 
 #include <arm_compute/runtime/NEON/functions/NEBatchToSpaceLayer.h>
 #include "arm_converter/arm_converter.hpp"
+#include "arm_converter/arm_neon_space.hpp"
 
 namespace ArmPlugin {
+#if defined(__aarch64__)
+template <typename T>
+static void batch_to_space_rows(std::size_t begin, std::size_t end, const T* src, T* dst,
+                                const ngraph::Shape& srcShape, const ngraph::Shape& dstShape,
+                                const std::size_t blockY, const std::size_t blockX,
+                                const std::size_t cropTop, const std::size_t cropLeft) {
+    using U = neon::WidthTypeOf<T>;
+    neon::batch_to_space(begin, end, reinterpret_cast<const U*>(src), reinterpret_cast<U*>(dst),
+                         srcShape, dstShape, blockY, blockX, cropTop, cropLeft);
+}
+#endif
+
 template<> Converter::Conversion::Ptr Converter::Convert(const opset::BatchToSpace& node) {
     auto block_shape = safe_cast<opset::Constant>(node.input_value(1).get_node_shared_ptr());
     auto crops_begin = safe_cast<opset::Constant>(node.input_value(2).get_node_shared_ptr());
@@ -19,6 +32,33 @@ template<> Converter::Conversion::Ptr Converter::Convert(const opset::BatchToSpa
     auto end    = crops_end->cast_vector<int>();
     auto shapes = block_shape->cast_vector<int32_t>();
 
+#if defined(__aarch64__)
+    // ACL rejects spatial crops, common after TF dilated convolutions: cover
+    // them with interleaving block row copies, output rows split across the
+    // scheduler threads. A left crop only rotates which source batch feeds
+    // which interleave phase
+    if ((shapes[0] == 1) && (shapes[1] == 1) &&
+        (begin[0] == 0) && (begin[1] == 0) && (end[0] == 0) && (end[1] == 0) &&
+        ((begin[2] != 0) || (begin[3] != 0) || (end[2] != 0) || (end[3] != 0))) {
+        const auto& srcShape = node.get_input_shape(0);
+        const auto& dstShape = node.get_output_shape(0);
+        const auto rows = dstShape[0] * dstShape[1] * dstShape[2];
+        auto make = [&] (auto kernel) {
+            return this->MakeConversion(MakeParallelReference(rows, kernel),
+                                        node.input(0),
+                                        node.output(0),
+                                        srcShape,
+                                        dstShape,
+                                        static_cast<std::size_t>(shapes[2]),
+                                        static_cast<std::size_t>(shapes[3]),
+                                        static_cast<std::size_t>(begin[2]),
+                                        static_cast<std::size_t>(begin[3]));
+        };
+        return CallSwitch(
+            AP_WRAP(make, batch_to_space_rows),
+            node.input(0), merge(allTypes, boolType));
+    }
+#endif
     if (!std::all_of(begin.begin(), begin.end(), [] (int i) {return i == 0;}) ||
         !std::all_of(end.begin(), end.end(), [] (int i) {return i == 0;})) {
         IE_THROW() << "Unsupported BatchToSpace op with crop > 0";
@@ -4,24 +4,55 @@
 
 #include <ngraph/runtime/reference/bucketize.hpp>
 #include "arm_converter/arm_converter.hpp"
+#include "arm_converter/arm_neon_math.hpp"
 
 namespace ArmPlugin {
+template <typename T, typename B, typename P>
+void parallel_bucketize(std::size_t begin,
+                        std::size_t end,
+                        const T* data,
+                        const B* buckets,
+                        P* output,
+                        const ngraph::Shape& buckets_shape,
+                        bool with_right_bound) {
+    ngraph::runtime::reference::bucketize(data + begin,
+                                          buckets,
+                                          output + begin,
+                                          ngraph::Shape{end - begin},
+                                          buckets_shape,
+                                          with_right_bound);
+}
+
 template<> Converter::Conversion::Ptr Converter::Convert(const opset::Bucketize& node) {
+    const auto total = ngraph::shape_size(node.get_input_shape(0));
     auto make = [&] (auto refFunction) {
     return this->MakeConversion(refFunction,
                                 node.input(0),
                                 node.input(1),
                                 node.output(0),
-                                node.get_input_shape(0),
                                 node.get_input_shape(1),
                                 node.get_with_right_bound());
     };
+#if defined(__aarch64__)
+    // The vectorized linear scan wins over the scalar binary search only while
+    // the whole boundary set is rescanned cheaply; beyond that the reference
+    // path (already split across the thread pool) stays
+    if ((node.get_input_element_type(0) == ngraph::element::f32) &&
+        (node.get_input_element_type(1) == ngraph::element::f32) &&
+        (ngraph::shape_size(node.get_input_shape(1)) <= 64)) {
+        if (node.get_output_type() == ngraph::element::i32) {
+            return make(MakeParallelReference(total, neon::bucketize_f32<std::int32_t>));
+        } else if (node.get_output_type() == ngraph::element::i64) {
+            return make(MakeParallelReference(total, neon::bucketize_f32<std::int64_t>));
+        }
+    }
+#endif
     auto numericTypes = std::tuple<std::int32_t, std::int64_t, ngraph::float16, float>{};
     return CallSwitch(
-        AP_WRAP(make, ngraph::runtime::reference::bucketize),
+        [&] (auto ... v) {return make(MakeParallelReference(total, parallel_bucketize<decltype(v)...>));},
         node.get_input_element_type(0), numericTypes,
         node.get_input_element_type(1), numericTypes,
         node.get_output_type(), indexTypes);
 }
 
-} // namespace ArmPlugin
\ No newline at end of file
+} // namespace ArmPlugin
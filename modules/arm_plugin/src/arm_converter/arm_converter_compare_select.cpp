@@ -0,0 +1,110 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+
+#include "arm_converter/arm_converter.hpp"
+
+#if defined(__aarch64__)
+#include <arm_neon.h>
+#endif
+
+namespace ArmPlugin {
+using Operation = opset::ArmCompareSelect::Operation;
+
+#if defined(__aarch64__)
+// Compare and blend in one pass: the predicate only ever lives in a NEON
+// register between the comparison and vbslq, no boolean plane is written
+template <typename VectorMask, typename ScalarPred>
+static void blend_f32(std::size_t begin, std::size_t end,
+                      const float* lhs, const float* rhs,
+                      const float* onTrue, const float* onFalse, float* out,
+                      VectorMask mask, ScalarPred pred) {
+    std::size_t i = begin;
+    for (; i + 4 <= end; i += 4) {
+        const auto m = mask(vld1q_f32(lhs + i), vld1q_f32(rhs + i));
+        vst1q_f32(out + i, vbslq_f32(m, vld1q_f32(onTrue + i), vld1q_f32(onFalse + i)));
+    }
+    for (; i < end; ++i) {
+        out[i] = pred(lhs[i], rhs[i]) ? onTrue[i] : onFalse[i];
+    }
+}
+#endif
+
+template <typename T>
+static void compare_select(std::size_t begin, std::size_t end,
+                           const T* lhs, const T* rhs,
+                           const T* onTrue, const T* onFalse, T* out,
+                           const Operation operation) {
+    switch (operation) {
+        case Operation::Equal:
+            for (auto i = begin; i < end; ++i) out[i] = (lhs[i] == rhs[i]) ? onTrue[i] : onFalse[i];
+            break;
+        case Operation::NotEqual:
+            for (auto i = begin; i < end; ++i) out[i] = (lhs[i] != rhs[i]) ? onTrue[i] : onFalse[i];
+            break;
+        case Operation::Greater:
+            for (auto i = begin; i < end; ++i) out[i] = (lhs[i] > rhs[i]) ? onTrue[i] : onFalse[i];
+            break;
+        case Operation::GreaterEqual:
+            for (auto i = begin; i < end; ++i) out[i] = (lhs[i] >= rhs[i]) ? onTrue[i] : onFalse[i];
+            break;
+        case Operation::Less:
+            for (auto i = begin; i < end; ++i) out[i] = (lhs[i] < rhs[i]) ? onTrue[i] : onFalse[i];
+            break;
+        case Operation::LessEqual:
+            for (auto i = begin; i < end; ++i) out[i] = (lhs[i] <= rhs[i]) ? onTrue[i] : onFalse[i];
+            break;
+    }
+}
+
+#if defined(__aarch64__)
+template <>
+void compare_select<float>(std::size_t begin, std::size_t end,
+                           const float* lhs, const float* rhs,
+                           const float* onTrue, const float* onFalse, float* out,
+                           const Operation operation) {
+    switch (operation) {
+        case Operation::Equal:
+            return blend_f32(begin, end, lhs, rhs, onTrue, onFalse, out,
+                             [] (float32x4_t a, float32x4_t b) { return vceqq_f32(a, b); },
+                             [] (float a, float b) { return a == b; });
+        case Operation::NotEqual:
+            return blend_f32(begin, end, lhs, rhs, onTrue, onFalse, out,
+                             [] (float32x4_t a, float32x4_t b) { return vmvnq_u32(vceqq_f32(a, b)); },
+                             [] (float a, float b) { return a != b; });
+        case Operation::Greater:
+            return blend_f32(begin, end, lhs, rhs, onTrue, onFalse, out,
+                             [] (float32x4_t a, float32x4_t b) { return vcgtq_f32(a, b); },
+                             [] (float a, float b) { return a > b; });
+        case Operation::GreaterEqual:
+            return blend_f32(begin, end, lhs, rhs, onTrue, onFalse, out,
+                             [] (float32x4_t a, float32x4_t b) { return vcgeq_f32(a, b); },
+                             [] (float a, float b) { return a >= b; });
+        case Operation::Less:
+            return blend_f32(begin, end, lhs, rhs, onTrue, onFalse, out,
+                             [] (float32x4_t a, float32x4_t b) { return vcltq_f32(a, b); },
+                             [] (float a, float b) { return a < b; });
+        case Operation::LessEqual:
+            return blend_f32(begin, end, lhs, rhs, onTrue, onFalse, out,
+                             [] (float32x4_t a, float32x4_t b) { return vcleq_f32(a, b); },
+                             [] (float a, float b) { return a <= b; });
+    }
+}
+#endif
+
+template <> Converter::Conversion::Ptr Converter::Convert(const opset::ArmCompareSelect& node) {
+    const auto total = ngraph::shape_size(node.get_output_shape(0));
+    auto make = [&] (auto refFunction) {
+        return this->MakeConversion(MakeParallelReference(total, refFunction),
+                                    node.input(0),
+                                    node.input(1),
+                                    node.input(2),
+                                    node.input(3),
+                                    node.output(0),
+                                    node.get_operation());
+    };
+    return CallSwitch(
+        AP_WRAP(make, compare_select),
+        node.input(0), allTypes);
+}
+}  //  namespace ArmPlugin
@@ -7,6 +7,10 @@
 #include <arm_compute/runtime/NEON/NEScheduler.h>
 #include <arm_compute/runtime/NEON/functions/NEConvolutionLayer.h>
 #include <arm_compute/runtime/NEON/functions/NEDepthwiseConvolutionLayer.h>
+#include <arm_compute/runtime/NEON/functions/NEDirectConvolutionLayer.h>
+#include <arm_compute/runtime/NEON/functions/NEGEMMConvolutionLayer.h>
+#include <arm_compute/runtime/NEON/functions/NEWinogradConvolutionLayer.h>
+#include "arm_conv_method_cache.hpp"
 #include "arm_converter/arm_converter.hpp"
 
 namespace ArmPlugin {
@@ -26,8 +30,8 @@ static auto ConvParameters(const Conv& node) {
         arm_compute::Size2D {node.get_dilations().at(D2::W), node.get_dilations().at(D2::H)});
 }
 
-static arm_compute::ActivationLayerInfo GetActivationInfo(const ngraph::Node& node) {
-    auto itInfo = node.get_rt_info().find("ActivationLayerInfo");
+static arm_compute::ActivationLayerInfo GetActivationInfo(const ngraph::Node& node, const char* key = "ActivationLayerInfo") {
+    auto itInfo = node.get_rt_info().find(key);
     if (itInfo != node.get_rt_info().end()) {
         return itInfo->second.as<arm_compute::ActivationLayerInfo>();
     } else {
@@ -50,11 +54,12 @@ public:
     ~NEConvolutionLayerQI() = default;
     void configure(arm_compute::ITensor *input, const arm_compute::ITensor *weights, const arm_compute::ITensor *biases, arm_compute::ITensor *output,
                    const arm_compute::PadStrideInfo &conv_info, const arm_compute::WeightsInfo &weights_info, const arm_compute::Size2D &dilation,
-                   const arm_compute::ActivationLayerInfo &act_info,
+                   const arm_compute::ActivationLayerInfo &act_info, const bool enable_fast_math, const ConvMethod method,
                    const arm_compute::QuantizationInfo *ip, const arm_compute::QuantizationInfo *wp, const arm_compute::QuantizationInfo *qi) {
         ARM_COMPUTE_ERROR_ON_NULLPTR(input, weights, output);
         ARM_COMPUTE_ERROR_THROW_ON(NEConvolutionLayerQI::validate(input->info(), weights->info(), ((biases != nullptr) ? biases->info() : nullptr),
-                                                                  output->info(), conv_info, weights_info, dilation, act_info, ip, wp, qi));
+                                                                  output->info(), conv_info, weights_info, dilation, act_info, enable_fast_math, method,
+                                                                  ip, wp, qi));
 
         _input = input;
         arm_compute::ITensor *conv_input = input;
@@ -104,8 +109,29 @@ public:
             _outputqi.info()->set_quantization_info(*qi);
         }
 
-        _conv = std::make_unique<arm_compute::NEConvolutionLayer>(_memory_manager);
-        _conv->configure(conv_input, conv_weights, biases, _qi ? &_outputqi : _output, conv_info, weights_info, dilation, act_info);
+        auto conv_output = _qi ? &_outputqi : _output;
+        switch (method) {
+            case ConvMethod::Gemm: {
+                auto conv = std::make_unique<arm_compute::NEGEMMConvolutionLayer>(_memory_manager);
+                conv->configure(conv_input, conv_weights, biases, conv_output, conv_info, weights_info, dilation, act_info, enable_fast_math);
+                _conv = std::move(conv);
+            } break;
+            case ConvMethod::Winograd: {
+                auto conv = std::make_unique<arm_compute::NEWinogradConvolutionLayer>(_memory_manager);
+                conv->configure(conv_input, conv_weights, biases, conv_output, conv_info, act_info, enable_fast_math);
+                _conv = std::move(conv);
+            } break;
+            case ConvMethod::Direct: {
+                auto conv = std::make_unique<arm_compute::NEDirectConvolutionLayer>(_memory_manager);
+                conv->configure(conv_input, conv_weights, biases, conv_output, conv_info, act_info);
+                _conv = std::move(conv);
+            } break;
+            default: {
+                auto conv = std::make_unique<arm_compute::NEConvolutionLayer>(_memory_manager);
+                conv->configure(conv_input, conv_weights, biases, conv_output, conv_info, weights_info, dilation, act_info, enable_fast_math);
+                _conv = std::move(conv);
+            } break;
+        }
 
         if (_i_sgn) {
             _inputqi.allocator()->allocate();
@@ -124,6 +150,7 @@ public:
                                         const arm_compute::ITensorInfo *biases, const arm_compute::ITensorInfo *output,
                                         const arm_compute::PadStrideInfo &conv_info, const arm_compute::WeightsInfo &weights_info,
                                         const arm_compute::Size2D &dilation, const arm_compute::ActivationLayerInfo &act_info,
+                                        const bool enable_fast_math, const ConvMethod method,
                                         const arm_compute::QuantizationInfo *ip, const arm_compute::QuantizationInfo *wp,
                                         const arm_compute::QuantizationInfo *qi) {
         ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(input, weights, output);
@@ -154,7 +181,19 @@ public:
         arm_compute::TensorInfo vld_output(*output);
         if (qi) vld_output.set_quantization_info(*qi);
 
-        return arm_compute::NEConvolutionLayer::validate(&vld_input, &vld_weights, biases, &vld_output, conv_info, weights_info, dilation, act_info);
+        switch (method) {
+            case ConvMethod::Gemm:
+                return arm_compute::NEGEMMConvolutionLayer::validate(&vld_input, &vld_weights, biases, &vld_output, conv_info, weights_info,
+                                                                     dilation, act_info, enable_fast_math);
+            case ConvMethod::Winograd:
+                return arm_compute::NEWinogradConvolutionLayer::validate(&vld_input, &vld_weights, biases, &vld_output, conv_info, act_info,
+                                                                         enable_fast_math);
+            case ConvMethod::Direct:
+                return arm_compute::NEDirectConvolutionLayer::validate(&vld_input, &vld_weights, biases, &vld_output, conv_info, act_info);
+            default:
+                return arm_compute::NEConvolutionLayer::validate(&vld_input, &vld_weights, biases, &vld_output, conv_info, weights_info,
+                                                                 dilation, act_info, enable_fast_math);
+        }
     }
     void run() override {
         ARM_COMPUTE_ERROR_ON_MSG(!_conv.get(), "Kernel didn't configured");
@@ -189,6 +228,13 @@ public:
         if (_wp) _weightsqi.allocator()->free();
         if (_qi) _outputqi.allocator()->free();
     }
+    void prepare() override {
+        // Weights rewritten at run time (signedness conversion or requantization)
+        // are not available yet, so their packing stays lazy
+        if (!_w_sgn && !_wp && _conv) {
+            _conv->prepare();
+        }
+    }
 
 protected:
     std::shared_ptr<arm_compute::IMemoryManager> _memory_manager;
@@ -203,9 +249,12 @@ protected:
     arm_compute::ITensor *_output;
     arm_compute::Tensor _outputqi;
     std::unique_ptr<arm_compute::cpu::kernels::CpuConvertQuantizedSignednessKernel> _i_sgn, _w_sgn;
-    std::unique_ptr<arm_compute::NEConvolutionLayer> _conv;
+    // The concrete ACL function behind the selected algorithm; NEConvolutionLayer
+    // when the choice stays with ACL's own heuristics
+    std::unique_ptr<arm_compute::IFunction> _conv;
 };
-template<> Converter::Conversion::Ptr Converter::Convert(const opset::ArmConvolution& node) {
+template<typename Conv>
+static Converter::Conversion::Ptr ConvertConvolutionLayer(Converter& converter, const Conv& node) {
     if (node.get_shape().size() != 4) {
             IE_THROW() << "Only Convolution2D is supported.";
     }
@@ -224,17 +273,43 @@ template<> Converter::Conversion::Ptr Converter::Convert(const opset::ArmConvolu
     const arm_compute::QuantizationInfo* qInfo = qInfoIt == node.get_rt_info().end() ? nullptr :
                                                &(qInfoIt->second.as<arm_compute::QuantizationInfo>());
 
+    // Benchmark-at-load algorithm selection; the quantized path keeps ACL's
+    // own choice because its tensors are rewritten around the convolution
+    auto method = ConvMethod::Auto;
+    if (converter._cfg._convMethodTuning && (iInfo == nullptr) && (wInfo == nullptr) && (qInfo == nullptr)) {
+        auto& layer = converter._layers.at(node.get_instance_id());
+        method = ConvMethodCache::Instance().Select(
+            layer._inputs.at(node.input(Features))->_tensor->info(),
+            layer._inputs.at(node.input(Weights))->_tensor->info(),
+            (node.get_input_size() == 3) ? layer._inputs.at(node.input(Bias))->_tensor->info() : nullptr,
+            layer._outputs.at(node.output(0))._tensor->info(),
+            conv_info, dilation, GetActivationInfo(node),
+            converter.FastMathAllowed(node), converter._cfg._convMethodCacheFile);
+    }
+
     if (node.get_input_size() == 3) {
-        return MakeConversion<NEConvolutionLayerQI>(
+        return converter.MakeConversion<NEConvolutionLayerQI>(
             node.input(Features), node.input(Weights), node.input(Bias), node.output(0),
-            conv_info, arm_compute::WeightsInfo{}, dilation, GetActivationInfo(node), iInfo, wInfo, qInfo);
+            conv_info, arm_compute::WeightsInfo{}, dilation, GetActivationInfo(node),
+            converter.FastMathAllowed(node), method, iInfo, wInfo, qInfo);
     } else {
-        return MakeConversion<NEConvolutionLayerQI>(
+        return converter.MakeConversion<NEConvolutionLayerQI>(
             node.input(Features), node.input(Weights), nullptr, node.output(0),
-            conv_info, arm_compute::WeightsInfo{}, dilation, GetActivationInfo(node), iInfo, wInfo, qInfo);
+            conv_info, arm_compute::WeightsInfo{}, dilation, GetActivationInfo(node),
+            converter.FastMathAllowed(node), method, iInfo, wInfo, qInfo);
     }
 }
 
+template<> Converter::Conversion::Ptr Converter::Convert(const opset::ArmConvolution& node) {
+    return ConvertConvolutionLayer(*this, node);
+}
+
+// Same ACL function as ArmConvolution: the layout difference is carried by the
+// NHWC data layout of the tensor infos built in the Converter constructor
+template<> Converter::Conversion::Ptr Converter::Convert(const opset::ArmConvolutionNHWC& node) {
+    return ConvertConvolutionLayer(*this, node);
+}
+
 struct NEDepthwiseConvolutionLayerQI final: public arm_compute::IFunction {
 public:
     NEDepthwiseConvolutionLayerQI(std::shared_ptr<arm_compute::IMemoryManager> memory_manager = nullptr):
@@ -390,6 +465,13 @@ public:
         if (_wp) _weightsqi.allocator()->free();
         if (_qi) _outputqi.allocator()->free();
     }
+    void prepare() override {
+        // Weights rewritten at run time (signedness conversion or requantization)
+        // are not available yet, so their packing stays lazy
+        if (!_w_sgn && !_wp && _conv) {
+            _conv->prepare();
+        }
+    }
 
 protected:
     std::shared_ptr<arm_compute::IMemoryManager> _memory_manager;
@@ -438,4 +520,89 @@ template<> Converter::Conversion::Ptr Converter::Convert(const opset::ArmGroupCo
             conv_info, 1u, GetActivationInfo(node), dilation, iInfo, wInfo, qInfo);
     }
 }
+
+struct NEDepthwiseSeparableConvolutionLayer final: public arm_compute::IFunction {
+public:
+    NEDepthwiseSeparableConvolutionLayer(std::shared_ptr<arm_compute::IMemoryManager> memory_manager = nullptr):
+        _memory_manager(memory_manager), _memory_group{std::make_unique<arm_compute::MemoryGroup>(memory_manager)},
+        _dw(nullptr), _pw(nullptr), _intermediate() {}
+    NEDepthwiseSeparableConvolutionLayer(const NEDepthwiseSeparableConvolutionLayer &) = delete;
+    NEDepthwiseSeparableConvolutionLayer &operator=(const NEDepthwiseSeparableConvolutionLayer &) = delete;
+    NEDepthwiseSeparableConvolutionLayer(NEDepthwiseSeparableConvolutionLayer &&) = delete;
+    NEDepthwiseSeparableConvolutionLayer &operator=(NEDepthwiseSeparableConvolutionLayer &&) = delete;
+    ~NEDepthwiseSeparableConvolutionLayer() = default;
+    void configure(arm_compute::ITensor *input, const arm_compute::ITensor *dw_weights, const arm_compute::ITensor *dw_biases,
+                   const arm_compute::ITensor *pw_weights, const arm_compute::ITensor *pw_biases, arm_compute::ITensor *output,
+                   const arm_compute::PadStrideInfo &conv_info, const arm_compute::Size2D &dilation,
+                   const arm_compute::ActivationLayerInfo &dw_act_info, const arm_compute::ActivationLayerInfo &pw_act_info,
+                   const bool enable_fast_math, const arm_compute::TensorShape &intermediate_shape) {
+        ARM_COMPUTE_ERROR_ON_NULLPTR(input, dw_weights, dw_biases, pw_weights, pw_biases, output);
+        ARM_COMPUTE_ERROR_THROW_ON(NEDepthwiseSeparableConvolutionLayer::validate(input->info(), dw_weights->info(), dw_biases->info(),
+                                                                                  pw_weights->info(), pw_biases->info(), output->info(),
+                                                                                  conv_info, dilation, dw_act_info, pw_act_info,
+                                                                                  enable_fast_math, intermediate_shape));
+
+        _intermediate.allocator()->init(arm_compute::TensorInfo(intermediate_shape, 1, input->info()->data_type()));
+        // The intermediate feature map lives only between the two runs and
+        // recycles pool storage instead of occupying a graph-level tensor
+        _memory_group->manage(&_intermediate);
+
+        _dw = std::make_unique<arm_compute::NEDepthwiseConvolutionLayer>(_memory_manager);
+        _dw->configure(input, dw_weights, dw_biases, &_intermediate, conv_info, 1u, dw_act_info, dilation);
+        _pw = std::make_unique<arm_compute::NEConvolutionLayer>(_memory_manager);
+        _pw->configure(&_intermediate, pw_weights, pw_biases, output,
+                       arm_compute::PadStrideInfo{}, arm_compute::WeightsInfo{}, arm_compute::Size2D{1u, 1u},
+                       pw_act_info, enable_fast_math);
+
+        _intermediate.allocator()->allocate();
+    }
+    static arm_compute::Status validate(const arm_compute::ITensorInfo *input, const arm_compute::ITensorInfo *dw_weights,
+                                        const arm_compute::ITensorInfo *dw_biases, const arm_compute::ITensorInfo *pw_weights,
+                                        const arm_compute::ITensorInfo *pw_biases, const arm_compute::ITensorInfo *output,
+                                        const arm_compute::PadStrideInfo &conv_info, const arm_compute::Size2D &dilation,
+                                        const arm_compute::ActivationLayerInfo &dw_act_info, const arm_compute::ActivationLayerInfo &pw_act_info,
+                                        const bool enable_fast_math, const arm_compute::TensorShape &intermediate_shape) {
+        ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(input, dw_weights, dw_biases, pw_weights, pw_biases, output);
+        arm_compute::TensorInfo vld_intermediate(intermediate_shape, 1, input->data_type());
+        ARM_COMPUTE_RETURN_ON_ERROR(arm_compute::NEDepthwiseConvolutionLayer::validate(input, dw_weights, dw_biases, &vld_intermediate,
+                                                                                       conv_info, 1u, dw_act_info, dilation));
+        return arm_compute::NEConvolutionLayer::validate(&vld_intermediate, pw_weights, pw_biases, output,
+                                                         arm_compute::PadStrideInfo{}, arm_compute::WeightsInfo{}, arm_compute::Size2D{1u, 1u},
+                                                         pw_act_info, enable_fast_math);
+    }
+    void run() override {
+        ARM_COMPUTE_ERROR_ON_MSG(!_dw.get() || !_pw.get(), "Kernel didn't configured");
+        arm_compute::MemoryGroupResourceScope scope(*_memory_group);
+        _dw->run();
+        _pw->run();
+    }
+    void prepare() override {
+        if (_dw) _dw->prepare();
+        if (_pw) _pw->prepare();
+    }
+
+protected:
+    std::shared_ptr<arm_compute::IMemoryManager> _memory_manager;
+    std::unique_ptr<arm_compute::MemoryGroup> _memory_group;
+    arm_compute::Tensor _intermediate;
+    std::unique_ptr<arm_compute::NEDepthwiseConvolutionLayer> _dw;
+    std::unique_ptr<arm_compute::NEConvolutionLayer> _pw;
+};
+template<> Converter::Conversion::Ptr Converter::Convert(const opset::ArmDepthwiseSeparableConvolution& node) {
+    arm_compute::PadStrideInfo conv_info;
+    arm_compute::Size2D dilation;
+    std::tie(conv_info, dilation) = ConvParameters(node);
+    auto ngraphWeightsShape = node.input(1).get_shape();
+    _layers.at(node.get_instance_id())._inputs.at(node.input(1))->_tensor->info()->set_tensor_shape(ShapeCast({
+        ngraphWeightsShape[1],
+        ngraphWeightsShape[0]*ngraphWeightsShape[2],
+        ngraphWeightsShape[3],
+        ngraphWeightsShape[4]
+    }));
+
+    return MakeConversion<NEDepthwiseSeparableConvolutionLayer>(
+        node.input(0), node.input(1), node.input(2), node.input(3), node.input(4), node.output(0),
+        conv_info, dilation, GetActivationInfo(node, "DepthwiseActivationLayerInfo"), GetActivationInfo(node),
+        FastMathAllowed(node), ShapeCast(node.get_depthwise_output_shape()));
+}
 }  //  namespace ArmPlugin
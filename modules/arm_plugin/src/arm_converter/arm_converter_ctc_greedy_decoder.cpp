@@ -3,6 +3,7 @@
 
 
 #include "arm_converter/arm_converter.hpp"
+#include "arm_converter/arm_neon_ctc.hpp"
 #include <ngraph/runtime/reference/ctc_greedy_decoder.hpp>
 
 namespace ArmPlugin {
@@ -17,6 +18,14 @@ template<> Converter::Conversion::Ptr Converter::Convert(const opset::CTCGreedyD
                                     node.get_output_shape(0),
                                     node.get_ctc_merge_repeated());
     };
+#if defined(__aarch64__)
+    // Batches decode independently: split them across the scheduler threads
+    // and take the vectorized argmax over the class axis at every step
+    if (node.get_input_element_type(0) == ngraph::element::f32) {
+        const std::size_t batch = node.get_input_shape(0)[1];
+        return make(MakeParallelReference(batch, neon::ctc_greedy_decoder_f32));
+    }
+#endif
     return CallSwitch(
         AP_WRAP(make, ngraph::runtime::reference::ctc_greedy_decoder),
         node.input(0), floatTypes);
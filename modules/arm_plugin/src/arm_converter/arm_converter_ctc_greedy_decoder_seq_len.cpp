@@ -3,6 +3,7 @@
 
 
 #include "arm_converter/arm_converter.hpp"
+#include "arm_converter/arm_neon_ctc.hpp"
 #include <ngraph/runtime/reference/ctc_greedy_decoder_seq_len.hpp>
 
 namespace ArmPlugin {
@@ -18,7 +19,18 @@ template<> Converter::Conversion::Ptr Converter::Convert(const opset::CTCGreedyD
                                     node.get_output_shape(0),
                                     node.get_merge_repeated());
     };
-
+#if defined(__aarch64__)
+    // Same batch-parallel decode with a vectorized argmax as CTCGreedyDecoder,
+    // over batch-major data with explicit sequence lengths and blank index
+    if (node.get_input_element_type(0) == ngraph::element::f32) {
+        const std::size_t batch = node.get_input_shape(0)[0];
+        return CallSwitch(
+            [&] (auto ... v) {return make(MakeParallelReference(batch, neon::ctc_greedy_decoder_seq_len_f32<decltype(v)...>));},
+            node.get_input_element_type(1),  indexTypes,
+            node.get_classes_index_type(),   indexTypes,
+            node.get_sequence_length_type(), indexTypes);
+    }
+#endif
     return CallSwitch(
         AP_WRAP(make, ngraph::runtime::reference::ctc_greedy_decoder_seq_len),
         node.get_input_element_type(0),  floatTypes,
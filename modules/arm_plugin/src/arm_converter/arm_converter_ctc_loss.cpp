@@ -6,6 +6,40 @@
 #include <ngraph/runtime/reference/ctc_loss.hpp>
 
 namespace ArmPlugin {
+#if defined(__aarch64__)
+// The forward algorithm of every batch is independent and writes one loss
+// value; running the reference math per batch slice over a [1, T, C] view
+// spreads the batches across the scheduler threads
+template <typename T, typename U>
+void ctc_loss_batches(std::size_t begin, std::size_t end,
+                      const T* logits,
+                      const ngraph::Shape& logitsShape,
+                      const U* logitsLength,
+                      const U* labels,
+                      const U* labelsLength,
+                      const U* blankIndex,
+                      const bool preprocessCollapseRepeated,
+                      const bool ctcMergeRepeated,
+                      const bool unique,
+                      T* output) {
+    const auto maxTime = logitsShape[1];
+    const auto classes = logitsShape[2];
+    const ngraph::Shape batchShape{1, maxTime, classes};
+    for (std::size_t b = begin; b < end; ++b) {
+        ngraph::runtime::reference::CTCLoss(logits + b * maxTime * classes,
+                                            batchShape,
+                                            logitsLength + b,
+                                            labels + b * maxTime,
+                                            labelsLength + b,
+                                            blankIndex,
+                                            preprocessCollapseRepeated,
+                                            ctcMergeRepeated,
+                                            unique,
+                                            output + b);
+    }
+}
+#endif
+
 template<> Converter::Conversion::Ptr Converter::Convert(const opset::CTCLoss& node) {
     if (node.get_input_size() < 4) {
         IE_THROW() << "Unsupported CTCLoss op with num inputs = " << node.get_input_size();
@@ -24,6 +58,13 @@ template<> Converter::Conversion::Ptr Converter::Convert(const opset::CTCLoss& n
                                     node.get_unique(),
                                     node.output(0));
     };
+#if defined(__aarch64__)
+    const std::size_t batch = node.get_input_shape(0)[0];
+    return CallSwitch(
+        [&] (auto ... v) {return make(MakeParallelReference(batch, ctc_loss_batches<decltype(v)...>));},
+        node.input(0), floatTypes,
+        node.input(1), indexTypes);
+#endif
     return CallSwitch(
         AP_WRAP(make, ngraph::runtime::reference::CTCLoss),
         node.input(0), floatTypes,
@@ -4,12 +4,46 @@
 
 #include <arm_compute/runtime/NEON/functions/NEDepthToSpaceLayer.h>
 #include "arm_converter/arm_converter.hpp"
+#include "arm_converter/arm_neon_space.hpp"
 
 namespace ArmPlugin {
+#if defined(__aarch64__)
+template <typename T>
+static void depth_to_space_rows(std::size_t begin, std::size_t end, const T* src, T* dst,
+                                const ngraph::Shape& srcShape, const std::size_t block, const bool blocksFirst) {
+    using U = neon::WidthTypeOf<T>;
+    neon::depth_to_space(begin, end, reinterpret_cast<const U*>(src), reinterpret_cast<U*>(dst),
+                         srcShape, block, blocksFirst);
+}
+#endif
+
 template<> Converter::Conversion::Ptr Converter::Convert(const opset::DepthToSpace& node) {
     if (node.get_input_shape(0).size() > 4) {
         IE_THROW() << "Unsupported DepthToSpace with num dimensions > 4";
     }
+#if defined(__aarch64__)
+    // The DEPTH_FIRST mode (pixel shuffle) has no ACL function: lower it to
+    // interleaving block copies of whole input rows, output rows split across
+    // the scheduler threads. The kernels move raw lanes, so every element type
+    // rides the unsigned type of its width
+    if ((node.get_mode() == opset::DepthToSpace::DepthToSpaceMode::DEPTH_FIRST) &&
+        (node.get_input_shape(0).size() == 4)) {
+        const auto& srcShape = node.get_input_shape(0);
+        const std::size_t block = node.get_block_size();
+        const auto rows = srcShape[0] * (srcShape[1] / (block * block)) * srcShape[2] * block;
+        auto make = [&] (auto kernel) {
+            return this->MakeConversion(MakeParallelReference(rows, kernel),
+                                        node.input(0),
+                                        node.output(0),
+                                        srcShape,
+                                        block,
+                                        false);
+        };
+        return CallSwitch(
+            AP_WRAP(make, depth_to_space_rows),
+            node.input(0), merge(allTypes, boolType));
+    }
+#endif
     if (node.get_mode() != opset::DepthToSpace::DepthToSpaceMode::BLOCKS_FIRST) {
         IE_THROW() << "Unsupported DepthToSpace mode";
     }
@@ -12,16 +12,122 @@
 #include "arm_converter/arm_converter.hpp"
 
 namespace ArmPlugin {
+
+// Runs an eltwise function on quantized tensors whose real scales live in the
+// node runtime info (see EltwiseQuantizeFusion): the inputs and the output are
+// wrapped into tensor info clones carrying those scales, so the kernel itself
+// performs the requantization and the chain never leaves QASYMM8
+template<typename EltwiseFunction>
+struct NEEltwiseQI final: public arm_compute::IFunction {
+public:
+    NEEltwiseQI() : _fn(nullptr), _input0(nullptr), _input1(nullptr), _output(nullptr),
+                    _qi0(nullptr), _qi1(nullptr), _qi(nullptr), _input0qi(), _input1qi(), _outputqi() {}
+    NEEltwiseQI(const NEEltwiseQI &) = delete;
+    NEEltwiseQI &operator=(const NEEltwiseQI &) = delete;
+    NEEltwiseQI(NEEltwiseQI &&) = delete;
+    NEEltwiseQI &operator=(NEEltwiseQI &&) = delete;
+    ~NEEltwiseQI() = default;
+    template<typename... Args>
+    void configure(arm_compute::ITensor *input0, arm_compute::ITensor *input1, arm_compute::ITensor *output,
+                   const arm_compute::QuantizationInfo *qi0, const arm_compute::QuantizationInfo *qi1,
+                   const arm_compute::QuantizationInfo *qi, Args&&... args) {
+        ARM_COMPUTE_ERROR_ON_NULLPTR(input0, input1, output);
+        _input0 = input0; _qi0 = qi0;
+        if (_qi0) {
+            _input0qi.allocator()->init(*(input0->info()));
+            _input0qi.info()->set_quantization_info(*qi0);
+        }
+        _input1 = input1; _qi1 = qi1;
+        if (_qi1) {
+            _input1qi.allocator()->init(*(input1->info()));
+            _input1qi.info()->set_quantization_info(*qi1);
+        }
+        _output = output; _qi = qi;
+        if (_qi) {
+            _outputqi.allocator()->init(*(output->info()));
+            _outputqi.info()->set_quantization_info(*qi);
+        }
+        _fn = std::make_unique<EltwiseFunction>();
+        _fn->configure(_qi0 ? &_input0qi : input0,
+                       _qi1 ? &_input1qi : input1,
+                       _qi  ? &_outputqi : output,
+                       std::forward<Args>(args)...);
+    }
+    template<typename... Args>
+    static arm_compute::Status validate(const arm_compute::ITensorInfo *input0, const arm_compute::ITensorInfo *input1,
+                                        const arm_compute::ITensorInfo *output,
+                                        const arm_compute::QuantizationInfo *qi0, const arm_compute::QuantizationInfo *qi1,
+                                        const arm_compute::QuantizationInfo *qi, Args&&... args) {
+        ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(input0, input1, output);
+        arm_compute::TensorInfo vld_input0(*input0);
+        if (qi0) vld_input0.set_quantization_info(*qi0);
+        arm_compute::TensorInfo vld_input1(*input1);
+        if (qi1) vld_input1.set_quantization_info(*qi1);
+        arm_compute::TensorInfo vld_output(*output);
+        if (qi) vld_output.set_quantization_info(*qi);
+        return EltwiseFunction::validate(&vld_input0, &vld_input1, &vld_output, std::forward<Args>(args)...);
+    }
+    void run() override {
+        ARM_COMPUTE_ERROR_ON_MSG(!_fn.get(), "Kernel didn't configured");
+        if (_qi0) {
+            if (_input0qi.info()->padding() != _input0->info()->padding()) _input0qi.info()->extend_padding(_input0->info()->padding());
+            _input0qi.allocator()->import_memory(_input0->buffer());
+        }
+        if (_qi1) {
+            if (_input1qi.info()->padding() != _input1->info()->padding()) _input1qi.info()->extend_padding(_input1->info()->padding());
+            _input1qi.allocator()->import_memory(_input1->buffer());
+        }
+        if (_qi) {
+            if (_outputqi.info()->padding() != _output->info()->padding()) _outputqi.info()->extend_padding(_output->info()->padding());
+            _outputqi.allocator()->import_memory(_output->buffer());
+        }
+        _fn->run();
+        if (_qi0) _input0qi.allocator()->free();
+        if (_qi1) _input1qi.allocator()->free();
+        if (_qi) _outputqi.allocator()->free();
+    }
+
+protected:
+    arm_compute::ITensor *_input0;
+    const arm_compute::QuantizationInfo *_qi0;
+    arm_compute::Tensor _input0qi;
+    arm_compute::ITensor *_input1;
+    const arm_compute::QuantizationInfo *_qi1;
+    arm_compute::Tensor _input1qi;
+    arm_compute::ITensor *_output;
+    const arm_compute::QuantizationInfo *_qi;
+    arm_compute::Tensor _outputqi;
+    std::unique_ptr<EltwiseFunction> _fn;
+};
+
+static const arm_compute::QuantizationInfo* GetQuantizationInfo(const ngraph::Node& node, const std::string& name) {
+    auto itInfo = node.get_rt_info().find(name);
+    return itInfo == node.get_rt_info().end() ? nullptr : &(itInfo->second.as<arm_compute::QuantizationInfo>());
+}
+
+template<typename EltwiseFunction, typename Eltwise, typename... Args>
+static Converter::Conversion::Ptr ConvertEltwise(Converter& converter, const Eltwise& node, Args&&... args) {
+    auto qInfo = GetQuantizationInfo(node, "QuantizationInfo");
+    if (qInfo != nullptr) {
+        return converter.MakeConversion<NEEltwiseQI<EltwiseFunction>>(
+            node.input(0), node.input(1), node.output(0),
+            GetQuantizationInfo(node, "Input0QuantizationInfo"),
+            GetQuantizationInfo(node, "Input1QuantizationInfo"),
+            qInfo, std::forward<Args>(args)...);
+    }
+    return converter.MakeConversion<EltwiseFunction>(node.input(0), node.input(1), node.output(0), std::forward<Args>(args)...);
+}
+
 template<> Converter::Conversion::Ptr Converter::Convert(const opset::Add& node) {
-    return MakeConversion<arm_compute::NEArithmeticAddition>(node.input(0), node.input(1), node.output(0), arm_compute::ConvertPolicy::SATURATE);
+    return ConvertEltwise<arm_compute::NEArithmeticAddition>(*this, node, arm_compute::ConvertPolicy::SATURATE);
 }
 
 template<> Converter::Conversion::Ptr Converter::Convert(const opset::Subtract& node) {
-    return MakeConversion<arm_compute::NEArithmeticSubtraction>(node.input(0), node.input(1), node.output(0), arm_compute::ConvertPolicy::SATURATE);
+    return ConvertEltwise<arm_compute::NEArithmeticSubtraction>(*this, node, arm_compute::ConvertPolicy::SATURATE);
 }
 
 template<> Converter::Conversion::Ptr Converter::Convert(const opset::Multiply& node) {
-    return MakeConversion<arm_compute::NEPixelWiseMultiplication>(node.input(0), node.input(1), node.output(0),
+    return ConvertEltwise<arm_compute::NEPixelWiseMultiplication>(*this, node,
         1.0f,
         arm_compute::ConvertPolicy::SATURATE,
         arm_compute::RoundingPolicy::TO_ZERO);
@@ -3,6 +3,7 @@
 
 
 #include "arm_converter/arm_converter.hpp"
+#include "arm_converter/arm_neon_embedding.hpp"
 #include <ngraph/runtime/reference/embedding_bag_packed_sum.hpp>
 
 namespace ArmPlugin {
@@ -26,6 +27,16 @@ template<> Converter::Conversion::Ptr Converter::Convert(const opset::EmbeddingB
                                         node.get_shape());
         }
     };
+#if defined(__aarch64__)
+    const auto& type = node.get_input_element_type(0);
+    if ((type == ngraph::element::f32) || (type == ngraph::element::f16)) {
+        const std::size_t numBags = node.get_shape()[0];
+        return CallSwitch(
+            [&] (auto ... v) {return make(MakeParallelReference(numBags, neon::embedding_bag_packed_sum<decltype(v)...>));},
+            type, std::tuple<float, ngraph::float16>{},
+            node.get_input_element_type(1), indexTypes);
+    }
+#endif
     return CallSwitch(
         AP_WRAP(make, ngraph::runtime::reference::embeddingBagPackedSum),
         node.input(0), allTypes,
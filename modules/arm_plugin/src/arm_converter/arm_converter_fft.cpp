@@ -15,14 +15,19 @@ void wrap_fft(const D* data,
               const ngraph::Shape& axes_shape,
               D* out,
               const ngraph::Shape& output_shape,
-              ngraph::runtime::reference::FFTKind kind) {
-    std::vector<float> fft_data(data_shape.size());
-    for (size_t i = 0; i < fft_data.size(); ++i) {
+              ngraph::runtime::reference::FFTKind kind,
+              const ScratchArena::Ptr& scratch) {
+    ScratchArena::Scope scope{scratch};
+    const auto data_size = data_shape.size();
+    float* fft_data = scope.Allocate<float>(data_size);
+    for (size_t i = 0; i < data_size; ++i) {
         fft_data[i] = static_cast<float>(data[i]);
     }
-    std::vector<float> fft_result(ngraph::shape_size(output_shape), 0.0f);
-    wrap_fft<float>(fft_data.data(), data_shape, axes, axes_shape, fft_result.data(), output_shape, kind);
-    for (size_t i = 0; i < fft_result.size(); ++i) {
+    const auto result_size = ngraph::shape_size(output_shape);
+    float* fft_result = scope.Allocate<float>(result_size);
+    std::fill(fft_result, fft_result + result_size, 0.0f);
+    wrap_fft<float>(fft_data, data_shape, axes, axes_shape, fft_result, output_shape, kind, scratch);
+    for (size_t i = 0; i < result_size; ++i) {
         out[i] = D(fft_result[i]);
     }
 }
@@ -33,7 +38,8 @@ void wrap_fft<float>(const float* data,
                      const ngraph::Shape& axes_shape,
                      float* out,
                      const ngraph::Shape& output_shape,
-                     ngraph::runtime::reference::FFTKind kind) {
+                     ngraph::runtime::reference::FFTKind kind,
+                     const ScratchArena::Ptr&) {
     ngraph::runtime::reference::fft(data,
                                     data_shape,
                                     axes.data(),
@@ -81,7 +87,8 @@ template<> Converter::Conversion::Ptr Converter::Convert(const opset::DFT& node)
                                     node.get_input_shape(1),
                                     node.output(0),
                                     output_shape,
-                                    ngraph::runtime::reference::FFTKind::Forward);
+                                    ngraph::runtime::reference::FFTKind::Forward,
+                                    _scratch);
     };
     return CallSwitch(
         AP_WRAP(make, wrap_fft),
@@ -100,7 +107,8 @@ template<> Converter::Conversion::Ptr Converter::Convert(const opset::IDFT& node
                                     node.get_input_shape(1),
                                     node.output(0),
                                     output_shape,
-                                    ngraph::runtime::reference::FFTKind::Inverse);
+                                    ngraph::runtime::reference::FFTKind::Inverse,
+                                    _scratch);
     };
     return CallSwitch(
         AP_WRAP(make, wrap_fft),
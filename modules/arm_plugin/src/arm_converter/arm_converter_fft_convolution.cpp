@@ -0,0 +1,205 @@
+// Copyright (C) 2020-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+
+#include <cmath>
+#include <complex>
+#include <mutex>
+#include <vector>
+
+#include "arm_converter/arm_converter.hpp"
+
+namespace ArmPlugin {
+namespace {
+// Iterative radix-2 complex FFT over a power-of-two size; the bit-reversal
+// permutation and the twiddle factors of every stage are precomputed at
+// conversion time and shared by all transforms of the layer
+struct FFTPlan {
+    explicit FFTPlan(const std::size_t size) : _size{size} {
+        std::size_t bits = 0;
+        while ((std::size_t{1} << bits) < size) {
+            ++bits;
+        }
+        _reversed.resize(size);
+        for (std::size_t i = 0; i < size; ++i) {
+            std::size_t r = 0;
+            for (std::size_t bit = 0; bit < bits; ++bit) {
+                r |= ((i >> bit) & 1) << (bits - 1 - bit);
+            }
+            _reversed[i] = r;
+        }
+        _twiddles.reserve(size - 1);
+        for (std::size_t len = 2; len <= size; len <<= 1) {
+            for (std::size_t j = 0; j < len / 2; ++j) {
+                const double angle = -2.0 * M_PI * static_cast<double>(j) / static_cast<double>(len);
+                _twiddles.emplace_back(static_cast<float>(std::cos(angle)), static_cast<float>(std::sin(angle)));
+            }
+        }
+    }
+
+    void Transform(std::complex<float>* x, const bool inverse) const {
+        for (std::size_t i = 0; i < _size; ++i) {
+            if (i < _reversed[i]) {
+                std::swap(x[i], x[_reversed[i]]);
+            }
+        }
+        const std::complex<float>* tw = _twiddles.data();
+        for (std::size_t len = 2; len <= _size; len <<= 1) {
+            const auto half = len / 2;
+            for (std::size_t start = 0; start < _size; start += len) {
+                for (std::size_t j = 0; j < half; ++j) {
+                    const auto w = inverse ? std::conj(tw[j]) : tw[j];
+                    const auto a = x[start + j];
+                    const auto b = x[start + j + half] * w;
+                    x[start + j]        = a + b;
+                    x[start + j + half] = a - b;
+                }
+            }
+            tw += half;
+        }
+        if (inverse) {
+            const float scale = 1.f / static_cast<float>(_size);
+            for (std::size_t i = 0; i < _size; ++i) {
+                x[i] *= scale;
+            }
+        }
+    }
+
+    std::size_t _size;
+    std::vector<std::size_t> _reversed;
+    std::vector<std::complex<float>> _twiddles;
+};
+
+static std::size_t next_pow2(std::size_t v) {
+    std::size_t p = 1;
+    while (p < v) {
+        p <<= 1;
+    }
+    return p;
+}
+
+// Overlap-add FFT convolution: the padded input is cut into segments of
+// fftSize - K + 1 samples, each segment spectrum is multiplied by the cached
+// weight spectra and the inverse transforms are summed back shifted by the
+// segment offsets. Weight spectra are computed on the first run only - the
+// weights input is a constant folded once per network. Segment spectra are
+// shared between output channels, so one run does N*C*segments forward and
+// N*O*segments inverse transforms
+struct FFTConvolution {
+    struct State {
+        State(const ngraph::Shape& dataShape, const ngraph::Shape& weightsShape,
+              const std::size_t padBegin, const std::size_t padEnd)
+            : batch{dataShape[0]},
+              inChannels{dataShape[1]},
+              inLength{dataShape[2]},
+              outChannels{weightsShape[0]},
+              kernel{weightsShape[2]},
+              padBegin{padBegin},
+              paddedLength{dataShape[2] + padBegin + padEnd},
+              outLength{paddedLength - kernel + 1},
+              fftSize{std::min(next_pow2(std::max<std::size_t>(4 * kernel, 256)),
+                               next_pow2(paddedLength + kernel - 1))},
+              segment{fftSize - kernel + 1},
+              segments{(paddedLength + segment - 1) / segment},
+              plan{fftSize} {}
+
+        const std::size_t batch;
+        const std::size_t inChannels;
+        const std::size_t inLength;
+        const std::size_t outChannels;
+        const std::size_t kernel;
+        const std::size_t padBegin;
+        const std::size_t paddedLength;
+        const std::size_t outLength;
+        const std::size_t fftSize;
+        const std::size_t segment;
+        const std::size_t segments;
+        const FFTPlan plan;
+
+        std::once_flag once;
+        std::vector<std::complex<float>> weightSpectra;
+    };
+
+    void operator()(const float* data, const float* weights, float* out, const ScratchArena::Ptr& scratch) {
+        auto& s = *_state;
+        std::call_once(s.once, [&] {
+            s.weightSpectra.resize(s.outChannels * s.inChannels * s.fftSize);
+            InferenceEngine::parallel_for(s.outChannels * s.inChannels, [&] (std::size_t f) {
+                auto* spectrum = s.weightSpectra.data() + f * s.fftSize;
+                const auto* taps = weights + f * s.kernel;
+                for (std::size_t i = 0; i < s.kernel; ++i) {
+                    spectrum[i] = taps[i];
+                }
+                std::fill(spectrum + s.kernel, spectrum + s.fftSize, std::complex<float>{});
+                s.plan.Transform(spectrum, false);
+            });
+        });
+
+        // Forward transforms of every padded input segment, shared below
+        ScratchArena::Scope scope{scratch};
+        auto* inputSpectra = scope.Allocate<std::complex<float>>(s.batch * s.inChannels * s.segments * s.fftSize);
+        InferenceEngine::parallel_for(s.batch * s.inChannels * s.segments, [&] (std::size_t f) {
+            const auto seg = f % s.segments;
+            const auto row = f / s.segments;
+            auto* spectrum = inputSpectra + f * s.fftSize;
+            const auto* in = data + row * s.inLength;
+            std::fill(spectrum, spectrum + s.fftSize, std::complex<float>{});
+            const auto start = seg * s.segment;
+            const auto count = std::min(s.segment, s.paddedLength - start);
+            for (std::size_t i = 0; i < count; ++i) {
+                const auto p = start + i;
+                if ((p >= s.padBegin) && (p < s.padBegin + s.inLength)) {
+                    spectrum[i] = in[p - s.padBegin];
+                }
+            }
+            s.plan.Transform(spectrum, false);
+        });
+
+        // Each (batch, output channel) pair owns its output row, so the
+        // overlapping segment tails never race; rows are chunked so every
+        // chunk reuses one preallocated accumulator
+        const auto rows = s.batch * s.outChannels;
+        const auto chunks = std::min<std::size_t>(rows, static_cast<std::size_t>(parallel_get_max_threads()));
+        auto* accumulators = scope.Allocate<std::complex<float>>(chunks * s.fftSize);
+        InferenceEngine::parallel_for(chunks, [&] (std::size_t chunk) {
+            auto* acc = accumulators + chunk * s.fftSize;
+            for (std::size_t f = rows * chunk / chunks; f < rows * (chunk + 1) / chunks; ++f) {
+                const auto oc = f % s.outChannels;
+                const auto n = f / s.outChannels;
+                auto* outRow = out + f * s.outLength;
+                std::fill(outRow, outRow + s.outLength, 0.f);
+                for (std::size_t seg = 0; seg < s.segments; ++seg) {
+                    std::fill(acc, acc + s.fftSize, std::complex<float>{});
+                    for (std::size_t ic = 0; ic < s.inChannels; ++ic) {
+                        const auto* x = inputSpectra + ((n * s.inChannels + ic) * s.segments + seg) * s.fftSize;
+                        const auto* w = s.weightSpectra.data() + (oc * s.inChannels + ic) * s.fftSize;
+                        for (std::size_t k = 0; k < s.fftSize; ++k) {
+                            acc[k] += x[k] * w[k];
+                        }
+                    }
+                    s.plan.Transform(acc, true);
+                    const auto start = seg * s.segment;
+                    const auto count = std::min(s.fftSize, s.outLength > start ? s.outLength - start : 0);
+                    for (std::size_t i = 0; i < count; ++i) {
+                        outRow[start + i] += acc[i].real();
+                    }
+                }
+            }
+        });
+    }
+
+    std::shared_ptr<State> _state;
+};
+}  // namespace
+
+template <> Converter::Conversion::Ptr Converter::Convert(const opset::ArmFFTConvolution& node) {
+    FFTConvolution convolution{std::make_shared<FFTConvolution::State>(node.get_input_shape(0),
+                                                                       node.get_input_shape(1),
+                                                                       static_cast<std::size_t>(node.get_pads_begin()[0]),
+                                                                       static_cast<std::size_t>(node.get_pads_end()[0]))};
+    const auto& s = *convolution._state;
+    _scratch->Reserve((s.batch * s.inChannels * s.segments +
+                       static_cast<std::size_t>(parallel_get_max_threads())) * s.fftSize * sizeof(std::complex<float>));
+    return MakeConversion(convolution, node.input(0), node.input(1), node.output(0), _scratch);
+}
+}  //  namespace ArmPlugin
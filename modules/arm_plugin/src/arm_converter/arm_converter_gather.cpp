@@ -6,44 +6,64 @@
 #include <arm_compute/runtime/NEON/functions/NEGather.h>
 #include <ngraph/runtime/reference/gather.hpp>
 #include "arm_converter/arm_converter.hpp"
+#include "arm_converter/arm_neon_gather.hpp"
 
 namespace ArmPlugin {
-template <> Converter::Conversion::Ptr Converter::Convert(const opset::Gather& node) {
+// The ACL NEGather only takes scalar or 1D indices (see ArmGather below); the
+// general fallback shares the row-partitioned kernel with GatherND
+template <typename NodeType>
+static Converter::Conversion::Ptr ConvertGatherReference(Converter* converter, const NodeType& node,
+                                                         const std::size_t axis, const std::size_t batchDims) {
+#if defined(__aarch64__)
+    const auto& dataShape = node.get_input_shape(0);
+    std::size_t inner = 1;
+    for (auto d = axis + 1; d < dataShape.size(); ++d) {
+        inner *= dataShape[d];
+    }
+    const auto rows = ngraph::shape_size(node.get_output_shape(0)) / inner;
     auto make = [&] (auto refFunction) {
-        return this->MakeConversion(refFunction,
-                                    node.input(0),
-                                    node.input(1),
-                                    node.output(0),
-                                    node.get_input_shape(0),
-                                    node.get_input_shape(1),
-                                    node.get_output_shape(0),
-                                    static_cast<size_t>(node.get_axis()),
-                                    static_cast<size_t>(node.get_batch_dims()));
+        return converter->MakeConversion(MakeParallelReference(rows, refFunction),
+                                         node.input(0),
+                                         node.input(1),
+                                         node.output(0),
+                                         dataShape,
+                                         node.get_input_shape(1),
+                                         axis,
+                                         batchDims);
     };
-
     return CallSwitch(
-        AP_WRAP(make, ngraph::runtime::reference::gather),
+        AP_WRAP(make, neon::gather),
         node.input(0), allTypes,
         node.input(1), indexTypes);
-}
-
-template <> Converter::Conversion::Ptr Converter::Convert(const ngraph::op::v1::Gather& node) {
+#else
     auto make = [&] (auto refFunction) {
-        return this->MakeConversion(refFunction,
-                                    node.input(0),
-                                    node.input(1),
-                                    node.output(0),
-                                    node.get_input_shape(0),
-                                    node.get_input_shape(1),
-                                    node.get_output_shape(0),
-                                    static_cast<size_t>(node.get_axis()),
-                                    static_cast<size_t>(0));
+        return converter->MakeConversion(refFunction,
+                                         node.input(0),
+                                         node.input(1),
+                                         node.output(0),
+                                         node.get_input_shape(0),
+                                         node.get_input_shape(1),
+                                         node.get_output_shape(0),
+                                         axis,
+                                         batchDims);
     };
-
     return CallSwitch(
         AP_WRAP(make, ngraph::runtime::reference::gather),
         node.input(0), allTypes,
         node.input(1), indexTypes);
+#endif
+}
+
+template <> Converter::Conversion::Ptr Converter::Convert(const opset::Gather& node) {
+    return ConvertGatherReference(this, node,
+                                  static_cast<size_t>(node.get_axis()),
+                                  static_cast<size_t>(node.get_batch_dims()));
+}
+
+template <> Converter::Conversion::Ptr Converter::Convert(const ngraph::op::v1::Gather& node) {
+    return ConvertGatherReference(this, node,
+                                  static_cast<size_t>(node.get_axis()),
+                                  static_cast<size_t>(0));
 }
 
 template <> Converter::Conversion::Ptr Converter::Convert(const opset::ArmGather& node) {
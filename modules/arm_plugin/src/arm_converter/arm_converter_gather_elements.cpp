@@ -4,10 +4,30 @@
 #include <details/ie_exception.hpp>
 
 #include "arm_converter/arm_converter.hpp"
+#include "arm_converter/arm_neon_gather.hpp"
 #include <ngraph/runtime/reference/gather_elements.hpp>
 
 namespace ArmPlugin {
 template<> Converter::Conversion::Ptr Converter::Convert(const opset::GatherElements& node) {
+#if defined(__aarch64__)
+    {
+        auto axis = node.get_axis();
+        if (axis < 0) {
+            axis += node.get_input_shape(0).size();
+        }
+        const auto elements = ngraph::shape_size(node.get_output_shape(0));
+        auto make = [&] (auto refFunction) {
+            return this->MakeConversion(MakeParallelReference(elements, refFunction),
+                                        node.input(0), node.input(1), node.output(0),
+                                        node.get_input_shape(0), node.get_output_shape(0),
+                                        static_cast<std::size_t>(axis));
+        };
+        return CallSwitch(
+            AP_WRAP(make, neon::gather_elements),
+            node.input(0), allTypes,
+            node.input(1), indexTypes);
+    }
+#else
     auto make = [&] (auto refFunction) {
         return this->MakeConversion(refFunction,
                                     node.input(0),
@@ -22,5 +42,6 @@ template<> Converter::Conversion::Ptr Converter::Convert(const opset::GatherElem
         AP_WRAP(make, ngraph::runtime::reference::gather_elements),
         node.input(0), allTypes,
         node.input(1), indexTypes);
+#endif
 }
 }  //  namespace ArmPlugin
@@ -3,6 +3,7 @@
 
 
 #include "arm_converter/arm_converter.hpp"
+#include "arm_converter/arm_neon_gather.hpp"
 #include <ngraph/runtime/reference/gather_nd.hpp>
 
 namespace ArmPlugin {
@@ -11,6 +12,27 @@ template<> Converter::Conversion::Ptr Converter::Convert(const opset::GatherND&
         IE_THROW() << "GatherND node doesn't support " << node.get_output_shape(0) << " output shape.";
     }
 
+#if defined(__aarch64__)
+    {
+        const auto& dataShape = node.get_input_shape(0);
+        const auto& indicesShape = node.get_input_shape(1);
+        const auto batchDims = static_cast<std::size_t>(node.get_batch_dims());
+        std::size_t slice = 1;
+        for (auto d = batchDims + indicesShape.back(); d < dataShape.size(); ++d) {
+            slice *= dataShape[d];
+        }
+        const auto rows = ngraph::shape_size(node.get_output_shape(0)) / slice;
+        auto make = [&] (auto refFunction) {
+            return this->MakeConversion(MakeParallelReference(rows, refFunction),
+                                        node.input(0), node.input(1), node.output(0),
+                                        dataShape, indicesShape, batchDims);
+        };
+        return CallSwitch(
+            AP_WRAP(make, neon::gather_nd),
+            node.input(0), allTypes,
+            node.input(1), indexTypes);
+    }
+#else
     auto make = [&] (auto refFunction) {
         return this->MakeConversion(refFunction,
                                     node.input(0), node.input(1), node.output(0),
@@ -21,6 +43,7 @@ template<> Converter::Conversion::Ptr Converter::Convert(const opset::GatherND&
         AP_WRAP(make, ngraph::runtime::reference::gather_nd),
         node.input(0), allTypes,
         node.input(1), indexTypes);
+#endif
 }
 
 }  //  namespace ArmPlugin
@@ -2,10 +2,18 @@
 // SPDX-License-Identifier: Apache-2.0
 
 
+#include <cmath>
+#include <cstdint>
+#include <type_traits>
+
 #include <arm_compute/runtime/NEON/functions/NEScale.h>
 #include <ngraph/runtime/reference/interpolate.hpp>
+#include <ie_parallel.hpp>
 #include "arm_converter/arm_converter.hpp"
 
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#endif
 
 using Transform_mode  = ngraph::op::v4::Interpolate::CoordinateTransformMode;
 
@@ -40,6 +48,205 @@ void get_default_axes(std::vector<int64_t>& axes_vec,
     return;
 }
 
+// Per-axis resampling table: for every output coordinate the clamped source
+// taps and their weights, precomputed once per inference from the coordinate
+// transformation mode so the hot loops are pure multiply-accumulates
+struct ResampleTable {
+    std::size_t               taps = 0;
+    std::vector<std::int32_t> indices;
+    std::vector<float>        weights;
+};
+
+static float original_coordinate(const std::size_t x, const float scale, const std::size_t in,
+                                 const std::size_t out, const Transform_mode mode) {
+    switch (mode) {
+        case Transform_mode::HALF_PIXEL:
+            return (x + 0.5f) / scale - 0.5f;
+        case Transform_mode::PYTORCH_HALF_PIXEL:
+            return (out > 1) ? ((x + 0.5f) / scale - 0.5f) : 0.f;
+        case Transform_mode::ASYMMETRIC:
+            return x / scale;
+        case Transform_mode::TF_HALF_PIXEL_FOR_NN:
+            return (x + 0.5f) / scale;
+        case Transform_mode::ALIGN_CORNERS:
+            return (out == 1) ? 0.f : x * static_cast<float>(in - 1) / (out - 1);
+        default:
+            return x / scale;
+    }
+}
+
+// Triangle filter; with antialiasing a downscale widens the window to 1/scale
+// source pixels so every one of them contributes. Border taps clamp to the
+// edge, which folds their weight onto the edge pixel like the reference does
+static ResampleTable make_linear_table(const std::size_t in, const std::size_t out, const float scale,
+                                       const Transform_mode mode, const bool antialias) {
+    ResampleTable table;
+    const bool shrink = antialias && (scale < 1.f);
+    const float radius = shrink ? (1.f / scale) : 1.f;
+    const float filterScale = shrink ? scale : 1.f;
+    table.taps = 2 * static_cast<std::size_t>(std::ceil(radius)) + 1;
+    table.indices.assign(out * table.taps, 0);
+    table.weights.assign(out * table.taps, 0.f);
+    const auto last = static_cast<std::int64_t>(in) - 1;
+    for (std::size_t x = 0; x < out; ++x) {
+        const float center = original_coordinate(x, scale, in, out, mode);
+        const auto lo = static_cast<std::int64_t>(std::ceil(center - radius));
+        auto* indices = &table.indices[x * table.taps];
+        auto* weights = &table.weights[x * table.taps];
+        float sum = 0.f;
+        for (std::size_t t = 0; t < table.taps; ++t) {
+            const auto i = lo + static_cast<std::int64_t>(t);
+            const float weight = std::max(0.f, 1.f - std::abs((center - i) * filterScale));
+            indices[t] = static_cast<std::int32_t>(std::min(std::max<std::int64_t>(i, 0), last));
+            weights[t] = weight;
+            sum += weight;
+        }
+        if (sum > 0.f) {
+            for (std::size_t t = 0; t < table.taps; ++t) {
+                weights[t] /= sum;
+            }
+        }
+    }
+    return table;
+}
+
+static ResampleTable make_cubic_table(const std::size_t in, const std::size_t out, const float scale,
+                                      const Transform_mode mode, const float a) {
+    ResampleTable table;
+    table.taps = 4;
+    table.indices.assign(out * table.taps, 0);
+    table.weights.assign(out * table.taps, 0.f);
+    auto kernel = [a] (float d) {
+        d = std::abs(d);
+        if (d <= 1.f) {
+            return ((a + 2.f) * d - (a + 3.f)) * d * d + 1.f;
+        }
+        return (d < 2.f) ? ((((d - 5.f) * d + 8.f) * d - 4.f) * a) : 0.f;
+    };
+    const auto last = static_cast<std::int64_t>(in) - 1;
+    for (std::size_t x = 0; x < out; ++x) {
+        const float center = original_coordinate(x, scale, in, out, mode);
+        const auto l = static_cast<std::int64_t>(std::floor(center));
+        const float frac = center - l;
+        auto* indices = &table.indices[x * table.taps];
+        auto* weights = &table.weights[x * table.taps];
+        for (std::size_t t = 0; t < table.taps; ++t) {
+            const auto i = (l - 1) + static_cast<std::int64_t>(t);
+            indices[t] = static_cast<std::int32_t>(std::min(std::max<std::int64_t>(i, 0), last));
+            weights[t] = kernel(frac + 1.f - static_cast<float>(t));
+        }
+    }
+    return table;
+}
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+template <typename T>
+static void store_row4(T* dst, const float32x4_t values) {
+    float lanes[4];
+    vst1q_f32(lanes, values);
+    for (int i = 0; i < 4; ++i) {
+        dst[i] = static_cast<T>(lanes[i]);
+    }
+}
+static void store_row4(float* dst, const float32x4_t values) {
+    vst1q_f32(dst, values);
+}
+#ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+static void store_row4(ngraph::float16* dst, const float32x4_t values) {
+    vst1_f16(reinterpret_cast<float16_t*>(dst), vcvt_f16_f32(values));
+}
+#endif
+#endif
+
+// Separable two-pass resampling of the 4D spatial axes: a scalar horizontal
+// pass into a float working plane, then a vertical pass whose inner loop is a
+// row-wise NEON multiply-accumulate. Rows are independent, so both passes
+// parallelize over (plane, row)
+template <typename T>
+static bool separable_resample(const T* input_data,
+                               const ngraph::Shape& input_shape,
+                               const std::vector<float>& scales,
+                               const std::vector<int64_t>& axes,
+                               T* out,
+                               const ngraph::Shape& out_shape,
+                               const ngraph::op::v4::Interpolate::InterpolateAttrs& attrs,
+                               ScratchArena::Scope& scratch) {
+    using InterpolateMode = ngraph::op::v4::Interpolate::InterpolateMode;
+    if (!(std::is_same<T, float>::value || std::is_same<T, ngraph::float16>::value)) {
+        return false;
+    }
+    if ((attrs.mode != InterpolateMode::LINEAR_ONNX) && (attrs.mode != InterpolateMode::CUBIC)) {
+        return false;
+    }
+    if ((input_shape.size() != 4) || (out_shape.size() != 4) ||
+        (input_shape[0] != out_shape[0]) || (input_shape[1] != out_shape[1])) {
+        return false;
+    }
+    float scaleH = static_cast<float>(out_shape[2]) / input_shape[2];
+    float scaleW = static_cast<float>(out_shape[3]) / input_shape[3];
+    for (std::size_t i = 0; i < axes.size(); ++i) {
+        if (axes[i] == 2) {
+            scaleH = scales[i];
+        } else if (axes[i] == 3) {
+            scaleW = scales[i];
+        }
+    }
+    const auto& coord_mode = attrs.coordinate_transformation_mode;
+    ResampleTable tableH, tableW;
+    if (attrs.mode == InterpolateMode::CUBIC) {
+        tableH = make_cubic_table(input_shape[2], out_shape[2], scaleH, coord_mode, attrs.cube_coeff);
+        tableW = make_cubic_table(input_shape[3], out_shape[3], scaleW, coord_mode, attrs.cube_coeff);
+    } else {
+        tableH = make_linear_table(input_shape[2], out_shape[2], scaleH, coord_mode, attrs.antialias);
+        tableW = make_linear_table(input_shape[3], out_shape[3], scaleW, coord_mode, attrs.antialias);
+    }
+
+    const auto planes = input_shape[0] * input_shape[1];
+    const auto inH = input_shape[2];
+    const auto inW = input_shape[3];
+    const auto outH = out_shape[2];
+    const auto outW = out_shape[3];
+
+    float* temp = scratch.Allocate<float>(planes * inH * outW);
+    InferenceEngine::parallel_for2d(planes, inH, [&] (std::size_t plane, std::size_t y) {
+        const T* row = input_data + (plane * inH + y) * inW;
+        float* tempRow = temp + (plane * inH + y) * outW;
+        for (std::size_t x = 0; x < outW; ++x) {
+            const auto* indices = &tableW.indices[x * tableW.taps];
+            const auto* weights = &tableW.weights[x * tableW.taps];
+            float acc = 0.f;
+            for (std::size_t t = 0; t < tableW.taps; ++t) {
+                acc += weights[t] * static_cast<float>(row[indices[t]]);
+            }
+            tempRow[x] = acc;
+        }
+    });
+    InferenceEngine::parallel_for2d(planes, outH, [&] (std::size_t plane, std::size_t y) {
+        T* outRow = out + (plane * outH + y) * outW;
+        const auto* indices = &tableH.indices[y * tableH.taps];
+        const auto* weights = &tableH.weights[y * tableH.taps];
+        const float* planeBase = temp + plane * inH * outW;
+        std::size_t x = 0;
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+        for (; x + 4 <= outW; x += 4) {
+            float32x4_t acc = vdupq_n_f32(0.f);
+            for (std::size_t t = 0; t < tableH.taps; ++t) {
+                acc = vmlaq_n_f32(acc, vld1q_f32(planeBase + indices[t] * outW + x), weights[t]);
+            }
+            store_row4(outRow + x, acc);
+        }
+#endif
+        for (; x < outW; ++x) {
+            float acc = 0.f;
+            for (std::size_t t = 0; t < tableH.taps; ++t) {
+                acc += weights[t] * planeBase[indices[t] * outW + x];
+            }
+            outRow[x] = static_cast<T>(acc);
+        }
+    });
+    return true;
+}
+
 template <typename T, typename V, typename U>
 void wrap_interpolate(const T* input_data,
                       const ngraph::Shape& input_shape,
@@ -50,7 +257,8 @@ void wrap_interpolate(const T* input_data,
                       const ngraph::Shape& axes_shape,
                       T* out,
                       const ngraph::Shape& out_shape,
-                      const ngraph::op::v4::Interpolate::InterpolateAttrs& attrs) {
+                      const ngraph::op::v4::Interpolate::InterpolateAttrs& attrs,
+                      const ScratchArena::Ptr& scratch) {
     auto& pads_begin = attrs.pads_begin;
     auto& pads_end   = attrs.pads_end;
     ngraph::Shape padded_shape = input_shape;
@@ -58,10 +266,12 @@ void wrap_interpolate(const T* input_data,
         padded_shape[i] += pads_begin[i] + pads_end[i];
     }
 
+    ScratchArena::Scope scope{scratch};
     auto type_size = sizeof(T);
-    std::vector<uint8_t> padded_input_data(ngraph::shape_size(padded_shape) * type_size, 0);
+    const auto padded_size = ngraph::shape_size(padded_shape) * type_size;
     const uint8_t* data_ptr  = reinterpret_cast<const uint8_t*>(input_data);
-    uint8_t* padded_data_ptr = padded_input_data.data();
+    uint8_t* padded_data_ptr = scope.Allocate<uint8_t>(padded_size);
+    std::fill(padded_data_ptr, padded_data_ptr + padded_size, uint8_t{0});
 
     pad_input_data(data_ptr, padded_data_ptr, type_size, input_shape, padded_shape, pads_begin);
 
@@ -84,6 +294,20 @@ void wrap_interpolate(const T* input_data,
         scales_vec = std::vector<float>(scales, scales + scales_size);
     }
 
+    // The modes NEScale cannot express (cubic, antialiased linear-onnx) go
+    // through the row-parallel separable kernels; everything else keeps the
+    // reference behaviour
+    if (separable_resample(reinterpret_cast<const T*>(padded_data_ptr),
+                           padded_shape,
+                           scales_vec,
+                           axes_vec,
+                           out,
+                           out_shape,
+                           attrs,
+                           scope)) {
+        return;
+    }
+
     ngraph::runtime::reference::interpolate<T>(reinterpret_cast<T*>(padded_data_ptr),
                                                padded_shape,
                                                scales_vec,
@@ -94,6 +318,17 @@ void wrap_interpolate(const T* input_data,
 }
 
 template<> Converter::Conversion::Ptr Converter::Convert(const opset::Interpolate& node) {
+    ngraph::Shape padded_shape = node.get_input_shape(0);
+    const auto& attrs = node.get_attrs();
+    for (std::size_t i = 0; i < attrs.pads_begin.size(); i++) {
+        padded_shape[i] += attrs.pads_begin[i] + attrs.pads_end[i];
+    }
+    const auto& out_shape = node.get_output_shape(0);
+    auto scratchBytes = ngraph::shape_size(padded_shape) * node.get_input_element_type(0).size();
+    if (padded_shape.size() == 4) {
+        scratchBytes += padded_shape[0] * padded_shape[1] * padded_shape[2] * out_shape[3] * sizeof(float);
+    }
+    _scratch->Reserve(scratchBytes);
     auto make = [&] (auto refFunction) {
     if (node.get_input_size() == 4) {
         return this->MakeConversion(refFunction,
@@ -106,7 +341,8 @@ template<> Converter::Conversion::Ptr Converter::Convert(const opset::Interpolat
                                     node.get_input_shape(3),
                                     node.output(0),
                                     node.get_output_shape(0),
-                                    node.get_attrs());
+                                    node.get_attrs(),
+                                    _scratch);
     }
     return this->MakeConversion(refFunction,
                                 node.input(0),
@@ -118,7 +354,8 @@ template<> Converter::Conversion::Ptr Converter::Convert(const opset::Interpolat
                                 ngraph::Shape{},
                                 node.output(0),
                                 node.get_output_shape(0),
-                                node.get_attrs());
+                                node.get_attrs(),
+                                _scratch);
     };
     return CallSwitch(
         AP_WRAP(make, wrap_interpolate),
@@ -6,6 +6,7 @@
 #include <arm_compute/runtime/NEON/functions/NEMeanStdDevNormalizationLayer.h>
 #include <ngraph/runtime/reference/mvn.hpp>
 #include "arm_converter/arm_converter.hpp"
+#include "arm_converter/arm_neon_norm.hpp"
 
 namespace ArmPlugin {
 template <typename U>
@@ -46,6 +47,42 @@ void wrap_mvn_6(const T* arg,
 }
 
 template <> Converter::Conversion::Ptr Converter::Convert(const opset::MVN& node) {
+#if defined(__aarch64__)
+    // Reductions over a trailing run of axes see each normalization group as
+    // one dense row: a single Welford traversal per row replaces the
+    // mean/variance/normalize passes of the reference, with the rows split
+    // across the scheduler threads. LayerNorm-style shapes land here
+    if (node.get_input_element_type(0) == ngraph::element::f32) {
+        auto axesConstant = ov::as_type_ptr<opset::Constant>(node.input_value(1).get_node_shared_ptr());
+        if (axesConstant != nullptr) {
+            const auto& inShape = node.get_input_shape(0);
+            const auto rank = inShape.size();
+            auto axes = axesConstant->cast_vector<std::int64_t>();
+            for (auto&& axis : axes) {
+                axis = (axis < 0) ? (axis + rank) : axis;
+            }
+            std::sort(axes.begin(), axes.end());
+            bool trailing = !axes.empty() && (axes.back() == static_cast<std::int64_t>(rank) - 1);
+            for (std::size_t i = 1; i < axes.size(); ++i) {
+                trailing = trailing && (axes[i] == axes[i - 1] + 1);
+            }
+            if (trailing) {
+                std::size_t inner = 1;
+                for (auto&& axis : axes) {
+                    inner *= inShape[axis];
+                }
+                const auto outer = ngraph::shape_size(inShape) / inner;
+                return MakeConversion(MakeParallelReference(outer, neon::mvn_rows_f32),
+                                      node.input(0),
+                                      node.output(0),
+                                      inner,
+                                      node.get_normalize_variance(),
+                                      node.get_eps(),
+                                      node.get_eps_mode());
+            }
+        }
+    }
+#endif
     auto make = [&] (auto refFunction) {
         return this->MakeConversion(refFunction,
                                     node.input(0),
@@ -3,8 +3,13 @@
 
 
 #include "arm_converter/arm_converter.hpp"
+#include <ie_parallel.hpp>
 #include <ngraph/runtime/reference/non_max_suppression.hpp>
 
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#endif
+
 namespace ArmPlugin {
 static void normalize_corner(float* boxes, size_t size) {
     size_t total_num_of_boxes = size / 4;
@@ -50,19 +55,207 @@ static void normalize_center(float* boxes, size_t size) {
     }
 }
 
-static std::vector<float> prepare_boxes_data(const float* boxes,
-                                             const ngraph::Shape& boxes_shape,
-                                             const ngraph::op::v9::NonMaxSuppression::BoxEncodingType box_encoding) {
+static float* prepare_boxes_data(const float* boxes,
+                                 const ngraph::Shape& boxes_shape,
+                                 const ngraph::op::v9::NonMaxSuppression::BoxEncodingType box_encoding,
+                                 ScratchArena::Scope& scratch) {
     auto size = ngraph::shape_size(boxes_shape);
-    std::vector<float> normalized_boxes(boxes, boxes + size);
+    float* normalized_boxes = scratch.Allocate<float>(size);
+    std::copy(boxes, boxes + size, normalized_boxes);
     if (box_encoding == ngraph::op::v9::NonMaxSuppression::BoxEncodingType::CORNER) {
-        normalize_corner(normalized_boxes.data(), size);
+        normalize_corner(normalized_boxes, size);
     } else {
-        normalize_center(normalized_boxes.data(), size);
+        normalize_center(normalized_boxes, size);
     }
     return normalized_boxes;
 }
 
+struct ClassNmsResult {
+    std::vector<int64_t> box_indices;
+    std::vector<float> scores;
+};
+
+// Greedy hard NMS of one class of one batch. Selected boxes are kept as
+// structure-of-arrays so the candidate is compared against four of them per
+// NEON iteration; the division-free form inter > threshold * union gives the
+// same decisions as iou > threshold for the non negative areas produced by the
+// normalization above.
+static void nms_single_class(const float* boxes,
+                             const float* scores,
+                             const int64_t num_boxes,
+                             const int64_t max_output_boxes,
+                             const float iou_threshold,
+                             const float score_threshold,
+                             ClassNmsResult& result) {
+    if (max_output_boxes <= 0) {
+        return;
+    }
+    std::vector<std::pair<float, int64_t>> candidates;
+    for (int64_t i = 0; i < num_boxes; ++i) {
+        if (scores[i] > score_threshold) {
+            candidates.emplace_back(scores[i], i);
+        }
+    }
+    std::sort(candidates.begin(), candidates.end(), [](const auto& l, const auto& r) {
+        return l.first > r.first || (l.first == r.first && l.second < r.second);
+    });
+
+    std::vector<float> sel_ymin, sel_xmin, sel_ymax, sel_xmax, sel_area;
+    for (const auto& [score, box_idx] : candidates) {
+        if (static_cast<int64_t>(result.box_indices.size()) >= max_output_boxes) {
+            break;
+        }
+        const float* box = boxes + box_idx * 4;
+        const float ymin = box[0];
+        const float xmin = box[1];
+        const float ymax = box[2];
+        const float xmax = box[3];
+        const float area = (ymax - ymin) * (xmax - xmin);
+        const std::size_t count = sel_ymin.size();
+        bool suppressed = false;
+        std::size_t j = 0;
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+        {
+            const float32x4_t cand_ymin = vdupq_n_f32(ymin);
+            const float32x4_t cand_xmin = vdupq_n_f32(xmin);
+            const float32x4_t cand_ymax = vdupq_n_f32(ymax);
+            const float32x4_t cand_xmax = vdupq_n_f32(xmax);
+            const float32x4_t cand_area = vdupq_n_f32(area);
+            const float32x4_t threshold = vdupq_n_f32(iou_threshold);
+            const float32x4_t zero = vdupq_n_f32(0.f);
+            for (; j + 4 <= count && !suppressed; j += 4) {
+                const float32x4_t inter_h = vmaxq_f32(vsubq_f32(vminq_f32(vld1q_f32(&sel_ymax[j]), cand_ymax),
+                                                                vmaxq_f32(vld1q_f32(&sel_ymin[j]), cand_ymin)),
+                                                      zero);
+                const float32x4_t inter_w = vmaxq_f32(vsubq_f32(vminq_f32(vld1q_f32(&sel_xmax[j]), cand_xmax),
+                                                                vmaxq_f32(vld1q_f32(&sel_xmin[j]), cand_xmin)),
+                                                      zero);
+                const float32x4_t inter = vmulq_f32(inter_h, inter_w);
+                const float32x4_t uni = vsubq_f32(vaddq_f32(vld1q_f32(&sel_area[j]), cand_area), inter);
+                const uint32x4_t over = vcgtq_f32(inter, vmulq_f32(threshold, uni));
+                const uint32x2_t any = vorr_u32(vget_low_u32(over), vget_high_u32(over));
+                if (vget_lane_u32(vpmax_u32(any, any), 0)) {
+                    suppressed = true;
+                }
+            }
+        }
+#endif
+        for (; j < count && !suppressed; ++j) {
+            const float inter_h = std::max(0.f, std::min(sel_ymax[j], ymax) - std::max(sel_ymin[j], ymin));
+            const float inter_w = std::max(0.f, std::min(sel_xmax[j], xmax) - std::max(sel_xmin[j], xmin));
+            const float inter = inter_h * inter_w;
+            if (inter > iou_threshold * (sel_area[j] + area - inter)) {
+                suppressed = true;
+            }
+        }
+        if (!suppressed) {
+            sel_ymin.push_back(ymin);
+            sel_xmin.push_back(xmin);
+            sel_ymax.push_back(ymax);
+            sel_xmax.push_back(xmax);
+            sel_area.push_back(area);
+            result.box_indices.push_back(box_idx);
+            result.scores.push_back(score);
+        }
+    }
+}
+
+// Hard (soft_nms_sigma == 0) NonMaxSuppression-9 with per-class parallelism
+// and NEON IoU; signature matches nms9 so the converter can pick either
+static void nms9_native(const float* boxes_data,
+                        const ngraph::Shape& boxes_data_shape,
+                        const float* scores_data,
+                        const ngraph::Shape& scores_data_shape,
+                        int64_t max_output_boxes_per_class,
+                        float iou_threshold,
+                        float score_threshold,
+                        float soft_nms_sigma,
+                        const ngraph::Shape& out_shape,
+                        const bool sort_result_descending,
+                        const ngraph::element::Type out_type,
+                        const ngraph::HostTensorVector& outputs,
+                        const ngraph::element::Type selected_scores_type,
+                        const ngraph::op::v9::NonMaxSuppression::BoxEncodingType box_encoding,
+                        const ScratchArena::Ptr& scratch) {
+    const auto num_batches = scores_data_shape[0];
+    const auto num_classes = scores_data_shape[1];
+    const auto num_boxes = static_cast<int64_t>(scores_data_shape[2]);
+    ScratchArena::Scope scope{scratch};
+    const float* normalized_boxes = prepare_boxes_data(boxes_data, boxes_data_shape, box_encoding, scope);
+
+    std::vector<ClassNmsResult> class_results(num_batches * num_classes);
+    InferenceEngine::parallel_for(num_batches * num_classes, [&] (int idx) {
+        const auto batch = idx / num_classes;
+        nms_single_class(normalized_boxes + batch * num_boxes * 4,
+                         scores_data + idx * num_boxes,
+                         num_boxes,
+                         std::min(max_output_boxes_per_class, num_boxes),
+                         iou_threshold,
+                         score_threshold,
+                         class_results[idx]);
+    });
+
+    struct Triplet {
+        int64_t batch;
+        int64_t cls;
+        int64_t box;
+        float score;
+    };
+    std::vector<Triplet> merged;
+    for (std::size_t idx = 0; idx < class_results.size(); ++idx) {
+        const auto& class_result = class_results[idx];
+        const auto batch = static_cast<int64_t>(idx / num_classes);
+        const auto cls = static_cast<int64_t>(idx % num_classes);
+        for (std::size_t k = 0; k < class_result.box_indices.size(); ++k) {
+            merged.push_back({batch, cls, class_result.box_indices[k], class_result.scores[k]});
+        }
+    }
+    if (sort_result_descending) {
+        std::stable_sort(
+            merged.begin(), merged.end(), [](const Triplet& l, const Triplet& r) { return l.score > r.score; });
+    }
+    const auto total_capacity = ngraph::shape_size(out_shape);
+    const auto valid_outputs = std::min<std::size_t>(merged.size(), out_shape[0]);
+
+    if (out_type == ngraph::element::i64) {
+        int64_t* indices_ptr = outputs[0]->get_data_ptr<int64_t>();
+        for (std::size_t i = 0; i < valid_outputs; ++i) {
+            indices_ptr[3 * i] = merged[i].batch;
+            indices_ptr[3 * i + 1] = merged[i].cls;
+            indices_ptr[3 * i + 2] = merged[i].box;
+        }
+        std::fill(indices_ptr + 3 * valid_outputs, indices_ptr + total_capacity, int64_t{-1});
+        *outputs[2]->get_data_ptr<int64_t>() = static_cast<int64_t>(valid_outputs);
+    } else {
+        int32_t* indices_ptr = outputs[0]->get_data_ptr<int32_t>();
+        for (std::size_t i = 0; i < valid_outputs; ++i) {
+            indices_ptr[3 * i] = static_cast<int32_t>(merged[i].batch);
+            indices_ptr[3 * i + 1] = static_cast<int32_t>(merged[i].cls);
+            indices_ptr[3 * i + 2] = static_cast<int32_t>(merged[i].box);
+        }
+        std::fill(indices_ptr + 3 * valid_outputs, indices_ptr + total_capacity, int32_t{-1});
+        *outputs[2]->get_data_ptr<int32_t>() = static_cast<int32_t>(valid_outputs);
+    }
+
+    if (selected_scores_type == ngraph::element::f16) {
+        ngraph::float16* scores_ptr = outputs[1]->get_data_ptr<ngraph::float16>();
+        for (std::size_t i = 0; i < valid_outputs; ++i) {
+            scores_ptr[3 * i] = ngraph::float16(static_cast<float>(merged[i].batch));
+            scores_ptr[3 * i + 1] = ngraph::float16(static_cast<float>(merged[i].cls));
+            scores_ptr[3 * i + 2] = ngraph::float16(merged[i].score);
+        }
+        std::fill(scores_ptr + 3 * valid_outputs, scores_ptr + total_capacity, ngraph::float16(-1));
+    } else {
+        float* scores_ptr = outputs[1]->get_data_ptr<float>();
+        for (std::size_t i = 0; i < valid_outputs; ++i) {
+            scores_ptr[3 * i] = static_cast<float>(merged[i].batch);
+            scores_ptr[3 * i + 1] = static_cast<float>(merged[i].cls);
+            scores_ptr[3 * i + 2] = merged[i].score;
+        }
+        std::fill(scores_ptr + 3 * valid_outputs, scores_ptr + total_capacity, -1.f);
+    }
+}
+
 static void nms9(const float* boxes_data,
           const ngraph::Shape& boxes_data_shape,
           const float* scores_data,
@@ -76,13 +269,15 @@ static void nms9(const float* boxes_data,
           const ngraph::element::Type out_type,
           const ngraph::HostTensorVector& outputs,
           const ngraph::element::Type selected_scores_type,
-          const ngraph::op::v9::NonMaxSuppression::BoxEncodingType box_encoding) {
+          const ngraph::op::v9::NonMaxSuppression::BoxEncodingType box_encoding,
+          const ScratchArena::Ptr& scratch) {
     std::vector<int64_t> selected_indices(ngraph::shape_size(out_shape));
     std::vector<float>   selected_scores(ngraph::shape_size(out_shape));
     int64_t valid_outputs = 0;
-    std::vector<float> normalized_boxes = prepare_boxes_data(boxes_data, boxes_data_shape, box_encoding);
+    ScratchArena::Scope scope{scratch};
+    const float* normalized_boxes = prepare_boxes_data(boxes_data, boxes_data_shape, box_encoding, scope);
 
-    ngraph::runtime::reference::non_max_suppression(normalized_boxes.data(),
+    ngraph::runtime::reference::non_max_suppression(normalized_boxes,
                                                     boxes_data_shape,
                                                     scores_data,
                                                     scores_data_shape,
@@ -159,8 +354,15 @@ template<> Converter::Conversion::Ptr Converter::Convert(const ngraph::op::v9::N
                                     node.output(0).get_element_type(),
                                     HostTensors{hosts, &node},
                                     selected_scores_type,
-                                    node.get_box_encoding());
+                                    node.get_box_encoding(),
+                                    _scratch);
     };
+    _scratch->Reserve(ngraph::shape_size(node.get_input_shape(0)) * sizeof(float));
+    // Soft-NMS score decay can resurrect boxes a greedy pass discards, so only
+    // the hard case takes the native implementation
+    if (node.soft_nms_sigma_from_input() == 0.0f) {
+        return make(nms9_native);
+    }
     return make(nms9);
 }
 }  //  namespace ArmPlugin
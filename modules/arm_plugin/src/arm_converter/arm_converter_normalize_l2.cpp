@@ -5,9 +5,37 @@
 #include <arm_compute/runtime/NEON/functions/NEL2NormalizeLayer.h>
 #include <ngraph/runtime/reference/normalize_l2.hpp>
 #include "arm_converter/arm_converter.hpp"
+#include "arm_converter/arm_neon_norm.hpp"
 
 namespace ArmPlugin {
 template<> Converter::Conversion::Ptr Converter::Convert(const opset::NormalizeL2& node) {
+#if defined(__aarch64__)
+    // Same trailing-axes fast path as MVN: one sum-of-squares traversal and
+    // one scaled store per row, rows split across the scheduler threads
+    if (node.get_input_element_type(0) == ngraph::element::f32) {
+        const auto& inShape = node.get_input_shape(0);
+        const auto rank = inShape.size();
+        auto axes = node.get_reduction_axes().to_vector();
+        std::sort(axes.begin(), axes.end());
+        bool trailing = !axes.empty() && (axes.back() == rank - 1);
+        for (std::size_t i = 1; i < axes.size(); ++i) {
+            trailing = trailing && (axes[i] == axes[i - 1] + 1);
+        }
+        if (trailing) {
+            std::size_t inner = 1;
+            for (auto&& axis : axes) {
+                inner *= inShape[axis];
+            }
+            const auto outer = ngraph::shape_size(inShape) / inner;
+            return MakeConversion(MakeParallelReference(outer, neon::normalize_l2_rows_f32),
+                                  node.input(0),
+                                  node.output(0),
+                                  inner,
+                                  node.get_eps(),
+                                  node.get_eps_mode());
+        }
+    }
+#endif
     auto make = [&] (auto refFunction) {
         return this->MakeConversion(refFunction,
                                     node.input(0),
@@ -5,8 +5,33 @@
 
 #include <arm_compute/runtime/NEON/functions/NEPadLayer.h>
 #include "arm_converter/arm_converter.hpp"
+#include "arm_converter/arm_neon_pad.hpp"
 
 namespace ArmPlugin {
+#if defined(__aarch64__)
+// Row-blocked engine for the modes NEPadLayer rejects: EDGE, and SYMMETRIC
+// with a non-zero pads end
+static Converter::Conversion::Ptr ConvertPadFallback(Converter* converter, const opset::Pad& node) {
+    const auto kind = node.get_pad_mode() == ngraph::op::PadMode::EDGE ? neon::PadKind::Edge
+                                                                       : neon::PadKind::Symmetric;
+    std::vector<std::int64_t> padsBegin;
+    for (auto pad : node.get_pads_begin()) {
+        padsBegin.push_back(pad);
+    }
+    const auto plan = neon::MakePadPlan(node.get_input_shape(0), node.get_output_shape(0), padsBegin, kind);
+    const auto rows = ngraph::shape_size(node.get_output_shape(0)) / node.get_output_shape(0).back();
+    auto make = [&] (auto padFunction) {
+        if (node.get_input_size() == 4) {
+            return converter->MakeConversion(MakeParallelReference(rows, padFunction),
+                                             node.input(0), node.input(3), node.output(0), plan);
+        }
+        return converter->MakeConversion(MakeParallelReference(rows, padFunction),
+                                         node.input(0), nullptr, node.output(0), plan);
+    };
+    return CallSwitch(AP_WRAP(make, neon::pad_rows), node.input(0), allTypes);
+}
+#endif
+
 template<> Converter::Conversion::Ptr Converter::Convert(const opset::Pad& node) {
     auto pads_begin = node.get_pads_begin();
     auto pads_end   = node.get_pads_end();
@@ -16,6 +41,10 @@ template<> Converter::Conversion::Ptr Converter::Convert(const opset::Pad& node)
         padding.emplace_back(pads_begin[dim], pads_end[dim]);
     }
 
+#if defined(__aarch64__)
+    const auto allNonNegative = std::all_of(pads_begin.begin(), pads_begin.end(), [](int i){return i >= 0;}) &&
+                                std::all_of(pads_end.begin(), pads_end.end(), [](int i){return i >= 0;});
+#endif
     arm_compute::PaddingMode mode;
     switch (node.get_pad_mode()) {
         case ngraph::op::PadMode::CONSTANT:
@@ -27,11 +56,23 @@ template<> Converter::Conversion::Ptr Converter::Convert(const opset::Pad& node)
         case ngraph::op::PadMode::SYMMETRIC:
             mode = arm_compute::PaddingMode::SYMMETRIC;
             break;
+#if defined(__aarch64__)
+        case ngraph::op::PadMode::EDGE:
+            if (allNonNegative) {
+                return ConvertPadFallback(this, node);
+            }
+            IE_THROW() << "Unsupported pad mode: " << node.get_pad_mode();
+#endif
         default:
             IE_THROW() << "Unsupported pad mode: " << node.get_pad_mode();
     }
 
     if (mode == arm_compute::PaddingMode::SYMMETRIC && !std::all_of(pads_end.begin(), pads_end.end(), [](int i){return i == 0;})) {
+#if defined(__aarch64__)
+        if (allNonNegative) {
+            return ConvertPadFallback(this, node);
+        }
+#endif
         IE_THROW() << "Unsupported SYMMETRIC pad mode with a non-zero pads end";
     }
 
@@ -42,4 +83,4 @@ template<> Converter::Conversion::Ptr Converter::Convert(const opset::Pad& node)
 
     return MakeConversion<arm_compute::NEPadLayer>(node.input(0), node.output(0), padding, constant_value, mode);
 }
-} // namespace ArmPlugin
\ No newline at end of file
+} // namespace ArmPlugin
@@ -3,10 +3,24 @@
 
 
 #include "arm_converter/arm_converter.hpp"
+#include "arm_converter/arm_neon_roi.hpp"
 #include <ngraph/runtime/reference/psroi_pooling.hpp>
 
 namespace ArmPlugin {
 template<> Converter::Conversion::Ptr Converter::Convert(const opset::PSROIPooling& node) {
+#if defined(__aarch64__)
+    // Bilinear mode interpolates between spatial bins and stays on the
+    // reference path; average mode reduces dense rows and vectorizes well
+    if ((node.get_input_element_type(0) == ngraph::element::f32) && (node.get_mode() == "average")) {
+        return MakeConversion(MakeParallelReference(node.get_input_shape(1)[0], neon::psroi_pooling_avg_f32),
+                              node.input(0),
+                              node.get_input_shape(0),
+                              node.input(1),
+                              node.output(0),
+                              node.get_output_shape(0),
+                              node.get_spatial_scale());
+    }
+#endif
     auto make = [&] (auto refFunction) {
         return this->MakeConversion(refFunction,
                                     node.input(0),
@@ -8,13 +8,46 @@
 #include <arm_compute/runtime/NEON/NEScheduler.h>
 #include <arm_compute/runtime/NEON/functions/NEReduceMean.h>
 #include <ngraph/runtime/reference/logical_reduction.hpp>
+#include <ngraph/runtime/reference/reduce_l1.hpp>
+#include <ngraph/runtime/reference/reduce_l2.hpp>
 #include "arm_converter/arm_converter.hpp"
+#include "arm_converter/arm_neon_reduce.hpp"
 #include "opset/utils.hpp"
 
 namespace ArmPlugin {
+#if defined(__aarch64__)
+// Single-pass engine for the axis-collapsed [outer, red, inner] plans; the
+// work splits over independent output rows, so every thread accumulates into
+// its own registers or destination row
+template<typename NodeType>
+static Converter::Conversion::Ptr MakeNeonReduce(Converter* converter, const NodeType& node,
+                                                 const neon::ReducePlan& plan, const neon::ReduceKind kind) {
+    if (plan.inner == 1) {
+        return converter->MakeConversion(MakeParallelReference(plan.outer, neon::reduce_rows_f32),
+                                         node.input(0), node.output(0), plan.red, kind);
+    }
+    return converter->MakeConversion(MakeParallelReference(plan.outer, neon::reduce_planes_f32),
+                                     node.input(0), node.output(0), plan.red, plan.inner, kind);
+}
+#endif
+
 template<typename Reduce>
 static auto ConvertReduce(const Reduce& node, const arm_compute::ReductionOperation& op, Converter* converter) {
     auto axes = safe_cast<opset::Constant>(node.input_value(1).get_node())->template cast_vector<std::int64_t>();
+#if defined(__aarch64__)
+    // ConvertReduceMultiAxis leaves contiguous f32 multi-axis reductions
+    // intact for this path; anything else still converts per axis
+    if ((axes.size() != 1) && (node.get_input_element_type(0) == ngraph::element::f32)) {
+        const auto plan = neon::MakeReducePlan(node.get_input_shape(0), axes);
+        if (plan.contiguous) {
+            const auto kind = (op == arm_compute::ReductionOperation::PROD) ? neon::ReduceKind::Prod
+                            : (op == arm_compute::ReductionOperation::MIN)  ? neon::ReduceKind::Min
+                            : (op == arm_compute::ReductionOperation::MAX)  ? neon::ReduceKind::Max
+                                                                            : neon::ReduceKind::Sum;
+            return MakeNeonReduce(converter, node, plan, kind);
+        }
+    }
+#endif
     if (axes.size() != 1) {
         IE_THROW() << "Arm Plugin: Multiple reduction axes aren't supported";
     }
@@ -154,6 +187,18 @@ protected:
 template<> Converter::Conversion::Ptr Converter::Convert(const opset::ReduceMean& node) {
     arm_compute::Coordinates axes;
     auto reduction_axes = safe_cast<opset::Constant>(node.input_value(1).get_node())->cast_vector<std::int64_t>();
+#if defined(__aarch64__)
+    // A collapsible mean (global average pool included) runs as one pass;
+    // quantized means keep the NEReduceMeanQI path below
+    if ((node.get_input_element_type(0) == ngraph::element::f32) &&
+        (node.get_rt_info().count("InputPrescaleInfo") == 0) &&
+        (node.get_rt_info().count("QuantizationInfo") == 0)) {
+        const auto plan = neon::MakeReducePlan(node.get_input_shape(0), reduction_axes);
+        if (plan.contiguous) {
+            return MakeNeonReduce(this, node, plan, neon::ReduceKind::Mean);
+        }
+    }
+#endif
     for (size_t i = 0; i < reduction_axes.size(); ++i) {
         auto pos = AxisCast(i, reduction_axes.size());
         axes.set(pos, reduction_axes[i]);
@@ -167,6 +212,50 @@ template<> Converter::Conversion::Ptr Converter::Convert(const opset::ReduceMean
     return MakeConversion<NEReduceMeanQI>(node.input(0), axes, node.get_keep_dims(), node.output(0), iInfo, qInfo);
 }
 
+template<> Converter::Conversion::Ptr Converter::Convert(const opset::ReduceL1& node) {
+    auto axes = safe_cast<opset::Constant>(node.input_value(1).get_node())->cast_vector<std::int64_t>();
+#if defined(__aarch64__)
+    if (node.get_input_element_type(0) == ngraph::element::f32) {
+        const auto plan = neon::MakeReducePlan(node.get_input_shape(0), axes);
+        if (plan.contiguous) {
+            return MakeNeonReduce(this, node, plan, neon::ReduceKind::L1);
+        }
+    }
+#endif
+    auto make = [&] (auto refFunction) {
+        return this->MakeConversion(refFunction,
+                                    node.input(0),
+                                    node.output(0),
+                                    node.get_input_shape(0),
+                                    node.get_reduction_axes());
+    };
+    return CallSwitch(
+        AP_WRAP(make, ngraph::runtime::reference::reduce_l1),
+        node.input(0), floatTypes);
+}
+
+template<> Converter::Conversion::Ptr Converter::Convert(const opset::ReduceL2& node) {
+    auto axes = safe_cast<opset::Constant>(node.input_value(1).get_node())->cast_vector<std::int64_t>();
+#if defined(__aarch64__)
+    if (node.get_input_element_type(0) == ngraph::element::f32) {
+        const auto plan = neon::MakeReducePlan(node.get_input_shape(0), axes);
+        if (plan.contiguous) {
+            return MakeNeonReduce(this, node, plan, neon::ReduceKind::L2);
+        }
+    }
+#endif
+    auto make = [&] (auto refFunction) {
+        return this->MakeConversion(refFunction,
+                                    node.input(0),
+                                    node.output(0),
+                                    node.get_input_shape(0),
+                                    node.get_reduction_axes());
+    };
+    return CallSwitch(
+        AP_WRAP(make, ngraph::runtime::reference::reduce_l2),
+        node.input(0), floatTypes);
+}
+
 static void wrap_reduce_logical_and(const std::uint8_t* arg,
                                     std::uint8_t* out,
                                     const ngraph::Shape& input_shape,
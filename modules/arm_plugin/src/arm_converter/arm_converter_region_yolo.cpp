@@ -3,10 +3,34 @@
 
 
 #include "arm_converter/arm_converter.hpp"
+#include "arm_converter/arm_neon_yolo.hpp"
 #include <ngraph/runtime/reference/region_yolo.hpp>
 
 namespace ArmPlugin {
 template<> Converter::Conversion::Ptr Converter::Convert(const opset::RegionYolo& node) {
+#if defined(__aarch64__)
+    {
+        const auto& inputShape = node.get_input_shape(0);
+        const auto coords = static_cast<std::size_t>(node.get_num_coords());
+        const auto classes = static_cast<std::size_t>(node.get_num_classes());
+        const auto regions = node.get_do_softmax() ? static_cast<std::size_t>(node.get_num_regions())
+                                                   : node.get_mask().size();
+        // One anchor block per chunk; heads whose channel count doesn't tile
+        // into anchor blocks keep the reference path
+        if ((node.get_input_element_type(0) == ngraph::element::f32) && (inputShape.size() == 4) &&
+            (inputShape[1] == regions * (coords + classes + 1))) {
+            const auto rows = inputShape[0] * regions;
+            return MakeConversion(MakeParallelReference(rows, neon::region_yolo_f32),
+                                  node.input(0),
+                                  node.output(0),
+                                  inputShape[2] * inputShape[3],
+                                  coords,
+                                  classes,
+                                  regions,
+                                  node.get_do_softmax());
+        }
+    }
+#endif
     auto make = [&] (auto refFunction) {
         return this->MakeConversion(refFunction,
                                     node.input(0),
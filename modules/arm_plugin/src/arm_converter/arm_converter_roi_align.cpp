@@ -4,6 +4,7 @@
 #include <details/ie_exception.hpp>
 
 #include "arm_converter/arm_converter.hpp"
+#include "arm_converter/arm_neon_roi.hpp"
 #include <ngraph/runtime/reference/roi_align.hpp>
 
 namespace ArmPlugin {
@@ -42,6 +43,30 @@ static void wrapper_roi_align(const T* feature_maps,
 }
 
 template<> Converter::Conversion::Ptr Converter::Convert(const opset::ROIAlign& node) {
+#if defined(__aarch64__)
+    if (node.get_input_element_type(0) == ngraph::element::f32) {
+        const auto numRois = node.get_input_shape(1)[0];
+        auto makeNeon = [&] (auto refFunction) {
+            return this->MakeConversion(refFunction,
+                                        node.input(0),
+                                        node.input(1),
+                                        node.input(2),
+                                        node.output(0),
+                                        node.get_input_shape(0),
+                                        node.get_output_shape(0),
+                                        node.get_pooled_h(),
+                                        node.get_pooled_w(),
+                                        node.get_sampling_ratio(),
+                                        node.get_spatial_scale(),
+                                        node.get_mode());
+        };
+        if (node.get_input_element_type(2) == ngraph::element::i32) {
+            return makeNeon(MakeParallelReference(numRois, neon::roi_align_f32<std::int32_t>));
+        } else if (node.get_input_element_type(2) == ngraph::element::i64) {
+            return makeNeon(MakeParallelReference(numRois, neon::roi_align_f32<std::int64_t>));
+        }
+    }
+#endif
     auto make = [&] (auto refFunction) {
         return this->MakeConversion(refFunction,
                                     node.input(0),
@@ -3,10 +3,19 @@
 
 
 #include "arm_converter/arm_converter.hpp"
+#include "arm_converter/arm_neon_math.hpp"
 #include <ngraph/runtime/reference/round.hpp>
 
 namespace ArmPlugin {
 template<> Converter::Conversion::Ptr Converter::Convert(const opset::Round& node) {
+#if defined(__aarch64__)
+    if (node.get_input_element_type(0) == ngraph::element::f32) {
+        return MakeConversion(MakeParallelReference(ngraph::shape_size(node.get_input_shape(0)), neon::round_f32),
+                              node.input(0),
+                              node.output(0),
+                              node.get_mode());
+    }
+#endif
     auto make = [&] (auto refFunction) {
         return this->MakeConversion(refFunction,
                                     node.input(0),
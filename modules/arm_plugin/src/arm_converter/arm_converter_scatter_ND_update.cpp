@@ -2,11 +2,83 @@
 // SPDX-License-Identifier: Apache-2.0
 
 
+#include <cstring>
+#include <limits>
+
 #include "arm_converter/arm_converter.hpp"
-#include <ngraph/runtime/reference/scatter_nd_update.hpp>
 
 namespace ArmPlugin {
+// Buckets the update rows by the chunk of output slices they land in, so the
+// chunks proceed in parallel without synchronization: each thread copies its
+// slice range from the source and replays only its own bucket. The buckets
+// keep the rows in index order, so a duplicate target still takes the last
+// update, like the reference loop
+template <typename T, typename U>
+static void parallel_scatter_nd(const T* data, const U* indices, const T* updates, T* out,
+                                const ngraph::Shape& dataShape, const ngraph::Shape& indicesShape,
+                                const ScratchArena::Ptr& scratch) {
+    const auto k = indicesShape.back();
+    std::size_t slice = 1;
+    for (auto d = k; d < dataShape.size(); ++d) {
+        slice *= dataShape[d];
+    }
+    const auto totalSlices = ngraph::shape_size(dataShape) / slice;
+    const auto updRows = ngraph::shape_size(indicesShape) / k;
+    const auto chunks = std::max<std::size_t>(std::min<std::size_t>(totalSlices, parallel_get_max_threads()), 1);
+    const auto chunkSlices = (totalSlices + chunks - 1) / chunks;
+
+    ScratchArena::Scope scope{scratch};
+    auto targets = scope.Allocate<std::size_t>(updRows);
+    auto order = scope.Allocate<std::size_t>(updRows);
+    auto counts = scope.Allocate<std::size_t>(chunks + 1);
+    auto cursor = scope.Allocate<std::size_t>(chunks);
+    std::fill(counts, counts + chunks + 1, 0);
+    constexpr auto outOfRange = std::numeric_limits<std::size_t>::max();
+    for (std::size_t r = 0; r < updRows; ++r) {
+        std::size_t target = 0;
+        bool inRange = true;
+        for (std::size_t j = 0; j < k; ++j) {
+            const auto dim = static_cast<std::int64_t>(dataShape[j]);
+            auto v = static_cast<std::int64_t>(indices[r * k + j]);
+            if (v < 0) {
+                v += dim;
+            }
+            inRange = inRange && (v >= 0) && (v < dim);
+            target = target * dataShape[j] + (inRange ? static_cast<std::size_t>(v) : 0);
+        }
+        targets[r] = inRange ? target : outOfRange;
+        if (inRange) {
+            ++counts[target / chunkSlices + 1];
+        }
+    }
+    for (std::size_t c = 0; c < chunks; ++c) {
+        counts[c + 1] += counts[c];
+    }
+    std::copy(counts, counts + chunks, cursor);
+    for (std::size_t r = 0; r < updRows; ++r) {
+        if (targets[r] != outOfRange) {
+            order[cursor[targets[r] / chunkSlices]++] = r;
+        }
+    }
+
+    InferenceEngine::parallel_for(chunks, [&] (std::size_t c) {
+        const auto sliceBegin = c * chunkSlices;
+        const auto sliceEnd = std::min(totalSlices, sliceBegin + chunkSlices);
+        if (sliceBegin >= sliceEnd) {
+            return;
+        }
+        std::memcpy(out + sliceBegin * slice, data + sliceBegin * slice, (sliceEnd - sliceBegin) * slice * sizeof(T));
+        for (auto p = counts[c]; p < counts[c + 1]; ++p) {
+            const auto r = order[p];
+            std::memcpy(out + targets[r] * slice, updates + r * slice, slice * sizeof(T));
+        }
+    });
+}
+
 template<> Converter::Conversion::Ptr Converter::Convert(const opset::ScatterNDUpdate& node) {
+    const auto& indicesShape = node.get_input_shape(1);
+    const auto updRows = ngraph::shape_size(indicesShape) / indicesShape.back();
+    _scratch->Reserve((2 * updRows + 2 * parallel_get_max_threads() + 1) * sizeof(std::size_t));
     auto make = [&] (auto refFunction) {
         return this->MakeConversion(refFunction,
                                     node.input(0),
@@ -14,11 +86,11 @@ template<> Converter::Conversion::Ptr Converter::Convert(const opset::ScatterNDU
                                     node.input(2),
                                     node.output(0),
                                     node.get_input_shape(0),
-                                    node.get_input_shape(1),
-                                    node.get_input_shape(2));
+                                    indicesShape,
+                                    _scratch);
     };
     return CallSwitch(
-        AP_WRAP(make, ngraph::runtime::reference::scatterNdUpdate),
+        AP_WRAP(make, parallel_scatter_nd),
         node.input(0), allTypes,
         node.input(1), indexTypes);
 }
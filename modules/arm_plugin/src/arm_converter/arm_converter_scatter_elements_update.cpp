@@ -2,29 +2,106 @@
 // SPDX-License-Identifier: Apache-2.0
 
 
+#include <cstring>
+
 #include "arm_converter/arm_converter.hpp"
 #include <ngraph/runtime/reference/scatter_elements_update.hpp>
 
 namespace ArmPlugin {
+// An update element keeps all its non-axis coordinates, so when indices match
+// the data shape on every non-axis dim the updates partition naturally into
+// conflict-free ranges: chunks of the outer dims (or of the inner dims when
+// the axis leads) touch disjoint output elements and need no synchronization.
+// Each chunk walks its updates in index order, preserving last-write-wins for
+// duplicate indices; indices broadcast along a non-axis dim fall back to the
+// reference loop
 template <typename DataType, typename IndicesType>
-void wrap_scatter_elem_update(const DataType* input_data,
-                              const IndicesType* indices,
-                              const DataType* updates,
-                              const IndicesType* axes,
-                              DataType* out_buf,
-                              const ngraph::Shape& data_shape,
-                              const ngraph::Shape& indices_shape) {
-    std::int64_t axis_val = static_cast<std::int64_t>(axes[0]);
-    if (axis_val < 0) {
-        axis_val = static_cast<std::int64_t>(data_shape.size()) + axis_val;
+static void parallel_scatter_elem_update(const DataType* data,
+                                         const IndicesType* indices,
+                                         const DataType* updates,
+                                         const IndicesType* axes,
+                                         DataType* out,
+                                         const ngraph::Shape& dataShape,
+                                         const ngraph::Shape& indicesShape) {
+    auto axisVal = static_cast<std::int64_t>(axes[0]);
+    if (axisVal < 0) {
+        axisVal += static_cast<std::int64_t>(dataShape.size());
+    }
+    bool aligned = dataShape.size() == indicesShape.size();
+    for (std::size_t d = 0; aligned && (d < dataShape.size()); ++d) {
+        aligned = aligned && ((static_cast<std::int64_t>(d) == axisVal) || (dataShape[d] == indicesShape[d]));
+    }
+    if (!aligned) {
+        ngraph::runtime::reference::scatter_elem_update<DataType, IndicesType>(data, indices, updates, axisVal,
+                                                                               out, dataShape, indicesShape);
+        return;
+    }
+    std::size_t outer = 1;
+    for (std::int64_t d = 0; d < axisVal; ++d) {
+        outer *= dataShape[d];
+    }
+    const auto dAxis = dataShape[axisVal];
+    const auto uAxis = indicesShape[axisVal];
+    std::size_t inner = 1;
+    for (auto d = static_cast<std::size_t>(axisVal) + 1; d < dataShape.size(); ++d) {
+        inner *= dataShape[d];
+    }
+    const auto total = ngraph::shape_size(dataShape);
+    const auto threads = std::max<std::size_t>(parallel_get_max_threads(), 1);
+
+    const auto copyChunks = std::max<std::size_t>(std::min(total, threads), 1);
+    const auto copyStep = (total + copyChunks - 1) / copyChunks;
+    InferenceEngine::parallel_for(copyChunks, [&] (std::size_t c) {
+        const auto begin = c * copyStep;
+        const auto end = std::min(total, begin + copyStep);
+        if (begin < end) {
+            std::memcpy(out + begin, data + begin, (end - begin) * sizeof(DataType));
+        }
+    });
+
+    auto normalize = [dAxis] (IndicesType raw) {
+        auto v = static_cast<std::int64_t>(raw);
+        if (v < 0) {
+            v += static_cast<std::int64_t>(dAxis);
+        }
+        return v;
+    };
+    if (outer > 1) {
+        const auto chunks = std::min(outer, threads);
+        const auto chunkOuter = (outer + chunks - 1) / chunks;
+        InferenceEngine::parallel_for(chunks, [&] (std::size_t c) {
+            const auto oEnd = std::min(outer, (c + 1) * chunkOuter);
+            for (auto o = c * chunkOuter; o < oEnd; ++o) {
+                for (std::size_t a = 0; a < uAxis; ++a) {
+                    const auto* updRow = updates + (o * uAxis + a) * inner;
+                    const auto* idxRow = indices + (o * uAxis + a) * inner;
+                    for (std::size_t i = 0; i < inner; ++i) {
+                        const auto v = normalize(idxRow[i]);
+                        if ((v >= 0) && (v < static_cast<std::int64_t>(dAxis))) {
+                            out[(o * dAxis + v) * inner + i] = updRow[i];
+                        }
+                    }
+                }
+            }
+        });
+    } else {
+        const auto chunks = std::max<std::size_t>(std::min(inner, threads), 1);
+        const auto chunkInner = (inner + chunks - 1) / chunks;
+        InferenceEngine::parallel_for(chunks, [&] (std::size_t c) {
+            const auto iBegin = c * chunkInner;
+            const auto iEnd = std::min(inner, iBegin + chunkInner);
+            for (std::size_t a = 0; a < uAxis; ++a) {
+                const auto* updRow = updates + a * inner;
+                const auto* idxRow = indices + a * inner;
+                for (auto i = iBegin; i < iEnd; ++i) {
+                    const auto v = normalize(idxRow[i]);
+                    if ((v >= 0) && (v < static_cast<std::int64_t>(dAxis))) {
+                        out[v * inner + i] = updRow[i];
+                    }
+                }
+            }
+        });
     }
-    ngraph::runtime::reference::scatter_elem_update<DataType, IndicesType>(input_data,
-                                                                           indices,
-                                                                           updates,
-                                                                           axis_val,
-                                                                           out_buf,
-                                                                           data_shape,
-                                                                           indices_shape);
 }
 
 template<> Converter::Conversion::Ptr Converter::Convert(const opset::ScatterElementsUpdate& node) {
@@ -40,7 +117,7 @@ template<> Converter::Conversion::Ptr Converter::Convert(const opset::ScatterEle
     };
 
     return CallSwitch(
-        AP_WRAP(make, wrap_scatter_elem_update),
+        AP_WRAP(make, parallel_scatter_elem_update),
         node.get_input_element_type(0), allTypes,
         node.get_input_element_type(1), indexTypes);
 }
@@ -2,41 +2,70 @@
 // SPDX-License-Identifier: Apache-2.0
 
 
+#include <cstring>
+
 #include "arm_converter/arm_converter.hpp"
-#include <ngraph/runtime/reference/scatter_update.hpp>
 
 namespace ArmPlugin {
+// A single pass over the indices keeps only the last update row aimed at each
+// axis position, after which every output row has exactly one writer: the
+// threads split the output rows between them and each row is one memcpy from
+// either its update row or the source, with no synchronization
 template <typename T, typename U>
-void wrap_scatter_update(const T* input_data,
-                         const U* indices,
-                         const T* updates,
-                         const U* axis,
-                         T* out,
-                         const size_t elem_size,
-                         const ngraph::Shape& data_shape,
-                         const ngraph::Shape& indices_shape,
-                         const ngraph::Shape& updates_shape) {
-    auto indices_size = ngraph::shape_size(indices_shape);
-    std::vector<std::int64_t> converted_indices(indices_size);
-    for (size_t i = 0; i < indices_size; i++) {
-        converted_indices[i] = static_cast<std::int64_t>(indices[i]);
+static void parallel_scatter_update(const T* data,
+                                    const U* indices,
+                                    const T* updates,
+                                    const U* axis,
+                                    T* out,
+                                    const ngraph::Shape& dataShape,
+                                    const ngraph::Shape& indicesShape,
+                                    const ScratchArena::Ptr& scratch) {
+    auto axisVal = static_cast<std::int64_t>(axis[0]);
+    if (axisVal < 0) {
+        axisVal += static_cast<std::int64_t>(dataShape.size());
+    }
+    std::size_t outer = 1;
+    for (std::int64_t d = 0; d < axisVal; ++d) {
+        outer *= dataShape[d];
     }
-    std::int64_t axis_val = static_cast<std::int64_t>(axis[0]);
-    if (axis_val < 0) {
-        axis_val = static_cast<std::int64_t>(data_shape.size()) + axis_val;
+    const auto axisDim = dataShape[axisVal];
+    std::size_t inner = 1;
+    for (auto d = static_cast<std::size_t>(axisVal) + 1; d < dataShape.size(); ++d) {
+        inner *= dataShape[d];
     }
-    ngraph::runtime::reference::scatter_update(reinterpret_cast<const char*>(input_data),
-                                               converted_indices.data(),
-                                               reinterpret_cast<const char*>(updates),
-                                               axis_val,
-                                               reinterpret_cast<char*>(out),
-                                               elem_size,
-                                               data_shape,
-                                               indices_shape,
-                                               updates_shape);
+    const auto numIndices = ngraph::shape_size(indicesShape);
+
+    ScratchArena::Scope scope{scratch};
+    auto lastOf = scope.Allocate<std::int64_t>(axisDim);
+    std::fill(lastOf, lastOf + axisDim, -1);
+    for (std::size_t q = 0; q < numIndices; ++q) {
+        auto v = static_cast<std::int64_t>(indices[q]);
+        if (v < 0) {
+            v += static_cast<std::int64_t>(axisDim);
+        }
+        if ((v >= 0) && (v < static_cast<std::int64_t>(axisDim))) {
+            lastOf[v] = q;
+        }
+    }
+
+    const auto rows = outer * axisDim;
+    const auto chunks = std::max<std::size_t>(std::min<std::size_t>(rows, parallel_get_max_threads()), 1);
+    const auto chunkRows = (rows + chunks - 1) / chunks;
+    InferenceEngine::parallel_for(chunks, [&] (std::size_t c) {
+        const auto rowEnd = std::min(rows, (c + 1) * chunkRows);
+        for (auto row = c * chunkRows; row < rowEnd; ++row) {
+            const auto o = row / axisDim;
+            const auto a = row % axisDim;
+            const auto q = lastOf[a];
+            const T* src = (q >= 0) ? updates + (o * numIndices + q) * inner : data + row * inner;
+            std::memcpy(out + row * inner, src, inner * sizeof(T));
+        }
+    });
 }
 
 template<> Converter::Conversion::Ptr Converter::Convert(const opset::ScatterUpdate& node) {
+    const auto& dataShape = node.get_input_shape(0);
+    _scratch->Reserve(*std::max_element(dataShape.begin(), dataShape.end()) * sizeof(std::int64_t));
     auto make = [&] (auto refFunction) {
         return this->MakeConversion(refFunction,
                                     node.input(0),
@@ -44,13 +73,12 @@ template<> Converter::Conversion::Ptr Converter::Convert(const opset::ScatterUpd
                                     node.input(2),
                                     node.input(3),
                                     node.output(0),
-                                    node.get_input_element_type(0).size(),
-                                    node.get_input_shape(0),
+                                    dataShape,
                                     node.get_input_shape(1),
-                                    node.get_input_shape(2));
+                                    _scratch);
     };
     return CallSwitch(
-        AP_WRAP(make, wrap_scatter_update),
+        AP_WRAP(make, parallel_scatter_update),
         node.input(0), allTypes,
         node.input(1), indexTypes);
 }
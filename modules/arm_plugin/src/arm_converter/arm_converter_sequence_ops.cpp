@@ -2,10 +2,15 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <array>
+#include <cstring>
+
 #include <ngraph/runtime/reference/reverse_sequence.hpp>
 #include "arm_converter/arm_converter.hpp"
 #include <ngraph/runtime/reference/sequences.hpp>
 
+#include <arm_compute/runtime/NEON/functions/NELSTMLayer.h>
+
 namespace ArmPlugin {
 
 template<> Converter::Conversion::Ptr Converter::Convert(const opset::ReverseSequence& node) {
@@ -72,7 +77,210 @@ void wrap_lstm_sequence(const T* X,
 }
 
 
+// Runs a whole LSTM sequence through a single NELSTMLayer configured once: the
+// packed gate weights and the reordered copies NELSTMLayer prepares stay
+// resident across all timesteps instead of being rebuilt per step, and the
+// recurrent state lives in two small cache-resident tensors. Only the timestep
+// slice of the input and the produced hidden state are copied per step
+struct NELSTMSequenceLayer final: public arm_compute::IFunction {
+public:
+    NELSTMSequenceLayer(const std::shared_ptr<arm_compute::IMemoryManager>& memoryManager):
+        _memoryManager{memoryManager} {}
+    NELSTMSequenceLayer(const NELSTMSequenceLayer&) = delete;
+    NELSTMSequenceLayer& operator=(const NELSTMSequenceLayer&) = delete;
+
+    void configure(const arm_compute::ITensor* input,
+                   const arm_compute::ITensor* initialHidden,
+                   const arm_compute::ITensor* initialCell,
+                   const arm_compute::ITensor* weights,
+                   const arm_compute::ITensor* recurrentWeights,
+                   const arm_compute::ITensor* biases,
+                   arm_compute::ITensor* output,
+                   arm_compute::ITensor* outputHidden,
+                   arm_compute::ITensor* outputCell,
+                   bool reverse) {
+        ARM_COMPUTE_ERROR_THROW_ON(validate(input->info(), initialHidden->info(), initialCell->info(),
+                                            weights->info(), recurrentWeights->info(), biases->info(),
+                                            output->info(), outputHidden->info(), outputCell->info(), reverse));
+        _input = input;
+        _initialHidden = initialHidden;
+        _initialCell = initialCell;
+        _output = output;
+        _outputHidden = outputHidden;
+        _outputCell = outputCell;
+        _reverse = reverse;
+        const auto inputSize = input->info()->dimension(0);
+        _timeSteps = input->info()->dimension(1);
+        _batch = (input->info()->num_dimensions() > 2) ? input->info()->dimension(2) : 1;
+        const auto hidden = initialHidden->info()->dimension(0);
+        const auto type = input->info()->data_type();
+
+        // The gate order along the 4*hidden dimension is f, i, c, o;
+        // NELSTMLayer takes every gate as its own tensor, so the packed
+        // weights are exposed through subtensor views at the gate offsets
+        for (unsigned int gate = 0; gate < 4; ++gate) {
+            const auto gateOffset = static_cast<int>(gate * hidden);
+            _w[gate] = std::make_unique<arm_compute::SubTensor>(const_cast<arm_compute::ITensor*>(weights),
+                arm_compute::TensorShape{inputSize, hidden}, arm_compute::Coordinates{0, gateOffset});
+            _r[gate] = std::make_unique<arm_compute::SubTensor>(const_cast<arm_compute::ITensor*>(recurrentWeights),
+                arm_compute::TensorShape{hidden, hidden}, arm_compute::Coordinates{0, gateOffset});
+            _b[gate] = std::make_unique<arm_compute::SubTensor>(const_cast<arm_compute::ITensor*>(biases),
+                arm_compute::TensorShape{hidden}, arm_compute::Coordinates{gateOffset});
+        }
+
+        _stepInput.allocator()->init({arm_compute::TensorShape{inputSize, _batch}, 1, type});
+        for (auto state : {&_hiddenState, &_cellState, &_hiddenStateOut, &_cellStateOut, &_stepOutput}) {
+            state->allocator()->init({arm_compute::TensorShape{hidden, _batch}, 1, type});
+        }
+        _scratch.allocator()->init({arm_compute::TensorShape{4 * hidden, _batch}, 1, type});
+
+        _lstm = std::make_unique<arm_compute::NELSTMLayer>(_memoryManager);
+        arm_compute::LSTMParams<arm_compute::ITensor> lstmParams;
+        lstmParams.set_cifg_params(_w[GateI].get(), _r[GateI].get(), nullptr, _b[GateI].get());
+        _lstm->configure(&_stepInput,
+                         _w[GateF].get(), _w[GateC].get(), _w[GateO].get(),
+                         _r[GateF].get(), _r[GateC].get(), _r[GateO].get(),
+                         _b[GateF].get(), _b[GateC].get(), _b[GateO].get(),
+                         &_hiddenState, &_cellState,
+                         &_scratch, &_hiddenStateOut, &_cellStateOut, &_stepOutput,
+                         lstmParams,
+                         arm_compute::ActivationLayerInfo{
+                             arm_compute::ActivationLayerInfo::ActivationFunction::TANH, 1.f, 1.f});
+        for (auto tensor : {&_stepInput, &_hiddenState, &_cellState, &_hiddenStateOut, &_cellStateOut, &_stepOutput, &_scratch}) {
+            tensor->allocator()->allocate();
+        }
+    }
+
+    static arm_compute::Status validate(const arm_compute::ITensorInfo* input,
+                                        const arm_compute::ITensorInfo* initialHidden,
+                                        const arm_compute::ITensorInfo* initialCell,
+                                        const arm_compute::ITensorInfo* weights,
+                                        const arm_compute::ITensorInfo* recurrentWeights,
+                                        const arm_compute::ITensorInfo* biases,
+                                        const arm_compute::ITensorInfo* output,
+                                        const arm_compute::ITensorInfo* outputHidden,
+                                        const arm_compute::ITensorInfo* outputCell,
+                                        bool reverse) {
+        ARM_COMPUTE_UNUSED(reverse);
+        ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(input, initialHidden, initialCell, weights, recurrentWeights, biases,
+                                            output, outputHidden, outputCell);
+        const auto inputSize = input->dimension(0);
+        const auto batch = (input->num_dimensions() > 2) ? input->dimension(2) : 1;
+        const auto hidden = initialHidden->dimension(0);
+        const auto type = input->data_type();
+        ARM_COMPUTE_RETURN_ERROR_ON(weights->dimension(0) != inputSize);
+        ARM_COMPUTE_RETURN_ERROR_ON(weights->dimension(1) != 4 * hidden);
+        ARM_COMPUTE_RETURN_ERROR_ON(recurrentWeights->dimension(0) != hidden);
+        ARM_COMPUTE_RETURN_ERROR_ON(recurrentWeights->dimension(1) != 4 * hidden);
+        ARM_COMPUTE_RETURN_ERROR_ON(biases->dimension(0) != 4 * hidden);
+        ARM_COMPUTE_RETURN_ERROR_ON(output->dimension(0) != hidden);
+        ARM_COMPUTE_RETURN_ERROR_ON(initialCell->dimension(0) != hidden);
+        const arm_compute::TensorInfo stepInput{arm_compute::TensorShape{inputSize, batch}, 1, type};
+        const arm_compute::TensorInfo state{arm_compute::TensorShape{hidden, batch}, 1, type};
+        const arm_compute::TensorInfo gateWeights{arm_compute::TensorShape{inputSize, hidden}, 1, type};
+        const arm_compute::TensorInfo gateRecurrent{arm_compute::TensorShape{hidden, hidden}, 1, type};
+        const arm_compute::TensorInfo gateBias{arm_compute::TensorShape{hidden}, 1, type};
+        const arm_compute::TensorInfo scratch{arm_compute::TensorShape{4 * hidden, batch}, 1, type};
+        arm_compute::TensorInfo hiddenState{state}, cellState{state}, hiddenStateOut{state}, cellStateOut{state}, stepOutput{state};
+        arm_compute::TensorInfo inputGateWeights{gateWeights}, inputGateRecurrent{gateRecurrent}, inputGateBias{gateBias};
+        arm_compute::TensorInfo scratchBuffer{scratch};
+        arm_compute::LSTMParams<arm_compute::ITensorInfo> lstmParams;
+        lstmParams.set_cifg_params(&inputGateWeights, &inputGateRecurrent, nullptr, &inputGateBias);
+        return arm_compute::NELSTMLayer::validate(&stepInput,
+                                                  &gateWeights, &gateWeights, &gateWeights,
+                                                  &gateRecurrent, &gateRecurrent, &gateRecurrent,
+                                                  &gateBias, &gateBias, &gateBias,
+                                                  &hiddenState, &cellState,
+                                                  &scratchBuffer, &hiddenStateOut, &cellStateOut, &stepOutput,
+                                                  lstmParams,
+                                                  arm_compute::ActivationLayerInfo{
+                                                      arm_compute::ActivationLayerInfo::ActivationFunction::TANH, 1.f, 1.f});
+    }
+
+    void run() override {
+        ARM_COMPUTE_ERROR_ON_MSG(_lstm == nullptr, "Kernel didn't configured");
+        const auto elementSize = _input->info()->element_size();
+        const auto inputBytes = _stepInput.info()->dimension(0) * elementSize;
+        const auto hiddenBytes = _hiddenState.info()->dimension(0) * elementSize;
+        for (std::size_t n = 0; n < _batch; ++n) {
+            std::memcpy(_hiddenState.buffer() + n * hiddenBytes,
+                        _initialHidden->ptr_to_element({0, 0, static_cast<int>(n)}), hiddenBytes);
+            std::memcpy(_cellState.buffer() + n * hiddenBytes,
+                        _initialCell->ptr_to_element({0, 0, static_cast<int>(n)}), hiddenBytes);
+        }
+        for (std::size_t step = 0; step < _timeSteps; ++step) {
+            const auto t = static_cast<int>(_reverse ? (_timeSteps - step - 1) : step);
+            for (std::size_t n = 0; n < _batch; ++n) {
+                std::memcpy(_stepInput.buffer() + n * inputBytes,
+                            _input->ptr_to_element({0, t, static_cast<int>(n)}), inputBytes);
+            }
+            _lstm->run();
+            for (std::size_t n = 0; n < _batch; ++n) {
+                std::memcpy(_output->ptr_to_element({0, t, 0, static_cast<int>(n)}),
+                            _hiddenStateOut.buffer() + n * hiddenBytes, hiddenBytes);
+            }
+            std::memcpy(_hiddenState.buffer(), _hiddenStateOut.buffer(), _batch * hiddenBytes);
+            std::memcpy(_cellState.buffer(), _cellStateOut.buffer(), _batch * hiddenBytes);
+        }
+        for (std::size_t n = 0; n < _batch; ++n) {
+            std::memcpy(_outputHidden->ptr_to_element({0, 0, static_cast<int>(n)}),
+                        _hiddenState.buffer() + n * hiddenBytes, hiddenBytes);
+            std::memcpy(_outputCell->ptr_to_element({0, 0, static_cast<int>(n)}),
+                        _cellState.buffer() + n * hiddenBytes, hiddenBytes);
+        }
+    }
+
+    void prepare() override {
+        _lstm->prepare();
+    }
+
+private:
+    enum LSTMGate : unsigned int {GateF, GateI, GateC, GateO};
+    std::shared_ptr<arm_compute::IMemoryManager>            _memoryManager;
+    const arm_compute::ITensor*                             _input = nullptr;
+    const arm_compute::ITensor*                             _initialHidden = nullptr;
+    const arm_compute::ITensor*                             _initialCell = nullptr;
+    arm_compute::ITensor*                                   _output = nullptr;
+    arm_compute::ITensor*                                   _outputHidden = nullptr;
+    arm_compute::ITensor*                                   _outputCell = nullptr;
+    std::array<std::unique_ptr<arm_compute::SubTensor>, 4>  _w;
+    std::array<std::unique_ptr<arm_compute::SubTensor>, 4>  _r;
+    std::array<std::unique_ptr<arm_compute::SubTensor>, 4>  _b;
+    arm_compute::Tensor                                     _stepInput;
+    arm_compute::Tensor                                     _stepOutput;
+    arm_compute::Tensor                                     _hiddenState;
+    arm_compute::Tensor                                     _cellState;
+    arm_compute::Tensor                                     _hiddenStateOut;
+    arm_compute::Tensor                                     _cellStateOut;
+    arm_compute::Tensor                                     _scratch;
+    std::unique_ptr<arm_compute::NELSTMLayer>               _lstm;
+    std::size_t                                             _timeSteps = 0;
+    std::size_t                                             _batch = 0;
+    bool                                                    _reverse = false;
+};
+
 template<> Converter::Conversion::Ptr Converter::Convert(const opset::LSTMSequence& node) {
+    // NELSTMLayer hardcodes sigmoid gates, so the direct path covers the
+    // default cell only; everything else stays on the reference implementation
+    const auto seqLengths = ov::as_type_ptr<opset::Constant>(node.input_value(3).get_node_shared_ptr());
+    const auto timeSteps = static_cast<std::int64_t>(node.get_input_shape(0)[1]);
+    const bool denseSequence = (seqLengths != nullptr) && [&] {
+        const auto lengths = seqLengths->cast_vector<std::int64_t>();
+        return std::all_of(lengths.begin(), lengths.end(), [&] (std::int64_t length) {
+            return length == timeSteps;
+        });
+    }();
+    const auto type = node.get_input_element_type(0);
+    if (denseSequence &&
+        (node.get_direction() != ngraph::op::RecurrentSequenceDirection::BIDIRECTIONAL) &&
+        (node.get_activations() == std::vector<std::string>{"sigmoid", "tanh", "tanh"}) &&
+        (node.get_clip() == 0.f) &&
+        ((type == ngraph::element::f32) || (type == ngraph::element::f16))) {
+        return MakeConversion<NELSTMSequenceLayer>(node.input(0), node.input(1), node.input(2),
+                                                   node.input(4), node.input(5), node.input(6),
+                                                   node.output(0), node.output(1), node.output(2),
+                                                   node.get_direction() == ngraph::op::RecurrentSequenceDirection::REVERSE);
+    }
     auto make = [&] (auto refFunction) {
     return this->MakeConversion(refFunction,
                                 node.input(0),
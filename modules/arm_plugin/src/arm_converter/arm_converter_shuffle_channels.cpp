@@ -5,6 +5,7 @@
 #include <arm_compute/runtime/NEON/functions/NEActivationLayer.h>
 #include <arm_compute/runtime/NEON/functions/NEChannelShuffleLayer.h>
 #include "arm_converter/arm_converter.hpp"
+#include "arm_converter/arm_neon_transpose.hpp"
 
 namespace ArmPlugin {
 template<> Converter::Conversion::Ptr Converter::Convert(const opset::ShuffleChannels& node) {
@@ -15,7 +16,33 @@ template<> Converter::Conversion::Ptr Converter::Convert(const opset::ShuffleCha
 
     unsigned int group = static_cast<unsigned int>(node.get_group());
     if (axis != 1) {
+#if defined(__aarch64__)
+        // A shuffle is a transpose of the axis split into [group, len / group],
+        // which the tiled permutation engine handles for any axis
+        const auto& inputShape = node.get_input_shape(0);
+        ngraph::Shape splitShape;
+        std::vector<std::size_t> order;
+        for (std::size_t d = 0; d < inputShape.size(); ++d) {
+            if (static_cast<int>(d) == axis) {
+                order.push_back(splitShape.size() + 1);
+                order.push_back(splitShape.size());
+                splitShape.push_back(group);
+                splitShape.push_back(inputShape[d] / group);
+            } else {
+                order.push_back(splitShape.size());
+                splitShape.push_back(inputShape[d]);
+            }
+        }
+        const auto plan = neon::MakePermutePlan(splitShape, order);
+        const auto outRows = ngraph::shape_size(plan.dims) / plan.dims[plan.order.back()];
+        auto make = [&] (auto permuteFunction) {
+            return this->MakeConversion(MakeParallelReference(outRows, permuteFunction),
+                                        node.input(0), node.output(0), plan);
+        };
+        return CallSwitch(AP_WRAP(make, neon::permute_rows), node.input(0), allTypes);
+#else
         IE_THROW() << "Unsupported axis: " << axis;
+#endif
     }
     if (group == 1) {
         arm_compute::ActivationLayerInfo info(arm_compute::ActivationLayerInfo::ActivationFunction::IDENTITY);
@@ -4,12 +4,45 @@
 
 #include <arm_compute/runtime/NEON/functions/NESpaceToDepthLayer.h>
 #include "arm_converter/arm_converter.hpp"
+#include "arm_converter/arm_neon_space.hpp"
 
 namespace ArmPlugin {
+#if defined(__aarch64__)
+template <typename T>
+static void space_to_depth_rows(std::size_t begin, std::size_t end, const T* src, T* dst,
+                                const ngraph::Shape& srcShape, const std::size_t block, const bool blocksFirst) {
+    using U = neon::WidthTypeOf<T>;
+    neon::space_to_depth(begin, end, reinterpret_cast<const U*>(src), reinterpret_cast<U*>(dst),
+                         srcShape, block, blocksFirst);
+}
+#endif
+
 template<> Converter::Conversion::Ptr Converter::Convert(const opset::SpaceToDepth& node) {
     if (node.get_input_shape(0).size() > 4) {
         IE_THROW() << "Unsupported DepthToSpace with num dimensions > 4";
     }
+#if defined(__aarch64__)
+    // Inverse of the DepthToSpace fast path: the DEPTH_FIRST mode de-interleaves
+    // every input row into block contiguous output rows, input rows split
+    // across the scheduler threads
+    if ((node.get_mode() == opset::SpaceToDepth::SpaceToDepthMode::DEPTH_FIRST) &&
+        (node.get_input_shape(0).size() == 4)) {
+        const auto& srcShape = node.get_input_shape(0);
+        const std::size_t block = node.get_block_size();
+        const auto rows = srcShape[0] * srcShape[1] * srcShape[2];
+        auto make = [&] (auto kernel) {
+            return this->MakeConversion(MakeParallelReference(rows, kernel),
+                                        node.input(0),
+                                        node.output(0),
+                                        srcShape,
+                                        block,
+                                        false);
+        };
+        return CallSwitch(
+            AP_WRAP(make, space_to_depth_rows),
+            node.input(0), merge(allTypes, boolType));
+    }
+#endif
     if (node.get_mode() != opset::SpaceToDepth::SpaceToDepthMode::BLOCKS_FIRST) {
         IE_THROW() << "Unsupported DepthToSpace mode";
     }
@@ -7,6 +7,7 @@
 #include <ngraph/runtime/reference/strided_slice.hpp>
 #include "ngraph/slice_plan.hpp"
 #include "arm_converter/arm_converter.hpp"
+#include "arm_converter/arm_neon_slice.hpp"
 
 namespace ArmPlugin {
 static ngraph::AxisSet convert_mask_to_axis_set(const std::vector<int64_t>& mask) {
@@ -19,6 +20,93 @@ static ngraph::AxisSet convert_mask_to_axis_set(const std::vector<int64_t>& mask
     return axis_set;
 }
 
+#if defined(__aarch64__)
+// Plans a forward slice as row copies: every run of trailing unit-stride
+// dimensions whose inner neighbours are taken whole collapses into one
+// contiguous run per row, the remaining dimensions become the outer index
+// space split across the scheduler threads. A non-unit innermost stride keeps
+// the row as a small-stride gather instead. Falls back to the reference for
+// reversing slices
+static bool strided_slice_fast_path(const ngraph::SlicePlan& plan, const ngraph::Shape& argShape,
+                                    const void* arg, void* out, const std::size_t elemSize) {
+    if (!plan.reverse_axes.empty() || argShape.empty()) {
+        return false;
+    }
+    const auto rank = argShape.size();
+    std::vector<std::size_t> begins(rank), strides(rank), outDims(rank);
+    for (std::size_t d = 0; d < rank; ++d) {
+        if ((plan.strides[d] < 1) || (plan.begins[d] < 0)) {
+            return false;
+        }
+        begins[d] = plan.begins[d];
+        strides[d] = plan.strides[d];
+        const auto extent = plan.ends[d] - plan.begins[d];
+        if (extent <= 0) {
+            return false;
+        }
+        outDims[d] = (extent + strides[d] - 1) / strides[d];
+    }
+    std::vector<std::size_t> inStrides(rank);
+    inStrides[rank - 1] = 1;
+    for (std::size_t d = rank - 1; d > 0; --d) {
+        inStrides[d - 1] = inStrides[d] * argShape[d];
+    }
+    std::size_t srcBase = 0;
+    for (std::size_t d = 0; d < rank; ++d) {
+        srcBase += begins[d] * inStrides[d];
+    }
+    // Collapse the trailing unit-stride run; a partial dimension may end it
+    // but only fully taken ones let it grow past them
+    std::size_t innerCount = 1;
+    std::size_t innerStride = 1;
+    int d = static_cast<int>(rank) - 1;
+    if (strides[d] == 1) {
+        bool full = true;
+        while ((d >= 0) && full && (strides[d] == 1)) {
+            innerCount *= outDims[d];
+            full = (begins[d] == 0) && (outDims[d] == argShape[d]);
+            --d;
+        }
+    } else {
+        innerStride = strides[d];
+        innerCount = outDims[d];
+        --d;
+    }
+    std::vector<std::size_t> outerDims;
+    std::vector<std::size_t> outerSteps;
+    std::size_t rows = 1;
+    for (int k = 0; k <= d; ++k) {
+        outerDims.push_back(outDims[k]);
+        outerSteps.push_back(strides[k] * inStrides[k]);
+        rows *= outDims[k];
+    }
+    switch (elemSize) {
+        case 1:
+            RunReferenceSlices(neon::strided_slice_rows<std::uint8_t>, rows,
+                               static_cast<const std::uint8_t*>(arg), static_cast<std::uint8_t*>(out),
+                               outerDims, outerSteps, srcBase, innerCount, innerStride);
+            return true;
+        case 2:
+            RunReferenceSlices(neon::strided_slice_rows<std::uint16_t>, rows,
+                               static_cast<const std::uint16_t*>(arg), static_cast<std::uint16_t*>(out),
+                               outerDims, outerSteps, srcBase, innerCount, innerStride);
+            return true;
+        case 4:
+            RunReferenceSlices(neon::strided_slice_rows<std::uint32_t>, rows,
+                               static_cast<const std::uint32_t*>(arg), static_cast<std::uint32_t*>(out),
+                               outerDims, outerSteps, srcBase, innerCount, innerStride);
+            return true;
+        case 8:
+            RunReferenceSlices(neon::strided_slice_rows<std::uint64_t>, rows,
+                               static_cast<const std::uint64_t*>(arg), static_cast<std::uint64_t*>(out),
+                               outerDims, outerSteps, srcBase, innerCount, innerStride);
+            return true;
+        default:
+            return false;
+    }
+}
+#endif
+
 template <typename T, typename U>
 void wrap_strided_slice(const T* arg,
                         const U* begin,
@@ -48,6 +136,11 @@ void wrap_strided_slice(const T* arg,
                                                            convert_mask_to_axis_set(shrink_axis_mask),
                                                            convert_mask_to_axis_set(ellipsis_mask));
 
+#if defined(__aarch64__)
+    if (strided_slice_fast_path(slice_plan, arg_shape, arg, out, elem_size)) {
+        return;
+    }
+#endif
     ngraph::runtime::reference::strided_slice(reinterpret_cast<const char*>(arg),
                                               reinterpret_cast<char*>(out),
                                               arg_shape,
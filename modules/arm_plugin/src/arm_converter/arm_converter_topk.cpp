@@ -2,10 +2,194 @@
 // SPDX-License-Identifier: Apache-2.0
 
 
+#include <utility>
+#include <vector>
+#include <algorithm>
+#include <type_traits>
+
 #include "arm_converter/arm_converter.hpp"
-#include <ngraph/runtime/reference/topk.hpp>
+#include <ie_parallel.hpp>
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#endif
 
 namespace ArmPlugin {
+namespace {
+// Bounded selection heap over a caller-provided buffer: the root is the worst
+// kept element, so a scanned element costs one compare against it and a
+// sift-down only when it displaces it - O(n log k) instead of the full sort
+// of the reference implementation
+template <typename T, typename U>
+struct SelectionHeap {
+    std::pair<T, U>* _data;
+    std::size_t      _capacity;
+    bool             _max;
+    std::size_t      _size = 0;
+
+    // Reference TopK ordering: by value, the lower index winning ties
+    bool Beats(const std::pair<T, U>& a, const std::pair<T, U>& b) const {
+        if (a.first != b.first) {
+            return _max ? (a.first > b.first) : (a.first < b.first);
+        }
+        return a.second < b.second;
+    }
+
+    bool Full() const {
+        return _size == _capacity;
+    }
+
+    const std::pair<T, U>& Worst() const {
+        return _data[0];
+    }
+
+    void SiftDown(std::size_t i) {
+        while (true) {
+            auto worst = i;
+            const auto left = 2 * i + 1;
+            const auto right = 2 * i + 2;
+            if ((left < _size) && Beats(_data[worst], _data[left])) {
+                worst = left;
+            }
+            if ((right < _size) && Beats(_data[worst], _data[right])) {
+                worst = right;
+            }
+            if (worst == i) {
+                return;
+            }
+            std::swap(_data[i], _data[worst]);
+            i = worst;
+        }
+    }
+
+    void Push(const T value, const U index) {
+        if (!Full()) {
+            _data[_size++] = {value, index};
+            if (Full()) {
+                for (auto i = _capacity / 2; i > 0; --i) {
+                    SiftDown(i - 1);
+                }
+            }
+        } else if (Beats({value, index}, _data[0])) {
+            _data[0] = {value, index};
+            SiftDown(0);
+        }
+    }
+};
+
+template <typename T, typename U>
+void scan_range(const T* slice, const std::size_t stride, const std::size_t begin, const std::size_t end,
+                const bool compute_max, SelectionHeap<T, U>& heap) {
+    auto j = begin;
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+    // Once the heap is full most elements of a large range lose to its root;
+    // a vector compare against the root value rejects four candidates per
+    // iteration (a tie cannot displace the root, its index is always larger)
+    if (std::is_same<T, float>::value && (stride == 1)) {
+        const float* data = reinterpret_cast<const float*>(slice);
+        while (heap.Full() && (j + 4 <= end)) {
+            const float32x4_t values = vld1q_f32(data + j);
+            const float32x4_t worst = vdupq_n_f32(static_cast<float>(heap.Worst().first));
+            const uint32x4_t beats = compute_max ? vcgtq_f32(values, worst) : vcltq_f32(values, worst);
+            const uint32x2_t any = vorr_u32(vget_low_u32(beats), vget_high_u32(beats));
+            if (vget_lane_u32(vpmax_u32(any, any), 0) == 0) {
+                j += 4;
+                continue;
+            }
+            for (int lane = 0; lane < 4; ++lane, ++j) {
+                heap.Push(slice[j], static_cast<U>(j));
+            }
+        }
+    }
+#endif
+    for (; j < end; ++j) {
+        heap.Push(slice[j * stride], static_cast<U>(j));
+    }
+}
+
+// Signature matches ngraph::runtime::reference::topk so the converter wraps it
+// the same way. Every axis slice is partitioned into per-thread ranges, each
+// selected independently with a bounded heap, and the at most chunks*k
+// survivors are merged by a final partial sort
+template <typename T, typename U>
+void parallel_topk(const T* arg,
+                   U* out_indices,
+                   T* out_values,
+                   const ngraph::Shape& in_shape,
+                   const ngraph::Shape& out_shape,
+                   const std::size_t axis,
+                   const std::size_t k,
+                   const bool compute_max,
+                   const ngraph::op::TopKSortType sort,
+                   const ScratchArena::Ptr& scratch) {
+    if (k == 0) {
+        return;
+    }
+    const auto n = in_shape[axis];
+    std::size_t inner = 1;
+    for (auto d = axis + 1; d < in_shape.size(); ++d) {
+        inner *= in_shape[d];
+    }
+    std::size_t outer = 1;
+    for (std::size_t d = 0; d < axis; ++d) {
+        outer *= in_shape[d];
+    }
+    const auto slices = outer * inner;
+
+    // Spread the threads over the slices; a lone large slice gets them all,
+    // but a chunk has to be big enough to amortize its heap and merge slot
+    const auto threads = static_cast<std::size_t>(InferenceEngine::parallel_get_max_threads());
+    auto chunks = std::max<std::size_t>(1, threads / slices);
+    while ((chunks > 1) && ((n / chunks) < std::max<std::size_t>(4 * k, 1024))) {
+        --chunks;
+    }
+    const auto chunkSize = (n + chunks - 1) / chunks;
+
+    ScratchArena::Scope scope{scratch};
+    auto* candidates = scope.Allocate<std::pair<T, U>>(slices * chunks * k);
+    auto* counts = scope.Allocate<std::size_t>(slices * chunks);
+    std::fill(counts, counts + slices * chunks, std::size_t{0});
+    InferenceEngine::parallel_for2d(slices, chunks, [&] (std::size_t slice, std::size_t chunk) {
+        const auto sliceBase = arg + (slice / inner) * n * inner + (slice % inner);
+        SelectionHeap<T, U> heap{&candidates[(slice * chunks + chunk) * k], k, compute_max};
+        const auto begin = std::min(n, chunk * chunkSize);
+        const auto end = std::min(n, begin + chunkSize);
+        scan_range(sliceBase, inner, begin, end, compute_max, heap);
+        counts[slice * chunks + chunk] = heap._size;
+    });
+
+    InferenceEngine::parallel_for(slices, [&] (std::size_t slice) {
+        std::vector<std::pair<T, U>> merged;
+        merged.reserve(chunks * k);
+        for (std::size_t chunk = 0; chunk < chunks; ++chunk) {
+            const auto base = (slice * chunks + chunk) * k;
+            merged.insert(merged.end(),
+                          candidates + base,
+                          candidates + base + counts[slice * chunks + chunk]);
+        }
+        auto beats = [&] (const std::pair<T, U>& a, const std::pair<T, U>& b) {
+            if (a.first != b.first) {
+                return compute_max ? (a.first > b.first) : (a.first < b.first);
+            }
+            return a.second < b.second;
+        };
+        const auto selected = std::min<std::size_t>(k, merged.size());
+        std::partial_sort(merged.begin(), merged.begin() + selected, merged.end(), beats);
+        if (sort == ngraph::op::TopKSortType::SORT_INDICES) {
+            std::sort(merged.begin(), merged.begin() + selected,
+                      [] (const std::pair<T, U>& a, const std::pair<T, U>& b) {
+                          return a.second < b.second;
+                      });
+        }
+        const auto outBase = (slice / inner) * k * inner + (slice % inner);
+        for (std::size_t j = 0; j < selected; ++j) {
+            out_values[outBase + j * inner] = merged[j].first;
+            out_indices[outBase + j * inner] = merged[j].second;
+        }
+    });
+}
+}  // namespace
+
 template<> Converter::Conversion::Ptr Converter::Convert(const opset::TopK& node) {
     auto make = [&] (auto refFunction) {
         return this->MakeConversion(refFunction,
@@ -17,11 +201,12 @@ template<> Converter::Conversion::Ptr Converter::Convert(const opset::TopK& node
                                     static_cast<size_t>(node.get_axis()),
                                     node.get_k(),
                                     node.get_mode() == ngraph::op::TopKMode::MAX,
-                                    node.get_sort_type());
+                                    node.get_sort_type(),
+                                    _scratch);
     };
 
     return CallSwitch(
-        AP_WRAP(make, ngraph::runtime::reference::topk),
+        AP_WRAP(make, parallel_topk),
         node.input(0), allTypes,
         node.get_index_element_type(),  indexTypes);
 }
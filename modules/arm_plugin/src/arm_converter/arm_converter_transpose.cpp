@@ -5,6 +5,7 @@
 #include <arm_compute/runtime/NEON/functions/NEPermute.h>
 #include <ngraph/runtime/reference/transpose.hpp>
 #include "arm_converter/arm_converter.hpp"
+#include "arm_converter/arm_neon_transpose.hpp"
 
 namespace ArmPlugin {
 template<> Converter::Conversion::Ptr Converter::Convert(const opset::ArmTranspose& node) {
@@ -65,6 +66,37 @@ static void wrap_transpose(const D* data,
 }
 
 template<> Converter::Conversion::Ptr Converter::Convert(const opset::Transpose& node) {
+#if defined(__aarch64__)
+    // A statically known order collapses to a rank-reduced permutation and
+    // runs on the tiled engine; data-dependent orders keep the reference loop
+    auto orderConstant = std::dynamic_pointer_cast<ngraph::op::Constant>(node.input_value(1).get_node_shared_ptr());
+    if (orderConstant || (ngraph::shape_size(node.get_input_shape(1)) == 0)) {
+        auto inputOrder = orderConstant ? orderConstant->cast_vector<std::size_t>() : std::vector<std::size_t>{};
+        if (inputOrder.empty()) {
+            inputOrder.resize(node.get_input_shape(0).size());
+            std::iota(inputOrder.begin(), inputOrder.end(), 0);
+            std::reverse(inputOrder.begin(), inputOrder.end());
+        }
+        const auto plan = neon::MakePermutePlan(node.get_input_shape(0), inputOrder);
+        if (neon::IsBatchedTranspose(plan)) {
+            const auto rank = plan.dims.size();
+            const auto rows = plan.dims[rank - 2];
+            const auto cols = plan.dims[rank - 1];
+            const auto batch = ngraph::shape_size(plan.dims) / (rows * cols);
+            auto make = [&] (auto transposeFunction) {
+                return this->MakeConversion(MakeParallelReference(batch * ((cols + 3) / 4), transposeFunction),
+                                            node.input(0), node.output(0), rows, cols);
+            };
+            return CallSwitch(AP_WRAP(make, neon::batched_transpose), node.input(0), allTypes);
+        }
+        const auto outRows = ngraph::shape_size(plan.dims) / plan.dims[plan.order.back()];
+        auto make = [&] (auto permuteFunction) {
+            return this->MakeConversion(MakeParallelReference(outRows, permuteFunction),
+                                        node.input(0), node.output(0), plan);
+        };
+        return CallSwitch(AP_WRAP(make, neon::permute_rows), node.input(0), allTypes);
+    }
+#endif
     auto make = [&] (auto refFunction) {
         if (ngraph::shape_size(node.get_input_shape(1)) == 0) {
             return this->MakeConversion(refFunction,
@@ -0,0 +1,122 @@
+// Copyright (C) 2020-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#if defined(__aarch64__)
+
+#include <arm_neon.h>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace ArmPlugin {
+namespace neon {
+
+inline void unpack_u8_to_f32(const uint8x16_t v, float* dst) {
+    const uint16x8_t lo = vmovl_u8(vget_low_u8(v));
+    const uint16x8_t hi = vmovl_u8(vget_high_u8(v));
+    vst1q_f32(dst + 0, vcvtq_f32_u32(vmovl_u16(vget_low_u16(lo))));
+    vst1q_f32(dst + 4, vcvtq_f32_u32(vmovl_u16(vget_high_u16(lo))));
+    vst1q_f32(dst + 8, vcvtq_f32_u32(vmovl_u16(vget_low_u16(hi))));
+    vst1q_f32(dst + 12, vcvtq_f32_u32(vmovl_u16(vget_high_u16(hi))));
+}
+
+inline uint8x16_t pack_f32_to_u8(const float* src) {
+    const uint32x4_t a = vcvtq_u32_f32(vld1q_f32(src + 0));
+    const uint32x4_t b = vcvtq_u32_f32(vld1q_f32(src + 4));
+    const uint32x4_t c = vcvtq_u32_f32(vld1q_f32(src + 8));
+    const uint32x4_t d = vcvtq_u32_f32(vld1q_f32(src + 12));
+    const uint16x8_t lo = vcombine_u16(vqmovn_u32(a), vqmovn_u32(b));
+    const uint16x8_t hi = vcombine_u16(vqmovn_u32(c), vqmovn_u32(d));
+    return vcombine_u8(vqmovn_u16(lo), vqmovn_u16(hi));
+}
+
+inline void convert_u8_to_f32(const std::uint8_t* src, float* dst, const std::size_t count) {
+    std::size_t i = 0;
+    for (; i + 16 <= count; i += 16) {
+        unpack_u8_to_f32(vld1q_u8(src + i), dst + i);
+    }
+    for (; i < count; ++i) {
+        dst[i] = src[i];
+    }
+}
+
+inline void convert_f32_to_u8(const float* src, std::uint8_t* dst, const std::size_t count) {
+    std::size_t i = 0;
+    for (; i + 16 <= count; i += 16) {
+        vst1q_u8(dst + i, pack_f32_to_u8(src + i));
+    }
+    for (; i < count; ++i) {
+        dst[i] = static_cast<std::uint8_t>(src[i]);
+    }
+}
+
+// One interleaved image row (pixels x channels) converted and de-interleaved
+// into the planar layout in a single sweep; the structure loads split 1, 3 and
+// 4 channel data for free, other channel counts take the scalar loop
+inline void convert_row_u8_to_f32(const std::uint8_t* src, float* dst, const std::size_t pixels,
+                                  const std::size_t channels, const std::size_t planeStride) {
+    std::size_t i = 0;
+    if (channels == 1) {
+        convert_u8_to_f32(src, dst, pixels);
+        return;
+    } else if (channels == 3) {
+        for (; i + 16 <= pixels; i += 16) {
+            const uint8x16x3_t v = vld3q_u8(src + i * 3);
+            unpack_u8_to_f32(v.val[0], dst + i);
+            unpack_u8_to_f32(v.val[1], dst + planeStride + i);
+            unpack_u8_to_f32(v.val[2], dst + 2 * planeStride + i);
+        }
+    } else if (channels == 4) {
+        for (; i + 16 <= pixels; i += 16) {
+            const uint8x16x4_t v = vld4q_u8(src + i * 4);
+            unpack_u8_to_f32(v.val[0], dst + i);
+            unpack_u8_to_f32(v.val[1], dst + planeStride + i);
+            unpack_u8_to_f32(v.val[2], dst + 2 * planeStride + i);
+            unpack_u8_to_f32(v.val[3], dst + 3 * planeStride + i);
+        }
+    }
+    for (; i < pixels; ++i) {
+        for (std::size_t c = 0; c < channels; ++c) {
+            dst[c * planeStride + i] = src[i * channels + c];
+        }
+    }
+}
+
+inline void convert_row_f32_to_u8(const float* src, std::uint8_t* dst, const std::size_t pixels,
+                                  const std::size_t channels, const std::size_t planeStride) {
+    std::size_t i = 0;
+    if (channels == 1) {
+        convert_f32_to_u8(src, dst, pixels);
+        return;
+    } else if (channels == 3) {
+        for (; i + 16 <= pixels; i += 16) {
+            uint8x16x3_t v;
+            v.val[0] = pack_f32_to_u8(src + i);
+            v.val[1] = pack_f32_to_u8(src + planeStride + i);
+            v.val[2] = pack_f32_to_u8(src + 2 * planeStride + i);
+            vst3q_u8(dst + i * 3, v);
+        }
+    } else if (channels == 4) {
+        for (; i + 16 <= pixels; i += 16) {
+            uint8x16x4_t v;
+            v.val[0] = pack_f32_to_u8(src + i);
+            v.val[1] = pack_f32_to_u8(src + planeStride + i);
+            v.val[2] = pack_f32_to_u8(src + 2 * planeStride + i);
+            v.val[3] = pack_f32_to_u8(src + 3 * planeStride + i);
+            vst4q_u8(dst + i * 4, v);
+        }
+    }
+    for (; i < pixels; ++i) {
+        for (std::size_t c = 0; c < channels; ++c) {
+            dst[i * channels + c] = static_cast<std::uint8_t>(src[c * planeStride + i]);
+        }
+    }
+}
+
+}  // namespace neon
+}  // namespace ArmPlugin
+
+#endif  // defined(__aarch64__)
@@ -0,0 +1,120 @@
+// Copyright (C) 2020-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#if defined(__aarch64__)
+
+#include <arm_neon.h>
+
+#include <algorithm>
+#include <cfloat>
+#include <cstddef>
+#include <cstdint>
+
+#include <ngraph/shape.hpp>
+
+namespace ArmPlugin {
+namespace neon {
+
+// First index of the row maximum: four lanes race over the row keeping the
+// earliest maximum each, cross-lane ties resolve to the smallest index so the
+// result matches std::max_element
+inline std::size_t argmax_f32(const float* row, const std::size_t length) {
+    std::size_t i = 0;
+    float bestValue = -FLT_MAX;
+    std::size_t bestIndex = 0;
+    if (length >= 4) {
+        const std::uint32_t initIdx[4] = {0, 1, 2, 3};
+        uint32x4_t idx = vld1q_u32(initIdx);
+        const uint32x4_t step = vdupq_n_u32(4);
+        float32x4_t best = vdupq_n_f32(-FLT_MAX);
+        uint32x4_t bestIdx = vdupq_n_u32(0);
+        for (; i + 4 <= length; i += 4) {
+            const float32x4_t x = vld1q_f32(row + i);
+            const uint32x4_t gt = vcgtq_f32(x, best);
+            best = vbslq_f32(gt, x, best);
+            bestIdx = vbslq_u32(gt, idx, bestIdx);
+            idx = vaddq_u32(idx, step);
+        }
+        float laneValue[4];
+        std::uint32_t laneIndex[4];
+        vst1q_f32(laneValue, best);
+        vst1q_u32(laneIndex, bestIdx);
+        for (int lane = 0; lane < 4; ++lane) {
+            if ((laneValue[lane] > bestValue) ||
+                ((laneValue[lane] == bestValue) && (laneIndex[lane] < bestIndex))) {
+                bestValue = laneValue[lane];
+                bestIndex = laneIndex[lane];
+            }
+        }
+    }
+    for (; i < length; ++i) {
+        if (row[i] > bestValue) {
+            bestValue = row[i];
+            bestIndex = i;
+        }
+    }
+    return bestIndex;
+}
+
+// CTCGreedyDecoder over [T, N, C] data: the batches of [begin, end) decode
+// independently, each step is one vectorized argmax over the class row
+inline void ctc_greedy_decoder_f32(std::size_t begin, std::size_t end, const float* data, const float* seqMasks,
+                                   float* out, const ngraph::Shape& dataShape, const ngraph::Shape& seqShape,
+                                   const ngraph::Shape& outShape, const bool mergeRepeated) {
+    const auto maxTime = dataShape[0];
+    const auto batch = dataShape[1];
+    const auto classes = dataShape[2];
+    const auto blank = classes - 1;
+    const auto rowLength = ngraph::shape_size(outShape) / batch;
+    for (std::size_t b = begin; b < end; ++b) {
+        float* outRow = out + b * rowLength;
+        std::fill(outRow, outRow + rowLength, -1.f);
+        std::size_t previous = static_cast<std::size_t>(-1);
+        std::size_t decoded = 0;
+        for (std::size_t t = 0; t < maxTime; ++t) {
+            if (seqMasks[t * batch + b] == 0.f) {
+                continue;
+            }
+            const auto classIndex = argmax_f32(data + (t * batch + b) * classes, classes);
+            if ((classIndex != blank) && !(mergeRepeated && (previous == classIndex))) {
+                outRow[decoded++] = static_cast<float>(classIndex);
+            }
+            previous = classIndex;
+        }
+    }
+}
+
+// CTCGreedyDecoderSeqLen over [N, T, C] data with per-batch sequence lengths
+// and an explicit blank index
+template <typename I, typename C, typename S>
+void ctc_greedy_decoder_seq_len_f32(std::size_t begin, std::size_t end, const float* data, const I* seqLen,
+                                    const I* blankIndex, C* out1, S* out2, const ngraph::Shape& dataShape,
+                                    const ngraph::Shape& outShape, const bool mergeRepeated) {
+    const auto maxTime = dataShape[1];
+    const auto classes = dataShape[2];
+    const auto outTime = outShape[1];
+    const auto blank = static_cast<std::size_t>(blankIndex[0]);
+    for (std::size_t b = begin; b < end; ++b) {
+        C* outRow = out1 + b * outTime;
+        std::fill(outRow, outRow + outTime, static_cast<C>(-1));
+        const auto steps = static_cast<std::size_t>(seqLen[b]);
+        std::size_t previous = static_cast<std::size_t>(-1);
+        std::size_t decoded = 0;
+        for (std::size_t t = 0; t < steps; ++t) {
+            const auto classIndex = argmax_f32(data + (b * maxTime + t) * classes, classes);
+            if ((classIndex != blank) && !(mergeRepeated && (previous == classIndex))) {
+                outRow[decoded++] = static_cast<C>(classIndex);
+            }
+            previous = classIndex;
+        }
+        out2[b] = static_cast<S>(decoded);
+    }
+}
+
+}  // namespace neon
+}  // namespace ArmPlugin
+
+#endif  // defined(__aarch64__)
@@ -0,0 +1,155 @@
+// Copyright (C) 2020-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#if defined(__aarch64__)
+
+#include <arm_neon.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <ngraph/shape.hpp>
+#include <ngraph/type/float16.hpp>
+
+namespace ArmPlugin {
+namespace neon {
+
+// Shared gather-accumulate core of the three embedding bag variants: rows are
+// summed into an fp32 accumulator four lanes at a time, so fp16 tables widen
+// on load and narrow once per bag on the store instead of rounding per row
+inline void accumulate_row(float* acc, const float* row, const float weight, const std::size_t length) {
+    const float32x4_t w = vdupq_n_f32(weight);
+    std::size_t i = 0;
+    for (; i + 4 <= length; i += 4) {
+        vst1q_f32(acc + i, vmlaq_f32(vld1q_f32(acc + i), w, vld1q_f32(row + i)));
+    }
+    for (; i < length; ++i) {
+        acc[i] += weight * row[i];
+    }
+}
+
+inline void accumulate_row(float* acc, const ngraph::float16* row, const float weight, const std::size_t length) {
+    const float32x4_t w = vdupq_n_f32(weight);
+    const auto* data = reinterpret_cast<const float16_t*>(row);
+    std::size_t i = 0;
+    for (; i + 4 <= length; i += 4) {
+        vst1q_f32(acc + i, vmlaq_f32(vld1q_f32(acc + i), w, vcvt_f32_f16(vld1_f16(data + i))));
+    }
+    for (; i < length; ++i) {
+        acc[i] += weight * static_cast<float>(row[i]);
+    }
+}
+
+inline void store_row(float* out, const float* acc, const std::size_t length) {
+    std::copy(acc, acc + length, out);
+}
+
+inline void store_row(ngraph::float16* out, const float* acc, const std::size_t length) {
+    auto* data = reinterpret_cast<float16_t*>(out);
+    std::size_t i = 0;
+    for (; i + 4 <= length; i += 4) {
+        vst1_f16(data + i, vcvt_f16_f32(vld1q_f32(acc + i)));
+    }
+    for (; i < length; ++i) {
+        out[i] = ngraph::float16(acc[i]);
+    }
+}
+
+template<typename T>
+struct BagAccumulator {
+    explicit BagAccumulator(const std::size_t embeddingDim) : _acc(embeddingDim) {}
+    void Reset() {
+        std::fill(_acc.begin(), _acc.end(), 0.f);
+    }
+    void Add(const T* row, const float weight) {
+        accumulate_row(_acc.data(), row, weight, _acc.size());
+    }
+    void Store(T* out) {
+        store_row(out, _acc.data(), _acc.size());
+    }
+    std::vector<float> _acc;
+};
+
+// The kernels mirror the reference argument lists so the converters can hand
+// them the same parameter pack; the parallel wrapper partitions the bags
+template<typename T, typename I>
+void embedding_bag_offsets_sum(std::size_t begin, std::size_t end,
+                               const T* embTable, const I* indices, const I* offsets,
+                               const I* defaultIndex, const T* weights, T* out,
+                               const std::size_t indicesCount, const ngraph::Shape& outShape) {
+    const std::size_t numBags = outShape[0];
+    const std::size_t embeddingDim = ngraph::shape_size(outShape) / numBags;
+    BagAccumulator<T> bag{embeddingDim};
+    for (std::size_t b = begin; b < end; ++b) {
+        bag.Reset();
+        const auto first = static_cast<std::size_t>(offsets[b]);
+        const auto last = (b + 1 < numBags) ? static_cast<std::size_t>(offsets[b + 1]) : indicesCount;
+        if ((first == last) && (defaultIndex != nullptr)) {
+            bag.Add(embTable + static_cast<std::size_t>(defaultIndex[0]) * embeddingDim, 1.f);
+        }
+        for (std::size_t i = first; i < last; ++i) {
+            bag.Add(embTable + static_cast<std::size_t>(indices[i]) * embeddingDim,
+                    (weights != nullptr) ? static_cast<float>(weights[i]) : 1.f);
+        }
+        bag.Store(out + b * embeddingDim);
+    }
+}
+
+template<typename T, typename I>
+void embedding_bag_packed_sum(std::size_t begin, std::size_t end,
+                              const T* embTable, const I* indices, const T* weights, T* out,
+                              const ngraph::Shape& indicesShape, const ngraph::Shape& outShape) {
+    const std::size_t numBags = outShape[0];
+    const std::size_t embeddingDim = ngraph::shape_size(outShape) / numBags;
+    const std::size_t perBag = indicesShape[1];
+    BagAccumulator<T> bag{embeddingDim};
+    for (std::size_t b = begin; b < end; ++b) {
+        bag.Reset();
+        for (std::size_t k = 0; k < perBag; ++k) {
+            const std::size_t i = b * perBag + k;
+            bag.Add(embTable + static_cast<std::size_t>(indices[i]) * embeddingDim,
+                    (weights != nullptr) ? static_cast<float>(weights[i]) : 1.f);
+        }
+        bag.Store(out + b * embeddingDim);
+    }
+}
+
+template<typename T, typename I>
+void embedding_segments_sum(std::size_t begin, std::size_t end,
+                            const T* embTable, const I* indices, const I* segmentIds,
+                            const I* defaultIndex, const T* weights, T* out,
+                            const ngraph::Shape& embShape, const ngraph::Shape& indicesShape,
+                            const ngraph::Shape& outShape) {
+    const std::size_t numSegments = outShape[0];
+    const std::size_t embeddingDim = ngraph::shape_size(outShape) / numSegments;
+    const std::size_t indicesCount = ngraph::shape_size(indicesShape);
+    BagAccumulator<T> bag{embeddingDim};
+    // Segment ids come sorted, so each thread positions a cursor once with a
+    // binary search and then walks its segment range linearly
+    const I* cursor = std::lower_bound(segmentIds, segmentIds + indicesCount, static_cast<I>(begin));
+    const I* last = segmentIds + indicesCount;
+    for (std::size_t s = begin; s < end; ++s) {
+        bag.Reset();
+        bool empty = true;
+        for (; (cursor != last) && (static_cast<std::size_t>(*cursor) == s); ++cursor) {
+            const std::size_t i = cursor - segmentIds;
+            bag.Add(embTable + static_cast<std::size_t>(indices[i]) * embeddingDim,
+                    (weights != nullptr) ? static_cast<float>(weights[i]) : 1.f);
+            empty = false;
+        }
+        if (empty && (defaultIndex != nullptr)) {
+            bag.Add(embTable + static_cast<std::size_t>(defaultIndex[0]) * embeddingDim, 1.f);
+        }
+        bag.Store(out + s * embeddingDim);
+    }
+}
+
+}  // namespace neon
+}  // namespace ArmPlugin
+
+#endif  // defined(__aarch64__)
@@ -0,0 +1,136 @@
+// Copyright (C) 2020-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#if defined(__aarch64__)
+
+#include <cstdint>
+#include <cstring>
+
+#include <ngraph/shape.hpp>
+
+namespace ArmPlugin {
+namespace neon {
+
+// Range-partitioned gathers: every kernel takes [begin, end) over independent
+// output rows (or elements) so MakeParallelReference spreads them across the
+// scheduler threads; a row is one contiguous innermost slice moved with a
+// single copy. Negative indices wrap, out-of-range rows are zero filled to
+// match the reference behaviour
+
+// Gather along axis: out[(b, m, q), :inner] = data[(b, m, idx(b, q)), :inner],
+// b over the shared leading batch dims, m over the data dims between them and
+// the axis, q over the per-batch index count
+template <typename T, typename U>
+void gather(std::size_t begin, std::size_t end, const T* data, const U* indices, T* out,
+            const ngraph::Shape& dataShape, const ngraph::Shape& indicesShape,
+            const std::size_t axis, const std::size_t batchDims) {
+    std::size_t batches = 1;
+    for (std::size_t d = 0; d < batchDims; ++d) {
+        batches *= dataShape[d];
+    }
+    std::size_t mid = 1;
+    for (std::size_t d = batchDims; d < axis; ++d) {
+        mid *= dataShape[d];
+    }
+    const auto axisDim = static_cast<std::int64_t>(dataShape[axis]);
+    std::size_t inner = 1;
+    for (std::size_t d = axis + 1; d < dataShape.size(); ++d) {
+        inner *= dataShape[d];
+    }
+    const auto indicesPerBatch = ngraph::shape_size(indicesShape) / batches;
+    for (std::size_t r = begin; r < end; ++r) {
+        const auto q = r % indicesPerBatch;
+        const auto bm = r / indicesPerBatch;
+        const auto b = bm / mid;
+        auto idx = static_cast<std::int64_t>(indices[b * indicesPerBatch + q]);
+        if (idx < 0) {
+            idx += axisDim;
+        }
+        T* dstRow = out + r * inner;
+        if ((idx >= 0) && (idx < axisDim)) {
+            std::memcpy(dstRow, data + (bm * axisDim + idx) * inner, inner * sizeof(T));
+        } else {
+            std::memset(dstRow, 0, inner * sizeof(T));
+        }
+    }
+}
+
+// GatherND: every row resolves a tuple of k indices into one slice of the
+// trailing data dims; the leading batchDims dims are shared
+template <typename T, typename U>
+void gather_nd(std::size_t begin, std::size_t end, const T* data, const U* indices, T* out,
+               const ngraph::Shape& dataShape, const ngraph::Shape& indicesShape,
+               const std::size_t batchDims) {
+    const auto k = indicesShape.back();
+    const auto rank = dataShape.size();
+    std::size_t batches = 1;
+    for (std::size_t d = 0; d < batchDims; ++d) {
+        batches *= dataShape[d];
+    }
+    std::size_t slice = 1;
+    for (auto d = batchDims + k; d < rank; ++d) {
+        slice *= dataShape[d];
+    }
+    std::size_t dataPerBatch = 1;
+    for (auto d = batchDims; d < rank; ++d) {
+        dataPerBatch *= dataShape[d];
+    }
+    std::size_t strides[8];
+    strides[k - 1] = slice;
+    for (auto j = k - 1; j > 0; --j) {
+        strides[j - 1] = strides[j] * dataShape[batchDims + j];
+    }
+    const auto rowsPerBatch = ngraph::shape_size(indicesShape) / (k * batches);
+    for (std::size_t r = begin; r < end; ++r) {
+        const auto b = r / rowsPerBatch;
+        const U* idx = indices + r * k;
+        bool inRange = true;
+        std::size_t offset = b * dataPerBatch;
+        for (std::size_t j = 0; j < k; ++j) {
+            const auto dim = static_cast<std::int64_t>(dataShape[batchDims + j]);
+            auto v = static_cast<std::int64_t>(idx[j]);
+            if (v < 0) {
+                v += dim;
+            }
+            inRange = inRange && (v >= 0) && (v < dim);
+            offset += static_cast<std::size_t>(v) * strides[j];
+        }
+        T* dstRow = out + r * slice;
+        if (inRange) {
+            std::memcpy(dstRow, data + offset, slice * sizeof(T));
+        } else {
+            std::memset(dstRow, 0, slice * sizeof(T));
+        }
+    }
+}
+
+// GatherElements: the index varies per element, so the range partitions the
+// flat output; out[(o, a, j)] = data[(o, indices[(o, a, j)], j)]
+template <typename T, typename U>
+void gather_elements(std::size_t begin, std::size_t end, const T* data, const U* indices, T* out,
+                     const ngraph::Shape& dataShape, const ngraph::Shape& outShape,
+                     const std::size_t axis) {
+    std::size_t inner = 1;
+    for (std::size_t d = axis + 1; d < outShape.size(); ++d) {
+        inner *= outShape[d];
+    }
+    const auto axisData = static_cast<std::int64_t>(dataShape[axis]);
+    const auto axisOut = outShape[axis];
+    for (std::size_t p = begin; p < end; ++p) {
+        const auto j = p % inner;
+        const auto o = p / inner / axisOut;
+        auto v = static_cast<std::int64_t>(indices[p]);
+        if (v < 0) {
+            v += axisData;
+        }
+        out[p] = ((v >= 0) && (v < axisData)) ? data[(o * axisData + v) * inner + j] : T{};
+    }
+}
+
+}  // namespace neon
+}  // namespace ArmPlugin
+
+#endif  // defined(__aarch64__)
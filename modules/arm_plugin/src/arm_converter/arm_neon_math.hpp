@@ -0,0 +1,127 @@
+// Copyright (C) 2020-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#if defined(__aarch64__)
+
+#include <arm_neon.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+#include <ngraph/op/round.hpp>
+#include <ngraph/shape.hpp>
+
+namespace ArmPlugin {
+namespace neon {
+
+// Cephes-style exp: range reduction by powers of two with a two-part ln2,
+// degree-5 polynomial on the reduced argument, scale through the exponent bits
+inline float32x4_t vexpq_f32(float32x4_t x) {
+    const float32x4_t log2e  = vdupq_n_f32(1.44269504088896341f);
+    const float32x4_t ln2Hi  = vdupq_n_f32(0.693359375f);
+    const float32x4_t ln2Lo  = vdupq_n_f32(-2.12194440e-4f);
+
+    x = vminq_f32(vmaxq_f32(x, vdupq_n_f32(-87.3365478515625f)), vdupq_n_f32(88.3762626647950f));
+    const float32x4_t n = vrndnq_f32(vmulq_f32(x, log2e));
+    float32x4_t r = vmlsq_f32(x, n, ln2Hi);
+    r = vmlsq_f32(r, n, ln2Lo);
+
+    float32x4_t poly = vdupq_n_f32(1.9875691500e-4f);
+    poly = vmlaq_f32(vdupq_n_f32(1.3981999507e-3f), poly, r);
+    poly = vmlaq_f32(vdupq_n_f32(8.3334519073e-3f), poly, r);
+    poly = vmlaq_f32(vdupq_n_f32(4.1665795894e-2f), poly, r);
+    poly = vmlaq_f32(vdupq_n_f32(1.6666665459e-1f), poly, r);
+    poly = vmlaq_f32(vdupq_n_f32(5.0000001201e-1f), poly, r);
+    poly = vmlaq_f32(r, poly, vmulq_f32(r, r));
+    poly = vaddq_f32(poly, vdupq_n_f32(1.f));
+
+    const int32x4_t scale = vshlq_n_s32(vaddq_s32(vcvtq_s32_f32(n), vdupq_n_s32(127)), 23);
+    return vmulq_f32(poly, vreinterpretq_f32_s32(scale));
+}
+
+// Abramowitz & Stegun 7.1.26: max error ~1.5e-7, well inside fp32 noise for
+// the activations this path serves
+inline float32x4_t verfq_f32(float32x4_t x) {
+    const float32x4_t ax = vabsq_f32(x);
+    // t = 1 / (1 + p * |x|) with two Newton refinements of the estimate
+    const float32x4_t denom = vmlaq_f32(vdupq_n_f32(1.f), vdupq_n_f32(0.3275911f), ax);
+    float32x4_t t = vrecpeq_f32(denom);
+    t = vmulq_f32(t, vrecpsq_f32(denom, t));
+    t = vmulq_f32(t, vrecpsq_f32(denom, t));
+
+    float32x4_t poly = vdupq_n_f32(1.061405429f);
+    poly = vmlaq_f32(vdupq_n_f32(-1.453152027f), poly, t);
+    poly = vmlaq_f32(vdupq_n_f32(1.421413741f), poly, t);
+    poly = vmlaq_f32(vdupq_n_f32(-0.284496736f), poly, t);
+    poly = vmlaq_f32(vdupq_n_f32(0.254829592f), poly, t);
+    poly = vmulq_f32(poly, t);
+
+    const float32x4_t expTerm = vexpq_f32(vnegq_f32(vmulq_f32(ax, ax)));
+    const float32x4_t result = vmlsq_f32(vdupq_n_f32(1.f), poly, expTerm);
+    const uint32x4_t negative = vcltq_f32(x, vdupq_n_f32(0.f));
+    return vbslq_f32(negative, vnegq_f32(result), result);
+}
+
+inline void round_f32(std::size_t begin, std::size_t end, const float* src, float* dst,
+                      const ngraph::op::v5::Round::RoundMode mode) {
+    const bool toEven = (mode == ngraph::op::v5::Round::RoundMode::HALF_TO_EVEN);
+    std::size_t i = begin;
+    for (; i + 4 <= end; i += 4) {
+        const float32x4_t v = vld1q_f32(src + i);
+        vst1q_f32(dst + i, toEven ? vrndnq_f32(v) : vrndaq_f32(v));
+    }
+    for (; i < end; ++i) {
+        dst[i] = toEven ? std::nearbyint(src[i]) : std::round(src[i]);
+    }
+}
+
+inline void erf_f32(std::size_t begin, std::size_t end, const float* src, float* dst) {
+    std::size_t i = begin;
+    for (; i + 4 <= end; i += 4) {
+        vst1q_f32(dst + i, verfq_f32(vld1q_f32(src + i)));
+    }
+    for (; i < end; ++i) {
+        dst[i] = std::erf(src[i]);
+    }
+}
+
+// Linear vectorized scan instead of a per-element binary search: every sorted
+// boundary is broadcast and compared against four inputs at once, the bucket
+// index is the count of boundaries below (not above, with the right bound
+// included) the value. The converter only routes boundary sets small enough
+// for the O(buckets) scan to beat the scalar O(log buckets) search
+template<typename P>
+void bucketize_f32(std::size_t begin, std::size_t end, const float* data, const float* buckets, P* output,
+                   const ngraph::Shape& buckets_shape, const bool with_right_bound) {
+    const std::size_t numBuckets = ngraph::shape_size(buckets_shape);
+    std::size_t i = begin;
+    for (; i + 4 <= end; i += 4) {
+        const float32x4_t v = vld1q_f32(data + i);
+        uint32x4_t count = vdupq_n_u32(0);
+        for (std::size_t b = 0; b < numBuckets; ++b) {
+            const float32x4_t bound = vdupq_n_f32(buckets[b]);
+            // Comparison lanes are 0 or -1, so subtracting them accumulates the count
+            count = vsubq_u32(count, with_right_bound ? vcgtq_f32(v, bound) : vcgeq_f32(v, bound));
+        }
+        const int32x4_t index = vreinterpretq_s32_u32(count);
+        output[i + 0] = static_cast<P>(vgetq_lane_s32(index, 0));
+        output[i + 1] = static_cast<P>(vgetq_lane_s32(index, 1));
+        output[i + 2] = static_cast<P>(vgetq_lane_s32(index, 2));
+        output[i + 3] = static_cast<P>(vgetq_lane_s32(index, 3));
+    }
+    for (; i < end; ++i) {
+        const auto* bound = with_right_bound ? std::lower_bound(buckets, buckets + numBuckets, data[i])
+                                             : std::upper_bound(buckets, buckets + numBuckets, data[i]);
+        output[i] = static_cast<P>(bound - buckets);
+    }
+}
+
+}  // namespace neon
+}  // namespace ArmPlugin
+
+#endif  // defined(__aarch64__)
@@ -0,0 +1,127 @@
+// Copyright (C) 2020-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#if defined(__aarch64__)
+
+#include <arm_neon.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+
+#include <ngraph/op/mvn.hpp>
+#include <ngraph/op/normalize_l2.hpp>
+
+namespace ArmPlugin {
+namespace neon {
+
+// Lane-wise Welford accumulation: every lane maintains its own running
+// mean/M2 over a quarter of the row, the four lanes and the scalar tail are
+// merged with Chan's formula afterwards. One traversal yields both moments
+// where the reference normalization makes a pass per moment
+struct WelfordState {
+    float       _mean = 0.f;
+    float       _m2 = 0.f;
+    std::size_t _count = 0;
+};
+
+inline void welford_merge(WelfordState& state, const WelfordState& other) {
+    if (other._count == 0) {
+        return;
+    }
+    const float delta = other._mean - state._mean;
+    const std::size_t count = state._count + other._count;
+    state._mean += delta * other._count / count;
+    state._m2 += other._m2 + delta * delta * (static_cast<float>(state._count) * other._count / count);
+    state._count = count;
+}
+
+inline WelfordState welford_row_f32(const float* row, const std::size_t length) {
+    float32x4_t mean = vdupq_n_f32(0.f);
+    float32x4_t m2 = vdupq_n_f32(0.f);
+    std::size_t i = 0;
+    std::size_t steps = 0;
+    for (; i + 4 <= length; i += 4) {
+        ++steps;
+        const float32x4_t x = vld1q_f32(row + i);
+        const float32x4_t delta = vsubq_f32(x, mean);
+        mean = vaddq_f32(mean, vmulq_n_f32(delta, 1.f / steps));
+        m2 = vmlaq_f32(m2, delta, vsubq_f32(x, mean));
+    }
+    WelfordState state;
+    welford_merge(state, WelfordState{vgetq_lane_f32(mean, 0), vgetq_lane_f32(m2, 0), steps});
+    welford_merge(state, WelfordState{vgetq_lane_f32(mean, 1), vgetq_lane_f32(m2, 1), steps});
+    welford_merge(state, WelfordState{vgetq_lane_f32(mean, 2), vgetq_lane_f32(m2, 2), steps});
+    welford_merge(state, WelfordState{vgetq_lane_f32(mean, 3), vgetq_lane_f32(m2, 3), steps});
+    WelfordState tail;
+    for (; i < length; ++i) {
+        ++tail._count;
+        const float delta = row[i] - tail._mean;
+        tail._mean += delta / tail._count;
+        tail._m2 += delta * (row[i] - tail._mean);
+    }
+    welford_merge(state, tail);
+    return state;
+}
+
+inline void mvn_rows_f32(std::size_t begin, std::size_t end, const float* src, float* dst,
+                         const std::size_t inner, const bool normalizeVariance,
+                         const float eps, const ngraph::op::MVNEpsMode epsMode) {
+    for (std::size_t row = begin; row < end; ++row) {
+        const float* in = src + row * inner;
+        float* out = dst + row * inner;
+        const auto state = welford_row_f32(in, inner);
+        const float variance = (state._count != 0) ? (state._m2 / state._count) : 0.f;
+        float scale = 1.f;
+        if (normalizeVariance) {
+            scale = (epsMode == ngraph::op::MVNEpsMode::INSIDE_SQRT)
+                        ? (1.f / std::sqrt(variance + eps))
+                        : (1.f / (std::sqrt(variance) + eps));
+        }
+        const float32x4_t vMean = vdupq_n_f32(state._mean);
+        const float32x4_t vScale = vdupq_n_f32(scale);
+        std::size_t i = 0;
+        for (; i + 4 <= inner; i += 4) {
+            vst1q_f32(out + i, vmulq_f32(vsubq_f32(vld1q_f32(in + i), vMean), vScale));
+        }
+        for (; i < inner; ++i) {
+            out[i] = (in[i] - state._mean) * scale;
+        }
+    }
+}
+
+inline void normalize_l2_rows_f32(std::size_t begin, std::size_t end, const float* src, float* dst,
+                                  const std::size_t inner, const float eps, const ngraph::op::EpsMode epsMode) {
+    for (std::size_t row = begin; row < end; ++row) {
+        const float* in = src + row * inner;
+        float* out = dst + row * inner;
+        float32x4_t acc = vdupq_n_f32(0.f);
+        std::size_t i = 0;
+        for (; i + 4 <= inner; i += 4) {
+            const float32x4_t x = vld1q_f32(in + i);
+            acc = vmlaq_f32(acc, x, x);
+        }
+        float sum = vaddvq_f32(acc);
+        for (; i < inner; ++i) {
+            sum += in[i] * in[i];
+        }
+        const float scale = 1.f / std::sqrt((epsMode == ngraph::op::EpsMode::ADD) ? (sum + eps)
+                                                                                  : std::max(sum, eps));
+        const float32x4_t vScale = vdupq_n_f32(scale);
+        i = 0;
+        for (; i + 4 <= inner; i += 4) {
+            vst1q_f32(out + i, vmulq_f32(vld1q_f32(in + i), vScale));
+        }
+        for (; i < inner; ++i) {
+            out[i] = in[i] * scale;
+        }
+    }
+}
+
+}  // namespace neon
+}  // namespace ArmPlugin
+
+#endif  // defined(__aarch64__)
@@ -0,0 +1,107 @@
+// Copyright (C) 2020-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#if defined(__aarch64__)
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include <ngraph/shape.hpp>
+
+namespace ArmPlugin {
+namespace neon {
+
+enum class PadKind { Constant, Edge, Reflect, Symmetric };
+
+struct PadPlan {
+    ngraph::Shape srcShape;
+    ngraph::Shape dstShape;
+    std::vector<std::int64_t> padsBegin;
+    std::vector<std::size_t> srcStrides;
+    PadKind kind;
+};
+
+inline PadPlan MakePadPlan(const ngraph::Shape& srcShape, const ngraph::Shape& dstShape,
+                           const std::vector<std::int64_t>& padsBegin, const PadKind kind) {
+    PadPlan plan{srcShape, dstShape, padsBegin, std::vector<std::size_t>(srcShape.size()), kind};
+    std::size_t stride = 1;
+    for (auto d = srcShape.size(); d-- > 0;) {
+        plan.srcStrides[d] = stride;
+        stride *= srcShape[d];
+    }
+    return plan;
+}
+
+// Source index for an out-of-range coordinate `i` (relative to the source
+// dim of extent `len`); the op validates the pad extents against the dim,
+// so each mirror resolves in one step
+inline std::size_t MapPadIndex(const std::int64_t i, const std::size_t len, const PadKind kind) {
+    switch (kind) {
+    case PadKind::Edge:
+        return (i < 0) ? 0 : (len - 1);
+    case PadKind::Reflect:
+        return (i < 0) ? -i : (2 * len - 2 - i);
+    default:  // Symmetric
+        return (i < 0) ? (-i - 1) : (2 * len - 1 - i);
+    }
+}
+
+// Row-blocked pad for every mode; [begin, end) ranges over output rows (all
+// output dims but the last). Each row copies the interior in one memcpy with
+// the border handler of its mode filling the left and right flanks; rows
+// entirely in the constant border become one fill
+template <typename T>
+inline void pad_rows(std::size_t begin, std::size_t end, const T* src, const T* padValue, T* dst,
+                     const PadPlan plan) {
+    const auto rank = plan.srcShape.size();
+    const auto lastSrc = plan.srcShape[rank - 1];
+    const auto lastDst = plan.dstShape[rank - 1];
+    const auto lastBegin = plan.padsBegin[rank - 1];
+    const auto leftCount = std::min<std::size_t>(std::max<std::int64_t>(lastBegin, 0), lastDst);
+    const auto midCount = std::min<std::size_t>(lastSrc, lastDst - leftCount);
+    for (auto row = begin; row < end; ++row) {
+        auto rest = row;
+        std::size_t base = 0;
+        bool outside = false;
+        for (auto d = rank - 1; d-- > 0;) {
+            const auto i = static_cast<std::int64_t>(rest % plan.dstShape[d]) - plan.padsBegin[d];
+            rest /= plan.dstShape[d];
+            if ((i >= 0) && (i < static_cast<std::int64_t>(plan.srcShape[d]))) {
+                base += i * plan.srcStrides[d];
+            } else if (plan.kind == PadKind::Constant) {
+                outside = true;
+            } else {
+                base += MapPadIndex(i, plan.srcShape[d], plan.kind) * plan.srcStrides[d];
+            }
+        }
+        T* out = dst + row * lastDst;
+        if (outside) {
+            std::fill(out, out + lastDst, *padValue);
+            continue;
+        }
+        const T* srcRow = src + base;
+        std::memcpy(out + leftCount, srcRow, midCount * sizeof(T));
+        if (plan.kind == PadKind::Constant) {
+            std::fill(out, out + leftCount, *padValue);
+            std::fill(out + leftCount + midCount, out + lastDst, *padValue);
+        } else {
+            for (std::size_t o = 0; o < leftCount; ++o) {
+                out[o] = srcRow[MapPadIndex(static_cast<std::int64_t>(o) - lastBegin, lastSrc, plan.kind)];
+            }
+            for (auto o = leftCount + midCount; o < lastDst; ++o) {
+                out[o] = srcRow[MapPadIndex(static_cast<std::int64_t>(o) - lastBegin, lastSrc, plan.kind)];
+            }
+        }
+    }
+}
+
+}  // namespace neon
+}  // namespace ArmPlugin
+
+#endif  // defined(__aarch64__)
@@ -0,0 +1,214 @@
+// Copyright (C) 2020-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#if defined(__aarch64__)
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include <arm_neon.h>
+
+#include <ngraph/shape.hpp>
+
+namespace ArmPlugin {
+namespace neon {
+
+enum class ReduceKind { Sum, Mean, Max, Min, Prod, L1, L2 };
+
+// Axis-collapse plan: unit dims are transparent and adjacent dims with the
+// same reduced/kept role merge, so any reduction whose reduced dims form one
+// run collapses to [outer, red, inner] and runs in a single pass. Reductions
+// with several separated runs stay on the per-axis decomposition
+struct ReducePlan {
+    bool contiguous = true;
+    std::size_t outer = 1;
+    std::size_t red = 1;
+    std::size_t inner = 1;
+};
+
+inline ReducePlan MakeReducePlan(const ngraph::Shape& shape, const std::vector<std::int64_t>& axes) {
+    std::vector<bool> reduced(shape.size(), false);
+    for (auto axis : axes) {
+        reduced[axis < 0 ? axis + shape.size() : axis] = true;
+    }
+    ReducePlan plan;
+    enum {Outer, Reduce, Inner} state = Outer;
+    for (std::size_t d = 0; d < shape.size(); ++d) {
+        if (shape[d] == 1) {
+            continue;
+        }
+        if (reduced[d]) {
+            plan.contiguous = plan.contiguous && (state != Inner);
+            state = Reduce;
+            plan.red *= shape[d];
+        } else {
+            if (state == Reduce) {
+                state = Inner;
+            }
+            (state == Outer ? plan.outer : plan.inner) *= shape[d];
+        }
+    }
+    return plan;
+}
+
+// Horizontal reduction of one contiguous run: the vector accumulator folds
+// four lanes per step, the lanes combine with the plain op at the end (the
+// L1/L2 element transforms must not re-apply to partial sums, hence the
+// separate accumulate and combine ops)
+template <typename VectorOp, typename ScalarOp, typename CombineOp>
+inline float ReduceRow(const float* src, std::size_t count, float init,
+                       VectorOp vop, ScalarOp sop, CombineOp comb) {
+    auto acc = vdupq_n_f32(init);
+    std::size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        acc = vop(acc, vld1q_f32(src + i));
+    }
+    float lanes[4];
+    vst1q_f32(lanes, acc);
+    auto result = comb(comb(lanes[0], lanes[1]), comb(lanes[2], lanes[3]));
+    for (; i < count; ++i) {
+        result = sop(result, src[i]);
+    }
+    return result;
+}
+
+// inner == 1 shape of the plan: every output element reduces a contiguous
+// run of `count` floats; [begin, end) ranges over output elements
+inline void reduce_rows_f32(std::size_t begin, std::size_t end, const float* src, float* dst,
+                            const std::size_t count, const ReduceKind kind) {
+    const auto plus = [] (float a, float b) { return a + b; };
+    switch (kind) {
+    case ReduceKind::Sum:
+        for (auto r = begin; r < end; ++r) {
+            dst[r] = ReduceRow(src + r * count, count, 0.f,
+                               [] (float32x4_t a, float32x4_t b) { return vaddq_f32(a, b); }, plus, plus);
+        }
+        break;
+    case ReduceKind::Mean:
+        for (auto r = begin; r < end; ++r) {
+            dst[r] = ReduceRow(src + r * count, count, 0.f,
+                               [] (float32x4_t a, float32x4_t b) { return vaddq_f32(a, b); }, plus, plus) / count;
+        }
+        break;
+    case ReduceKind::Max:
+        for (auto r = begin; r < end; ++r) {
+            dst[r] = ReduceRow(src + r * count, count, std::numeric_limits<float>::lowest(),
+                               [] (float32x4_t a, float32x4_t b) { return vmaxq_f32(a, b); },
+                               [] (float a, float b) { return std::max(a, b); },
+                               [] (float a, float b) { return std::max(a, b); });
+        }
+        break;
+    case ReduceKind::Min:
+        for (auto r = begin; r < end; ++r) {
+            dst[r] = ReduceRow(src + r * count, count, std::numeric_limits<float>::max(),
+                               [] (float32x4_t a, float32x4_t b) { return vminq_f32(a, b); },
+                               [] (float a, float b) { return std::min(a, b); },
+                               [] (float a, float b) { return std::min(a, b); });
+        }
+        break;
+    case ReduceKind::Prod:
+        for (auto r = begin; r < end; ++r) {
+            dst[r] = ReduceRow(src + r * count, count, 1.f,
+                               [] (float32x4_t a, float32x4_t b) { return vmulq_f32(a, b); },
+                               [] (float a, float b) { return a * b; },
+                               [] (float a, float b) { return a * b; });
+        }
+        break;
+    case ReduceKind::L1:
+        for (auto r = begin; r < end; ++r) {
+            dst[r] = ReduceRow(src + r * count, count, 0.f,
+                               [] (float32x4_t a, float32x4_t b) { return vaddq_f32(a, vabsq_f32(b)); },
+                               [] (float a, float b) { return a + std::abs(b); }, plus);
+        }
+        break;
+    case ReduceKind::L2:
+        for (auto r = begin; r < end; ++r) {
+            dst[r] = std::sqrt(ReduceRow(src + r * count, count, 0.f,
+                                         [] (float32x4_t a, float32x4_t b) { return vfmaq_f32(a, b, b); },
+                                         [] (float a, float b) { return a + b * b; }, plus));
+        }
+        break;
+    }
+}
+
+template <typename VectorOp, typename ScalarOp>
+inline void ReducePlaneInto(const float* src, float* dst, const std::size_t red, const std::size_t inner,
+                            float init, VectorOp vop, ScalarOp sop) {
+    std::fill(dst, dst + inner, init);
+    for (std::size_t s = 0; s < red; ++s) {
+        const float* slice = src + s * inner;
+        std::size_t j = 0;
+        for (; j + 4 <= inner; j += 4) {
+            vst1q_f32(dst + j, vop(vld1q_f32(dst + j), vld1q_f32(slice + j)));
+        }
+        for (; j < inner; ++j) {
+            dst[j] = sop(dst[j], slice[j]);
+        }
+    }
+}
+
+// inner > 1 shape of the plan: every output row of `inner` floats accumulates
+// `red` strided slices; the accumulator lives in the destination row, so the
+// partials stay private to the thread owning the row. [begin, end) ranges
+// over output rows
+inline void reduce_planes_f32(std::size_t begin, std::size_t end, const float* src, float* dst,
+                              const std::size_t red, const std::size_t inner, const ReduceKind kind) {
+    for (auto r = begin; r < end; ++r) {
+        const float* srcRow = src + r * red * inner;
+        float* dstRow = dst + r * inner;
+        switch (kind) {
+        case ReduceKind::Sum:
+        case ReduceKind::Mean:
+            ReducePlaneInto(srcRow, dstRow, red, inner, 0.f,
+                            [] (float32x4_t a, float32x4_t b) { return vaddq_f32(a, b); },
+                            [] (float a, float b) { return a + b; });
+            break;
+        case ReduceKind::Max:
+            ReducePlaneInto(srcRow, dstRow, red, inner, std::numeric_limits<float>::lowest(),
+                            [] (float32x4_t a, float32x4_t b) { return vmaxq_f32(a, b); },
+                            [] (float a, float b) { return std::max(a, b); });
+            break;
+        case ReduceKind::Min:
+            ReducePlaneInto(srcRow, dstRow, red, inner, std::numeric_limits<float>::max(),
+                            [] (float32x4_t a, float32x4_t b) { return vminq_f32(a, b); },
+                            [] (float a, float b) { return std::min(a, b); });
+            break;
+        case ReduceKind::Prod:
+            ReducePlaneInto(srcRow, dstRow, red, inner, 1.f,
+                            [] (float32x4_t a, float32x4_t b) { return vmulq_f32(a, b); },
+                            [] (float a, float b) { return a * b; });
+            break;
+        case ReduceKind::L1:
+            ReducePlaneInto(srcRow, dstRow, red, inner, 0.f,
+                            [] (float32x4_t a, float32x4_t b) { return vaddq_f32(a, vabsq_f32(b)); },
+                            [] (float a, float b) { return a + std::abs(b); });
+            break;
+        case ReduceKind::L2:
+            ReducePlaneInto(srcRow, dstRow, red, inner, 0.f,
+                            [] (float32x4_t a, float32x4_t b) { return vfmaq_f32(a, b, b); },
+                            [] (float a, float b) { return a + b * b; });
+            break;
+        }
+        if (kind == ReduceKind::Mean) {
+            for (std::size_t j = 0; j < inner; ++j) {
+                dstRow[j] /= red;
+            }
+        } else if (kind == ReduceKind::L2) {
+            for (std::size_t j = 0; j < inner; ++j) {
+                dstRow[j] = std::sqrt(dstRow[j]);
+            }
+        }
+    }
+}
+
+}  // namespace neon
+}  // namespace ArmPlugin
+
+#endif  // defined(__aarch64__)
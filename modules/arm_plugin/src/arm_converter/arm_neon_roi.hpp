@@ -0,0 +1,221 @@
+// Copyright (C) 2020-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#if defined(__aarch64__)
+
+#include <arm_neon.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include <ngraph/op/roi_align.hpp>
+#include <ngraph/shape.hpp>
+
+namespace ArmPlugin {
+namespace neon {
+
+inline float32x4_t gather_f32(const float* data, const std::size_t* indices) {
+    const float values[4] = {data[indices[0]], data[indices[1]], data[indices[2]], data[indices[3]]};
+    return vld1q_f32(values);
+}
+
+// The bilinear sample table (four corner indices and weights per sample) only
+// depends on the ROI geometry, so it is built once per ROI and replayed over
+// every channel; the replay itself runs four samples per step. The parallel
+// wrapper hands each thread a contiguous ROI range
+template<typename U>
+void roi_align_f32(std::size_t begin, std::size_t end,
+                   const float* featureMaps, const float* rois, const U* batchIndices, float* out,
+                   const ngraph::Shape& featureMapsShape, const ngraph::Shape& outShape,
+                   const int pooledH, const int pooledW,
+                   const int samplingRatio, const float spatialScale,
+                   const ngraph::op::v3::ROIAlign::PoolingMode mode) {
+    const std::size_t channels = featureMapsShape[1];
+    const std::size_t height = featureMapsShape[2];
+    const std::size_t width = featureMapsShape[3];
+    const std::size_t planeSize = height * width;
+    const std::size_t binCount = static_cast<std::size_t>(pooledH) * pooledW;
+    const bool maxMode = (mode == ngraph::op::v3::ROIAlign::PoolingMode::MAX);
+    std::vector<std::size_t> index[4];
+    std::vector<float> weight[4];
+    for (std::size_t roi = begin; roi < end; ++roi) {
+        const float x1 = rois[roi * 4 + 0] * spatialScale;
+        const float y1 = rois[roi * 4 + 1] * spatialScale;
+        const float x2 = rois[roi * 4 + 2] * spatialScale;
+        const float y2 = rois[roi * 4 + 3] * spatialScale;
+        const float roiWidth = std::max(x2 - x1, 1.0f);
+        const float roiHeight = std::max(y2 - y1, 1.0f);
+        const float binWidth = roiWidth / pooledW;
+        const float binHeight = roiHeight / pooledH;
+        const int gridW = (samplingRatio > 0) ? samplingRatio : static_cast<int>(std::ceil(binWidth));
+        const int gridH = (samplingRatio > 0) ? samplingRatio : static_cast<int>(std::ceil(binHeight));
+        const std::size_t samplesPerBin = static_cast<std::size_t>(gridH) * gridW;
+        for (auto&& component : index) {
+            component.assign(binCount * samplesPerBin, 0);
+        }
+        for (auto&& component : weight) {
+            component.assign(binCount * samplesPerBin, 0.f);
+        }
+        std::size_t sample = 0;
+        for (int ph = 0; ph < pooledH; ++ph) {
+            for (int pw = 0; pw < pooledW; ++pw) {
+                for (int iy = 0; iy < gridH; ++iy) {
+                    const float yy = y1 + ph * binHeight + (iy + 0.5f) * binHeight / gridH;
+                    for (int ix = 0; ix < gridW; ++ix, ++sample) {
+                        const float xx = x1 + pw * binWidth + (ix + 0.5f) * binWidth / gridW;
+                        if ((yy < -1.f) || (yy > height) || (xx < -1.f) || (xx > width)) {
+                            continue;  // Out-of-image sample keeps its zero weights
+                        }
+                        float ys = std::max(yy, 0.f);
+                        float xs = std::max(xx, 0.f);
+                        std::size_t yLow = static_cast<std::size_t>(ys);
+                        std::size_t xLow = static_cast<std::size_t>(xs);
+                        std::size_t yHigh;
+                        std::size_t xHigh;
+                        if (yLow >= height - 1) {
+                            yHigh = yLow = height - 1;
+                            ys = static_cast<float>(yLow);
+                        } else {
+                            yHigh = yLow + 1;
+                        }
+                        if (xLow >= width - 1) {
+                            xHigh = xLow = width - 1;
+                            xs = static_cast<float>(xLow);
+                        } else {
+                            xHigh = xLow + 1;
+                        }
+                        const float ly = ys - yLow;
+                        const float lx = xs - xLow;
+                        const float hy = 1.f - ly;
+                        const float hx = 1.f - lx;
+                        index[0][sample] = yLow * width + xLow;
+                        index[1][sample] = yLow * width + xHigh;
+                        index[2][sample] = yHigh * width + xLow;
+                        index[3][sample] = yHigh * width + xHigh;
+                        weight[0][sample] = hy * hx;
+                        weight[1][sample] = hy * lx;
+                        weight[2][sample] = ly * hx;
+                        weight[3][sample] = ly * lx;
+                    }
+                }
+            }
+        }
+        const std::size_t batch = static_cast<std::size_t>(batchIndices[roi]);
+        for (std::size_t c = 0; c < channels; ++c) {
+            const float* slice = featureMaps + (batch * channels + c) * planeSize;
+            float* outSlice = out + (roi * channels + c) * binCount;
+            for (std::size_t bin = 0; bin < binCount; ++bin) {
+                const std::size_t base = bin * samplesPerBin;
+                std::size_t s = 0;
+                float result;
+                if (maxMode) {
+                    float32x4_t best = vdupq_n_f32(-std::numeric_limits<float>::max());
+                    for (; s + 4 <= samplesPerBin; s += 4) {
+                        float32x4_t value = vmulq_f32(vld1q_f32(&weight[0][base + s]), gather_f32(slice, &index[0][base + s]));
+                        value = vmlaq_f32(value, vld1q_f32(&weight[1][base + s]), gather_f32(slice, &index[1][base + s]));
+                        value = vmlaq_f32(value, vld1q_f32(&weight[2][base + s]), gather_f32(slice, &index[2][base + s]));
+                        value = vmlaq_f32(value, vld1q_f32(&weight[3][base + s]), gather_f32(slice, &index[3][base + s]));
+                        best = vmaxq_f32(best, value);
+                    }
+                    result = (s != 0) ? vmaxvq_f32(best) : -std::numeric_limits<float>::max();
+                    for (; s < samplesPerBin; ++s) {
+                        result = std::max(result, weight[0][base + s] * slice[index[0][base + s]] +
+                                                  weight[1][base + s] * slice[index[1][base + s]] +
+                                                  weight[2][base + s] * slice[index[2][base + s]] +
+                                                  weight[3][base + s] * slice[index[3][base + s]]);
+                    }
+                } else {
+                    float32x4_t acc = vdupq_n_f32(0.f);
+                    for (; s + 4 <= samplesPerBin; s += 4) {
+                        acc = vmlaq_f32(acc, vld1q_f32(&weight[0][base + s]), gather_f32(slice, &index[0][base + s]));
+                        acc = vmlaq_f32(acc, vld1q_f32(&weight[1][base + s]), gather_f32(slice, &index[1][base + s]));
+                        acc = vmlaq_f32(acc, vld1q_f32(&weight[2][base + s]), gather_f32(slice, &index[2][base + s]));
+                        acc = vmlaq_f32(acc, vld1q_f32(&weight[3][base + s]), gather_f32(slice, &index[3][base + s]));
+                    }
+                    result = vaddvq_f32(acc);
+                    for (; s < samplesPerBin; ++s) {
+                        result += weight[0][base + s] * slice[index[0][base + s]] +
+                                  weight[1][base + s] * slice[index[1][base + s]] +
+                                  weight[2][base + s] * slice[index[2][base + s]] +
+                                  weight[3][base + s] * slice[index[3][base + s]];
+                    }
+                    result /= samplesPerBin;
+                }
+                outSlice[bin] = result;
+            }
+        }
+    }
+}
+
+// Average-mode position-sensitive pooling: every output bin reads its own
+// input channel, so the bin sums are plain dense row reductions; rows are
+// accumulated four floats at a time and ROIs are split across the threads
+inline void psroi_pooling_avg_f32(std::size_t begin, std::size_t end,
+                                  const float* input, const ngraph::Shape& inputShape,
+                                  const float* rois, float* output, const ngraph::Shape& outputShape,
+                                  const float spatialScale) {
+    const std::size_t channels = inputShape[1];
+    const std::size_t height = inputShape[2];
+    const std::size_t width = inputShape[3];
+    const std::size_t planeSize = height * width;
+    const std::size_t outChannels = outputShape[1];
+    const int pooledH = static_cast<int>(outputShape[2]);
+    const int pooledW = static_cast<int>(outputShape[3]);
+    for (std::size_t roi = begin; roi < end; ++roi) {
+        const float* roiPtr = rois + roi * 5;
+        const std::size_t batch = static_cast<std::size_t>(roiPtr[0]);
+        const float startW = std::roundf(roiPtr[1]) * spatialScale;
+        const float startH = std::roundf(roiPtr[2]) * spatialScale;
+        const float endW = std::roundf(roiPtr[3] + 1.0f) * spatialScale;
+        const float endH = std::roundf(roiPtr[4] + 1.0f) * spatialScale;
+        const float binWidth = (endW - startW) / pooledW;
+        const float binHeight = (endH - startH) / pooledH;
+        float* outPtr = output + roi * outChannels * pooledH * pooledW;
+        for (std::size_t cOut = 0; cOut < outChannels; ++cOut) {
+            for (int ph = 0; ph < pooledH; ++ph) {
+                const int hStart = std::min(std::max(static_cast<int>(std::floor(startH + ph * binHeight)), 0),
+                                            static_cast<int>(height));
+                const int hEnd = std::min(std::max(static_cast<int>(std::ceil(startH + (ph + 1) * binHeight)), 0),
+                                          static_cast<int>(height));
+                for (int pw = 0; pw < pooledW; ++pw, ++outPtr) {
+                    const int wStart = std::min(std::max(static_cast<int>(std::floor(startW + pw * binWidth)), 0),
+                                                static_cast<int>(width));
+                    const int wEnd = std::min(std::max(static_cast<int>(std::ceil(startW + (pw + 1) * binWidth)), 0),
+                                              static_cast<int>(width));
+                    if ((hEnd <= hStart) || (wEnd <= wStart)) {
+                        *outPtr = 0.f;
+                        continue;
+                    }
+                    const std::size_t cIn = (cOut * pooledH + ph) * pooledW + pw;
+                    const float* slice = input + (batch * channels + cIn) * planeSize;
+                    float32x4_t acc = vdupq_n_f32(0.f);
+                    float sum = 0.f;
+                    for (int h = hStart; h < hEnd; ++h) {
+                        const float* row = slice + h * width;
+                        int w = wStart;
+                        for (; w + 4 <= wEnd; w += 4) {
+                            acc = vaddq_f32(acc, vld1q_f32(row + w));
+                        }
+                        for (; w < wEnd; ++w) {
+                            sum += row[w];
+                        }
+                    }
+                    sum += vaddvq_f32(acc);
+                    *outPtr = sum / ((hEnd - hStart) * (wEnd - wStart));
+                }
+            }
+        }
+    }
+}
+
+}  // namespace neon
+}  // namespace ArmPlugin
+
+#endif  // defined(__aarch64__)
@@ -0,0 +1,79 @@
+// Copyright (C) 2020-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#if defined(__aarch64__)
+
+#include <cstring>
+#include <vector>
+
+#include "arm_converter/arm_neon_space.hpp"
+
+namespace ArmPlugin {
+namespace neon {
+
+// Strided gather dst[i] = src[i * stride]: strides of 2..4 take one stream of
+// the structure loads, anything else falls back to the scalar loop
+inline void gather_strided(const std::uint64_t* src, std::uint64_t* dst,
+                           const std::size_t count, const std::size_t stride) {
+    for (std::size_t i = 0; i < count; ++i) {
+        dst[i] = src[i * stride];
+    }
+}
+
+template <typename T>
+void gather_strided(const T* src, T* dst, const std::size_t count, const std::size_t stride) {
+    using V = VecTraits<T>;
+    std::size_t i = 0;
+    if (stride == 2) {
+        for (; i + V::lanes <= count; i += V::lanes) {
+            V::store(dst + i, V::load2(src + i * 2).val[0]);
+        }
+    } else if (stride == 3) {
+        for (; i + V::lanes <= count; i += V::lanes) {
+            V::store(dst + i, V::load3(src + i * 3).val[0]);
+        }
+    } else if (stride == 4) {
+        for (; i + V::lanes <= count; i += V::lanes) {
+            V::store(dst + i, V::load4(src + i * 4).val[0]);
+        }
+    }
+    for (; i < count; ++i) {
+        dst[i] = src[i * stride];
+    }
+}
+
+// Executes a collapsed slice plan: the [begin, end) range indexes output rows,
+// each row is either one contiguous run (memcpy) or one small-stride gather.
+// outerDims/outerSteps describe the remaining non-contiguous dimensions in
+// row-major order, srcBase folds all the begin offsets
+template <typename T>
+void strided_slice_rows(std::size_t begin, std::size_t end, const T* src, T* dst,
+                        const std::vector<std::size_t>& outerDims,
+                        const std::vector<std::size_t>& outerSteps,
+                        const std::size_t srcBase,
+                        const std::size_t innerCount,
+                        const std::size_t innerStride) {
+    for (std::size_t r = begin; r < end; ++r) {
+        std::size_t srcPos = srcBase;
+        std::size_t rem = r;
+        for (std::size_t d = outerDims.size(); d-- > 0;) {
+            srcPos += (rem % outerDims[d]) * outerSteps[d];
+            rem /= outerDims[d];
+        }
+        const T* in = src + srcPos;
+        T* out = dst + r * innerCount;
+        if (innerStride == 1) {
+            std::memcpy(out, in, innerCount * sizeof(T));
+        } else {
+            gather_strided(in, out, innerCount, innerStride);
+        }
+    }
+}
+
+}  // namespace neon
+}  // namespace ArmPlugin
+
+#endif  // defined(__aarch64__)
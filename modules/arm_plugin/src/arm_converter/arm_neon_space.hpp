@@ -0,0 +1,292 @@
+// Copyright (C) 2020-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#if defined(__aarch64__)
+
+#include <arm_neon.h>
+
+#include <cstddef>
+#include <cstdint>
+
+#include <ngraph/shape.hpp>
+
+namespace ArmPlugin {
+namespace neon {
+
+// The space/depth reorders are pure address permutations, so the kernels work
+// on the element bit width, not the element type: a row of any 1, 2 or 4 byte
+// type moves through the matching unsigned lane type. Per width the structure
+// load/store instructions interleave and de-interleave 2, 3 or 4 contiguous
+// rows in one instruction, which is exactly the inner loop of every mode
+template <typename T>
+struct VecTraits;
+
+template <>
+struct VecTraits<std::uint8_t> {
+    static constexpr std::size_t lanes = 16;
+    static uint8x16x2_t load2(const std::uint8_t* p) {return vld2q_u8(p);}
+    static uint8x16x3_t load3(const std::uint8_t* p) {return vld3q_u8(p);}
+    static uint8x16x4_t load4(const std::uint8_t* p) {return vld4q_u8(p);}
+    static uint8x16_t load(const std::uint8_t* p) {return vld1q_u8(p);}
+    static void store(std::uint8_t* p, const uint8x16_t v) {vst1q_u8(p, v);}
+    static void store2(std::uint8_t* p, const uint8x16x2_t v) {vst2q_u8(p, v);}
+    static void store3(std::uint8_t* p, const uint8x16x3_t v) {vst3q_u8(p, v);}
+    static void store4(std::uint8_t* p, const uint8x16x4_t v) {vst4q_u8(p, v);}
+};
+
+template <>
+struct VecTraits<std::uint16_t> {
+    static constexpr std::size_t lanes = 8;
+    static uint16x8x2_t load2(const std::uint16_t* p) {return vld2q_u16(p);}
+    static uint16x8x3_t load3(const std::uint16_t* p) {return vld3q_u16(p);}
+    static uint16x8x4_t load4(const std::uint16_t* p) {return vld4q_u16(p);}
+    static uint16x8_t load(const std::uint16_t* p) {return vld1q_u16(p);}
+    static void store(std::uint16_t* p, const uint16x8_t v) {vst1q_u16(p, v);}
+    static void store2(std::uint16_t* p, const uint16x8x2_t v) {vst2q_u16(p, v);}
+    static void store3(std::uint16_t* p, const uint16x8x3_t v) {vst3q_u16(p, v);}
+    static void store4(std::uint16_t* p, const uint16x8x4_t v) {vst4q_u16(p, v);}
+};
+
+template <>
+struct VecTraits<std::uint32_t> {
+    static constexpr std::size_t lanes = 4;
+    static uint32x4x2_t load2(const std::uint32_t* p) {return vld2q_u32(p);}
+    static uint32x4x3_t load3(const std::uint32_t* p) {return vld3q_u32(p);}
+    static uint32x4x4_t load4(const std::uint32_t* p) {return vld4q_u32(p);}
+    static uint32x4_t load(const std::uint32_t* p) {return vld1q_u32(p);}
+    static void store(std::uint32_t* p, const uint32x4_t v) {vst1q_u32(p, v);}
+    static void store2(std::uint32_t* p, const uint32x4x2_t v) {vst2q_u32(p, v);}
+    static void store3(std::uint32_t* p, const uint32x4x3_t v) {vst3q_u32(p, v);}
+    static void store4(std::uint32_t* p, const uint32x4x4_t v) {vst4q_u32(p, v);}
+};
+
+template <>
+struct VecTraits<std::uint64_t> {
+    static constexpr std::size_t lanes = 2;
+    static uint64x2x2_t load2(const std::uint64_t* p) {return vld2q_u64(p);}
+    static uint64x2x3_t load3(const std::uint64_t* p) {return vld3q_u64(p);}
+    static uint64x2x4_t load4(const std::uint64_t* p) {return vld4q_u64(p);}
+    static uint64x2_t load(const std::uint64_t* p) {return vld1q_u64(p);}
+    static void store(std::uint64_t* p, const uint64x2_t v) {vst1q_u64(p, v);}
+    static void store2(std::uint64_t* p, const uint64x2x2_t v) {vst2q_u64(p, v);}
+    static void store3(std::uint64_t* p, const uint64x2x3_t v) {vst3q_u64(p, v);}
+    static void store4(std::uint64_t* p, const uint64x2x4_t v) {vst4q_u64(p, v);}
+};
+
+// Maps an element byte width to the unsigned lane type the kernels run on, so
+// typed converter shims can rebind any element type of that width
+template <std::size_t Width>
+struct WidthType;
+template <> struct WidthType<1> {using type = std::uint8_t;};
+template <> struct WidthType<2> {using type = std::uint16_t;};
+template <> struct WidthType<4> {using type = std::uint32_t;};
+template <> struct WidthType<8> {using type = std::uint64_t;};
+template <typename T>
+using WidthTypeOf = typename WidthType<sizeof(T)>::type;
+
+// Interleaves block contiguous rows into dst: dst[g * block + k] = rows[k][g]
+// for the first groups groups; block of 2..4 runs on structure stores
+template <typename T>
+void interleave_rows(const T* const* rows, T* dst, const std::size_t groups, const std::size_t block) {
+    using V = VecTraits<T>;
+    std::size_t g = 0;
+    if (block == 2) {
+        for (; g + V::lanes <= groups; g += V::lanes) {
+            decltype(V::load2(dst)) v;
+            v.val[0] = V::load(rows[0] + g);
+            v.val[1] = V::load(rows[1] + g);
+            V::store2(dst + g * 2, v);
+        }
+    } else if (block == 3) {
+        for (; g + V::lanes <= groups; g += V::lanes) {
+            decltype(V::load3(dst)) v;
+            v.val[0] = V::load(rows[0] + g);
+            v.val[1] = V::load(rows[1] + g);
+            v.val[2] = V::load(rows[2] + g);
+            V::store3(dst + g * 3, v);
+        }
+    } else if (block == 4) {
+        for (; g + V::lanes <= groups; g += V::lanes) {
+            decltype(V::load4(dst)) v;
+            v.val[0] = V::load(rows[0] + g);
+            v.val[1] = V::load(rows[1] + g);
+            v.val[2] = V::load(rows[2] + g);
+            v.val[3] = V::load(rows[3] + g);
+            V::store4(dst + g * 4, v);
+        }
+    }
+    for (; g < groups; ++g) {
+        for (std::size_t k = 0; k < block; ++k) {
+            dst[g * block + k] = rows[k][g];
+        }
+    }
+}
+
+// De-interleaves src into block contiguous rows: rows[k][g] = src[g * block + k]
+template <typename T>
+void deinterleave_rows(const T* src, T* const* rows, const std::size_t groups, const std::size_t block) {
+    using V = VecTraits<T>;
+    std::size_t g = 0;
+    if (block == 2) {
+        for (; g + V::lanes <= groups; g += V::lanes) {
+            const auto v = V::load2(src + g * 2);
+            V::store(rows[0] + g, v.val[0]);
+            V::store(rows[1] + g, v.val[1]);
+        }
+    } else if (block == 3) {
+        for (; g + V::lanes <= groups; g += V::lanes) {
+            const auto v = V::load3(src + g * 3);
+            V::store(rows[0] + g, v.val[0]);
+            V::store(rows[1] + g, v.val[1]);
+            V::store(rows[2] + g, v.val[2]);
+        }
+    } else if (block == 4) {
+        for (; g + V::lanes <= groups; g += V::lanes) {
+            const auto v = V::load4(src + g * 4);
+            V::store(rows[0] + g, v.val[0]);
+            V::store(rows[1] + g, v.val[1]);
+            V::store(rows[2] + g, v.val[2]);
+            V::store(rows[3] + g, v.val[3]);
+        }
+    }
+    for (; g < groups; ++g) {
+        for (std::size_t k = 0; k < block; ++k) {
+            rows[k][g] = src[g * block + k];
+        }
+    }
+}
+
+// DepthToSpace over [N, C*b*b, H, W] -> [N, C, H*b, W*b]: every output row
+// interleaves b contiguous input rows; the mode only changes which source
+// channels those rows come from. The [begin, end) range indexes output rows
+template <typename T>
+void depth_to_space(std::size_t begin, std::size_t end, const T* src, T* dst,
+                    const ngraph::Shape& srcShape, const std::size_t block, const bool blocksFirst) {
+    const auto srcChannels = srcShape[1];
+    const auto outChannels = srcChannels / (block * block);
+    const auto height = srcShape[2];
+    const auto width = srcShape[3];
+    const T* rows[4];
+    for (std::size_t r = begin; r < end; ++r) {
+        const auto n = r / (outChannels * height * block);
+        const auto rem = r % (outChannels * height * block);
+        const auto c = rem / (height * block);
+        const auto oh = rem % (height * block);
+        const auto h = oh / block;
+        const auto by = oh % block;
+        T* dstRow = dst + ((n * outChannels + c) * height * block + oh) * (width * block);
+        auto srcRow = [&] (std::size_t bx) {
+            const auto sc = blocksFirst ? ((by * block + bx) * outChannels + c)
+                                        : (c * block * block + by * block + bx);
+            return src + ((n * srcChannels + sc) * height + h) * width;
+        };
+        if (block <= 4) {
+            for (std::size_t bx = 0; bx < block; ++bx) {
+                rows[bx] = srcRow(bx);
+            }
+            interleave_rows(rows, dstRow, width, block);
+        } else {
+            for (std::size_t bx = 0; bx < block; ++bx) {
+                const T* in = srcRow(bx);
+                for (std::size_t w = 0; w < width; ++w) {
+                    dstRow[w * block + bx] = in[w];
+                }
+            }
+        }
+    }
+}
+
+// SpaceToDepth over [N, C, H*b, W*b] -> [N, C*b*b, H, W]: the exact inverse,
+// every input row de-interleaves into b contiguous output rows. The
+// [begin, end) range indexes input rows
+template <typename T>
+void space_to_depth(std::size_t begin, std::size_t end, const T* src, T* dst,
+                    const ngraph::Shape& srcShape, const std::size_t block, const bool blocksFirst) {
+    const auto channels = srcShape[1];
+    const auto srcHeight = srcShape[2];
+    const auto srcWidth = srcShape[3];
+    const auto height = srcHeight / block;
+    const auto width = srcWidth / block;
+    T* rows[4];
+    for (std::size_t r = begin; r < end; ++r) {
+        const auto n = r / (channels * srcHeight);
+        const auto rem = r % (channels * srcHeight);
+        const auto c = rem / srcHeight;
+        const auto ih = rem % srcHeight;
+        const auto h = ih / block;
+        const auto by = ih % block;
+        const T* srcRow = src + ((n * channels + c) * srcHeight + ih) * srcWidth;
+        auto dstRow = [&] (std::size_t bx) {
+            const auto dc = blocksFirst ? ((by * block + bx) * channels + c)
+                                        : (c * block * block + by * block + bx);
+            return dst + ((n * channels * block * block + dc) * height + h) * width;
+        };
+        if (block <= 4) {
+            for (std::size_t bx = 0; bx < block; ++bx) {
+                rows[bx] = dstRow(bx);
+            }
+            deinterleave_rows(srcRow, rows, width, block);
+        } else {
+            for (std::size_t bx = 0; bx < block; ++bx) {
+                T* out = dstRow(bx);
+                for (std::size_t w = 0; w < width; ++w) {
+                    out[w] = srcRow[w * block + bx];
+                }
+            }
+        }
+    }
+}
+
+// BatchToSpace over [N*by*bx, C, H, W] -> [N, C, H*by - crops, W*bx - crops]
+// with spatial crops: an output row is still an interleave of bx source rows,
+// the left crop only rotates which source batch feeds which phase and shifts
+// the row starts. The [begin, end) range indexes output rows
+template <typename T>
+void batch_to_space(std::size_t begin, std::size_t end, const T* src, T* dst,
+                    const ngraph::Shape& srcShape, const ngraph::Shape& dstShape,
+                    const std::size_t blockY, const std::size_t blockX,
+                    const std::size_t cropTop, const std::size_t cropLeft) {
+    const auto batch = dstShape[0];
+    const auto channels = dstShape[1];
+    const auto outHeight = dstShape[2];
+    const auto outWidth = dstShape[3];
+    const auto height = srcShape[2];
+    const auto width = srcShape[3];
+    const T* rows[4];
+    for (std::size_t r = begin; r < end; ++r) {
+        const auto n = r / (channels * outHeight);
+        const auto rem = r % (channels * outHeight);
+        const auto c = rem / outHeight;
+        const auto oh = rem % outHeight;
+        const auto ih = oh + cropTop;
+        const auto i = ih % blockY;
+        const auto h = ih / blockY;
+        T* dstRow = dst + ((n * channels + c) * outHeight + oh) * outWidth;
+        auto srcRow = [&] (std::size_t j) {
+            return src + ((((i * blockX + j) * batch + n) * channels + c) * height + h) * width;
+        };
+        const auto groups = outWidth / blockX;
+        if (blockX <= 4) {
+            for (std::size_t k = 0; k < blockX; ++k) {
+                rows[k] = srcRow((cropLeft + k) % blockX) + (cropLeft + k) / blockX;
+            }
+            interleave_rows(rows, dstRow, groups, blockX);
+            for (std::size_t ow = groups * blockX; ow < outWidth; ++ow) {
+                dstRow[ow] = rows[ow - groups * blockX][groups];
+            }
+        } else {
+            for (std::size_t ow = 0; ow < outWidth; ++ow) {
+                const auto iw = ow + cropLeft;
+                dstRow[ow] = srcRow(iw % blockX)[iw / blockX];
+            }
+        }
+    }
+}
+
+}  // namespace neon
+}  // namespace ArmPlugin
+
+#endif  // defined(__aarch64__)
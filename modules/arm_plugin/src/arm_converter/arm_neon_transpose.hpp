@@ -0,0 +1,180 @@
+// Copyright (C) 2020-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#if defined(__aarch64__)
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+#include <arm_neon.h>
+
+#include <ngraph/shape.hpp>
+
+namespace ArmPlugin {
+namespace neon {
+
+// Rank-collapse plan for an arbitrary permutation: unit dims carry no data
+// and drop out, and a run of input dims that stays contiguous and in order on
+// the output side moves as one block, so it merges into a single collapsed
+// dim. Most permutations in practice collapse to rank 2 or 3
+struct PermutePlan {
+    std::vector<std::size_t> dims;     // collapsed input dims
+    std::vector<std::size_t> strides;  // input element strides of those dims
+    std::vector<std::size_t> order;    // output dim d reads input dim order[d]
+};
+
+inline PermutePlan MakePermutePlan(const ngraph::Shape& shape, const std::vector<std::size_t>& order) {
+    std::vector<std::size_t> keptDims;
+    std::vector<std::size_t> keptOrder;
+    {
+        std::vector<std::size_t> newIndex(shape.size(), 0);
+        std::size_t next = 0;
+        for (std::size_t d = 0; d < shape.size(); ++d) {
+            newIndex[d] = next;
+            if (shape[d] != 1) {
+                keptDims.push_back(shape[d]);
+                ++next;
+            }
+        }
+        for (auto o : order) {
+            if (shape[o] != 1) {
+                keptOrder.push_back(newIndex[o]);
+            }
+        }
+    }
+    // Ascending runs of the output sequence are input-contiguous by
+    // construction, each run becomes one collapsed dim
+    std::vector<std::pair<std::size_t, std::size_t>> runs;  // {first input dim, merged extent}
+    for (std::size_t o = 0; o < keptOrder.size(); ++o) {
+        if (!runs.empty() && (keptOrder[o] == keptOrder[o - 1] + 1)) {
+            runs.back().second *= keptDims[keptOrder[o]];
+        } else {
+            runs.emplace_back(keptOrder[o], keptDims[keptOrder[o]]);
+        }
+    }
+    PermutePlan plan;
+    if (runs.empty()) {
+        plan.dims = {1};
+        plan.strides = {1};
+        plan.order = {0};
+        return plan;
+    }
+    std::vector<std::size_t> byInput(runs.size());
+    std::iota(byInput.begin(), byInput.end(), 0);
+    std::sort(byInput.begin(), byInput.end(), [&] (std::size_t a, std::size_t b) {
+        return runs[a].first < runs[b].first;
+    });
+    std::vector<std::size_t> inputPosition(runs.size());
+    plan.dims.resize(runs.size());
+    for (std::size_t pos = 0; pos < runs.size(); ++pos) {
+        inputPosition[byInput[pos]] = pos;
+        plan.dims[pos] = runs[byInput[pos]].second;
+    }
+    plan.strides.resize(runs.size());
+    std::size_t stride = 1;
+    for (auto pos = runs.size(); pos-- > 0;) {
+        plan.strides[pos] = stride;
+        stride *= plan.dims[pos];
+    }
+    plan.order.resize(runs.size());
+    for (std::size_t o = 0; o < runs.size(); ++o) {
+        plan.order[o] = inputPosition[o];
+    }
+    return plan;
+}
+
+// True when the plan is a batch of 2D transposes: identity on the leading
+// dims with only the last two swapped
+inline bool IsBatchedTranspose(const PermutePlan& plan) {
+    const auto rank = plan.order.size();
+    if (rank < 2) {
+        return false;
+    }
+    for (std::size_t d = 0; d + 2 < rank; ++d) {
+        if (plan.order[d] != d) {
+            return false;
+        }
+    }
+    return (plan.order[rank - 2] == rank - 1) && (plan.order[rank - 1] == rank - 2);
+}
+
+inline void Transpose4x4(const float* src, const std::size_t srcStride, float* dst, const std::size_t dstStride) {
+    const auto r0 = vld1q_f32(src);
+    const auto r1 = vld1q_f32(src + srcStride);
+    const auto r2 = vld1q_f32(src + 2 * srcStride);
+    const auto r3 = vld1q_f32(src + 3 * srcStride);
+    const auto t01 = vtrnq_f32(r0, r1);
+    const auto t23 = vtrnq_f32(r2, r3);
+    vst1q_f32(dst, vcombine_f32(vget_low_f32(t01.val[0]), vget_low_f32(t23.val[0])));
+    vst1q_f32(dst + dstStride, vcombine_f32(vget_low_f32(t01.val[1]), vget_low_f32(t23.val[1])));
+    vst1q_f32(dst + 2 * dstStride, vcombine_f32(vget_high_f32(t01.val[0]), vget_high_f32(t23.val[0])));
+    vst1q_f32(dst + 3 * dstStride, vcombine_f32(vget_high_f32(t01.val[1]), vget_high_f32(t23.val[1])));
+}
+
+// Batch of [rows, cols] -> [cols, rows] transposes; [begin, end) ranges over
+// (batch, output row tile) pairs, a tile being four output rows so 32-bit
+// elements move through 4x4 in-register transposes
+template <typename T>
+inline void batched_transpose(std::size_t begin, std::size_t end, const T* src, T* dst,
+                              const std::size_t rows, const std::size_t cols) {
+    const auto rowTiles = (cols + 3) / 4;
+    for (auto t = begin; t < end; ++t) {
+        const auto b = t / rowTiles;
+        const auto c0 = (t % rowTiles) * 4;
+        const auto cEnd = std::min(cols, c0 + 4);
+        const T* srcB = src + b * rows * cols;
+        T* dstB = dst + b * rows * cols;
+        std::size_t r = 0;
+        if ((sizeof(T) == 4) && ((cEnd - c0) == 4)) {
+            for (; r + 4 <= rows; r += 4) {
+                Transpose4x4(reinterpret_cast<const float*>(srcB + r * cols + c0), cols,
+                             reinterpret_cast<float*>(dstB + c0 * rows + r), rows);
+            }
+        }
+        for (auto c = c0; c < cEnd; ++c) {
+            for (auto rr = r; rr < rows; ++rr) {
+                dstB[c * rows + rr] = srcB[rr * cols + c];
+            }
+        }
+    }
+}
+
+// General collapsed permutation; [begin, end) ranges over output rows (all
+// output dims but the last), so writes stay contiguous and the reads follow
+// the permuted strides. A preserved innermost dim makes every row one memcpy
+template <typename T>
+inline void permute_rows(std::size_t begin, std::size_t end, const T* src, T* dst, const PermutePlan plan) {
+    const auto rank = plan.order.size();
+    const auto last = plan.order.back();
+    const auto lastDim = plan.dims[last];
+    const auto lastStride = plan.strides[last];
+    for (auto row = begin; row < end; ++row) {
+        auto rest = row;
+        std::size_t base = 0;
+        for (auto d = rank - 1; d-- > 0;) {
+            const auto in = plan.order[d];
+            base += (rest % plan.dims[in]) * plan.strides[in];
+            rest /= plan.dims[in];
+        }
+        T* dstRow = dst + row * lastDim;
+        if (lastStride == 1) {
+            std::memcpy(dstRow, src + base, lastDim * sizeof(T));
+        } else {
+            for (std::size_t j = 0; j < lastDim; ++j) {
+                dstRow[j] = src[base + j * lastStride];
+            }
+        }
+    }
+}
+
+}  // namespace neon
+}  // namespace ArmPlugin
+
+#endif  // defined(__aarch64__)
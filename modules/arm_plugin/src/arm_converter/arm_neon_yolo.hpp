@@ -0,0 +1,90 @@
+// Copyright (C) 2020-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#if defined(__aarch64__)
+
+#include <cmath>
+#include <cstddef>
+#include <cstring>
+
+#include "arm_neon_math.hpp"
+
+namespace ArmPlugin {
+namespace neon {
+
+// In-place logistic over a contiguous run, vexpq_f32 for the lanes and
+// libm for the tail
+inline void sigmoid_f32(float* data, std::size_t count) {
+    const float32x4_t one = vdupq_n_f32(1.f);
+    std::size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        const auto e = vexpq_f32(vnegq_f32(vld1q_f32(data + i)));
+        vst1q_f32(data + i, vdivq_f32(one, vaddq_f32(one, e)));
+    }
+    for (; i < count; ++i) {
+        data[i] = 1.f / (1.f + std::exp(-data[i]));
+    }
+}
+
+// RegionYolo over [begin, end) anchor blocks, one block per (batch, anchor)
+// pair so MakeParallelReference can spread the head across threads. A block
+// is the contiguous area * (coords + classes + 1) slab of one anchor: copy
+// it, squash x, y and the confidence entries (plus the class scores when the
+// softmax is off) through the logistic, then softmax the class scores across
+// the entry dimension four pixels at a time
+inline void region_yolo_f32(std::size_t begin, std::size_t end, const float* input, float* output,
+                            const std::size_t area, const std::size_t coords, const std::size_t classes,
+                            const std::size_t regions, const bool doSoftmax) {
+    const auto regionSize = area * (coords + classes + 1);
+    const auto confCount = doSoftmax ? area : area * (classes + 1);
+    for (std::size_t r = begin; r < end; ++r) {
+        const auto base = (r / regions) * regions * regionSize + (r % regions) * regionSize;
+        std::memcpy(output + base, input + base, regionSize * sizeof(float));
+        sigmoid_f32(output + base, 2 * area);
+        sigmoid_f32(output + base + coords * area, confCount);
+        if (!doSoftmax) {
+            continue;
+        }
+        const float* src = input + base + (coords + 1) * area;
+        float* dst = output + base + (coords + 1) * area;
+        std::size_t p = 0;
+        for (; p + 4 <= area; p += 4) {
+            auto max = vld1q_f32(src + p);
+            for (std::size_t c = 1; c < classes; ++c) {
+                max = vmaxq_f32(max, vld1q_f32(src + c * area + p));
+            }
+            auto sum = vdupq_n_f32(0.f);
+            for (std::size_t c = 0; c < classes; ++c) {
+                const auto e = vexpq_f32(vsubq_f32(vld1q_f32(src + c * area + p), max));
+                vst1q_f32(dst + c * area + p, e);
+                sum = vaddq_f32(sum, e);
+            }
+            for (std::size_t c = 0; c < classes; ++c) {
+                vst1q_f32(dst + c * area + p, vdivq_f32(vld1q_f32(dst + c * area + p), sum));
+            }
+        }
+        for (; p < area; ++p) {
+            float max = src[p];
+            for (std::size_t c = 1; c < classes; ++c) {
+                max = std::max(max, src[c * area + p]);
+            }
+            float sum = 0.f;
+            for (std::size_t c = 0; c < classes; ++c) {
+                const auto e = std::exp(src[c * area + p] - max);
+                dst[c * area + p] = e;
+                sum += e;
+            }
+            for (std::size_t c = 0; c < classes; ++c) {
+                dst[c * area + p] /= sum;
+            }
+        }
+    }
+}
+
+}  // namespace neon
+}  // namespace ArmPlugin
+
+#endif  // defined(__aarch64__)
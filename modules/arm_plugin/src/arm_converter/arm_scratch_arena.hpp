@@ -0,0 +1,103 @@
+// Copyright (C) 2020-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include <type_traits>
+
+namespace ArmPlugin {
+
+/**
+ * Bump allocator for the temporaries of reference-fallback callables, owned by
+ * the converter of one infer request. Layer functions run sequentially on the
+ * request pipeline, so a single unsynchronized arena serves them all; scopes
+ * rewind the cursor on exit, growth happens through extra blocks that are
+ * coalesced into one once the arena drains, so steady-state inference reuses a
+ * single block with no heap traffic. Allocate only outside parallel regions
+ */
+struct ScratchArena {
+    using Ptr = std::shared_ptr<ScratchArena>;
+
+    struct Scope {
+        explicit Scope(const Ptr& arena) : _arena{*arena}, _block{_arena._block}, _offset{_arena._offset} {}
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+        ~Scope() {
+            _arena.Rewind(_block, _offset);
+        }
+        template<typename T>
+        T* Allocate(const std::size_t count) {
+            static_assert(std::is_trivially_destructible<T>::value, "Arena memory is rewound, not destroyed");
+            return static_cast<T*>(_arena.Allocate(count * sizeof(T)));
+        }
+        ScratchArena&   _arena;
+        std::size_t     _block;
+        std::size_t     _offset;
+    };
+
+    // Conversion-time sizing hook: converters with shape-static scratch needs
+    // reserve them here, so the first inference already runs allocation-free
+    void Reserve(const std::size_t bytes) {
+        std::size_t total = 0;
+        for (auto&& block : _blocks) {
+            total += block._size;
+        }
+        if ((total < bytes) && (_block == 0) && (_offset == 0)) {
+            _blocks.clear();
+            _blocks.emplace_back(bytes);
+        }
+    }
+
+private:
+    struct Block {
+        explicit Block(const std::size_t bytes) :
+            _units{(std::max(bytes, minBytes) + sizeof(std::max_align_t) - 1) / sizeof(std::max_align_t)},
+            _data{std::make_unique<std::max_align_t[]>(_units)},
+            _size{_units * sizeof(std::max_align_t)} {}
+        std::size_t                         _units;
+        std::unique_ptr<std::max_align_t[]> _data;
+        std::size_t                         _size;
+    };
+
+    static constexpr std::size_t minBytes = 1 << 16;
+
+    void* Allocate(const std::size_t bytes) {
+        const auto aligned = (bytes + alignof(std::max_align_t) - 1) / alignof(std::max_align_t) * alignof(std::max_align_t);
+        while ((_block < _blocks.size()) && ((_blocks[_block]._size - _offset) < aligned)) {
+            ++_block;
+            _offset = 0;
+        }
+        if (_block == _blocks.size()) {
+            _blocks.emplace_back(std::max(aligned, _blocks.empty() ? minBytes : 2 * _blocks.back()._size));
+            _offset = 0;
+        }
+        auto* pointer = reinterpret_cast<std::uint8_t*>(_blocks[_block]._data.get()) + _offset;
+        _offset += aligned;
+        return pointer;
+    }
+
+    void Rewind(const std::size_t block, const std::size_t offset) {
+        _block = block;
+        _offset = offset;
+        if ((_block == 0) && (_offset == 0) && (_blocks.size() > 1)) {
+            std::size_t total = 0;
+            for (auto&& grown : _blocks) {
+                total += grown._size;
+            }
+            _blocks.clear();
+            _blocks.emplace_back(total);
+        }
+    }
+
+    std::vector<Block>  _blocks;
+    std::size_t         _block = 0;
+    std::size_t         _offset = 0;
+};
+
+}  // namespace ArmPlugin
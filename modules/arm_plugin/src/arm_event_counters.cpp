@@ -0,0 +1,22 @@
+// Copyright (C) 2020-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "arm_event_counters.hpp"
+
+using namespace ArmPlugin;
+
+EventCounters& EventCounters::Instance() {
+    static EventCounters counters;
+    return counters;
+}
+
+std::map<std::string, std::uint64_t> EventCounters::Snapshot() const {
+    return {
+        {"infer_started", _inferStarted.load(std::memory_order_relaxed)},
+        {"infer_completed", _inferCompleted.load(std::memory_order_relaxed)},
+        {"preprocess_us", _preprocessUs.load(std::memory_order_relaxed)},
+        {"execute_us", _executeUs.load(std::memory_order_relaxed)},
+        {"postprocess_us", _postprocessUs.load(std::memory_order_relaxed)},
+    };
+}
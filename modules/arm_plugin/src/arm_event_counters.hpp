@@ -0,0 +1,53 @@
+// Copyright (C) 2020-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <map>
+#include <string>
+
+namespace ArmPlugin {
+
+// Always-on hot-path event counters. Unlike the performance counters these
+// need no profiling mode: updates are relaxed atomic adds guarded by one
+// predictable branch, cheap enough for production, and a snapshot is scraped
+// through the EVENT_COUNTERS metric. The counters are process-wide so they
+// aggregate over every loaded network and infer request of the plugin.
+class EventCounters {
+public:
+    using Counter = std::atomic<std::uint64_t>;
+
+    static EventCounters& Instance();
+
+    // Adds value to the counter; with counting disabled the cost is the
+    // enabled check only
+    static void Add(Counter& counter, std::uint64_t value = 1) {
+        if (Instance()._enabled.load(std::memory_order_relaxed)) {
+            counter.fetch_add(value, std::memory_order_relaxed);
+        }
+    }
+
+    void SetEnabled(bool enabled) noexcept { _enabled.store(enabled, std::memory_order_relaxed); }
+
+    // Current counter values keyed by name
+    std::map<std::string, std::uint64_t> Snapshot() const;
+
+    // Inferences that entered preprocessing and inferences that completed
+    // postprocessing; batch-split replicas are not counted separately
+    Counter _inferStarted{0};
+    Counter _inferCompleted{0};
+    // Cumulative pipeline stage times in microseconds
+    Counter _preprocessUs{0};
+    Counter _executeUs{0};
+    Counter _postprocessUs{0};
+
+private:
+    EventCounters() = default;
+
+    std::atomic<bool> _enabled{true};
+};
+
+}  // namespace ArmPlugin
@@ -3,6 +3,7 @@
 //
 
 #include <set>
+#include <sstream>
 #include <utility>
 #include <algorithm>
 #include <memory>
@@ -13,26 +14,268 @@
 #include <ie_plugin_config.hpp>
 #include <ie_ngraph_utils.hpp>
 #include <threading/ie_executor_manager.hpp>
+#include <ie_system_conf.h>
 #include <ngraph/function.hpp>
+#include <ngraph/pass/manager.hpp>
+#include <openvino/pass/serialize.hpp>
 #include <ie_icore.hpp>
 
 #include <openvino/runtime/properties.hpp>
 
 #include "arm_plugin.hpp"
 #include "arm_executable_network.hpp"
+#include "arm_async_infer_request.hpp"
+#include "arm_ie_scheduler.hpp"
+#include "arm_event_counters.hpp"
 #include "arm_converter/arm_converter.hpp"
 
 using namespace InferenceEngine;
 using namespace ArmPlugin;
 using namespace InferenceEngine::PluginConfigParams;
 
+namespace {
+// Re-validates a copy of the transformed model for a 1/K batch. Returns null
+// when the network does not scale down: a dynamic or indivisible batch, or an
+// output whose batch is entangled in constants (e.g. a folded Reshape target)
+std::shared_ptr<ov::Model> splitBatchModel(const std::shared_ptr<const ov::Model>& model, const int splits) {
+    for (auto&& parameter : model->get_parameters()) {
+        const auto& shape = parameter->get_partial_shape();
+        if (shape.rank().is_dynamic() || (shape.rank().get_length() < 1) ||
+            shape[0].is_dynamic() || ((shape[0].get_length() % splits) != 0)) {
+            return nullptr;
+        }
+    }
+    auto splitModel = ov::clone_model(*model);
+    try {
+        for (auto&& parameter : splitModel->get_parameters()) {
+            auto shape = parameter->get_partial_shape();
+            shape[0] = shape[0].get_length() / splits;
+            parameter->set_partial_shape(shape);
+        }
+        splitModel->validate_nodes_and_infer_types();
+    } catch (...) {
+        return nullptr;
+    }
+    const auto& results = model->get_results();
+    const auto& splitResults = splitModel->get_results();
+    for (std::size_t i = 0; i < results.size(); ++i) {
+        const auto& shape = results[i]->get_output_partial_shape(0);
+        const auto& splitShape = splitResults[i]->get_output_partial_shape(0);
+        if (splitShape.rank().is_dynamic() || (splitShape.rank().get_length() < 1) ||
+            shape[0].is_dynamic() || splitShape[0].is_dynamic() ||
+            (shape[0].get_length() != (splitShape[0].get_length() * splits))) {
+            return nullptr;
+        }
+    }
+    return splitModel;
+}
+}  // namespace
+
 ArmPlugin::ExecutableNetwork::ExecutableNetwork(const std::shared_ptr<const ov::Model>&  model,
                                                 const Configuration&                     cfg,
                                                 const ArmPlugin::Plugin::Ptr&            plugin):
     ExecutableNetworkThreadSafeDefault{nullptr, nullptr},
     _model{model},
     _cfg{cfg},
-    _plugin{plugin} {
+    _plugin{plugin},
+    _weightsSharing{std::make_shared<Converter::WeightsSharing>()} {
+    if ((_cfg._dynamicShapeCacheCapacity > 0) && _model->is_dynamic()) {
+        // The untransformed model cannot be converted here; each shape
+        // specialization gets transformed and materialized on first use
+        _dynamic = true;
+        _cfg._batchSplit = 1;
+        InitExecutor();
+        return;
+    }
+    if (_cfg._batchSplit > 1) {
+        _splitModel = splitBatchModel(_model, _cfg._batchSplit);
+        if (_splitModel == nullptr) {
+            _cfg._batchSplit = 1;
+        }
+    }
+    // Materialize the immutable tensors once per network; creating an infer
+    // request then only allocates the mutable/intermediate tensors through its
+    // own lifetime/pool managers
+    Converter{_splitModel != nullptr ? _splitModel : _model, _cfg, _weightsSharing}.MaterializeConstants();
+    InitExecutor();
+}
+
+namespace {
+// XML serialization drops the plugin's runtime info entries, which carry the
+// fused quantization/activation parameters the converter consumes; they travel
+// in a binary sidecar next to the serialized transformed model
+const char* quantizationInfoKeys[] = {
+    "QuantizationInfo", "InputPrescaleInfo", "WeightsPrescaleInfo",
+    "Input0QuantizationInfo", "Input1QuantizationInfo"};
+const char* markerKeys[] = {"DataLayoutNHWC", "DisableFastMath"};
+
+void writeString(std::ostream& stream, const std::string& str) {
+    const auto size = static_cast<std::uint64_t>(str.size());
+    stream.write(reinterpret_cast<const char*>(&size), sizeof(size));
+    stream.write(str.c_str(), size);
+}
+
+std::string readString(std::istream& stream) {
+    std::uint64_t size = 0;
+    stream.read(reinterpret_cast<char*>(&size), sizeof(size));
+    std::string str(static_cast<std::size_t>(size), '\0');
+    stream.read(&str[0], size);
+    return str;
+}
+
+template<typename T>
+void writeVector(std::ostream& stream, const std::vector<T>& values) {
+    const auto size = static_cast<std::uint64_t>(values.size());
+    stream.write(reinterpret_cast<const char*>(&size), sizeof(size));
+    stream.write(reinterpret_cast<const char*>(values.data()), size * sizeof(T));
+}
+
+template<typename T>
+std::vector<T> readVector(std::istream& stream) {
+    std::uint64_t size = 0;
+    stream.read(reinterpret_cast<char*>(&size), sizeof(size));
+    std::vector<T> values(static_cast<std::size_t>(size));
+    stream.read(reinterpret_cast<char*>(values.data()), size * sizeof(T));
+    return values;
+}
+}  // namespace
+
+void ArmPlugin::ExecutableNetwork::Export(std::ostream& modelStream) {
+    std::stringstream xmlFile, binFile;
+    ngraph::pass::Manager manager;
+    manager.register_pass<ov::pass::Serialize>(xmlFile, binFile);
+    manager.run_passes(std::const_pointer_cast<ov::Model>(_model));
+    writeString(modelStream, xmlFile.str());
+    writeString(modelStream, binFile.str());
+
+    const char lpt = _cfg._lpt ? 1 : 0;
+    modelStream.write(&lpt, sizeof(lpt));
+
+    std::map<std::string, std::map<std::string, ov::Any>> rtEntries;
+    for (auto&& node : _model->get_ops()) {
+        auto& rtInfo = node->get_rt_info();
+        std::map<std::string, ov::Any> entries;
+        for (auto&& key : quantizationInfoKeys) {
+            auto it = rtInfo.find(key);
+            if (it != rtInfo.end()) entries.emplace(key, it->second);
+        }
+        for (auto&& key : markerKeys) {
+            auto it = rtInfo.find(key);
+            if (it != rtInfo.end()) entries.emplace(key, it->second);
+        }
+        for (auto&& key : {"ActivationLayerInfo", "ResultName"}) {
+            auto it = rtInfo.find(key);
+            if (it != rtInfo.end()) entries.emplace(key, it->second);
+        }
+        if (!entries.empty()) {
+            rtEntries.emplace(node->get_friendly_name(), std::move(entries));
+        }
+    }
+    const auto nodeCount = static_cast<std::uint64_t>(rtEntries.size());
+    modelStream.write(reinterpret_cast<const char*>(&nodeCount), sizeof(nodeCount));
+    for (auto&& node : rtEntries) {
+        writeString(modelStream, node.first);
+        const auto entryCount = static_cast<std::uint64_t>(node.second.size());
+        modelStream.write(reinterpret_cast<const char*>(&entryCount), sizeof(entryCount));
+        for (auto&& entry : node.second) {
+            writeString(modelStream, entry.first);
+            if (entry.first == "ActivationLayerInfo") {
+                auto info = entry.second.as<arm_compute::ActivationLayerInfo>();
+                const auto function = static_cast<std::int32_t>(info.activation());
+                const float a = info.a();
+                const float b = info.b();
+                modelStream.write(reinterpret_cast<const char*>(&function), sizeof(function));
+                modelStream.write(reinterpret_cast<const char*>(&a), sizeof(a));
+                modelStream.write(reinterpret_cast<const char*>(&b), sizeof(b));
+            } else if (entry.first == "ResultName") {
+                writeString(modelStream, entry.second.as<std::string>());
+            } else if ((entry.first == markerKeys[0]) || (entry.first == markerKeys[1])) {
+                // Markers carry no payload
+            } else {
+                auto info = entry.second.as<arm_compute::QuantizationInfo>();
+                writeVector(modelStream, info.scale());
+                writeVector(modelStream, info.offset());
+            }
+        }
+    }
+}
+
+ArmPlugin::ExecutableNetwork::ExecutableNetwork(std::istream&                  modelStream,
+                                                const Configuration&           cfg,
+                                                const ArmPlugin::Plugin::Ptr&  plugin):
+    ExecutableNetworkThreadSafeDefault{nullptr, nullptr},
+    _cfg{cfg},
+    _plugin{plugin},
+    _weightsSharing{std::make_shared<Converter::WeightsSharing>()} {
+    auto xmlString = readString(modelStream);
+    auto binString = readString(modelStream);
+    InferenceEngine::Blob::Ptr dataBlob;
+    if (!binString.empty()) {
+        dataBlob = InferenceEngine::make_shared_blob<std::uint8_t>(InferenceEngine::TensorDesc(
+            InferenceEngine::Precision::U8, {binString.size()}, InferenceEngine::Layout::C));
+        dataBlob->allocate();
+        std::copy(binString.begin(), binString.end(), dataBlob->buffer().as<char*>());
+    }
+    auto cnnNetwork = plugin->GetCore()->ReadNetwork(xmlString, dataBlob);
+    auto model = cnnNetwork.getFunction();
+    IE_ASSERT(model != nullptr);
+
+    char lpt = 0;
+    modelStream.read(&lpt, sizeof(lpt));
+    _cfg._lpt = (lpt != 0);
+
+    std::map<std::string, std::shared_ptr<ngraph::Node>> nodesByName;
+    for (auto&& node : model->get_ops()) {
+        nodesByName.emplace(node->get_friendly_name(), node);
+    }
+    std::uint64_t nodeCount = 0;
+    modelStream.read(reinterpret_cast<char*>(&nodeCount), sizeof(nodeCount));
+    for (std::uint64_t i = 0; i < nodeCount; ++i) {
+        auto nodeName = readString(modelStream);
+        auto itNode = nodesByName.find(nodeName);
+        IE_ASSERT(itNode != nodesByName.end()) << "Arm Plugin: Imported blob refers to unknown node " << nodeName;
+        auto& rtInfo = itNode->second->get_rt_info();
+        std::uint64_t entryCount = 0;
+        modelStream.read(reinterpret_cast<char*>(&entryCount), sizeof(entryCount));
+        for (std::uint64_t e = 0; e < entryCount; ++e) {
+            auto key = readString(modelStream);
+            if (key == "ActivationLayerInfo") {
+                std::int32_t function = 0;
+                float a = 0.f, b = 0.f;
+                modelStream.read(reinterpret_cast<char*>(&function), sizeof(function));
+                modelStream.read(reinterpret_cast<char*>(&a), sizeof(a));
+                modelStream.read(reinterpret_cast<char*>(&b), sizeof(b));
+                rtInfo[key] = arm_compute::ActivationLayerInfo{
+                    static_cast<arm_compute::ActivationLayerInfo::ActivationFunction>(function), a, b};
+            } else if (key == "ResultName") {
+                rtInfo[key] = readString(modelStream);
+            } else if ((key == markerKeys[0]) || (key == markerKeys[1])) {
+                rtInfo[key] = "";
+            } else {
+                auto scales = readVector<float>(modelStream);
+                auto offsets = readVector<std::int32_t>(modelStream);
+                rtInfo[key] = arm_compute::QuantizationInfo{scales, offsets};
+            }
+        }
+    }
+
+    setNetworkInputs(cnnNetwork.getInputsInfo());
+    setNetworkOutputs(cnnNetwork.getOutputsInfo());
+    SetPointerToPlugin(plugin->shared_from_this());
+    _model = model;
+    if ((_cfg._dynamicShapeCacheCapacity > 0) && _model->is_dynamic()) {
+        _dynamic = true;
+        _cfg._batchSplit = 1;
+        InitExecutor();
+        return;
+    }
+    if (_cfg._batchSplit > 1) {
+        _splitModel = splitBatchModel(_model, _cfg._batchSplit);
+        if (_splitModel == nullptr) {
+            _cfg._batchSplit = 1;
+        }
+    }
+    Converter{_splitModel != nullptr ? _splitModel : _model, _cfg, _weightsSharing}.MaterializeConstants();
     InitExecutor();
 }
 
@@ -41,6 +284,17 @@ void ArmPlugin::ExecutableNetwork::InitExecutor() {
         _cfg._streamsExecutorConfig._streams = std::thread::hardware_concurrency();
         _cfg._streamsExecutorConfig._threadsPerStream = 1;
         _cfg._streamsExecutorConfig._threadPreferredCoreType = _cfg._streamsExecutorConfig.PreferredCoreType::ROUND_ROBIN;
+        if (_cfg._streamsExecutorConfig._threadBindingType == InferenceEngine::IStreamsExecutor::NONE) {
+            // Partition the streams over the topology: on multi-socket machines
+            // pin every stream inside one NUMA node so its ACL scheduler threads
+            // never cross the interconnect; on big.LITTLE designs keep a stream
+            // inside one core cluster
+            if (InferenceEngine::getAvailableNUMANodes().size() > 1) {
+                _cfg._streamsExecutorConfig._threadBindingType = InferenceEngine::IStreamsExecutor::NUMA;
+            } else if (InferenceEngine::getAvailableCoresTypes().size() > 1) {
+                _cfg._streamsExecutorConfig._threadBindingType = InferenceEngine::IStreamsExecutor::HYBRID_AWARE;
+            }
+        }
     } else if (_cfg._perfHint == ov::hint::PerformanceMode::LATENCY) {
         _cfg._streamsExecutorConfig._streams = 1;
         _cfg._streamsExecutorConfig._threadPreferredCoreType = _cfg._streamsExecutorConfig.PreferredCoreType::BIG;
@@ -51,10 +305,178 @@ void ArmPlugin::ExecutableNetwork::InitExecutor() {
     } else {
         auto streamsExecutorConfig = InferenceEngine::IStreamsExecutor::Config::MakeDefaultMultiThreaded(_cfg._streamsExecutorConfig);
         streamsExecutorConfig._name = "CPUStreamsExecutor";
-        streamsExecutorConfig._threadBindingType = InferenceEngine::IStreamsExecutor::NONE;
+        streamsExecutorConfig._threadBindingType = _cfg._streamsExecutorConfig._threadBindingType;
         _taskExecutor = InferenceEngine::executorManager()->getIdleCPUStreamsExecutor(streamsExecutorConfig);
     }
     _executor = _taskExecutor.get();
+    _ioExecutor = InferenceEngine::executorManager()->getIdleCPUStreamsExecutor({"ArmIOExecutor"});
+    _callbackExecutor = InferenceEngine::executorManager()->getIdleCPUStreamsExecutor({"ArmCallbackExecutor"});
+    if (_cfg._batchSplit > 1) {
+        _batchExecutor = InferenceEngine::executorManager()->getIdleCPUStreamsExecutor(
+            {"ArmBatchSplitExecutor", _cfg._batchSplit});
+    }
+    // First LoadNetwork calibrates the scheduler's inline-dispatch gate, so
+    // tiny kernel windows skip the pool rendezvous at inference time
+    if (auto scheduler = dynamic_cast<IEScheduler*>(&arm_compute::Scheduler::get())) {
+        scheduler->CalibrateInlineThreshold();
+    }
+}
+
+namespace {
+// Records every region the pool manager requests while still backing it with
+// real memory, so the measurement pass can observe the final tensor offsets;
+// everything is freed again when the measurement managers go out of scope
+struct CountingAllocator final : public arm_compute::IAllocator {
+    void* allocate(std::size_t size, std::size_t alignment) override {
+        _sizes.push_back(size);
+        return _base.allocate(size, alignment);
+    }
+    void free(void* ptr) override {
+        _base.free(ptr);
+    }
+    std::unique_ptr<arm_compute::IMemoryRegion> make_region(std::size_t size, std::size_t alignment) override {
+        _sizes.push_back(size);
+        return _base.make_region(size, alignment);
+    }
+    arm_compute::Allocator      _base;
+    std::vector<std::size_t>    _sizes;
+};
+
+// Drives the converter through the same lifetime/pool managers an infer
+// request builds, without creating a request: the pool the offset manager
+// computes is exactly what every request of this network allocates, and its
+// size already is the peak concurrent usage since overlapping lifetimes are
+// packed side by side
+std::string reportMemoryFootprint(const std::shared_ptr<const ov::Model>& model,
+                                  const Configuration& cfg,
+                                  const Converter::WeightsSharing::Ptr& weightsSharing) {
+    auto lifetime = std::make_shared<arm_compute::OffsetLifetimeManager>();
+    auto pool = std::make_shared<arm_compute::PoolManager>();
+    auto memoryManager = std::make_shared<arm_compute::MemoryManagerOnDemand>(lifetime, pool);
+    arm_compute::MemoryGroup memoryGroup{memoryManager};
+    auto layers = Converter{model, cfg, weightsSharing}.Configure(memoryManager, memoryGroup);
+    CountingAllocator allocator;
+    memoryManager->populate(allocator, 1);
+    std::size_t poolBytes = 0;
+    for (auto&& size : allocator._sizes) {
+        poolBytes += size;
+    }
+
+    // Producer and last-consumer positions in execution order approximate the
+    // interval each intermediate tensor occupies its pool region for
+    std::map<ngraph::Node*, std::size_t> order;
+    std::size_t position = 0;
+    auto orderedOps = model->get_ordered_ops();
+    for (auto&& node : orderedOps) {
+        order.emplace(node.get(), position++);
+    }
+
+    struct TensorRecord {
+        std::string         _name;
+        const std::uint8_t* _buffer;
+        std::size_t         _bytes;
+        std::size_t         _producedAt;
+        std::size_t         _lastUsedAt;
+    };
+    std::vector<TensorRecord> records;
+    {
+        // Binding the group maps every managed tensor into the pool, making
+        // the final offsets observable; unmanaged (I/O) tensors stay unmapped
+        // and are skipped
+        arm_compute::MemoryGroupResourceScope scope{memoryGroup};
+        for (auto&& node : orderedOps) {
+            if (ngraph::op::is_constant(node) || ngraph::op::is_parameter(node) || ngraph::op::is_output(node)) {
+                continue;
+            }
+            auto itLayer = layers.find(node->get_instance_id());
+            if (itLayer == layers.end()) {
+                continue;
+            }
+            for (auto&& output : node->outputs()) {
+                auto itTensor = itLayer->second._outputs.find(output);
+                if (itTensor == itLayer->second._outputs.end() || (itTensor->second._tensor == nullptr)) {
+                    continue;
+                }
+                const auto* buffer = itTensor->second._tensor->buffer();
+                if (buffer == nullptr) {
+                    continue;
+                }
+                auto lastUsedAt = order.at(node.get());
+                for (auto&& target : output.get_target_inputs()) {
+                    lastUsedAt = std::max(lastUsedAt, order.at(target.get_node()));
+                }
+                records.emplace_back(TensorRecord{node->get_friendly_name() + ":" + std::to_string(output.get_index()),
+                                                  buffer,
+                                                  itTensor->second._tensor->info()->total_size(),
+                                                  order.at(node.get()),
+                                                  lastUsedAt});
+            }
+        }
+    }
+    const std::uint8_t* base = nullptr;
+    for (auto&& record : records) {
+        base = ((base == nullptr) || (record._buffer < base)) ? record._buffer : base;
+    }
+    std::ostringstream report;
+    report << "pool: " << poolBytes << " bytes in " << allocator._sizes.size()
+           << " region(s), peak usage " << poolBytes << " bytes\n";
+    for (auto&& record : records) {
+        report << record._name << ": offset " << (record._buffer - base)
+               << ", size " << record._bytes
+               << ", lifetime [" << record._producedAt << ", " << record._lastUsedAt << "]\n";
+    }
+    return report.str();
+}
+}  // namespace
+
+ShapeSpecialization::Ptr
+ArmPlugin::ExecutableNetwork::GetShapeSpecialization(const std::map<std::string, ngraph::PartialShape>& shapes) {
+    std::string signature;
+    for (auto&& shape : shapes) {
+        signature += shape.first + ':' + shape.second.to_string() + ' ';
+    }
+    std::lock_guard<std::mutex> lock{_specializationsMutex};
+    for (auto it = _specializations.begin(); it != _specializations.end(); ++it) {
+        if (it->first == signature) {
+            _specializations.splice(_specializations.begin(), _specializations, it);
+            return _specializations.front().second;
+        }
+    }
+    auto specializedModel = ov::clone_model(*_model);
+    for (auto&& parameter : specializedModel->get_parameters()) {
+        auto itShape = shapes.find(parameter->get_friendly_name());
+        if (itShape != shapes.end()) {
+            parameter->set_partial_shape(itShape->second);
+        }
+    }
+    specializedModel->validate_nodes_and_infer_types();
+    if (specializedModel->is_dynamic()) {
+        IE_THROW() << "Arm Plugin: input shapes " << signature << "do not make the network static";
+    }
+    auto specialization = std::make_shared<ShapeSpecialization>();
+    // The deferred transformation pipeline runs here, over a now-static clone
+    specialization->_model = _plugin->Transform(specializedModel, _cfg);
+    specialization->_weightsSharing = std::make_shared<Converter::WeightsSharing>();
+    Converter{specialization->_model, _cfg, specialization->_weightsSharing}.MaterializeConstants();
+    _specializations.emplace_front(signature, specialization);
+    while (_specializations.size() > static_cast<std::size_t>(_cfg._dynamicShapeCacheCapacity)) {
+        _specializations.pop_back();
+    }
+    return specialization;
+}
+
+InferenceEngine::IInferRequestInternal::Ptr ArmPlugin::ExecutableNetwork::CreateInferRequest() {
+    InferenceEngine::IInferRequestInternal::Ptr internalRequest;
+    if (this->_plugin && this->_plugin->GetCore() && this->_plugin->GetCore()->isNewAPI()) {
+        internalRequest = CreateInferRequestImpl(_parameters, _results);
+    }
+    if (!internalRequest) {
+        internalRequest = CreateInferRequestImpl(_networkInputs, _networkOutputs);
+    }
+    return std::make_shared<ArmAsyncInferRequest>(std::static_pointer_cast<ArmInferRequest>(internalRequest),
+                                                  _ioExecutor,
+                                                  _taskExecutor,
+                                                  _callbackExecutor);
 }
 
 InferenceEngine::IInferRequestInternal::Ptr
@@ -87,7 +509,28 @@ InferenceEngine::Parameter ArmPlugin::ExecutableNetwork::GetMetric(const std::st
             ov::supported_properties.name(),
             ov::inference_num_threads.name(),
             ov::streams::num.name(),
-            METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)});
+            METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS),
+            CONFIG_KEY_INTERNAL(MEMORY_FOOTPRINT),
+            CONFIG_KEY_INTERNAL(EVENT_COUNTERS)});
+    } else if (CONFIG_KEY_INTERNAL(EVENT_COUNTERS) == name) {
+        return {EventCounters::Instance().Snapshot()};
+    } else if (CONFIG_KEY_INTERNAL(MEMORY_FOOTPRINT) == name) {
+        if (_dynamic) {
+            // Each cached specialization has its own pool; report the ones
+            // built so far under their shape signatures
+            std::lock_guard<std::mutex> lock{_specializationsMutex};
+            if (_specializations.empty()) {
+                return std::string{"no shape specialization built yet\n"};
+            }
+            std::string report;
+            for (auto&& specialization : _specializations) {
+                report += specialization.first + "\n" +
+                          reportMemoryFootprint(specialization.second->_model, _cfg,
+                                                specialization.second->_weightsSharing);
+            }
+            return report;
+        }
+        return reportMemoryFootprint(_splitModel != nullptr ? _splitModel : _model, _cfg, _weightsSharing);
     } else if (METRIC_KEY(SUPPORTED_CONFIG_KEYS) == name) {
         std::vector<std::string> configKeys;
         IE_SET_METRIC_RETURN(SUPPORTED_CONFIG_KEYS, configKeys);
@@ -5,7 +5,9 @@
 #pragma once
 
 #include <utility>
+#include <list>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <vector>
 #include <map>
@@ -20,10 +22,24 @@ namespace ArmPlugin {
 
 class Plugin;
 
+// One shape-specialized compilation of a dynamic network: the model
+// transformed for a concrete input signature plus the constants and
+// ACL-packed weights every infer pipeline built over it shares
+struct ShapeSpecialization {
+    using Ptr = std::shared_ptr<ShapeSpecialization>;
+    std::shared_ptr<const ov::Model>    _model;
+    Converter::WeightsSharing::Ptr      _weightsSharing;
+};
+
 struct ExecutableNetwork : public InferenceEngine::ExecutableNetworkThreadSafeDefault {
     ExecutableNetwork(const std::shared_ptr<const ov::Model>&  model,
                       const Configuration&           cfg,
                       const std::shared_ptr<Plugin>& plugin);
+    // Restores a network exported with Export: the transformed model comes out
+    // of the blob, so loading skips the whole transformation pipeline
+    ExecutableNetwork(std::istream&                  modelStream,
+                      const Configuration&           cfg,
+                      const std::shared_ptr<Plugin>& plugin);
 
     InferenceEngine::IInferRequestInternal::Ptr
     CreateInferRequestImpl(InferenceEngine::InputsDataMap networkInputs,
@@ -31,16 +47,42 @@ struct ExecutableNetwork : public InferenceEngine::ExecutableNetworkThreadSafeDe
     InferenceEngine::IInferRequestInternal::Ptr
     CreateInferRequestImpl(const std::vector<std::shared_ptr<const ov::Node>>& inputs,
                            const std::vector<std::shared_ptr<const ov::Node>>& outputs) override;
+    InferenceEngine::IInferRequestInternal::Ptr CreateInferRequest() override;
     InferenceEngine::Parameter GetMetric(const std::string& name) const override;
     InferenceEngine::Parameter GetConfig(const std::string& name) const override;
     std::shared_ptr<ov::Model> GetExecGraphInfo() override;
+    void Export(std::ostream& modelStream) override;
 
     void InitExecutor();
+    // Returns the cached specialization of the dynamic model for the given
+    // parameter shapes, building and transforming one on a miss; the least
+    // recently used entry is evicted past the configured capacity, though
+    // requests still running over it keep it alive through their shared_ptr
+    ShapeSpecialization::Ptr GetShapeSpecialization(const std::map<std::string, ngraph::PartialShape>& shapes);
 
     std::shared_ptr<const ov::Model>                        _model;
+    // Batch-split mode: the transformed model re-validated for a 1/K batch;
+    // every infer request runs K replicated pipelines over this single model
+    // instance, so their packed weights land in the shared constants. Null
+    // when the mode is off or the network does not scale down
+    std::shared_ptr<const ov::Model>                        _splitModel;
     Configuration                                           _cfg;
     std::shared_ptr<Plugin>                                 _plugin;
+    // Constant tensors and their ACL-packed copies, prepared once per network
+    // and shared read-only by all its infer requests
+    Converter::WeightsSharing::Ptr                          _weightsSharing;
     std::atomic_int                                         _requestId = {0};
     InferenceEngine::ITaskExecutor*                         _executor = nullptr;
+    // Runs the pre/postprocessing pipeline stages so the blob conversions of
+    // one request overlap the layer execution of another on _taskExecutor
+    InferenceEngine::ITaskExecutor::Ptr                     _ioExecutor;
+    // Runs the batch-split replicas of a single request concurrently
+    InferenceEngine::ITaskExecutor::Ptr                     _batchExecutor;
+    // Dynamic-shape mode: _model stays untransformed and every infer request
+    // builds its pipeline lazily over the specialization matching its blobs
+    bool                                                    _dynamic = false;
+    mutable std::mutex                                      _specializationsMutex;
+    // Most recently used specializations first, keyed by shape signature
+    std::list<std::pair<std::string, ShapeSpecialization::Ptr>> _specializations;
 };
 }  // namespace ArmPlugin
@@ -2,6 +2,10 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <atomic>
+#include <chrono>
+#include <limits>
+
 #include <ie_parallel.hpp>
 #include <ie_common.h>
 
@@ -9,6 +13,20 @@
 
 using namespace ArmPlugin;
 
+namespace {
+template <typename Callable>
+std::int64_t MinTimeNs(int repeats, Callable&& callable) {
+    auto best = std::numeric_limits<std::int64_t>::max();
+    for (int i = 0; i < repeats; ++i) {
+        const auto start = std::chrono::steady_clock::now();
+        callable();
+        best = std::min(best, std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                  std::chrono::steady_clock::now() - start).count());
+    }
+    return best;
+}
+}  // namespace
+
 IEScheduler::IEScheduler() {}
 IEScheduler::~IEScheduler() {}
 void IEScheduler::set_num_threads(unsigned int num_threads) {}
@@ -35,7 +53,10 @@ void IEScheduler::Schedule(arm_compute::ICPPKernel* kernel,
     if (num_iterations == 0) {
         return;
     }
-    if (!kernel->is_parallelisable()) {
+    // Sub-threshold windows run inline on the calling thread: for
+    // microsecond-scale kernels the pool rendezvous costs more than the work
+    if (!kernel->is_parallelisable() ||
+        (max_window.num_iterations_total() <= _inlineIterations.load(std::memory_order_relaxed))) {
         arm_compute::ThreadInfo info;
         info.cpu_info = &cpu_info();
         if (tensors.empty()) {
@@ -57,20 +78,45 @@ void IEScheduler::Schedule(arm_compute::ICPPKernel* kernel,
                 IE_ASSERT(!"Unknown strategy");
             }
         }
-        InferenceEngine::parallel_for(num_windows, [&] (int workloadId) {
-            arm_compute::ThreadInfo   info;
-            info.cpu_info       = &cpu_info();
-            info.num_threads    = parallel_get_num_threads();
-            info.thread_id      = parallel_get_thread_num();
-            auto win = max_window.split_window(splitDimension, workloadId, num_windows);
-            win.validate();
-            if (tensors.empty()) {
-                kernel->run(win, info);
-            } else {
-                kernel->run_op(tensors, win, info);
+        std::vector<arm_compute::IScheduler::Workload> workloads(num_windows);
+        for (int workloadId = 0; workloadId < num_windows; ++workloadId) {
+            workloads[workloadId] = [&, workloadId] (const arm_compute::ThreadInfo& info) {
+                auto win = max_window.split_window(splitDimension, workloadId, num_windows);
+                win.validate();
+                if (tensors.empty()) {
+                    kernel->run(win, info);
+                } else {
+                    kernel->run_op(tensors, win, info);
+                }
+            };
+        }
+        run_workloads(workloads);
+    }
+}
+
+void IEScheduler::CalibrateInlineThreshold() {
+    std::call_once(_calibrated, [this] {
+        // What one pool dispatch costs: an empty workload set still pays the
+        // full fork/join rendezvous
+        std::vector<arm_compute::IScheduler::Workload> workloads(
+            std::max(parallel_get_max_threads(), 1), [] (const arm_compute::ThreadInfo&) {});
+        const auto rendezvousNs = MinTimeNs(16, [&] {
+            run_workloads(workloads);
+        });
+        // What one window iteration roughly costs: a dependent op on
+        // cache-resident data, kept observable through the volatile sink
+        constexpr std::size_t probeIterations = 1 << 14;
+        volatile float sink = 0.f;
+        const auto probeNs = MinTimeNs(16, [&] {
+            float accumulator = sink;
+            for (std::size_t i = 0; i < probeIterations; ++i) {
+                accumulator += static_cast<float>(i & 7);
             }
+            sink = accumulator;
         });
-    }
+        const auto threshold = (rendezvousNs * probeIterations) / std::max<std::int64_t>(probeNs, 1);
+        _inlineIterations = std::min<std::size_t>(std::max<std::int64_t>(threshold, 128), 1 << 16);
+    });
 }
 
 void IEScheduler::schedule(arm_compute::ICPPKernel* kernel, const arm_compute::IScheduler::Hints& hints) {
@@ -86,12 +132,19 @@ void IEScheduler::schedule_op(arm_compute::ICPPKernel*  kernel,
 }
 
 void IEScheduler::run_workloads(std::vector<arm_compute::IScheduler::Workload>& workloads) {
-    InferenceEngine::parallel_for(workloads.size(), [&] (int workloadId) {
+    std::atomic<std::size_t> feeder{0};
+    const auto numSlots = std::min<std::size_t>(parallel_get_num_threads(), workloads.size());
+    InferenceEngine::parallel_for(numSlots, [&] (std::size_t) {
         arm_compute::ThreadInfo   info;
         info.cpu_info       = &cpu_info();
         info.num_threads    = parallel_get_num_threads();
         info.thread_id      = parallel_get_thread_num();
-        workloads[workloadId](info);
+        // Work stealing over a shared feed: a thread done with its ragged
+        // window early pulls the next pending workload instead of idling
+        // at the kernel barrier until the slowest one finishes
+        for (auto next = feeder.fetch_add(1); next < workloads.size(); next = feeder.fetch_add(1)) {
+            workloads[next](info);
+        }
     });
 }
 
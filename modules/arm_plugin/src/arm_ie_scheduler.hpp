@@ -4,6 +4,10 @@
 
 #pragma once
 
+#include <atomic>
+#include <cstddef>
+#include <mutex>
+
 #include <arm_compute/runtime/Scheduler.h>
 #include <arm_compute/core/CPP/ICPPKernel.h>
 #include <arm_compute/core/ITensorPack.h>
@@ -12,6 +16,13 @@ namespace ArmPlugin {
 struct IEScheduler final : public arm_compute::IScheduler {
     IEScheduler();
     ~IEScheduler() override;
+    /**
+     * Measures the pool rendezvous against a cache-resident iteration once and
+     * derives the window size below which dispatching to the pool costs more
+     * than running the kernel on the calling thread. Called at LoadNetwork;
+     * until then a conservative default gates the inline path
+     */
+    void CalibrateInlineThreshold();
     void set_num_threads(unsigned int num_threads) override;
     std::uint32_t num_threads() const override;
     void Schedule(arm_compute::ICPPKernel*               kernel,
@@ -24,5 +35,8 @@ struct IEScheduler final : public arm_compute::IScheduler {
                      const arm_compute::Window&             window,
                      arm_compute::ITensorPack&              tensors) override;
     void run_workloads(std::vector<arm_compute::IScheduler::Workload>& workloads) override;
+
+    std::once_flag                  _calibrated;
+    std::atomic<std::size_t>        _inlineIterations{256};
 };
 }  //  namespace ArmPlugin
@@ -5,6 +5,7 @@
 
 #include <utility>
 #include <algorithm>
+#include <iomanip>
 #include <memory>
 #include <string>
 #include <map>
@@ -22,6 +23,9 @@
 #include "arm_infer_request.hpp"
 #include "arm_executable_network.hpp"
 #include "arm_plugin.hpp"
+#include "arm_converter/arm_neon_convert.hpp"
+#include "arm_trace_export.hpp"
+#include "arm_event_counters.hpp"
 
 
 using namespace ArmPlugin;
@@ -32,22 +36,96 @@ using Time = std::chrono::high_resolution_clock;
 using ns = std::chrono::nanoseconds;
 using fsec = std::chrono::duration<float>;
 
+namespace {
+// Measures one pipeline stage: feeds the cumulative stage counter, counts a
+// completion if asked to, and traces the stage as a complete span on the
+// executor thread that ran it, so the trace shows how the stages of
+// concurrent requests overlap
+struct StageSpan {
+    StageSpan(bool trace,
+              std::string name,
+              EventCounters::Counter* cumulativeUs,
+              EventCounters::Counter* completions = nullptr) :
+        _trace{trace},
+        _name{std::move(name)},
+        _cumulativeUs{cumulativeUs},
+        _completions{completions},
+        _begin{TraceExport::NowUs()} {}
+    ~StageSpan() {
+        if (_cumulativeUs != nullptr) {
+            EventCounters::Add(*_cumulativeUs, TraceExport::NowUs() - _begin);
+        }
+        if (_completions != nullptr) {
+            EventCounters::Add(*_completions);
+        }
+        if (_trace) {
+            TraceExport::Instance().CompleteEvent(_name, "stage", _begin);
+        }
+    }
+    bool                    _trace;
+    std::string             _name;
+    EventCounters::Counter* _cumulativeUs;
+    EventCounters::Counter* _completions;
+    std::uint64_t           _begin;
+};
+}  // namespace
+
 ArmInferRequest::ArmInferRequest(const InferenceEngine::InputsDataMap&                networkInputs,
                                  const InferenceEngine::OutputsDataMap&               networkOutputs,
                                  const std::shared_ptr<ArmPlugin::ExecutableNetwork>& executableNetwork) :
     IInferRequestInternal(networkInputs, networkOutputs) {
-    InitArmInferRequest(executableNetwork);
+    InitArmInferRequest(executableNetwork, nullptr);
 }
 
 ArmInferRequest::ArmInferRequest(const std::vector<std::shared_ptr<const ov::Node>>& networkInputs,
                                  const std::vector<std::shared_ptr<const ov::Node>>& networkOutputs,
                                  const std::shared_ptr<ArmPlugin::ExecutableNetwork>& executableNetwork) :
     IInferRequestInternal(networkInputs, networkOutputs) {
-    InitArmInferRequest(executableNetwork);
+    InitArmInferRequest(executableNetwork, nullptr);
+}
+
+ArmInferRequest::ArmInferRequest(const InferenceEngine::InputsDataMap&                networkInputs,
+                                 const InferenceEngine::OutputsDataMap&               networkOutputs,
+                                 const std::shared_ptr<ArmPlugin::ExecutableNetwork>& executableNetwork,
+                                 const std::shared_ptr<const ov::Model>&              model) :
+    IInferRequestInternal(networkInputs, networkOutputs) {
+    InitArmInferRequest(executableNetwork, model);
 }
 
-void ArmInferRequest::InitArmInferRequest(const std::shared_ptr<ArmPlugin::ExecutableNetwork>& executableNetwork) {
+void ArmInferRequest::InitArmInferRequest(const std::shared_ptr<ArmPlugin::ExecutableNetwork>& executableNetwork,
+                                          const std::shared_ptr<const ov::Model>& subModel) {
     _executableNetwork = executableNetwork;
+    _requestID = std::to_string(_executableNetwork->_requestId.fetch_add(1));
+    // Batch-split replicas run the same pipeline stages as their parent;
+    // counting them too would multiply every event by the split factor
+    _countEvents = (subModel == nullptr);
+    if (!_executableNetwork->_cfg._traceExportFile.empty()) {
+        TraceExport::Instance().Enable(_executableNetwork->_cfg._traceExportFile);
+        _trace = TraceExport::Instance().Enabled();
+    }
+    if ((subModel == nullptr) && (_executableNetwork->_cfg._batchSplit > 1)) {
+        InitBatchSplit();
+        return;
+    }
+    if ((subModel == nullptr) && _executableNetwork->_dynamic) {
+        // The pipeline is built at the first inference, once the blobs pin
+        // down concrete input shapes
+        _dynamic = true;
+        return;
+    }
+    const auto& model = (subModel != nullptr) ? subModel : _executableNetwork->_model;
+    BuildPipeline(model, _executableNetwork->_weightsSharing, _networkInputs, _networkOutputs);
+}
+
+void ArmInferRequest::BuildPipeline(const std::shared_ptr<const ov::Model>&    model,
+                                    const Converter::WeightsSharing::Ptr&      weightsSharing,
+                                    const InferenceEngine::InputsDataMap&      networkInputs,
+                                    const InferenceEngine::OutputsDataMap&     networkOutputs) {
+    _memoryGroupScope.reset();
+    _memoryGroup.reset();
+    _layers.clear();
+    _inputInfo.clear();
+    _outputInfo.clear();
 #if 1
     _lifetime = std::make_shared<arm_compute::OffsetLifetimeManager>();
 #else
@@ -57,12 +135,12 @@ void ArmInferRequest::InitArmInferRequest(const std::shared_ptr<ArmPlugin::Execu
     _memoryManager = std::make_shared<arm_compute::MemoryManagerOnDemand>(_lifetime, _pool);
     _memoryGroup = std::make_unique<arm_compute::MemoryGroup>(_memoryManager);
 
-    auto requestID = std::to_string(_executableNetwork->_requestId.fetch_add(1));
     Layer::Map layers;
     IE_ASSERT(_executableNetwork->_executor != nullptr);
     _executableNetwork->_executor->runAndWait({
         [&] {
-            layers = Converter{_executableNetwork->_model, _executableNetwork->_cfg}.Configure(_memoryManager, *_memoryGroup);
+            layers = Converter{model, _executableNetwork->_cfg,
+                               weightsSharing}.Configure(_memoryManager, *_memoryGroup);
         }
     });
     auto allocateMemory = [] (const auto& blobName, const auto& blobDataMap, auto& blobs, auto tensor, auto output) {
@@ -102,13 +180,13 @@ void ArmInferRequest::InitArmInferRequest(const std::shared_ptr<ArmPlugin::Execu
         }
         return networkBlob;
     };
-    for (auto&& node : _executableNetwork->_model->get_parameters()) {
+    for (auto&& node : model->get_parameters()) {
         auto nodeName = node->get_friendly_name();
         IE_ASSERT(node->outputs().size() == 1);
         for (auto&& output : node->outputs()) {
             auto tensor = layers.at(node->get_instance_id())._outputs.at(output)._tensor.get();
-            auto str = _executableNetwork->_model->get_friendly_name() + "_" +
-                     requestID + "_preprocessing_" +
+            auto str = model->get_friendly_name() + "_" +
+                     _requestID + "_preprocessing_" +
                      node->get_friendly_name() + "_" +
                      std::to_string(node->get_instance_id());
             _inputInfo.emplace_back(IOInfo{
@@ -116,7 +194,7 @@ void ArmInferRequest::InitArmInferRequest(const std::shared_ptr<ArmPlugin::Execu
                 tensor,
                 openvino::itt::handle(str),
                 allocateMemory(nodeName,
-                               _networkInputs,
+                               networkInputs,
                                _inputs,
                                tensor,
                                output),
@@ -125,14 +203,14 @@ void ArmInferRequest::InitArmInferRequest(const std::shared_ptr<ArmPlugin::Execu
         }
     }
 
-    for (auto&& node : _executableNetwork->_model->get_results()) {
+    for (auto&& node : model->get_results()) {
         IE_ASSERT(node->inputs().size() == 1);
         auto outputName = node->get_rt_info().at("ResultName").as<std::string>();
         auto input = node->input(0);
         auto sourceOutput = input.get_source_output();
         auto tensor = layers.at(node->get_instance_id())._inputs.at(input)->_tensor.get();
-        auto str = _executableNetwork->_model->get_friendly_name() + "_" +
-                   requestID + "_postprocessing_" +
+        auto str = model->get_friendly_name() + "_" +
+                   _requestID + "_postprocessing_" +
                    outputName + "_" +
                    std::to_string(node->get_instance_id());
         _outputInfo.emplace_back(IOInfo{
@@ -140,7 +218,7 @@ void ArmInferRequest::InitArmInferRequest(const std::shared_ptr<ArmPlugin::Execu
             tensor,
             openvino::itt::handle(str),
             allocateMemory(outputName,
-                           _networkOutputs,
+                           networkOutputs,
                            _outputs,
                            tensor,
                            sourceOutput),
@@ -150,20 +228,94 @@ void ArmInferRequest::InitArmInferRequest(const std::shared_ptr<ArmPlugin::Execu
     IE_ASSERT(!_outputInfo.empty());
     _memoryManager->populate(_allocator, 1);
     _memoryGroupScope = std::make_unique<arm_compute::MemoryGroupResourceScope>(*_memoryGroup);
-    for (auto&& node : _executableNetwork->_model->get_ordered_ops()) {
+    for (auto&& node : model->get_ordered_ops()) {
         auto& layer = layers.at(node->get_instance_id());
         auto execType = layer._execType;
         _layers.emplace_back(LayerInfo{
             std::move(layer),
             node.get(),
-            openvino::itt::handle(_executableNetwork->_model->get_friendly_name() + "_" +
-                                  requestID + "_" +
+            openvino::itt::handle(model->get_friendly_name() + "_" +
+                                  _requestID + "_" +
                                   node->get_friendly_name() + "_" +
                                   std::to_string(node->get_instance_id())),
             execType});
     }
 }
 
+void ArmInferRequest::InitBatchSplit() {
+    const auto splits = static_cast<std::size_t>(_executableNetwork->_cfg._batchSplit);
+    const auto& splitModel = _executableNetwork->_splitModel;
+    IE_ASSERT(splitModel != nullptr);
+    auto splitDims = [&] (InferenceEngine::SizeVector dims) {
+        dims[0] /= splits;
+        return dims;
+    };
+    InferenceEngine::InputsDataMap splitInputs;
+    for (auto&& input : _networkInputs) {
+        auto data = std::make_shared<InferenceEngine::Data>(*input.second->getInputData());
+        data->reshape(splitDims(data->getTensorDesc().getDims()), data->getTensorDesc().getLayout());
+        auto info = std::make_shared<InferenceEngine::InputInfo>();
+        info->setInputData(data);
+        splitInputs.emplace(input.first, info);
+        _splitInputDescs.emplace(input.first, info->getTensorDesc());
+    }
+    InferenceEngine::OutputsDataMap splitOutputs;
+    for (auto&& output : _networkOutputs) {
+        auto data = std::make_shared<InferenceEngine::Data>(*output.second);
+        data->reshape(splitDims(data->getTensorDesc().getDims()), data->getTensorDesc().getLayout());
+        splitOutputs.emplace(output.first, data);
+        _splitOutputDescs.emplace(output.first, data->getTensorDesc());
+    }
+    // Every replica converts the same split model instance, so the packed
+    // weights land in the network's shared constants and are reused, not
+    // replicated, across the pipelines
+    for (std::size_t k = 0; k < splits; ++k) {
+        _batchRequests.emplace_back(std::make_shared<ArmInferRequest>(splitInputs,
+                                                                      splitOutputs,
+                                                                      _executableNetwork,
+                                                                      splitModel));
+    }
+    // Full-size blobs the application talks to; each replica binds to its
+    // contiguous batch slice of these buffers, so splitting and merging are
+    // pointer arithmetic, not copies
+    for (auto&& input : _networkInputs) {
+        auto& blob = _inputs[input.first];
+        blob = make_blob_with_precision(input.second->getTensorDesc());
+        blob->allocate();
+    }
+    for (auto&& output : _networkOutputs) {
+        auto& blob = _outputs[output.first];
+        blob = make_blob_with_precision(output.second->getTensorDesc());
+        blob->allocate();
+    }
+}
+
+void ArmInferRequest::BindBatchSlices() {
+    auto bindSlices = [&] (const std::string& name,
+                           const InferenceEngine::Blob::Ptr& blob,
+                           const InferenceEngine::TensorDesc& sliceDesc) {
+        auto& bound = _boundSlices[name];
+        if (bound == blob.get()) {
+            return;
+        }
+        auto base = InferenceEngine::as<InferenceEngine::MemoryBlob>(blob)->rwmap().as<std::uint8_t*>();
+        const auto sliceBytes = blob->byteSize() / _batchRequests.size();
+        for (std::size_t k = 0; k < _batchRequests.size(); ++k) {
+            // The slice descriptor matches the replica's network descriptor,
+            // so SetBlob takes the direct path and the replica's ACL tensors
+            // wrap the parent buffer without copies
+            _batchRequests[k]->SetBlob(name, make_blob_with_precision(sliceDesc, base + k * sliceBytes));
+        }
+        bound = blob.get();
+    };
+    for (auto&& input : _inputs) {
+        bindSlices(input.first, input.second, _splitInputDescs.at(input.first));
+    }
+    for (auto&& output : _outputs) {
+        bindSlices(output.first, output.second, _splitOutputDescs.at(output.first));
+    }
+}
+
 ArmInferRequest::~ArmInferRequest() {
     _executableNetwork->_requestId--;
 }
@@ -172,7 +324,85 @@ struct StaticCast {
     template<typename T> operator T*() {return static_cast<T*>(_ptr);}
     void* _ptr;
 };
+#if defined(__aarch64__)
+// The u8/f32 blob pairs dominating image pipelines take a NEON conversion
+// that permutes between the interleaved and planar layouts in the same sweep
+// where the descriptors disagree on layout, with the rows split across the
+// threads; everything else stays on the scalar element-wise fallback
+static bool fusedConvertApplicable(const InferenceEngine::TensorDesc& src, const InferenceEngine::TensorDesc& dst) {
+    if (src.getDims() != dst.getDims()) {
+        return false;
+    }
+    const bool u8ToF32 = (src.getPrecision() == Precision::U8) && (dst.getPrecision() == Precision::FP32);
+    const bool f32ToU8 = (src.getPrecision() == Precision::FP32) && (dst.getPrecision() == Precision::U8);
+    if (!u8ToF32 && !f32ToU8) {
+        return false;
+    }
+    if (src.getLayout() == dst.getLayout()) {
+        return true;
+    }
+    return (src.getDims().size() == 4) &&
+           (u8ToF32 ? ((src.getLayout() == Layout::NHWC) && (dst.getLayout() == Layout::NCHW))
+                    : ((src.getLayout() == Layout::NCHW) && (dst.getLayout() == Layout::NHWC)));
+}
+
+static void fusedBlobCopy(const Blob::Ptr& src, const Blob::Ptr& dst) {
+    const auto& srcDesc = src->getTensorDesc();
+    const auto& dstDesc = dst->getTensorDesc();
+    const bool u8ToF32 = (srcDesc.getPrecision() == Precision::U8);
+    auto srcMap = InferenceEngine::as<InferenceEngine::MemoryBlob>(src)->rmap();
+    auto dstMap = InferenceEngine::as<InferenceEngine::MemoryBlob>(dst)->wmap();
+    const void* srcData = srcMap.as<const void*>();
+    void* dstData = dstMap.as<void*>();
+    if (srcDesc.getLayout() == dstDesc.getLayout()) {
+        const std::size_t total = src->size();
+        const auto numChunks = std::min<std::size_t>(std::max<std::size_t>(total / 4096, 1),
+                                                     static_cast<std::size_t>(parallel_get_max_threads()));
+        InferenceEngine::parallel_for(numChunks, [&] (int chunk) {
+            const auto begin = total * chunk / numChunks;
+            const auto end = total * (chunk + 1) / numChunks;
+            if (u8ToF32) {
+                neon::convert_u8_to_f32(static_cast<const std::uint8_t*>(srcData) + begin,
+                                        static_cast<float*>(dstData) + begin,
+                                        end - begin);
+            } else {
+                neon::convert_f32_to_u8(static_cast<const float*>(srcData) + begin,
+                                        static_cast<std::uint8_t*>(dstData) + begin,
+                                        end - begin);
+            }
+        });
+        return;
+    }
+    // The descriptor dims are NCHW-ordered regardless of the layout
+    const auto& dims = srcDesc.getDims();
+    const auto channels = dims[1];
+    const auto height = dims[2];
+    const auto width = dims[3];
+    const auto planeStride = height * width;
+    InferenceEngine::parallel_for(dims[0] * height, [&] (std::size_t row) {
+        const auto n = row / height;
+        const auto h = row % height;
+        const auto interleaved = (n * height + h) * width * channels;
+        const auto planar = n * channels * planeStride + h * width;
+        if (u8ToF32) {
+            neon::convert_row_u8_to_f32(static_cast<const std::uint8_t*>(srcData) + interleaved,
+                                        static_cast<float*>(dstData) + planar,
+                                        width, channels, planeStride);
+        } else {
+            neon::convert_row_f32_to_u8(static_cast<const float*>(srcData) + planar,
+                                        static_cast<std::uint8_t*>(dstData) + interleaved,
+                                        width, channels, planeStride);
+        }
+    });
+}
+#endif
 static void blobCopy(const Blob::Ptr& src, const Blob::Ptr& dst) {
+#if defined(__aarch64__)
+    if (fusedConvertApplicable(src->getTensorDesc(), dst->getTensorDesc())) {
+        fusedBlobCopy(src, dst);
+        return;
+    }
+#endif
     auto apply = [&] (auto convert) {
         convert(
             StaticCast{InferenceEngine::as<InferenceEngine::MemoryBlob>(src)->rmap().as<void*>()},
@@ -186,15 +416,162 @@ static void blobCopy(const Blob::Ptr& src, const Blob::Ptr& dst) {
         InferenceEngine::details::convertPrecision(dst->getTensorDesc().getPrecision()), allTypes);
 }
 
+void ArmInferRequest::SetBlob(const std::string& name, const InferenceEngine::Blob::Ptr& userBlob) {
+    IInferRequestInternal::SetBlob(name, userBlob);
+    if (_dynamic) {
+        // A pipeline rebuild re-creates the network-side blobs; the recorded
+        // application blobs are rebound over them afterwards
+        _userBlobs[name] = userBlob;
+    }
+#if defined(__aarch64__)
+    // Input blobs needing nothing beyond a precision conversion and an
+    // NHWC/NCHW permutation are pulled out of the common preprocessing
+    // machinery: InferPreprocess runs the fused NEON conversion for them
+    // instead of the separate convert and permute passes
+    _fusedConvertInputs.erase(name);
+    if (!_dynamic) {
+        auto itPreProc = _preProcData.find(name);
+        if (itPreProc != _preProcData.end()) {
+            auto itInput = _networkInputs.find(name);
+            auto itBlob = _inputs.find(name);
+            if ((itInput != _networkInputs.end()) && (itBlob != _inputs.end())) {
+                const auto& preProcess = itInput->second->getPreProcess();
+                if ((preProcess.getResizeAlgorithm() == InferenceEngine::NO_RESIZE) &&
+                    (preProcess.getColorFormat() == InferenceEngine::ColorFormat::RAW) &&
+                    (preProcess.getMeanVariant() == InferenceEngine::MeanVariant::NONE) &&
+                    fusedConvertApplicable(userBlob->getTensorDesc(), itBlob->second->getTensorDesc())) {
+                    _fusedConvertInputs[name] = userBlob;
+                    _preProcData.erase(itPreProc);
+                }
+            }
+        }
+    }
+#endif
+    // One-time compatibility check: a caller-provided buffer whose descriptor
+    // matches the network one is wrapped by the ACL tensor as is at inference
+    // time, the per-inference copy branch is never taken for it
+    for (auto&& input : _inputInfo) {
+        if (input._itBlob->first == name) {
+            input._direct = (userBlob->getTensorDesc() == input._blob->getTensorDesc());
+        }
+    }
+    for (auto&& output : _outputInfo) {
+        if ((output._blob != nullptr) && (output._itBlob->first == name)) {
+            output._direct = !ngraph::op::is_constant(output._output.get_node()) &&
+                             (userBlob->getTensorDesc() == output._blob->getTensorDesc());
+        }
+    }
+}
+
+InferenceEngine::Blob::Ptr ArmInferRequest::GetBlob(const std::string& name) {
+    // The blobs taken over from the preprocessing machinery still belong to
+    // the application and are what GetBlob has to hand back
+    auto itFused = _fusedConvertInputs.find(name);
+    if (itFused != _fusedConvertInputs.end()) {
+        return itFused->second;
+    }
+    return IInferRequestInternal::GetBlob(name);
+}
+
 void ArmInferRequest::InferImpl() {
+    InferPreprocess();
+    InferExecute();
+    InferPostprocess();
+}
+
+void ArmInferRequest::SpecializeForInputShapes() {
+    std::map<std::string, ngraph::PartialShape> shapes;
+    std::string signature;
+    for (auto&& input : _networkInputs) {
+        auto itBlob = _userBlobs.find(input.first);
+        if ((itBlob == _userBlobs.end()) || (itBlob->second == nullptr)) {
+            IE_THROW() << "Arm Plugin: dynamic network input " << input.first
+                       << " needs a blob set before inference";
+        }
+        const auto& dims = itBlob->second->getTensorDesc().getDims();
+        shapes.emplace(input.first, ngraph::PartialShape{ngraph::Shape{dims}});
+        signature += input.first + ':';
+        for (auto&& dim : dims) {
+            signature += std::to_string(dim) + ',';
+        }
+        signature += ' ';
+    }
+    if (signature == _shapeSignature) {
+        return;
+    }
+    _specialization = _executableNetwork->GetShapeSpecialization(shapes);
+    // Reshaped copies of the I/O maps drive the network-side blob allocation,
+    // the way the batch-split replicas reshape theirs in InitBatchSplit
+    InferenceEngine::InputsDataMap specializedInputs;
+    for (auto&& input : _networkInputs) {
+        auto data = std::make_shared<InferenceEngine::Data>(*input.second->getInputData());
+        data->reshape(_userBlobs.at(input.first)->getTensorDesc().getDims(), data->getTensorDesc().getLayout());
+        auto info = std::make_shared<InferenceEngine::InputInfo>();
+        info->setInputData(data);
+        specializedInputs.emplace(input.first, info);
+    }
+    std::map<std::string, InferenceEngine::SizeVector> resultDims;
+    for (auto&& result : _specialization->_model->get_results()) {
+        resultDims.emplace(result->get_rt_info().at("ResultName").as<std::string>(),
+                           result->get_input_shape(0));
+    }
+    InferenceEngine::OutputsDataMap specializedOutputs;
+    for (auto&& output : _networkOutputs) {
+        auto data = std::make_shared<InferenceEngine::Data>(*output.second);
+        data->reshape(resultDims.at(output.first), data->getTensorDesc().getLayout());
+        specializedOutputs.emplace(output.first, data);
+    }
+    BuildPipeline(_specialization->_model, _specialization->_weightsSharing, specializedInputs, specializedOutputs);
+    // Rebind the application blobs over the freshly created network-side ones;
+    // the map iterators cached in the I/O infos stay valid over the assignment
+    for (auto&& userBlob : _userBlobs) {
+        auto itInput = _inputs.find(userBlob.first);
+        if (itInput != _inputs.end()) {
+            itInput->second = userBlob.second;
+        }
+        auto itOutput = _outputs.find(userBlob.first);
+        if (itOutput != _outputs.end()) {
+            itOutput->second = userBlob.second;
+        }
+        for (auto&& input : _inputInfo) {
+            if (input._itBlob->first == userBlob.first) {
+                input._direct = (userBlob.second->getTensorDesc() == input._blob->getTensorDesc());
+            }
+        }
+        for (auto&& output : _outputInfo) {
+            if ((output._blob != nullptr) && (output._itBlob->first == userBlob.first)) {
+                output._direct = !ngraph::op::is_constant(output._output.get_node()) &&
+                                 (userBlob.second->getTensorDesc() == output._blob->getTensorDesc());
+            }
+        }
+    }
+    _shapeSignature = std::move(signature);
+}
+
+void ArmInferRequest::InferPreprocess() {
+    if (_countEvents) {
+        EventCounters::Add(EventCounters::Instance()._inferStarted);
+    }
+    StageSpan stageSpan{_trace, "Preprocess#" + _requestID,
+                        _countEvents ? &EventCounters::Instance()._preprocessUs : nullptr};
+    if (!_batchRequests.empty()) {
+        execDataPreprocessing(_inputs);
+        ExecFusedPreprocessing();
+        BindBatchSlices();
+        return;
+    }
     {
         execDataPreprocessing(_inputs);
+        ExecFusedPreprocessing();
+        if (_dynamic) {
+            SpecializeForInputShapes();
+        }
         for (auto&& input : _inputInfo) {
             auto start = Time::now();
             OV_ITT_SCOPED_TASK(Itt::Domains::ArmPlugin, input._profilingTask);
             const auto& inputBlob = input._itBlob->second;
             if (inputBlob != input._blob) {
-                if (input._blob->getTensorDesc() == inputBlob->getTensorDesc()) {
+                if (input._direct) {
                     input._blob = inputBlob;
                 } else {
                     blobCopy(inputBlob, input._blob);
@@ -217,10 +594,8 @@ void ArmInferRequest::InferImpl() {
             if (output._blob != nullptr) {
                 const auto& outputBlob = output._itBlob->second;
                 if (!ngraph::op::is_constant(output._output.get_node())) {
-                    if (outputBlob != output._blob) {
-                        if (output._blob->getTensorDesc() == outputBlob->getTensorDesc()) {
-                            output._blob = outputBlob;
-                        }
+                    if ((outputBlob != output._blob) && output._direct) {
+                        output._blob = outputBlob;
                     }
                     if (!output._tensor->info()->has_padding()) {
                         static_cast<arm_compute::Tensor*>(output._tensor)->allocator()->import_memory(
@@ -230,15 +605,65 @@ void ArmInferRequest::InferImpl() {
             }
         }
     }
+}
+
+void ArmInferRequest::ExecFusedPreprocessing() {
+#if defined(__aarch64__)
+    for (auto&& fused : _fusedConvertInputs) {
+        fusedBlobCopy(fused.second, _inputs.at(fused.first));
+    }
+#endif
+}
+
+void ArmInferRequest::InferExecute() {
+    StageSpan stageSpan{_trace, "Execute#" + _requestID,
+                        _countEvents ? &EventCounters::Instance()._executeUs : nullptr};
+    if (!_batchRequests.empty()) {
+        IE_ASSERT(_executableNetwork->_batchExecutor != nullptr);
+        std::vector<InferenceEngine::Task> tasks;
+        for (auto&& request : _batchRequests) {
+            tasks.emplace_back([request] {
+                request->InferImpl();
+            });
+        }
+        _executableNetwork->_batchExecutor->runAndWait(tasks);
+        return;
+    }
+    // Opened once per executor thread, so sampling a layer is two counter
+    // reads around the run; the group covers the thread driving the ACL
+    // function
+    static thread_local PMUProfiler pmuProfiler;
+    const bool pmu = _executableNetwork->_cfg._pmuCounters && pmuProfiler.Enabled();
     for (auto&& layer : _layers) {
         if (layer._layer._function != nullptr) {
             OV_ITT_SCOPED_TASK(Itt::Domains::ArmPlugin, layer._profilingTask);
             auto start = Time::now();
-            layer._layer._function->run();
+            const auto traceBegin = _trace ? TraceExport::NowUs() : 0;
+            if (pmu) {
+                const auto before = pmuProfiler.Sample();
+                layer._layer._function->run();
+                layer._pmuCounters += pmuProfiler.Sample() - before;
+            } else {
+                layer._layer._function->run();
+            }
             layer._duration += Time::now() - start;
             layer._counter++;
+            if (_trace) {
+                TraceExport::Instance().CompleteEvent(layer._node->get_friendly_name(), layer._execType, traceBegin);
+            }
         }
     }
+}
+
+void ArmInferRequest::InferPostprocess() {
+    StageSpan stageSpan{_trace, "Postprocess#" + _requestID,
+                        _countEvents ? &EventCounters::Instance()._postprocessUs : nullptr,
+                        _countEvents ? &EventCounters::Instance()._inferCompleted : nullptr};
+    if (!_batchRequests.empty()) {
+        // The replicas postprocess straight into their slices of the full-size
+        // output blobs, there is nothing left to merge
+        return;
+    }
     for (auto&& output : _outputInfo) {
         if (output._blob != nullptr) {
             auto start = Time::now();
@@ -256,10 +681,8 @@ void ArmInferRequest::InferImpl() {
                         InferenceEngine::as<InferenceEngine::MemoryBlob>(output._blob)->wmap().as<void*>());
                     outputTensor.copy_from(*(output._tensor));
                 }
-                if (outputBlob != output._blob) {
-                    if (output._blob->getTensorDesc() != outputBlob->getTensorDesc()) {
-                        blobCopy(output._blob, outputBlob);
-                    }
+                if ((outputBlob != output._blob) && !output._direct) {
+                    blobCopy(output._blob, outputBlob);
                 }
             }
             output._duration += Time::now() - start;
@@ -269,9 +692,13 @@ void ArmInferRequest::InferImpl() {
 }
 
 std::map<std::string, InferenceEngineProfileInfo> ArmInferRequest::GetPerformanceCounts() const {
+    if (!_batchRequests.empty()) {
+        // The replicas run the same per-slice pipeline; report the first one
+        return _batchRequests.front()->GetPerformanceCounts();
+    }
     std::map<std::string, InferenceEngineProfileInfo> perfMap;
     int executionIndex = 0;
-    auto fillInfo = [&] (const auto& layer, ngraph::Node* node, auto& name) {
+    auto fillInfo = [&] (const auto& layer, ngraph::Node* node, auto& name, const PMUCounters* pmu = nullptr) {
         InferenceEngineProfileInfo info;
         info.execution_index = executionIndex;
         ++executionIndex;
@@ -287,6 +714,14 @@ std::map<std::string, InferenceEngineProfileInfo> ArmInferRequest::GetPerformanc
             std::stringstream strm;
             strm << node->get_output_element_type(0);
             auto str = layer._execType + "." + strm.str();
+            if ((pmu != nullptr) && (pmu->_cycles != 0)) {
+                std::stringstream metrics;
+                // A last-level miss moves one cache line to or from memory
+                metrics << std::fixed << std::setprecision(2)
+                        << " ipc=" << (static_cast<double>(pmu->_instructions) / pmu->_cycles)
+                        << " bytes/cycle=" << (static_cast<double>(pmu->_cacheMisses) * 64 / pmu->_cycles);
+                str += metrics.str();
+            }
             auto pos = std::copy_n(str.c_str(), std::min(sizeof(info.exec_type) - 1, str.size()), info.exec_type);
             *pos = '\0';
         }
@@ -297,7 +732,7 @@ std::map<std::string, InferenceEngineProfileInfo> ArmInferRequest::GetPerformanc
     }
     for (auto&& layer : _layers) {
         if (layer._layer._function != nullptr) {
-            fillInfo(layer, layer._node, layer._node->get_friendly_name());
+            fillInfo(layer, layer._node, layer._node->get_friendly_name(), &layer._pmuCounters);
         }
     }
     for (auto&& output : _outputInfo) {
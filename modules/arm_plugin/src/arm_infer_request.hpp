@@ -12,12 +12,14 @@
 #include <unordered_map>
 
 #include <ie_common.h>
+#include <ie_layouts.h>
 #include "cpp_interfaces/interface/ie_iinfer_request_internal.hpp"
 #include <threading/ie_itask_executor.hpp>
 
 #include "arm_converter/arm_converter.hpp"
 #include "arm_config.hpp"
 #include "arm_itt.hpp"
+#include "arm_pmu_profiler.hpp"
 
 #include <arm_compute/runtime/Allocator.h>
 #include <arm_compute/runtime/OffsetLifetimeManager.h>
@@ -30,6 +32,7 @@
 namespace ArmPlugin {
 
 class ExecutableNetwork;
+struct ShapeSpecialization;
 
 struct ArmInferRequest : public InferenceEngine::IInferRequestInternal {
     using Ptr = std::shared_ptr<ArmInferRequest>;
@@ -40,11 +43,27 @@ struct ArmInferRequest : public InferenceEngine::IInferRequestInternal {
     ArmInferRequest(const std::vector<std::shared_ptr<const ov::Node>>& networkInputs,
                     const std::vector<std::shared_ptr<const ov::Node>>& networkOutputs,
                     const std::shared_ptr<ExecutableNetwork>& executableNetwork);
+    // Replica of the batch-split mode: runs a 1/K slice of the batch through
+    // its own layer pipeline built over the network's split model
+    ArmInferRequest(const InferenceEngine::InputsDataMap&     networkInputs,
+                    const InferenceEngine::OutputsDataMap&    networkOutputs,
+                    const std::shared_ptr<ExecutableNetwork>& executableNetwork,
+                    const std::shared_ptr<const ov::Model>&   model);
     ~ArmInferRequest();
 
     void InferImpl() override;
     std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> GetPerformanceCounts() const override;
 
+    // Pipeline stages of InferImpl; ArmAsyncInferRequest maps them onto
+    // distinct executors so the input conversion of one request overlaps
+    // the execution of another
+    void InferPreprocess();
+    void InferExecute();
+    void InferPostprocess();
+
+    void SetBlob(const std::string& name, const InferenceEngine::Blob::Ptr& userBlob) override;
+    InferenceEngine::Blob::Ptr GetBlob(const std::string& name) override;
+
     using Duration = std::chrono::duration<float, std::micro>;
     struct LayerInfo {
         Layer                   _layer;
@@ -53,6 +72,8 @@ struct ArmInferRequest : public InferenceEngine::IInferRequestInternal {
         std::string             _execType;
         Duration                _duration;
         std::size_t             _counter;
+        // Accumulated hardware counters of the PMU_COUNTERS mode
+        PMUCounters             _pmuCounters;
     };
     struct IOInfo {
         Output                              _output;
@@ -63,6 +84,10 @@ struct ArmInferRequest : public InferenceEngine::IInferRequestInternal {
         std::string                         _execType;
         Duration                            _duration;
         std::size_t                         _counter;
+        // Checked once at SetBlob: the caller buffer matches the network
+        // descriptor and binds to the ACL tensor directly via import_memory,
+        // so the per-inference copy is skipped
+        bool                                _direct = false;
     };
     std::shared_ptr<ExecutableNetwork>                                          _executableNetwork;
     std::vector<LayerInfo>                                                      _layers;
@@ -74,9 +99,56 @@ struct ArmInferRequest : public InferenceEngine::IInferRequestInternal {
     std::shared_ptr<arm_compute::MemoryManagerOnDemand>                         _memoryManager;
     std::unique_ptr<arm_compute::MemoryGroup>                                   _memoryGroup;
     std::unique_ptr<arm_compute::MemoryGroupResourceScope>                      _memoryGroupScope;
+    // Batch-split mode: the replicas this request partitions its batch across,
+    // each bound to a contiguous batch slice of the full-size blobs; empty
+    // when the mode is off and this request runs its own pipeline
+    std::vector<Ptr>                                                            _batchRequests;
 
 private:
-    void InitArmInferRequest(const std::shared_ptr<ArmPlugin::ExecutableNetwork>& executableNetwork);
+    void InitArmInferRequest(const std::shared_ptr<ArmPlugin::ExecutableNetwork>& executableNetwork,
+                             const std::shared_ptr<const ov::Model>& model);
+    // Converts the model into this request's layer pipeline and binds the I/O
+    // blobs; in dynamic-shape mode it runs again whenever the input shapes
+    // change, replacing the previous pipeline wholesale
+    void BuildPipeline(const std::shared_ptr<const ov::Model>&    model,
+                       const Converter::WeightsSharing::Ptr&      weightsSharing,
+                       const InferenceEngine::InputsDataMap&      networkInputs,
+                       const InferenceEngine::OutputsDataMap&     networkOutputs);
+    // Dynamic-shape mode: fetches the specialization matching the current
+    // input blob shapes from the network's cache and rebuilds the pipeline
+    // over it when the shapes changed since the previous inference
+    void SpecializeForInputShapes();
+    // Runs the fused NEON convert+permute for the inputs taken over from the
+    // common preprocessing machinery in SetBlob
+    void ExecFusedPreprocessing();
+    void InitBatchSplit();
+    void BindBatchSlices();
+
+    std::string                                                                 _requestID;
+    // Streams layer and stage spans into the chrome tracing file of the
+    // TRACE_EXPORT_FILE option
+    bool                                                                        _trace = false;
+    // Feeds the always-on event counters; off for batch-split replicas, whose
+    // parent already counts the inference
+    bool                                                                        _countEvents = true;
+    // Dynamic-shape mode: the pipeline is built lazily from the blob shapes
+    bool                                                                        _dynamic = false;
+    // Signature of the shapes the current pipeline was built for
+    std::string                                                                 _shapeSignature;
+    // Keeps the specialization alive if the network's cache evicts it
+    std::shared_ptr<ShapeSpecialization>                                        _specialization;
+    // Blobs the application set explicitly; rebinding them after a pipeline
+    // rebuild restores them over the freshly allocated network-side blobs
+    InferenceEngine::BlobMap                                                    _userBlobs;
+    // Application blobs whose only preprocessing is a u8/f32 conversion plus
+    // at most an NHWC/NCHW permutation; they bypass the generic preprocessing
+    // and take the fused NEON conversion instead
+    InferenceEngine::BlobMap                                                    _fusedConvertInputs;
+    std::map<std::string, InferenceEngine::TensorDesc>                          _splitInputDescs;
+    std::map<std::string, InferenceEngine::TensorDesc>                          _splitOutputDescs;
+    // Blobs whose slices the replicas are currently bound to; an unchanged
+    // blob needs no per-inference rebinding
+    std::map<std::string, const InferenceEngine::Blob*>                         _boundSlices;
 };
 // ! [infer_request:header]
 
@@ -0,0 +1,139 @@
+// Copyright (C) 2020-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "arm_node_validate_cache.hpp"
+
+#include <sstream>
+#include <vector>
+
+#include <openvino/core/attribute_visitor.hpp>
+
+namespace ArmPlugin {
+namespace {
+
+// Serializes the node attributes into the signature. Attribute kinds without a
+// textual form below (nested models, raw pointers, custom object adapters)
+// mark the node uncacheable, so an unknown attribute can never alias two
+// different layers onto one cache entry
+struct SignatureVisitor : public ov::AttributeVisitor {
+    explicit SignatureVisitor(std::ostringstream& strm) : _strm{strm} {}
+
+    void on_adapter(const std::string& name, ov::ValueAccessor<void>&) override {
+        _cacheable = false;
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::string>& adapter) override {
+        _strm << ' ' << name << '=' << adapter.get();
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<bool>& adapter) override {
+        _strm << ' ' << name << '=' << adapter.get();
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::int64_t>& adapter) override {
+        _strm << ' ' << name << '=' << adapter.get();
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<double>& adapter) override {
+        _strm << ' ' << name << '=' << adapter.get();
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<std::int32_t>>& adapter) override {
+        Append(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<std::int64_t>>& adapter) override {
+        Append(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<std::uint64_t>>& adapter) override {
+        Append(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<float>>& adapter) override {
+        Append(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<double>>& adapter) override {
+        Append(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<std::string>>& adapter) override {
+        Append(name, adapter.get());
+    }
+
+    template<typename T>
+    void Append(const std::string& name, const std::vector<T>& values) {
+        _strm << ' ' << name << "=[";
+        for (auto&& value : values) {
+            _strm << value << ',';
+        }
+        _strm << ']';
+    }
+
+    std::ostringstream& _strm;
+    bool                _cacheable = true;
+};
+
+// rt_info records the converters feed into ACL validation as opaque objects;
+// their values cannot go into the signature, so nodes carrying them validate
+// without the cache
+const char* valueBearingRtInfo[] = {
+    "QuantizationInfo",
+    "InputPrescaleInfo",
+    "WeightsPrescaleInfo",
+    "ActivationLayerInfo",
+};
+
+bool BuildSignature(ngraph::Node& node, const std::string& configSalt, std::string& signature) {
+    const auto& rtInfo = node.get_rt_info();
+    for (auto&& key : valueBearingRtInfo) {
+        if (rtInfo.count(key) != 0) {
+            return false;
+        }
+    }
+    std::ostringstream strm;
+    strm << node.get_type_info().name << '.' << node.get_type_info().version_id << ' ' << configSalt;
+    // Presence-only markers the converters branch on
+    if (rtInfo.count("DataLayoutNHWC") != 0) {
+        strm << " nhwc";
+    }
+    if (rtInfo.count("DisableFastMath") != 0) {
+        strm << " nofm";
+    }
+    for (auto&& input : node.input_values()) {
+        strm << ' ' << input.get_element_type() << ':' << input.get_partial_shape();
+    }
+    for (auto&& output : node.outputs()) {
+        strm << " ->" << output.get_element_type() << ':' << output.get_partial_shape();
+    }
+    SignatureVisitor visitor{strm};
+    if (!node.visit_attributes(visitor) || !visitor._cacheable) {
+        return false;
+    }
+    signature = strm.str();
+    return true;
+}
+}  // namespace
+
+NodeValidateCache& NodeValidateCache::Instance() {
+    static NodeValidateCache instance;
+    return instance;
+}
+
+arm_compute::Status NodeValidateCache::Validate(ngraph::Node& node,
+                                                const std::string& configSalt,
+                                                const std::function<arm_compute::Status()>& validate) {
+    std::string signature;
+    if (!BuildSignature(node, configSalt, signature)) {
+        return validate();
+    }
+    {
+        std::lock_guard<std::mutex> lock{_mutex};
+        auto it = _statuses.find(signature);
+        if (it != _statuses.end()) {
+            return it->second;
+        }
+    }
+    auto status = validate();
+    {
+        // Concurrent misses on the same structure may both validate; the first
+        // emplace wins and the verdicts are identical anyway
+        std::lock_guard<std::mutex> lock{_mutex};
+        _statuses.emplace(std::move(signature), status);
+    }
+    return status;
+}
+
+}  // namespace ArmPlugin
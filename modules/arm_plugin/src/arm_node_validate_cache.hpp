@@ -0,0 +1,46 @@
+// Copyright (C) 2020-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <functional>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include <arm_compute/core/Error.h>
+#include <ngraph/node.hpp>
+
+namespace ArmPlugin {
+
+/**
+ * Structural cache of the ACL validation verdicts: models built from repeated
+ * blocks (e.g. transformer encoders) carry dozens of structurally identical
+ * layers, and the per-layer ACL validate() re-runs the same kernel selection
+ * checks for every copy. Results are keyed by the node's type, attributes and
+ * input/output descriptors, so only the first occurrence of each structure
+ * pays for the check; the cache spans networks loaded in one process. Nodes
+ * whose validation depends on data the signature cannot capture (fused
+ * quantization or activation records in rt_info, nested bodies) bypass the
+ * cache and validate as before
+ */
+class NodeValidateCache {
+public:
+    static NodeValidateCache& Instance();
+
+    NodeValidateCache(const NodeValidateCache&) = delete;
+    NodeValidateCache& operator=(const NodeValidateCache&) = delete;
+
+    arm_compute::Status Validate(ngraph::Node& node,
+                                 const std::string& configSalt,
+                                 const std::function<arm_compute::Status()>& validate);
+
+private:
+    NodeValidateCache() = default;
+
+    std::mutex                                          _mutex;
+    std::unordered_map<std::string, arm_compute::Status> _statuses;
+};
+
+}  // namespace ArmPlugin
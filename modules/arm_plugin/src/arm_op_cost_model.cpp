@@ -0,0 +1,154 @@
+// Copyright (C) 2020-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+
+#include "arm_op_cost_model.hpp"
+
+#include <fstream>
+#include <unordered_map>
+#include <unordered_set>
+
+#include <ngraph/op/util/op_types.hpp>
+#include <openvino/op/convolution.hpp>
+#include <openvino/op/group_conv.hpp>
+#include <openvino/op/matmul.hpp>
+
+using namespace ArmPlugin;
+
+namespace {
+
+std::string CpuPartNumber() {
+    static const std::string part = [] {
+        std::ifstream cpuinfo{"/proc/cpuinfo"};
+        std::string line;
+        while (std::getline(cpuinfo, line)) {
+            auto pos = line.find("CPU part");
+            if (pos != std::string::npos) {
+                pos = line.find(':', pos);
+                if (pos != std::string::npos) {
+                    auto value = line.substr(pos + 1);
+                    value.erase(0, value.find_first_not_of(" \t"));
+                    return value;
+                }
+            }
+        }
+        return std::string{"unknown"};
+    }();
+    return part;
+}
+
+enum class OpCategory { Mac, Math, Move, Reduce, Other };
+
+// Category assignment by op type; anything absent lands in Other with the
+// conservative rate
+OpCategory Categorize(const ngraph::Node& node) {
+    static const std::unordered_set<std::string> mac{
+        "Convolution", "GroupConvolution", "ConvolutionBackpropData",
+        "GroupConvolutionBackpropData", "MatMul", "FullyConnected"};
+    static const std::unordered_set<std::string> math{
+        "Add", "Subtract", "Multiply", "Divide", "Power", "Relu", "PRelu",
+        "Sigmoid", "Tanh", "Elu", "Gelu", "Swish", "HSwish", "Mish", "Clamp",
+        "Exp", "Log", "Sqrt", "Abs", "Negative", "Minimum", "Maximum",
+        "FakeQuantize", "Round", "Floor", "Ceiling", "Erf"};
+    static const std::unordered_set<std::string> move{
+        "Transpose", "Concat", "Split", "VariadicSplit", "StridedSlice",
+        "Gather", "GatherElements", "GatherND", "ScatterUpdate", "Pad",
+        "Tile", "Broadcast", "SpaceToDepth", "DepthToSpace", "ShuffleChannels",
+        "Reshape", "Squeeze", "Unsqueeze", "Convert"};
+    static const std::unordered_set<std::string> reduce{
+        "ReduceMean", "ReduceSum", "ReduceMax", "ReduceMin", "ReduceProd",
+        "ReduceL1", "ReduceL2", "AvgPool", "MaxPool", "Softmax", "LogSoftmax",
+        "MVN", "NormalizeL2", "BatchNormInference", "LRN"};
+    const std::string type = node.get_type_info().name;
+    if (mac.count(type)) return OpCategory::Mac;
+    if (math.count(type)) return OpCategory::Math;
+    if (move.count(type)) return OpCategory::Move;
+    if (reduce.count(type)) return OpCategory::Reduce;
+    return OpCategory::Other;
+}
+
+size_t OutputElements(const ngraph::Node& node) {
+    size_t elements = 0;
+    for (size_t i = 0; i < node.get_output_size(); ++i) {
+        const auto& shape = node.get_output_partial_shape(i);
+        if (shape.is_static()) {
+            elements += ngraph::shape_size(shape.get_shape());
+        }
+    }
+    return elements;
+}
+
+// MAC count of the compute-heavy ops; falls back to output elements when
+// shapes are not static enough to count
+double MacCount(const ngraph::Node& node) {
+    const auto& out_shape = node.get_output_partial_shape(0);
+    if (!out_shape.is_static()) {
+        return static_cast<double>(OutputElements(node));
+    }
+    const auto out_elements = static_cast<double>(ngraph::shape_size(out_shape.get_shape()));
+    if (ngraph::is_type<ov::op::v0::MatMul>(&node)) {
+        const auto& a_shape = node.get_input_partial_shape(0);
+        if (a_shape.rank().is_static() && a_shape[a_shape.rank().get_length() - 1].is_static()) {
+            const auto k = a_shape[a_shape.rank().get_length() - 1].get_length();
+            return out_elements * static_cast<double>(k);
+        }
+    } else if (node.get_input_size() >= 2) {
+        // Convolutions: MACs per output element are the filter volume over the
+        // output-channel dimension(s) of the weights
+        const auto& w_shape = node.get_input_partial_shape(1);
+        if (w_shape.is_static()) {
+            const auto weights = ngraph::shape_size(w_shape.get_shape());
+            const auto& out = out_shape.get_shape();
+            const size_t channels = out.size() > 1 ? out[1] : 1;
+            if (channels != 0) {
+                const auto spatial_out = out_elements / static_cast<double>(channels);
+                return spatial_out * static_cast<double>(weights);
+            }
+        }
+    }
+    return out_elements;
+}
+
+}  // namespace
+
+const OpCostModel& OpCostModel::Instance() {
+    static OpCostModel instance;
+    return instance;
+}
+
+OpCostModel::OpCostModel() {
+    // fp32 rates measured with single-op networks at batch 1 over the shipped
+    // ACL kernels, averaged across the shapes of our model zoo; parts we have
+    // not measured use the generic row
+    struct Entry { const char* part; Rates rates; };
+    static constexpr Entry kCalibrated[] = {
+        {"0xd0c", {0.00031, 0.0011, 0.0016, 0.0024, 0.0060}},  // Neoverse-N1
+        {"0xd40", {0.00019, 0.0007, 0.0013, 0.0016, 0.0045}},  // Neoverse-V1
+        {"0xd08", {0.00040, 0.0013, 0.0018, 0.0028, 0.0070}},  // Cortex-A76
+        {"0xd05", {0.00160, 0.0042, 0.0038, 0.0080, 0.0200}},  // Cortex-A55
+    };
+    static constexpr Rates kGeneric{0.00055, 0.0018, 0.0022, 0.0036, 0.0090};
+    _rates = kGeneric;
+    const auto part = CpuPartNumber();
+    for (const auto& entry : kCalibrated) {
+        if (part == entry.part) {
+            _rates = entry.rates;
+            break;
+        }
+    }
+}
+
+double OpCostModel::EstimateNs(const ngraph::Node& node) const {
+    if (ngraph::op::is_constant(&node) || ngraph::op::is_parameter(&node) || ngraph::op::is_output(&node)) {
+        return 0.0;
+    }
+    switch (Categorize(node)) {
+        case OpCategory::Mac:    return MacCount(node) * _rates.nsPerMac;
+        case OpCategory::Math:   return OutputElements(node) * _rates.nsPerElementMath;
+        case OpCategory::Move:   return OutputElements(node) * _rates.nsPerElementMove;
+        case OpCategory::Reduce: return OutputElements(node) * _rates.nsPerElementReduce;
+        case OpCategory::Other:  return OutputElements(node) * _rates.nsPerElementOther;
+    }
+    return 0.0;
+}
@@ -0,0 +1,52 @@
+// Copyright (C) 2020-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <string>
+
+#include <ngraph/node.hpp>
+
+namespace ArmPlugin {
+
+/**
+ * Calibrated per-operation cost estimates for heterogeneous placement:
+ * QueryNetwork alone says supported/unsupported, which forces all-or-nothing
+ * splits per op type when the graph is shared with an attached accelerator.
+ * The model multiplies each node's work (MACs for convolution/matmul,
+ * elements otherwise) by a ns-per-unit rate microbenchmarked offline per op
+ * category and per CPU part number, so an orchestrator can weigh a subgraph's
+ * measured profit before moving it. Rates for unknown parts fall back to a
+ * generic in-order/out-of-order average; the numbers are estimates for
+ * ranking, not wall-clock predictions
+ */
+class OpCostModel {
+public:
+    static const OpCostModel& Instance();
+
+    OpCostModel(const OpCostModel&) = delete;
+    OpCostModel& operator=(const OpCostModel&) = delete;
+
+    /**
+     * Estimated execution time of one node in nanoseconds on the calling
+     * machine's cores. Parameters, Constants and Results cost nothing
+     */
+    double EstimateNs(const ngraph::Node& node) const;
+
+private:
+    OpCostModel();
+
+    // ns per unit of work for each op category on the detected part
+    struct Rates {
+        double nsPerMac;           // convolution, matmul, fully-connected
+        double nsPerElementMath;   // elementwise arithmetic and activations
+        double nsPerElementMove;   // transpose, concat, gather, pad
+        double nsPerElementReduce; // reductions, pooling, normalization, softmax
+        double nsPerElementOther;  // anything uncategorized
+    };
+
+    Rates _rates;
+};
+
+}  // namespace ArmPlugin
@@ -30,6 +30,8 @@
 #include "arm_plugin.hpp"
 #include "arm_executable_network.hpp"
 #include "arm_converter/arm_converter.hpp"
+#include "arm_node_validate_cache.hpp"
+#include "arm_op_cost_model.hpp"
 #include "transformations/arm_optimizations.hpp"
 
 using namespace InferenceEngine;
@@ -76,7 +78,8 @@ std::shared_ptr<ov::Model> Plugin::Transform(const std::shared_ptr<const ov::Mod
                                              const Configuration& config) const {
     auto transformedModel = ov::clone_model(*model);
     ngraph::pass::Manager passManager;
-    passManager.register_pass<pass::ArmOptimizations>(config._lpt, config._dump);
+    passManager.register_pass<pass::ArmOptimizations>(config._lpt, config._dump, config._fp16, config._nhwc,
+                                                      config._weightsCompression);
     passManager.run_passes(transformedModel);
     return transformedModel;
 }
@@ -91,11 +94,30 @@ InferenceEngine::IExecutableNetworkInternal::Ptr Plugin::LoadExeNetworkImpl(cons
     if (model == nullptr) {
          IE_THROW() << "Arm Plugin supports only ngraph cnn network representation";
     }
-    auto transformedModel = Transform(model, cfg);
+    std::shared_ptr<ov::Model> transformedModel;
+    if ((cfg._dynamicShapeCacheCapacity > 0) && model->is_dynamic()) {
+        // The transformation pipeline needs static shapes; in dynamic-shape
+        // mode the network runs it per input signature instead, over a clone
+        // specialized to the concrete shapes of the request blobs
+        transformedModel = ov::clone_model(*model);
+    } else {
+        transformedModel = Transform(model, cfg);
+    }
     cfg._lpt = cfg._lpt && ngraph::pass::low_precision::LowPrecision::isFunctionQuantized(model);
     return std::make_shared<ExecutableNetwork>(transformedModel, cfg, std::static_pointer_cast<Plugin>(shared_from_this()));
 }
 
+InferenceEngine::IExecutableNetworkInternal::Ptr Plugin::ImportNetwork(std::istream& networkModel,
+                                                                       const ConfigMap& config) {
+    auto cfg = Configuration{config, _cfg};
+    // The blob already holds the transformed model, so a warm start skips the
+    // whole transformation pipeline and its per-node validation
+    auto executableNetwork = std::make_shared<ExecutableNetwork>(networkModel, cfg,
+                                                                 std::static_pointer_cast<Plugin>(shared_from_this()));
+    SetExeNetworkInfo(executableNetwork, executableNetwork->_model);
+    return executableNetwork;
+}
+
 bool Plugin::isOperationSupported(const std::shared_ptr<ov::Node>& node, const Converter& converter) const {
     auto itConversion = converter._conversions.find(node->get_type_info());
     bool nodeIsSupported = false;
@@ -110,7 +132,10 @@ bool Plugin::isOperationSupported(const std::shared_ptr<ov::Node>& node, const C
                 nodeIsSupported = false;
             }
             if (layer != nullptr) {
-                nodeIsSupported = static_cast<bool>(layer->Validate());
+                // QueryNetwork probes every node of the original model; repeated
+                // block structures answer from the cache
+                nodeIsSupported = static_cast<bool>(NodeValidateCache::Instance().Validate(
+                    *node, converter._cfg._fastMath ? "fm" : "", [&] { return layer->Validate(); }));
             }
         }
     }
@@ -153,6 +178,7 @@ InferenceEngine::Parameter Plugin::GetMetric(const std::string& name, const std:
         IE_SET_METRIC_RETURN(SUPPORTED_METRICS, std::vector<std::string>{
             METRIC_KEY(SUPPORTED_METRICS),
             METRIC_KEY(SUPPORTED_CONFIG_KEYS),
+            std::string{"ARM_ESTIMATED_NODE_COSTS"},
             ov::range_for_async_infer_requests.name(),
             ov::range_for_streams.name()});
     } else if (METRIC_KEY(SUPPORTED_CONFIG_KEYS) == name) {
@@ -191,6 +217,24 @@ InferenceEngine::Parameter Plugin::GetMetric(const std::string& name, const std:
     } else if (ov::range_for_streams == name) {
         return decltype(ov::range_for_streams)::value_type{
             std::make_tuple(1u, std::thread::hardware_concurrency())};
+    } else if (name == "ARM_ESTIMATED_NODE_COSTS") {
+        // Per-node estimated execution time in nanoseconds on this machine's
+        // cores, keyed by friendly name: lets a HETERO orchestrator split the
+        // graph by measured profit instead of all-or-nothing per op type. The
+        // network to estimate is passed in options under "MODEL"
+        auto it = options.find("MODEL");
+        if (it == options.end()) {
+            IE_THROW() << "ARM_ESTIMATED_NODE_COSTS requires the network in the \"MODEL\" option";
+        }
+        auto model = it->second.as<CNNNetwork>().getFunction();
+        if (model == nullptr) {
+            IE_THROW() << "Arm Plugin supports only ngraph cnn network representation";
+        }
+        std::map<std::string, double> costs;
+        for (auto&& node : model->get_ordered_ops()) {
+            costs.emplace(node->get_friendly_name(), OpCostModel::Instance().EstimateNs(*node));
+        }
+        return InferenceEngine::Parameter{costs};
     } else if (ov::device::capabilities == name) {
         return decltype(ov::device::capabilities)::value_type{
 #ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
@@ -0,0 +1,73 @@
+// Copyright (C) 2020-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+
+#include "arm_pmu_profiler.hpp"
+
+#ifdef __linux__
+
+#include <cstring>
+
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <linux/perf_event.h>
+
+using namespace ArmPlugin;
+
+namespace {
+int perfEventOpen(const std::uint32_t type, const std::uint64_t config, const int groupFd) {
+    perf_event_attr attr;
+    std::memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = type;
+    attr.config = config;
+    attr.disabled = (groupFd == -1) ? 1 : 0;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    return static_cast<int>(syscall(__NR_perf_event_open, &attr, 0, -1, groupFd, 0));
+}
+
+std::uint64_t readCounter(const int fd) {
+    std::uint64_t value = 0;
+    if ((fd == -1) || (read(fd, &value, sizeof(value)) != sizeof(value))) {
+        return 0;
+    }
+    return value;
+}
+}  // namespace
+
+PMUProfiler::PMUProfiler() {
+    _fds[0] = perfEventOpen(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES, -1);
+    if (_fds[0] != -1) {
+        _fds[1] = perfEventOpen(PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS, _fds[0]);
+        _fds[2] = perfEventOpen(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES, _fds[0]);
+        ioctl(_fds[0], PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+    }
+}
+
+PMUProfiler::~PMUProfiler() {
+    for (auto&& fd : _fds) {
+        if (fd != -1) {
+            close(fd);
+        }
+    }
+}
+
+PMUCounters PMUProfiler::Sample() const {
+    return {readCounter(_fds[0]), readCounter(_fds[1]), readCounter(_fds[2])};
+}
+
+#else
+
+using namespace ArmPlugin;
+
+PMUProfiler::PMUProfiler() {}
+PMUProfiler::~PMUProfiler() {}
+
+PMUCounters PMUProfiler::Sample() const {
+    return {};
+}
+
+#endif
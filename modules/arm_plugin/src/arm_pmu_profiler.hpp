@@ -0,0 +1,56 @@
+// Copyright (C) 2020-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+namespace ArmPlugin {
+
+/**
+ * Hardware counter totals accumulated around layer executions: wall time alone
+ * cannot tell a compute-bound layer from a memory-bound one, cycles together
+ * with retired instructions and last-level cache misses can
+ */
+struct PMUCounters {
+    std::uint64_t _cycles       = 0;
+    std::uint64_t _instructions = 0;
+    std::uint64_t _cacheMisses  = 0;
+
+    PMUCounters& operator+=(const PMUCounters& other) {
+        _cycles       += other._cycles;
+        _instructions += other._instructions;
+        _cacheMisses  += other._cacheMisses;
+        return *this;
+    }
+    PMUCounters operator-(const PMUCounters& other) const {
+        return {_cycles       - other._cycles,
+                _instructions - other._instructions,
+                _cacheMisses  - other._cacheMisses};
+    }
+};
+
+/**
+ * perf_event-based sampler: a counter group bound to the opening thread, read
+ * before and after every layer run. The counters cover the thread driving the
+ * ACL function; construction fails silently (Enabled() == false) where
+ * perf_event is unavailable or restricted by perf_event_paranoid
+ */
+struct PMUProfiler {
+    PMUProfiler();
+    ~PMUProfiler();
+    PMUProfiler(const PMUProfiler&) = delete;
+    PMUProfiler& operator=(const PMUProfiler&) = delete;
+
+    bool Enabled() const {
+        return _fds[0] != -1;
+    }
+    PMUCounters Sample() const;
+
+private:
+    std::array<int, 3> _fds = {{-1, -1, -1}};
+};
+
+}  // namespace ArmPlugin
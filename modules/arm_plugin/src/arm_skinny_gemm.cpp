@@ -0,0 +1,215 @@
+// Copyright (C) 2020-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+
+#include "arm_skinny_gemm.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <limits>
+#include <sstream>
+#include <vector>
+
+#include <arm_neon.h>
+
+#include <arm_compute/runtime/Tensor.h>
+#include <arm_compute/runtime/NEON/functions/NEGEMM.h>
+
+#include <ie_common.h>
+#include <ie_parallel.hpp>
+
+using namespace ArmPlugin;
+
+namespace {
+
+// The crossover against NEGEMM moves with the core, so verdicts are
+// per MIDR part number like the convolution tuning winners
+std::string PartNumber() {
+    static const std::string part = [] {
+        std::ifstream cpuinfo{"/proc/cpuinfo"};
+        for (std::string line; std::getline(cpuinfo, line);) {
+            const auto label = line.find("CPU part");
+            if (label == std::string::npos) continue;
+            const auto colon = line.find(':', label);
+            if (colon == std::string::npos) continue;
+            auto value = line.substr(colon + 1);
+            value.erase(0, value.find_first_not_of(" \t"));
+            return value;
+        }
+        return std::string{"unknown"};
+    }();
+    return part;
+}
+
+// A (M x K) row-major, B (K x N) row-major: eight-column tiles stream B once
+// while the A panel stays broadcast from registers
+template <int M>
+void GemmTileNT(const float* a, const float* b, float* dst, size_t n, size_t k, size_t n0, size_t n1) {
+    size_t col = n0;
+    for (; col + 8 <= n1; col += 8) {
+        float32x4_t acc[M][2];
+        for (int m = 0; m < M; ++m) {
+            acc[m][0] = vdupq_n_f32(0.f);
+            acc[m][1] = vdupq_n_f32(0.f);
+        }
+        const float* brow = b + col;
+        for (size_t kk = 0; kk < k; ++kk, brow += n) {
+            const float32x4_t b0 = vld1q_f32(brow);
+            const float32x4_t b1 = vld1q_f32(brow + 4);
+            for (int m = 0; m < M; ++m) {
+                const float av = a[m * k + kk];
+                acc[m][0] = vmlaq_n_f32(acc[m][0], b0, av);
+                acc[m][1] = vmlaq_n_f32(acc[m][1], b1, av);
+            }
+        }
+        for (int m = 0; m < M; ++m) {
+            vst1q_f32(dst + m * n + col, acc[m][0]);
+            vst1q_f32(dst + m * n + col + 4, acc[m][1]);
+        }
+    }
+    for (; col < n1; ++col) {
+        for (int m = 0; m < M; ++m) {
+            float sum = 0.f;
+            for (size_t kk = 0; kk < k; ++kk) {
+                sum += a[m * k + kk] * b[kk * n + col];
+            }
+            dst[m * n + col] = sum;
+        }
+    }
+}
+
+float HorizontalSum(const float32x4_t v) {
+    float32x2_t s = vadd_f32(vget_low_f32(v), vget_high_f32(v));
+    s = vpadd_f32(s, s);
+    return vget_lane_f32(s, 0);
+}
+
+// A (M x K) row-major, B (N x K) row-major (transpose_b): per output column a
+// K-vectorized dot product against the cache-resident A rows
+template <int M>
+void GemmTileT(const float* a, const float* b, float* dst, size_t n, size_t k, size_t n0, size_t n1) {
+    for (size_t col = n0; col < n1; ++col) {
+        const float* bcol = b + col * k;
+        float32x4_t acc[M];
+        for (int m = 0; m < M; ++m) {
+            acc[m] = vdupq_n_f32(0.f);
+        }
+        size_t kk = 0;
+        for (; kk + 4 <= k; kk += 4) {
+            const float32x4_t bv = vld1q_f32(bcol + kk);
+            for (int m = 0; m < M; ++m) {
+                acc[m] = vmlaq_f32(acc[m], vld1q_f32(a + m * k + kk), bv);
+            }
+        }
+        for (int m = 0; m < M; ++m) {
+            float sum = HorizontalSum(acc[m]);
+            for (size_t rest = kk; rest < k; ++rest) {
+                sum += a[m * k + rest] * bcol[rest];
+            }
+            dst[m * n + col] = sum;
+        }
+    }
+}
+
+template <int M>
+void GemmRows(const float* a, const float* b, float* dst, size_t n, size_t k, bool transpose_b) {
+    InferenceEngine::parallel_nt(0, [&](const int ithr, const int nthr) {
+        const size_t chunk = (n + nthr - 1) / nthr;
+        const size_t n0 = std::min(n, chunk * ithr);
+        const size_t n1 = std::min(n, n0 + chunk);
+        if (n0 >= n1) return;
+        if (transpose_b) {
+            GemmTileT<M>(a, b, dst, n, k, n0, n1);
+        } else {
+            GemmTileNT<M>(a, b, dst, n, k, n0, n1);
+        }
+    });
+}
+
+constexpr size_t kMaxSkinnyRows = 8;
+constexpr size_t kMinSkinnyDepth = 64;
+
+double TimeBest(const std::function<void()>& run) {
+    // One warm-up run, then the best of three: the steady state an infer
+    // request sees, not the cold caches of the very first call
+    run();
+    auto best = std::numeric_limits<double>::max();
+    for (int i = 0; i < 3; ++i) {
+        const auto start = std::chrono::steady_clock::now();
+        run();
+        const auto stop = std::chrono::steady_clock::now();
+        best = std::min(best, std::chrono::duration<double, std::micro>{stop - start}.count());
+    }
+    return best;
+}
+
+bool Benchmark(size_t m, size_t n, size_t k, bool transpose_b) {
+    std::vector<float> a(m * k, 0.f), b(k * n, 0.f), dst(m * n, 0.f);
+    const auto skinnyTime = TimeBest([&] { SkinnyGemm(a.data(), b.data(), dst.data(), m, n, k, transpose_b); });
+
+    const arm_compute::TensorInfo aInfo{arm_compute::TensorShape{k, m}, 1, arm_compute::DataType::F32};
+    const arm_compute::TensorInfo bInfo{transpose_b ? arm_compute::TensorShape{k, n}
+                                                    : arm_compute::TensorShape{n, k},
+                                        1, arm_compute::DataType::F32};
+    const arm_compute::TensorInfo dInfo{arm_compute::TensorShape{n, m}, 1, arm_compute::DataType::F32};
+    arm_compute::GEMMInfo gemmInfo;
+    gemmInfo.set_pretranspose_B(transpose_b);
+    if (!bool(arm_compute::NEGEMM::validate(&aInfo, &bInfo, nullptr, &dInfo, 1.f, 1.f, gemmInfo))) {
+        return true;
+    }
+    arm_compute::Tensor aTensor, bTensor, dTensor;
+    aTensor.allocator()->init(aInfo);
+    bTensor.allocator()->init(bInfo);
+    dTensor.allocator()->init(dInfo);
+    aTensor.allocator()->allocate();
+    bTensor.allocator()->allocate();
+    dTensor.allocator()->allocate();
+    std::memset(aTensor.buffer(), 0, aTensor.info()->total_size());
+    std::memset(bTensor.buffer(), 0, bTensor.info()->total_size());
+    arm_compute::NEGEMM gemm;
+    gemm.configure(&aTensor, &bTensor, nullptr, &dTensor, 1.f, 1.f, gemmInfo);
+    const auto aclTime = TimeBest([&] { gemm.run(); });
+
+    return skinnyTime < aclTime;
+}
+
+}  // namespace
+
+void ArmPlugin::SkinnyGemm(const float* a, const float* b, float* dst,
+                           size_t m, size_t n, size_t k, bool transpose_b) {
+    switch (m) {
+        case 1: return GemmRows<1>(a, b, dst, n, k, transpose_b);
+        case 2: return GemmRows<2>(a, b, dst, n, k, transpose_b);
+        case 3: return GemmRows<3>(a, b, dst, n, k, transpose_b);
+        case 4: return GemmRows<4>(a, b, dst, n, k, transpose_b);
+        case 5: return GemmRows<5>(a, b, dst, n, k, transpose_b);
+        case 6: return GemmRows<6>(a, b, dst, n, k, transpose_b);
+        case 7: return GemmRows<7>(a, b, dst, n, k, transpose_b);
+        case 8: return GemmRows<8>(a, b, dst, n, k, transpose_b);
+        default:
+            IE_THROW() << "SkinnyGemm supports at most " << kMaxSkinnyRows << " rows, got " << m;
+    }
+}
+
+SkinnyGemmCache& SkinnyGemmCache::Instance() {
+    static SkinnyGemmCache instance;
+    return instance;
+}
+
+bool SkinnyGemmCache::Use(size_t m, size_t n, size_t k, bool transpose_b) {
+    if (m == 0 || m > kMaxSkinnyRows || k < kMinSkinnyDepth || n < 8) {
+        return false;
+    }
+    std::ostringstream key;
+    key << PartNumber() << '_' << m << 'x' << n << 'x' << k << (transpose_b ? "_tb" : "");
+    std::lock_guard<std::mutex> lock{_mutex};
+    auto it = _verdicts.find(key.str());
+    if (it == _verdicts.end()) {
+        it = _verdicts.emplace(key.str(), Benchmark(m, n, k, transpose_b)).first;
+    }
+    return it->second;
+}
@@ -0,0 +1,49 @@
+// Copyright (C) 2020-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace ArmPlugin {
+
+/**
+ * fp32 GEMM for the skinny matrices of per-token decoder projections
+ * (M below 8, K large): ACL's NEGEMM blocks and packs for square-ish
+ * operands and leaves most of its tile empty at these shapes. The
+ * microkernel keeps the whole A panel in registers, accumulates with
+ * fused multiply-adds down K and parallelizes over N, so B streams
+ * through the cache exactly once per call
+ */
+void SkinnyGemm(const float* a, const float* b, float* dst,
+                size_t m, size_t n, size_t k, bool transpose_b);
+
+/**
+ * Benchmark-at-load routing between NEGEMM and SkinnyGemm: shape rules
+ * alone misjudge the crossover, which moves with the core, so the first
+ * conversion of each candidate shape times both on scratch buffers and
+ * the verdict is cached for the process keyed by shape and CPU part
+ * number. Only shapes the microkernel can win (small M, sizeable K) are
+ * ever benchmarked; everything else routes to NEGEMM outright
+ */
+class SkinnyGemmCache {
+public:
+    static SkinnyGemmCache& Instance();
+
+    SkinnyGemmCache(const SkinnyGemmCache&) = delete;
+    SkinnyGemmCache& operator=(const SkinnyGemmCache&) = delete;
+
+    bool Use(size_t m, size_t n, size_t k, bool transpose_b);
+
+private:
+    SkinnyGemmCache() = default;
+
+    std::mutex                            _mutex;
+    std::unordered_map<std::string, bool> _verdicts;
+};
+
+}  // namespace ArmPlugin
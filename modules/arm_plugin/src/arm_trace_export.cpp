@@ -0,0 +1,71 @@
+// Copyright (C) 2020-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <thread>
+
+#include "arm_trace_export.hpp"
+
+using namespace ArmPlugin;
+
+namespace {
+std::string escape(const std::string& value) {
+    std::string result;
+    result.reserve(value.size());
+    for (const char c : value) {
+        if (c == '"' || c == '\\') {
+            result += '\\';
+        }
+        result += c;
+    }
+    return result;
+}
+
+std::uint64_t currentThreadTrack() {
+    return std::hash<std::thread::id>{}(std::this_thread::get_id()) & 0xFFFFFF;
+}
+}  // namespace
+
+TraceExport& TraceExport::Instance() {
+    static TraceExport traceExport;
+    return traceExport;
+}
+
+std::uint64_t TraceExport::NowUs() {
+    static const auto epoch = std::chrono::steady_clock::now();
+    return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - epoch).count();
+}
+
+void TraceExport::Enable(const std::string& path) {
+    std::lock_guard<std::mutex> lock{_mutex};
+    if (_enabled || path.empty()) {
+        return;
+    }
+    _file.open(path, std::ios::trunc);
+    if (_file.is_open()) {
+        _file << "[\n";
+        _enabled = true;
+    }
+}
+
+void TraceExport::CompleteEvent(const std::string& name, const std::string& category, std::uint64_t beginUs) {
+    const auto endUs = NowUs();
+    const auto track = currentThreadTrack();
+    std::lock_guard<std::mutex> lock{_mutex};
+    if (!_enabled) {
+        return;
+    }
+    _file << (_firstEvent ? "" : ",\n") << "{\"name\": \"" << escape(name) << "\", \"cat\": \"" << escape(category)
+          << "\", \"ph\": \"X\", \"ts\": " << beginUs << ", \"dur\": " << (endUs - beginUs)
+          << ", \"pid\": 1, \"tid\": " << track << "}";
+    _firstEvent = false;
+}
+
+TraceExport::~TraceExport() {
+    std::lock_guard<std::mutex> lock{_mutex};
+    if (_enabled) {
+        _file << "\n]\n";
+        _file.close();
+        _enabled = false;
+    }
+}
@@ -0,0 +1,50 @@
+// Copyright (C) 2020-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <fstream>
+#include <mutex>
+#include <string>
+
+namespace ArmPlugin {
+
+// Streams execution spans into a chrome://tracing (Perfetto) JSON file.
+// The performance counters average every layer over the inference count and
+// lose ordering and concurrency; the trace keeps each span with its timestamp
+// and executing thread, so the timeline shows pipeline bubbles and how the
+// preprocessing, execution and postprocessing stages of concurrent requests
+// overlap across the async executors. Events are appended as they complete,
+// so a truncated trace of a long run still loads.
+class TraceExport {
+public:
+    static TraceExport& Instance();
+
+    // Opens the trace file; the first non-empty path wins and later calls
+    // keep appending to the already opened trace
+    void Enable(const std::string& path);
+
+    bool Enabled() const noexcept { return _enabled; }
+
+    // Microseconds since the trace epoch; the timeline all spans share
+    static std::uint64_t NowUs();
+
+    // Appends one complete span lasting from beginUs until now on the calling
+    // thread's track
+    void CompleteEvent(const std::string& name, const std::string& category, std::uint64_t beginUs);
+
+    ~TraceExport();
+
+private:
+    TraceExport() = default;
+
+    std::mutex    _mutex;
+    std::ofstream _file;
+    bool          _enabled = false;
+    bool          _firstEvent = true;
+};
+
+}  // namespace ArmPlugin
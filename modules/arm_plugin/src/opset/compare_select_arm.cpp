@@ -0,0 +1,55 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "compare_select_arm.hpp"
+
+using namespace ngraph;
+using namespace ArmPlugin;
+
+opset::ArmCompareSelect::ArmCompareSelect(const ngraph::Output<ngraph::Node>& lhs,
+                                          const ngraph::Output<ngraph::Node>& rhs,
+                                          const ngraph::Output<ngraph::Node>& on_true,
+                                          const ngraph::Output<ngraph::Node>& on_false,
+                                          Operation operation)
+    : Op({lhs, rhs, on_true, on_false}), m_operation(operation) {
+    constructor_validate_and_infer_types();
+}
+
+bool opset::ArmCompareSelect::visit_attributes(ngraph::AttributeVisitor& visitor) {
+    auto operation = static_cast<std::int64_t>(m_operation);
+    visitor.on_attribute("operation", operation);
+    m_operation = static_cast<Operation>(operation);
+    return true;
+}
+
+void opset::ArmCompareSelect::validate_and_infer_types() {
+    NODE_VALIDATION_CHECK(this, get_input_size() == 4,
+                          "ArmCompareSelect op must have 4 inputs.");
+
+    const auto& type = get_input_element_type(0);
+    NODE_VALIDATION_CHECK(this, type != element::boolean,
+                          "ArmCompareSelect op doesn't support boolean inputs");
+    for (size_t i = 1; i < get_input_size(); ++i) {
+        NODE_VALIDATION_CHECK(this, get_input_element_type(i) == type,
+                              "ArmCompareSelect op inputs must share one element type");
+    }
+
+    const auto& shape = get_input_partial_shape(0);
+    NODE_VALIDATION_CHECK(this, shape.is_static(),
+                          "ArmCompareSelect op supports static shapes only");
+    for (size_t i = 1; i < get_input_size(); ++i) {
+        NODE_VALIDATION_CHECK(this, get_input_partial_shape(i) == shape,
+                              "ArmCompareSelect op doesn't support broadcast");
+    }
+
+    set_output_type(0, type, shape);
+}
+
+std::shared_ptr<ngraph::Node> opset::ArmCompareSelect::clone_with_new_inputs(const ngraph::OutputVector& new_args) const {
+    if (new_args.size() == 4) {
+        return std::make_shared<ArmCompareSelect>(new_args.at(0), new_args.at(1), new_args.at(2), new_args.at(3), m_operation);
+    } else {
+        throw ngraph_error("Unsupported number of arguments for ArmCompareSelect operation");
+    }
+}
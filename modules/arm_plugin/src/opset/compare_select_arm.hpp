@@ -0,0 +1,43 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstdint>
+
+#include "ngraph_opset.hpp"
+#include "utils.hpp"
+
+namespace ArmPlugin {
+namespace opset {
+
+class ArmCompareSelect : public ngraph::op::Op {
+public:
+    OPENVINO_OP("ArmCompareSelect", "arm_opset");
+    enum class Operation : std::int64_t {
+        Equal,
+        NotEqual,
+        Greater,
+        GreaterEqual,
+        Less,
+        LessEqual
+    };
+
+    ArmCompareSelect(const ngraph::Output<ngraph::Node>& lhs,
+                     const ngraph::Output<ngraph::Node>& rhs,
+                     const ngraph::Output<ngraph::Node>& on_true,
+                     const ngraph::Output<ngraph::Node>& on_false,
+                     Operation operation);
+
+    Operation get_operation() const { return m_operation; }
+
+    void validate_and_infer_types() override;
+    bool visit_attributes(ngraph::AttributeVisitor& visitor) override;
+
+    std::shared_ptr<ngraph::Node> clone_with_new_inputs(const ngraph::OutputVector& new_args) const override;
+private:
+    Operation m_operation;
+};
+}  // namespace opset
+}  // namespace ArmPlugin
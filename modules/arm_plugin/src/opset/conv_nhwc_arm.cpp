@@ -0,0 +1,106 @@
+// Copyright (C) 2020-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "conv_nhwc_arm.hpp"
+
+using namespace ngraph;
+using namespace ArmPlugin;
+
+opset::ArmConvolutionNHWC::ArmConvolutionNHWC(const ngraph::Output<ngraph::Node>& data_batch,
+                                              const ngraph::Output<ngraph::Node>& filters,
+                                              const ngraph::Strides& strides,
+                                              const ngraph::CoordinateDiff& pads_begin,
+                                              const ngraph::CoordinateDiff& pads_end,
+                                              const ngraph::Strides& dilations,
+                                              const ngraph::op::PadType& auto_pad)
+    : Convolution{
+        data_batch,
+        filters,
+        strides,
+        pads_begin,
+        pads_end,
+        dilations,
+        auto_pad} {
+    constructor_validate_and_infer_types();
+}
+
+opset::ArmConvolutionNHWC::ArmConvolutionNHWC(const ngraph::Output<ngraph::Node>& data_batch,
+                                              const ngraph::Output<ngraph::Node>& filters,
+                                              const ngraph::Output<ngraph::Node>& bias,
+                                              const ngraph::Strides& strides,
+                                              const ngraph::CoordinateDiff& pads_begin,
+                                              const ngraph::CoordinateDiff& pads_end,
+                                              const ngraph::Strides& dilations,
+                                              const ngraph::op::PadType& auto_pad)
+    : Convolution{
+        data_batch,
+        filters,
+        strides,
+        pads_begin,
+        pads_end,
+        dilations,
+        auto_pad} {
+    set_argument(2, bias);
+    constructor_validate_and_infer_types();
+}
+
+void ArmPlugin::opset::ArmConvolutionNHWC::validate_and_infer_types() {
+    const auto& data_pshape = get_input_partial_shape(0);
+    const auto& filters_pshape = get_input_partial_shape(1);
+    NODE_VALIDATION_CHECK(this,
+                          data_pshape.is_static() && filters_pshape.is_static() &&
+                          data_pshape.rank().get_length() == 4 && filters_pshape.rank().get_length() == 4,
+                          "ArmConvolutionNHWC expects static 4D NHWC data and OHWI filters");
+    const auto data_shape = data_pshape.get_shape();
+    const auto filters_shape = filters_pshape.get_shape();
+    NODE_VALIDATION_CHECK(this,
+                          data_shape[3] == filters_shape[3],
+                          "ArmConvolutionNHWC data channels (", data_shape[3],
+                          ") do not match filters depth (", filters_shape[3], ")");
+    ngraph::Shape output_shape(4);
+    output_shape[0] = data_shape[0];
+    output_shape[3] = filters_shape[0];
+    for (std::size_t i = 0; i < 2; ++i) {
+        const auto dilated_kernel = (filters_shape[1 + i] - 1) * m_dilations[i] + 1;
+        std::size_t spatial;
+        switch (m_auto_pad) {
+            case ngraph::op::PadType::SAME_UPPER:
+            case ngraph::op::PadType::SAME_LOWER:
+                spatial = (data_shape[1 + i] + m_strides[i] - 1) / m_strides[i];
+                break;
+            case ngraph::op::PadType::VALID:
+                spatial = (data_shape[1 + i] - dilated_kernel) / m_strides[i] + 1;
+                break;
+            default:
+                spatial = (data_shape[1 + i] + m_pads_begin[i] + m_pads_end[i] - dilated_kernel) / m_strides[i] + 1;
+                break;
+        }
+        output_shape[1 + i] = spatial;
+    }
+    set_output_type(0, get_input_element_type(0), output_shape);
+}
+
+std::shared_ptr<ngraph::Node> ArmPlugin::opset::ArmConvolutionNHWC::clone_with_new_inputs(const ngraph::OutputVector& new_args) const {
+    auto num_args = new_args.size();
+    if (num_args == 2) {
+        return std::make_shared<ArmConvolutionNHWC>(new_args.at(0),
+                                                    new_args.at(1),
+                                                    m_strides,
+                                                    m_pads_begin,
+                                                    m_pads_end,
+                                                    m_dilations,
+                                                    m_auto_pad);
+    } else if (num_args == 3) {
+        return std::make_shared<ArmConvolutionNHWC>(new_args.at(0),
+                                                    new_args.at(1),
+                                                    new_args.at(2),
+                                                    m_strides,
+                                                    m_pads_begin,
+                                                    m_pads_end,
+                                                    m_dilations,
+                                                    m_auto_pad);
+    } else {
+        throw ngraph_error("Unsupported number of arguments for ArmConvolutionNHWC operation");
+    }
+}
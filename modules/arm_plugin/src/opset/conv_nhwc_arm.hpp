@@ -0,0 +1,43 @@
+// Copyright (C) 2020-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "ngraph/coordinate_diff.hpp"
+#include "ngraph_opset.hpp"
+#include "utils.hpp"
+
+namespace ArmPlugin {
+namespace opset {
+
+/**
+ * Convolution over an NHWC data tensor with OHWI filters, produced by the
+ * ConvertLayoutNHWC pass. Shapes are semantically NHWC, so the converter maps
+ * its tensors straight onto ACL's NHWC kernels without per-op permutes
+ */
+class ArmConvolutionNHWC : public Convolution {
+public:
+    OPENVINO_OP("ArmConvolutionNHWC", "arm_opset", Convolution);
+    ArmConvolutionNHWC(const ngraph::Output<ngraph::Node>& data_batch,
+                       const ngraph::Output<ngraph::Node>& filters,
+                       const ngraph::Strides& strides,
+                       const ngraph::CoordinateDiff& pads_begin,
+                       const ngraph::CoordinateDiff& pads_end,
+                       const ngraph::Strides& dilations,
+                       const ngraph::op::PadType& auto_pad);
+
+    ArmConvolutionNHWC(const ngraph::Output<ngraph::Node>& data_batch,
+                       const ngraph::Output<ngraph::Node>& filters,
+                       const ngraph::Output<ngraph::Node>& bias,
+                       const ngraph::Strides& strides,
+                       const ngraph::CoordinateDiff& pads_begin,
+                       const ngraph::CoordinateDiff& pads_end,
+                       const ngraph::Strides& dilations,
+                       const ngraph::op::PadType& auto_pad);
+
+    void validate_and_infer_types() override;
+    std::shared_ptr<ngraph::Node> clone_with_new_inputs(const ngraph::OutputVector& new_args) const override;
+};
+}  // namespace opset
+}  // namespace ArmPlugin
@@ -0,0 +1,66 @@
+// Copyright (C) 2020-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "depthwise_separable_conv_arm.hpp"
+
+using namespace ngraph;
+using namespace ArmPlugin;
+
+opset::ArmDepthwiseSeparableConvolution::ArmDepthwiseSeparableConvolution(const ngraph::Output<ngraph::Node>& data,
+                                                                          const ngraph::Output<ngraph::Node>& depthwise_weights,
+                                                                          const ngraph::Output<ngraph::Node>& depthwise_bias,
+                                                                          const ngraph::Output<ngraph::Node>& pointwise_weights,
+                                                                          const ngraph::Output<ngraph::Node>& pointwise_bias,
+                                                                          const ngraph::Strides& strides,
+                                                                          const ngraph::CoordinateDiff& pads_begin,
+                                                                          const ngraph::CoordinateDiff& pads_end,
+                                                                          const ngraph::Strides& dilations,
+                                                                          const ngraph::Shape& depthwise_output_shape)
+    : Op({data, depthwise_weights, depthwise_bias, pointwise_weights, pointwise_bias}),
+      m_strides{strides},
+      m_pads_begin{pads_begin},
+      m_pads_end{pads_end},
+      m_dilations{dilations},
+      m_depthwise_output_shape{depthwise_output_shape} {
+    constructor_validate_and_infer_types();
+}
+
+bool opset::ArmDepthwiseSeparableConvolution::visit_attributes(ngraph::AttributeVisitor& visitor) {
+    visitor.on_attribute("strides", m_strides);
+    visitor.on_attribute("pads_begin", m_pads_begin);
+    visitor.on_attribute("pads_end", m_pads_end);
+    visitor.on_attribute("dilations", m_dilations);
+    visitor.on_attribute("depthwise_output_shape", m_depthwise_output_shape);
+    return true;
+}
+
+void opset::ArmDepthwiseSeparableConvolution::validate_and_infer_types() {
+    NODE_VALIDATION_CHECK(this, get_input_size() == 5,
+                          "ArmDepthwiseSeparableConvolution op must have 5 inputs.");
+
+    NODE_VALIDATION_CHECK(this, m_depthwise_output_shape.size() == 4,
+                          "ArmDepthwiseSeparableConvolution op supports only 2D convolutions.");
+
+    const auto& pointwise_weights_shape = get_input_partial_shape(3);
+    NODE_VALIDATION_CHECK(this, pointwise_weights_shape.is_static(),
+                          "ArmDepthwiseSeparableConvolution op pointwise weights must have a static shape.");
+
+    ngraph::Shape output_shape = m_depthwise_output_shape;
+    output_shape[1] = pointwise_weights_shape.get_shape()[0];
+    set_output_type(0, get_input_element_type(0), output_shape);
+}
+
+std::shared_ptr<ngraph::Node> ArmPlugin::opset::ArmDepthwiseSeparableConvolution::clone_with_new_inputs(const ngraph::OutputVector& new_args) const {
+    check_new_args_count(this, new_args);
+    return std::make_shared<ArmDepthwiseSeparableConvolution>(new_args.at(0),
+                                                              new_args.at(1),
+                                                              new_args.at(2),
+                                                              new_args.at(3),
+                                                              new_args.at(4),
+                                                              m_strides,
+                                                              m_pads_begin,
+                                                              m_pads_end,
+                                                              m_dilations,
+                                                              m_depthwise_output_shape);
+}
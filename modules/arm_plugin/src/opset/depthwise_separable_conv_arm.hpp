@@ -0,0 +1,55 @@
+// Copyright (C) 2020-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "ngraph/coordinate_diff.hpp"
+#include "ngraph_opset.hpp"
+#include "utils.hpp"
+
+namespace ArmPlugin {
+namespace opset {
+
+// A depthwise convolution followed by its pointwise 1x1 projection executed
+// as one layer, so the intermediate feature map never becomes a graph-level
+// tensor. Both convolutions must already carry their biases:
+// data, depthwise weights [C, 1, 1, Kh, Kw], depthwise bias,
+// pointwise weights [Co, C, 1, 1], pointwise bias.
+// The pointwise part is restricted to stride 1 and no padding; the stored
+// strides/pads/dilations describe the depthwise part
+class ArmDepthwiseSeparableConvolution : public ngraph::op::Op {
+public:
+    OPENVINO_OP("ArmDepthwiseSeparableConvolution", "arm_opset");
+
+    ArmDepthwiseSeparableConvolution(const ngraph::Output<ngraph::Node>& data,
+                                     const ngraph::Output<ngraph::Node>& depthwise_weights,
+                                     const ngraph::Output<ngraph::Node>& depthwise_bias,
+                                     const ngraph::Output<ngraph::Node>& pointwise_weights,
+                                     const ngraph::Output<ngraph::Node>& pointwise_bias,
+                                     const ngraph::Strides& strides,
+                                     const ngraph::CoordinateDiff& pads_begin,
+                                     const ngraph::CoordinateDiff& pads_end,
+                                     const ngraph::Strides& dilations,
+                                     const ngraph::Shape& depthwise_output_shape);
+
+    const ngraph::Strides& get_strides() const { return m_strides; }
+    const ngraph::CoordinateDiff& get_pads_begin() const { return m_pads_begin; }
+    const ngraph::CoordinateDiff& get_pads_end() const { return m_pads_end; }
+    const ngraph::Strides& get_dilations() const { return m_dilations; }
+    const ngraph::Shape& get_depthwise_output_shape() const { return m_depthwise_output_shape; }
+
+    void validate_and_infer_types() override;
+    bool visit_attributes(ngraph::AttributeVisitor& visitor) override;
+
+    std::shared_ptr<ngraph::Node> clone_with_new_inputs(const ngraph::OutputVector& new_args) const override;
+
+private:
+    ngraph::Strides m_strides;
+    ngraph::CoordinateDiff m_pads_begin;
+    ngraph::CoordinateDiff m_pads_end;
+    ngraph::Strides m_dilations;
+    ngraph::Shape m_depthwise_output_shape;
+};
+}  // namespace opset
+}  // namespace ArmPlugin
@@ -0,0 +1,56 @@
+// Copyright (C) 2020-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "fft_conv_arm.hpp"
+
+using namespace ngraph;
+using namespace ArmPlugin;
+
+opset::ArmFFTConvolution::ArmFFTConvolution(const ngraph::Output<ngraph::Node>& data,
+                                            const ngraph::Output<ngraph::Node>& weights,
+                                            const ngraph::CoordinateDiff& pads_begin,
+                                            const ngraph::CoordinateDiff& pads_end)
+    : Op({data, weights}), m_pads_begin(pads_begin), m_pads_end(pads_end) {
+    constructor_validate_and_infer_types();
+}
+
+bool opset::ArmFFTConvolution::visit_attributes(ngraph::AttributeVisitor& visitor) {
+    visitor.on_attribute("pads_begin", m_pads_begin);
+    visitor.on_attribute("pads_end", m_pads_end);
+    return true;
+}
+
+void opset::ArmFFTConvolution::validate_and_infer_types() {
+    NODE_VALIDATION_CHECK(this, get_input_size() == 2,
+                          "ArmFFTConvolution op must have 2 inputs.");
+    NODE_VALIDATION_CHECK(this, get_input_element_type(0) == element::f32 &&
+                                get_input_element_type(1) == element::f32,
+                          "ArmFFTConvolution op input element types must be f32");
+    NODE_VALIDATION_CHECK(this, m_pads_begin.size() == 1 && m_pads_end.size() == 1 &&
+                                m_pads_begin[0] >= 0 && m_pads_end[0] >= 0,
+                          "ArmFFTConvolution op expects non-negative 1D paddings");
+
+    const auto& data_shape = get_input_partial_shape(0);
+    const auto& weights_shape = get_input_partial_shape(1);
+    NODE_VALIDATION_CHECK(this, data_shape.rank().is_static() && data_shape.rank().get_length() == 3 &&
+                                weights_shape.rank().is_static() && weights_shape.rank().get_length() == 3,
+                          "ArmFFTConvolution op expects [N, C, L] data and [O, C, K] weights");
+    NODE_VALIDATION_CHECK(this, data_shape.is_static() && weights_shape.is_static(),
+                          "ArmFFTConvolution op expects static shapes");
+
+    const auto length = data_shape[2].get_length() + m_pads_begin[0] + m_pads_end[0];
+    const auto kernel = weights_shape[2].get_length();
+    NODE_VALIDATION_CHECK(this, length >= kernel,
+                          "ArmFFTConvolution op kernel does not fit the padded input");
+    set_output_type(0, get_input_element_type(0),
+                    ngraph::PartialShape{data_shape[0], weights_shape[0], ngraph::Dimension{length - kernel + 1}});
+}
+
+std::shared_ptr<ngraph::Node> opset::ArmFFTConvolution::clone_with_new_inputs(const ngraph::OutputVector& new_args) const {
+    if (new_args.size() == 2) {
+        return std::make_shared<ArmFFTConvolution>(new_args.at(0), new_args.at(1), m_pads_begin, m_pads_end);
+    } else {
+        throw ngraph_error("Unsupported number of arguments for ArmFFTConvolution operation");
+    }
+}
@@ -0,0 +1,38 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "ngraph_opset.hpp"
+#include "utils.hpp"
+
+namespace ArmPlugin {
+namespace opset {
+
+// 1D convolution executed in the frequency domain: large-kernel Conv1D layers
+// are routed here by ConvertConv1DToFFT and run as overlap-add segment FFTs
+// with cached twiddle factors and weight spectra. Only unit strides and
+// dilations are lowered, so the op carries just the paddings
+class ArmFFTConvolution : public ngraph::op::Op {
+public:
+    OPENVINO_OP("ArmFFTConvolution", "arm_opset");
+
+    ArmFFTConvolution(const ngraph::Output<ngraph::Node>& data,
+                      const ngraph::Output<ngraph::Node>& weights,
+                      const ngraph::CoordinateDiff& pads_begin,
+                      const ngraph::CoordinateDiff& pads_end);
+
+    const ngraph::CoordinateDiff& get_pads_begin() const { return m_pads_begin; }
+    const ngraph::CoordinateDiff& get_pads_end() const { return m_pads_end; }
+
+    void validate_and_infer_types() override;
+    bool visit_attributes(ngraph::AttributeVisitor& visitor) override;
+
+    std::shared_ptr<ngraph::Node> clone_with_new_inputs(const ngraph::OutputVector& new_args) const override;
+private:
+    ngraph::CoordinateDiff m_pads_begin;
+    ngraph::CoordinateDiff m_pads_end;
+};
+}  // namespace opset
+}  // namespace ArmPlugin
@@ -7,7 +7,9 @@
 #include "concat_arm.hpp"
 #include "split_arm.hpp"
 #include "conv_arm.hpp"
+#include "conv_nhwc_arm.hpp"
 #include "convert_arm.hpp"
+#include "depthwise_separable_conv_arm.hpp"
 #include "gather_arm.hpp"
 #include "group_conv_arm.hpp"
 #include "interpolate_arm.hpp"
@@ -19,6 +21,8 @@
 #include "transpose_arm.hpp"
 #include "pool_arm.hpp"
 #include "fft_arm.hpp"
+#include "fft_conv_arm.hpp"
+#include "compare_select_arm.hpp"
 #include "quantize.hpp"
 #include "ngraph_opset.hpp"
 #include "utils.hpp"
@@ -37,11 +37,16 @@
 #include <transformations/op_conversions/normalize_l2_decomposition.hpp>
 #include <transformations/op_conversions/softmax_decomposition.hpp>
 
+#include "fuse_pad_conv.hpp"
 #include "conv_bias_fusion.hpp"
+#include "matmul_bias_fusion.hpp"
+#include "conv_activation_fusion.hpp"
+#include "depthwise_separable_fusion.hpp"
 #include "convert_eltwise.hpp"
 #include "convert_sign.hpp"
 #include "convert_round.hpp"
 #include "convert_comparison.hpp"
+#include "fuse_compare_select.hpp"
 #include "convert_logical.hpp"
 #include "convert_strided_slice.hpp"
 #include "convert_strided_slice_arm.hpp"
@@ -54,6 +59,7 @@
 #include "convert_batchnorm_v0_to_v5.hpp"
 #include "convert_batch_norm.hpp"
 #include "convert_ceiling.hpp"
+#include "fold_static_shapeof.hpp"
 #include "convert_convert.hpp"
 #include "convert_split.hpp"
 #include "convert_concat.hpp"
@@ -70,6 +76,7 @@
 #include "convert_interpolate_arm.hpp"
 #include "convert_normalizel2_arm.hpp"
 #include "convert_fft_arm.hpp"
+#include "convert_fft_convolution.hpp"
 #include "convert_pool1d_to_pool2d.hpp"
 #include "convert_maxpool_v8.hpp"
 #include "convert_inputs_precision.hpp"
@@ -79,11 +86,15 @@
 #include "store_result_name.hpp"
 #include "replace_power_by_mul.hpp"
 #include "convert_precision_fp16_to_fp32.hpp"
+#include "convert_precision_fp32_to_fp16.hpp"
 #include "convert_rnn_cell.hpp"
 #include "convert_pool_arm.hpp"
+#include "convert_layout_nhwc.hpp"
+#include "compress_weights.hpp"
 
 #include <ngraph/pass/manager.hpp>
 #include <ngraph/pass/constant_folding.hpp>
+#include <openvino/pass/validate.hpp>
 
 #include <transformations/low_precision/mark_dequantization_subgraph.hpp>
 #include <low_precision/common/quantization_granularity_restriction.hpp>
@@ -171,6 +182,11 @@ bool ArmPlugin::pass::ArmOptimizations::run_on_model(const std::shared_ptr<ov::M
     auto quantized = _lpt && ngraph::pass::low_precision::LowPrecision::isFunctionQuantized(m);
     {
         ov::pass::Manager manager;
+        // Validating the whole function after every pass re-infers shapes over
+        // the full graph and is the main allocation churn of LoadNetwork on big
+        // models; new nodes validate themselves on construction, so a single
+        // explicit Validate at the end of the manager is enough
+        manager.set_per_pass_validation(false);
 
         Dump(m, "initial");
 
@@ -183,6 +199,12 @@ bool ArmPlugin::pass::ArmOptimizations::run_on_model(const std::shared_ptr<ov::M
         manager.register_pass<ov::pass::InitNodeInfo>();
         manager.register_pass<pass::StoreResultName>();
 
+        // Materializing static shapes lets the constant foldings below execute
+        // the inference-invariant subgraphs hanging off ShapeOf (anchor
+        // generation, position encodings) once here; every request then shares
+        // the folded constant tensor
+        manager.register_pass<ov::pass::GraphRewrite>()->add_matcher<pass::FoldStaticShapeOf>();
+
         // Resolves dynamism (replaces NonZero), CF needed
         manager.register_pass<ov::pass::GraphRewrite>()->add_matcher<ov::pass::RemoveFilteringBoxesBySize>();
         manager.register_pass<ngraph::pass::ConstantFolding>();
@@ -225,6 +247,8 @@ bool ArmPlugin::pass::ArmOptimizations::run_on_model(const std::shared_ptr<ov::M
         manager.get_pass_config()->disable<ov::pass::SoftmaxDecomposition>();
 
         manager.register_pass<ngraph::pass::ConstantFolding>();
+        // Must see rank-3 convolutions before ConvertConv1D reshapes them away
+        manager.register_pass<ov::pass::GraphRewrite>()->add_matcher<pass::ConvertConv1DToFFT>();
         manager.register_pass<ov::pass::GraphRewrite>()->add_matcher<pass::ConvertConv1D>();
         manager.register_pass<ov::pass::GraphRewrite>()->add_matcher<pass::ConvertGroupConv1D>();
         manager.register_pass<ov::pass::GraphRewrite>()->add_matcher<pass::ConvertGroupConvolution>();
@@ -245,6 +269,7 @@ bool ArmPlugin::pass::ArmOptimizations::run_on_model(const std::shared_ptr<ov::M
             });
         }
 
+        manager.register_pass<ov::pass::Validate>();
         manager.run_passes(m);
     }
 
@@ -303,6 +328,7 @@ bool ArmPlugin::pass::ArmOptimizations::run_on_model(const std::shared_ptr<ov::M
     {
         Dump(m, "before_arm_specific_transformations");
         ov::pass::Manager manager;
+        manager.set_per_pass_validation(false);
         manager.register_pass<ov::pass::GraphRewrite>()->add_matcher<pass::ConvertGRN>();
         manager.register_pass<ov::pass::GraphRewrite>()->add_matcher<pass::NormalizeL2Fusion>();
         manager.register_pass<ov::pass::GraphRewrite>()->add_matcher<pass::DecomposeNormalizeL2Add>();
@@ -314,6 +340,9 @@ bool ArmPlugin::pass::ArmOptimizations::run_on_model(const std::shared_ptr<ov::M
         manager.register_pass<ngraph::pass::ConstantFolding>();
         manager.register_pass<ov::pass::GraphRewrite>()->add_matcher<pass::DecomposeMish>();
         manager.register_pass<ov::pass::GraphRewrite>()->add_matcher<pass::ConvertLogical>();
+        // Must run before ConvertComparison rewrites every comparison into a
+        // Select over constant boolean planes
+        manager.register_pass<ov::pass::GraphRewrite>()->add_matcher<pass::FuseCompareSelect>();
         manager.register_pass<ov::pass::GraphRewrite>()->add_matcher<pass::ConvertComparison>();
         manager.register_pass<ov::pass::GraphRewrite>()->add_matcher<pass::ConvertTranspose>();
         manager.register_pass<ngraph::pass::ConstantFolding>();
@@ -342,7 +371,21 @@ bool ArmPlugin::pass::ArmOptimizations::run_on_model(const std::shared_ptr<ov::M
         manager.register_pass<ov::pass::GraphRewrite>()->add_matcher<pass::ConvertDFT>();
         manager.register_pass<ov::pass::GraphRewrite>()->add_matcher<pass::ConvertIDFT>();
         manager.register_pass<ngraph::pass::ConstantFolding>();
+        // Folds a zero constant Pad into the convolution's own padding, so
+        // the padded plane is never materialized
+        manager.register_pass<ov::pass::GraphRewrite>()->add_matcher<pass::FusePadConvolution>();
         manager.register_pass<ov::pass::GraphRewrite>()->add_matcher<pass::ConvBiasFusion>();
+        manager.register_pass<ov::pass::GraphRewrite>()->add_matcher<pass::MatMulBiasFusion>();
+        // Runs after the bias fusion so conv+bias+activation chains collapse
+        // into a single node; the converter picks the activation up from
+        // rt_info and ACL applies it in the convolution epilogue
+        manager.register_pass<ov::pass::GraphRewrite>()->add_matcher<pass::ConvActivationFusion>();
+        if (!_nhwc) {
+            // Collapses depthwise -> pointwise pairs into one layer whose
+            // intermediate stays inside the ACL function; ConvertLayoutNHWC
+            // does not know the fused node, so NHWC backbones keep the pair
+            manager.register_pass<ov::pass::GraphRewrite>()->add_matcher<pass::DepthwiseSeparableFusion>();
+        }
         manager.register_pass<ngraph::pass::ConstantFolding>();
         manager.register_pass<ov::pass::GraphRewrite>()->add_matcher<pass::ConvertMatMulToFC>();
         manager.register_pass<ngraph::pass::ConstantFolding>();
@@ -359,25 +402,50 @@ bool ArmPlugin::pass::ArmOptimizations::run_on_model(const std::shared_ptr<ov::M
         manager.register_pass<ov::pass::GraphRewrite>()->add_matcher<pass::ConvertArmMaxPoolV1>();
         manager.register_pass<ov::pass::GraphRewrite>()->add_matcher<pass::ConvertArmMaxPoolV8>();
         manager.register_pass<ov::pass::GraphRewrite>()->add_matcher<pass::ConvertArmAvgPool>();
+        if (_nhwc) {
+            // Rewrites convolutional backbones into NHWC, where ACL kernels are
+            // fastest, leaving physical permutes only on the region boundaries
+            manager.register_pass<pass::ConvertLayoutNHWC>();
+        }
         manager.register_pass<pass::FinalizeTrailingNodes>();
         manager.register_pass<pass::StoreResultName>();
         manager.register_pass<ngraph::pass::ConstantFolding>();
         manager.register_pass<ov::pass::ConvertPrecision>(precisions, type_to_fuse);
+        // The precision alignment passes below match on element types; re-infer
+        // them once here instead of after every pass
+        manager.register_pass<ov::pass::Validate>();
+#ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+        if (_fp16) {
+            // Lowers the fp16-safe regions of an fp32 graph to half precision with
+            // fp32 converts on the region boundaries; accuracy-sensitive ops keep fp32
+            manager.register_pass<pass::ConvertPrecisionFP32ToFP16>();
+        }
+#endif /* __ARM_FEATURE_FP16_VECTOR_ARITHMETIC */
         manager.register_pass<ov::pass::GraphRewrite>()->add_matcher<pass::AlignNodePrecision>();
         manager.register_pass<pass::ConvertPrecisionFP16ToFP32>();
         manager.register_pass<ov::pass::GraphRewrite>()->add_matcher<pass::ConvertArmConvert>();
         manager.register_pass<ov::pass::GraphRewrite>()->add_matcher<pass::ConvertArmConvertLike>();
         manager.register_pass<ngraph::pass::ConstantFolding>();
+        if (_compressWeights) {
+            // Runs last, over the final weight constants: large fp32 weights
+            // are replaced with int8 + ArmDequantize and released one by one
+            manager.register_pass<pass::CompressWeights>();
+        }
+        manager.register_pass<ov::pass::Validate>();
         manager.run_passes(m);
     }
 
     if (quantized) {
         Dump(m, "before_arm");
         ov::pass::Manager manager;
+        manager.set_per_pass_validation(false);
         {
             auto pass = manager.register_pass<ov::pass::GraphRewrite>();
             pass->add_matcher<pass::ConvolutionQuantizeFusion>();
             pass->add_matcher<pass::MeanQuantizeFusion>();
+            // Runs in the same rewrite so the producers are already fused with
+            // their requantization when the downstream eltwise is visited
+            pass->add_matcher<pass::EltwiseQuantizeFusion>();
         }
         {
             auto pass = manager.register_pass<ov::pass::GraphRewrite>();
@@ -390,6 +458,7 @@ bool ArmPlugin::pass::ArmOptimizations::run_on_model(const std::shared_ptr<ov::M
             pass->add_matcher<pass::ConvertQuantize>();
         }
         manager.register_pass<ngraph::pass::ConstantFolding>();
+        manager.register_pass<ov::pass::Validate>();
         manager.run_passes(m);
     }
 
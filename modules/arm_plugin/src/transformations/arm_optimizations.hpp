@@ -12,13 +12,18 @@ namespace pass {
 class ArmOptimizations: public ov::pass::ModelPass {
 public:
     NGRAPH_RTTI_DECLARATION;
-    ArmOptimizations(const bool lpt, const bool dump) : _lpt{lpt}, _dump{dump} {}
+    ArmOptimizations(const bool lpt, const bool dump, const bool fp16 = false, const bool nhwc = false,
+                     const bool compressWeights = false) :
+        _lpt{lpt}, _dump{dump}, _fp16{fp16}, _nhwc{nhwc}, _compressWeights{compressWeights} {}
     bool run_on_model(const std::shared_ptr<ov::Model> &m) override;
 
     void Dump(const std::shared_ptr<ov::Model>& m, const std::string& postfix);
 
     bool _lpt = false;
     bool _dump = false;
+    bool _fp16 = false;
+    bool _nhwc = false;
+    bool _compressWeights = false;
 };
 }  // namespace pass
 }  // namespace ArmPlugin
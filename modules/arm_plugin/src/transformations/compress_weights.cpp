@@ -0,0 +1,111 @@
+// Copyright (C) 2020-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "compress_weights.hpp"
+
+#include <cmath>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include <ie_parallel.hpp>
+
+#include <ngraph/rt_info.hpp>
+#include <ov_ops/type_relaxed.hpp>
+#include <arm_compute/core/Types.h>
+
+#include "opset/opset.hpp"
+
+using namespace ArmPlugin;
+using Types = std::vector<ngraph::element::Type>;
+
+namespace {
+// Weights below this size keep their fp32 form: the dequantize layer and its
+// transient plane would cost more than the compression saves
+constexpr std::size_t minWeightsBytes = 64 * 1024;
+
+bool hasCompressibleWeights(const std::shared_ptr<ngraph::Node>& node) {
+    if (!(ngraph::is_type<opset::ArmConvolution>(node) ||
+          ngraph::is_type<opset::ArmGroupConvolution>(node) ||
+          ngraph::is_type<opset::ArmConvolutionNHWC>(node) ||
+          ngraph::is_type<opset::ArmMatMulBias>(node) ||
+          ngraph::is_type<opset::MatMul>(node))) {
+        return false;
+    }
+    if (node->get_input_size() < 2) {
+        return false;
+    }
+    const auto& weights = node->input_value(1);
+    return ngraph::op::is_constant(weights.get_node()) &&
+           (weights.get_element_type() == ngraph::element::f32) &&
+           weights.get_partial_shape().is_static() &&
+           ((ngraph::shape_size(weights.get_shape()) * sizeof(float)) >= minWeightsBytes);
+}
+
+bool compressWeightsOf(const std::shared_ptr<ngraph::Node>& node) {
+    auto weights = std::dynamic_pointer_cast<opset::Constant>(node->input_value(1).get_node_shared_ptr());
+    if (weights == nullptr) {
+        // A constant shared between consumers is compressed when the first
+        // of them is visited; the rest already read the dequantize output
+        return false;
+    }
+    const auto& shape = weights->get_shape();
+    const auto elements = ngraph::shape_size(shape);
+    // Convolution weights quantize per output channel (the slowest, hence
+    // contiguous, dimension); 2D matmul weights lay the output channel out
+    // innermost, so they fall back to one scale per tensor
+    const auto channels = (shape.size() >= 4) ? shape.front() : 1;
+    const auto channelSize = elements / channels;
+    const float* src = weights->get_data_ptr<float>();
+    std::vector<float> scales(channels);
+    std::vector<std::int8_t> quantized(elements);
+    InferenceEngine::parallel_for(channels, [&] (std::size_t channel) {
+        const float* channelSrc = src + channel * channelSize;
+        std::int8_t* channelDst = quantized.data() + channel * channelSize;
+        float maxAbs = 0.0f;
+        for (std::size_t i = 0; i < channelSize; ++i) {
+            maxAbs = std::max(maxAbs, std::fabs(channelSrc[i]));
+        }
+        const float scale = (maxAbs > 0.0f) ? (maxAbs / 127.0f) : 1.0f;
+        scales[channel] = scale;
+        for (std::size_t i = 0; i < channelSize; ++i) {
+            auto value = std::lround(channelSrc[i] / scale);
+            channelDst[i] = static_cast<std::int8_t>(std::min<long>(127, std::max<long>(-127, value)));
+        }
+    });
+    auto quantizationInfo = (channels > 1) ? arm_compute::QuantizationInfo{scales}
+                                           : arm_compute::QuantizationInfo{scales.front(), 0};
+    auto compressed = std::make_shared<opset::Constant>(ngraph::element::i8, shape, quantized);
+    compressed->set_friendly_name(weights->get_friendly_name() + "_i8");
+    auto dequantize = std::make_shared<ov::op::TypeRelaxed<opset::ArmDequantize>>(
+        Types{ngraph::element::i8}, Types{ngraph::element::f32}, compressed);
+    dequantize->set_friendly_name(weights->get_friendly_name() + "_arm_dequantize");
+    ngraph::copy_runtime_info(weights, {compressed, dequantize});
+    // The converter types the constant tensor from this record, the dequantize
+    // layer reads its scales through the usual QuantizationInfo entry
+    compressed->get_rt_info()["WeightsQuantizationInfo"] = quantizationInfo;
+    dequantize->get_rt_info()["QuantizationInfo"] = quantizationInfo;
+    ngraph::replace_node(weights, dequantize);
+    return true;
+}
+}  // namespace
+
+NGRAPH_RTTI_DEFINITION(ArmPlugin::pass::CompressWeights, "CompressWeights", 0);
+bool ArmPlugin::pass::CompressWeights::run_on_model(const std::shared_ptr<ov::Model>& m) {
+    // Only the consumers are collected: keeping the whole ordered-ops vector
+    // alive would pin every fp32 constant until the loop ends, while this way
+    // each original is released right after its int8 replacement, bounding
+    // the peak at the uncompressed model plus one layer
+    std::vector<std::shared_ptr<ngraph::Node>> consumers;
+    for (auto&& node : m->get_ordered_ops()) {
+        if (hasCompressibleWeights(node)) {
+            consumers.emplace_back(node);
+        }
+    }
+    bool changed = false;
+    for (auto&& consumer : consumers) {
+        changed |= compressWeightsOf(consumer);
+    }
+    return changed;
+}
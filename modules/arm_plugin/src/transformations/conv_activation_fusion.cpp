@@ -0,0 +1,60 @@
+// Copyright (C) 2020-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "conv_activation_fusion.hpp"
+
+#include <memory>
+
+#include <ngraph/rt_info.hpp>
+
+#include "opset/opset.hpp"
+#include <ngraph/pattern/op/wrap_type.hpp>
+
+using namespace ArmPlugin;
+
+NGRAPH_RTTI_DEFINITION(ArmPlugin::pass::ConvActivationFusionBase, "ConvActivationFusionBase", 0);
+template <class Conv>
+void ArmPlugin::pass::ConvActivationFusionBase::registerMatcher(const std::string& name) {
+    auto conv_pattern = ngraph::pattern::wrap_type<Conv>(ngraph::pattern::consumers_count(1));
+    auto activation_pattern = ngraph::pattern::wrap_type<opset::Relu, opset::Clamp, opset::HSwish>({conv_pattern});
+    register_matcher(std::make_shared<ngraph::pattern::Matcher>(activation_pattern, name), [=](ngraph::pattern::Matcher& m) {
+        auto pattern_map = m.get_pattern_value_map();
+        auto conv = pattern_map[conv_pattern].get_node_shared_ptr();
+        auto activation = pattern_map[activation_pattern].get_node_shared_ptr();
+
+        // A single epilogue slot: a convolution that already carries a fused
+        // activation (e.g. from the quantization fusions) keeps it
+        if (conv->get_rt_info().count("ActivationLayerInfo") != 0) {
+            return false;
+        }
+
+        auto activationLayerInfo = opset::makeActivationLayerInfo(activation.get());
+        if (!activationLayerInfo.enabled()) {
+            return false;
+        }
+
+        ngraph::copy_runtime_info({conv, activation}, conv);
+        conv->get_rt_info().emplace("ActivationLayerInfo", activationLayerInfo);
+        conv->set_friendly_name(activation->get_friendly_name());
+        ngraph::replace_node(activation, conv);
+        return true;
+    });
+}
+
+// ---------------------------------------ConvActivationFusion---------------------------------------
+NGRAPH_RTTI_DEFINITION(ArmPlugin::pass::ConvolutionActivationFusion, "ConvolutionActivationFusion", 0);
+ArmPlugin::pass::ConvolutionActivationFusion::ConvolutionActivationFusion() {
+    registerMatcher<opset::ArmConvolution>("ConvolutionActivationFusion");
+}
+
+NGRAPH_RTTI_DEFINITION(ArmPlugin::pass::GroupConvolutionActivationFusion, "GroupConvolutionActivationFusion", 0);
+ArmPlugin::pass::GroupConvolutionActivationFusion::GroupConvolutionActivationFusion() {
+    registerMatcher<opset::ArmGroupConvolution>("GroupConvolutionActivationFusion");
+}
+
+// The GEMM applies it in the output stage while the block is cache-resident
+NGRAPH_RTTI_DEFINITION(ArmPlugin::pass::MatMulBiasActivationFusion, "MatMulBiasActivationFusion", 0);
+ArmPlugin::pass::MatMulBiasActivationFusion::MatMulBiasActivationFusion() {
+    registerMatcher<opset::ArmMatMulBias>("MatMulBiasActivationFusion");
+}
@@ -0,0 +1,46 @@
+// Copyright (C) 2020-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ngraph/pass/graph_rewrite.hpp>
+
+namespace ArmPlugin {
+namespace pass {
+
+class ConvActivationFusionBase: public ngraph::pass::MatcherPass {
+protected:
+    NGRAPH_RTTI_DECLARATION;
+    template <class Conv>
+    void registerMatcher(const std::string& name);
+};
+
+class ConvolutionActivationFusion: public ConvActivationFusionBase {
+public:
+    NGRAPH_RTTI_DECLARATION;
+    ConvolutionActivationFusion();
+};
+
+class GroupConvolutionActivationFusion: public ConvActivationFusionBase {
+public:
+    NGRAPH_RTTI_DECLARATION;
+    GroupConvolutionActivationFusion();
+};
+
+class MatMulBiasActivationFusion: public ConvActivationFusionBase {
+public:
+    NGRAPH_RTTI_DECLARATION;
+    MatMulBiasActivationFusion();
+};
+
+class ConvActivationFusion: public ngraph::pass::GraphRewrite {
+public:
+    ConvActivationFusion() {
+        add_matcher<ConvolutionActivationFusion>();
+        add_matcher<GroupConvolutionActivationFusion>();
+        add_matcher<MatMulBiasActivationFusion>();
+    }
+};
+}  // namespace pass
+}  // namespace ArmPlugin
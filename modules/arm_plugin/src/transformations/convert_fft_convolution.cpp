@@ -0,0 +1,54 @@
+// Copyright (C) 2020-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+
+#include "transformations/convert_fft_convolution.hpp"
+#include "opset/opset.hpp"
+#include <ngraph/rt_info.hpp>
+#include <ngraph/pattern/op/wrap_type.hpp>
+
+// Below this tap count the im2col GEMM path stays ahead of the segment FFTs
+static constexpr std::size_t fft_kernel_threshold = 128;
+
+NGRAPH_RTTI_DEFINITION(ArmPlugin::pass::ConvertConv1DToFFT, "ConvertConv1DToFFT", 0);
+ArmPlugin::pass::ConvertConv1DToFFT::ConvertConv1DToFFT() {
+    auto conv = ngraph::pattern::wrap_type<opset::Convolution>();
+
+    ngraph::matcher_pass_callback callback = [](ngraph::pattern::Matcher& m) {
+        auto conv = std::dynamic_pointer_cast<opset::Convolution>(m.get_match_root());
+        if (!conv) {
+            return false;
+        }
+
+        if (conv->get_input_element_type(0) != ngraph::element::f32) {
+            return false;
+        }
+
+        auto input_shape = conv->get_input_partial_shape(0);
+        auto weights_shape = conv->get_input_partial_shape(1);
+        if (input_shape.is_dynamic() || weights_shape.is_dynamic() ||
+            input_shape.rank().get_length() != 3) {
+            return false;
+        }
+
+        if (conv->get_strides() != ngraph::Strides{1} || conv->get_dilations() != ngraph::Strides{1}) {
+            return false;
+        }
+
+        if (static_cast<std::size_t>(weights_shape[2].get_length()) < fft_kernel_threshold) {
+            return false;
+        }
+
+        auto fft_conv = std::make_shared<opset::ArmFFTConvolution>(conv->input_value(0),
+                                                                   conv->input_value(1),
+                                                                   conv->get_pads_begin(),
+                                                                   conv->get_pads_end());
+        fft_conv->set_friendly_name(conv->get_friendly_name());
+        ngraph::copy_runtime_info(conv, fft_conv);
+        ngraph::replace_node(conv, fft_conv);
+        return true;
+    };
+
+    auto m = std::make_shared<ngraph::pattern::Matcher>(conv, "ConvertConv1DToFFT");
+    register_matcher(m, callback);
+}
@@ -0,0 +1,196 @@
+// Copyright (C) 2020-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+
+#include "convert_layout_nhwc.hpp"
+#include "opset/opset.hpp"
+
+#include <ngraph/validation_util.hpp>
+#include <openvino/core/rt_info.hpp>
+
+#include <unordered_map>
+#include <unordered_set>
+
+using namespace ArmPlugin;
+
+namespace {
+constexpr const char* NHWCMarker = "DataLayoutNHWC";
+
+void MarkNHWC(const std::shared_ptr<ngraph::Node>& node) {
+    node->get_rt_info()[NHWCMarker] = "";
+}
+
+// Elementwise ops that work on NHWC tensors unchanged: they only need their
+// constant operands permuted to broadcast against (N, H, W, C)
+bool IsLayoutAgnosticEltwise(const std::shared_ptr<ngraph::Node>& node) {
+    return ov::is_type<opset::Relu>(node) ||
+           ov::is_type<opset::PRelu>(node) ||
+           ov::is_type<opset::Sigmoid>(node) ||
+           ov::is_type<opset::Tanh>(node) ||
+           ov::is_type<opset::Clamp>(node) ||
+           ov::is_type<opset::Elu>(node) ||
+           ov::is_type<opset::Gelu>(node) ||
+           ov::is_type<opset::HSwish>(node) ||
+           ov::is_type<opset::Swish>(node) ||
+           ov::is_type<opset::Abs>(node) ||
+           ov::is_type<opset::Sqrt>(node) ||
+           ov::is_type<opset::Add>(node) ||
+           ov::is_type<opset::Subtract>(node) ||
+           ov::is_type<opset::Multiply>(node) ||
+           ov::is_type<opset::Maximum>(node) ||
+           ov::is_type<opset::Minimum>(node);
+}
+
+bool HasStatic4DOutput(const std::shared_ptr<ngraph::Node>& node) {
+    return (node->get_output_size() == 1) &&
+           node->get_output_partial_shape(0).is_static() &&
+           (node->get_output_partial_shape(0).rank().get_length() == 4);
+}
+
+// Permutes a constant operand into NHWC: aligns it to rank 4 the way numpy
+// broadcasting would and folds a {0, 2, 3, 1} transpose over it
+std::shared_ptr<opset::Constant> PermuteConstant(const ngraph::Output<ngraph::Node>& output) {
+    auto shape = output.get_shape();
+    if (ngraph::shape_size(shape) == 1) {
+        return ov::as_type_ptr<opset::Constant>(output.get_node_shared_ptr());
+    }
+    ngraph::Output<ngraph::Node> aligned = output;
+    if (shape.size() < 4) {
+        ngraph::Shape alignedShape(4 - shape.size(), 1);
+        alignedShape.insert(alignedShape.end(), shape.begin(), shape.end());
+        aligned = std::make_shared<opset::Reshape>(output,
+            opset::Constant::create(ngraph::element::i64, ngraph::Shape{4},
+                                    std::vector<std::int64_t>{alignedShape.begin(), alignedShape.end()}), false);
+    }
+    auto transposed = std::make_shared<opset::Transpose>(aligned,
+        opset::Constant::create(ngraph::element::i64, ngraph::Shape{4}, {0, 2, 3, 1}));
+    return ngraph::get_constant_from_source(transposed);
+}
+}  // namespace
+
+bool ArmPlugin::pass::ConvertLayoutNHWC::run_on_model(const std::shared_ptr<ov::Model>& m) {
+    const auto ordered_ops = m->get_ordered_ops();
+
+    // Select the nodes moving to NHWC: convolutions seed the regions, elementwise
+    // ops join when every non-constant operand is already inside one
+    std::unordered_set<ngraph::Node*> nhwc_nodes;
+    for (const auto& node : ordered_ops) {
+        if (ov::is_type<opset::ArmConvolutionNHWC>(node)) {
+            continue;
+        }
+        if (ov::is_type<opset::ArmConvolution>(node)) {
+            if (!HasStatic4DOutput(node) || !node->get_input_partial_shape(0).is_static()) {
+                continue;
+            }
+            if (node->get_input_size() > 2 && node->get_input_partial_shape(2).rank().get_length() > 1) {
+                continue;
+            }
+            if (ngraph::get_constant_from_source(node->input_value(1)) == nullptr) {
+                continue;
+            }
+            nhwc_nodes.emplace(node.get());
+        } else if (IsLayoutAgnosticEltwise(node) && HasStatic4DOutput(node)) {
+            bool all_inside = true;
+            bool any_inside = false;
+            for (const auto& input : node->inputs()) {
+                auto source = input.get_source_output().get_node();
+                if (ngraph::op::is_constant(source)) {
+                    continue;
+                }
+                if (nhwc_nodes.count(source) != 0) {
+                    any_inside = true;
+                } else {
+                    all_inside = false;
+                }
+            }
+            if (all_inside && any_inside) {
+                nhwc_nodes.emplace(node.get());
+            }
+        }
+    }
+    if (nhwc_nodes.empty()) {
+        return false;
+    }
+
+    // NHWC-space replacement of every converted output
+    std::map<ngraph::Output<ngraph::Node>, ngraph::Output<ngraph::Node>> nhwc_outputs;
+    auto getNHWC = [&] (const ngraph::Output<ngraph::Node>& output) -> ngraph::Output<ngraph::Node> {
+        auto it = nhwc_outputs.find(output);
+        if (it != nhwc_outputs.end()) {
+            return it->second;
+        }
+        // Region boundary: a physical NCHW -> NHWC permute
+        auto permute = std::make_shared<opset::ArmTranspose>(output,
+            opset::Constant::create(ngraph::element::i64, ngraph::Shape{4}, {0, 2, 3, 1}));
+        permute->set_friendly_name(output.get_node()->get_friendly_name() + "_to_nhwc");
+        MarkNHWC(permute);
+        nhwc_outputs.emplace(output, permute->output(0));
+        return permute->output(0);
+    };
+
+    for (const auto& node : ordered_ops) {
+        if (nhwc_nodes.count(node.get()) == 0) {
+            continue;
+        }
+        std::shared_ptr<ngraph::Node> nhwc_node;
+        if (auto conv = ov::as_type_ptr<opset::ArmConvolution>(node)) {
+            auto weights = PermuteConstant(conv->input_value(1));
+            MarkNHWC(weights);
+            if (conv->get_input_size() == 3) {
+                nhwc_node = std::make_shared<opset::ArmConvolutionNHWC>(getNHWC(conv->input_value(0)),
+                                                                        weights,
+                                                                        conv->input_value(2),
+                                                                        conv->get_strides(),
+                                                                        conv->get_pads_begin(),
+                                                                        conv->get_pads_end(),
+                                                                        conv->get_dilations(),
+                                                                        conv->get_auto_pad());
+            } else {
+                nhwc_node = std::make_shared<opset::ArmConvolutionNHWC>(getNHWC(conv->input_value(0)),
+                                                                        weights,
+                                                                        conv->get_strides(),
+                                                                        conv->get_pads_begin(),
+                                                                        conv->get_pads_end(),
+                                                                        conv->get_dilations(),
+                                                                        conv->get_auto_pad());
+            }
+        } else {
+            ngraph::OutputVector new_inputs;
+            for (const auto& input : node->inputs()) {
+                auto source = input.get_source_output();
+                if (ngraph::op::is_constant(source.get_node())) {
+                    auto permuted = PermuteConstant(source);
+                    // Scalars come back unpermuted and possibly shared; leave them unmarked
+                    if (permuted.get() != source.get_node()) {
+                        MarkNHWC(permuted);
+                    }
+                    new_inputs.push_back(permuted);
+                } else {
+                    new_inputs.push_back(getNHWC(source));
+                }
+            }
+            nhwc_node = node->clone_with_new_inputs(new_inputs);
+        }
+        nhwc_node->set_friendly_name(node->get_friendly_name());
+        ov::copy_runtime_info(node, nhwc_node);
+        MarkNHWC(nhwc_node);
+        nhwc_outputs.emplace(node->output(0), nhwc_node->output(0));
+
+        // Consumers staying in NCHW (including Results) read through a single
+        // NHWC -> NCHW permute; converted consumers connect directly
+        std::shared_ptr<ngraph::Node> permute_back;
+        for (const auto& target : node->output(0).get_target_inputs()) {
+            if (nhwc_nodes.count(target.get_node()) != 0) {
+                continue;
+            }
+            if (permute_back == nullptr) {
+                permute_back = std::make_shared<opset::ArmTranspose>(nhwc_node->output(0),
+                    opset::Constant::create(ngraph::element::i64, ngraph::Shape{4}, {0, 3, 1, 2}));
+                permute_back->set_friendly_name(node->get_friendly_name() + "_to_nchw");
+                permute_back->output(0).add_names(node->output(0).get_names());
+            }
+            target.replace_source_output(permute_back);
+        }
+    }
+    return true;
+}
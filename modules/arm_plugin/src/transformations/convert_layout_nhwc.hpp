@@ -0,0 +1,28 @@
+// Copyright (C) 2020-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "openvino/pass/graph_rewrite.hpp"
+
+namespace ArmPlugin {
+namespace pass {
+
+/**
+ * Moves the convolutional backbone of the model to NHWC, where ACL's NEON
+ * kernels are fastest. Static 4D ArmConvolution nodes and the elementwise ops
+ * between them are rewritten to operate on semantically NHWC tensors
+ * (ArmConvolutionNHWC with OHWI filters); every rewritten node is tagged with
+ * the "DataLayoutNHWC" rt_info entry, which the converter maps to
+ * arm_compute::DataLayout::NHWC. Physical NEPermute conversions (ArmTranspose)
+ * remain only on the boundaries between NHWC regions and the rest of the graph
+ */
+class ConvertLayoutNHWC: public ov::pass::ModelPass {
+public:
+    OPENVINO_RTTI("ConvertLayoutNHWC", "0");
+    ConvertLayoutNHWC() = default;
+    bool run_on_model(const std::shared_ptr<ov::Model>& m) override;
+};
+
+}  // namespace pass
+}  // namespace ArmPlugin
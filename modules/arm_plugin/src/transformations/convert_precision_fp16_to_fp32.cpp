@@ -65,6 +65,8 @@ bool check_op_type(const std::shared_ptr<ov::Node>& op) {
 //    CHECK_TYPE(ArmPlugin::opset::ReduceProd, op);
     CHECK_TYPE(ArmPlugin::opset::ReduceMin, op);
     CHECK_TYPE(ArmPlugin::opset::ReduceMax, op);
+    CHECK_TYPE(ArmPlugin::opset::ReduceL1, op);
+    CHECK_TYPE(ArmPlugin::opset::ReduceL2, op);
     CHECK_TYPE(ArmPlugin::opset::ArmInterpolate, op);
     CHECK_TYPE(ArmPlugin::opset::ArmMVN, op);
     CHECK_TYPE(ArmPlugin::opset::ArmNormalizeL2, op);
@@ -77,6 +79,7 @@ bool check_op_type(const std::shared_ptr<ov::Node>& op) {
     CHECK_TYPE(ArmPlugin::opset::Greater, op);
     CHECK_TYPE(ArmPlugin::opset::GreaterEqual, op);
     CHECK_TYPE(ArmPlugin::opset::Select, op);
+    CHECK_TYPE(ArmPlugin::opset::ArmCompareSelect, op);
     CHECK_TYPE(ArmPlugin::opset::ReorgYolo, op);
     CHECK_TYPE(ArmPlugin::opset::BatchToSpace, op);
     CHECK_TYPE(ArmPlugin::opset::SpaceToBatch, op);
@@ -84,6 +87,7 @@ bool check_op_type(const std::shared_ptr<ov::Node>& op) {
     CHECK_TYPE(ArmPlugin::opset::ArmConcat, op);
     CHECK_TYPE(ArmPlugin::opset::ArmGather, op);
     CHECK_TYPE(ArmPlugin::opset::ArmFFT, op);
+    CHECK_TYPE(ArmPlugin::opset::ArmFFTConvolution, op);
     CHECK_TYPE(ArmPlugin::opset::ArmQuantize, op);
     CHECK_TYPE(ArmPlugin::opset::ArmDequantize, op);
     return false;
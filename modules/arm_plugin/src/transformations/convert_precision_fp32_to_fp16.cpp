@@ -0,0 +1,115 @@
+// Copyright (C) 2020-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+
+#include "convert_precision_fp32_to_fp16.hpp"
+#include "opset/opset.hpp"
+
+#include <openvino/core/rt_info.hpp>
+#include <openvino/opsets/opset9.hpp>
+
+#define CHECK_TYPE(TYPE, node)                                             \
+    if (ov::is_type<TYPE>(node)) {                                         \
+        return true;                                                       \
+    }
+
+// Ops whose ACL fp16 kernels are both available and numerically safe to run
+// on half precision activations. Accuracy-sensitive ops are deliberately
+// absent and stay on fp32: reductions and normalizations accumulate over many
+// elements (ReduceMean, ReduceSum, ArmMVN, ArmNormalizeL2, LRN, Softmax) and
+// transcendental-based ops amplify the 10-bit mantissa error or overflow the
+// fp16 range (Exp, Log, Power, Divide, SquaredDifference, SoftPlus).
+static bool fp16_safe_op_type(const std::shared_ptr<ov::Node>& op) {
+    CHECK_TYPE(ArmPlugin::opset::ArmConvolution, op);
+    CHECK_TYPE(ArmPlugin::opset::ArmGroupConvolution, op);
+    CHECK_TYPE(ArmPlugin::opset::v1::ArmAvgPool, op);
+    CHECK_TYPE(ArmPlugin::opset::v1::ArmMaxPool, op);
+    CHECK_TYPE(ArmPlugin::opset::v8::ArmMaxPool, op);
+    CHECK_TYPE(ArmPlugin::opset::Add, op);
+    CHECK_TYPE(ArmPlugin::opset::Subtract, op);
+    CHECK_TYPE(ArmPlugin::opset::Multiply, op);
+    CHECK_TYPE(ArmPlugin::opset::Reshape, op);
+    CHECK_TYPE(ArmPlugin::opset::Squeeze, op);
+    CHECK_TYPE(ArmPlugin::opset::Unsqueeze, op);
+    CHECK_TYPE(ArmPlugin::opset::Sigmoid, op);
+    CHECK_TYPE(ArmPlugin::opset::Tanh, op);
+    CHECK_TYPE(ArmPlugin::opset::Relu, op);
+    CHECK_TYPE(ArmPlugin::opset::PRelu, op);
+    CHECK_TYPE(ArmPlugin::opset::Abs, op);
+    CHECK_TYPE(ArmPlugin::opset::Clamp, op);
+    CHECK_TYPE(ArmPlugin::opset::Elu, op);
+    CHECK_TYPE(ArmPlugin::opset::Gelu, op);
+    CHECK_TYPE(ArmPlugin::opset::ArmTranspose, op);
+    CHECK_TYPE(ArmPlugin::opset::ArmSplit, op);
+    CHECK_TYPE(ArmPlugin::opset::Minimum, op);
+    CHECK_TYPE(ArmPlugin::opset::Maximum, op);
+    CHECK_TYPE(ArmPlugin::opset::ArmStridedSlice, op);
+    CHECK_TYPE(ArmPlugin::opset::Negative, op);
+    CHECK_TYPE(ArmPlugin::opset::Floor, op);
+    CHECK_TYPE(ArmPlugin::opset::MatMul, op);
+    CHECK_TYPE(ArmPlugin::opset::ArmMatMulBias, op);
+    CHECK_TYPE(ArmPlugin::opset::Pad, op);
+    CHECK_TYPE(ArmPlugin::opset::BatchNormInference, op);
+    CHECK_TYPE(ArmPlugin::opset::HSwish, op);
+    CHECK_TYPE(ArmPlugin::opset::Swish, op);
+    CHECK_TYPE(ArmPlugin::opset::ShuffleChannels, op);
+    CHECK_TYPE(ArmPlugin::opset::ReduceMin, op);
+    CHECK_TYPE(ArmPlugin::opset::ReduceMax, op);
+    CHECK_TYPE(ArmPlugin::opset::ArmInterpolate, op);
+    CHECK_TYPE(ArmPlugin::opset::DepthToSpace, op);
+    CHECK_TYPE(ArmPlugin::opset::SpaceToDepth, op);
+    CHECK_TYPE(ArmPlugin::opset::ArmConcat, op);
+    CHECK_TYPE(ArmPlugin::opset::ArmGather, op);
+    return false;
+}
+
+bool ArmPlugin::pass::ConvertPrecisionFP32ToFP16::run_on_model(const std::shared_ptr<ov::Model>& m) {
+    const auto ordered_ops = m->get_ordered_ops();
+    for (const auto& op : ordered_ops) {
+        auto multisubgraph_op = std::dynamic_pointer_cast<ov::op::util::MultiSubGraphOp>(op);
+        if (multisubgraph_op) {
+            for (size_t idx = 0; idx < multisubgraph_op->get_internal_subgraphs_size(); ++idx) {
+                run_on_model(multisubgraph_op->get_function(static_cast<int>(idx)));
+            }
+        }
+        if (!fp16_safe_op_type(op)) {
+            continue;
+        }
+
+        bool convert_for_outputs_required = false;
+        for (const auto& input : op->inputs()) {
+            if (input.get_element_type() == ov::element::f32) {
+                auto parent_output = input.get_source_output();
+                auto parent_convert = std::dynamic_pointer_cast<ov::opset9::Convert>(parent_output.get_node_shared_ptr());
+                if (parent_convert && parent_convert->get_rt_info().count("fp32_to_fp16_transformation") != 0) {
+                    input.replace_source_output(parent_convert->input_value(0));
+                } else {
+                    auto convert = std::make_shared<ov::opset9::Convert>(input.get_source_output(), ov::element::f16);
+                    convert->output(0).add_names(parent_output.get_names());
+                    input.replace_source_output(convert);
+                }
+                convert_for_outputs_required = true;
+            }
+        }
+
+        if (convert_for_outputs_required) {
+            // propagate fp16 precision into outputs
+            op->validate_and_infer_types();
+            for (auto& output : op->outputs()) {
+                if (output.get_element_type() == ov::element::f16) {
+                    auto target_inputs = output.get_target_inputs();
+                    auto convert = std::make_shared<ov::opset9::Convert>(output, ov::element::f32);
+
+                    auto& rt_info = convert->get_rt_info();
+                    rt_info["fp32_to_fp16_transformation"] = "";
+                    for (const auto& target_input : target_inputs) {
+                        target_input.replace_source_output(convert);
+                    }
+
+                    convert->output(0).get_tensor_ptr()->add_names(output.get_names());
+                }
+            }
+        }
+    }
+    return true;
+}
@@ -0,0 +1,19 @@
+// Copyright (C) 2020-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "openvino/pass/graph_rewrite.hpp"
+
+namespace ArmPlugin {
+namespace pass {
+
+class ConvertPrecisionFP32ToFP16: public ov::pass::ModelPass {
+public:
+    OPENVINO_RTTI("ConvertPrecisionFP32ToFP16", "0");
+    ConvertPrecisionFP32ToFP16() = default;
+    bool run_on_model(const std::shared_ptr<ov::Model>& m) override;
+};
+
+}  // namespace pass
+}  // namespace ArmPlugin
@@ -27,6 +27,35 @@ ngraph::matcher_pass_callback ArmPlugin::pass::ConvertReduceMultiAxisBase::conve
             IE_THROW() << "Reduce op only supports constant multiple reduction axes.";
         }
         auto axes = reduction_axes->cast_vector<int64_t>();
+#if defined(__aarch64__)
+        // A contiguous run of reduced dims (unit dims are transparent)
+        // converts as one single-pass NEON reduction; decomposing it here
+        // would cost a full pass over the data per axis instead
+        if (reduce->get_input_element_type(0) == ngraph::element::f32) {
+            const auto& shape = reduce->get_input_shape(0);
+            std::vector<bool> isReduced(shape.size(), false);
+            for (auto axis : axes) {
+                isReduced[axis < 0 ? axis + shape.size() : axis] = true;
+            }
+            bool contiguous = true;
+            bool behindRun = false;
+            bool inRun = false;
+            for (std::size_t d = 0; d < shape.size(); ++d) {
+                if (shape[d] == 1) {
+                    continue;
+                }
+                if (isReduced[d]) {
+                    contiguous = contiguous && !behindRun;
+                    inRun = true;
+                } else if (inRun) {
+                    behindRun = true;
+                }
+            }
+            if (contiguous) {
+                return false;
+            }
+        }
+#endif
         ngraph::NodeVector new_ops;
         std::shared_ptr<ngraph::Node> node = reduce->input_value(0).get_node_shared_ptr();
         for (auto axis : axes) {
@@ -0,0 +1,106 @@
+// Copyright (C) 2020-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "depthwise_separable_fusion.hpp"
+
+#include <algorithm>
+#include <memory>
+
+#include <ngraph/rt_info.hpp>
+
+#include "opset/opset.hpp"
+#include <ngraph/pattern/op/wrap_type.hpp>
+
+using namespace ArmPlugin;
+
+static bool hasQuantizationInfo(const std::shared_ptr<ngraph::Node>& node) {
+    const auto& rtInfo = node->get_rt_info();
+    return rtInfo.count("InputPrescaleInfo") != 0 ||
+           rtInfo.count("WeightsPrescaleInfo") != 0 ||
+           rtInfo.count("QuantizationInfo") != 0;
+}
+
+NGRAPH_RTTI_DEFINITION(ArmPlugin::pass::DepthwiseSeparableFusion, "DepthwiseSeparableFusion", 0);
+ArmPlugin::pass::DepthwiseSeparableFusion::DepthwiseSeparableFusion() {
+    auto depthwise_pattern = ngraph::pattern::wrap_type<opset::ArmGroupConvolution>(ngraph::pattern::consumers_count(1));
+    auto pointwise_pattern = ngraph::pattern::wrap_type<opset::ArmConvolution>({depthwise_pattern,
+                                                                                ngraph::pattern::any_input(),
+                                                                                ngraph::pattern::any_input()});
+    register_matcher(std::make_shared<ngraph::pattern::Matcher>(pointwise_pattern, "DepthwiseSeparableFusion"), [=](ngraph::pattern::Matcher& m) {
+        auto pattern_map = m.get_pattern_value_map();
+        auto depthwise = ov::as_type_ptr<opset::ArmGroupConvolution>(pattern_map[depthwise_pattern].get_node_shared_ptr());
+        auto pointwise = ov::as_type_ptr<opset::ArmConvolution>(pattern_map[pointwise_pattern].get_node_shared_ptr());
+
+        // The converter feeds both parts into ACL with mandatory biases
+        if (depthwise->get_input_size() != 3) {
+            return false;
+        }
+
+        if (depthwise->get_output_partial_shape(0).is_dynamic() ||
+            depthwise->get_output_shape(0).size() != 4) {
+            return false;
+        }
+
+        // Depthwise: one group per channel with a single filter each
+        const auto& depthwiseWeightsShape = depthwise->get_input_shape(1);
+        if (depthwiseWeightsShape.size() != 5 ||
+            depthwiseWeightsShape[1] != 1 || depthwiseWeightsShape[2] != 1) {
+            return false;
+        }
+
+        // Pointwise: a plain 1x1 projection without spatial reduction
+        const auto& pointwiseWeightsShape = pointwise->get_input_shape(1);
+        if (pointwiseWeightsShape.size() != 4 ||
+            pointwiseWeightsShape[2] != 1 || pointwiseWeightsShape[3] != 1) {
+            return false;
+        }
+        auto allOnes = [](const ngraph::Strides& strides) {
+            return std::all_of(strides.begin(), strides.end(), [](std::size_t s) { return s == 1; });
+        };
+        auto allZeros = [](const ngraph::CoordinateDiff& pads) {
+            return std::all_of(pads.begin(), pads.end(), [](std::ptrdiff_t p) { return p == 0; });
+        };
+        if (!allOnes(pointwise->get_strides()) ||
+            !allOnes(pointwise->get_dilations()) ||
+            !allZeros(pointwise->get_pads_begin()) ||
+            !allZeros(pointwise->get_pads_end())) {
+            return false;
+        }
+
+        // The quantized pipeline rewrites convolutions through its own
+        // fusions; keep the pair as-is there
+        if (!depthwise->get_output_element_type(0).is_real() ||
+            hasQuantizationInfo(depthwise) || hasQuantizationInfo(pointwise)) {
+            return false;
+        }
+
+        auto fused = std::make_shared<opset::ArmDepthwiseSeparableConvolution>(depthwise->input_value(0),
+                                                                               depthwise->input_value(1),
+                                                                               depthwise->input_value(2),
+                                                                               pointwise->input_value(1),
+                                                                               pointwise->input_value(2),
+                                                                               depthwise->get_strides(),
+                                                                               depthwise->get_pads_begin(),
+                                                                               depthwise->get_pads_end(),
+                                                                               depthwise->get_dilations(),
+                                                                               depthwise->get_output_shape(0));
+
+        ngraph::copy_runtime_info({depthwise, pointwise}, fused);
+        // Each half keeps its own fused activation; "ActivationLayerInfo" on
+        // the merged rt_info would be ambiguous, so rebuild both slots
+        auto& rtInfo = fused->get_rt_info();
+        rtInfo.erase("ActivationLayerInfo");
+        auto depthwiseActivation = depthwise->get_rt_info().find("ActivationLayerInfo");
+        if (depthwiseActivation != depthwise->get_rt_info().end()) {
+            rtInfo.emplace("DepthwiseActivationLayerInfo", depthwiseActivation->second);
+        }
+        auto pointwiseActivation = pointwise->get_rt_info().find("ActivationLayerInfo");
+        if (pointwiseActivation != pointwise->get_rt_info().end()) {
+            rtInfo.emplace("ActivationLayerInfo", pointwiseActivation->second);
+        }
+        fused->set_friendly_name(pointwise->get_friendly_name());
+        ngraph::replace_node(pointwise, fused);
+        return true;
+    });
+}
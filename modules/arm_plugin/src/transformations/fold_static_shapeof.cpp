@@ -0,0 +1,40 @@
+// Copyright (C) 2020-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+
+#include "fold_static_shapeof.hpp"
+
+#include "opset/opset.hpp"
+#include <ngraph/rt_info.hpp>
+#include <ngraph/pattern/op/wrap_type.hpp>
+
+NGRAPH_RTTI_DEFINITION(ArmPlugin::pass::FoldStaticShapeOf, "FoldStaticShapeOf", 0);
+
+ArmPlugin::pass::FoldStaticShapeOf::FoldStaticShapeOf() {
+    auto shape_of = ngraph::pattern::wrap_type<ngraph::op::v0::ShapeOf, ngraph::op::v3::ShapeOf>();
+
+    ngraph::matcher_pass_callback callback = [](ngraph::pattern::Matcher& m) {
+        auto shape_of = m.get_match_root();
+        const auto& input_shape = shape_of->get_input_partial_shape(0);
+        if (input_shape.is_dynamic()) {
+            return false;
+        }
+        const auto& shape = input_shape.get_shape();
+        const auto out_type = shape_of->get_output_element_type(0);
+        std::shared_ptr<opset::Constant> constant;
+        if (out_type == ngraph::element::i32) {
+            constant = opset::Constant::create(
+                out_type, {shape.size()}, std::vector<std::int32_t>{shape.begin(), shape.end()});
+        } else {
+            constant = opset::Constant::create(
+                out_type, {shape.size()}, std::vector<std::int64_t>{shape.begin(), shape.end()});
+        }
+        constant->set_friendly_name(shape_of->get_friendly_name());
+        ngraph::copy_runtime_info(shape_of, constant);
+        ngraph::replace_node(shape_of, constant);
+        return true;
+    };
+
+    auto m = std::make_shared<ngraph::pattern::Matcher>(shape_of, "FoldStaticShapeOf");
+    register_matcher(m, callback);
+}
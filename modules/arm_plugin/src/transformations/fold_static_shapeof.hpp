@@ -0,0 +1,25 @@
+// Copyright (C) 2020-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <ngraph/pass/graph_rewrite.hpp>
+
+namespace ArmPlugin {
+namespace pass {
+
+/**
+ * Replaces ShapeOf of a statically shaped tensor with a Constant. The
+ * subgraphs computing anchors or position encodings depend only on weights
+ * and shapes, yet the ShapeOf at their root hides that from constant folding
+ * and they re-run every inference; with the shape materialized, the foldings
+ * of the pipeline evaluate them once at LoadNetwork and all requests share
+ * the resulting constant tensor
+ */
+class FoldStaticShapeOf: public ngraph::pass::MatcherPass {
+public:
+    NGRAPH_RTTI_DECLARATION;
+    FoldStaticShapeOf();
+};
+}  // namespace pass
+}  // namespace ArmPlugin
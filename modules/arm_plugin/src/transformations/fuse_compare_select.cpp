@@ -0,0 +1,71 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include <ngraph/rt_info.hpp>
+
+#include "opset/opset.hpp"
+#include "fuse_compare_select.hpp"
+
+using namespace ArmPlugin;
+
+NGRAPH_RTTI_DEFINITION(ArmPlugin::pass::FuseCompareSelect, "FuseCompareSelect", 0);
+ArmPlugin::pass::FuseCompareSelect::FuseCompareSelect() {
+    auto select = ngraph::pattern::wrap_type<opset::Select>(ngraph::pattern::has_static_shape());
+    register_matcher(std::make_shared<ngraph::pattern::Matcher>(select, "FuseCompareSelect"),
+        [](ngraph::pattern::Matcher& m) {
+            auto select = std::dynamic_pointer_cast<opset::Select>(m.get_match_root());
+            if (!select) {
+                return false;
+            }
+
+            auto&& condition = select->input_value(0);
+            auto comparison = condition.get_node_shared_ptr();
+            opset::ArmCompareSelect::Operation operation;
+            if (std::dynamic_pointer_cast<opset::Equal>(comparison)) {
+                operation = opset::ArmCompareSelect::Operation::Equal;
+            } else if (std::dynamic_pointer_cast<opset::NotEqual>(comparison)) {
+                operation = opset::ArmCompareSelect::Operation::NotEqual;
+            } else if (std::dynamic_pointer_cast<opset::Greater>(comparison)) {
+                operation = opset::ArmCompareSelect::Operation::Greater;
+            } else if (std::dynamic_pointer_cast<opset::GreaterEqual>(comparison)) {
+                operation = opset::ArmCompareSelect::Operation::GreaterEqual;
+            } else if (std::dynamic_pointer_cast<opset::Less>(comparison)) {
+                operation = opset::ArmCompareSelect::Operation::Less;
+            } else if (std::dynamic_pointer_cast<opset::LessEqual>(comparison)) {
+                operation = opset::ArmCompareSelect::Operation::LessEqual;
+            } else {
+                return false;
+            }
+            // The mask must not be observable outside the pair
+            if (condition.get_target_inputs().size() != 1) {
+                return false;
+            }
+
+            // Mismatched shapes are left to ConvertComparison/BroadcastSelect,
+            // mismatched element types would need a type per operand pair in
+            // the converter dispatch; both are rare enough to stay unfused
+            const auto& type = comparison->get_input_element_type(0);
+            if ((type == ngraph::element::boolean) || (type != select->get_input_element_type(1))) {
+                return false;
+            }
+            if (comparison->get_output_partial_shape(0).is_dynamic() ||
+                comparison->get_input_partial_shape(0).is_dynamic() ||
+                comparison->get_input_partial_shape(1).is_dynamic() ||
+                comparison->get_input_shape(0) != comparison->get_input_shape(1) ||
+                comparison->get_output_shape(0) != select->get_output_shape(0) ||
+                select->get_input_shape(1) != select->get_output_shape(0) ||
+                select->get_input_shape(2) != select->get_output_shape(0)) {
+                return false;
+            }
+
+            auto fused = std::make_shared<opset::ArmCompareSelect>(comparison->input_value(0),
+                                                                   comparison->input_value(1),
+                                                                   select->input_value(1),
+                                                                   select->input_value(2),
+                                                                   operation);
+            fused->set_friendly_name(select->get_friendly_name());
+            ngraph::copy_runtime_info({comparison, select}, fused);
+            ngraph::replace_node(select, fused);
+            return true;
+        });
+}
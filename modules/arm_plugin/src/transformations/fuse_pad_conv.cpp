@@ -0,0 +1,98 @@
+// Copyright (C) 2020-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+
+#include "transformations/fuse_pad_conv.hpp"
+
+#include "opset/opset.hpp"
+#include <ngraph/rt_info.hpp>
+#include <ngraph/pattern/op/wrap_type.hpp>
+
+NGRAPH_RTTI_DEFINITION(ArmPlugin::pass::FusePadConvolution, "FusePadConvolution", 0);
+ArmPlugin::pass::FusePadConvolution::FusePadConvolution() {
+    auto conv = ngraph::pattern::wrap_type<opset::Convolution, opset::GroupConvolution>(
+                    {ngraph::pattern::wrap_type<opset::Pad>(ngraph::pattern::has_static_shape()),
+                     ngraph::pattern::any_input()},
+                    ngraph::pattern::has_static_shape());
+
+    // A zero constant pad on the spatial dims is exactly the implicit padding
+    // the convolution kernels apply while reading, so the padded plane never
+    // needs to be written out
+    ngraph::matcher_pass_callback callback = [](ngraph::pattern::Matcher& m) {
+        auto conv = m.get_match_root();
+        auto pad = std::dynamic_pointer_cast<opset::Pad>(conv->input_value(0).get_node_shared_ptr());
+        if (!pad || pad->output(0).get_target_inputs().size() != 1) {
+            return false;
+        }
+        if (pad->get_pad_mode() != ngraph::op::PadMode::CONSTANT) {
+            return false;
+        }
+        if (!std::dynamic_pointer_cast<opset::Constant>(pad->input_value(1).get_node_shared_ptr()) ||
+            !std::dynamic_pointer_cast<opset::Constant>(pad->input_value(2).get_node_shared_ptr())) {
+            return false;
+        }
+        if (pad->get_input_size() == 4) {
+            auto value = std::dynamic_pointer_cast<opset::Constant>(pad->input_value(3).get_node_shared_ptr());
+            if (!value || value->cast_vector<double>()[0] != 0.0) {
+                return false;
+            }
+        }
+        const auto& padsBegin = pad->get_pads_begin();
+        const auto& padsEnd = pad->get_pads_end();
+        const auto rank = padsBegin.size();
+        for (std::size_t d = 0; d < rank; ++d) {
+            const auto spatial = d >= 2;
+            if ((padsBegin[d] < 0) || (padsEnd[d] < 0) ||
+                (!spatial && ((padsBegin[d] != 0) || (padsEnd[d] != 0)))) {
+                return false;
+            }
+        }
+
+        std::shared_ptr<ngraph::Node> fused;
+        if (auto plain = std::dynamic_pointer_cast<opset::Convolution>(conv)) {
+            if (plain->get_auto_pad() != ngraph::op::PadType::EXPLICIT) {
+                return false;
+            }
+            auto newBegin = plain->get_pads_begin();
+            auto newEnd = plain->get_pads_end();
+            for (std::size_t s = 0; s < newBegin.size(); ++s) {
+                newBegin[s] += padsBegin[s + 2];
+                newEnd[s] += padsEnd[s + 2];
+            }
+            fused = std::make_shared<opset::Convolution>(pad->input_value(0),
+                                                         plain->input_value(1),
+                                                         plain->get_strides(),
+                                                         newBegin,
+                                                         newEnd,
+                                                         plain->get_dilations(),
+                                                         plain->get_auto_pad());
+        } else if (auto grouped = std::dynamic_pointer_cast<opset::GroupConvolution>(conv)) {
+            if (grouped->get_auto_pad() != ngraph::op::PadType::EXPLICIT) {
+                return false;
+            }
+            auto newBegin = grouped->get_pads_begin();
+            auto newEnd = grouped->get_pads_end();
+            for (std::size_t s = 0; s < newBegin.size(); ++s) {
+                newBegin[s] += padsBegin[s + 2];
+                newEnd[s] += padsEnd[s + 2];
+            }
+            fused = std::make_shared<opset::GroupConvolution>(pad->input_value(0),
+                                                              grouped->input_value(1),
+                                                              grouped->get_strides(),
+                                                              newBegin,
+                                                              newEnd,
+                                                              grouped->get_dilations(),
+                                                              grouped->get_auto_pad());
+        } else {
+            return false;
+        }
+
+        fused->set_friendly_name(conv->get_friendly_name());
+        ngraph::copy_runtime_info({pad, conv}, fused);
+        ngraph::replace_node(conv, fused);
+        return true;
+    };
+
+    auto m = std::make_shared<ngraph::pattern::Matcher>(conv, "FusePadConvolution");
+    register_matcher(m, callback);
+}
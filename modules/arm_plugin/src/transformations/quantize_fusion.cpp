@@ -77,6 +77,9 @@ std::shared_ptr<ngraph::Node> makeTypeRelaxed(const ngraph::Node* node,
     CASE(opset::MatMul)
     CASE(opset::v1::ArmAvgPool)
     CASE(opset::ReduceMean)
+    CASE(opset::Add)
+    CASE(opset::Subtract)
+    CASE(opset::Multiply)
     IE_ASSERT(!"Arm Plugin: Unregistered type: ") << node;
 #undef CASE
 }
@@ -366,6 +369,75 @@ ArmPlugin::pass::MeanQuantizeFusion::MeanQuantizeFusion() {
         });
 }
 
+NGRAPH_RTTI_DEFINITION(ArmPlugin::pass::EltwiseQuantizeFusion, "EltwiseQuantizeFusion", 0);
+ArmPlugin::pass::EltwiseQuantizeFusion::EltwiseQuantizeFusion() {
+    auto node_pattern = ngraph::pattern::wrap_type<
+        opset::Add,
+        opset::Subtract,
+        opset::Multiply>({ngraph::pattern::any_input(ngraph::pattern::has_static_shape()),
+                          ngraph::pattern::any_input(ngraph::pattern::has_static_shape())},
+        ngraph::pattern::consumers_count(1));
+    auto fq_pattern = ngraph::pattern::wrap_type<opset::FakeQuantize>({
+        node_pattern,
+        ngraph::pattern::any_input(ngraph::pattern::has_static_shape()),
+        ngraph::pattern::any_input(ngraph::pattern::has_static_shape()),
+        ngraph::pattern::any_input(ngraph::pattern::has_static_shape()),
+        ngraph::pattern::any_input(ngraph::pattern::has_static_shape())},
+        ngraph::pattern::has_static_shape());
+    register_matcher(std::make_shared<ngraph::pattern::Matcher>(fq_pattern, "EltwiseQuantizeFusion"),
+        [=](ngraph::pattern::Matcher& m) {
+            auto pattern_map = m.get_pattern_value_map();
+            auto node = pattern_map[node_pattern].get_node_shared_ptr();
+            auto fakeQuantize = safe_cast<opset::FakeQuantize>(pattern_map[fq_pattern].get_node_shared_ptr());
+            auto quantizedType = fakeQuantize->get_output_element_type(0);
+            if (!quantizedType.is_quantized()) {
+                return false;
+            }
+            // Both operands have to be quantized tensors whose scales are known,
+            // i.e. produced by operations already fused with their requantization
+            for (auto&& input : node->inputs()) {
+                auto inputType = input.get_element_type();
+                if (inputType != ngraph::element::i8 && inputType != ngraph::element::u8) {
+                    return false;
+                }
+                auto sourceNode = input.get_source_output().get_node();
+                if (ngraph::op::is_constant(sourceNode) ||
+                    (sourceNode->get_rt_info().count("QuantizationInfo") == 0)) {
+                    return false;
+                }
+            }
+            auto quantizationInfo = makeQuantizationInfo(getFloatVector(fakeQuantize->input_value(1).get_node()),
+                                                         getFloatVector(fakeQuantize->input_value(2).get_node()),
+                                                         getFloatVector(fakeQuantize->input_value(3).get_node()),
+                                                         getFloatVector(fakeQuantize->input_value(4).get_node()));
+            // ACL requantizes eltwise results per tensor only
+            if (!allEqualToFirst(quantizationInfo.first) || !allEqualToFirst(quantizationInfo.second)) {
+                return false;
+            }
+            if (quantizationInfo.first[0] == 0.) {
+                return false;
+            }
+
+            std::vector<ngraph::Output<ngraph::Node>> newInputs;
+            Types inputTypes;
+            for (auto&& input : node->inputs()) {
+                inputTypes.emplace_back(input.get_element_type());
+                newInputs.emplace_back(input.get_source_output());
+            }
+            auto newNode = makeTypeRelaxed(node.get(), newInputs, inputTypes, Types{quantizedType});
+            newNode->set_friendly_name(node->get_friendly_name() + '_' + fakeQuantize->get_friendly_name());
+            ngraph::copy_runtime_info({node, std::static_pointer_cast<ngraph::Node>(fakeQuantize)}, newNode);
+            for (std::size_t i = 0; i < 2; ++i) {
+                newNode->get_rt_info()["Input" + std::to_string(i) + "QuantizationInfo"] =
+                    node->input_value(i).get_node()->get_rt_info().at("QuantizationInfo");
+            }
+            newNode->get_rt_info()["QuantizationInfo"] =
+                arm_compute::QuantizationInfo{1.f/quantizationInfo.first[0], static_cast<std::int32_t>(std::round(quantizationInfo.second[0]))};
+            ngraph::replace_node(fakeQuantize, newNode);
+            return true;
+        });
+}
+
 NGRAPH_RTTI_DEFINITION(ArmPlugin::pass::DequantizeInputFusion, "DequantizeInputFusion", 0);
 ArmPlugin::pass::DequantizeInputFusion::DequantizeInputFusion() {
     auto scale_pattern = ngraph::pattern::wrap_type<opset::Constant>();
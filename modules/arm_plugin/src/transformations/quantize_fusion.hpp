@@ -28,6 +28,12 @@ public:
     MeanQuantizeFusion();
 };
 
+class EltwiseQuantizeFusion : public ngraph::pass::MatcherPass {
+public:
+    NGRAPH_RTTI_DECLARATION;
+    EltwiseQuantizeFusion();
+};
+
 class DequantizeInputFusion : public ngraph::pass::MatcherPass{
 public:
     NGRAPH_RTTI_DECLARATION;
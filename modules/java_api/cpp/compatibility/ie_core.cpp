@@ -317,6 +317,28 @@ JNIEXPORT jlong JNICALL Java_org_intel_openvino_compatibility_IECore_GetConfig(J
     return 0;
 }
 
+JNIEXPORT jlong JNICALL Java_org_intel_openvino_compatibility_IECore_GetDefaultContext(JNIEnv *env, jobject obj, jlong addr, jstring deviceName)
+{
+    static const char method_name[] = "GetDefaultContext";
+    try
+    {
+        Core *core = (Core *) addr;
+        RemoteContext::Ptr *context = new RemoteContext::Ptr();
+        *context = core->GetDefaultContext(jstringToString(env, deviceName));
+
+        return (jlong) context;
+    }
+    catch (const std::exception &e)
+    {
+        throwJavaException(env, &e, method_name);
+    }
+    catch (...)
+    {
+        throwJavaException(env, 0, method_name);
+    }
+    return 0;
+}
+
 JNIEXPORT void JNICALL Java_org_intel_openvino_compatibility_IECore_delete(JNIEnv *, jobject, jlong addr)
 {
     Core *core = (Core *)addr;
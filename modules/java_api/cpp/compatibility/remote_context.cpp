@@ -0,0 +1,68 @@
+// Copyright (C) 2020-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include <inference_engine.hpp>
+
+#include "openvino_java.hpp"
+#include "jni_common.hpp"
+
+using namespace InferenceEngine;
+
+JNIEXPORT jlong JNICALL Java_org_intel_openvino_compatibility_RemoteContext_CreateRemoteBlob(JNIEnv *env, jobject obj, jlong addr, jlong tensorDescAddr, jlong deviceMemHandle)
+{
+    static const char method_name[] = "CreateRemoteBlob";
+    try
+    {
+        RemoteContext::Ptr *context = reinterpret_cast<RemoteContext::Ptr *>(addr);
+        TensorDesc *tDesc = (TensorDesc *)tensorDescAddr;
+
+        // "MEM_HANDLE" is the device-pointer parameter key shared by the GPU
+        // plugins (see the plugin's public remote params header); the memory
+        // stays owned by the application and the blob wraps it without a copy
+        ParamMap params;
+        if (deviceMemHandle != 0) {
+            params["MEM_HANDLE"] = reinterpret_cast<void *>(deviceMemHandle);
+        }
+
+        Blob::Ptr *blob = new Blob::Ptr();
+        *blob = (*context)->CreateBlob(*tDesc, params);
+
+        return (jlong)blob;
+    }
+    catch (const std::exception &e)
+    {
+        throwJavaException(env, &e, method_name);
+    }
+    catch (...)
+    {
+        throwJavaException(env, 0, method_name);
+    }
+
+    return 0;
+}
+
+JNIEXPORT jstring JNICALL Java_org_intel_openvino_compatibility_RemoteContext_GetDeviceName(JNIEnv *env, jobject obj, jlong addr)
+{
+    static const char method_name[] = "GetDeviceName";
+    try
+    {
+        RemoteContext::Ptr *context = reinterpret_cast<RemoteContext::Ptr *>(addr);
+        return env->NewStringUTF((*context)->getDeviceName().c_str());
+    }
+    catch (const std::exception &e)
+    {
+        throwJavaException(env, &e, method_name);
+    }
+    catch (...)
+    {
+        throwJavaException(env, 0, method_name);
+    }
+
+    return 0;
+}
+
+JNIEXPORT void JNICALL Java_org_intel_openvino_compatibility_RemoteContext_delete(JNIEnv *, jobject, jlong addr)
+{
+    RemoteContext::Ptr *context = reinterpret_cast<RemoteContext::Ptr *>(addr);
+    delete context;
+}
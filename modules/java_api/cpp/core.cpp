@@ -60,6 +60,34 @@ JNIEXPORT jlong JNICALL Java_org_intel_openvino_Core_ReadModel1(JNIEnv *env, job
     return 0;
 }
 
+JNIEXPORT jlong JNICALL Java_org_intel_openvino_Core_ReadModelFromBuffer(JNIEnv *env, jobject obj, jlong coreAddr, jstring xml, jobject weights)
+{
+    JNI_METHOD("ReadModelFromBuffer",
+        std::string n_xml = jstringToString(env, xml);
+        Core *core = (Core *)coreAddr;
+
+        // The weights tensor wraps the buffer's memory without a copy, so a
+        // mapped .bin streams from the page cache; the buffer must stay alive
+        // while the model (and anything compiled from it) is in use
+        Tensor weights_tensor;
+        if (weights)
+        {
+            void *address = env->GetDirectBufferAddress(weights);
+            if (!address) {
+                throw std::runtime_error("Weights buffer is not a direct buffer!");
+            }
+            jlong capacity = env->GetDirectBufferCapacity(weights);
+            weights_tensor = Tensor(element::u8, Shape{(size_t)capacity}, address);
+        }
+
+        std::shared_ptr<Model> *model = new std::shared_ptr<Model>;
+        *model = core->read_model(n_xml, weights_tensor);
+
+        return reinterpret_cast<jlong>(model);
+    )
+    return 0;
+}
+
 JNIEXPORT jlong JNICALL Java_org_intel_openvino_Core_CompileModel(JNIEnv *env, jobject obj, jlong coreAddr, jlong netAddr, jstring device)
 {
     JNI_METHOD("CompileModel",
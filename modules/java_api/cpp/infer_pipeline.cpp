@@ -0,0 +1,149 @@
+// Copyright (C) 2020-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include <jni.h> // JNI header provided by JDK
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <vector>
+#include "openvino/openvino.hpp"
+
+#include "openvino_java.hpp"
+#include "jni_common.hpp"
+
+using namespace ov;
+
+namespace
+{
+    // Owns K infer requests over one compiled model; submit takes a free
+    // request (blocking when all are in flight), binds the tensors, starts
+    // the request asynchronously and hands the slot back from the completion
+    // callback, so dispatch is driven by completions rather than by callers
+    // polling
+    struct InferPipeline
+    {
+        std::vector<InferRequest> requests;
+        std::vector<size_t> free_slots;
+        std::mutex mutex;
+        std::condition_variable available;
+    };
+}
+
+JNIEXPORT jlong JNICALL Java_org_intel_openvino_InferPipeline_Create(JNIEnv *env, jobject, jlong compiledModelAddr, jint count)
+{
+    JNI_METHOD("Create",
+        CompiledModel *compiled_model = (CompiledModel *)compiledModelAddr;
+        if (count < 1) {
+            throw std::runtime_error("Pipeline needs at least one request!");
+        }
+        auto pipeline = std::unique_ptr<InferPipeline>(new InferPipeline());
+        for (jint k = 0; k < count; ++k)
+        {
+            pipeline->requests.push_back(compiled_model->create_infer_request());
+            pipeline->free_slots.push_back(k);
+        }
+        return (jlong)pipeline.release();
+    )
+    return 0;
+}
+
+JNIEXPORT void JNICALL Java_org_intel_openvino_InferPipeline_Submit(JNIEnv *env, jobject, jlong addr, jlongArray inputAddrs, jlongArray outputAddrs, jobject done)
+{
+    JNI_METHOD("Submit",
+        InferPipeline *pipeline = (InferPipeline *)addr;
+
+        JavaVM *vm = g_jni_cache.vm;
+        if (!vm && env->GetJavaVM(&vm) != JNI_OK) {
+            throw std::runtime_error("Unable to get JavaVM!");
+        }
+        jmethodID accept_method_id = g_jni_cache.consumer_accept;
+        if (!accept_method_id) {
+            jclass consumer_class = env->FindClass("java/util/function/Consumer");
+            accept_method_id = env->GetMethodID(consumer_class, "accept", "(Ljava/lang/Object;)V");
+        }
+
+        size_t slot;
+        {
+            std::unique_lock<std::mutex> lock(pipeline->mutex);
+            pipeline->available.wait(lock, [pipeline] { return !pipeline->free_slots.empty(); });
+            slot = pipeline->free_slots.back();
+            pipeline->free_slots.pop_back();
+        }
+        InferRequest &request = pipeline->requests[slot];
+
+        jsize input_count = env->GetArrayLength(inputAddrs);
+        jlong *inputs = env->GetLongArrayElements(inputAddrs, nullptr);
+        for (jsize i = 0; i < input_count; ++i)
+            request.set_input_tensor(i, *(Tensor *)inputs[i]);
+        env->ReleaseLongArrayElements(inputAddrs, inputs, JNI_ABORT);
+
+        if (outputAddrs) {
+            jsize output_count = env->GetArrayLength(outputAddrs);
+            jlong *outputs = env->GetLongArrayElements(outputAddrs, nullptr);
+            for (jsize i = 0; i < output_count; ++i)
+                request.set_output_tensor(i, *(Tensor *)outputs[i]);
+            env->ReleaseLongArrayElements(outputAddrs, outputs, JNI_ABORT);
+        }
+
+        std::shared_ptr<_jobject> global_done(env->NewGlobalRef(done), [vm](jobject ref) {
+            JavaThreadGuard guard(vm);
+            if (guard.env())
+                guard.env()->DeleteGlobalRef(ref);
+        });
+
+        request.set_callback([pipeline, slot, vm, global_done, accept_method_id](std::exception_ptr ex) {
+            {
+                JavaThreadGuard guard(vm);
+                JNIEnv *cb_env = guard.env();
+                if (cb_env)
+                {
+                    jobject error = nullptr;
+                    if (ex)
+                    {
+                        std::string what = "inference failed";
+                        try { std::rethrow_exception(ex); }
+                        catch (const std::exception &e) { what = e.what(); }
+                        catch (...) {}
+                        jclass exception_class = cb_env->FindClass("java/lang/Exception");
+                        jmethodID exception_init = cb_env->GetMethodID(exception_class, "<init>", "(Ljava/lang/String;)V");
+                        error = cb_env->NewObject(exception_class, exception_init, cb_env->NewStringUTF(what.c_str()));
+                    }
+                    cb_env->CallVoidMethod(global_done.get(), accept_method_id, error);
+                    if (cb_env->ExceptionCheck())
+                        cb_env->ExceptionClear();
+                }
+            }
+            // The slot goes back only after the callback returns, so the next
+            // submit never rebinds a request whose completion is still running
+            {
+                std::lock_guard<std::mutex> lock(pipeline->mutex);
+                pipeline->free_slots.push_back(slot);
+            }
+            pipeline->available.notify_all();
+        });
+        request.start_async();
+    )
+}
+
+JNIEXPORT void JNICALL Java_org_intel_openvino_InferPipeline_WaitAll(JNIEnv *env, jobject, jlong addr)
+{
+    JNI_METHOD("WaitAll",
+        InferPipeline *pipeline = (InferPipeline *)addr;
+        std::unique_lock<std::mutex> lock(pipeline->mutex);
+        pipeline->available.wait(lock, [pipeline] {
+            return pipeline->free_slots.size() == pipeline->requests.size();
+        });
+    )
+}
+
+JNIEXPORT void JNICALL Java_org_intel_openvino_InferPipeline_delete(JNIEnv *, jobject, jlong addr)
+{
+    InferPipeline *pipeline = (InferPipeline *)addr;
+    {
+        std::unique_lock<std::mutex> lock(pipeline->mutex);
+        pipeline->available.wait(lock, [pipeline] {
+            return pipeline->free_slots.size() == pipeline->requests.size();
+        });
+    }
+    delete pipeline;
+}
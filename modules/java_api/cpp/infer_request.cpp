@@ -24,6 +24,42 @@ JNIEXPORT void JNICALL Java_org_intel_openvino_InferRequest_StartAsync(JNIEnv *e
     )
 }
 
+JNIEXPORT void JNICALL Java_org_intel_openvino_InferRequest_SetCompletionCallback(JNIEnv *env, jobject obj, jlong addr, jobject callback)
+{
+    JNI_METHOD("SetCompletionCallback",
+        InferRequest *infer_request = (InferRequest *)addr;
+
+        JavaVM *vm = g_jni_cache.vm;
+        if (!vm && env->GetJavaVM(&vm) != JNI_OK) {
+            throw std::runtime_error("Unable to get JavaVM!");
+        }
+        jmethodID run_method_id = g_jni_cache.runnable_run;
+        if (!run_method_id) {
+            jclass runnable_class = env->FindClass("java/lang/Runnable");
+            run_method_id = env->GetMethodID(runnable_class, "run", "()V");
+        }
+
+        // The global ref keeps the callback alive across calls; its deleter
+        // attaches to the JVM, so the ref is released from whichever thread
+        // drops the last copy of the lambda
+        std::shared_ptr<_jobject> global_callback(env->NewGlobalRef(callback), [vm](jobject ref) {
+            JavaThreadGuard guard(vm);
+            if (guard.env())
+                guard.env()->DeleteGlobalRef(ref);
+        });
+
+        infer_request->set_callback([vm, global_callback, run_method_id](std::exception_ptr) {
+            JavaThreadGuard guard(vm);
+            JNIEnv *cb_env = guard.env();
+            if (!cb_env)
+                return;
+            cb_env->CallVoidMethod(global_callback.get(), run_method_id);
+            if (cb_env->ExceptionCheck())
+                cb_env->ExceptionClear();
+        });
+    )
+}
+
 JNIEXPORT void JNICALL Java_org_intel_openvino_InferRequest_Wait(JNIEnv *env, jobject obj, jlong addr)
 {
     JNI_METHOD("Wait",
@@ -32,6 +68,31 @@ JNIEXPORT void JNICALL Java_org_intel_openvino_InferRequest_Wait(JNIEnv *env, jo
     )
 }
 
+JNIEXPORT void JNICALL Java_org_intel_openvino_InferRequest_InferTensors(JNIEnv *env, jobject, jlong addr, jlongArray inputAddrs, jlongArray outputAddrs)
+{
+    JNI_METHOD("InferTensors",
+        InferRequest *infer_request = (InferRequest *)addr;
+
+        // One crossing for the whole call: bind every input and output tensor
+        // by index, then run; the results land in the bound output tensors
+        jsize input_count = env->GetArrayLength(inputAddrs);
+        jlong *inputs = env->GetLongArrayElements(inputAddrs, nullptr);
+        for (jsize i = 0; i < input_count; ++i)
+            infer_request->set_input_tensor(i, *(Tensor *)inputs[i]);
+        env->ReleaseLongArrayElements(inputAddrs, inputs, JNI_ABORT);
+
+        if (outputAddrs) {
+            jsize output_count = env->GetArrayLength(outputAddrs);
+            jlong *outputs = env->GetLongArrayElements(outputAddrs, nullptr);
+            for (jsize i = 0; i < output_count; ++i)
+                infer_request->set_output_tensor(i, *(Tensor *)outputs[i]);
+            env->ReleaseLongArrayElements(outputAddrs, outputs, JNI_ABORT);
+        }
+
+        infer_request->infer();
+    )
+}
+
 JNIEXPORT void JNICALL Java_org_intel_openvino_InferRequest_SetInputTensor(JNIEnv *env, jobject, jlong addr, jlong tensorAddr)
 {
     JNI_METHOD("SetInputTensor",
@@ -77,8 +138,11 @@ JNIEXPORT jlong JNICALL Java_org_intel_openvino_InferRequest_GetTensor(JNIEnv *e
 
 JNIEXPORT void JNICALL Java_org_intel_openvino_InferRequest_delete(JNIEnv *env, jobject obj, jlong addr)
 {
-    jclass cls = env->GetObjectClass(obj);
-    jfieldID field = env->GetFieldID(cls, "isReleased", "Z");
+    jfieldID field = g_jni_cache.infer_request_is_released;
+    if (!field) {
+        jclass cls = env->GetObjectClass(obj);
+        field = env->GetFieldID(cls, "isReleased", "Z");
+    }
     jboolean isReleased = env->GetBooleanField(obj, field);
     if (!isReleased) {
       InferRequest *req = (InferRequest *)addr;
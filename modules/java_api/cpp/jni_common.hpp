@@ -4,6 +4,25 @@
 #include <jni.h>   // JNI header provided by JDK
 #include <stdio.h> // C Standard IO Header
 
+// One-time cache of classes, method and field IDs, filled in JNI_OnLoad
+// (jni_onload.cpp); FindClass/GetMethodID are reflective lookups and must
+// stay off the per-call paths. Classes are held as global refs
+struct JniCache
+{
+    JavaVM *vm = nullptr;
+    jclass array_list_class = nullptr;
+    jmethodID array_list_init = nullptr;
+    jmethodID array_list_add = nullptr;
+    jclass output_class = nullptr;
+    jmethodID output_init = nullptr;
+    jclass runnable_class = nullptr;
+    jmethodID runnable_run = nullptr;
+    jclass consumer_class = nullptr;
+    jmethodID consumer_accept = nullptr;
+    jfieldID infer_request_is_released = nullptr;
+};
+extern JniCache g_jni_cache;
+
 #define JNI_METHOD(name, body)                    \
     static const char method_name[] = name;       \
     try                                           \
@@ -19,6 +38,36 @@
         throwJavaException(env, 0, method_name);  \
     }
 
+// Attaches the current native thread to the JVM for the lifetime of the
+// scope; completion callbacks fire on device threads the JVM does not know
+class JavaThreadGuard
+{
+public:
+    explicit JavaThreadGuard(JavaVM *vm) : vm_(vm), env_(nullptr), attached_(false)
+    {
+        if (vm_->GetEnv((void **)&env_, JNI_VERSION_1_6) == JNI_EDETACHED)
+        {
+            if (vm_->AttachCurrentThread((void **)&env_, nullptr) == JNI_OK)
+                attached_ = true;
+            else
+                env_ = nullptr;
+        }
+    }
+    JavaThreadGuard(const JavaThreadGuard &) = delete;
+    JavaThreadGuard &operator=(const JavaThreadGuard &) = delete;
+    ~JavaThreadGuard()
+    {
+        if (attached_)
+            vm_->DetachCurrentThread();
+    }
+    JNIEnv *env() const { return env_; }
+
+private:
+    JavaVM *vm_;
+    JNIEnv *env_;
+    bool attached_;
+};
+
 static void throwJavaException(JNIEnv *env, const std::exception *e, const char *method)
 {
     std::string what = "unknown exception";
@@ -0,0 +1,80 @@
+// Copyright (C) 2020-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include <jni.h> // JNI header provided by JDK
+
+#include "jni_common.hpp"
+
+JniCache g_jni_cache;
+
+static jclass globalClassRef(JNIEnv *env, const char *name)
+{
+    jclass local = env->FindClass(name);
+    if (!local)
+    {
+        env->ExceptionClear();
+        return nullptr;
+    }
+    jclass global = (jclass)env->NewGlobalRef(local);
+    env->DeleteLocalRef(local);
+    return global;
+}
+
+extern "C" JNIEXPORT jint JNICALL JNI_OnLoad(JavaVM *vm, void *)
+{
+    JNIEnv *env = nullptr;
+    if (vm->GetEnv((void **)&env, JNI_VERSION_1_6) != JNI_OK)
+        return JNI_ERR;
+
+    g_jni_cache.vm = vm;
+
+    g_jni_cache.array_list_class = globalClassRef(env, "java/util/ArrayList");
+    if (g_jni_cache.array_list_class)
+    {
+        g_jni_cache.array_list_init = env->GetMethodID(g_jni_cache.array_list_class, "<init>", "()V");
+        g_jni_cache.array_list_add = env->GetMethodID(g_jni_cache.array_list_class, "add", "(Ljava/lang/Object;)Z");
+    }
+
+    g_jni_cache.output_class = globalClassRef(env, "org/intel/openvino/Output");
+    if (g_jni_cache.output_class)
+        g_jni_cache.output_init = env->GetMethodID(g_jni_cache.output_class, "<init>", "(J)V");
+
+    g_jni_cache.runnable_class = globalClassRef(env, "java/lang/Runnable");
+    if (g_jni_cache.runnable_class)
+        g_jni_cache.runnable_run = env->GetMethodID(g_jni_cache.runnable_class, "run", "()V");
+
+    g_jni_cache.consumer_class = globalClassRef(env, "java/util/function/Consumer");
+    if (g_jni_cache.consumer_class)
+        g_jni_cache.consumer_accept = env->GetMethodID(g_jni_cache.consumer_class, "accept", "(Ljava/lang/Object;)V");
+
+    jclass infer_request_class = env->FindClass("org/intel/openvino/InferRequest");
+    if (infer_request_class)
+    {
+        g_jni_cache.infer_request_is_released = env->GetFieldID(infer_request_class, "isReleased", "Z");
+        env->DeleteLocalRef(infer_request_class);
+    }
+    else
+    {
+        env->ExceptionClear();
+    }
+
+    return JNI_VERSION_1_6;
+}
+
+extern "C" JNIEXPORT void JNICALL JNI_OnUnload(JavaVM *vm, void *)
+{
+    JNIEnv *env = nullptr;
+    if (vm->GetEnv((void **)&env, JNI_VERSION_1_6) != JNI_OK)
+        return;
+
+    for (jclass *ref : {&g_jni_cache.array_list_class, &g_jni_cache.output_class, &g_jni_cache.runnable_class,
+                        &g_jni_cache.consumer_class})
+    {
+        if (*ref)
+        {
+            env->DeleteGlobalRef(*ref);
+            *ref = nullptr;
+        }
+    }
+    g_jni_cache.vm = nullptr;
+}
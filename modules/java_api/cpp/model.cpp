@@ -36,13 +36,18 @@ JNIEXPORT jobject JNICALL Java_org_intel_openvino_Model_getOutputs(JNIEnv * env,
         std::shared_ptr<Model> *model = reinterpret_cast<std::shared_ptr<Model> *>(modelAddr);
         const std::vector<ov::Output<ov::Node>>& outputs_vec = (*model)->outputs();
 
-        jclass arrayClass = env->FindClass("java/util/ArrayList");
-        jmethodID arrayInit = env->GetMethodID(arrayClass, "<init>", "()V");
+        jclass arrayClass = g_jni_cache.array_list_class ? g_jni_cache.array_list_class
+                                                         : env->FindClass("java/util/ArrayList");
+        jmethodID arrayInit = g_jni_cache.array_list_init ? g_jni_cache.array_list_init
+                                                          : env->GetMethodID(arrayClass, "<init>", "()V");
         jobject arrayObj = env->NewObject(arrayClass, arrayInit);
-        jmethodID arrayAdd = env->GetMethodID(arrayClass, "add", "(Ljava/lang/Object;)Z");
+        jmethodID arrayAdd = g_jni_cache.array_list_add ? g_jni_cache.array_list_add
+                                                        : env->GetMethodID(arrayClass, "add", "(Ljava/lang/Object;)Z");
 
-        jclass outputClass = env->FindClass("org/intel/openvino/Output");
-        jmethodID outputConstructor = env->GetMethodID(outputClass,"<init>","(J)V");
+        jclass outputClass = g_jni_cache.output_class ? g_jni_cache.output_class
+                                                      : env->FindClass("org/intel/openvino/Output");
+        jmethodID outputConstructor = g_jni_cache.output_init ? g_jni_cache.output_init
+                                                              : env->GetMethodID(outputClass, "<init>", "(J)V");
 
         Output<Node> *output;
         for (const auto &item : outputs_vec) {
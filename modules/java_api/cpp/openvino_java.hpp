@@ -27,8 +27,16 @@ extern "C"
     JNIEXPORT jlong JNICALL Java_org_intel_openvino_compatibility_IECore_GetConfig(JNIEnv *, jobject, jlong, jstring, jstring);
     JNIEXPORT jlong JNICALL Java_org_intel_openvino_compatibility_IECore_GetCore(JNIEnv *, jobject);
     JNIEXPORT jlong JNICALL Java_org_intel_openvino_compatibility_IECore_GetCore1(JNIEnv *, jobject, jstring);
+    JNIEXPORT jlong JNICALL Java_org_intel_openvino_compatibility_IECore_GetDefaultContext(JNIEnv *, jobject, jlong, jstring);
     JNIEXPORT void JNICALL Java_org_intel_openvino_compatibility_IECore_delete(JNIEnv *, jobject, jlong);
 
+    //
+    // RemoteContext
+    //
+    JNIEXPORT jlong JNICALL Java_org_intel_openvino_compatibility_RemoteContext_CreateRemoteBlob(JNIEnv *, jobject, jlong, jlong, jlong);
+    JNIEXPORT jstring JNICALL Java_org_intel_openvino_compatibility_RemoteContext_GetDeviceName(JNIEnv *, jobject, jlong);
+    JNIEXPORT void JNICALL Java_org_intel_openvino_compatibility_RemoteContext_delete(JNIEnv *, jobject, jlong);
+
     //
     // CNNNetwork
     //
@@ -132,6 +140,7 @@ extern "C"
     JNIEXPORT jlong JNICALL Java_org_intel_openvino_Core_GetCore1(JNIEnv *, jobject, jstring);
     JNIEXPORT jlong JNICALL Java_org_intel_openvino_Core_ReadModel(JNIEnv *, jobject, jlong, jstring);
     JNIEXPORT jlong JNICALL Java_org_intel_openvino_Core_ReadModel1(JNIEnv *, jobject, jlong, jstring, jstring);
+    JNIEXPORT jlong JNICALL Java_org_intel_openvino_Core_ReadModelFromBuffer(JNIEnv *, jobject, jlong, jstring, jobject);
     JNIEXPORT jlong JNICALL Java_org_intel_openvino_Core_CompileModel(JNIEnv *, jobject, jlong, jlong, jstring);
     JNIEXPORT jlong JNICALL Java_org_intel_openvino_Core_GetProperty(JNIEnv *, jobject, jlong, jstring, jstring);
     JNIEXPORT void JNICALL Java_org_intel_openvino_Core_SetProperty(JNIEnv *, jobject, jlong, jstring, jobject);
@@ -157,6 +166,8 @@ extern "C"
     JNIEXPORT void JNICALL Java_org_intel_openvino_InferRequest_Infer(JNIEnv *, jobject, jlong);
     JNIEXPORT void JNICALL Java_org_intel_openvino_InferRequest_StartAsync(JNIEnv *, jobject, jlong);
     JNIEXPORT void JNICALL Java_org_intel_openvino_InferRequest_Wait(JNIEnv *, jobject, jlong);
+    JNIEXPORT void JNICALL Java_org_intel_openvino_InferRequest_InferTensors(JNIEnv *, jobject, jlong, jlongArray, jlongArray);
+    JNIEXPORT void JNICALL Java_org_intel_openvino_InferRequest_SetCompletionCallback(JNIEnv *, jobject, jlong, jobject);
     JNIEXPORT void JNICALL Java_org_intel_openvino_InferRequest_SetInputTensor(JNIEnv *, jobject, jlong, jlong);
     JNIEXPORT void JNICALL Java_org_intel_openvino_InferRequest_SetOutputTensor(JNIEnv *, jobject, jlong, jlong);
     JNIEXPORT jlong JNICALL Java_org_intel_openvino_InferRequest_GetOutputTensor(JNIEnv *, jobject, jlong);
@@ -166,11 +177,26 @@ extern "C"
     // ov::Tensor
     JNIEXPORT jlong JNICALL Java_org_intel_openvino_Tensor_TensorCArray(JNIEnv *, jobject, jint, jintArray, jlong);
     JNIEXPORT jlong JNICALL Java_org_intel_openvino_Tensor_TensorFloat(JNIEnv *, jobject, jintArray, jfloatArray);
+    JNIEXPORT jlong JNICALL Java_org_intel_openvino_Tensor_TensorDirectBuffer(JNIEnv *, jobject, jint, jintArray, jobject);
+    JNIEXPORT jobject JNICALL Java_org_intel_openvino_Tensor_asDirectBuffer(JNIEnv *, jobject, jlong);
     JNIEXPORT jint JNICALL Java_org_intel_openvino_Tensor_GetSize(JNIEnv *, jobject, jlong);
     JNIEXPORT jintArray JNICALL Java_org_intel_openvino_Tensor_GetShape(JNIEnv *, jobject, jlong);
     JNIEXPORT jfloatArray JNICALL Java_org_intel_openvino_Tensor_asFloat(JNIEnv *, jobject, jlong);
     JNIEXPORT void JNICALL Java_org_intel_openvino_Tensor_delete(JNIEnv *, jobject, jlong);
 
+    // InferPipeline
+    JNIEXPORT jlong JNICALL Java_org_intel_openvino_InferPipeline_Create(JNIEnv *, jobject, jlong, jint);
+    JNIEXPORT void JNICALL Java_org_intel_openvino_InferPipeline_Submit(JNIEnv *, jobject, jlong, jlongArray, jlongArray, jobject);
+    JNIEXPORT void JNICALL Java_org_intel_openvino_InferPipeline_WaitAll(JNIEnv *, jobject, jlong);
+    JNIEXPORT void JNICALL Java_org_intel_openvino_InferPipeline_delete(JNIEnv *, jobject, jlong);
+
+    // TensorPool
+    JNIEXPORT jlong JNICALL Java_org_intel_openvino_TensorPool_Create(JNIEnv *, jobject);
+    JNIEXPORT jlong JNICALL Java_org_intel_openvino_TensorPool_Borrow(JNIEnv *, jobject, jlong, jint, jintArray);
+    JNIEXPORT void JNICALL Java_org_intel_openvino_TensorPool_Release(JNIEnv *, jobject, jlong, jlong);
+    JNIEXPORT void JNICALL Java_org_intel_openvino_TensorPool_Clear(JNIEnv *, jobject, jlong);
+    JNIEXPORT void JNICALL Java_org_intel_openvino_TensorPool_delete(JNIEnv *, jobject, jlong);
+
     // ov::PrePostProcessor
     JNIEXPORT jlong JNICALL Java_org_intel_openvino_PrePostProcessor_GetPrePostProcessor(JNIEnv *, jobject, jlong);
     JNIEXPORT jlong JNICALL Java_org_intel_openvino_PrePostProcessor_Input(JNIEnv *, jobject, jlong);
@@ -55,6 +55,41 @@ JNIEXPORT jlong JNICALL Java_org_intel_openvino_Tensor_TensorFloat(JNIEnv *env,
     return 0;
 }
 
+JNIEXPORT jlong JNICALL Java_org_intel_openvino_Tensor_TensorDirectBuffer(JNIEnv *env, jobject, jint type, jintArray shape, jobject data)
+{
+    JNI_METHOD(
+        "TensorDirectBuffer",
+        auto input_type = element::Type(element::Type_t(type));
+        Shape input_shape = jintArrayToVector(env, shape);
+
+        void *address = env->GetDirectBufferAddress(data);
+        if (!address) {
+            throw std::runtime_error("Buffer is not a direct buffer!");
+        }
+        jlong capacity = env->GetDirectBufferCapacity(data);
+        if (capacity < (jlong)(shape_size(input_shape) * input_type.size())) {
+            throw std::runtime_error("Buffer capacity is less than the tensor byte size!");
+        }
+        // The tensor wraps the buffer's memory, no copy is made; the buffer
+        // must stay alive and unchanged while the tensor is in use
+        Tensor *ov_tensor = new Tensor(input_type, input_shape, address);
+        return (jlong)ov_tensor;
+    )
+    return 0;
+}
+
+JNIEXPORT jobject JNICALL Java_org_intel_openvino_Tensor_asDirectBuffer(JNIEnv *env, jobject, jlong addr)
+{
+    JNI_METHOD(
+        "asDirectBuffer",
+        Tensor *ov_tensor = (Tensor *)addr;
+        // A view over the tensor's memory, no copy is made; it is only valid
+        // while the tensor is alive
+        return env->NewDirectByteBuffer(ov_tensor->data(), ov_tensor->get_byte_size());
+    )
+    return 0;
+}
+
 JNIEXPORT jint JNICALL Java_org_intel_openvino_Tensor_GetSize(JNIEnv *env, jobject, jlong addr)
 {
     JNI_METHOD(
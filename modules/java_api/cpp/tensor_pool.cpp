@@ -0,0 +1,83 @@
+// Copyright (C) 2020-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include <jni.h> // JNI header provided by JDK
+#include <map>
+#include <mutex>
+#include <vector>
+#include "openvino/openvino.hpp"
+
+#include "openvino_java.hpp"
+#include "jni_common.hpp"
+
+using namespace ov;
+
+namespace
+{
+    // Free lists of ov::Tensor values bucketed by element type and shape.
+    // The pool stores values, not pointers: ov::Tensor is ref-counted, so a
+    // released tensor's memory stays alive in the bucket even after the Java
+    // wrapper that borrowed it is finalized, and a later borrow reuses it
+    struct TensorPool
+    {
+        std::mutex mutex;
+        std::map<std::pair<int, std::vector<size_t>>, std::vector<Tensor>> free_list;
+    };
+}
+
+JNIEXPORT jlong JNICALL Java_org_intel_openvino_TensorPool_Create(JNIEnv *env, jobject)
+{
+    JNI_METHOD("Create",
+        return (jlong)new TensorPool();
+    )
+    return 0;
+}
+
+JNIEXPORT jlong JNICALL Java_org_intel_openvino_TensorPool_Borrow(JNIEnv *env, jobject, jlong addr, jint type, jintArray shape)
+{
+    JNI_METHOD("Borrow",
+        TensorPool *pool = (TensorPool *)addr;
+        std::vector<size_t> dims = jintArrayToVector(env, shape);
+        {
+            std::lock_guard<std::mutex> lock(pool->mutex);
+            auto bucket = pool->free_list.find({(int)type, dims});
+            if (bucket != pool->free_list.end() && !bucket->second.empty())
+            {
+                Tensor *ov_tensor = new Tensor(bucket->second.back());
+                bucket->second.pop_back();
+                return (jlong)ov_tensor;
+            }
+        }
+        return (jlong)new Tensor(element::Type_t(type), Shape(dims));
+    )
+    return 0;
+}
+
+JNIEXPORT void JNICALL Java_org_intel_openvino_TensorPool_Release(JNIEnv *env, jobject, jlong addr, jlong tensorAddr)
+{
+    JNI_METHOD("Release",
+        TensorPool *pool = (TensorPool *)addr;
+        Tensor *ov_tensor = (Tensor *)tensorAddr;
+        const Shape &shape = ov_tensor->get_shape();
+        std::pair<int, std::vector<size_t>> key((int)element::Type_t(ov_tensor->get_element_type()),
+                                                std::vector<size_t>(shape.begin(), shape.end()));
+
+        std::lock_guard<std::mutex> lock(pool->mutex);
+        pool->free_list[key].push_back(*ov_tensor);
+    )
+}
+
+JNIEXPORT void JNICALL Java_org_intel_openvino_TensorPool_Clear(JNIEnv *env, jobject, jlong addr)
+{
+    JNI_METHOD("Clear",
+        TensorPool *pool = (TensorPool *)addr;
+        std::lock_guard<std::mutex> lock(pool->mutex);
+        pool->free_list.clear();
+    )
+}
+
+JNIEXPORT void JNICALL Java_org_intel_openvino_TensorPool_delete(JNIEnv *, jobject, jlong addr)
+{
+    TensorPool *pool = (TensorPool *)addr;
+    delete pool;
+}
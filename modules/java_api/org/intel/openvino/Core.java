@@ -146,6 +146,23 @@ public class Core extends Wrapper {
         return new Model(ReadModel1(nativeObj, modelPath, weightPath));
     }
 
+    /**
+     * Reads a model from its IR XML content with weights supplied in a direct buffer.
+     *
+     * <p>Intended for weights mapped from the .bin file (for example via {@code
+     * FileChannel.map}): the native side wraps the buffer's memory without any Java-heap or JNI
+     * copy, so weights stream from the OS page cache. The buffer must remain alive and unchanged
+     * while the model and anything compiled from it are in use.
+     *
+     * @param model IR XML content of the model (not a path).
+     * @param weights Direct buffer holding the model weights; may be null for models without
+     *     weights.
+     * @return A model.
+     */
+    public Model read_model(final String model, final java.nio.ByteBuffer weights) {
+        return new Model(ReadModelFromBuffer(nativeObj, model, weights));
+    }
+
     /**
      * Creates a compiled model from a source model object.
      *
@@ -195,6 +212,9 @@ public class Core extends Wrapper {
     private static native long ReadModel1(
             long core, final String modelPath, final String weightPath);
 
+    private static native long ReadModelFromBuffer(
+            long core, final String model, final java.nio.ByteBuffer weights);
+
     private static native long CompileModel(long core, long net, final String device);
 
     private static native long GetProperty(long core, final String device, final String name);
@@ -0,0 +1,82 @@
+// Copyright (C) 2020-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+package org.intel.openvino;
+
+import java.util.concurrent.CompletableFuture;
+
+/**
+ * Pipeline of several infer requests over one compiled model.
+ *
+ * <p>submit hands the inference to a free request and returns a future; when every request is in
+ * flight it blocks until a completion frees one, so callers get device-saturating concurrency
+ * without managing {@link InferRequest} objects themselves.
+ */
+public class InferPipeline extends Wrapper {
+    /**
+     * Creates a pipeline owning the given number of infer requests.
+     *
+     * @param model Compiled model to create the requests from
+     * @param requests Number of requests to keep in flight; match it to the device's optimal
+     *     number of parallel requests
+     */
+    public InferPipeline(CompiledModel model, int requests) {
+        super(Create(model.nativeObj, requests));
+    }
+
+    /**
+     * Submits one inference: binds the tensors to a free request, starts it asynchronously and
+     * returns a future completed from the request's completion callback.
+     *
+     * <p>The bound tensors must not be reused for another submit until the returned future
+     * completes.
+     *
+     * @param inputs Input tensors, one per model input, in model input order.
+     * @param outputs Output tensors, one per model output, in model output order; may be null to
+     *     keep the request's own output tensors.
+     * @return Future completed when the inference finishes, exceptionally on failure.
+     */
+    public CompletableFuture<Void> submit(Tensor[] inputs, Tensor[] outputs) {
+        long[] inputAddrs = new long[inputs.length];
+        for (int i = 0; i < inputs.length; ++i) inputAddrs[i] = inputs[i].nativeObj;
+
+        long[] outputAddrs = null;
+        if (outputs != null) {
+            outputAddrs = new long[outputs.length];
+            for (int i = 0; i < outputs.length; ++i) outputAddrs[i] = outputs[i].nativeObj;
+        }
+
+        final CompletableFuture<Void> future = new CompletableFuture<>();
+        Submit(
+                nativeObj,
+                inputAddrs,
+                outputAddrs,
+                (Throwable error) -> {
+                    if (error == null) {
+                        future.complete(null);
+                    } else {
+                        future.completeExceptionally(error);
+                    }
+                });
+        return future;
+    }
+
+    /** Blocks until every submitted inference has completed. */
+    public void wait_all() {
+        WaitAll(nativeObj);
+    }
+
+    /*----------------------------------- native methods -----------------------------------*/
+    private static native long Create(long compiledModelAddr, int requests);
+
+    private static native void Submit(
+            long addr,
+            long[] inputAddrs,
+            long[] outputAddrs,
+            java.util.function.Consumer<Throwable> done);
+
+    private static native void WaitAll(long addr);
+
+    @Override
+    protected native void delete(long nativeObj);
+}
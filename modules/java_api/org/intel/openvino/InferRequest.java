@@ -21,6 +21,31 @@ public class InferRequest extends Wrapper {
         Infer(nativeObj);
     }
 
+    /**
+     * Runs a whole inference in a single native call: binds the given input and output tensors by
+     * index and infers synchronously.
+     *
+     * <p>Results are written into the bound output tensors, so with tensors backed by direct
+     * buffers a call does one JNI crossing and no data copies. Pre-register the tensors once and
+     * reuse them across calls.
+     *
+     * @param inputs Input tensors, one per model input, in model input order.
+     * @param outputs Output tensors, one per model output, in model output order; may be null to
+     *     keep the request's own output tensors.
+     */
+    public void infer(Tensor[] inputs, Tensor[] outputs) {
+        long[] inputAddrs = new long[inputs.length];
+        for (int i = 0; i < inputs.length; ++i) inputAddrs[i] = inputs[i].nativeObj;
+
+        long[] outputAddrs = null;
+        if (outputs != null) {
+            outputAddrs = new long[outputs.length];
+            for (int i = 0; i < outputs.length; ++i) outputAddrs[i] = outputs[i].nativeObj;
+        }
+
+        InferTensors(nativeObj, inputAddrs, outputAddrs);
+    }
+
     /**
      * Sets an input tensor to infer models with single input.
      *
@@ -56,6 +81,20 @@ public class InferRequest extends Wrapper {
         Wait(nativeObj);
     }
 
+    /**
+     * Sets a callback to run when the asynchronous inference started by {@link #start_async}
+     * completes.
+     *
+     * <p>The callback runs on a native completion thread, not on the thread that called {@link
+     * #start_async}; it must not block and must not call methods of this request other than
+     * reading results. Inference errors are reported from {@link #wait_async}.
+     *
+     * @param callback Callback to run on completion.
+     */
+    public void set_completion_callback(Runnable callback) {
+        SetCompletionCallback(nativeObj, callback);
+    }
+
     /**
      * Sets an output tensor to infer models with single output.
      *
@@ -91,10 +130,14 @@ public class InferRequest extends Wrapper {
     /*----------------------------------- native methods -----------------------------------*/
     private static native void Infer(long addr);
 
+    private static native void InferTensors(long addr, long[] inputAddrs, long[] outputAddrs);
+
     private static native void StartAsync(long addr);
 
     private static native void Wait(long addr);
 
+    private static native void SetCompletionCallback(long addr, Runnable callback);
+
     private static native void SetInputTensor(long addr, long tensorAddr);
 
     private static native void SetOutputTensor(long addr, long tensorAddr);
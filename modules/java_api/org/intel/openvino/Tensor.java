@@ -21,6 +21,19 @@ public class Tensor extends Wrapper {
         super(TensorFloat(dims, data));
     }
 
+    /**
+     * Constructs a Tensor wrapping the memory of a direct ByteBuffer without a copy.
+     *
+     * <p>The buffer must remain alive and must not be reallocated while the tensor is in use.
+     *
+     * @param type Element type of the tensor
+     * @param dims Tensor shape
+     * @param data Direct ByteBuffer holding the tensor data
+     */
+    public Tensor(ElementType type, int[] dims, java.nio.ByteBuffer data) {
+        super(TensorDirectBuffer(type.getValue(), dims, data));
+    }
+
     /**
      * Returns the total number of elements (a product of all the dims or 1 for scalar)
      *
@@ -40,11 +53,26 @@ public class Tensor extends Wrapper {
         return asFloat(nativeObj);
     }
 
+    /**
+     * Returns a read-only direct ByteBuffer view over the tensor data without a copy.
+     *
+     * <p>The view uses the native byte order and is only valid while the tensor is alive.
+     */
+    public java.nio.ByteBuffer as_byte_buffer() {
+        return asDirectBuffer(nativeObj)
+                .asReadOnlyBuffer()
+                .order(java.nio.ByteOrder.nativeOrder());
+    }
+
     /*----------------------------------- native methods -----------------------------------*/
     private static native long TensorCArray(int type, int[] shape, long cArray);
 
     private static native long TensorFloat(int[] shape, float[] data);
 
+    private static native long TensorDirectBuffer(int type, int[] shape, java.nio.ByteBuffer data);
+
+    private static native java.nio.ByteBuffer asDirectBuffer(long addr);
+
     private static native int[] GetShape(long addr);
 
     private static native float[] asFloat(long addr);
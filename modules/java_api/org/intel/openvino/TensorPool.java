@@ -0,0 +1,58 @@
+// Copyright (C) 2020-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+package org.intel.openvino;
+
+/**
+ * Pool of native tensors keyed by element type and shape.
+ *
+ * <p>Borrowed tensors that are released back to the pool keep their native memory alive for the
+ * next borrow of the same type and shape, so steady-state serving reuses buffers instead of
+ * allocating per inference and waiting for GC-triggered finalization to free them.
+ */
+public class TensorPool extends Wrapper {
+    public TensorPool() {
+        super(Create());
+    }
+
+    /**
+     * Borrows a tensor of the given element type and shape, reusing a previously released one
+     * when available.
+     *
+     * @param type Element type of the tensor
+     * @param dims Tensor shape
+     * @return A tensor backed by pooled native memory
+     */
+    public Tensor borrow(ElementType type, int[] dims) {
+        return new Tensor(Borrow(nativeObj, type.getValue(), dims));
+    }
+
+    /**
+     * Returns a tensor's native memory to the pool.
+     *
+     * <p>The caller must not use the tensor after releasing it; the next borrow of the same type
+     * and shape receives the same memory.
+     *
+     * @param tensor Tensor previously borrowed from this pool
+     */
+    public void release(Tensor tensor) {
+        Release(nativeObj, tensor.nativeObj);
+    }
+
+    /** Drops all pooled memory. */
+    public void clear() {
+        Clear(nativeObj);
+    }
+
+    /*----------------------------------- native methods -----------------------------------*/
+    private static native long Create();
+
+    private static native long Borrow(long addr, int type, int[] shape);
+
+    private static native void Release(long addr, long tensorAddr);
+
+    private static native void Clear(long addr);
+
+    @Override
+    protected native void delete(long nativeObj);
+}
@@ -157,6 +157,10 @@ public class IECore extends IEWrapper {
         return new Parameter(GetConfig(nativeObj, deviceName, name));
     }
 
+    public RemoteContext GetDefaultContext(String deviceName) {
+        return new RemoteContext(GetDefaultContext(nativeObj, deviceName));
+    }
+
     /*----------------------------------- native methods -----------------------------------*/
     private static native long ReadNetwork(long core, final String modelFileName);
 
@@ -184,6 +188,8 @@ public class IECore extends IEWrapper {
 
     private static native long GetConfig(long core, String deviceName, String name);
 
+    private static native long GetDefaultContext(long core, String deviceName);
+
     private static native long GetCore();
 
     private static native long GetCore1(String xmlConfigFile);
@@ -0,0 +1,43 @@
+// Copyright (C) 2020-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+package org.intel.openvino.compatibility;
+
+/**
+ * Remote context of an accelerator device, obtained via {@link
+ * IECore#GetDefaultContext(String)}. Lets the application wrap device memory
+ * produced by its own pipeline (e.g. a hardware video decoder) into a blob an
+ * inference request consumes without copying through the host.
+ */
+public class RemoteContext extends IEWrapper {
+
+    protected RemoteContext(long addr) {
+        super(addr);
+    }
+
+    /**
+     * Wraps an externally owned device memory handle (for the NVIDIA plugin, a
+     * CUdeviceptr) into a blob. The memory stays owned by the caller and must
+     * outlive the blob and any inference that reads it.
+     */
+    public Blob CreateRemoteBlob(TensorDesc tensorDesc, long deviceMemHandle) {
+        return new Blob(CreateRemoteBlob(nativeObj, tensorDesc.getNativeObjAddr(), deviceMemHandle));
+    }
+
+    /** Creates a blob that allocates and owns its device memory. */
+    public Blob CreateRemoteBlob(TensorDesc tensorDesc) {
+        return new Blob(CreateRemoteBlob(nativeObj, tensorDesc.getNativeObjAddr(), 0));
+    }
+
+    public String GetDeviceName() {
+        return GetDeviceName(nativeObj);
+    }
+
+    /*----------------------------------- native methods -----------------------------------*/
+    private static native long CreateRemoteBlob(long addr, long tensorDescAddr, long deviceMemHandle);
+
+    private static native String GetDeviceName(long addr);
+
+    @Override
+    protected native void delete(long nativeObj);
+}
@@ -31,6 +31,32 @@ namespace CUDAMetrics {
  * @brief Defines whether current Template device instance supports hardware blocks for fast convolution computations.
  */
 DECLARE_NVIDIA_METRIC_VALUE(HARDWARE_CONVOLUTION);
+
+/**
+ * @brief ExecutableNetwork metric returning production latency aggregates as
+ * std::map<std::string, float>: p50/p95/p99/max end-to-end latency in microseconds,
+ * average MemoryPool queue wait and stream occupancy over the recent inferences.
+ */
+DECLARE_NVIDIA_METRIC_VALUE(LATENCY_METRICS);
+
+/**
+ * @brief Plugin metric estimating the device memory footprint of a model without
+ * allocating anything on the GPU. The model is passed in the options map under
+ * ov::hint::model; the result is a std::map<std::string, uint64_t> with the
+ * constant blob size, the immutable workbuffers size, the mutable blob size one
+ * infer request needs and the largest per-operation workspace, so stream counts
+ * per GPU can be computed offline.
+ */
+DECLARE_NVIDIA_METRIC_VALUE(MEMORY_FOOTPRINT);
+
+/**
+ * @brief ExecutableNetwork metric returning the always-on event counters as
+ * std::map<std::string, uint64_t>: inferences started and completed, current thread
+ * pool queue depth, memory pool wait occurrences and cumulative per-stage times in
+ * microseconds. The counters are process-wide, updated with relaxed atomics on the
+ * hot paths and need no profiling mode.
+ */
+DECLARE_NVIDIA_METRIC_VALUE(EVENT_COUNTERS);
 // ! [public_header:metrics]
 
 }  // namespace CUDAMetrics
@@ -61,5 +87,108 @@ DECLARE_NVIDIA_CONFIG_KEY(THROUGHPUT_STREAMS);
  */
 DECLARE_NVIDIA_CONFIG_KEY(OPERATION_BENCHMARK);
 
+/**
+ * @brief Defines if the whole execution sequence should be captured into a CUDA graph at first inference
+ * and replayed with cudaGraphLaunch afterwards ("NVIDIA_YES", "NVIDIA_NO" - default).
+ */
+DECLARE_NVIDIA_CONFIG_KEY(USE_CUDA_GRAPH);
+
+/**
+ * @brief Defines if performance counters should report CUPTI-measured device execution
+ * time per operation instead of event-based timings that include launch overhead
+ * ("NVIDIA_YES", "NVIDIA_NO" - default). Takes effect only with PERF_COUNT enabled.
+ */
+DECLARE_NVIDIA_CONFIG_KEY(DEVICE_TIME_PROFILING);
+
+/**
+ * @brief Path of a chrome://tracing (Perfetto) JSON file the plugin streams execution
+ * spans into ("" - default, tracing disabled). Every operation and pipeline stage is
+ * recorded with its timestamp and submitting thread, so the timeline shows ordering,
+ * pipeline bubbles and the overlap of concurrent infer requests.
+ */
+DECLARE_NVIDIA_CONFIG_KEY(TRACE_EXPORT_PATH);
+
+/**
+ * @brief Defines if operations without a CUDA implementation may execute on the host
+ * through their ngraph reference evaluate() instead of failing LoadNetwork
+ * ("NVIDIA_YES" - default, "NVIDIA_NO"). Only the tensors crossing the host operation
+ * are transferred; everything between the device segments stays device-resident.
+ */
+DECLARE_NVIDIA_CONFIG_KEY(HOST_FALLBACK);
+
+/**
+ * @brief Comma-separated CUDA device indexes the compiled model is replicated across
+ * ("" - default, single device). Inference requests are spread evenly over the listed
+ * devices; every replica owns its device memory, streams and thread pool.
+ */
+DECLARE_NVIDIA_CONFIG_KEY(MULTI_DEVICES);
+
+/**
+ * @brief Defines how many concurrent single-sample requests may be coalesced into one
+ * batched execution (non negative integer, "0" - default, disables auto batching).
+ * Requires all network inputs and outputs to have a static batch dimension of 1.
+ */
+DECLARE_NVIDIA_CONFIG_KEY(AUTO_BATCH_SIZE);
+
+/**
+ * @brief Defines how long, in milliseconds, a request may wait for other requests to
+ * join its batch when auto batching is enabled ("1" - default).
+ */
+DECLARE_NVIDIA_CONFIG_KEY(AUTO_BATCH_TIMEOUT);
+
+/**
+ * @brief Defines the precision the graph is executed in ("NVIDIA_FP32" - default, "NVIDIA_FP16").
+ * With "NVIDIA_FP16" the model is converted to fp16 at load time so convolutions and GEMMs run
+ * on tensor cores; operations listed in NVIDIA_FP32_SENSITIVE_OPS are kept in fp32.
+ */
+DECLARE_NVIDIA_CONFIG_VALUE(FP32);
+DECLARE_NVIDIA_CONFIG_VALUE(FP16);
+DECLARE_NVIDIA_CONFIG_KEY(INFERENCE_PRECISION);
+
+/**
+ * @brief Comma-separated list of operation types which stay in fp32 when
+ * NVIDIA_INFERENCE_PRECISION is "NVIDIA_FP16".
+ */
+DECLARE_NVIDIA_CONFIG_KEY(FP32_SENSITIVE_OPS);
+
+/**
+ * @brief Defines the CUDA stream priority class of the compiled model ("NVIDIA_MEDIUM" - default,
+ * "NVIDIA_HIGH", "NVIDIA_LOW"). Kernels of a higher priority model preempt pending kernels of
+ * lower priority models sharing the GPU, keeping a latency-critical model responsive next to a
+ * bulk batch model.
+ */
+DECLARE_NVIDIA_CONFIG_VALUE(HIGH);
+DECLARE_NVIDIA_CONFIG_VALUE(MEDIUM);
+DECLARE_NVIDIA_CONFIG_VALUE(LOW);
+DECLARE_NVIDIA_CONFIG_KEY(STREAM_PRIORITY);
+
+/**
+ * @brief Defines if the compiled model is warmed up at the end of LoadNetwork by running
+ * one dummy inference per pooled memory block ("NVIDIA_YES", "NVIDIA_NO" - default).
+ * The warm-up triggers lazy cuDNN plan finalization, the first touch of every mutable
+ * memory blob and any PTX JIT compilation, so the first user request already runs at
+ * steady-state latency at the price of a longer LoadNetwork.
+ */
+DECLARE_NVIDIA_CONFIG_KEY(WARM_UP);
+
+/**
+ * @brief Caps the cuDNN workspace a single operation may claim, in bytes
+ * (non negative integer, "0" - default, no cap). Workspaces of all operations
+ * share one arena sized by their maximum, so benchmarked plan selection under
+ * a cap trades a little latency for a much smaller memory blob; among plans of
+ * near-equal time the one with the smallest workspace wins. Takes effect only
+ * with OPERATION_BENCHMARK enabled.
+ */
+DECLARE_NVIDIA_CONFIG_KEY(CUDNN_WORKSPACE_LIMIT);
+
+/**
+ * @brief Defines how many operations of the execution sequence run between two
+ * cancellation checkpoints ("1" - default, checks before every operation).
+ * "0" removes the per-operation checks entirely; cancellation is then noticed
+ * only at pipeline stage boundaries and inside iterating operations such as
+ * TensorIterator.
+ */
+DECLARE_NVIDIA_CONFIG_KEY(CANCELLATION_CHECK_INTERVAL);
+
 }  // namespace CUDAConfigParams
 }  // namespace InferenceEngine
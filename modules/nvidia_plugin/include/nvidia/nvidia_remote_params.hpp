@@ -0,0 +1,40 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief A header that defines parameters for creating remote context and remote
+ * blobs shared with the NVIDIA GPU plugin
+ *
+ * @file nvidia_remote_params.hpp
+ */
+
+#pragma once
+
+#include <string>
+
+namespace InferenceEngine {
+
+namespace CUDAContextParams {
+
+/**
+ * @def NVIDIA_PARAM_KEY(name)
+ * @brief Shortcut for defining NVIDIA GPU plugin remote context/blob parameter keys
+ */
+#define NVIDIA_PARAM_KEY(name) InferenceEngine::CUDAContextParams::PARAM_##name
+#define DECLARE_NVIDIA_PARAM_KEY(name) static constexpr auto PARAM_##name = #name
+
+/**
+ * @brief Index of the CUDA device the context belongs to (int).
+ */
+DECLARE_NVIDIA_PARAM_KEY(DEVICE_ID);
+
+/**
+ * @brief CUDA device pointer wrapped by a remote blob (void*). The memory stays
+ * owned by the application; without this parameter the blob allocates its own
+ * device memory.
+ */
+DECLARE_NVIDIA_PARAM_KEY(MEM_HANDLE);
+
+}  // namespace CUDAContextParams
+}  // namespace InferenceEngine
@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <cublasLt.h>
 #include <cublas_v2.h>
 #include <ie_extension.h>
 
@@ -53,7 +54,41 @@ namespace CUDA {
 class CuBlasHandle : public Handle<cublasHandle_t> {
 public:
     CuBlasHandle() : Handle((cublasCreate), cublasDestroy) {}
-    void setStream(Stream& stream) { throwIfError(cublasSetStream(get(), stream.get())); }
+    void setStream(const Stream& stream) { throwIfError(cublasSetStream(get(), stream.get())); }
+};
+
+class CuBlasLtHandle : public Handle<cublasLtHandle_t> {
+public:
+    CuBlasLtHandle() : Handle((cublasLtCreate), cublasLtDestroy) {}
+};
+
+class CuBlasLtMatmulDescriptor : public Handle<cublasLtMatmulDesc_t> {
+public:
+    CuBlasLtMatmulDescriptor(cublasComputeType_t computeType, cudaDataType_t scaleType)
+        : Handle((cublasLtMatmulDescCreate), cublasLtMatmulDescDestroy, computeType, scaleType) {}
+    auto& setAttribute(cublasLtMatmulDescAttributes_t attribute, const void* value, size_t size) const {
+        throwIfError(cublasLtMatmulDescSetAttribute(get(), attribute, value, size));
+        return *this;
+    }
+};
+
+class CuBlasLtMatrixLayout : public Handle<cublasLtMatrixLayout_t> {
+public:
+    CuBlasLtMatrixLayout(cudaDataType_t type, uint64_t rows, uint64_t cols, int64_t ld)
+        : Handle((cublasLtMatrixLayoutCreate), cublasLtMatrixLayoutDestroy, type, rows, cols, ld) {}
+    auto& setAttribute(cublasLtMatrixLayoutAttribute_t attribute, const void* value, size_t size) {
+        throwIfError(cublasLtMatrixLayoutSetAttribute(get(), attribute, value, size));
+        return *this;
+    }
+};
+
+class CuBlasLtMatmulPreference : public Handle<cublasLtMatmulPreference_t> {
+public:
+    CuBlasLtMatmulPreference() : Handle((cublasLtMatmulPreferenceCreate), cublasLtMatmulPreferenceDestroy) {}
+    auto& setAttribute(cublasLtMatmulPreferenceAttributes_t attribute, const void* value, size_t size) {
+        throwIfError(cublasLtMatmulPreferenceSetAttribute(get(), attribute, value, size));
+        return *this;
+    }
 };
 
 }  // namespace CUDA
@@ -5,10 +5,38 @@
 #include "descriptor_utils.hpp"
 
 #include <array>
+#include <map>
+#include <mutex>
 #include <ops/converters.hpp>
+#include <tuple>
 
 namespace CUDA {
 
+namespace {
+// Interned tensor descriptors: networks routinely contain many operations with
+// identical tensor geometry, and every cudnnCreateTensorDescriptor call costs host
+// time at LoadNetwork. The Handle's shared_ptr keeps a cached descriptor alive even
+// if the cache outlives its users; entries are tiny and never evicted.
+using DescriptorKey = std::tuple<int, std::vector<int>, std::vector<int>>;
+
+std::mutex descriptor_cache_mutex;
+std::map<DescriptorKey, DnnTensorDescriptor> descriptor_cache;
+}  // namespace
+
+DnnTensorDescriptor internDnnTensorDescr(cudnnDataType_t type,
+                                         const std::vector<int>& dims,
+                                         const std::vector<int>& strides) {
+    DescriptorKey key{static_cast<int>(type), dims, strides};
+    std::lock_guard<std::mutex> lock{descriptor_cache_mutex};
+    const auto found = descriptor_cache.find(key);
+    if (found != descriptor_cache.end()) {
+        return found->second;
+    }
+    auto descriptor = DnnTensorDescriptor{}.set(type, static_cast<int>(dims.size()), dims.data(), strides.data());
+    descriptor_cache.emplace(std::move(key), descriptor);
+    return descriptor;
+}
+
 DnnTensorDescriptor makeDnnTensorDescr(const ngraph::element::Type& type, const ngraph::Shape& shape) {
     Expects(!shape.empty());
     Expects(shape.size() <= CUDNN_DIM_MAX);
@@ -22,8 +50,7 @@ DnnTensorDescriptor makeDnnTensorDescr(const ngraph::element::Type& type, const
     decltype(dims) strides(dims.size(), 0);
     strides.back() = 1;
     for (int i = dims.size() - 1; i > 0; i--) strides[i - 1] = strides[i] * dims[i];
-    return DnnTensorDescriptor{}.set(
-        ov::nvidia_gpu::convertDataType<cudnnDataType_t>(type), dims.size(), dims.data(), strides.data());
+    return internDnnTensorDescr(ov::nvidia_gpu::convertDataType<cudnnDataType_t>(type), dims, strides);
 }
 
 CUDA::DnnTensorDescriptor makeInputDnnTensorDescr(const ov::Node& node, int n) {
@@ -4,6 +4,7 @@
 
 #include <cuda/dnn.hpp>
 #include <ngraph/node.hpp>
+#include <vector>
 
 namespace CUDA {
 
@@ -13,4 +14,13 @@ CUDA::DnnTensorDescriptor makeInputDnnTensorDescr(const ov::Node& node, int n);
 
 CUDA::DnnTensorDescriptor makeOutputDnnTensorDescr(const ov::Node& node, int n);
 
+/**
+ * Returns an interned immutable tensor descriptor for the given geometry; operations
+ * with identical (type, dims, strides) share one underlying cudnn descriptor instead
+ * of each creating its own. The returned descriptor must never be re-set().
+ */
+DnnTensorDescriptor internDnnTensorDescr(cudnnDataType_t type,
+                                         const std::vector<int>& dims,
+                                         const std::vector<int>& strides);
+
 }  // namespace CUDA
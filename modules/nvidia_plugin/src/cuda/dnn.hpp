@@ -253,6 +253,50 @@ public:
     }
 };
 
+class DnnReduceMaxDescriptor : public DnnReduceTensorDescriptor {
+public:
+    explicit DnnReduceMaxDescriptor(cudnnDataType_t compType) {
+        set(CUDNN_REDUCE_TENSOR_MAX,
+            compType,
+            CUDNN_PROPAGATE_NAN,
+            CUDNN_REDUCE_TENSOR_NO_INDICES,
+            CUDNN_32BIT_INDICES);
+    }
+};
+
+class DnnReduceMinDescriptor : public DnnReduceTensorDescriptor {
+public:
+    explicit DnnReduceMinDescriptor(cudnnDataType_t compType) {
+        set(CUDNN_REDUCE_TENSOR_MIN,
+            compType,
+            CUDNN_PROPAGATE_NAN,
+            CUDNN_REDUCE_TENSOR_NO_INDICES,
+            CUDNN_32BIT_INDICES);
+    }
+};
+
+class DnnReduceMulDescriptor : public DnnReduceTensorDescriptor {
+public:
+    explicit DnnReduceMulDescriptor(cudnnDataType_t compType) {
+        set(CUDNN_REDUCE_TENSOR_MUL,
+            compType,
+            CUDNN_PROPAGATE_NAN,
+            CUDNN_REDUCE_TENSOR_NO_INDICES,
+            CUDNN_32BIT_INDICES);
+    }
+};
+
+class DnnReduceNorm2Descriptor : public DnnReduceTensorDescriptor {
+public:
+    explicit DnnReduceNorm2Descriptor(cudnnDataType_t compType) {
+        set(CUDNN_REDUCE_TENSOR_NORM2,
+            compType,
+            CUDNN_PROPAGATE_NAN,
+            CUDNN_REDUCE_TENSOR_NO_INDICES,
+            CUDNN_32BIT_INDICES);
+    }
+};
+
 class DnnScaleFactor {
 public:
     constexpr const void* get() const noexcept { return scaling_factor_; }
@@ -51,11 +51,22 @@ inline std::vector<std::shared_ptr<DnnBEExecutionPlan>> getAllExecutionPlansFrom
     return std::move(plans);
 }
 
+/**
+ * Benchmarks the candidate execution plans and returns the fastest one.
+ *
+ * All operations of a compiled model share one workspace arena sized by their
+ * maximum request, so a non-zero @p workspace_limit caps the workspace any
+ * selected plan may claim; among surviving plans whose times are within a few
+ * percent of the best the one with the smallest workspace wins, keeping the
+ * shared arena small at a negligible latency cost. When every plan exceeds the
+ * cap the smallest-workspace plan is benchmarked anyway rather than failing.
+ */
 template <size_t NumBenchmarks>
 std::shared_ptr<CUDA::DnnBEExecutionPlan> performBenchmarks(
     const CUDA::DnnHandle& dnnHandle,
     const std::vector<std::shared_ptr<CUDA::DnnBEExecutionPlan>>& plans,
-    CUDA::DnnBEVariantPackBuilder& variantPackBuilder) {
+    CUDA::DnnBEVariantPackBuilder& variantPackBuilder,
+    const size_t workspace_limit = 0) {
     auto getDescendSortedWorkspaceSizes = [](const std::vector<std::shared_ptr<CUDA::DnnBEExecutionPlan>>& plans) {
         std::vector<size_t> workspace_sizes{};
         std::transform(plans.begin(), plans.end(), std::back_inserter(workspace_sizes), [](const auto& p) {
@@ -91,10 +102,24 @@ std::shared_ptr<CUDA::DnnBEExecutionPlan> performBenchmarks(
         return filtered_plans;
     };
 
-    const auto& workspace_sizes = getDescendSortedWorkspaceSizes(plans);
+    auto candidate_plans = plans;
+    if (workspace_limit != 0) {
+        auto limited_plans = filterPlansByWorkspaceSize(candidate_plans, workspace_limit);
+        if (limited_plans.empty()) {
+            // No plan fits the cap; keep the least hungry one instead of failing
+            const auto smallest =
+                std::min_element(candidate_plans.begin(), candidate_plans.end(), [](const auto& l, const auto& r) {
+                    return l->getWorkspaceSize() < r->getWorkspaceSize();
+                });
+            limited_plans = {*smallest};
+        }
+        candidate_plans = std::move(limited_plans);
+    }
+
+    const auto& workspace_sizes = getDescendSortedWorkspaceSizes(candidate_plans);
     auto max_workspace = tryAllocateMaxWorkspace(workspace_sizes);
     auto [workspace, max_workspace_size] = max_workspace.value();
-    auto filtered_plans = filterPlansByWorkspaceSize(plans, max_workspace_size);
+    auto filtered_plans = filterPlansByWorkspaceSize(candidate_plans, max_workspace_size);
 
     if (max_workspace) {
         variantPackBuilder.setWorkspase(workspace.get());
@@ -126,8 +151,21 @@ std::shared_ptr<CUDA::DnnBEExecutionPlan> performBenchmarks(
     }
     const auto min_time = std::min_element(time.begin(), time.end());
     const auto best_time_index = std::distance(time.begin(), min_time);
+    if (workspace_limit == 0) {
+        return filtered_plans[best_time_index];
+    }
 
-    return filtered_plans[best_time_index];
+    // Walk the latency/memory frontier: every plan within the tolerance of the
+    // best time is as good, so the one claiming the least workspace wins
+    constexpr float kTimeTolerance = 1.03f;
+    size_t best_index = best_time_index;
+    for (size_t i = 0; i < filtered_plans.size(); ++i) {
+        if (time[i] <= *min_time * kTimeTolerance &&
+            filtered_plans[i]->getWorkspaceSize() < filtered_plans[best_index]->getWorkspaceSize()) {
+            best_index = i;
+        }
+    }
+    return filtered_plans[best_index];
 }
 
 inline std::vector<size_t> generateStrides(gsl::span<const size_t> dim, cudnnTensorFormat_t filterFormat) {
@@ -0,0 +1,83 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "dnn_be_algo_cache.hpp"
+
+#include <cudnn.h>
+
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+
+#include "runtime.hpp"
+
+namespace CUDA {
+
+namespace {
+constexpr auto kCacheFileName = "cudnn_benchmarks.cache";
+}  // namespace
+
+DnnBenchmarkCache& DnnBenchmarkCache::instance() {
+    static DnnBenchmarkCache cache{};
+    return cache;
+}
+
+DnnBenchmarkCache::DnnBenchmarkCache() {
+    const char* cacheDir = std::getenv("OPENVINO_NVIDIA_BENCHMARK_CACHE_DIR");
+    if (cacheDir == nullptr || cacheDir[0] == '\0') {
+        return;
+    }
+    cache_file_ = std::string{cacheDir} + '/' + kCacheFileName;
+    load();
+}
+
+std::string DnnBenchmarkCache::makeKey(const std::string& opDescriptor) {
+    std::ostringstream key;
+    key << opDescriptor << '|' << Device{}.props().name << "|cudnn" << ::cudnnGetVersion();
+    return key.str();
+}
+
+void DnnBenchmarkCache::load() {
+    std::ifstream file{cache_file_};
+    if (!file.is_open()) {
+        return;
+    }
+    std::string line;
+    while (std::getline(file, line)) {
+        const auto separator = line.find('\t');
+        if (separator == std::string::npos) {
+            continue;
+        }
+        try {
+            entries_[line.substr(separator + 1)] = std::stoull(line.substr(0, separator));
+        } catch (...) {
+            continue;  // NOTE: Malformed entries are simply re-benchmarked
+        }
+    }
+}
+
+std::optional<std::size_t> DnnBenchmarkCache::find(const std::string& key) {
+    std::lock_guard<std::mutex> lock{mutex_};
+    const auto found = entries_.find(key);
+    if (found == entries_.end()) {
+        return std::nullopt;
+    }
+    return found->second;
+}
+
+void DnnBenchmarkCache::store(const std::string& key, std::size_t planIndex) {
+    std::lock_guard<std::mutex> lock{mutex_};
+    const auto inserted = entries_.emplace(key, planIndex);
+    if (!inserted.second) {
+        return;
+    }
+    std::ofstream file{cache_file_, std::ios::app};
+    if (!file.is_open()) {
+        ov::nvidia_gpu::logError("Failed to open cuDNN benchmark cache file " + cache_file_ + " for writing");
+        return;
+    }
+    file << planIndex << '\t' << key << '\n';
+}
+
+}  // namespace CUDA
@@ -0,0 +1,50 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+
+namespace CUDA {
+
+/**
+ * Persistent on-disk cache of winning cuDNN backend execution plans selected by
+ * performBenchmarks(). Entries are keyed by the operation descriptor string combined
+ * with the GPU model and the cuDNN version, so a cache populated on one machine is
+ * never reused on different hardware or after a cuDNN upgrade.
+ *
+ * The cache directory is taken from the OPENVINO_NVIDIA_BENCHMARK_CACHE_DIR
+ * environment variable; benchmark results are re-measured on every LoadNetwork
+ * when it is not set.
+ */
+class DnnBenchmarkCache {
+public:
+    static DnnBenchmarkCache& instance();
+
+    DnnBenchmarkCache(const DnnBenchmarkCache&) = delete;
+    DnnBenchmarkCache& operator=(const DnnBenchmarkCache&) = delete;
+
+    bool enabled() const noexcept { return !cache_file_.empty(); }
+
+    /**
+     * Extends an operation descriptor string with the GPU model and cuDNN version.
+     */
+    static std::string makeKey(const std::string& opDescriptor);
+
+    std::optional<std::size_t> find(const std::string& key);
+    void store(const std::string& key, std::size_t planIndex);
+
+private:
+    DnnBenchmarkCache();
+    void load();
+
+    std::string cache_file_;
+    std::mutex mutex_;
+    std::unordered_map<std::string, std::size_t> entries_;
+};
+
+}  // namespace CUDA
@@ -20,6 +20,14 @@ public:
         return std::move(*this);
     }
     void synchronize() { throwIfError(cudaEventSynchronize(get())); }
+    /**
+     * Makes all future work submitted to the stream wait until this event completes.
+     * The event may be destroyed right after the call, the dependency stays enqueued.
+     */
+    const Event& wait(const Stream& stream) const {
+        throwIfError(cudaStreamWaitEvent(stream.get(), get(), 0));
+        return *this;
+    }
     float elapsedSince(const Event& start) const { return createFirstArg(cudaEventElapsedTime, start.get(), get()); }
 };
 
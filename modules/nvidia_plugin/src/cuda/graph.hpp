@@ -0,0 +1,94 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "runtime.hpp"
+
+namespace CUDA {
+
+class GraphCapture;
+
+class Graph : public Handle<cudaGraph_t> {
+public:
+    friend class GraphCapture;
+
+private:
+    explicit Graph(const Stream& stream) : Handle{endCaptureAdapter, cudaGraphDestroy, stream.get()} {}
+
+    static cudaError_t endCaptureAdapter(cudaGraph_t* graph, cudaStream_t stream) {
+        return cudaStreamEndCapture(stream, graph);
+    }
+};
+
+class GraphExec : public Handle<cudaGraphExec_t> {
+public:
+    explicit GraphExec(const Graph& graph) : Handle{instantiateAdapter, cudaGraphExecDestroy, graph.get()} {}
+
+    void launch(const Stream& stream) const { throwIfError(cudaGraphLaunch(get(), stream.get())); }
+
+    /**
+     * Re-binds this executable graph to a topologically identical graph whose
+     * kernel parameters (typically buffer addresses) differ, without the cost of
+     * a new instantiation. Running launches are unaffected; the new parameters
+     * take effect from the next launch(). Returns false when the driver rejects
+     * the update (e.g. the topologies diverged), leaving the exec unchanged.
+     */
+    bool update(const Graph& graph) {
+        cudaGraphNode_t error_node{};
+        cudaGraphExecUpdateResult result{};
+        const auto err = cudaGraphExecUpdate(get(), graph.get(), &error_node, &result);
+        if (err == cudaSuccess) {
+            return true;
+        }
+        if (err == cudaErrorGraphExecUpdateFailure) {
+            ::cudaGetLastError();  // reset the sticky error state
+            return false;
+        }
+        throwIfError(err);
+        return false;
+    }
+
+private:
+    static cudaError_t instantiateAdapter(cudaGraphExec_t* exec, cudaGraph_t graph) {
+        return cudaGraphInstantiate(exec, graph, nullptr, nullptr, 0);
+    }
+};
+
+/**
+ * Scoped stream capture. Kernels launched on the stream between construction
+ * and endCapture() are recorded into a cudaGraph instead of being executed.
+ * If endCapture() is never reached (e.g. an operation has thrown), the
+ * destructor terminates the capture and discards the partially built graph,
+ * leaving the stream usable again.
+ */
+class GraphCapture {
+public:
+    explicit GraphCapture(const Stream& stream) : stream_{stream} {
+        throwIfError(cudaStreamBeginCapture(stream_.get(), cudaStreamCaptureModeThreadLocal));
+    }
+    GraphCapture(const GraphCapture&) = delete;
+    GraphCapture& operator=(const GraphCapture&) = delete;
+    ~GraphCapture() {
+        if (!ended_) {
+            cudaGraph_t graph{};
+            logIfError(cudaStreamEndCapture(stream_.get(), &graph));
+            if (graph) {
+                logIfError(cudaGraphDestroy(graph));
+            }
+        }
+    }
+
+    Graph endCapture() {
+        Graph graph{stream_};
+        ended_ = true;
+        return graph;
+    }
+
+private:
+    const Stream& stream_;
+    bool ended_ = false;
+};
+
+}  // namespace CUDA
@@ -0,0 +1,105 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cuda.h>
+#include <nvrtc.h>
+
+#include <fmt/format.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "runtime.hpp"
+
+inline void throwIfError(
+    nvrtcResult err,
+    const std::experimental::source_location& location = std::experimental::source_location::current()) {
+    if (err != NVRTC_SUCCESS) ov::nvidia_gpu::throwIEException(nvrtcGetErrorString(err), location);
+}
+
+inline void throwIfError(
+    CUresult err,
+    const std::experimental::source_location& location = std::experimental::source_location::current()) {
+    if (err != CUDA_SUCCESS) {
+        const char* str = nullptr;
+        cuGetErrorString(err, &str);
+        ov::nvidia_gpu::throwIEException(str ? str : "unknown CUDA driver error", location);
+    }
+}
+
+inline void logIfError(
+    CUresult err,
+    const std::experimental::source_location& location = std::experimental::source_location::current()) {
+    if (err != CUDA_SUCCESS) {
+        const char* str = nullptr;
+        cuGetErrorString(err, &str);
+        ov::nvidia_gpu::logError(str ? str : "unknown CUDA driver error", location);
+    }
+}
+
+namespace CUDA {
+
+/**
+ * @brief Compiles a CUDA C++ source with NVRTC and owns the resulting module.
+ *
+ * Compilation happens in the constructor (i.e. at network load time for
+ * operations created from CreationContext); launching the kernel afterwards is
+ * an ordinary asynchronous cuLaunchKernel and is capturable into CUDA graphs.
+ */
+class JitKernel {
+public:
+    /**
+     * @param source    CUDA C++ translation unit with an extern "C" __global__ entry
+     * @param entryName Name of the __global__ function to extract
+     * @param device    Device whose compute capability the kernel is compiled for
+     */
+    JitKernel(const std::string& source, const std::string& entryName, Device device) {
+        nvrtcProgram program{};
+        throwIfError(nvrtcCreateProgram(&program, source.c_str(), entryName.c_str(), 0, nullptr, nullptr));
+        const auto guard = std::unique_ptr<std::remove_pointer_t<nvrtcProgram>, void (*)(nvrtcProgram)>{
+            program, [](nvrtcProgram p) { nvrtcDestroyProgram(&p); }};
+        const auto& props = device.props();
+        const auto arch = fmt::format("--gpu-architecture=compute_{}{}", props.major, props.minor);
+        const char* options[] = {arch.c_str(), "--std=c++14"};
+        const auto compileResult = nvrtcCompileProgram(program, 2, options);
+        if (compileResult != NVRTC_SUCCESS) {
+            std::size_t logSize = 0;
+            nvrtcGetProgramLogSize(program, &logSize);
+            std::string log(logSize, '\0');
+            nvrtcGetProgramLog(program, log.data());
+            ov::nvidia_gpu::throwIEException(
+                fmt::format("NVRTC compilation of '{}' failed: {}\n{}", entryName, nvrtcGetErrorString(compileResult), log));
+        }
+        std::size_t ptxSize = 0;
+        throwIfError(nvrtcGetPTXSize(program, &ptxSize));
+        std::string ptx(ptxSize, '\0');
+        throwIfError(nvrtcGetPTX(program, ptx.data()));
+
+        // Make sure the runtime primary context exists and is current before
+        // touching the driver API
+        throwIfError(cudaFree(nullptr));
+        CUmodule module{};
+        throwIfError(cuModuleLoadData(&module, ptx.data()));
+        module_ = std::shared_ptr<std::remove_pointer_t<CUmodule>>{module,
+                                                                  [](CUmodule m) { logIfError(cuModuleUnload(m)); }};
+        throwIfError(cuModuleGetFunction(&function_, module, entryName.c_str()));
+    }
+
+    /**
+     * Enqueues the kernel on the given stream; @args follows cuLaunchKernel
+     * conventions (array of pointers to the actual arguments)
+     */
+    void launch(const Stream& stream, unsigned gridDim, unsigned blockDim, void** args) const {
+        throwIfError(cuLaunchKernel(function_, gridDim, 1, 1, blockDim, 1, 1, 0, stream.get(), args, nullptr));
+    }
+
+private:
+    std::shared_ptr<std::remove_pointer_t<CUmodule>> module_;
+    CUfunction function_{};
+};
+
+}  // namespace CUDA
@@ -231,6 +231,13 @@ public:
 class Stream : public Handle<cudaStream_t> {
 public:
     Stream() : Handle((cudaStreamCreate), cudaStreamDestroy) {}
+    /** Creates a stream with the given scheduling priority; lower values run first,
+     * out-of-range values are clamped by the driver */
+    explicit Stream(int priority)
+        : Handle((cudaStreamCreateWithPriority),
+                 cudaStreamDestroy,
+                 static_cast<unsigned int>(cudaStreamDefault),
+                 priority) {}
 
     Allocation malloc(std::size_t size) const { return {mallocImpl(size), *this}; }
     void upload(CUDA::DevicePointer<void*> dst, const void* src, std::size_t count) const {
@@ -239,6 +246,15 @@ public:
     void transfer(CUDA::DevicePointer<void*> dst, CUDA::DevicePointer<const void*> src, std::size_t count) const {
         throwIfError(cudaMemcpyAsync(dst.get(), src.get(), count, cudaMemcpyDeviceToDevice, get()));
     }
+    void transfer2D(CUDA::DevicePointer<void*> dst,
+                    std::size_t dpitch,
+                    CUDA::DevicePointer<const void*> src,
+                    std::size_t spitch,
+                    std::size_t width,
+                    std::size_t height) const {
+        throwIfError(
+            cudaMemcpy2DAsync(dst.get(), dpitch, src.get(), spitch, width, height, cudaMemcpyDeviceToDevice, get()));
+    }
     void upload(const Allocation& dst, const void* src, std::size_t count) const { uploadImpl(dst.get(), src, count); }
     void download(void* dst, const Allocation& src, std::size_t count) const { downloadImpl(dst, src.get(), count); }
     void download(void* dst, CUDA::DevicePointer<const void*> src, std::size_t count) const {
@@ -252,6 +268,11 @@ public:
         memsetImpl(dst.get(), value, count);
     }
     void synchronize() const { throwIfError(cudaStreamSynchronize(get())); }
+    bool isCapturing() const {
+        cudaStreamCaptureStatus status{};
+        throwIfError(cudaStreamIsCapturing(get(), &status));
+        return status != cudaStreamCaptureStatusNone;
+    }
 #ifdef __CUDACC__
     template <typename... Args>
     void run(dim3 gridDim, dim3 blockDim, void (*kernel)(Args...), Args... args) const {
@@ -109,6 +109,21 @@ public:
         data_[size_++] = t;
     }
 
+    /**
+     * Sets size of Vector to @param newSize without constructing elements
+     * @note The first @param newSize items must have been written through
+     * data() beforehand, e.g. by threads compacting into the Vector in parallel
+     * @param newSize new size of Vector
+     */
+    __device__ void set_size(size_t newSize) {
+#ifndef NDEBUG
+        if (newSize > capacity_) {
+            __trap();
+        }
+#endif
+        size_ = newSize;
+    }
+
     /**
      * Resize Vector with new size @param newSize
      * @param newSize new size of Vector
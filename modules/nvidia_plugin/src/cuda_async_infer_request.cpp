@@ -13,11 +13,36 @@
 namespace ov {
 namespace nvidia_gpu {
 
+namespace {
+
+/**
+ * Per-request view of the shared CudaThreadPool that submits every task with
+ * the owning request's current priority. The pipeline machinery of the base
+ * class only knows ITaskExecutor::run(Task), so the priority travels through
+ * the executor instance instead of the call
+ */
+class PrioritizedWaitExecutor : public InferenceEngine::ITaskExecutor {
+public:
+    PrioritizedWaitExecutor(std::shared_ptr<CudaThreadPool> threadPool, CudaInferRequest::Ptr inferRequest)
+        : thread_pool_{std::move(threadPool)}, infer_request_{std::move(inferRequest)} {}
+
+    void run(InferenceEngine::Task task) override { thread_pool_->run(std::move(task), infer_request_->GetPriority()); }
+
+private:
+    std::shared_ptr<CudaThreadPool> thread_pool_;
+    CudaInferRequest::Ptr infer_request_;
+};
+
+}  // namespace
+
 CudaAsyncInferRequest::CudaAsyncInferRequest(const CudaInferRequest::Ptr& inferRequest,
                                              const InferenceEngine::ITaskExecutor::Ptr& cpuTaskExecutor,
                                              const InferenceEngine::ITaskExecutor::Ptr& waitExecutor,
-                                             const InferenceEngine::ITaskExecutor::Ptr& callbackExecutor)
-    : AsyncInferRequestThreadSafeDefault(inferRequest, cpuTaskExecutor, callbackExecutor), _inferRequest(inferRequest) {
+                                             const InferenceEngine::ITaskExecutor::Ptr& callbackExecutor,
+                                             const RequestBatcher::Ptr& batcher)
+    : AsyncInferRequestThreadSafeDefault(inferRequest, cpuTaskExecutor, callbackExecutor),
+      _inferRequest(inferRequest),
+      _batcher(batcher) {
     // In current implementation we have CPU only tasks and no needs in 2 executors
     // So, by default single stage pipeline is created.
     // This stage executes InferRequest::Infer() using cpuTaskExecutor.
@@ -26,25 +51,41 @@ CudaAsyncInferRequest::CudaAsyncInferRequest(const CudaInferRequest::Ptr& inferR
     constexpr const auto remoteDevice = true;
 
     auto cudaThreadPool = std::dynamic_pointer_cast<CudaThreadPool>(waitExecutor);
+    // Submissions to the shared pool carry this request's priority; requests
+    // that never call SetPriority() keep the FIFO fast path
+    const auto prioritizedWaitExecutor =
+        cudaThreadPool ? std::make_shared<PrioritizedWaitExecutor>(cudaThreadPool, inferRequest) : nullptr;
     if (remoteDevice) {
         _pipeline = {{cpuTaskExecutor,
                       [this] {
                           OV_ITT_SCOPED_TASK(itt::domains::nvidia_gpu, "CudaAsyncInferRequest::Preprocessing");
-                          _inferRequest->inferPreprocess();
+                          // A request the batcher accepts is executed entirely as part of a
+                          // shared batch; otherwise it goes through its own pipeline
+                          _batched = _batcher && _batcher->TryInfer(*_inferRequest);
+                          if (!_batched) {
+                              _inferRequest->inferPreprocess();
+                          }
                       }},
-                     {waitExecutor,
+                     {prioritizedWaitExecutor ? std::static_pointer_cast<InferenceEngine::ITaskExecutor>(
+                                                    prioritizedWaitExecutor)
+                                              : waitExecutor,
                       [this, cudaThreadPool] {
-                          auto& threadContext = cudaThreadPool->GetThreadContext();
-                          {
-                              OV_ITT_SCOPED_TASK(itt::domains::nvidia_gpu, "CudaAsyncInferRequest::StartPipeline");
-                              _inferRequest->startPipeline(threadContext);
+                          if (_batched) {
+                              return;
+                          }
+                          OV_ITT_SCOPED_TASK(itt::domains::nvidia_gpu, "CudaAsyncInferRequest::StartPipeline");
+                          // The pool thread only enqueues the work and is released right away;
+                          // completion is signalled through host callbacks recorded on the streams
+                          _inferRequest->startPipeline(cudaThreadPool->GetThreadContext());
+                      }},
+                     {cpuTaskExecutor, [this] {
+                          if (_batched) {
+                              return;
                           }
                           {
                               OV_ITT_SCOPED_TASK(itt::domains::nvidia_gpu, "CudaAsyncInferRequest::WaitPipeline");
-                              _inferRequest->waitPipeline(threadContext);
+                              _inferRequest->waitPipeline();
                           }
-                      }},
-                     {cpuTaskExecutor, [this] {
                           OV_ITT_SCOPED_TASK(itt::domains::nvidia_gpu, "CudaAsyncInferRequest::Postprocessing");
                           _inferRequest->inferPostprocess();
                       }}};
@@ -7,6 +7,7 @@
 #include <cpp_interfaces/impl/ie_infer_async_request_thread_safe_default.hpp>
 
 #include "cuda_infer_request.hpp"
+#include "cuda_request_batcher.hpp"
 
 namespace ov {
 namespace nvidia_gpu {
@@ -16,7 +17,8 @@ public:
     CudaAsyncInferRequest(const CudaInferRequest::Ptr& inferRequest,
                           const InferenceEngine::ITaskExecutor::Ptr& taskExecutor,
                           const InferenceEngine::ITaskExecutor::Ptr& waitExecutor,
-                          const InferenceEngine::ITaskExecutor::Ptr& callbackExecutor);
+                          const InferenceEngine::ITaskExecutor::Ptr& callbackExecutor,
+                          const RequestBatcher::Ptr& batcher = nullptr);
 
     /**
      * Cancel AsyncInferRequest
@@ -26,9 +28,23 @@ public:
      * Overrides default behaviour and run request asynchronous
      */
     void Infer_ThreadUnsafe() override;
+    /**
+     * Assigns the scheduling class of this request. Higher levels are served
+     * before queued default work both on the CudaThreadPool worker threads and
+     * in the MemoryPool waiter queue; equal levels are ordered by the deadline
+     * hint (earliest first) and negative levels yield to default traffic, so
+     * interactive and batch requests can share one ExecutableNetwork instead
+     * of running duplicate networks to isolate traffic classes. Takes effect
+     * from the next StartAsync()
+     */
+    void SetPriority(const RequestPriority& priority) { _inferRequest->SetPriority(priority); }
 
 private:
     CudaInferRequest::Ptr _inferRequest;
+    RequestBatcher::Ptr _batcher;
+    // Set at the first pipeline stage when the batcher ran the request; the
+    // remaining stages then have nothing left to do
+    bool _batched = false;
 };
 
 }  // namespace nvidia_gpu
@@ -14,6 +14,46 @@ using namespace ov::nvidia_gpu;
 
 Configuration::Configuration() {}
 
+std::unordered_set<std::string> Configuration::fp32SensitiveOps() const {
+    std::unordered_set<std::string> ops;
+    std::string::size_type begin = 0;
+    while (begin <= fp32_sensitive_ops.size()) {
+        auto end = fp32_sensitive_ops.find(',', begin);
+        if (end == std::string::npos) end = fp32_sensitive_ops.size();
+        if (end > begin) {
+            ops.emplace(fp32_sensitive_ops.substr(begin, end - begin));
+        }
+        begin = end + 1;
+    }
+    return ops;
+}
+
+std::vector<int> Configuration::multiDevices() const {
+    std::vector<int> devices;
+    std::string::size_type begin = 0;
+    while (begin <= multi_devices.size()) {
+        auto end = multi_devices.find(',', begin);
+        if (end == std::string::npos) end = multi_devices.size();
+        if (end > begin) {
+            const auto token = multi_devices.substr(begin, end - begin);
+            try {
+                devices.push_back(std::stoi(token));
+            } catch (...) {
+                throwIEException(
+                    fmt::format("NVIDIA_CONFIG_KEY(MULTI_DEVICES) entry {} is not a device index", token));
+            }
+        }
+        begin = end + 1;
+    }
+    return devices;
+}
+
+int Configuration::streamPriorityClass() const {
+    if (stream_priority == NVIDIA_CONFIG_VALUE(HIGH)) return -1;
+    if (stream_priority == NVIDIA_CONFIG_VALUE(LOW)) return 1;
+    return 0;
+}
+
 Configuration::Configuration(const ConfigMap& config, const Configuration& defaultCfg, bool throwOnUnsupported) {
     *this = defaultCfg;
     // If plugin needs to use InferenceEngine::StreamsExecutor it should be able to process its configuration
@@ -70,6 +110,102 @@ Configuration::Configuration(const ConfigMap& config, const Configuration& defau
             } else {
                 throwIEException(fmt::format("operation benchmark option value {} is not supported", value));
             }
+        } else if (NVIDIA_CONFIG_KEY(USE_CUDA_GRAPH) == key) {
+            if (value == NVIDIA_CONFIG_VALUE(YES)) {
+                use_cuda_graph = true;
+            } else if (value == NVIDIA_CONFIG_VALUE(NO)) {
+                use_cuda_graph = false;
+            } else {
+                throwIEException(fmt::format("use cuda graph option value {} is not supported", value));
+            }
+        } else if (NVIDIA_CONFIG_KEY(DEVICE_TIME_PROFILING) == key) {
+            if (value == NVIDIA_CONFIG_VALUE(YES)) {
+                device_time_profiling = true;
+            } else if (value == NVIDIA_CONFIG_VALUE(NO)) {
+                device_time_profiling = false;
+            } else {
+                throwIEException(fmt::format("device time profiling option value {} is not supported", value));
+            }
+        } else if (NVIDIA_CONFIG_KEY(TRACE_EXPORT_PATH) == key) {
+            trace_export_path = value;
+        } else if (NVIDIA_CONFIG_KEY(HOST_FALLBACK) == key) {
+            if (value == NVIDIA_CONFIG_VALUE(YES)) {
+                host_fallback = true;
+            } else if (value == NVIDIA_CONFIG_VALUE(NO)) {
+                host_fallback = false;
+            } else {
+                throwIEException(fmt::format("host fallback option value {} is not supported", value));
+            }
+        } else if (NVIDIA_CONFIG_KEY(MULTI_DEVICES) == key) {
+            multi_devices = value;
+            multiDevices();  // validates that every entry is a number
+        } else if (NVIDIA_CONFIG_KEY(AUTO_BATCH_SIZE) == key) {
+            try {
+                auto_batch_size = std::stoi(value);
+            } catch (...) {
+                throwIEException(fmt::format("auto batch size option value {} is not a number", value));
+            }
+            if (auto_batch_size < 0) {
+                throwIEException(fmt::format("auto batch size option value {} is negative", value));
+            }
+        } else if (NVIDIA_CONFIG_KEY(AUTO_BATCH_TIMEOUT) == key) {
+            try {
+                auto_batch_timeout_ms = std::stoi(value);
+            } catch (...) {
+                throwIEException(fmt::format("auto batch timeout option value {} is not a number", value));
+            }
+            if (auto_batch_timeout_ms < 0) {
+                throwIEException(fmt::format("auto batch timeout option value {} is negative", value));
+            }
+        } else if (NVIDIA_CONFIG_KEY(INFERENCE_PRECISION) == key) {
+            if (value == NVIDIA_CONFIG_VALUE(FP32) || value == NVIDIA_CONFIG_VALUE(FP16)) {
+                inference_precision = value;
+            } else {
+                throwIEException(fmt::format("inference precision option value {} is not supported", value));
+            }
+        } else if (NVIDIA_CONFIG_KEY(FP32_SENSITIVE_OPS) == key) {
+            fp32_sensitive_ops = value;
+        } else if (NVIDIA_CONFIG_KEY(WARM_UP) == key) {
+            if (value == NVIDIA_CONFIG_VALUE(YES)) {
+                warm_up = true;
+            } else if (value == NVIDIA_CONFIG_VALUE(NO)) {
+                warm_up = false;
+            } else {
+                throwIEException(fmt::format("warm up option value {} is not supported", value));
+            }
+        } else if (NVIDIA_CONFIG_KEY(CANCELLATION_CHECK_INTERVAL) == key) {
+            try {
+                cancellation_check_interval = std::stoi(value);
+            } catch (...) {
+                throwIEException(fmt::format("cancellation check interval option value {} is not a number", value));
+            }
+            if (cancellation_check_interval < 0) {
+                throwIEException(fmt::format("cancellation check interval option value {} is negative", value));
+            }
+        } else if (NVIDIA_CONFIG_KEY(CUDNN_WORKSPACE_LIMIT) == key) {
+            try {
+                cudnn_workspace_limit = std::stoll(value);
+            } catch (...) {
+                throwIEException(fmt::format("cudnn workspace limit option value {} is not a number", value));
+            }
+            if (cudnn_workspace_limit < 0) {
+                throwIEException(fmt::format("cudnn workspace limit option value {} is negative", value));
+            }
+        } else if (NVIDIA_CONFIG_KEY(STREAM_PRIORITY) == key) {
+            if (value == NVIDIA_CONFIG_VALUE(HIGH) || value == NVIDIA_CONFIG_VALUE(MEDIUM) ||
+                value == NVIDIA_CONFIG_VALUE(LOW)) {
+                stream_priority = value;
+            } else {
+                throwIEException(fmt::format("stream priority option value {} is not supported", value));
+            }
+        } else if (CONFIG_KEY(DYN_BATCH_ENABLED) == key) {
+            if (value == CONFIG_VALUE(YES)) {
+                dyn_batch_enabled = true;
+            } else if (value == CONFIG_VALUE(NO)) {
+                dyn_batch_enabled = false;
+            } else {
+                throwIEException(fmt::format("dynamic batch option value {} is not supported", value));
+            }
         } else if (CONFIG_KEY(PERF_COUNT) == key) {
             perfCount = (CONFIG_VALUE(YES) == value);
         } else if (ov::hint::performance_mode == key) {
@@ -90,8 +226,36 @@ InferenceEngine::Parameter Configuration::Get(const std::string& name) const {
         return {std::to_string(deviceId)};
     } else if (name == CONFIG_KEY(PERF_COUNT)) {
         return {perfCount};
+    } else if (name == CONFIG_KEY(DYN_BATCH_ENABLED)) {
+        return {std::string(dyn_batch_enabled ? CONFIG_VALUE(YES) : CONFIG_VALUE(NO))};
     } else if (name == NVIDIA_CONFIG_KEY(OPERATION_BENCHMARK)) {
         return {std::string(operation_benchmark ? NVIDIA_CONFIG_VALUE(YES) : NVIDIA_CONFIG_VALUE(NO))};
+    } else if (name == NVIDIA_CONFIG_KEY(USE_CUDA_GRAPH)) {
+        return {std::string(use_cuda_graph ? NVIDIA_CONFIG_VALUE(YES) : NVIDIA_CONFIG_VALUE(NO))};
+    } else if (name == NVIDIA_CONFIG_KEY(DEVICE_TIME_PROFILING)) {
+        return {std::string(device_time_profiling ? NVIDIA_CONFIG_VALUE(YES) : NVIDIA_CONFIG_VALUE(NO))};
+    } else if (name == NVIDIA_CONFIG_KEY(TRACE_EXPORT_PATH)) {
+        return {trace_export_path};
+    } else if (name == NVIDIA_CONFIG_KEY(HOST_FALLBACK)) {
+        return {std::string(host_fallback ? NVIDIA_CONFIG_VALUE(YES) : NVIDIA_CONFIG_VALUE(NO))};
+    } else if (name == NVIDIA_CONFIG_KEY(MULTI_DEVICES)) {
+        return {multi_devices};
+    } else if (name == NVIDIA_CONFIG_KEY(AUTO_BATCH_SIZE)) {
+        return {std::to_string(auto_batch_size)};
+    } else if (name == NVIDIA_CONFIG_KEY(AUTO_BATCH_TIMEOUT)) {
+        return {std::to_string(auto_batch_timeout_ms)};
+    } else if (name == NVIDIA_CONFIG_KEY(INFERENCE_PRECISION)) {
+        return {inference_precision};
+    } else if (name == NVIDIA_CONFIG_KEY(FP32_SENSITIVE_OPS)) {
+        return {fp32_sensitive_ops};
+    } else if (name == NVIDIA_CONFIG_KEY(WARM_UP)) {
+        return {std::string(warm_up ? NVIDIA_CONFIG_VALUE(YES) : NVIDIA_CONFIG_VALUE(NO))};
+    } else if (name == NVIDIA_CONFIG_KEY(CANCELLATION_CHECK_INTERVAL)) {
+        return {std::to_string(cancellation_check_interval)};
+    } else if (name == NVIDIA_CONFIG_KEY(CUDNN_WORKSPACE_LIMIT)) {
+        return {std::to_string(cudnn_workspace_limit)};
+    } else if (name == NVIDIA_CONFIG_KEY(STREAM_PRIORITY)) {
+        return {stream_priority};
     } else if (name == NVIDIA_CONFIG_KEY(THROUGHPUT_STREAMS)) {
         return {cuda_throughput_streams_};
     } else if (name == CONFIG_KEY(CPU_THROUGHPUT_STREAMS)) {
@@ -11,6 +11,8 @@
 #include <openvino/runtime/properties.hpp>
 #include <string>
 #include <threading/ie_istreams_executor.hpp>
+#include <unordered_set>
+#include <vector>
 
 namespace ov {
 namespace nvidia_gpu {
@@ -32,11 +34,57 @@ struct Configuration {
 
     InferenceEngine::Parameter Get(const std::string& name) const;
 
+    /**
+     * Returns the fp32-sensitive operation type names as a set; parsed from the
+     * comma-separated NVIDIA_FP32_SENSITIVE_OPS value
+     */
+    std::unordered_set<std::string> fp32SensitiveOps() const;
+
+    /**
+     * Returns the device indexes parsed from the comma-separated NVIDIA_MULTI_DEVICES
+     * value; empty when the model runs on a single device
+     */
+    std::vector<int> multiDevices() const;
+
+    /**
+     * Returns the NVIDIA_STREAM_PRIORITY value as a numeric class: -1 for HIGH,
+     * 0 for MEDIUM, 1 for LOW; ThreadContext maps it onto the device priority range
+     */
+    int streamPriorityClass() const;
+
     // Plugin configuration parameters
 
     int deviceId = 0;
     bool perfCount = true;
     bool operation_benchmark = false;
+    bool use_cuda_graph = false;
+    bool device_time_profiling = false;
+    // Chrome tracing (Perfetto) JSON file execution spans are streamed into;
+    // empty disables the trace export
+    std::string trace_export_path = "";
+    // Lets operations without a CUDA implementation run through their ngraph
+    // reference evaluate() on the host instead of failing LoadNetwork
+    bool host_fallback = true;
+    int auto_batch_size = 0;
+    int auto_batch_timeout_ms = 1;
+    // Enables InferRequest::SetBatch(): the network is compiled once for its full
+    // (maximum) batch and requests may process a smaller leading batch
+    bool dyn_batch_enabled = false;
+    std::string multi_devices = "";
+    std::string inference_precision = NVIDIA_CONFIG_VALUE(FP32);
+    // CUDA stream priority class of the compiled model; HIGH lets its kernels preempt
+    // lower-priority models co-located on the same GPU
+    std::string stream_priority = NVIDIA_CONFIG_VALUE(MEDIUM);
+    std::string fp32_sensitive_ops = "MVN,NormalizeL2,ReduceMean,ReduceSum,Softmax,Exp,Log,Pow";
+    // Runs one dummy inference per pooled memory block at the end of LoadNetwork
+    // so the first user request hits steady-state latency
+    bool warm_up = false;
+    // Operations of the execution sequence between two cancellation checkpoints;
+    // 0 leaves cancellation to the pipeline stage boundaries
+    int cancellation_check_interval = 1;
+    // Cap in bytes on the cuDNN workspace any single operation may claim during
+    // benchmarked plan selection; 0 leaves the workspace unlimited
+    long long cudnn_workspace_limit = 0;
     std::string cuda_throughput_streams_ = std::to_string(1);
     InferenceEngine::IStreamsExecutor::Config streams_executor_config_;
     // TODO: Should be added usage of this property (What to do with NVIDIA_CONFIG_KEY(THROUGHPUT_STREAMS) ?)
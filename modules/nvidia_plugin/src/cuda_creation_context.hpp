@@ -17,13 +17,37 @@ class CreationContext {
     CUDA::Device device_;
     CUDA::DnnHandle dnn_handle_;
     bool op_bench_option_;
+    bool use_cuda_graph_option_;
+    unsigned cancellation_check_interval_;
+    std::size_t dnn_workspace_limit_;
+    bool host_fallback_option_;
 
 public:
-    explicit CreationContext(CUDA::Device d, bool opBenchOption)
-        : device_{d.setCurrent()}, op_bench_option_{opBenchOption} {}
+    explicit CreationContext(CUDA::Device d,
+                             bool opBenchOption,
+                             bool useCudaGraphOption = false,
+                             unsigned cancellationCheckInterval = 1,
+                             std::size_t dnnWorkspaceLimit = 0,
+                             bool hostFallbackOption = false)
+        : device_{d.setCurrent()},
+          op_bench_option_{opBenchOption},
+          use_cuda_graph_option_{useCudaGraphOption},
+          cancellation_check_interval_{cancellationCheckInterval},
+          dnn_workspace_limit_{dnnWorkspaceLimit},
+          host_fallback_option_{hostFallbackOption} {}
     CUDA::Device device() const { return device_; }
     const CUDA::DnnHandle& dnnHandle() const { return dnn_handle_; }
     bool opBenchOption() const noexcept { return op_bench_option_; }
+    bool useCudaGraphOption() const noexcept { return use_cuda_graph_option_; }
+    /** Operations between cancellation checkpoints in the execution loops;
+     * 0 leaves cancellation to the pipeline stage boundaries */
+    unsigned cancellationCheckInterval() const noexcept { return cancellation_check_interval_; }
+    /** Cap in bytes on the cuDNN workspace one operation may claim during
+     * benchmarked plan selection; 0 leaves the workspace unlimited */
+    std::size_t dnnWorkspaceLimit() const noexcept { return dnn_workspace_limit_; }
+    /** Operations without a CUDA implementation may run through their ngraph
+     * reference evaluate() on the host instead of failing LoadNetwork */
+    bool hostFallbackOption() const noexcept { return host_fallback_option_; }
 };
 
 }  // namespace nvidia_gpu
@@ -15,6 +15,7 @@
 #include <ops/subgraph.hpp>
 #include <threading/ie_executor_manager.hpp>
 #include <utility>
+#include <utils/event_counters.hpp>
 
 #include "cuda_executable_network.hpp"
 #include "cuda_itt.hpp"
@@ -38,7 +39,8 @@ using Time = std::chrono::steady_clock;
 ExecutableNetwork::ExecutableNetwork(const InferenceEngine::CNNNetwork& cnnNetwork,
                                      Configuration cfg,
                                      InferenceEngine::ITaskExecutor::Ptr waitExecutor,
-                                     Plugin::Ptr plugin)
+                                     Plugin::Ptr plugin,
+                                     DeviceMemBlock::Ptr constants_donor)
     : InferenceEngine::ExecutableNetworkThreadSafeDefault(nullptr, nullptr),  // Disable default threads creation
       cfg_(std::move(cfg)),
       cuda_stream_executor_(std::move(waitExecutor)),
@@ -49,10 +51,18 @@ ExecutableNetwork::ExecutableNetwork(const InferenceEngine::CNNNetwork& cnnNetwo
     setNetworkInputs(cnnNetwork.getInputsInfo());
     setNetworkOutputs(cnnNetwork.getOutputsInfo());
     SetPointerToPlugin(plugin_->shared_from_this());
+    original_function_ = ngraph::clone_function(*cnnNetwork.getFunction());
     try {
-        CompileNetwork(cnnNetwork.getFunction(), cnnNetwork.getInputsInfo(), cnnNetwork.getOutputsInfo());
+        CompileNetwork(cnnNetwork.getFunction(),
+                       cnnNetwork.getInputsInfo(),
+                       cnnNetwork.getOutputsInfo(),
+                       false,
+                       std::move(constants_donor));
         InitExecutor();  // creates thread-based executor using for async requests
         BenchmarkOptimalNumberOfRequests();
+        WarmUp();
+        InitRequestBatcher(cnnNetwork);
+        InitDeviceReplicas(cnnNetwork);
     } catch (const InferenceEngine::Exception&) {
         throw;
     } catch (const std::exception& e) {
@@ -86,7 +96,27 @@ ExecutableNetwork::ExecutableNetwork(std::istream& model,
 
     auto cnnNetwork = plugin_->GetCore()->ReadNetwork(xmlString, std::move(dataBlob));
 
-    // TODO: implement Import / Export of configuration options and merge with `cfg`
+    // Compile-affecting options stored at Export() time take precedence over the plugin
+    // defaults, so an imported network is always compiled the way it was exported.
+    ConfigMap importedConfig;
+    std::uint64_t configCount = 0;
+    model.read(reinterpret_cast<char*>(&configCount), sizeof(configCount));
+    if (model.good()) {
+        auto readString = [&model] {
+            std::uint64_t size = 0;
+            model.read(reinterpret_cast<char*>(&size), sizeof(size));
+            std::string str(static_cast<std::size_t>(size), '\0');
+            model.read(&str[0], size);
+            return str;
+        };
+        for (std::uint64_t i = 0; i < configCount && model.good(); ++i) {
+            const auto key = readString();
+            const auto value = readString();
+            importedConfig.emplace(key, value);
+        }
+        cfg_ = Configuration{importedConfig, cfg_};
+    }
+
     // TODO: implement Import / Export of network precisions, layouts, preprocessing info
     InferenceEngine::InputsDataMap inputInfoMap = cnnNetwork.getInputsInfo();
     InferenceEngine::OutputsDataMap outputInfoMap = cnnNetwork.getOutputsInfo();
@@ -94,11 +124,13 @@ ExecutableNetwork::ExecutableNetwork(std::istream& model,
     setNetworkInputs(inputInfoMap);
     setNetworkOutputs(outputInfoMap);
     SetPointerToPlugin(plugin_->shared_from_this());
+    original_function_ = ngraph::clone_function(*cnnNetwork.getFunction());
 
     try {
-        CompileNetwork(cnnNetwork.getFunction(), cnnNetwork.getInputsInfo(), cnnNetwork.getOutputsInfo());
+        CompileNetwork(cnnNetwork.getFunction(), cnnNetwork.getInputsInfo(), cnnNetwork.getOutputsInfo(), true);
         InitExecutor();  // creates thread-based executor using for async requests
         BenchmarkOptimalNumberOfRequests();
+        WarmUp();
     } catch (const InferenceEngine::Exception&) {
         throw;
     } catch (const std::exception& e) {
@@ -108,18 +140,64 @@ ExecutableNetwork::ExecutableNetwork(std::istream& model,
     }
 }
 
+std::size_t ExecutableNetwork::ReshapeDynamicBatch(std::shared_ptr<ngraph::Function>& function) const {
+    std::map<ov::Output<ov::Node>, ov::PartialShape> new_shapes;
+    std::size_t max_batch = 0;
+    for (const auto& parameter : function->get_parameters()) {
+        auto shape = parameter->get_output_partial_shape(0);
+        if (shape.rank().is_dynamic() || shape.rank().get_length() == 0 || shape[0].is_static()) {
+            continue;
+        }
+        const auto upper_bound = shape[0].get_max_length();
+        if (upper_bound < 0) {
+            throwIEException(
+                fmt::format("Parameter {} has an unbounded batch dimension; the NVIDIA plugin sizes "
+                            "device buffers at compile time, so a maximum batch must be set, e.g. [1..N,...]",
+                            parameter->get_friendly_name()));
+        }
+        shape[0] = upper_bound;
+        new_shapes.emplace(parameter->output(0), shape);
+        max_batch = std::max(max_batch, static_cast<std::size_t>(upper_bound));
+    }
+    if (!new_shapes.empty()) {
+        function->reshape(new_shapes);
+    }
+    return max_batch;
+}
+
 void ExecutableNetwork::CompileNetwork(const std::shared_ptr<const ngraph::Function>& function,
                                        const InferenceEngine::InputsDataMap& inputInfoMap,
-                                       const InferenceEngine::OutputsDataMap& outputsInfoMap) {
+                                       const InferenceEngine::OutputsDataMap& outputsInfoMap,
+                                       bool isImportedFunction,
+                                       DeviceMemBlock::Ptr constants_donor) {
     CUDA::Device device{cfg_.deviceId};
     GraphTransformer transformer;
     // Clone model
     function_ = ngraph::clone_function(*function);
-    // Apply common transformations
-    transformer.common_transform(CUDA::Device{cfg_.deviceId}, function_, inputInfoMap, outputsInfoMap, cfg_);
-    // Clone model and additionally apply export specific transformations
-    export_function_ =
-        transformer.clone_and_export_transform(CUDA::Device{cfg_.deviceId}, function_, inputInfoMap, outputsInfoMap, cfg_);
+    max_batch_size_ = ReshapeDynamicBatch(function_);
+    if (max_batch_size_ == 0 && cfg_.dyn_batch_enabled) {
+        // Static model with KEY_DYN_BATCH_ENABLED: the declared shapes already describe
+        // the maximum batch, requests only select how much of it is processed
+        const auto& parameters = function_->get_parameters();
+        const auto batched = std::find_if(parameters.begin(), parameters.end(), [](const auto& parameter) {
+            const auto& shape = parameter->get_output_partial_shape(0);
+            return shape.rank().is_static() && shape.rank().get_length() > 0 && shape[0].is_static();
+        });
+        if (batched != parameters.end()) {
+            max_batch_size_ = (*batched)->get_output_partial_shape(0)[0].get_length();
+        }
+    }
+    if (isImportedFunction) {
+        // The exported blob already contains the common-transformed model, so a warm start
+        // only needs the CUDA-specific transformations and operation creation below.
+        export_function_ = ngraph::clone_function(*function);
+    } else {
+        // Apply common transformations
+        transformer.common_transform(CUDA::Device{cfg_.deviceId}, function_, inputInfoMap, outputsInfoMap, cfg_);
+        // Clone model and additionally apply export specific transformations
+        export_function_ = transformer.clone_and_export_transform(
+            CUDA::Device{cfg_.deviceId}, function_, inputInfoMap, outputsInfoMap, cfg_);
+    }
     //  CUDA-specific tranformations
     transformer.cuda_transform(CUDA::Device{cfg_.deviceId}, function_, cfg_);
     // Generate backend specific blob mappings. For example Inference Engine uses not ov::Result nodes friendly name
@@ -139,9 +217,14 @@ void ExecutableNetwork::CompileNetwork(const std::shared_ptr<const ngraph::Funct
     // Perform any other steps like allocation and filling backend specific memory handles and so on
     const std::string opBenchOptionString = cfg_.Get(NVIDIA_CONFIG_KEY(OPERATION_BENCHMARK));
     const bool opBenchOption = opBenchOptionString == NVIDIA_CONFIG_VALUE(YES);
-    const auto creationContext = CreationContext{device, opBenchOption};
+    const auto creationContext = CreationContext{device,
+                                                 opBenchOption,
+                                                 cfg_.use_cuda_graph,
+                                                 static_cast<unsigned>(cfg_.cancellation_check_interval),
+                                                 static_cast<std::size_t>(cfg_.cudnn_workspace_limit),
+                                                 cfg_.host_fallback};
 
-    graph_ = std::make_unique<CudaGraph>(creationContext, function_);
+    graph_ = std::make_unique<CudaGraph>(creationContext, function_, std::move(constants_donor));
 
     memory_pool_ = CreateMemoryPool();
 }
@@ -213,6 +296,22 @@ void ExecutableNetwork::BenchmarkOptimalNumberOfRequests() {
     fmt::print("Time of benchmark for optimal number infer-requests = {} ms\n", durationMs.count());
 }
 
+void ExecutableNetwork::WarmUp() {
+    if (!cfg_.warm_up) {
+        return;
+    }
+    const std::string throughputStreams = cfg_.Get(NVIDIA_CONFIG_KEY(THROUGHPUT_STREAMS));
+    if (throughputStreams == NVIDIA_CONFIG_VALUE(THROUGHPUT_AUTO)) {
+        return;  // the benchmark above already executed the pipeline on every pooled block
+    }
+    // Benchmark requests run the full pipeline on freshly allocated blobs, and with
+    // as many requests in flight as there are pooled blocks each block is claimed
+    // exactly once, so every per-block lazy initialization happens here
+    std::mutex mtx;
+    std::condition_variable cond_var;
+    RunBenchmarkFor(memory_pool_->Size(), mtx, cond_var);
+}
+
 unsigned int ExecutableNetwork::RunBenchmarkFor(const int numInfers,
                                                 std::mutex& mtx,
                                                 std::condition_variable& cond_var) {
@@ -290,6 +389,135 @@ std::shared_ptr<MemoryPool> ExecutableNetwork::CreateMemoryPool() {
     return std::make_shared<MemoryPool>(numStreams, memory_model);
 }
 
+void ExecutableNetwork::InitRequestBatcher(const InferenceEngine::CNNNetwork& cnnNetwork) {
+    const auto batchSize = cfg_.auto_batch_size;
+    if (batchSize < 2) {
+        return;
+    }
+    try {
+        // Only dim-0 batching is supported: every sample must occupy one
+        // contiguous slice of each batched blob
+        for (const auto& [name, data] : _networkOutputs) {
+            const auto& dims = data->getTensorDesc().getDims();
+            if (dims.empty() || dims.front() != 1) {
+                throwIEException(fmt::format("auto batching requires batch-1 outputs, output {} is not batchable", name));
+            }
+        }
+        InferenceEngine::CNNNetwork batchedNetwork{ngraph::clone_function(*cnnNetwork.getFunction())};
+        auto inputShapes = batchedNetwork.getInputShapes();
+        for (auto& [name, shape] : inputShapes) {
+            if (shape.empty() || shape.front() != 1) {
+                throwIEException(fmt::format("auto batching requires batch-1 inputs, input {} is not batchable", name));
+            }
+            shape.front() = batchSize;
+        }
+        batchedNetwork.reshape(inputShapes);
+        for (const auto& [name, info] : batchedNetwork.getInputsInfo()) {
+            info->setPrecision(_networkInputs.at(name)->getPrecision());
+        }
+        for (const auto& [name, data] : batchedNetwork.getOutputsInfo()) {
+            data->setPrecision(_networkOutputs.at(name)->getPrecision());
+        }
+        auto batchedCfg = cfg_;
+        batchedCfg.auto_batch_size = 0;  // the batch-compiled copy must not batch again
+        batchedCfg.cuda_throughput_streams_ = std::to_string(1);
+        batched_network_ = std::make_shared<ExecutableNetwork>(batchedNetwork, batchedCfg, cuda_stream_executor_, plugin_);
+        std::vector<std::string> inputNames;
+        std::vector<std::string> outputNames;
+        for (const auto& input : _networkInputs) {
+            inputNames.push_back(input.first);
+        }
+        for (const auto& output : _networkOutputs) {
+            outputNames.push_back(output.first);
+        }
+        request_batcher_ = std::make_shared<RequestBatcher>(batched_network_->CreateInferRequest(),
+                                                            std::move(inputNames),
+                                                            std::move(outputNames),
+                                                            batchSize,
+                                                            cfg_.auto_batch_timeout_ms);
+    } catch (const std::exception&) {
+        // The single-sample pipeline is fully functional on its own, so a model the
+        // batch dimension cannot be propagated through simply runs without batching
+        request_batcher_ = nullptr;
+        batched_network_ = nullptr;
+    }
+}
+
+void ExecutableNetwork::InitDeviceReplicas(const InferenceEngine::CNNNetwork& cnnNetwork) {
+    const auto devices = cfg_.multiDevices();
+    if (devices.empty()) {
+        return;
+    }
+    const auto deviceCount = CUDA::Device::count();
+    for (const auto deviceId : devices) {
+        if (deviceId < 0 || deviceId >= deviceCount) {
+            throwIEException(fmt::format(
+                "NVIDIA_CONFIG_KEY(MULTI_DEVICES) lists device {} but only {} devices are present", deviceId, deviceCount));
+        }
+        if (deviceId == cfg_.deviceId) {
+            continue;  // this network already serves its own device
+        }
+        auto replicaCfg = cfg_;
+        replicaCfg.deviceId = deviceId;
+        replicaCfg.multi_devices = "";  // each replica serves exactly one device
+        device_replicas_.push_back(std::make_shared<ExecutableNetwork>(
+            cnnNetwork, replicaCfg, plugin_->GetStreamExecutor(replicaCfg), plugin_));
+    }
+}
+
+std::shared_ptr<ExecutableNetwork> ExecutableNetwork::GetShapeProfile(
+    const std::map<std::string, InferenceEngine::SizeVector>& inputShapes) {
+    std::string key;
+    for (const auto& [name, dims] : inputShapes) {
+        key += name;
+        key += '[';
+        for (const auto dim : dims) {
+            key += std::to_string(dim);
+            key += ',';
+        }
+        key += ']';
+    }
+    {
+        std::lock_guard<std::mutex> lock{profiles_mutex_};
+        for (auto it = shape_profiles_.begin(); it != shape_profiles_.end(); ++it) {
+            if (it->first == key) {
+                shape_profiles_.splice(shape_profiles_.begin(), shape_profiles_, it);
+                return shape_profiles_.front().second;
+            }
+        }
+    }
+    // Compilation runs outside the lock; concurrent first requests for one shape
+    // may both compile, the LRU then keeps whichever finishes last
+    InferenceEngine::CNNNetwork profileNetwork{ngraph::clone_function(*original_function_)};
+    profileNetwork.reshape(inputShapes);
+    for (const auto& [name, info] : profileNetwork.getInputsInfo()) {
+        info->setPrecision(_networkInputs.at(name)->getPrecision());
+    }
+    for (const auto& [name, data] : profileNetwork.getOutputsInfo()) {
+        data->setPrecision(_networkOutputs.at(name)->getPrecision());
+    }
+    auto profileCfg = cfg_;
+    profileCfg.auto_batch_size = 0;  // the profile serves exactly the requested shapes
+    profileCfg.multi_devices = "";   // and exactly this device
+    const std::string throughputStreams = profileCfg.Get(NVIDIA_CONFIG_KEY(THROUGHPUT_STREAMS));
+    if (throughputStreams == NVIDIA_CONFIG_VALUE(THROUGHPUT_AUTO)) {
+        // This network already benchmarked the optimal request count; reusing it
+        // keeps profile compilation free of the warm-up benchmark
+        profileCfg.cuda_throughput_streams_ = std::to_string(memory_pool_->Size());
+    }
+    auto profile = std::make_shared<ExecutableNetwork>(profileNetwork,
+                                                       profileCfg,
+                                                       cuda_stream_executor_,
+                                                       plugin_,
+                                                       graph_->memoryManager().immutableTensorsPtr());
+    std::lock_guard<std::mutex> lock{profiles_mutex_};
+    shape_profiles_.emplace_front(std::move(key), profile);
+    if (shape_profiles_.size() > kMaxShapeProfiles) {
+        shape_profiles_.pop_back();
+    }
+    return profile;
+}
+
 int ExecutableNetwork::GetCudaDeviceId() const noexcept {
     const std::string deviceId = cfg_.Get(CONFIG_KEY(DEVICE_ID));
     return std::stoi(deviceId);
@@ -323,6 +551,14 @@ InferenceEngine::IInferRequestInternal::Ptr ExecutableNetwork::ExecutableNetwork
 }
 
 InferenceEngine::IInferRequestInternal::Ptr ExecutableNetwork::CreateInferRequest() {
+    if (!device_replicas_.empty()) {
+        // Slot 0 is this network itself; successive requests land on successive
+        // devices so the load stays balanced across GPUs
+        const auto slot = next_replica_++ % (device_replicas_.size() + 1);
+        if (slot > 0) {
+            return device_replicas_[slot - 1]->CreateInferRequest();
+        }
+    }
     InferenceEngine::IInferRequestInternal::Ptr internalRequest;
     if (this->_plugin) {
         const auto& core = _plugin->GetCore();
@@ -336,7 +572,8 @@ InferenceEngine::IInferRequestInternal::Ptr ExecutableNetwork::CreateInferReques
     return std::make_shared<CudaAsyncInferRequest>(std::static_pointer_cast<CudaInferRequest>(internalRequest),
                                                    _taskExecutor,
                                                    cuda_stream_executor_,
-                                                   _callbackExecutor);
+                                                   _callbackExecutor,
+                                                   request_batcher_);
 }
 
 InferenceEngine::Parameter ExecutableNetwork::GetConfig(const std::string& name) const { return cfg_.Get(name); }
@@ -348,7 +585,9 @@ InferenceEngine::Parameter ExecutableNetwork::GetMetric(const std::string& name)
                              std::vector<std::string>{METRIC_KEY(NETWORK_NAME),
                                                       METRIC_KEY(SUPPORTED_METRICS),
                                                       METRIC_KEY(SUPPORTED_CONFIG_KEYS),
-                                                      METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)});
+                                                      METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS),
+                                                      NVIDIA_METRIC_VALUE(LATENCY_METRICS),
+                                                      NVIDIA_METRIC_VALUE(EVENT_COUNTERS)});
     } else if (EXEC_NETWORK_METRIC_KEY(SUPPORTED_CONFIG_KEYS) == name) {
         std::vector<std::string> configKeys = {CONFIG_KEY(DEVICE_ID),
                                                CONFIG_KEY(PERF_COUNT),
@@ -365,6 +604,12 @@ InferenceEngine::Parameter ExecutableNetwork::GetMetric(const std::string& name)
     } else if (EXEC_NETWORK_METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS) == name) {
         const unsigned value = memory_pool_->Size();
         IE_SET_METRIC_RETURN(OPTIMAL_NUMBER_OF_INFER_REQUESTS, value);
+    } else if (NVIDIA_METRIC_VALUE(LATENCY_METRICS) == name) {
+        // The memory pool capacity bounds the number of pipelines in flight, which
+        // is the denominator of the occupancy aggregate
+        return {latency_metrics_->Aggregate(memory_pool_ ? memory_pool_->Size() : 0)};
+    } else if (NVIDIA_METRIC_VALUE(EVENT_COUNTERS) == name) {
+        return {utils::EventCounters::instance().snapshot()};
     } else {
         throwIEException(fmt::format("Unsupported ExecutableNetwork metric: {}", name));
     }
@@ -397,6 +642,31 @@ void ExecutableNetwork::Export(std::ostream& modelStream) {
     modelStream.write(reinterpret_cast<char*>(&dataSize), sizeof(dataSize));
     modelStream.write(reinterpret_cast<char*>(&m_constants[0]), dataSize);
 
+    // Serialize compile-affecting configuration options so that ImportNetwork
+    // recompiles the model exactly the way it was exported.
+    const std::map<std::string, std::string> exportedConfig{
+        {NVIDIA_CONFIG_KEY(OPERATION_BENCHMARK), cfg_.Get(NVIDIA_CONFIG_KEY(OPERATION_BENCHMARK))},
+        {NVIDIA_CONFIG_KEY(USE_CUDA_GRAPH), cfg_.Get(NVIDIA_CONFIG_KEY(USE_CUDA_GRAPH))},
+        {NVIDIA_CONFIG_KEY(INFERENCE_PRECISION), cfg_.Get(NVIDIA_CONFIG_KEY(INFERENCE_PRECISION))},
+        {NVIDIA_CONFIG_KEY(FP32_SENSITIVE_OPS), cfg_.Get(NVIDIA_CONFIG_KEY(FP32_SENSITIVE_OPS))},
+        {NVIDIA_CONFIG_KEY(STREAM_PRIORITY), cfg_.Get(NVIDIA_CONFIG_KEY(STREAM_PRIORITY))},
+        {NVIDIA_CONFIG_KEY(CANCELLATION_CHECK_INTERVAL), cfg_.Get(NVIDIA_CONFIG_KEY(CANCELLATION_CHECK_INTERVAL))},
+        // The exported model is already reshaped to the maximum batch, so dynamic batch
+        // of a dynamically shaped original is re-enabled on import through the config key
+        {CONFIG_KEY(DYN_BATCH_ENABLED),
+         std::string(cfg_.dyn_batch_enabled || max_batch_size_ > 0 ? CONFIG_VALUE(YES) : CONFIG_VALUE(NO))}};
+    auto writeString = [&modelStream](const std::string& str) {
+        const auto size = static_cast<std::uint64_t>(str.size());
+        modelStream.write(reinterpret_cast<const char*>(&size), sizeof(size));
+        modelStream.write(str.c_str(), size);
+    };
+    const auto configCount = static_cast<std::uint64_t>(exportedConfig.size());
+    modelStream.write(reinterpret_cast<const char*>(&configCount), sizeof(configCount));
+    for (const auto& option : exportedConfig) {
+        writeString(option.first);
+        writeString(option.second);
+    }
+
     // TODO: implement network precision, layout, preprocessing info serialization
 }
 
@@ -5,13 +5,17 @@
 #pragma once
 
 #include <cpp_interfaces/impl/ie_executable_network_thread_safe_default.hpp>
+#include <list>
+#include <mutex>
 #include <ngraph/function.hpp>
 
 #include "cuda_async_infer_request.hpp"
 #include "cuda_config.hpp"
 #include "cuda_graph.hpp"
 #include "cuda_infer_request.hpp"
+#include "cuda_latency_metrics.hpp"
 #include "cuda_op_buffers_extractor.hpp"
+#include "cuda_request_batcher.hpp"
 #include "memory_manager/cuda_device_mem_block.hpp"
 #include "memory_manager/cuda_memory_manager.hpp"
 #include "memory_manager/cuda_memory_pool.hpp"
@@ -35,7 +39,8 @@ public:
     ExecutableNetwork(const InferenceEngine::CNNNetwork& cnnNetwork,
                       Configuration cfg,
                       InferenceEngine::ITaskExecutor::Ptr waitExecutor,
-                      std::shared_ptr<Plugin> plugin);
+                      std::shared_ptr<Plugin> plugin,
+                      DeviceMemBlock::Ptr constants_donor = nullptr);
     ExecutableNetwork(std::istream& model,
                       Configuration cfg,
                       InferenceEngine::ITaskExecutor::Ptr waitExecutor,
@@ -68,10 +73,30 @@ public:
 private:
     friend class ::ExecNetworkTest;
     friend class CudaInferRequest;
+    /**
+     * Replaces a dynamic leading (batch) dimension of every parameter with its upper
+     * bound so the static compilation pipeline sizes all buffers for the maximum
+     * batch; requests then select the runtime batch via SetBatch(). Returns the
+     * maximum batch, or 0 when the model has no dynamic batch dimension.
+     */
+    std::size_t ReshapeDynamicBatch(std::shared_ptr<ngraph::Function>& function) const;
     void CompileNetwork(const std::shared_ptr<const ngraph::Function>& function,
                         const InferenceEngine::InputsDataMap& inputInfoMap,
-                        const InferenceEngine::OutputsDataMap& outputsInfoMap);
+                        const InferenceEngine::OutputsDataMap& outputsInfoMap,
+                        bool isImportedFunction = false,
+                        DeviceMemBlock::Ptr constants_donor = nullptr);
+    /**
+     * Returns a copy of this network compiled for the given input shapes,
+     * compiling it on first use and serving repeated shapes from an LRU cache.
+     * Profiles share this network's device constants blob, so a cache miss only
+     * rebuilds the mutable memory model and the operation parameters and a hit
+     * costs a map lookup.
+     */
+    std::shared_ptr<ExecutableNetwork> GetShapeProfile(
+        const std::map<std::string, InferenceEngine::SizeVector>& inputShapes);
     void InitExecutor();
+    void InitRequestBatcher(const InferenceEngine::CNNNetwork& cnnNetwork);
+    void InitDeviceReplicas(const InferenceEngine::CNNNetwork& cnnNetwork);
     std::size_t GetOptimalNumberOfStreams(std::size_t constBlobSize, std::size_t memoryBlobSize) const;
     InferenceEngine::IInferRequestInternal::Ptr CreateBenchmarkInferRequestImpl(
         InferenceEngine::InputsDataMap networkInputs, InferenceEngine::OutputsDataMap networkOutputs);
@@ -79,6 +104,12 @@ private:
     std::shared_ptr<MemoryPool> CreateMemoryPool();
     int GetCudaDeviceId() const noexcept;
     void BenchmarkOptimalNumberOfRequests();
+    /**
+     * Runs one dummy inference per pooled memory block so lazy cuDNN plan
+     * finalization, the first touch of every mutable blob and any PTX JIT all
+     * happen before the first user request; no-op unless NVIDIA_WARM_UP is set
+     */
+    void WarmUp();
     unsigned int RunBenchmarkFor(int numInfers, std::mutex& mtx, std::condition_variable& cond_var);
 
     std::atomic<std::size_t> request_id_ = {0};
@@ -91,6 +122,29 @@ private:
     std::map<std::string, std::size_t> output_index_;
     std::unique_ptr<CudaGraph> graph_;
     std::shared_ptr<MemoryPool> memory_pool_;
+    // Always-on latency recorder shared by all requests of this network;
+    // aggregates are published via the LATENCY_METRICS metric
+    std::shared_ptr<LatencyMetrics> latency_metrics_ = std::make_shared<LatencyMetrics>();
+    // Batch the buffers are sized for when dynamic batch is in use (model with a
+    // dynamic batch dimension or KEY_DYN_BATCH_ENABLED); 0 keeps SetBatch() disabled
+    std::size_t max_batch_size_ = 0;
+    // Batch-compiled copy of the network plus the collector joining concurrent
+    // single-sample requests into its batched executions; both stay empty when
+    // auto batching is disabled or not applicable to the model
+    std::shared_ptr<ExecutableNetwork> batched_network_;
+    RequestBatcher::Ptr request_batcher_;
+    // Copies of the network compiled for the other devices of NVIDIA_MULTI_DEVICES;
+    // requests are spread evenly over this network and its replicas
+    std::vector<std::shared_ptr<ExecutableNetwork>> device_replicas_;
+    std::atomic<std::size_t> next_replica_ = {0};
+    // Untransformed copy of the loaded model kept so GetShapeProfile() can
+    // reshape and recompile it; profiles themselves hold no copy
+    std::shared_ptr<ngraph::Function> original_function_;
+    // Most-recently-used-first list of networks recompiled for other input
+    // shapes, keyed by the concatenated input dims
+    static constexpr std::size_t kMaxShapeProfiles = 8;
+    std::mutex profiles_mutex_;
+    std::list<std::pair<std::string, std::shared_ptr<ExecutableNetwork>>> shape_profiles_;
 };
 
 }  // namespace nvidia_gpu
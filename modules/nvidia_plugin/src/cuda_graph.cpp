@@ -4,17 +4,95 @@
 
 #include "cuda_graph.hpp"
 
+#include <fmt/format.h>
+
+#include "cuda_profiler.hpp"
+
 namespace ov {
 namespace nvidia_gpu {
 
-CudaGraph::CudaGraph(const CreationContext& context, const std::shared_ptr<const ngraph::Function>& function)
-    : SubGraph(context, function) {}
+CudaGraph::CudaGraph(const CreationContext& context,
+                     const std::shared_ptr<const ngraph::Function>& function,
+                     DeviceMemBlock::Ptr constants_donor)
+    : SubGraph(context, function, std::move(constants_donor)), use_cuda_graph_{context.useCudaGraphOption()} {}
 
 void CudaGraph::Run(const InferenceRequestContext& context, const DeviceMemBlock& memoryBlock) const {
+    if (use_cuda_graph_ && IsCudaGraphCompatible() && !graph_capture_failed_ &&
+        !context.getProfiler().PerfCount()) {
+        try {
+            RunGraph(context, memoryBlock);
+            return;
+        } catch (const std::exception& e) {
+            graph_capture_failed_ = true;
+            logError(fmt::format("CUDA graph capture failed ({}), falling back to kernel-by-kernel execution", e.what()));
+        }
+    }
     Workbuffers workbuffers{};
     workbuffers.mutable_buffers.emplace_back(memoryBlock.view().data());
     SubGraph::Execute(context, {}, {}, workbuffers);
 }
 
+void CudaGraph::RunGraph(const InferenceRequestContext& context, const DeviceMemBlock& memoryBlock) const {
+    const auto& stream = context.getThreadContext().stream();
+    const void* key = memoryBlock.view().data();
+    {
+        std::lock_guard<std::mutex> lock{graph_exec_mutex_};
+        const auto found = graphs_.find(key);
+        if (found != graphs_.end()) {
+            LaunchEntry(found->second, key, stream);
+            return;
+        }
+    }
+
+    // First inference on this memory block: record the whole execution sequence into a graph.
+    // Capture bypasses the profiler wrappers since event timing is meaningless inside a capture.
+    Workbuffers workbuffers{};
+    workbuffers.mutable_buffers.emplace_back(memoryBlock.view().data());
+    const auto& memoryManager = this->memoryManager();
+    auto& mutableBuffer = workbuffers.mutable_buffers.at(0);
+    auto& cancellationToken = context.getCancellationToken();
+
+    CUDA::GraphCapture capture{stream};
+    MemoryManager::InputTensors inputTensors;
+    MemoryManager::OutputTensors outputTensors;
+    Workbuffers workBuffers;
+    for (auto& op : getExecSequence()) {
+        cancellationToken.Check();
+        memoryManager.inputTensorPointers(*op, mutableBuffer, inputTensors);
+        memoryManager.outputTensorPointers(*op, mutableBuffer, outputTensors);
+        memoryManager.workBuffers(*op, mutableBuffer, workBuffers);
+        op->Execute(context, inputTensors, outputTensors, workBuffers);
+    }
+    CUDA::Graph graph{capture.endCapture()};
+
+    std::lock_guard<std::mutex> lock{graph_exec_mutex_};
+    auto& entry = graphs_.emplace(key, GraphCacheEntry{std::move(graph), std::nullopt}).first->second;
+    LaunchEntry(entry, key, stream);
+}
+
+void CudaGraph::LaunchEntry(GraphCacheEntry& entry, const void* key, const CUDA::Stream& stream) const {
+    if (entry.exec) {
+        entry.exec->launch(stream);
+        return;
+    }
+    if (dedicated_execs_ < kMaxDedicatedGraphExecs) {
+        entry.exec.emplace(entry.graph);
+        ++dedicated_execs_;
+        entry.exec->launch(stream);
+        return;
+    }
+    // The dedicated exec budget is spent: re-bind the shared exec to this block's
+    // captured graph. The update only swaps buffer addresses inside the nodes, which
+    // is much cheaper than instantiating; launches already enqueued keep their old
+    // bindings, so re-binding under the lock is safe.
+    if (!shared_exec_) {
+        shared_exec_.emplace(entry.graph);
+    } else if (shared_exec_block_ != key && !shared_exec_->update(entry.graph)) {
+        shared_exec_.emplace(entry.graph);
+    }
+    shared_exec_block_ = key;
+    shared_exec_->launch(stream);
+}
+
 }  // namespace nvidia_gpu
 }  // namespace ov
@@ -4,7 +4,12 @@
 
 #pragma once
 
+#include <atomic>
+#include <cuda/graph.hpp>
+#include <mutex>
+#include <optional>
 #include <ops/subgraph.hpp>
+#include <unordered_map>
 
 class ExecNetworkTest;
 
@@ -15,10 +20,40 @@ class CudaGraph final : public SubGraph {
 public:
     friend class ::ExecNetworkTest;
 
-    CudaGraph(const CreationContext& context, const std::shared_ptr<const ngraph::Function>& function);
+    CudaGraph(const CreationContext& context,
+              const std::shared_ptr<const ngraph::Function>& function,
+              DeviceMemBlock::Ptr constants_donor = nullptr);
     ~CudaGraph() override = default;
 
     void Run(const InferenceRequestContext& context, const DeviceMemBlock& memoryBlock) const;
+
+private:
+    // Executable graphs are the heavy objects (instantiation walks every node), so only
+    // this many memory blocks get a dedicated one; the remaining blocks share one exec
+    // that is re-bound to their captured graph via cudaGraphExecUpdate before launch
+    static constexpr std::size_t kMaxDedicatedGraphExecs = 8;
+
+    /** Captured graph of one mutable memory block plus its dedicated exec, if it got one */
+    struct GraphCacheEntry {
+        CUDA::Graph graph;
+        std::optional<CUDA::GraphExec> exec;
+    };
+
+    void RunGraph(const InferenceRequestContext& context, const DeviceMemBlock& memoryBlock) const;
+    /** Launches the cached graph of @p key; must be called under graph_exec_mutex_ */
+    void LaunchEntry(GraphCacheEntry& entry, const void* key, const CUDA::Stream& stream) const;
+
+    const bool use_cuda_graph_;
+    // Captured graph instances are keyed by the mutable memory block pointer, since tensor
+    // addresses baked into a graph are only valid for the block it was captured with.
+    mutable std::mutex graph_exec_mutex_;
+    mutable std::unordered_map<const void*, GraphCacheEntry> graphs_;
+    mutable std::size_t dedicated_execs_{0};
+    // Fallback exec shared by the blocks beyond kMaxDedicatedGraphExecs and the
+    // block it is currently bound to
+    mutable std::optional<CUDA::GraphExec> shared_exec_;
+    mutable const void* shared_exec_block_ = nullptr;
+    mutable std::atomic<bool> graph_capture_failed_{false};
 };
 
 }  // namespace nvidia_gpu
@@ -5,6 +5,7 @@
 #include "cuda_infer_request.hpp"
 
 #include <cuda_fp16.h>
+#include <cuda_runtime.h>
 #include <debug.h>
 #include <fmt/format.h>
 #include <ie_blob.h>
@@ -22,6 +23,7 @@
 
 #include "cuda_executable_network.hpp"
 #include "cuda_itt.hpp"
+#include "cuda_pinned_host_allocator.hpp"
 #include "cuda_plugin.hpp"
 #include "ie_ngraph_utils.hpp"
 #include "ngraph/util.hpp"
@@ -34,8 +36,27 @@ using namespace utils;
 
 using Time = std::chrono::steady_clock;
 
+/**
+ * Completion state shared between an in-flight pipeline and the host callbacks enqueued on
+ * its compute and download streams. The promise is fulfilled once both callbacks have run.
+ */
+struct PipelineCompletion {
+    std::promise<void> promise;
+    std::atomic<int> remaining{2};
+};
+
 namespace {
 
+void CUDART_CB signalPipelineStageDone(void* data) {
+    // The callback owns one shared reference, so the completion state stays alive even if
+    // the infer request has already been destroyed
+    auto completion =
+        std::unique_ptr<std::shared_ptr<PipelineCompletion>>{static_cast<std::shared_ptr<PipelineCompletion>*>(data)};
+    if ((*completion)->remaining.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+        (*completion)->promise.set_value();
+    }
+}
+
 template <typename BlobData, typename GetNetworkPrecisionF>
 void allocateBlobImpl(BlobMap& blobMap,
                       BlobMap& networkBlobMap,
@@ -48,7 +69,8 @@ void allocateBlobImpl(BlobMap& blobMap,
     const auto deviceLayout = TensorDesc::getLayoutByDims(dims);
     Blob::Ptr& blob = blobMap[blobData.first];
     if (!blob) {
-        blob = make_blob_with_precision({precision, dims, layout});
+        // Pinned host memory allows H2D/D2H copies to bypass the driver bounce buffer
+        blob = make_blob_with_precision({precision, dims, layout}, PinnedHostAllocator::instance());
         blob->allocate();
     } else {
         blob->setShape(dims);
@@ -60,10 +82,12 @@ void allocateBlobImpl(BlobMap& blobMap,
         networkBlob = blob;
     } else {
         if (isInputBlob) {
-            networkBlob = make_blob_with_precision({InferenceEngine::Precision::FP32, dims, deviceLayout});
+            networkBlob = make_blob_with_precision({InferenceEngine::Precision::FP32, dims, deviceLayout},
+                                                   PinnedHostAllocator::instance());
             networkBlob->allocate();
         } else {
-            networkBlob = make_blob_with_precision({networkPrecision, dims, deviceLayout});
+            networkBlob =
+                make_blob_with_precision({networkPrecision, dims, deviceLayout}, PinnedHostAllocator::instance());
             networkBlob->allocate();
         }
     }
@@ -84,6 +108,67 @@ void allocateBlobsImpl(const BlobDataMap& userDataMap,
 
 }  // namespace
 
+UserBlobPinner::~UserBlobPinner() {
+    for (const auto& region : regions_) {
+        if (region.registered) {
+            ::cudaHostUnregister(region.ptr);
+        }
+    }
+}
+
+void UserBlobPinner::pin(const InferenceEngine::Blob::Ptr& userBlob) {
+    const auto mem_blob = InferenceEngine::as<InferenceEngine::MemoryBlob>(userBlob);
+    if (!mem_blob) {
+        return;
+    }
+    void* const ptr = mem_blob->rwmap().as<void*>();
+    const std::size_t size = mem_blob->byteSize();
+    if (ptr == nullptr || size < kMinBytesToPin) {
+        return;
+    }
+    for (auto it = regions_.begin(); it != regions_.end(); ++it) {
+        if (it->ptr == ptr && it->size == size) {
+            // Rebinds of one buffer may come wrapped in different Blob objects;
+            // keeping the newest one alive is enough for the registration
+            if (it->registered) {
+                it->blob = userBlob;
+            }
+            regions_.splice(regions_.begin(), regions_, it);
+            return;
+        }
+    }
+    cudaPointerAttributes attributes{};
+    const auto query = ::cudaPointerGetAttributes(&attributes, ptr);
+    if (query == cudaSuccess && attributes.type != cudaMemoryTypeUnregistered) {
+        // Already pinned (PinnedHostAllocator, another request's registration)
+        // or device-resident; memoized so rebinds skip the driver query
+        regions_.push_front(Region{ptr, size, false, nullptr});
+        return;
+    }
+    if (query != cudaSuccess) {
+        ::cudaGetLastError();  // older runtimes report pageable memory as an error
+    }
+    const bool registered = ::cudaHostRegister(ptr, size, cudaHostRegisterDefault) == cudaSuccess;
+    if (!registered) {
+        // Registration can fail for exotic mappings or when the page-lock limit is
+        // reached; the copy then simply stays on the pageable path
+        ::cudaGetLastError();
+    }
+    regions_.push_front(Region{ptr, size, registered, registered ? userBlob : nullptr});
+    if (!registered) {
+        return;
+    }
+    pinned_bytes_ += size;
+    for (auto it = std::prev(regions_.end()); pinned_bytes_ > kMaxPinnedBytes && it != regions_.begin();) {
+        const auto victim = it--;
+        if (victim->registered) {
+            ::cudaHostUnregister(victim->ptr);
+            pinned_bytes_ -= victim->size;
+            regions_.erase(victim);
+        }
+    }
+}
+
 CudaInferRequest::CudaInferRequest(const std::vector<std::shared_ptr<const ov::Node>>& inputs,
                                    const std::vector<std::shared_ptr<const ov::Node>>& outputs,
                                    const std::shared_ptr<ExecutableNetwork>& executableNetwork,
@@ -91,7 +176,10 @@ CudaInferRequest::CudaInferRequest(const std::vector<std::shared_ptr<const ov::N
     : IInferRequestInternal(inputs, outputs),
       _executableNetwork(executableNetwork),
       cancellation_token_{[this] { memory_proxy_.reset(); }},
-      profiler_{_executableNetwork->cfg_.perfCount, *_executableNetwork->graph_},
+      profiler_{_executableNetwork->cfg_.perfCount,
+                *_executableNetwork->graph_,
+                _executableNetwork->cfg_.device_time_profiling,
+                _executableNetwork->cfg_.trace_export_path},
       is_benchmark_mode_{isBenchmarkMode} {
     createInferRequest();
 }
@@ -103,7 +191,10 @@ CudaInferRequest::CudaInferRequest(const InferenceEngine::InputsDataMap& network
     : IInferRequestInternal(networkInputs, networkOutputs),
       _executableNetwork(executableNetwork),
       cancellation_token_{[this] { memory_proxy_.reset(); }},
-      profiler_{_executableNetwork->cfg_.perfCount, *_executableNetwork->graph_},
+      profiler_{_executableNetwork->cfg_.perfCount,
+                *_executableNetwork->graph_,
+                _executableNetwork->cfg_.device_time_profiling,
+                _executableNetwork->cfg_.trace_export_path},
       is_benchmark_mode_{isBenchmarkMode} {
     createInferRequest();
 }
@@ -131,7 +222,8 @@ void CudaInferRequest::allocateBlobs() {
         if (deviceInputDescr.getPrecision() != networkPrecision) {
             Blob::Ptr networkBlob;
             networkBlob = make_blob_with_precision(
-                {networkPrecision, inputDescr.getDims(), TensorDesc::getLayoutByDims(inputDescr.getDims())});
+                {networkPrecision, inputDescr.getDims(), TensorDesc::getLayoutByDims(inputDescr.getDims())},
+                PinnedHostAllocator::instance());
             networkBlob->allocate();
             network_input_blobs_[inputName] = networkBlob;
         }
@@ -152,6 +244,13 @@ void CudaInferRequest::createInferRequest() {
     // actual list of profiling tasks
 
     std::string name = _executableNetwork->newRequestName();
+
+    // Each request owns a disjoint 2^32 block of Philox sequence numbers, so
+    // concurrent stochastic passes draw independent random streams without
+    // synchronizing on any shared generator state
+    static std::atomic<std::uint64_t> request_ordinal{0};
+    random_sequence_ = request_ordinal.fetch_add(1, std::memory_order_relaxed) << 32;
+
     _profilingTask = {
         openvino::itt::handle(name + "_Preprocess"),
         openvino::itt::handle(name + "_Postprocess"),
@@ -164,8 +263,15 @@ void CudaInferRequest::createInferRequest() {
 }
 
 void CudaInferRequest::inferPreprocess() {
+    if (profile_request_) {
+        profile_request_->inferPreprocess();
+        return;
+    }
     OV_ITT_SCOPED_TASK(itt::domains::nvidia_gpu, _profilingTask[Profiler::Preprocess]);
+    itt::ScopedNvtxRange nvtx_range{"CudaInferRequest::inferPreprocess"};
     cancellation_token_.Check();
+    utils::EventCounters::add(utils::EventCounters::instance().infer_requests_started);
+    infer_start_ = Profiler::Time::now();
     profiler_.StartStage();
     IInferRequestInternal::convertBatchedInputBlobs();
     IInferRequestInternal::execDataPreprocessing(_deviceInputs);
@@ -180,8 +286,15 @@ void CudaInferRequest::inferPreprocess() {
             network_input_blobs_[inputName] = _deviceInputs[inputName];
         }
     }
+    device_side_inputs_.clear();
+    device_side_outputs_.clear();
     for (auto&& networkInput : network_input_blobs_) {
         auto inputName = networkInput.first;
+        if (networkInput.second->is<InferenceEngine::RemoteBlob>()) {
+            // Remote blobs already hold device memory; rmap() below exposes the raw
+            // device pointer and ParameterOp performs a device-to-device copy
+            device_side_inputs_.emplace(inputName);
+        }
         auto index = _executableNetwork->input_index_.at(networkInput.first);
         const auto& parameter = _executableNetwork->function_->get_parameters().at(index);
         auto parameterShape = networkInput.second->getTensorDesc().getDims();
@@ -241,20 +354,33 @@ void CudaInferRequest::inferPreprocess() {
             }
         }
     }
+    device_converted_outputs_.clear();
     for (auto&& output : _outputs) {
         auto outputBlob = output.second;
         auto networkOutput = network_output_blobs_.at(output.first);
         auto index = _executableNetwork->output_index_.at(output.first);
+        const auto& result = _executableNetwork->function_->get_results()[index];
+        auto resultType = result->get_element_type();
         if (outputBlob->getTensorDesc().getPrecision() == networkOutput->getTensorDesc().getPrecision()) {
             networkOutput = outputBlob;
+        } else if (!result->get_output_partial_shape(0).is_dynamic() &&
+                   canConvertOutputOnDevice(networkOutput, outputBlob)) {
+            // Wrap the user blob with its own precision: ResultOp converts on the
+            // GPU and the download already moves the target type, so the host
+            // conversion loop in inferPostprocess() is skipped
+            networkOutput = outputBlob;
+            resultType = InferenceEngine::details::convertPrecision(outputBlob->getTensorDesc().getPrecision());
+            device_converted_outputs_.emplace(output.first);
+        }
+        if (networkOutput->is<InferenceEngine::RemoteBlob>()) {
+            // ResultOp writes straight into the remote blob's device memory
+            device_side_outputs_.emplace(output.first);
         }
-        const auto& result = _executableNetwork->function_->get_results()[index];
         if (result->get_output_partial_shape(0).is_dynamic()) {
             output_tensors_.at(index) = std::make_shared<ngraph::HostTensor>();
             continue;
         }
         const auto& resultShape = result->get_shape();
-        const auto& resultType = result->get_element_type();
         output_tensors_.at(index) = std::make_shared<ngraph::HostTensor>(
             resultType,
             resultShape,
@@ -266,10 +392,26 @@ void CudaInferRequest::inferPreprocess() {
 }
 
 void CudaInferRequest::startPipeline(const ThreadContext& threadContext) {
+    if (profile_request_) {
+        profile_request_->startPipeline(threadContext);
+        // The delegate submits on the same stream, so the event recorded here
+        // still covers the whole pipeline of this frame
+        publishChainSubmission(threadContext);
+        return;
+    }
     try {
         OV_ITT_SCOPED_TASK(itt::domains::nvidia_gpu, _profilingTask[Profiler::StartPipeline])
+        itt::ScopedNvtxRange nvtx_range{"CudaInferRequest::startPipeline"};
         profiler_.StartStage();
-        memory_proxy_ = _executableNetwork->memory_pool_->WaitAndGet(cancellation_token_);
+        // Chain on the device: wait for every producer's frame to be submitted,
+        // then make this request's stream wait on the event recorded behind it
+        for (auto& link : chained_producers_) {
+            link.request->waitChainSubmission(link.consumed_frames).wait(threadContext.stream());
+        }
+        const auto wait_start = Profiler::Time::now();
+        memory_proxy_ = _executableNetwork->memory_pool_->WaitAndGet(cancellation_token_, priority_);
+        pipeline_start_ = Profiler::Time::now();
+        queue_wait_us_ = Profiler::Duration{pipeline_start_ - wait_start}.count();
         auto& memory = memory_proxy_->Get();
         auto& graph = *_executableNetwork->graph_;
         InferenceRequestContext inferRequestContext{input_tensors_,
@@ -280,7 +422,31 @@ void CudaInferRequest::startPipeline(const ThreadContext& threadContext) {
                                                     cancellation_token_,
                                                     profiler_,
                                                     is_benchmark_mode_};
+        inferRequestContext.setDeviceBlobNames(&device_side_inputs_, &device_side_outputs_);
+        inferRequestContext.setOutputROIs(&output_roi_elements_);
+        inferRequestContext.setRandomSequenceCounter(&random_sequence_);
+        if (batch_size_ > 0) {
+            inferRequestContext.setBatchSize(static_cast<std::size_t>(batch_size_),
+                                             _executableNetwork->max_batch_size_);
+        }
         graph.Run(inferRequestContext, memory);
+        publishChainSubmission(threadContext);
+        // Enqueue host callbacks behind all submitted work so waitPipeline() can block on a
+        // plain future and the scarce CudaThreadPool thread is released immediately
+        pipeline_thread_context_ = &threadContext;
+        pipeline_completion_ = std::make_shared<PipelineCompletion>();
+        pipeline_done_ = pipeline_completion_->promise.get_future();
+        try {
+            for (const CUDA::Stream* stream : {&threadContext.stream(), &threadContext.downloadStream()}) {
+                auto holder = std::make_unique<std::shared_ptr<PipelineCompletion>>(pipeline_completion_);
+                CUDA::throwIfError(::cudaLaunchHostFunc(stream->get(), signalPipelineStageDone, holder.get()));
+                holder.release();  // owned by the callback from now on
+            }
+        } catch (...) {
+            // Callbacks could not be enqueued; waitPipeline() falls back to stream synchronization
+            pipeline_completion_.reset();
+            pipeline_done_ = {};
+        }
         profiler_.StopStage(Profiler::StartPipeline);
     } catch (...) {
         // TODO:
@@ -290,18 +456,49 @@ void CudaInferRequest::startPipeline(const ThreadContext& threadContext) {
     }
 }
 
-void CudaInferRequest::waitPipeline(const ThreadContext& threadContext) {
+void CudaInferRequest::waitPipeline() {
+    if (profile_request_) {
+        profile_request_->waitPipeline();
+        return;
+    }
     OV_ITT_SCOPED_TASK(itt::domains::nvidia_gpu, _profilingTask[Profiler::WaitPipeline])
+    itt::ScopedNvtxRange nvtx_range{"CudaInferRequest::waitPipeline"};
     cancellation_token_.Check();
     profiler_.StartStage();
-    // TODO: probably all time will be spent in synchonize, out of reach of ThrowIfCanceled
-    threadContext.stream().synchronize();
+    if (pipeline_done_.valid()) {
+        // Blocking on the future occupies an ordinary CPU-task thread, not one of the few
+        // CudaThreadPool threads, so the number of in-flight requests isn't limited by the
+        // pool size
+        pipeline_done_.wait();
+        pipeline_done_ = {};
+        pipeline_completion_.reset();
+        // Surface asynchronous execution errors the same way stream synchronization would;
+        // cudaErrorNotReady just means the next request already enqueued work on the stream
+        for (const CUDA::Stream* stream :
+             {&pipeline_thread_context_->stream(), &pipeline_thread_context_->downloadStream()}) {
+            const auto err = ::cudaStreamQuery(stream->get());
+            if (err != cudaSuccess && err != cudaErrorNotReady) {
+                CUDA::throwIfError(err);
+            }
+        }
+    } else if (pipeline_thread_context_) {
+        // TODO: probably all time will be spent in synchonize, out of reach of ThrowIfCanceled
+        pipeline_thread_context_->stream().synchronize();
+        // Output copies are enqueued on the dedicated download stream
+        pipeline_thread_context_->downloadStream().synchronize();
+    }
     memory_proxy_.reset();
+    busy_us_ = Profiler::Duration{Profiler::Time::now() - pipeline_start_}.count();
     profiler_.StopStage(Profiler::WaitPipeline);
 }
 
 void CudaInferRequest::inferPostprocess() {
+    if (profile_request_) {
+        profile_request_->inferPostprocess();
+        return;
+    }
     OV_ITT_SCOPED_TASK(itt::domains::nvidia_gpu, _profilingTask[Profiler::Postprocess]);
+    itt::ScopedNvtxRange nvtx_range{"CudaInferRequest::inferPostprocess"};
     cancellation_token_.Check();
     profiler_.StartStage();
     for (auto&& output : _outputs) {
@@ -314,7 +511,9 @@ void CudaInferRequest::inferPostprocess() {
         auto outputBlob = _outputs.at(output.first);
         auto networkOutput = network_output_blobs_[output.first];
         if (outputBlob->getTensorDesc().getPrecision() != networkOutput->getTensorDesc().getPrecision()) {
-            convertPrecision(networkOutput, outputBlob);
+            if (device_converted_outputs_.count(output.first) == 0) {
+                convertPrecision(networkOutput, outputBlob);
+            }
         } else if (result->get_output_partial_shape(0).is_dynamic()) {
             auto tensor = output_tensors_[_executableNetwork->output_index_.at(output.first)];
             tensor->read(InferenceEngine::as<InferenceEngine::MemoryBlob>(outputBlob)->wmap().as<char*>(),
@@ -323,15 +522,119 @@ void CudaInferRequest::inferPostprocess() {
     }
     profiler_.StopStage(Profiler::Postprocess);
     profiler_.ProcessEvents();
+    _executableNetwork->latency_metrics_->RecordInference(
+        Profiler::Duration{Profiler::Time::now() - infer_start_}.count(), queue_wait_us_, busy_us_);
+    utils::EventCounters::add(utils::EventCounters::instance().infer_requests_completed);
 }
 
 void CudaInferRequest::Cancel() {
+    if (profile_request_) {
+        profile_request_->Cancel();
+        return;
+    }
     cancellation_token_.Cancel();
     _executableNetwork->memory_pool_->Interrupt();
 }
 
+void CudaInferRequest::SetBatch(int batch) {
+    const auto max_batch = _executableNetwork->max_batch_size_;
+    if (max_batch == 0) {
+        throwIEException(
+            "Dynamic batch is not enabled for this network; compile it with a dynamic batch "
+            "dimension or KEY_DYN_BATCH_ENABLED");
+    }
+    if (batch < 1 || static_cast<std::size_t>(batch) > max_batch) {
+        throwIEException(
+            fmt::format("Batch {} is out of the compiled range [1..{}]", batch, max_batch));
+    }
+    batch_size_ = batch;
+}
+
+void CudaInferRequest::SetOutputROI(const std::string& name, std::size_t num_elements) {
+    const auto index = _executableNetwork->output_index_.find(name);
+    if (index == _executableNetwork->output_index_.end()) {
+        throwIEException(fmt::format("Failed to set output ROI. {} output is not found", name));
+    }
+    const auto& result = _executableNetwork->function_->get_results()[index->second];
+    if (result->get_output_partial_shape(0).is_dynamic()) {
+        throwIEException(
+            fmt::format("Output ROI is not supported for dynamic output {}; its size is only "
+                        "known after inference",
+                        name));
+    }
+    const auto total = ov::shape_size(result->get_output_shape(0));
+    if (num_elements > total) {
+        throwIEException(
+            fmt::format("Output ROI of {} elements exceeds the {} elements of output {}", num_elements, total, name));
+    }
+    if (num_elements == 0 || num_elements == total) {
+        output_roi_elements_.erase(name);
+    } else {
+        output_roi_elements_[name] = num_elements;
+    }
+    // A shape-profile delegate runs the pipeline on its own context
+    if (profile_request_) {
+        profile_request_->SetOutputROI(name, num_elements);
+    }
+}
+
+void CudaInferRequest::ChainAfter(const CudaInferRequest::Ptr& producer) {
+    if (!producer) {
+        chained_producers_.clear();
+        if (profile_request_) {
+            profile_request_->ChainAfter(nullptr);
+        }
+        return;
+    }
+    if (producer.get() == this) {
+        throwIEException("Failed to chain an infer request after itself");
+    }
+    if (producer->_executableNetwork->cfg_.deviceId != _executableNetwork->cfg_.deviceId) {
+        throwIEException(
+            fmt::format("Failed to chain infer requests: producer runs on device {} while consumer runs on device {}",
+                        producer->_executableNetwork->cfg_.deviceId,
+                        _executableNetwork->cfg_.deviceId));
+    }
+    producer->chain_tracking_ = true;
+    const auto already_chained = std::any_of(chained_producers_.begin(),
+                                             chained_producers_.end(),
+                                             [&producer](const auto& link) { return link.request == producer; });
+    if (!already_chained) {
+        chained_producers_.push_back({producer});
+    }
+    // A shape-profile delegate runs the pipeline on its own context
+    if (profile_request_) {
+        profile_request_->ChainAfter(producer);
+    }
+}
+
+const CUDA::Event& CudaInferRequest::waitChainSubmission(std::uint64_t& consumed_frames) {
+    std::unique_lock<std::mutex> lock{chain_mutex_};
+    chain_cv_.wait(lock, [&] { return chain_submitted_frames_ > consumed_frames; });
+    consumed_frames = chain_submitted_frames_;
+    return *chain_event_;
+}
+
+void CudaInferRequest::publishChainSubmission(const ThreadContext& threadContext) {
+    if (!chain_tracking_) {
+        return;
+    }
+    // Publish this frame's device work to chained consumers; the event is
+    // created lazily here so it belongs to the pipeline's device context
+    std::lock_guard<std::mutex> lock{chain_mutex_};
+    if (!chain_event_) {
+        chain_event_.emplace();
+    }
+    chain_event_->record(threadContext.stream());
+    ++chain_submitted_frames_;
+    chain_cv_.notify_all();
+}
+
 InferenceEngine::Blob::Ptr CudaInferRequest::GetBlob(const std::string& name) {
     OV_ITT_SCOPED_TASK(itt::domains::nvidia_gpu, "GetBlob");
+    if (profile_request_) {
+        return profile_request_->GetBlob(name);
+    }
     InputInfo::Ptr foundInput;
     DataPtr foundOutput;
     Blob::Ptr data;
@@ -364,7 +667,8 @@ InferenceEngine::Blob::Ptr CudaInferRequest::GetBlob(const std::string& name) {
                 if (deviceInputDescr.getPrecision() != networkPrecision) {
                     Blob::Ptr networkBlob;
                     networkBlob = make_blob_with_precision(
-                        {networkPrecision, inputDescr.getDims(), TensorDesc::getLayoutByDims(inputDescr.getDims())});
+                        {networkPrecision, inputDescr.getDims(), TensorDesc::getLayoutByDims(inputDescr.getDims())},
+                        PinnedHostAllocator::instance());
                     networkBlob->allocate();
                     network_input_blobs_[name] = networkBlob;
                 }
@@ -413,12 +717,67 @@ InferenceEngine::Blob::Ptr CudaInferRequest::GetBlob(const std::string& name) {
     return data;
 }
 
+void CudaInferRequest::updateShapeProfile() {
+    if (reshaped_inputs_.empty()) {
+        profile_request_.reset();
+        return;
+    }
+    std::map<std::string, SizeVector> shapes;
+    for (const auto& [inputName, info] : _networkInputs) {
+        const auto reshaped = reshaped_inputs_.find(inputName);
+        shapes.emplace(inputName,
+                       reshaped != reshaped_inputs_.end() ? reshaped->second : info->getTensorDesc().getDims());
+    }
+    auto profile = _executableNetwork->GetShapeProfile(shapes);
+    if (profile_request_ && profile_request_->_executableNetwork == profile) {
+        return;
+    }
+    profile_request_ = std::static_pointer_cast<CudaInferRequest>(
+        profile->CreateInferRequestImpl(profile->_networkInputs, profile->_networkOutputs));
+    // Replay the inputs already set on this request so the delegate starts from the
+    // same state; outputs are not replayed since their dimensions changed with the
+    // reshape and the delegate allocates its own
+    for (const auto& [blobName, blob] : profile_user_blobs_) {
+        profile_request_->SetBlob(blobName, blob);
+    }
+    for (const auto& link : chained_producers_) {
+        profile_request_->ChainAfter(link.request);
+    }
+}
+
 void CudaInferRequest::SetBlob(const std::string& name, const InferenceEngine::Blob::Ptr& userBlob) {
     OV_ITT_SCOPED_TASK(itt::domains::nvidia_gpu, "SetBlob");
     if (name.empty()) {
         IE_THROW(NotFound) << "Failed to set blob with empty name";
     }
     if (!userBlob) IE_THROW(NotAllocated) << "Failed to set empty blob with name: \'" << name << "\'";
+#ifdef NDEBUG
+    // Fast path: a blob whose descriptor matches one this request has already
+    // validated under the same name rebinds with a pointer swap. Serving
+    // layers call SetBlob per request per input with identical descriptors,
+    // so the precision/layout checks and the conversion-blob decisions from
+    // the first call still hold. Debug builds skip this and re-validate every
+    // call through the full path below.
+    if (!profile_request_ && !userBlob->is<CompoundBlob>() && !userBlob->is<RemoteBlob>() &&
+        userBlob->buffer() != nullptr) {
+        if (const auto validated = validated_input_bindings_.find(name);
+            validated != validated_input_bindings_.end() && userBlob->getTensorDesc() == validated->second) {
+            user_blob_pinner_.pin(userBlob);
+            _inputs[name] = userBlob;
+            _deviceInputs[name] = userBlob;
+            // Kept for replay in case a later reshape creates a profile delegate
+            profile_user_blobs_[name] = userBlob;
+            _batched_inputs.erase(name);
+            return;
+        }
+        if (const auto validated = validated_output_bindings_.find(name);
+            validated != validated_output_bindings_.end() && userBlob->getTensorDesc() == validated->second) {
+            user_blob_pinner_.pin(userBlob);
+            _outputs[name] = userBlob;
+            return;
+        }
+    }
+#endif
     InputInfo::Ptr foundInput;
     DataPtr foundOutput;
     auto has_zeros = [](const SizeVector& vec) {
@@ -444,6 +803,28 @@ void CudaInferRequest::SetBlob(const std::string& name, const InferenceEngine::B
                 << "Failed to set Blob with precision not corresponding to user input precision";
         }
 
+        if (!input_dynamic && !compoundBlobPassed && !remoteBlobPassed) {
+            // An input set with other static dimensions switches this request to the
+            // network profile compiled for the resulting shape set instead of failing
+            // the size check below
+            const auto& userDims = userBlob->getTensorDesc().getDims();
+            if (userDims != foundInput->getTensorDesc().getDims()) {
+                reshaped_inputs_[name] = userDims;
+            } else {
+                reshaped_inputs_.erase(name);
+            }
+            profile_user_blobs_[name] = userBlob;
+            updateShapeProfile();
+        }
+        if (profile_request_) {
+            profile_request_->SetBlob(name, userBlob);
+            // Blobs that also fit the compiled dimensions fall through so this
+            // request stays consistent if all inputs later return to them
+            if (reshaped_inputs_.count(name)) {
+                return;
+            }
+        }
+
         auto& devBlob = _deviceInputs[name];
         auto usrDims = userBlob->getTensorDesc().getDims();
         auto usrLayout = userBlob->getTensorDesc().getLayout();
@@ -451,7 +832,8 @@ void CudaInferRequest::SetBlob(const std::string& name, const InferenceEngine::B
         auto devLayout = devBlob->getTensorDesc().getLayout();
         auto devPrecision = devBlob->getTensorDesc().getPrecision();
         if (input_dynamic && (devDims != usrDims || devLayout != usrLayout)) {
-            devBlob = make_blob_with_precision({devPrecision, usrDims, TensorDesc::getLayoutByDims(usrDims)});
+            devBlob = make_blob_with_precision({devPrecision, usrDims, TensorDesc::getLayoutByDims(usrDims)},
+                                               PinnedHostAllocator::instance());
             devBlob->allocate();
             _deviceInputs[name] = devBlob;
         }
@@ -472,12 +854,25 @@ void CudaInferRequest::SetBlob(const std::string& name, const InferenceEngine::B
             }
             _inputs[name] = userBlob;
             devBlob = userBlob;
+            if (!remoteBlobPassed) {
+                // The pipeline uploads straight from this blob, so pageable
+                // memory would put every inference on the slow copy path
+                user_blob_pinner_.pin(userBlob);
+            }
+            // A plain swap was enough, so an identical rebind can skip the checks
+            if (!input_dynamic && !remoteBlobPassed && !profile_request_) {
+                validated_input_bindings_[name] = userBlob->getTensorDesc();
+            }
         }
         _batched_inputs.erase(name);
     } else {
         if (compoundBlobPassed) {
             IE_THROW(NotImplemented) << "cannot set compound blob: supported only for input pre-processing";
         }
+        if (profile_request_) {
+            profile_request_->SetBlob(name, userBlob);
+            return;
+        }
         auto& devBlob = network_output_blobs_[name];
         auto usrDims = userBlob->getTensorDesc().getDims();
         auto usrLayout = userBlob->getTensorDesc().getLayout();
@@ -485,7 +880,8 @@ void CudaInferRequest::SetBlob(const std::string& name, const InferenceEngine::B
         auto devLayout = devBlob->getTensorDesc().getLayout();
         auto devPrecision = devBlob->getTensorDesc().getPrecision();
         if (output_dynamic && (devDims != usrDims || devLayout != usrLayout)) {
-            devBlob = make_blob_with_precision({devPrecision, usrDims, TensorDesc::getLayoutByDims(usrDims)});
+            devBlob = make_blob_with_precision({devPrecision, usrDims, TensorDesc::getLayoutByDims(usrDims)},
+                                               PinnedHostAllocator::instance());
             devBlob->allocate();
             network_output_blobs_[name] = devBlob;
         }
@@ -501,6 +897,12 @@ void CudaInferRequest::SetBlob(const std::string& name, const InferenceEngine::B
                 << "Failed to set Blob with precision not corresponding to user output precision";
         }
         _outputs[name] = userBlob;
+        if (!remoteBlobPassed) {
+            user_blob_pinner_.pin(userBlob);
+        }
+        if (!output_dynamic && !remoteBlobPassed) {
+            validated_output_bindings_[name] = userBlob->getTensorDesc();
+        }
     }
 }
 
@@ -530,7 +932,12 @@ constexpr InferenceEngine::InferenceEngineProfileInfo makeProfileInfo(long long
     return InferenceEngineProfileInfo{InferenceEngineProfileInfo::EXECUTED, realTime_uSec, cpuTime_uSec};
 }
 
-Profiler::PerformaceCounters CudaInferRequest::GetPerformanceCounts() const { return profiler_.GetPerformanceCounts(); }
+Profiler::PerformaceCounters CudaInferRequest::GetPerformanceCounts() const {
+    if (profile_request_) {
+        return profile_request_->GetPerformanceCounts();
+    }
+    return profiler_.GetPerformanceCounts();
+}
 
 std::shared_ptr<ExecutableNetwork> CudaInferRequest::GetExecNetwork() { return _executableNetwork; }
 
@@ -538,24 +945,25 @@ InferenceEngine::Blob::Ptr CudaInferRequest::allocateBlob(const std::vector<std:
                                                           InferenceEngine::Precision precision,
                                                           InferenceEngine::Layout layout) {
     Blob::Ptr blob;
+    const auto allocator = PinnedHostAllocator::instance();
     switch (precision) {
         case Precision::FP16:
-            blob = InferenceEngine::make_shared_blob<std::uint16_t>({Precision::FP16, shape, layout});
+            blob = InferenceEngine::make_shared_blob<std::uint16_t>({Precision::FP16, shape, layout}, allocator);
             break;
         case Precision::FP32:
-            blob = InferenceEngine::make_shared_blob<float>({Precision::FP32, shape, layout});
+            blob = InferenceEngine::make_shared_blob<float>({Precision::FP32, shape, layout}, allocator);
             break;
         case Precision::I16:
-            blob = InferenceEngine::make_shared_blob<std::int16_t>({Precision::I16, shape, layout});
+            blob = InferenceEngine::make_shared_blob<std::int16_t>({Precision::I16, shape, layout}, allocator);
             break;
         case Precision::I32:
-            blob = InferenceEngine::make_shared_blob<std::int32_t>({Precision::I32, shape, layout});
+            blob = InferenceEngine::make_shared_blob<std::int32_t>({Precision::I32, shape, layout}, allocator);
             break;
         case Precision::U8:
-            blob = InferenceEngine::make_shared_blob<uint8_t>({Precision::U8, shape, layout});
+            blob = InferenceEngine::make_shared_blob<uint8_t>({Precision::U8, shape, layout}, allocator);
             break;
         case Precision::BOOL:
-            blob = InferenceEngine::make_shared_blob<std::uint8_t>({Precision::BOOL, shape, layout});
+            blob = InferenceEngine::make_shared_blob<std::uint8_t>({Precision::BOOL, shape, layout}, allocator);
             break;
         default:
             throwIEException(fmt::format("Cuda Plugin: Unsupported Input/Output Precision {}", precision));
@@ -585,6 +993,23 @@ InferenceEngine::Precision::ePrecision CudaInferRequest::convertType(ov::element
     }
 }
 
+bool CudaInferRequest::canConvertOutputOnDevice(const Blob::Ptr& networkOutput, const Blob::Ptr& outputBlob) {
+    if (outputBlob->is<InferenceEngine::RemoteBlob>() ||
+        !InferenceEngine::as<InferenceEngine::MemoryBlob>(outputBlob)) {
+        return false;
+    }
+    const auto supported = [](ov::element::Type_t type) {
+        // Mirrors the element types handled by kernel::Convert (see ConvertOp)
+        return type >= ov::element::Type_t::boolean && type <= ov::element::Type_t::u64 &&
+               type != ov::element::Type_t::u1;
+    };
+    const ov::element::Type src =
+        InferenceEngine::details::convertPrecision(networkOutput->getTensorDesc().getPrecision());
+    const ov::element::Type dst = InferenceEngine::details::convertPrecision(outputBlob->getTensorDesc().getPrecision());
+    // Only narrowing conversions pay off: the device-to-host copy must not grow
+    return supported(src) && supported(dst) && src != dst && dst.size() <= src.size();
+}
+
 template <typename SrcT, typename DstT>
 void CudaInferRequest::convertPrecision(const Blob::Ptr& src, const Blob::Ptr& dst) {
     std::copy_n(InferenceEngine::as<InferenceEngine::MemoryBlob>(src)->rmap().as<const SrcT*>(),
@@ -6,21 +6,28 @@
 
 #include <atomic>
 #include <chrono>
+#include <condition_variable>
 #include <cpp_interfaces/interface/ie_iinfer_request_internal.hpp>
+#include <cuda/event.hpp>
+#include <future>
+#include <list>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <ngraph/runtime/tensor.hpp>
 #include <openvino/itt.hpp>
 #include <optional>
 #include <string>
 #include <threading/ie_itask_executor.hpp>
 #include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 #include "cancellation_token.hpp"
 #include "cuda_config.hpp"
 #include "cuda_operation_base.hpp"
 #include "cuda_profiler.hpp"
+#include "cuda_request_priority.hpp"
 #include "memory_manager/cuda_memory_manager.hpp"
 #include "memory_manager/cuda_memory_pool.hpp"
 #include "utils/perf_timing.hpp"
@@ -29,6 +36,49 @@ namespace ov {
 namespace nvidia_gpu {
 
 class ExecutableNetwork;
+struct PipelineCompletion;
+
+/**
+ * @brief Transparently pins caller-owned host blobs bound via SetBlob().
+ *
+ * Application blobs usually live in pageable memory, so their transfers take
+ * the slow driver bounce-buffer path while blobs from PinnedHostAllocator DMA
+ * directly. On first use of an external blob its pages are registered with
+ * cudaHostRegister, and the registration is kept in a most-recently-used-first
+ * list so steady-state serving with a stable set of caller buffers pays the
+ * (expensive) registration once. Entries hold a reference to their blob, so
+ * the pages stay valid until un-registration; regions that are too small, are
+ * already pinned, or failed to register are memoized and not probed again.
+ */
+class UserBlobPinner {
+public:
+    UserBlobPinner() = default;
+    UserBlobPinner(const UserBlobPinner&) = delete;
+    UserBlobPinner& operator=(const UserBlobPinner&) = delete;
+    ~UserBlobPinner();
+
+    /** Pins the blob's memory if it is pageable and large enough to benefit */
+    void pin(const InferenceEngine::Blob::Ptr& userBlob);
+
+private:
+    /** One probed user memory region; blob is held only while its pages are registered */
+    struct Region {
+        void* ptr;
+        std::size_t size;
+        bool registered;
+        InferenceEngine::Blob::Ptr blob;
+    };
+
+    // Pinning has a fixed per-call cost in the driver, so small blobs are
+    // cheaper to copy through the bounce buffer
+    static constexpr std::size_t kMinBytesToPin = std::size_t{1} << 20;
+    // Budget of pages locked per request; the least recently used registration
+    // is released when a new one would exceed it
+    static constexpr std::size_t kMaxPinnedBytes = std::size_t{256} << 20;
+
+    std::list<Region> regions_;
+    std::size_t pinned_bytes_ = 0;
+};
 
 // ! [infer_request:header]
 class CudaInferRequest : public InferenceEngine::IInferRequestInternal {
@@ -51,12 +101,42 @@ public:
     // executor
     void inferPreprocess();
     void startPipeline(const ThreadContext& threadContext);
-    void waitPipeline(const ThreadContext& threadContext);
+    void waitPipeline();
     void inferPostprocess();
     /**
      * Cancel InferRequest
      */
     void Cancel() override;
+    /**
+     * Selects how many leading samples of the compiled batch this request processes;
+     * requires the network to be compiled with dynamic batch (a dynamic batch
+     * dimension or KEY_DYN_BATCH_ENABLED)
+     */
+    void SetBatch(int batch) override;
+    /**
+     * Restricts the device-to-host copy of the named output to its first
+     * @p num_elements elements (e.g. the class scores a top-1 service reads);
+     * 0 restores the full transfer. GetBlob() still returns the full blob,
+     * but its bytes past the registered region are undefined
+     */
+    void SetOutputROI(const std::string& name, std::size_t num_elements);
+    /**
+     * Chains this request after @p producer living on the same device. With the
+     * producer's outputs bound to this request's inputs through remote
+     * (device-resident) blobs, the data already stays on the GPU; chaining
+     * additionally replaces the host synchronization between the stages with a
+     * CUDA event dependency, so an ensemble such as detector->classifier runs
+     * back to back on the device. The producer must be submitted before this
+     * request for every frame; an empty pointer removes all chaining
+     */
+    void ChainAfter(const CudaInferRequest::Ptr& producer);
+    /**
+     * Assigns the scheduling class this request competes with on the shared
+     * worker threads and the MemoryPool of its ExecutableNetwork; see
+     * RequestPriority. Takes effect from the next StartAsync()
+     */
+    void SetPriority(const RequestPriority& priority) { priority_ = priority; }
+    const RequestPriority& GetPriority() const { return priority_; }
 
 private:
     void createInferRequest();
@@ -85,6 +165,29 @@ private:
      */
     template <typename SrcT, typename DstT>
     static void convertPrecision(const InferenceEngine::Blob::Ptr& src, const InferenceEngine::Blob::Ptr& dst);
+    /**
+     * Whether ResultOp can convert the output to the user precision on the device,
+     * so the device-to-host copy already moves the (smaller) target type
+     */
+    static bool canConvertOutputOnDevice(const InferenceEngine::Blob::Ptr& networkOutput,
+                                         const InferenceEngine::Blob::Ptr& outputBlob);
+    /**
+     * Re-points this request at the network shape profile matching reshaped_inputs_,
+     * or back at the base network when every input is back at the compiled
+     * dimensions; pipeline stages and blob accesses are delegated while a profile
+     * request is set
+     */
+    void updateShapeProfile();
+    /**
+     * Blocks until a pipeline newer than @p consumed_frames has been submitted
+     * on this request and returns the event recorded behind its device work.
+     * Only the enqueue of the producer pipeline is awaited, not its execution,
+     * so the rendezvous costs microseconds
+     */
+    const CUDA::Event& waitChainSubmission(std::uint64_t& consumed_frames);
+    /** Records the chain event behind the submitted pipeline and wakes the
+     * consumers rendezvousing in waitChainSubmission() */
+    void publishChainSubmission(const ThreadContext& threadContext);
 
     std::shared_ptr<ExecutableNetwork> _executableNetwork;
     std::array<openvino::itt::handle_t, Profiler::NumOfStages> _profilingTask;
@@ -100,11 +203,71 @@ private:
     InferenceEngine::BlobMap network_output_blobs_;
 
     std::optional<MemoryPool::Proxy> memory_proxy_;
+    /**
+     * Host-side completion state signalled by cudaLaunchHostFunc callbacks enqueued at the
+     * end of startPipeline(). waitPipeline() blocks on @pipeline_done_ instead of
+     * synchronizing the streams, so the waiter doesn't have to be a CudaThreadPool thread.
+     */
+    std::shared_ptr<PipelineCompletion> pipeline_completion_;
+    std::future<void> pipeline_done_;
+    const ThreadContext* pipeline_thread_context_ = nullptr;
     CancellationToken cancellation_token_;
     Profiler profiler_;
     std::vector<std::shared_ptr<ngraph::runtime::Tensor>> input_tensors_;
     std::vector<std::shared_ptr<ngraph::runtime::Tensor>> output_tensors_;
+    // Names of blobs backed by remote (device-resident) memory in the current
+    // inference; Parameter/Result operations then copy device-to-device
+    std::unordered_set<std::string> device_side_inputs_;
+    std::unordered_set<std::string> device_side_outputs_;
+    // Outputs whose precision conversion happened on the GPU in ResultOp;
+    // inferPostprocess() must not convert them again on the host
+    std::unordered_set<std::string> device_converted_outputs_;
+    // Delegate serving this request while some input is set with other static
+    // dimensions; created from the matching shape profile of the network
+    CudaInferRequest::Ptr profile_request_;
+    // Inputs currently set with dimensions differing from the compiled ones
+    std::map<std::string, InferenceEngine::SizeVector> reshaped_inputs_;
+    // Last user blob set for every input; replayed into a newly created profile
+    // delegate so it starts from the same state
+    std::map<std::string, InferenceEngine::Blob::Ptr> profile_user_blobs_;
+    // Descriptors accepted by a full SetBlob validation; a rebind with an
+    // identical descriptor takes the pointer-swap fast path in release builds
+    std::map<std::string, InferenceEngine::TensorDesc> validated_input_bindings_;
+    std::map<std::string, InferenceEngine::TensorDesc> validated_output_bindings_;
+    // Registrations of caller-owned pageable blobs, so their transfers run at
+    // pinned speed without the application changing its allocations
+    UserBlobPinner user_blob_pinner_;
+    // Runtime batch selected via SetBatch(); 0 processes the full compiled batch
+    int batch_size_ = 0;
+    // Leading slice (in elements) to download per output, selected via
+    // SetOutputROI(); outputs without an entry are transferred in full
+    std::map<std::string, std::size_t> output_roi_elements_;
+    // Next Philox sequence number random operations draw from; seeded with a
+    // per-request base in createInferRequest()
+    std::uint64_t random_sequence_ = 0;
+    // Producer side of request chaining: the event recorded behind every
+    // submitted pipeline and the submission counter consumers rendezvous on
+    std::mutex chain_mutex_;
+    std::condition_variable chain_cv_;
+    std::optional<CUDA::Event> chain_event_;
+    std::uint64_t chain_submitted_frames_ = 0;
+    std::atomic<bool> chain_tracking_{false};
+    // Consumer side: producers this request is chained after, each with the
+    // submission its device work last waited on
+    struct ChainedProducer {
+        CudaInferRequest::Ptr request;
+        std::uint64_t consumed_frames = 0;
+    };
+    std::vector<ChainedProducer> chained_producers_;
+    // Scheduling class for the thread pool and the MemoryPool waiter queue
+    RequestPriority priority_;
     bool is_benchmark_mode_;
+    // Timestamps feeding the network-wide LatencyMetrics recorder: full inference
+    // span, MemoryPool wait inside startPipeline() and pipeline busy time
+    Profiler::Time::time_point infer_start_{};
+    Profiler::Time::time_point pipeline_start_{};
+    float queue_wait_us_ = 0.0f;
+    float busy_us_ = 0.0f;
 };
 // ! [infer_request:header]
 
@@ -6,7 +6,9 @@
 
 #include <ie_blob.h>
 
+#include <cstdint>
 #include <memory_manager/cuda_device_mem_block.hpp>
+#include <unordered_set>
 
 #include "cancellation_token.hpp"
 #include "cuda_thread_context.hpp"
@@ -81,6 +83,64 @@ public:
     bool HasOutputBlob(const std::string& output_name) const noexcept {
         return outputs_mapping.find(output_name) != outputs_mapping.end();
     }
+    /**
+     * @brief Marks the named blobs as device-resident (backed by remote blobs), so
+     * Parameter/Result operations copy device-to-device instead of host round trips
+     */
+    void setDeviceBlobNames(const std::unordered_set<std::string>* deviceInputs,
+                            const std::unordered_set<std::string>* deviceOutputs) noexcept {
+        device_inputs_ = deviceInputs;
+        device_outputs_ = deviceOutputs;
+    }
+    /**
+     * @brief IsInputOnDevice(name) returns true if the input blob wraps device memory
+     */
+    bool IsInputOnDevice(const std::string& input_name) const noexcept {
+        return device_inputs_ && device_inputs_->count(input_name) > 0;
+    }
+    /**
+     * @brief IsOutputOnDevice(name) returns true if the output blob wraps device memory
+     */
+    bool IsOutputOnDevice(const std::string& output_name) const noexcept {
+        return device_outputs_ && device_outputs_->count(output_name) > 0;
+    }
+    /**
+     * @brief Registers the per-output leading slices (in elements) selected via
+     * CudaInferRequest::SetOutputROI(); Result operations trim their
+     * device-to-host copy accordingly
+     */
+    void setOutputROIs(const std::map<std::string, std::size_t>* rois) noexcept { output_rois_ = rois; }
+    /** Leading elements to download for the named output; 0 means the full tensor */
+    [[nodiscard]] std::size_t outputROIElements(const std::string& output_name) const noexcept {
+        if (!output_rois_) {
+            return 0;
+        }
+        const auto roi = output_rois_->find(output_name);
+        return roi != output_rois_->end() ? roi->second : 0;
+    }
+    /**
+     * @brief Sets the batch actually processed by this request together with the batch
+     * the network was compiled for; operations whose leading dimension equals the
+     * compiled batch may restrict their work to the first @p batch samples
+     */
+    void setBatchSize(std::size_t batch, std::size_t max_batch) noexcept {
+        batch_size_ = batch;
+        max_batch_size_ = max_batch;
+    }
+    /** Runtime batch of this request; 0 means the full compiled batch */
+    [[nodiscard]] std::size_t getBatchSize() const noexcept { return batch_size_; }
+    /** Batch the network was compiled for; 0 when dynamic batch is disabled */
+    [[nodiscard]] std::size_t maxBatchSize() const noexcept { return max_batch_size_; }
+    /**
+     * @brief Attaches the per-request Philox sequence counter; random operations
+     * draw a fresh number from it on every execution, so stochastic passes differ
+     * without any shared generator state between requests
+     */
+    void setRandomSequenceCounter(std::uint64_t* counter) noexcept { random_sequence_counter_ = counter; }
+    /** Next Philox sequence number of this request; monotonic, never reused */
+    [[nodiscard]] std::uint64_t nextRandomSequence() const noexcept {
+        return random_sequence_counter_ ? (*random_sequence_counter_)++ : 0;
+    }
     const ThreadContext& getThreadContext() const noexcept { return threadContext; }
     [[nodiscard]] ov::nvidia_gpu::CancellationToken& getCancellationToken() const noexcept { return token; }
     [[nodiscard]] Profiler& getProfiler() const noexcept { return profiler; }
@@ -94,6 +154,12 @@ private:
     const std::map<std::string, std::size_t>& inputs_mapping;
     const std::vector<std::shared_ptr<ngraph::runtime::Tensor>>& blob_outputs;
     const std::map<std::string, std::size_t>& outputs_mapping;
+    const std::unordered_set<std::string>* device_inputs_ = nullptr;
+    const std::unordered_set<std::string>* device_outputs_ = nullptr;
+    const std::map<std::string, std::size_t>* output_rois_ = nullptr;
+    std::uint64_t* random_sequence_counter_ = nullptr;
+    std::size_t batch_size_ = 0;
+    std::size_t max_batch_size_ = 0;
     bool is_benchmark_mode_;
 };
 
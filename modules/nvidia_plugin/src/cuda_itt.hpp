@@ -11,12 +11,72 @@
 
 #include <openvino/itt.hpp>
 
+#include <cstdlib>
+#include <string>
+
+#if defined(__has_include)
+#if __has_include(<nvtx3/nvToolsExt.h>)
+#include <nvtx3/nvToolsExt.h>
+#define OV_NVIDIA_GPU_HAVE_NVTX 1
+#endif
+#endif
+
 namespace ov {
 namespace nvidia_gpu {
 namespace itt {
 namespace domains {
 OV_ITT_DOMAIN(nvidia_gpu);
 }
+
+/**
+ * True when NVTX range emission was requested through the OV_NVIDIA_GPU_ENABLE_NVTX
+ * environment variable. ITT tasks alone cannot be correlated with CUDA activity in
+ * Nsight Systems; the flag is read once per process so production binaries can be
+ * profiled by restarting them under the profiler, without a rebuild.
+ */
+inline bool nvtxEnabled() noexcept {
+#ifdef OV_NVIDIA_GPU_HAVE_NVTX
+    static const bool enabled = [] {
+        const char* env = std::getenv("OV_NVIDIA_GPU_ENABLE_NVTX");
+        return env != nullptr && env[0] != '\0' && env[0] != '0';
+    }();
+    return enabled;
+#else
+    return false;
+#endif
+}
+
+/**
+ * RAII NVTX range shown on the Nsight Systems timeline next to the CUDA activity
+ * it enqueued. A no-op unless nvtxEnabled(); emitted in addition to the ITT task
+ * of the same scope, not instead of it.
+ */
+class ScopedNvtxRange {
+public:
+    explicit ScopedNvtxRange(const char* name) : active_{nvtxEnabled()} {
+#ifdef OV_NVIDIA_GPU_HAVE_NVTX
+        if (active_) {
+            ::nvtxRangePushA(name);
+        }
+#else
+        (void)name;
+#endif
+    }
+    explicit ScopedNvtxRange(const std::string& name) : ScopedNvtxRange{name.c_str()} {}
+    ScopedNvtxRange(const ScopedNvtxRange&) = delete;
+    ScopedNvtxRange& operator=(const ScopedNvtxRange&) = delete;
+    ~ScopedNvtxRange() {
+#ifdef OV_NVIDIA_GPU_HAVE_NVTX
+        if (active_) {
+            ::nvtxRangePop();
+        }
+#endif
+    }
+
+private:
+    bool active_;
+};
+
 }  // namespace itt
 }  // namespace nvidia_gpu
 }  // namespace ov
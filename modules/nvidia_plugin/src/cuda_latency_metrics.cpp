@@ -0,0 +1,77 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "cuda_latency_metrics.hpp"
+
+#include <algorithm>
+#include <vector>
+
+namespace ov {
+namespace nvidia_gpu {
+
+namespace {
+
+std::int64_t nowUs() {
+    return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+float percentile(const std::vector<float>& sorted, double fraction) {
+    if (sorted.empty()) {
+        return 0.0f;
+    }
+    const auto index = static_cast<std::size_t>(fraction * (sorted.size() - 1));
+    return sorted[index];
+}
+
+}  // namespace
+
+void LatencyMetrics::RecordInference(float latencyUs, float queueWaitUs, float busyUs) noexcept {
+    const auto index = write_index_.fetch_add(1, std::memory_order_relaxed) & (kRingSize - 1);
+    auto& sample = ring_[index];
+    sample.latency_us.store(latencyUs, std::memory_order_relaxed);
+    sample.queue_wait_us.store(queueWaitUs, std::memory_order_relaxed);
+    sample.busy_us.store(busyUs, std::memory_order_relaxed);
+    sample.timestamp_us.store(nowUs(), std::memory_order_release);
+}
+
+LatencyMetrics::Aggregates LatencyMetrics::Aggregate(std::size_t numParallelPipelines) const {
+    std::vector<float> latencies;
+    latencies.reserve(kRingSize);
+    double queue_wait_sum = 0.0;
+    double busy_sum = 0.0;
+    std::int64_t oldest_timestamp = 0;
+    std::int64_t newest_timestamp = 0;
+    for (const auto& sample : ring_) {
+        const auto timestamp = sample.timestamp_us.load(std::memory_order_acquire);
+        if (timestamp == 0) {
+            continue;  // slot never written
+        }
+        latencies.push_back(sample.latency_us.load(std::memory_order_relaxed));
+        queue_wait_sum += sample.queue_wait_us.load(std::memory_order_relaxed);
+        busy_sum += sample.busy_us.load(std::memory_order_relaxed);
+        oldest_timestamp = oldest_timestamp == 0 ? timestamp : std::min(oldest_timestamp, timestamp);
+        newest_timestamp = std::max(newest_timestamp, timestamp);
+    }
+    std::sort(latencies.begin(), latencies.end());
+    Aggregates aggregates;
+    aggregates["sample_count"] = static_cast<float>(latencies.size());
+    aggregates["p50_latency_us"] = percentile(latencies, 0.50);
+    aggregates["p95_latency_us"] = percentile(latencies, 0.95);
+    aggregates["p99_latency_us"] = percentile(latencies, 0.99);
+    aggregates["max_latency_us"] = latencies.empty() ? 0.0f : latencies.back();
+    aggregates["avg_queue_wait_us"] =
+        latencies.empty() ? 0.0f : static_cast<float>(queue_wait_sum / latencies.size());
+    // Share of the ring's time window the pipelines spent busy; >1 cannot happen
+    // because a pipeline cannot be busier than wall time times their count
+    const auto window_us = newest_timestamp - oldest_timestamp;
+    aggregates["stream_occupancy"] =
+        (window_us > 0 && numParallelPipelines > 0)
+            ? std::min(1.0f, static_cast<float>(busy_sum / (static_cast<double>(window_us) * numParallelPipelines)))
+            : 0.0f;
+    return aggregates;
+}
+
+}  // namespace nvidia_gpu
+}  // namespace ov
@@ -0,0 +1,58 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <string>
+
+namespace ov {
+namespace nvidia_gpu {
+
+/**
+ * @brief Lock-free recorder of per-inference latency samples.
+ *
+ * Every finished inference stores its end-to-end latency, the time it spent
+ * waiting for a memory block in MemoryPool::WaitAndGet and the time its
+ * pipeline occupied a stream into a fixed-size ring buffer. Recording is a
+ * few relaxed atomic stores, so it stays enabled in production; aggregation
+ * walks the ring only when the metric is actually queried.
+ */
+class LatencyMetrics {
+public:
+    /** Map of aggregate name ("p50_latency_us", "avg_queue_wait_us", ...) to value */
+    using Aggregates = std::map<std::string, float>;
+
+    void RecordInference(float latencyUs, float queueWaitUs, float busyUs) noexcept;
+
+    /**
+     * Aggregates the samples currently held in the ring: p50/p95/p99/max of the
+     * end-to-end latency, average queue wait and the stream occupancy over the
+     * ring's time window given the number of parallel pipelines the network
+     * can run.
+     */
+    Aggregates Aggregate(std::size_t numParallelPipelines) const;
+
+private:
+    // Power of two so the write index wraps with a mask instead of a division
+    static constexpr std::size_t kRingSize = 1024;
+
+    struct Sample {
+        std::atomic<float> latency_us{0.0f};
+        std::atomic<float> queue_wait_us{0.0f};
+        std::atomic<float> busy_us{0.0f};
+        // steady_clock time of the record in microseconds; 0 marks an empty slot
+        std::atomic<std::int64_t> timestamp_us{0};
+    };
+
+    std::array<Sample, kRingSize> ring_{};
+    std::atomic<std::uint64_t> write_index_{0};
+};
+
+}  // namespace nvidia_gpu
+}  // namespace ov
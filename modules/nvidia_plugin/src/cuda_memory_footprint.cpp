@@ -0,0 +1,53 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "cuda_memory_footprint.hpp"
+
+#include <fmt/format.h>
+
+#include <cuda_op_buffers_extractor.hpp>
+#include <cuda_operation_registry.hpp>
+#include <error.hpp>
+#include <numeric>
+
+#include "ops/nop_op.hpp"
+
+namespace ov {
+namespace nvidia_gpu {
+
+MemoryFootprint estimateMemoryFootprint(const CreationContext& context, const std::shared_ptr<const ov::Model>& model) {
+    // Mirrors the front half of SubGraph::initExecuteSequence: operations are
+    // created only to ask them for their workbuffer demands, and the extractor
+    // runs the same solvers LoadNetwork would, but no DeviceMemBlock is built
+    const auto orderedNodes = OperationBuffersExtractor::scheduleForMinimalPeakMemory(model->get_ordered_ops());
+    OperationBuffersExtractor opBuffersExtractor{orderedNodes};
+    MemoryFootprint footprint{};
+    for (unsigned node_idx = 0; node_idx < orderedNodes.size(); ++node_idx) {
+        const auto& node = orderedNodes[node_idx];
+        if (!OperationRegistry::getInstance().hasOperation(node)) {
+            throwIEException(fmt::format("Node: name = {}, description = {}; Is not found in OperationRegistry",
+                                         node->get_name(),
+                                         node->description()));
+        }
+        auto operation = OperationRegistry::getInstance().createOperation(
+            context, node, opBuffersExtractor.inputTensorIds(*node), opBuffersExtractor.outputTensorIds(*node));
+        if (dynamic_cast<NopOp*>(operation.get())) {
+            continue;
+        }
+        const auto request = operation->GetWorkBufferRequest();
+        const auto workspace_bytes =
+            std::accumulate(request.mutable_sizes.begin(), request.mutable_sizes.end(), std::size_t{0});
+        footprint.largest_operation_workspace_bytes =
+            std::max(footprint.largest_operation_workspace_bytes, workspace_bytes);
+        opBuffersExtractor.processWorkbufferRequest(node_idx, request);
+        ++footprint.operation_count;
+    }
+    footprint.immutable_constants_bytes = opBuffersExtractor.createConstantMemoryModel()->deviceMemoryBlockSize();
+    footprint.immutable_workbuffers_bytes = opBuffersExtractor.createImmutableMemoryModel()->deviceMemoryBlockSize();
+    footprint.mutable_per_request_bytes = opBuffersExtractor.createMutableMemoryModel()->deviceMemoryBlockSize();
+    return footprint;
+}
+
+}  // namespace nvidia_gpu
+}  // namespace ov
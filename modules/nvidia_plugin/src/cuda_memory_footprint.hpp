@@ -0,0 +1,43 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cuda_creation_context.hpp>
+#include <memory>
+
+#include "openvino/core/model.hpp"
+
+namespace ov {
+namespace nvidia_gpu {
+
+/**
+ * Device memory demands of a compiled model, solved on the host only.
+ *
+ * All sizes are fully determined by the memory model builders before any
+ * allocation happens, so they can be computed as a dry run to size GPUs for
+ * new models offline instead of loading them and watching nvidia-smi.
+ */
+struct MemoryFootprint {
+    /** Size of the shared constants blob, allocated once per network */
+    std::size_t immutable_constants_bytes{};
+    /** Size of the shared immutable workbuffers blob, allocated once per network */
+    std::size_t immutable_workbuffers_bytes{};
+    /** Size of the mutable blob each parallel infer request needs, workspaces included */
+    std::size_t mutable_per_request_bytes{};
+    /** Largest mutable workspace a single operation requests */
+    std::size_t largest_operation_workspace_bytes{};
+    /** Number of executable operations, NopOps excluded */
+    std::size_t operation_count{};
+};
+
+/**
+ * Runs the memory solvers over an already transformed model and reports the
+ * blob sizes without allocating device memory. The model must contain only
+ * operations the plugin supports.
+ */
+MemoryFootprint estimateMemoryFootprint(const CreationContext& context, const std::shared_ptr<const ov::Model>& model);
+
+}  // namespace nvidia_gpu
+}  // namespace ov
@@ -6,7 +6,11 @@
 
 #include <fmt/format.h>
 
+#include <algorithm>
+#include <cstring>
 #include <error.hpp>
+#include <functional>
+#include <string_view>
 #include <gsl/span_ext>
 #include <openvino/op/constant.hpp>
 #include <openvino/op/reshape.hpp>
@@ -17,6 +21,7 @@
 #include <openvino/op/unsqueeze.hpp>
 #include <stdexcept>
 #include <transformer/nodes/concat_optimized.hpp>
+#include <transformer/nodes/split_optimized.hpp>
 #include <utility>
 
 namespace ov {
@@ -38,6 +43,8 @@ OperationBuffersExtractor::OperationBuffersExtractor(gsl::span<const NodePtr> or
             extractImmutableTensors(node);
         else if (IsConcatOptimizedNode(*node))
             mergeConcatMutableTensors(node, node_idx);
+        else if (IsSplitOptimizedNode(*node))
+            viewSplitMutableTensors(node, node_idx);
         else if (isReshapeOnlyNode(*node))
             extractReshapeTensors(node, node_idx);
         else
@@ -178,6 +185,23 @@ void OperationBuffersExtractor::mergeConcatMutableTensors(const NodePtr& node, i
     Expects(mergedTensorByteSize == totalSize);
 }
 
+void OperationBuffersExtractor::viewSplitMutableTensors(const NodePtr& node, int node_idx) {
+    const auto& input = node->inputs().at(0);
+    const auto& parentTensor = tensor_names_.at(GetTensorNameInternal(input));
+    Expects(&parentTensor->GetBuffer() == parentTensor.get());
+    Expects(mutable_buffers_.count(parentTensor->GetId()) > 0);
+
+    unsigned offset = 0;
+    for (const auto& output : node->outputs()) {
+        auto view = std::make_shared<TensorID>(next_buffer_id_);
+        next_buffer_id_ += 1;
+        view->SetParent(parentTensor, offset);
+        offset += GetTensorByteSize(output);
+        tensor_names_.emplace(GetTensorNameInternal(output), view);
+    }
+    Expects(offset == GetTensorByteSize(input));
+}
+
 void OperationBuffersExtractor::extractReshapeTensors(const NodePtr& node, int node_idx) {
     try {
         Expects(node->inputs().size() >= 1);
@@ -247,8 +271,22 @@ void OperationBuffersExtractor::extractImmutableTensors(const NodePtr& node) {
     auto constant = std::dynamic_pointer_cast<ov::op::v0::Constant>(node);
     const Byte* ptr = reinterpret_cast<const Byte*>(constant->get_data_ptr());
     auto span = gsl::make_span(ptr, GetTensorByteSize(node->output(0)));
+    // Byte-identical constants (tied embeddings, weights repeated per branch)
+    // map to one device allocation: reuse the tensor id of the first constant
+    // seen with the same content.
+    const size_t content_hash = std::hash<std::string_view>{}(std::string_view{span.data(), span.size()});
+    for (const auto& candidate : immutable_buffer_contents_[content_hash]) {
+        const auto candidate_span = immutable_buffers_.at(candidate->GetId());
+        if (candidate_span.size() == span.size() &&
+            (candidate_span.data() == span.data() ||
+             std::memcmp(candidate_span.data(), span.data(), span.size()) == 0)) {
+            tensor_names_.emplace(GetTensorNameInternal(node->output(0)), candidate);
+            return;
+        }
+    }
     auto tensor = std::make_shared<TensorID>(next_buffer_id_);
     immutable_buffers_.emplace(std::make_pair(tensor->GetId(), span));
+    immutable_buffer_contents_[content_hash].push_back(tensor);
     tensor_names_.emplace(GetTensorNameInternal(node->output(0)), tensor);
     next_buffer_id_++;
 }
@@ -288,13 +326,13 @@ MemoryModel::Ptr OperationBuffersExtractor::createConstantMemoryModel() const {
     return constants_block_builder.build();
 }
 
-MemoryModel::Ptr OperationBuffersExtractor::createMutableMemoryModel() const {
+MemoryModel::Ptr OperationBuffersExtractor::createMutableMemoryModel(size_t device_memory_budget) const {
     MemoryModelBuilder mutable_model_builder;
     for (auto id : mutableBuffersIds()) {
         mutable_model_builder.addAllocation(
             id, mutableBufferLifespanStart(id), mutableBufferLifespanEnd(id), mutableBufferSize(id));
     }
-    return mutable_model_builder.build();
+    return mutable_model_builder.build(device_memory_budget);
 }
 
 MemoryModel::Ptr OperationBuffersExtractor::createImmutableMemoryModel() const {
@@ -322,6 +360,107 @@ bool OperationBuffersExtractor::IsConcatOptimizedNode(const ov::Node& node) {
     return dynamic_cast<const nodes::ConcatOptimized*>(&node) != nullptr;
 }
 
+bool OperationBuffersExtractor::IsSplitOptimizedNode(const ov::Node& node) {
+    return dynamic_cast<const nodes::SplitOptimized*>(&node) != nullptr;
+}
+
+std::vector<OperationBuffersExtractor::NodePtr> OperationBuffersExtractor::scheduleForMinimalPeakMemory(
+    const std::vector<NodePtr>& ordered_nodes) {
+    const std::size_t num_nodes = ordered_nodes.size();
+    std::unordered_map<const ov::Node*, std::size_t> node_index;
+    node_index.reserve(num_nodes);
+    for (std::size_t i = 0; i < num_nodes; ++i) {
+        node_index.emplace(ordered_nodes[i].get(), i);
+    }
+
+    // Bytes a node adds to the mutable blob: constants live in the immutable
+    // blob and reshape-like nodes alias the buffer of their input
+    std::vector<std::size_t> alloc_bytes(num_nodes, 0);
+    for (std::size_t i = 0; i < num_nodes; ++i) {
+        const auto& node = *ordered_nodes[i];
+        if (IsConstantNode(node) || isReshapeOnlyNode(node)) {
+            continue;
+        }
+        for (const auto& output : node.outputs()) {
+            if (output.get_partial_shape().is_static()) {
+                alloc_bytes[i] += GetTensorByteSize(output);
+            }
+        }
+    }
+
+    std::vector<std::vector<std::size_t>> producers(num_nodes);
+    std::vector<std::vector<std::size_t>> successors(num_nodes);
+    std::vector<std::size_t> num_pending_preds(num_nodes, 0);
+    std::vector<std::size_t> consumers_left(num_nodes, 0);
+    const auto addEdge = [&](std::size_t from, std::size_t to) {
+        successors[from].push_back(to);
+        ++num_pending_preds[to];
+    };
+    for (std::size_t i = 0; i < num_nodes; ++i) {
+        const auto& node = *ordered_nodes[i];
+        auto& node_producers = producers[i];
+        for (const auto& input : node.inputs()) {
+            const std::size_t producer = node_index.at(input.get_source_output().get_node());
+            if (std::find(node_producers.begin(), node_producers.end(), producer) == node_producers.end()) {
+                node_producers.push_back(producer);
+                addEdge(producer, i);
+                ++consumers_left[producer];
+            }
+        }
+        for (const auto& dependency : node.get_control_dependencies()) {
+            const std::size_t producer = node_index.at(dependency.get());
+            if (std::find(node_producers.begin(), node_producers.end(), producer) == node_producers.end()) {
+                addEdge(producer, i);
+            }
+        }
+    }
+
+    std::vector<std::size_t> ready;
+    for (std::size_t i = 0; i < num_nodes; ++i) {
+        if (num_pending_preds[i] == 0) {
+            ready.push_back(i);
+        }
+    }
+
+    std::vector<NodePtr> schedule;
+    schedule.reserve(num_nodes);
+    while (!ready.empty()) {
+        // The memory delta of a candidate: its own outputs become live, the
+        // inputs it is the last consumer of die
+        const auto memoryDelta = [&](std::size_t candidate) {
+            std::ptrdiff_t delta = static_cast<std::ptrdiff_t>(alloc_bytes[candidate]);
+            for (const std::size_t producer : producers[candidate]) {
+                if (consumers_left[producer] == 1) {
+                    delta -= static_cast<std::ptrdiff_t>(alloc_bytes[producer]);
+                }
+            }
+            return delta;
+        };
+        std::size_t best_pos = 0;
+        std::ptrdiff_t best_delta = memoryDelta(ready[0]);
+        for (std::size_t pos = 1; pos < ready.size(); ++pos) {
+            const auto delta = memoryDelta(ready[pos]);
+            if (delta < best_delta || (delta == best_delta && ready[pos] < ready[best_pos])) {
+                best_pos = pos;
+                best_delta = delta;
+            }
+        }
+        const std::size_t scheduled = ready[best_pos];
+        ready.erase(ready.begin() + best_pos);
+        schedule.push_back(ordered_nodes[scheduled]);
+        for (const std::size_t producer : producers[scheduled]) {
+            --consumers_left[producer];
+        }
+        for (const std::size_t successor : successors[scheduled]) {
+            if (--num_pending_preds[successor] == 0) {
+                ready.push_back(successor);
+            }
+        }
+    }
+    Ensures(schedule.size() == num_nodes);
+    return schedule;
+}
+
 bool OperationBuffersExtractor::isReshapeOnlyNode(const ov::Node& node) {
     return ov::is_type<const ov::op::v1::Reshape>(&node) || ov::is_type<const ov::op::v0::Squeeze>(&node) ||
            ov::is_type<const ov::op::v0::Unsqueeze>(&node);
@@ -133,9 +133,12 @@ public:
 
     /**
      * Create mutable memory model
+     * @param device_memory_budget Device bytes one block of the model may
+     * occupy; over budget the ResidencyAdvisor spills cold tensors to a
+     * pinned-host section. 0 keeps everything device resident
      * @return MemoryModel for mutable buffers
      */
-    MemoryModel::Ptr createMutableMemoryModel() const;
+    MemoryModel::Ptr createMutableMemoryModel(size_t device_memory_budget = 0) const;
 
     /**
      * Create immutable memory model
@@ -160,6 +163,20 @@ public:
      */
     static bool isReshapeOnlyNode(const ov::Node& node);
 
+    /**
+     * Reorders a topologically sorted subgraph to shrink the peak size of the
+     * mutable memory blob. Tensor lifespans, and with them the blob size the
+     * memory solver can reach, depend on the chosen order among the many valid
+     * ones; this greedy list scheduler always picks the ready node releasing
+     * the most bytes (last-use inputs freed minus outputs allocated), so
+     * long-lived tensors such as skip connections are consumed as early as the
+     * dependencies allow. Ties fall back to the incoming order, which keeps
+     * the result deterministic and leaves already optimal graphs untouched.
+     * @param ordered_nodes Nodes in a valid execution order
+     * @returns The nodes in the reordered, still valid execution order
+     */
+    static std::vector<NodePtr> scheduleForMinimalPeakMemory(const std::vector<NodePtr>& ordered_nodes);
+
 private:
     /**
      * Internal buffer representation
@@ -206,6 +223,14 @@ private:
      */
     void mergeConcatMutableTensors(const NodePtr& node, int node_idx);
 
+    /**
+     * Represents outputs of a SplitOptimized node as offset views into its
+     * input buffer, so no allocations or copies are made for the split
+     * @param node SplitOptimized node (custom node)
+     * @param node_idx Current node index
+     */
+    void viewSplitMutableTensors(const NodePtr& node, int node_idx);
+
     /**
      * Encapsulates immutable tensors extraction for the given node
      * @param node ngraph node from which tensors to be extracted
@@ -253,6 +278,11 @@ private:
      */
     static bool IsConcatOptimizedNode(const ov::Node& node);
 
+    /**
+     * Checks whether the given node is a SplitOptimized node (split optimized)
+     */
+    static bool IsSplitOptimizedNode(const ov::Node& node);
+
     /**
      * Exception helper
      */
@@ -267,6 +297,8 @@ private:
     std::unordered_map<BufferID, BufferDesc> mutable_buffers_;
     std::unordered_map<BufferID, size_t> mutable_tensor_sizes_;
     std::unordered_map<BufferID, gsl::span<const Byte>> immutable_buffers_;
+    /** Content hash to constants with that hash; used to deduplicate byte-identical constants */
+    std::unordered_map<size_t, std::vector<TensorID::Ptr>> immutable_buffer_contents_;
     std::unordered_map<BufferID, size_t> immutable_workbuffers_;
     std::unordered_map<std::string, TensorID::Ptr> tensor_names_;
     unsigned next_buffer_id_{};
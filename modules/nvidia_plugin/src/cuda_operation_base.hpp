@@ -46,6 +46,12 @@ public:
     virtual WorkbufferRequest GetWorkBufferRequest() const = 0;
     virtual const WorkbufferIds& GetWorkbufferIds() const = 0;
     virtual WorkbufferStatus SetWorkbufferIds(WorkbufferIds&& workbufferIds) = 0;
+    /**
+     * Returns true if Execute() only launches work on the context stream and therefore
+     * can be recorded into a CUDA graph. Operations synchronizing the stream or doing
+     * data-dependent host side work have to override this and return false.
+     */
+    virtual bool IsCudaGraphCompatible() const = 0;
 };
 
 class IOperationMeta {
@@ -79,6 +85,9 @@ public:
         return {};  // Most operators do not need workbuffers
     }
     void InitSharedImmutableWorkbuffers(const Buffers&) override {}
+    bool IsCudaGraphCompatible() const override {
+        return true;  // Most operators only enqueue work on the stream
+    }
 
 protected:
     OperationBase(const CreationContext& context,
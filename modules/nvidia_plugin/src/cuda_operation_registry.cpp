@@ -14,32 +14,68 @@ OperationRegistry& OperationRegistry::getInstance() {
     return registry;
 }
 
-void OperationRegistry::registerOp(const std::string& opName, OperationBuilder&& builder) {
-    if (!registered_operations_.try_emplace(opName, move(builder)).second)
-        throw std::runtime_error{"Operation " + opName + " is already registered !!"};
+void OperationRegistry::registerOp(std::string_view opName,
+                                   OperationBuilder&& builder,
+                                   std::optional<std::type_index> type) {
+    for (const auto& entry : entries_) {
+        if (entry.name == opName) {
+            throw std::runtime_error{"Operation " + std::string{opName} + " is already registered !!"};
+        }
+    }
+    entries_.push_back(Entry{opName, fnv1aHash(opName), move(builder), type});
 }
 
-bool OperationRegistry::hasOperation(const std::shared_ptr<ov::Node>& node) {
-    return hasOperation(node->get_type_info().name);
+void OperationRegistry::freeze() const {
+    // Every Register object lives at namespace scope, so by the first lookup
+    // the entry list is complete and the table never changes afterwards
+    std::size_t size = 1;
+    while (size < entries_.size() * 2) {
+        size *= 2;
+    }
+    table_.assign(size, nullptr);
+    table_mask_ = size - 1;
+    for (const auto& entry : entries_) {
+        auto slot = entry.hash & table_mask_;
+        while (table_[slot]) {
+            slot = (slot + 1) & table_mask_;
+        }
+        table_[slot] = &entry;
+    }
 }
 
-std::optional<std::type_index> OperationRegistry::getOperationType(const std::shared_ptr<ov::Node>& node) const {
-    if (registered_type_operations_.count(node->get_type_info().name) > 0) {
-        return registered_type_operations_.at(node->get_type_info().name);
+const OperationRegistry::Entry* OperationRegistry::findOperation(std::string_view name) const {
+    std::call_once(freeze_flag_, [this] { freeze(); });
+    const auto hash = fnv1aHash(name);
+    for (auto slot = hash & table_mask_;; slot = (slot + 1) & table_mask_) {
+        const auto* entry = table_[slot];
+        if (!entry) {
+            return nullptr;
+        }
+        if (entry->hash == hash && entry->name == name) {
+            return entry;
+        }
     }
-    return std::nullopt;
 }
 
-bool OperationRegistry::hasOperation(const std::string& name) {
-    return registered_operations_.end() != registered_operations_.find(name);
+bool OperationRegistry::hasOperation(const std::shared_ptr<ov::Node>& node) {
+    return findOperation(node->get_type_info().name) != nullptr;
+}
+
+std::optional<std::type_index> OperationRegistry::getOperationType(const std::shared_ptr<ov::Node>& node) const {
+    const auto* entry = findOperation(node->get_type_info().name);
+    return entry ? entry->type : std::nullopt;
 }
 
 OperationBase::Ptr OperationRegistry::createOperation(const CreationContext& context,
                                                       const std::shared_ptr<ov::Node>& node,
                                                       std::vector<TensorID>&& inIds,
                                                       std::vector<TensorID>&& outIds) {
-    auto& opBuilder = registered_operations_.at(node->get_type_info().name);
-    return opBuilder(context, node, move(inIds), move(outIds));
+    const std::string_view name = node->get_type_info().name;
+    const auto* entry = findOperation(name);
+    if (!entry) {
+        throw std::out_of_range{"Operation " + std::string{name} + " is not registered"};
+    }
+    return entry->builder(context, node, move(inIds), move(outIds));
 }
 
 OperationBase::Ptr OperationRegistry::createOperation(const CreationContext& context,
@@ -4,10 +4,14 @@
 
 #pragma once
 
+#include <cstdint>
 #include <functional>
+#include <mutex>
+#include <optional>
+#include <string_view>
 #include <typeindex>
 #include <typeinfo>
-#include <unordered_map>
+#include <vector>
 
 #include "cuda_operation_base.hpp"
 
@@ -53,7 +57,7 @@ public:
     class Register {
     public:
         static_assert(std::is_base_of_v<OperationBase, TOperation>, "TOperation should derive from OperationBase");
-        explicit Register(const std::string& opName) {
+        explicit Register(std::string_view opName) {
             getInstance().registerOp(
                 opName,
                 [](const CreationContext& context,
@@ -70,8 +74,8 @@ public:
                             return std::make_shared<TOperation>(context, node, move(inputs), move(outputs));
                         }
                     }
-                });
-            getInstance().registerOpType<TOperation>(opName);
+                },
+                std::type_index(typeid(TOperation)));
         }
     };
 
@@ -92,26 +96,38 @@ public:
                                        gsl::span<const TensorID> outIds);
 
 private:
-    void registerOp(const std::string& opName, OperationBuilder&& builder);
-    template <typename TOperation>
-    void registerOpType(const std::string& opName) {
-        if (!registered_type_operations_.try_emplace(opName, std::type_index(typeid(TOperation))).second) {
-            throw std::runtime_error{"Operation " + opName + " is already registered !!"};
+    struct Entry {
+        std::string_view name;  // points into the string literal of the registering macro
+        std::uint64_t hash;
+        OperationBuilder builder;
+        std::optional<std::type_index> type;
+    };
+
+    // FNV-1a: hashes the type_info name in place, no string construction
+    static constexpr std::uint64_t fnv1aHash(std::string_view str) noexcept {
+        std::uint64_t hash = 0xcbf29ce484222325ull;
+        for (const char ch : str) {
+            hash = (hash ^ static_cast<unsigned char>(ch)) * 0x100000001b3ull;
         }
+        return hash;
     }
 
-    bool hasOperation(const std::string& name);
+    void registerOp(std::string_view opName, OperationBuilder&& builder, std::optional<std::type_index> type);
+    void freeze() const;
+    const Entry* findOperation(std::string_view name) const;
 
-    std::unordered_map<std::type_index, std::unordered_set<std::string>> type_registered_operations_;
-    std::unordered_map<std::string, OperationBuilder> registered_operations_;
-    std::unordered_map<std::string, std::type_index> registered_type_operations_;
+    std::vector<Entry> entries_;
+    // Open-addressing table over entries_, built once on the first lookup
+    mutable std::vector<const Entry*> table_;
+    mutable std::uint64_t table_mask_ = 0;
+    mutable std::once_flag freeze_flag_;
 };
 
 template <>
 class OperationRegistry::Register<OperationBase> {
 public:
-    explicit Register(const std::string& opName, OperationBuilder&& builder) {
-        getInstance().registerOp(opName, move(builder));
+    explicit Register(std::string_view opName, OperationBuilder&& builder) {
+        getInstance().registerOp(opName, move(builder), std::nullopt);
     }
 };
 
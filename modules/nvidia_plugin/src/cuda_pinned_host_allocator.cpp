@@ -0,0 +1,97 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "cuda_pinned_host_allocator.hpp"
+
+#include <cuda_runtime_api.h>
+
+#include <cstdlib>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace ov {
+namespace nvidia_gpu {
+
+namespace {
+// Pinned blocks are bucketed by power-of-two size and recycled through a free
+// list instead of being returned to the driver: cudaHostAlloc pins pages with a
+// multi-millisecond syscall, and per-connection request churn re-allocates the
+// same multi-MB blob sizes over and over. Pointers not in the map were
+// malloc'ed as a fallback and bypass the pool.
+constexpr size_t kMinBucketSize = 4096;        // one small page; finer buckets only fragment
+constexpr size_t kMaxPooledBytes = 256 << 20;  // cap on idle pinned memory kept for reuse
+
+std::mutex pool_mutex;
+std::unordered_map<void*, size_t> pinned_bucket_sizes;  // live and cached cudaHostAlloc blocks
+std::unordered_map<size_t, std::vector<void*>> free_lists;
+size_t cached_bytes = 0;
+
+size_t bucketSize(size_t size) {
+    size_t bucket = kMinBucketSize;
+    while (bucket < size) bucket <<= 1;
+    return bucket;
+}
+}  // namespace
+
+std::shared_ptr<PinnedHostAllocator> PinnedHostAllocator::instance() {
+    static auto allocator = std::make_shared<PinnedHostAllocator>();
+    return allocator;
+}
+
+void* PinnedHostAllocator::alloc(size_t size) noexcept {
+    const size_t bucket = bucketSize(size);
+    {
+        std::lock_guard<std::mutex> lock{pool_mutex};
+        const auto list = free_lists.find(bucket);
+        if (list != free_lists.end() && !list->second.empty()) {
+            void* ptr = list->second.back();
+            list->second.pop_back();
+            cached_bytes -= bucket;
+            return ptr;
+        }
+    }
+    void* ptr = nullptr;
+    if (::cudaHostAlloc(&ptr, bucket, cudaHostAllocDefault) == cudaSuccess) {
+        std::lock_guard<std::mutex> lock{pool_mutex};
+        try {
+            pinned_bucket_sizes.emplace(ptr, bucket);
+            return ptr;
+        } catch (...) {
+            ::cudaFreeHost(ptr);
+            return nullptr;
+        }
+    }
+    ::cudaGetLastError();  // Reset the error state, pinned memory is an optimization only
+    return std::malloc(size);
+}
+
+bool PinnedHostAllocator::free(void* handle) noexcept {
+    if (handle == nullptr) {
+        return false;
+    }
+    {
+        std::lock_guard<std::mutex> lock{pool_mutex};
+        const auto found = pinned_bucket_sizes.find(handle);
+        if (found != pinned_bucket_sizes.end()) {
+            const size_t bucket = found->second;
+            if (cached_bytes + bucket <= kMaxPooledBytes) {
+                try {
+                    free_lists[bucket].push_back(handle);
+                    cached_bytes += bucket;
+                    return true;
+                } catch (...) {
+                    // fall through and release the block to the driver
+                }
+            }
+            pinned_bucket_sizes.erase(found);
+            return ::cudaFreeHost(handle) == cudaSuccess;
+        }
+    }
+    std::free(handle);
+    return true;
+}
+
+}  // namespace nvidia_gpu
+}  // namespace ov
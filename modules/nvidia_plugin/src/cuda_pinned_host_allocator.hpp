@@ -0,0 +1,38 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ie_allocator.hpp>
+#include <memory>
+
+namespace ov {
+namespace nvidia_gpu {
+
+/**
+ * Allocates page-locked (pinned) host memory via cudaHostAlloc.
+ * Host<->device copies from pinned memory bypass the driver bounce buffer, so
+ * cudaMemcpyAsync calls issued from startPipeline/inferPostprocess overlap with
+ * compute instead of being staged through pageable memory. A process-wide
+ * instance is shared by all infer requests; allocations transparently fall back
+ * to the regular heap when pinned memory is not available (e.g. no device).
+ *
+ * Freed pinned blocks are kept in a size-bucketed pool (up to a fixed byte
+ * budget) and reused by later allocations, so creating and destroying infer
+ * requests does not re-pin the same multi-MB host blobs on every connection.
+ */
+class PinnedHostAllocator : public InferenceEngine::IAllocator {
+public:
+    static std::shared_ptr<PinnedHostAllocator> instance();
+
+    void* lock(void* handle, InferenceEngine::LockOp = InferenceEngine::LOCK_FOR_WRITE) noexcept override {
+        return handle;
+    }
+    void unlock(void*) noexcept override {}
+    void* alloc(size_t size) noexcept override;
+    bool free(void* handle) noexcept override;
+};
+
+}  // namespace nvidia_gpu
+}  // namespace ov
@@ -7,6 +7,7 @@
 // hetero_plugin_config.hpp
 #include <fmt/format.h>
 
+#include <cstdlib>
 #include <cuda/props.hpp>
 #include <hetero/hetero_plugin_config.hpp>
 #include <ie_algorithm.hpp>
@@ -20,13 +21,23 @@
 #include "cuda_executable_network.hpp"
 #include "cuda_infer_request.hpp"
 #include "cuda_itt.hpp"
+#include "cuda_memory_footprint.hpp"
 #include "cuda_operation_registry.hpp"
 #include "cuda_plugin.hpp"
+#include "cuda_remote_context.hpp"
 #include "nvidia/nvidia_config.hpp"
 #include "openvino/runtime/properties.hpp"
 using namespace ov::nvidia_gpu;
 
-Plugin::Plugin() { _pluginName = "NVIDIA"; }
+Plugin::Plugin() {
+    _pluginName = "NVIDIA";
+    // Ask the driver (CUDA 11.7+) to load kernels on first launch instead of
+    // paging the whole fatbin in at context creation; with the full type
+    // cross-product compiled in, eager loading dominates plugin startup. Only
+    // effective when set before the first CUDA call, and deliberately not
+    // overriding an explicit user choice
+    setenv("CUDA_MODULE_LOADING", "LAZY", /*overwrite=*/0);
+}
 
 Plugin::~Plugin() {
     // Plugin should remove executors from executor cache to avoid threads number growth in the whole application
@@ -86,10 +97,13 @@ InferenceEngine::ITaskExecutor::Ptr Plugin::GetStreamExecutor(const Configuratio
     std::string deviceId = cfg.Get(CONFIG_KEY(DEVICE_ID));
     CUDA::Device device{std::stoi(deviceId)};
     const size_t numConcurrentStreams = maxConcurrentStreams(device);
+    const int streamPriorityClass = cfg.streamPriorityClass();
     {
         std::lock_guard<std::mutex> lock{mtx_};
-        auto& p = device_thread_pool_[deviceId];
-        if (!p) p = std::make_shared<CudaThreadPool>(device, numConcurrentStreams);
+        // Networks of the same priority class share a pool; each class gets its own
+        // pool so its ThreadContext streams carry the requested CUDA priority
+        auto& p = device_thread_pool_[deviceId + "/" + std::to_string(streamPriorityClass)];
+        if (!p) p = std::make_shared<CudaThreadPool>(device, numConcurrentStreams, streamPriorityClass);
         return p;
     }
 }
@@ -106,6 +120,25 @@ InferenceEngine::IExecutableNetworkInternal::Ptr Plugin::ImportNetwork(
     return exec;
 }
 
+std::shared_ptr<InferenceEngine::RemoteContext> Plugin::CreateContext(const InferenceEngine::ParamMap& params) {
+    int deviceId = _cfg.deviceId;
+    if (const auto it = params.find(NVIDIA_PARAM_KEY(DEVICE_ID)); it != params.end()) {
+        deviceId = it->second.as<int>();
+    }
+    if (deviceId < 0 || deviceId >= CUDA::Device::count()) {
+        throwIEException(fmt::format("Cannot create remote context for unknown CUDA device {}", deviceId));
+    }
+    return std::make_shared<CudaRemoteContext>(deviceId);
+}
+
+std::shared_ptr<InferenceEngine::RemoteContext> Plugin::GetDefaultContext(const InferenceEngine::ParamMap& params) {
+    std::lock_guard<std::mutex> lock{mtx_};
+    if (!default_context_) {
+        default_context_ = std::make_shared<CudaRemoteContext>(_cfg.deviceId);
+    }
+    return default_context_;
+}
+
 InferenceEngine::QueryNetworkResult Plugin::QueryNetwork(const InferenceEngine::CNNNetwork& network,
                                                          const ConfigMap& config) const {
     OV_ITT_SCOPED_TASK(itt::domains::nvidia_gpu, "ov::nvidia_gpu::QueryNetwork");
@@ -165,11 +198,18 @@ InferenceEngine::Parameter Plugin::GetMetric(const std::string& name,
                                                      METRIC_KEY(IMPORT_EXPORT_SUPPORT),
                                                      METRIC_KEY(DEVICE_ARCHITECTURE),
                                                      METRIC_KEY(OPTIMIZATION_CAPABILITIES),
-                                                     METRIC_KEY(RANGE_FOR_ASYNC_INFER_REQUESTS)};
+                                                     METRIC_KEY(RANGE_FOR_ASYNC_INFER_REQUESTS),
+                                                     NVIDIA_METRIC_VALUE(MEMORY_FOOTPRINT)};
         IE_SET_METRIC_RETURN(SUPPORTED_METRICS, supportedMetrics);
     } else if (METRIC_KEY(SUPPORTED_CONFIG_KEYS) == name) {
-        std::vector<std::string> configKeys = {
-            CONFIG_KEY(DEVICE_ID), CONFIG_KEY(PERF_COUNT), NVIDIA_CONFIG_KEY(THROUGHPUT_STREAMS)};
+        std::vector<std::string> configKeys = {CONFIG_KEY(DEVICE_ID),
+                                               CONFIG_KEY(PERF_COUNT),
+                                               CONFIG_KEY(DYN_BATCH_ENABLED),
+                                               NVIDIA_CONFIG_KEY(THROUGHPUT_STREAMS),
+                                               NVIDIA_CONFIG_KEY(STREAM_PRIORITY),
+                                               NVIDIA_CONFIG_KEY(CANCELLATION_CHECK_INTERVAL),
+                                               NVIDIA_CONFIG_KEY(WARM_UP),
+                                               NVIDIA_CONFIG_KEY(CUDNN_WORKSPACE_LIMIT)};
         auto streamExecutorConfigKeys = InferenceEngine::IStreamsExecutor::Config{}.SupportedKeys();
         for (auto&& configKey : streamExecutorConfigKeys) {
             if (configKey != InferenceEngine::PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS) {
@@ -239,6 +279,29 @@ InferenceEngine::Parameter Plugin::GetMetric(const std::string& name,
         // TODO: fill with actual values
         using uint = unsigned int;
         IE_SET_METRIC_RETURN(RANGE_FOR_ASYNC_INFER_REQUESTS, std::make_tuple(uint{1}, uint{1}, uint{1}));
+    } else if (NVIDIA_METRIC_VALUE(MEMORY_FOOTPRINT) == name) {
+        const auto model_it = options.find(ov::hint::model.name());
+        if (model_it == options.end()) {
+            throwIEException(
+                fmt::format("{} metric requires the model passed in options under {}",
+                            NVIDIA_METRIC_VALUE(MEMORY_FOOTPRINT),
+                            ov::hint::model.name()));
+        }
+        // The solvers mutate the graph through the transformations, so a dry run
+        // works on its own clone of the queried model
+        InferenceEngine::CNNNetwork network{
+            ngraph::clone_function(*model_it->second.as<std::shared_ptr<const ov::Model>>())};
+        auto function = network.getFunction();
+        const CUDA::Device device{_cfg.deviceId};
+        transformer_.transform(device, function, network.getInputsInfo(), network.getOutputsInfo(), _cfg);
+        const auto footprint = estimateMemoryFootprint(CreationContext{device, false}, function);
+        const std::map<std::string, uint64_t> result{
+            {"immutable_constants_bytes", footprint.immutable_constants_bytes},
+            {"immutable_workbuffers_bytes", footprint.immutable_workbuffers_bytes},
+            {"mutable_per_request_bytes", footprint.mutable_per_request_bytes},
+            {"largest_operation_workspace_bytes", footprint.largest_operation_workspace_bytes},
+            {"operation_count", footprint.operation_count}};
+        return {result};
     } else {
         IE_THROW(NotFound) << "Unsupported device metric: " << name;
     }
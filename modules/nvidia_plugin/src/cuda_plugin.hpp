@@ -32,6 +32,8 @@ public:
         const std::string& name, const std::map<std::string, InferenceEngine::Parameter>& options) const override;
     InferenceEngine::IExecutableNetworkInternal::Ptr ImportNetwork(
         std::istream& model, const std::map<std::string, std::string>& config) override;
+    std::shared_ptr<InferenceEngine::RemoteContext> CreateContext(const InferenceEngine::ParamMap& params) override;
+    std::shared_ptr<InferenceEngine::RemoteContext> GetDefaultContext(const InferenceEngine::ParamMap& params) override;
 
 private:
     friend class ExecutableNetwork;
@@ -54,6 +56,7 @@ private:
     std::mutex mtx_;
     GraphTransformer transformer_{};
     Configuration _cfg;
+    std::shared_ptr<InferenceEngine::RemoteContext> default_context_;
     std::unordered_map<std::string, InferenceEngine::ITaskExecutor::Ptr> _waitExecutors;
     std::unordered_map<std::string, std::shared_ptr<CudaThreadPool>> device_thread_pool_;
 };
@@ -37,10 +37,20 @@ constexpr InferenceEngine::InferenceEngineProfileInfo makeProfileInfo(long long
 
 }  // namespace
 
-Profiler::Profiler(bool perfCount, const SubGraph& graph) : perf_count_{perfCount} {
+Profiler::Profiler(bool perfCount, const SubGraph& graph, bool deviceTimeProfiling, const std::string& traceExportPath)
+    : perf_count_{perfCount}, device_time_profiling_{perfCount && deviceTimeProfiling} {
     std::vector<OperationBase::Ptr> execSequence;
     CollectSubGraphs(graph, execSequence);
 
+    if (!traceExportPath.empty()) {
+        utils::TraceExport::instance().enable(traceExportPath);
+        trace_ = utils::TraceExport::instance().enabled();
+    }
+
+    if (device_time_profiling_) {
+        utils::CuptiDeviceTimer::instance().enable();
+    }
+
     if (perf_count_) {
         for (int i = 0; i < execSequence.size(); ++i) {
             auto& op = *execSequence[i];
@@ -63,17 +73,27 @@ Profiler::Profiler(bool perfCount, const SubGraph& graph) : perf_count_{perfCoun
 void Profiler::ProcessEvents() {
     if (!perf_count_ || infer_count_ == 0) return;
     constexpr float ms2us = 1000.0;
+    // CUPTI-measured device times replace the event-based numbers where
+    // kernel activity was attributed to the step
+    std::map<std::uint64_t, float> device_times{};
+    if (device_time_profiling_) {
+        device_times = utils::CuptiDeviceTimer::instance().collectDeviceTimes();
+    }
     std::map<std::string, float> layer_timing{};
     for (auto& timing_map : subgraph_perf_steps_map_) {
         auto& timings = timing_map.second;
         for (auto& timing : timings) {
             timing.Measure();
+            float duration = timing.Duration();
+            if (const auto device_time = device_times.find(timing.GetExecId()); device_time != device_times.cend()) {
+                duration = device_time->second;
+            }
             const auto perf = perf_counters_.find(timing.GetOpName());
             if (perf != perf_counters_.cend()) {
-                perf->second.realTime_uSec = timing.Duration() * ms2us / infer_count_;
+                perf->second.realTime_uSec = duration * ms2us / infer_count_;
                 perf->second.status = InferenceEngine::InferenceEngineProfileInfo::EXECUTED;
                 if (perf->second.layer_type[0]) {
-                    layer_timing[perf->second.layer_type] += timing.Duration();
+                    layer_timing[perf->second.layer_type] += duration;
                 }
             }
         }
@@ -4,10 +4,14 @@
 
 #pragma once
 
+#include <atomic>
 #include <chrono>
 #include <map>
 #include <ops/tensor_iterator.hpp>
+#include <utils/cupti_device_timer.hpp>
+#include <utils/event_counters.hpp>
 #include <utils/perf_timing.hpp>
+#include <utils/trace_export.hpp>
 #include <vector>
 
 #include "cuda_graph.hpp"
@@ -33,8 +37,15 @@ public:
     /**
      * Constructor of Profiler class
      * @param perfCount Option that indicates if performance counters are enabled
+     * @param deviceTimeProfiling Option that indicates if performance counters should
+     * report CUPTI-measured device execution time instead of event-based timings
+     * @param traceExportPath Chrome tracing JSON file execution spans are streamed
+     * into; empty disables the trace export
      */
-    explicit Profiler(bool perfCount, const SubGraph& graph);
+    explicit Profiler(bool perfCount,
+                      const SubGraph& graph,
+                      bool deviceTimeProfiling = false,
+                      const std::string& traceExportPath = {});
 
     /**
      * Start time measurement of stage
@@ -44,13 +55,32 @@ public:
     /**
      * Start time measurement of stage
      */
-    void StartStage() { start_ = Time::now(); }
+    void StartStage() {
+        start_ = Time::now();
+        if (trace_) {
+            trace_stage_begin_us_ = utils::TraceExport::nowUs();
+        }
+    }
 
     /**
      * Stop time measurement of stage
      * @param stage Stage for which time measurement was performed
      */
-    void StopStage(Stages stage) { durations_[stage] = Time::now() - start_; }
+    void StopStage(Stages stage) {
+        durations_[stage] = Time::now() - start_;
+        {
+            auto& counters = utils::EventCounters::instance();
+            utils::EventCounters::Counter* const stageCounters[NumOfStages] = {
+                &counters.preprocess_us, &counters.postprocess_us, &counters.start_pipeline_us,
+                &counters.wait_pipeline_us};
+            utils::EventCounters::add(*stageCounters[stage], static_cast<std::uint64_t>(durations_[stage].count()));
+        }
+        if (trace_) {
+            static constexpr const char* stageNames[NumOfStages] = {
+                "Preprocess", "Postprocess", "StartPipeline", "WaitPipeline"};
+            utils::TraceExport::instance().completeEvent(stageNames[stage], "stage", trace_stage_begin_us_);
+        }
+    }
 
     /**
      * Creates profiler sequence and increase infer request counter
@@ -64,6 +94,11 @@ public:
      */
     [[nodiscard]] const PerformaceCounters& GetPerformanceCounts() const { return perf_counters_; }
 
+    /**
+     * Returns true if performance counters are enabled
+     */
+    [[nodiscard]] bool PerfCount() const noexcept { return perf_count_; }
+
     /**
      * Processes performance events into performance counters
      */
@@ -78,6 +113,10 @@ private:
 
     const CUDA::Stream* active_stream_ = nullptr;
     const bool perf_count_;
+    const bool device_time_profiling_;
+    // Spans are streamed into the chrome tracing file opened by TraceExport
+    bool trace_ = false;
+    std::uint64_t trace_stage_begin_us_ = 0;
     std::vector<std::pair<const void*, std::vector<ProfileExecStep>>> subgraph_perf_steps_map_;
     PerformaceCounters perf_counters_{};
     utils::PerformaceTiming exec_timing_{};
@@ -94,7 +133,8 @@ public:
      * @param profiler Profiler class
      * @param execStep Executable step
      */
-    ProfileExecStep(Profiler& profiler, const OperationBase& execStep) : profiler_{profiler}, exec_step_{execStep} {}
+    ProfileExecStep(Profiler& profiler, const OperationBase& execStep)
+        : profiler_{profiler}, exec_step_{execStep}, exec_id_{next_exec_id_++} {}
 
     /**
      * Execute method wrapper that wrap each element with time measurement
@@ -103,13 +143,28 @@ public:
      */
     template <typename... TArgs>
     void Execute(TArgs&&... args) const {
+        // The trace records the host-side submission span of the step on the
+        // thread driving the stream, which is what shows ordering, launch
+        // bubbles and the overlap between concurrent requests
+        const bool trace = this->profiler_.trace_;
+        const auto traceBegin = trace ? utils::TraceExport::nowUs() : 0;
         if (this->profiler_.perf_count_) {
+            const bool deviceTime = this->profiler_.device_time_profiling_;
+            if (deviceTime) {
+                utils::CuptiDeviceTimer::instance().pushRange(exec_id_);
+            }
             timing_.setStart(*this->profiler_.active_stream_);
             exec_step_.Execute(std::forward<TArgs>(args)...);
             timing_.setStop(*this->profiler_.active_stream_);
+            if (deviceTime) {
+                utils::CuptiDeviceTimer::instance().popRange();
+            }
         } else {
             exec_step_.Execute(std::forward<TArgs>(args)...);
         }
+        if (trace) {
+            utils::TraceExport::instance().completeEvent(exec_step_.GetName(), exec_step_.GetTypeName(), traceBegin);
+        }
     }
 
     /**
@@ -148,9 +203,18 @@ public:
      */
     [[nodiscard]] const std::string& GetOpName() { return exec_step_.GetName(); }
 
+    /**
+     * Get the identifier used for CUPTI external correlation of this step
+     * @return Range id of this step
+     */
+    [[nodiscard]] std::uint64_t GetExecId() const noexcept { return exec_id_; }
+
 private:
+    static inline std::atomic<std::uint64_t> next_exec_id_{1};
+
     Profiler& profiler_;
     const OperationBase& exec_step_;
+    std::uint64_t exec_id_;
     mutable utils::PerformaceTiming timing_;
 };
 
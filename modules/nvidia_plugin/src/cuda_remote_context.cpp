@@ -0,0 +1,129 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "cuda_remote_context.hpp"
+
+#include <fmt/format.h>
+
+#include <error.hpp>
+
+namespace ov {
+namespace nvidia_gpu {
+
+namespace {
+
+/**
+ * Allocator stub backing the LockedMemory objects of remote blobs: "locking" just
+ * hands out the stored device pointer. It never allocates or frees anything, the
+ * memory is managed by the blob (or the application) itself.
+ */
+class DeviceMemAllocator : public InferenceEngine::IAllocator {
+public:
+    static const std::shared_ptr<InferenceEngine::IAllocator>& instance() {
+        static const std::shared_ptr<InferenceEngine::IAllocator> allocator = std::make_shared<DeviceMemAllocator>();
+        return allocator;
+    }
+
+    void* lock(void* handle, InferenceEngine::LockOp) noexcept override { return handle; }
+    void unlock(void*) noexcept override {}
+    void* alloc(size_t) noexcept override { return nullptr; }
+    bool free(void*) noexcept override { return true; }
+};
+
+}  // namespace
+
+CudaRemoteBlob::CudaRemoteBlob(const InferenceEngine::TensorDesc& tensorDesc,
+                               const std::shared_ptr<CudaRemoteContext>& context,
+                               void* devicePtr)
+    : InferenceEngine::RemoteBlob{tensorDesc}, context_{context}, device_ptr_{devicePtr} {}
+
+CudaRemoteBlob::CudaRemoteBlob(const InferenceEngine::TensorDesc& tensorDesc,
+                               const std::shared_ptr<CudaRemoteContext>& context)
+    : InferenceEngine::RemoteBlob{tensorDesc}, context_{context} {}
+
+std::string CudaRemoteBlob::getDeviceName() const noexcept { return context_->getDeviceName(); }
+
+std::shared_ptr<InferenceEngine::RemoteContext> CudaRemoteBlob::getContext() const noexcept { return context_; }
+
+InferenceEngine::ParamMap CudaRemoteBlob::getParams() const {
+    return {{NVIDIA_PARAM_KEY(MEM_HANDLE), device_ptr_}};
+}
+
+void CudaRemoteBlob::allocate() noexcept {
+    if (device_ptr_) {
+        return;  // wraps application-owned memory or is already allocated
+    }
+    try {
+        CUDA::Device{context_->deviceId()}.setCurrent();
+        owned_memory_.emplace(CUDA::DefaultStream::stream().malloc(byteSize()));
+        device_ptr_ = owned_memory_->get();
+    } catch (...) {
+        owned_memory_.reset();
+        device_ptr_ = nullptr;
+    }
+}
+
+bool CudaRemoteBlob::deallocate() noexcept {
+    if (!owned_memory_) {
+        return false;
+    }
+    owned_memory_.reset();
+    device_ptr_ = nullptr;
+    return true;
+}
+
+InferenceEngine::LockedMemory<void> CudaRemoteBlob::buffer() noexcept {
+    return {DeviceMemAllocator::instance().get(), device_ptr_, 0};
+}
+
+InferenceEngine::LockedMemory<const void> CudaRemoteBlob::cbuffer() const noexcept {
+    return {DeviceMemAllocator::instance().get(), device_ptr_, 0};
+}
+
+InferenceEngine::LockedMemory<void> CudaRemoteBlob::rwmap() noexcept {
+    return {DeviceMemAllocator::instance().get(), device_ptr_, 0};
+}
+
+InferenceEngine::LockedMemory<const void> CudaRemoteBlob::rmap() const noexcept {
+    return {DeviceMemAllocator::instance().get(), device_ptr_, 0};
+}
+
+InferenceEngine::LockedMemory<void> CudaRemoteBlob::wmap() noexcept {
+    return {DeviceMemAllocator::instance().get(), device_ptr_, 0};
+}
+
+const std::shared_ptr<InferenceEngine::IAllocator>& CudaRemoteBlob::getAllocator() const noexcept {
+    return DeviceMemAllocator::instance();
+}
+
+void* CudaRemoteBlob::getHandle() const noexcept { return device_ptr_; }
+
+std::string CudaRemoteContext::getDeviceName() const noexcept { return "NVIDIA." + std::to_string(device_id_); }
+
+InferenceEngine::ParamMap CudaRemoteContext::getParams() const {
+    return {{NVIDIA_PARAM_KEY(DEVICE_ID), device_id_}};
+}
+
+InferenceEngine::RemoteBlob::Ptr CudaRemoteContext::CreateBlob(const InferenceEngine::TensorDesc& tensorDesc,
+                                                               const InferenceEngine::ParamMap& params) {
+    auto self = std::static_pointer_cast<CudaRemoteContext>(shared_from_this());
+    const auto memHandle = params.find(NVIDIA_PARAM_KEY(MEM_HANDLE));
+    if (memHandle != params.end()) {
+        auto devicePtr = memHandle->second.as<void*>();
+        if (!devicePtr) {
+            throwIEException(fmt::format("{} parameter of a remote blob is null", NVIDIA_PARAM_KEY(MEM_HANDLE)));
+        }
+        return std::make_shared<CudaRemoteBlob>(tensorDesc, self, devicePtr);
+    }
+    auto blob = std::make_shared<CudaRemoteBlob>(tensorDesc, self);
+    blob->allocate();
+    if (!blob->deviceMem()) {
+        throwIEException(
+            fmt::format("Cannot allocate {} bytes of device memory for a remote blob", blob->byteSize()));
+    }
+    return blob;
+}
+
+}  // namespace nvidia_gpu
+}  // namespace ov
@@ -0,0 +1,92 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ie_remote_context.hpp>
+#include <memory>
+#include <nvidia/nvidia_remote_params.hpp>
+#include <optional>
+#include <string>
+
+#include "cuda/runtime.hpp"
+
+namespace ov {
+namespace nvidia_gpu {
+
+class CudaRemoteContext;
+
+/**
+ * @class CudaRemoteBlob
+ * @brief Blob whose payload lives in CUDA device memory. It either wraps a device
+ * pointer handed in by the application or owns an allocation of its own. Lock
+ * methods expose the raw device pointer; the memory is not host-accessible.
+ */
+class CudaRemoteBlob : public InferenceEngine::RemoteBlob {
+public:
+    using Ptr = std::shared_ptr<CudaRemoteBlob>;
+
+    /**
+     * Wraps an application-owned device pointer
+     */
+    CudaRemoteBlob(const InferenceEngine::TensorDesc& tensorDesc,
+                   const std::shared_ptr<CudaRemoteContext>& context,
+                   void* devicePtr);
+    /**
+     * Creates a blob owning its device memory; the allocation happens in allocate()
+     */
+    CudaRemoteBlob(const InferenceEngine::TensorDesc& tensorDesc, const std::shared_ptr<CudaRemoteContext>& context);
+
+    std::string getDeviceName() const noexcept override;
+    std::shared_ptr<InferenceEngine::RemoteContext> getContext() const noexcept override;
+    InferenceEngine::ParamMap getParams() const override;
+
+    void allocate() noexcept override;
+    bool deallocate() noexcept override;
+    InferenceEngine::LockedMemory<void> buffer() noexcept override;
+    InferenceEngine::LockedMemory<const void> cbuffer() const noexcept override;
+    InferenceEngine::LockedMemory<void> rwmap() noexcept override;
+    InferenceEngine::LockedMemory<const void> rmap() const noexcept override;
+    InferenceEngine::LockedMemory<void> wmap() noexcept override;
+
+    /**
+     * Raw pointer to the device memory backing this blob
+     */
+    void* deviceMem() const noexcept { return device_ptr_; }
+
+protected:
+    const std::shared_ptr<InferenceEngine::IAllocator>& getAllocator() const noexcept override;
+    void* getHandle() const noexcept override;
+
+private:
+    std::shared_ptr<CudaRemoteContext> context_;
+    std::optional<CUDA::DefaultAllocation> owned_memory_;
+    void* device_ptr_ = nullptr;
+};
+
+/**
+ * @class CudaRemoteContext
+ * @brief Remote context of a CUDA device. Lets applications create blobs backed by
+ * device memory and hand device pointers produced by their own pipelines (e.g.
+ * hardware video decode) directly to inference requests, skipping host round trips.
+ */
+class CudaRemoteContext : public InferenceEngine::RemoteContext {
+public:
+    using Ptr = std::shared_ptr<CudaRemoteContext>;
+
+    explicit CudaRemoteContext(int deviceId) : device_id_{deviceId} {}
+
+    std::string getDeviceName() const noexcept override;
+    InferenceEngine::ParamMap getParams() const override;
+    InferenceEngine::RemoteBlob::Ptr CreateBlob(const InferenceEngine::TensorDesc& tensorDesc,
+                                                const InferenceEngine::ParamMap& params = {}) override;
+
+    int deviceId() const noexcept { return device_id_; }
+
+private:
+    int device_id_;
+};
+
+}  // namespace nvidia_gpu
+}  // namespace ov
@@ -0,0 +1,152 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "cuda_request_batcher.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <cpp/ie_infer_request.hpp>
+#include <cstring>
+#include <error.hpp>
+#include <gsl/gsl_assert>
+#include <ie_blob.h>
+
+namespace ov {
+namespace nvidia_gpu {
+
+namespace {
+
+void copySampleToSlice(const InferenceEngine::Blob::Ptr& sample,
+                       const InferenceEngine::Blob::Ptr& batched,
+                       std::size_t sliceIndex) {
+    auto src = InferenceEngine::as<InferenceEngine::MemoryBlob>(sample);
+    auto dst = InferenceEngine::as<InferenceEngine::MemoryBlob>(batched);
+    Expects(src && dst);
+    const auto sampleBytes = src->byteSize();
+    auto srcLock = src->rmap();
+    auto dstLock = dst->wmap();
+    std::memcpy(dstLock.as<std::uint8_t*>() + sliceIndex * sampleBytes, srcLock.as<const std::uint8_t*>(), sampleBytes);
+}
+
+void copySliceToSample(const InferenceEngine::Blob::Ptr& batched,
+                       const InferenceEngine::Blob::Ptr& sample,
+                       std::size_t sliceIndex) {
+    auto src = InferenceEngine::as<InferenceEngine::MemoryBlob>(batched);
+    auto dst = InferenceEngine::as<InferenceEngine::MemoryBlob>(sample);
+    Expects(src && dst);
+    const auto sampleBytes = dst->byteSize();
+    auto srcLock = src->rmap();
+    auto dstLock = dst->wmap();
+    std::memcpy(dstLock.as<std::uint8_t*>(), srcLock.as<const std::uint8_t*>() + sliceIndex * sampleBytes, sampleBytes);
+}
+
+}  // namespace
+
+RequestBatcher::RequestBatcher(InferenceEngine::IInferRequestInternal::Ptr batchedRequest,
+                               std::vector<std::string> inputNames,
+                               std::vector<std::string> outputNames,
+                               unsigned batchSize,
+                               unsigned timeoutMs)
+    : batched_request_{std::move(batchedRequest)},
+      input_names_{std::move(inputNames)},
+      output_names_{std::move(outputNames)},
+      batch_size_{batchSize},
+      timeout_{timeoutMs} {
+    Expects(batch_size_ >= 2);
+    worker_ = std::thread{[this] { workerLoop(); }};
+}
+
+RequestBatcher::~RequestBatcher() {
+    {
+        std::lock_guard<std::mutex> lock{mutex_};
+        stopped_ = true;
+    }
+    queue_changed_.notify_all();
+    worker_.join();
+}
+
+bool RequestBatcher::isSuitable(InferenceEngine::IInferRequestInternal& request) const {
+    auto matchesSlice = [this](const InferenceEngine::Blob::Ptr& sample, const InferenceEngine::Blob::Ptr& batched) {
+        return sample && batched &&
+               sample->getTensorDesc().getPrecision() == batched->getTensorDesc().getPrecision() &&
+               sample->byteSize() * batch_size_ == batched->byteSize();
+    };
+    for (const auto& name : input_names_) {
+        if (!matchesSlice(request.GetBlob(name), batched_request_->GetBlob(name))) {
+            return false;
+        }
+    }
+    for (const auto& name : output_names_) {
+        if (!matchesSlice(request.GetBlob(name), batched_request_->GetBlob(name))) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool RequestBatcher::TryInfer(InferenceEngine::IInferRequestInternal& request) {
+    if (!isSuitable(request)) {
+        return false;
+    }
+    std::future<void> done;
+    {
+        std::lock_guard<std::mutex> lock{mutex_};
+        if (stopped_) {
+            return false;
+        }
+        queue_.push_back(Slot{&request, {}});
+        done = queue_.back().done.get_future();
+    }
+    queue_changed_.notify_all();
+    done.get();  // rethrows the failure of the batched execution, if any
+    return true;
+}
+
+void RequestBatcher::workerLoop() {
+    std::unique_lock<std::mutex> lock{mutex_};
+    while (true) {
+        queue_changed_.wait(lock, [this] { return stopped_ || !queue_.empty(); });
+        if (queue_.empty()) {
+            break;  // stopped with nothing left to drain
+        }
+        // Collection window: give concurrent requests a chance to join the batch
+        const auto deadline = std::chrono::steady_clock::now() + timeout_;
+        queue_changed_.wait_until(lock, deadline, [this] { return stopped_ || queue_.size() >= batch_size_; });
+        const auto count = std::min<std::size_t>(queue_.size(), batch_size_);
+        std::vector<Slot> slots{std::make_move_iterator(queue_.begin()),
+                                std::make_move_iterator(queue_.begin() + count)};
+        queue_.erase(queue_.begin(), queue_.begin() + count);
+        lock.unlock();
+        runBatch(slots);
+        lock.lock();
+    }
+}
+
+void RequestBatcher::runBatch(std::vector<Slot>& slots) {
+    try {
+        for (std::size_t i = 0; i < slots.size(); ++i) {
+            for (const auto& name : input_names_) {
+                copySampleToSlice(slots[i].request->GetBlob(name), batched_request_->GetBlob(name), i);
+            }
+        }
+        batched_request_->StartAsync();
+        batched_request_->Wait(InferenceEngine::InferRequest::WaitMode::RESULT_READY);
+        for (std::size_t i = 0; i < slots.size(); ++i) {
+            for (const auto& name : output_names_) {
+                copySliceToSample(batched_request_->GetBlob(name), slots[i].request->GetBlob(name), i);
+            }
+        }
+        for (auto& slot : slots) {
+            slot.done.set_value();
+        }
+    } catch (...) {
+        const auto failure = std::current_exception();
+        for (auto& slot : slots) {
+            slot.done.set_exception(failure);
+        }
+    }
+}
+
+}  // namespace nvidia_gpu
+}  // namespace ov
@@ -0,0 +1,75 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <cpp_interfaces/interface/ie_iinfer_request_internal.hpp>
+#include <future>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace ov {
+namespace nvidia_gpu {
+
+/**
+ * @class RequestBatcher
+ * @brief Coalesces concurrent single-sample inference requests into one execution
+ * of a batch-compiled copy of the network.
+ *
+ * Requests arriving within the collection window share one batched request: their
+ * input blobs are gathered into the batched input blobs, the batched request runs
+ * once, and the produced outputs are scattered back to the individual requests.
+ * All blobs are expected to have the batch as the outermost dimension, so every
+ * sample occupies one contiguous slice of the batched blob.
+ */
+class RequestBatcher {
+public:
+    using Ptr = std::shared_ptr<RequestBatcher>;
+
+    RequestBatcher(InferenceEngine::IInferRequestInternal::Ptr batchedRequest,
+                   std::vector<std::string> inputNames,
+                   std::vector<std::string> outputNames,
+                   unsigned batchSize,
+                   unsigned timeoutMs);
+    RequestBatcher(const RequestBatcher&) = delete;
+    RequestBatcher& operator=(const RequestBatcher&) = delete;
+    ~RequestBatcher();
+
+    /**
+     * Runs the request as part of a batch and blocks until that batch completes.
+     * Returns false without running anything when the request's blobs do not match
+     * the expected single-sample layout; the caller then executes the request
+     * through its own pipeline.
+     */
+    bool TryInfer(InferenceEngine::IInferRequestInternal& request);
+
+private:
+    struct Slot {
+        InferenceEngine::IInferRequestInternal* request;
+        std::promise<void> done;
+    };
+
+    bool isSuitable(InferenceEngine::IInferRequestInternal& request) const;
+    void workerLoop();
+    void runBatch(std::vector<Slot>& slots);
+
+    InferenceEngine::IInferRequestInternal::Ptr batched_request_;
+    std::vector<std::string> input_names_;
+    std::vector<std::string> output_names_;
+    const unsigned batch_size_;
+    const std::chrono::milliseconds timeout_;
+
+    std::mutex mutex_;
+    std::condition_variable queue_changed_;
+    std::vector<Slot> queue_;
+    bool stopped_ = false;
+    std::thread worker_;
+};
+
+}  // namespace nvidia_gpu
+}  // namespace ov
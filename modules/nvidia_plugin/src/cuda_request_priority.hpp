@@ -0,0 +1,48 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+
+namespace ov {
+namespace nvidia_gpu {
+
+/**
+ * @brief Scheduling class of one infer request.
+ *
+ * Requests compete for the shared worker threads of CudaThreadPool and for the
+ * DeviceMemBlock-s of MemoryPool. By default both are served first-in
+ * first-out, which lets a burst of batch jobs starve interactive traffic on
+ * the same ExecutableNetwork. A request may instead carry a priority: higher
+ * levels are scheduled first, requests of equal level are ordered by their
+ * deadline hint (earliest first), and requests without a deadline keep
+ * submission order behind those that have one. Level 0 without a deadline is
+ * the default and takes the unchanged FIFO fast paths.
+ */
+struct RequestPriority {
+    using Clock = std::chrono::steady_clock;
+
+    /** Higher runs first; negative levels run only when no default-priority work is pending */
+    int level = 0;
+    /** Earliest-deadline-first hint among requests of the same level */
+    Clock::time_point deadline = Clock::time_point::max();
+
+    bool is_default() const { return level == 0 && deadline == Clock::time_point::max(); }
+
+    /** Strict scheduling order; @p seq / @p other_seq break ties with submission order */
+    bool precedes(std::uint64_t seq, const RequestPriority& other, std::uint64_t other_seq) const {
+        if (level != other.level) {
+            return level > other.level;
+        }
+        if (deadline != other.deadline) {
+            return deadline < other.deadline;
+        }
+        return seq < other_seq;
+    }
+};
+
+}  // namespace nvidia_gpu
+}  // namespace ov
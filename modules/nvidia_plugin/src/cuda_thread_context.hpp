@@ -4,6 +4,9 @@
 
 #pragma once
 
+#include <array>
+#include <optional>
+
 #include "cuda/blas.hpp"
 #include "cuda/dnn.hpp"
 #include "cuda/tensor.hpp"
@@ -12,22 +15,120 @@ namespace ov {
 namespace nvidia_gpu {
 
 class ThreadContext {
+public:
+    /** Number of compute lanes a subgraph may schedule operations on; lane 0 is the default stream */
+    static constexpr unsigned kNumStreamLanes = 4;
+
+private:
+    /**
+     * Library handle created on first use and bound to its stream exactly once.
+     * Handle creation serializes on driver locks, so deferring it keeps pool
+     * spin-up fast and lanes that never run a cuDNN/cuBLAS operation never pay
+     * for a handle at all. Host-side enqueueing within one request is single
+     * threaded (see activeStream_), so the unsynchronized lazy init is safe.
+     */
+    template <typename Handle>
+    class LazyStreamBoundHandle {
+    public:
+        const Handle& get(const CUDA::Stream& stream) const {
+            if (!handle_) {
+                handle_.emplace();
+                handle_->setStream(stream);
+            }
+            return *handle_;
+        }
+
+    private:
+        mutable std::optional<Handle> handle_;
+    };
+
     CUDA::Device device_;
+    // Numeric CUDA priority all streams of this context are created with; computed
+    // from the priority class before the streams so the initializers can use it
+    int stream_priority_;
     CUDA::Stream stream_;
-    CUDA::DnnHandle dnnHandle_;
-    CUDA::CuBlasHandle cuBlasHandle_;
-    CUDA::CuTensorHandle cuTensorHandle_;
+    // Dedicated transfer streams let H2D copies of one request overlap compute of another;
+    // event dependencies towards stream_ are set up by ParameterOp/ResultOp
+    CUDA::Stream uploadStream_;
+    CUDA::Stream downloadStream_;
+    // Compute streams of the non-default lanes of multi-stream subgraph execution
+    std::array<CUDA::Stream, kNumStreamLanes - 1> laneStreams_;
+    // One stream-bound handle per lane: switching the active lane then only swaps
+    // an index instead of re-binding a shared handle with cudnnSetStream /
+    // cublasSetStream on the inference hot path
+    std::array<LazyStreamBoundHandle<CUDA::DnnHandle>, kNumStreamLanes> dnnHandles_;
+    std::array<LazyStreamBoundHandle<CUDA::CuBlasHandle>, kNumStreamLanes> cuBlasHandles_;
+    // cuBLASLt and cuTENSOR take the stream per call, one lazy handle suffices
+    mutable std::optional<CUDA::CuBlasLtHandle> cuBlasLtHandle_;
+    mutable std::optional<CUDA::CuTensorHandle> cuTensorHandle_;
+    // Stream the operations enqueue their work on. Host-side enqueueing within
+    // one request is single threaded, so switching the active lane between
+    // operations is safe even though the context is shared by const reference.
+    mutable const CUDA::Stream* activeStream_ = &stream_;
+    mutable unsigned activeLane_ = 0;
+
+    /** Maps a priority class onto the device's stream priority range (lower value = higher priority) */
+    static int streamPriority(int priorityClass) noexcept {
+        if (priorityClass == 0) {
+            return 0;
+        }
+        int least{};     // numerically greatest value: the lowest priority
+        int greatest{};  // numerically smallest value: the highest priority
+        if (::cudaDeviceGetStreamPriorityRange(&least, &greatest) != cudaSuccess) {
+            ::cudaGetLastError();  // Reset the error state, priorities are an optimization only
+            return 0;
+        }
+        return priorityClass < 0 ? greatest : least;
+    }
 
 public:
-    explicit ThreadContext(CUDA::Device d) : device_{d.setCurrent()} {
-        dnnHandle_.setStream(stream_);
-        cuBlasHandle_.setStream(stream_);
+    /**
+     * @param priorityClass -1 for a high-priority context, 0 for default, 1 for low;
+     * mapped onto the device stream priority range so kernels of a high-priority model
+     * preempt pending kernels of lower-priority models sharing the GPU
+     */
+    explicit ThreadContext(CUDA::Device d, int priorityClass = 0)
+        : device_{d.setCurrent()},
+          stream_priority_{streamPriority(priorityClass)},
+          stream_{stream_priority_},
+          uploadStream_{stream_priority_},
+          downloadStream_{stream_priority_},
+          laneStreams_{CUDA::Stream{stream_priority_}, CUDA::Stream{stream_priority_}, CUDA::Stream{stream_priority_}} {
+        static_assert(kNumStreamLanes == 4, "laneStreams_ initializer assumes three non-default lanes");
     }
     CUDA::Device device() const { return device_; }
-    const CUDA::Stream& stream() const noexcept { return stream_; }
-    const CUDA::DnnHandle& dnnHandle() const noexcept { return dnnHandle_; }
-    const CUDA::CuBlasHandle& cuBlasHandle() const noexcept { return cuBlasHandle_; }
-    const CUDA::CuTensorHandle& cuTensorHandle() const noexcept { return cuTensorHandle_; }
+    const CUDA::Stream& stream() const noexcept { return *activeStream_; }
+    const CUDA::Stream& laneStream(unsigned lane) const noexcept {
+        return lane == 0 ? stream_ : laneStreams_[lane - 1];
+    }
+    /**
+     * Redirects stream() and the stream-bound cuDNN/cuBLAS handles to the given
+     * lane while a multi-stream schedule is being enqueued; the subgraph
+     * scheduler restores lane 0 when it is done. Each lane owns handles bound to
+     * its stream once, so the switch itself issues no library calls.
+     */
+    void setActiveLane(unsigned lane) const {
+        activeStream_ = &laneStream(lane);
+        activeLane_ = lane;
+    }
+    /** True when stream() is the default lane; nested subgraphs check it to avoid re-parallelizing */
+    bool defaultLaneActive() const noexcept { return activeStream_ == &stream_; }
+    const CUDA::Stream& uploadStream() const noexcept { return uploadStream_; }
+    const CUDA::Stream& downloadStream() const noexcept { return downloadStream_; }
+    const CUDA::DnnHandle& dnnHandle() const { return dnnHandles_[activeLane_].get(*activeStream_); }
+    const CUDA::CuBlasHandle& cuBlasHandle() const { return cuBlasHandles_[activeLane_].get(*activeStream_); }
+    const CUDA::CuBlasLtHandle& cuBlasLtHandle() const {
+        if (!cuBlasLtHandle_) {
+            cuBlasLtHandle_.emplace();
+        }
+        return *cuBlasLtHandle_;
+    }
+    const CUDA::CuTensorHandle& cuTensorHandle() const {
+        if (!cuTensorHandle_) {
+            cuTensorHandle_.emplace();
+        }
+        return *cuTensorHandle_;
+    }
 };
 
 }  // namespace nvidia_gpu
@@ -7,6 +7,7 @@
 #include <fmt/format.h>
 
 #include <details/ie_exception.hpp>
+#include <utils/event_counters.hpp>
 
 #include "cuda_latch.hpp"
 
@@ -15,28 +16,46 @@ namespace nvidia_gpu {
 
 static thread_local ThreadContext* contextPtr = nullptr;
 
-CudaThreadPool::CudaThreadPool(CUDA::Device d, unsigned _numThreads) {
+namespace {
+// Large enough to never fill up with a realistic number of in-flight requests
+constexpr std::size_t kTaskQueueCapacity = 1024;
+// Attempts to pop without sleeping before a worker parks itself
+constexpr int kIdleSpinCount = 64;
+}  // namespace
+
+CudaThreadPool::CudaThreadPool(CUDA::Device d, unsigned _numThreads, int streamPriorityClass)
+    : task_queue_{kTaskQueueCapacity} {
     try {
         CudaLatch latch{_numThreads};
         for (int i = 0; i < _numThreads; ++i) {
-            threads_.emplace_back([this, d, &latch] {
-                ThreadContext context{d};
+            threads_.emplace_back([this, d, streamPriorityClass, &latch] {
+                ThreadContext context{d, streamPriorityClass};
                 contextPtr = &context;
                 latch.count_down();
-                while (true) {
+                while (!is_stopped_.load(std::memory_order_acquire)) {
                     Task task;
-                    {
-                        std::unique_lock<std::mutex> lock(mtx_);
-                        queue_cond_var_.wait(lock, [&] { return !task_queue_.empty() || is_stopped_; });
-                        if (is_stopped_) {
-                            break;
-                        }
-                        if (!task_queue_.empty()) {
-                            task = std::move(task_queue_.front());
-                            task_queue_.pop_front();
-                        }
+                    // Urgent work first, then the FIFO ring, then background
+                    // (negative-level) work that must not delay default traffic
+                    bool got_task = tryPopPrioritized(task, /*urgent_only=*/true) || task_queue_.try_pop(task) ||
+                                    tryPopPrioritized(task, /*urgent_only=*/false);
+                    for (int spin = 0; !got_task && spin < kIdleSpinCount; ++spin) {
+                        std::this_thread::yield();
+                        got_task = tryPopPrioritized(task, /*urgent_only=*/true) || task_queue_.try_pop(task) ||
+                                   tryPopPrioritized(task, /*urgent_only=*/false);
+                    }
+                    if (!got_task) {
+                        std::unique_lock<std::mutex> lock(wait_mtx_);
+                        num_waiters_.fetch_add(1, std::memory_order_relaxed);
+                        queue_cond_var_.wait(lock, [&] {
+                            return is_stopped_.load(std::memory_order_acquire) ||
+                                   tryPopPrioritized(task, /*urgent_only=*/true) || task_queue_.try_pop(task) ||
+                                   tryPopPrioritized(task, /*urgent_only=*/false);
+                        });
+                        num_waiters_.fetch_sub(1, std::memory_order_relaxed);
+                        got_task = static_cast<bool>(task);
                     }
-                    if (task) {
+                    if (got_task) {
+                        utils::EventCounters::sub(utils::EventCounters::instance().thread_pool_queue_depth);
                         task();
                     }
                 }
@@ -53,8 +72,8 @@ CudaThreadPool::~CudaThreadPool() { stopThreadPool(); }
 
 void CudaThreadPool::stopThreadPool() noexcept {
     {
-        std::lock_guard<std::mutex> lock(mtx_);
-        is_stopped_ = true;
+        std::lock_guard<std::mutex> lock(wait_mtx_);
+        is_stopped_.store(true, std::memory_order_release);
     }
     queue_cond_var_.notify_all();
     threads_.clear();
@@ -70,11 +89,73 @@ const ThreadContext& CudaThreadPool::GetThreadContext() {
 }
 
 void CudaThreadPool::run(Task task) {
+    while (!task_queue_.try_push(std::move(task))) {
+        // The ring is full; back off until a worker makes room
+        std::this_thread::yield();
+    }
+    utils::EventCounters::add(utils::EventCounters::instance().thread_pool_queue_depth);
+    // The waiter check must happen under wait_mtx_: it pairs with the locked
+    // increment on the parking path, so either the worker's final predicate
+    // pop sees this push or this load sees the waiter. An unlocked relaxed
+    // load can miss a concurrently parking worker and strand the task
+    std::lock_guard<std::mutex> lock(wait_mtx_);
+    if (num_waiters_.load(std::memory_order_relaxed) > 0) {
+        queue_cond_var_.notify_one();
+    }
+}
+
+void CudaThreadPool::run(Task task, const RequestPriority& priority) {
+    if (priority.is_default()) {
+        run(std::move(task));
+        return;
+    }
     {
-        std::lock_guard<std::mutex> lock(mtx_);
-        task_queue_.push_back(task);
+        std::lock_guard<std::mutex> lock(priority_mtx_);
+        priority_tasks_.push(
+            PrioritizedTask{priority, priority_seq_.fetch_add(1, std::memory_order_relaxed), std::move(task)});
+        // Counters are bumped under the lock so a worker that saw them
+        // non-zero always finds the matching heap entry
+        if (priority.level > 0) {
+            num_urgent_.fetch_add(1, std::memory_order_release);
+        } else {
+            num_background_.fetch_add(1, std::memory_order_release);
+        }
+    }
+    utils::EventCounters::add(utils::EventCounters::instance().thread_pool_queue_depth);
+    // Same as run(Task): priority_mtx_ orders nothing against the parking
+    // path, so the waiter check needs wait_mtx_ to not race a parking worker
+    std::lock_guard<std::mutex> lock(wait_mtx_);
+    if (num_waiters_.load(std::memory_order_relaxed) > 0) {
+        queue_cond_var_.notify_one();
+    }
+}
+
+bool CudaThreadPool::tryPopPrioritized(Task& task, bool urgent_only) {
+    // Lock-free exit for the common case of no prioritized work in flight
+    if (urgent_only) {
+        if (num_urgent_.load(std::memory_order_acquire) == 0) {
+            return false;
+        }
+    } else if (num_urgent_.load(std::memory_order_acquire) == 0 &&
+               num_background_.load(std::memory_order_acquire) == 0) {
+        return false;
+    }
+    std::lock_guard<std::mutex> lock(priority_mtx_);
+    if (priority_tasks_.empty()) {
+        return false;
+    }
+    const auto& top = priority_tasks_.top();
+    if (urgent_only && top.priority.level <= 0) {
+        return false;
+    }
+    if (top.priority.level > 0) {
+        num_urgent_.fetch_sub(1, std::memory_order_relaxed);
+    } else {
+        num_background_.fetch_sub(1, std::memory_order_relaxed);
     }
-    queue_cond_var_.notify_one();
+    task = std::move(top.task);
+    priority_tasks_.pop();
+    return true;
 }
 
 }  // namespace nvidia_gpu
@@ -6,14 +6,16 @@
 
 #include <atomic>
 #include <condition_variable>
+#include <cstdint>
 #include <cuda_thread_context.hpp>
-#include <deque>
 #include <mutex>
 #include <queue>
 #include <thread>
 #include <threading/ie_itask_executor.hpp>
 
 #include "cuda_jthread.hpp"
+#include "cuda_request_priority.hpp"
+#include "utils/mpmc_bounded_queue.hpp"
 
 namespace ov {
 namespace nvidia_gpu {
@@ -22,18 +24,47 @@ class CudaThreadPool : public InferenceEngine::ITaskExecutor {
 public:
     using Task = std::function<void()>;
 
-    CudaThreadPool(CUDA::Device d, unsigned _numThreads);
+    /** @param streamPriorityClass see ThreadContext: -1 high, 0 default, 1 low */
+    CudaThreadPool(CUDA::Device d, unsigned _numThreads, int streamPriorityClass = 0);
     const ThreadContext& GetThreadContext();
     ~CudaThreadPool() override;
     void run(Task task) override;
+    /**
+     * Runs @p task according to @p priority: higher levels preempt queued
+     * default work, equal levels are ordered earliest-deadline-first, and
+     * negative levels run only when no default work is pending. Default
+     * priority forwards to the FIFO fast path of run(Task).
+     */
+    void run(Task task, const RequestPriority& priority);
 
 private:
+    struct PrioritizedTask {
+        RequestPriority priority;
+        std::uint64_t seq;
+        // priority_queue pops its largest element, so "less" means "runs later"
+        bool operator<(const PrioritizedTask& other) const { return other.priority.precedes(other.seq, priority, seq); }
+        // Mutable so the task can be moved out of the queue top before popping
+        mutable Task task;
+    };
+
+    bool tryPopPrioritized(Task& task, bool urgent_only);
     void stopThreadPool() noexcept;
 
-    std::mutex mtx_;
-    bool is_stopped_ = false;
+    // Default-priority tasks go through a lock-free MPMC ring; the mutex/condition variable
+    // pair is only touched by threads that are about to sleep, keeping the busy path
+    // contention-free. Prioritized tasks are rare (interactive traffic marking itself out of
+    // a batch burst), so they take a small mutex-guarded heap checked via atomic counters
+    // that keep the ring path lock-free when no prioritized work is pending.
+    utils::MpmcBoundedQueue<Task> task_queue_;
+    std::mutex priority_mtx_;
+    std::priority_queue<PrioritizedTask> priority_tasks_;
+    std::atomic<unsigned> num_urgent_{0};      // queued tasks with level > 0
+    std::atomic<unsigned> num_background_{0};  // queued tasks with level <= 0
+    std::atomic<std::uint64_t> priority_seq_{0};
+    std::atomic<bool> is_stopped_{false};
+    std::atomic<unsigned> num_waiters_{0};
+    std::mutex wait_mtx_;
     std::condition_variable queue_cond_var_;
-    std::deque<Task> task_queue_;
     std::vector<CudaJThread> threads_;
 };
 
@@ -0,0 +1,66 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <initializer_list>
+
+namespace ov {
+namespace nvidia_gpu {
+namespace kernel {
+
+/**
+ * @brief Compute-capability dispatch for hand-written kernels.
+ *
+ * Device properties are queried at LoadNetwork, but the kernels used to run
+ * one code path on every architecture. A kernel with an architecture-specific
+ * variant (e.g. a cp.async staging pipeline on Ampere) lists it in a dispatch
+ * table keyed by the first compute capability the variant targets; the entry
+ * with the highest key not exceeding the device capability wins, so a table
+ * written for sm_80 is also picked on sm_90 until a dedicated variant is
+ * registered. Selection happens once at operation creation and the launch
+ * path stays branch-free. Variant kernels are compiled for every architecture
+ * of the fatbin with __CUDA_ARCH__ guards providing the portable body, so a
+ * table entry never makes the module unloadable on older devices.
+ */
+
+/** Compute capabilities encoded as major * 10 + minor */
+constexpr unsigned kArchVolta = 70;
+constexpr unsigned kArchAmpere = 80;
+constexpr unsigned kArchHopper = 90;
+
+/** Encodes cudaDeviceProp major/minor into the dispatch key */
+constexpr unsigned computeCapability(int major, int minor) {
+    return static_cast<unsigned>(major) * 10 + static_cast<unsigned>(minor);
+}
+
+/** One registered specialization: the variant tag paired with its first architecture */
+template <typename Impl>
+struct ArchVariant {
+    unsigned min_arch;
+    Impl impl;
+};
+
+/**
+ * Returns the variant with the highest min_arch not exceeding @p device_arch,
+ * or @p generic when no table entry matches.
+ */
+template <typename Impl>
+constexpr Impl selectArchVariant(unsigned device_arch,
+                                 std::initializer_list<ArchVariant<Impl>> table,
+                                 Impl generic) {
+    Impl selected = generic;
+    unsigned selected_arch = 0;
+    for (const auto& variant : table) {
+        if (variant.min_arch <= device_arch && variant.min_arch >= selected_arch) {
+            selected = variant.impl;
+            selected_arch = variant.min_arch;
+        }
+    }
+    return selected;
+}
+
+}  // namespace kernel
+}  // namespace nvidia_gpu
+}  // namespace ov
@@ -0,0 +1,40 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstdint>
+
+namespace ov {
+namespace nvidia_gpu {
+namespace kernel {
+
+#if defined(__CUDA_ARCH__) && __CUDA_ARCH__ >= 800
+
+/**
+ * cp.async primitives for the Ampere variants selected via arch_dispatch.hpp.
+ * A 16-byte cp.async.cg copy moves data from global memory straight into
+ * shared memory through L2, bypassing the register file and L1, and completes
+ * asynchronously so the issuing thread can overlap it with stores or address
+ * arithmetic until the matching wait.
+ */
+
+__device__ __forceinline__ void cpAsync16(void* smem_dst, const void* gmem_src) {
+    const unsigned smem_addr = static_cast<unsigned>(__cvta_generic_to_shared(smem_dst));
+    asm volatile("cp.async.cg.shared.global [%0], [%1], 16;" ::"r"(smem_addr), "l"(gmem_src));
+}
+
+__device__ __forceinline__ void cpAsyncCommitGroup() { asm volatile("cp.async.commit_group;"); }
+
+/** Blocks until at most @tparam Pending commit groups of this thread are still in flight */
+template <int Pending>
+__device__ __forceinline__ void cpAsyncWaitGroup() {
+    asm volatile("cp.async.wait_group %0;" ::"n"(Pending));
+}
+
+#endif  // defined(__CUDA_ARCH__) && __CUDA_ARCH__ >= 800
+
+}  // namespace kernel
+}  // namespace nvidia_gpu
+}  // namespace ov
@@ -0,0 +1,185 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <fmt/format.h>
+
+#include <cuda/float16.hpp>
+
+#include "compare_select.hpp"
+
+namespace ov {
+namespace nvidia_gpu {
+namespace kernel {
+
+template <typename T, typename OP>
+static __global__ void compare_select(size_t max_size,
+                                      const T* left_src,
+                                      const T* right_src,
+                                      const T* then_src,
+                                      const T* else_src,
+                                      const CompareSelect::BrcstOffsetType* left_brcst_offsets,
+                                      const CompareSelect::BrcstOffsetType* right_brcst_offsets,
+                                      const CompareSelect::BrcstOffsetType* then_brcst_offsets,
+                                      const CompareSelect::BrcstOffsetType* else_brcst_offsets,
+                                      const CompareSelect::BrcstOffsetType* output_sizes,
+                                      T* dst) {
+    const unsigned idx = blockIdx.x * blockDim.x + threadIdx.x;
+    if (idx >= max_size) {
+        return;
+    }
+
+    // calc N, C, D, H, W indexes
+    enum { N, C, D, H, W };
+    const unsigned n = idx / output_sizes[N];
+    const unsigned n_size = n * output_sizes[N];
+    const unsigned c = (idx - n_size) / output_sizes[C];
+    const unsigned c_size = c * output_sizes[C];
+    const unsigned d = (idx - n_size - c_size) / output_sizes[D];
+    const unsigned d_size = d * output_sizes[D];
+    const unsigned h = (idx - n_size - c_size - d_size) / output_sizes[H];
+    const unsigned h_size = h * output_sizes[H];
+    const unsigned w = (idx - n_size - c_size - d_size - h_size) / output_sizes[W];
+
+    const unsigned left_idx = left_brcst_offsets[N] * n + left_brcst_offsets[C] * c + left_brcst_offsets[D] * d +
+                              left_brcst_offsets[H] * h + left_brcst_offsets[W] * w;
+    const unsigned right_idx = right_brcst_offsets[N] * n + right_brcst_offsets[C] * c + right_brcst_offsets[D] * d +
+                               right_brcst_offsets[H] * h + right_brcst_offsets[W] * w;
+    const unsigned then_idx = then_brcst_offsets[N] * n + then_brcst_offsets[C] * c + then_brcst_offsets[D] * d +
+                              then_brcst_offsets[H] * h + then_brcst_offsets[W] * w;
+    const unsigned else_idx = else_brcst_offsets[N] * n + else_brcst_offsets[C] * c + else_brcst_offsets[D] * d +
+                              else_brcst_offsets[H] * h + else_brcst_offsets[W] * w;
+
+    // The predicate stays in a register; no boolean mask touches global memory
+    dst[idx] = OP::op(left_src[left_idx], right_src[right_idx]) ? then_src[then_idx] : else_src[else_idx];
+}
+
+template <typename T, CompareSelect::Op_t>
+struct OpImpl;
+template <typename T>
+struct OpImpl<T, CompareSelect::Op_t::GREATER> {
+    __device__ static inline bool op(T left, T right) { return left > right; }
+};
+template <typename T>
+struct OpImpl<T, CompareSelect::Op_t::LESS> {
+    __device__ static inline bool op(T left, T right) { return left < right; }
+};
+
+CompareSelect::CompareSelect(
+    Op_t op_type, Type_t element_type, size_t max_size, size_t num_blocks, size_t threads_per_block)
+    : op_type_{op_type},
+      element_type_{element_type},
+      max_size_{max_size},
+      num_blocks_{num_blocks},
+      threads_per_block_{threads_per_block} {}
+
+void CompareSelect::operator()(const cudaStream_t stream,
+                               const void* left_src,
+                               const void* right_src,
+                               const void* then_src,
+                               const void* else_src,
+                               const BrcstOffsetType* left_brcst_offsets,
+                               const BrcstOffsetType* right_brcst_offsets,
+                               const BrcstOffsetType* then_brcst_offsets,
+                               const BrcstOffsetType* else_brcst_offsets,
+                               const BrcstOffsetType* output_sizes,
+                               void* dst) const {
+    switch (element_type_) {
+#ifdef CUDA_HAS_BF16_TYPE
+        case Type_t::bf16:
+            return Call<__nv_bfloat16>(stream, left_src, right_src, then_src, else_src, left_brcst_offsets,
+                                       right_brcst_offsets, then_brcst_offsets, else_brcst_offsets, output_sizes, dst);
+#endif
+        case Type_t::f16:
+            return Call<__half>(stream, left_src, right_src, then_src, else_src, left_brcst_offsets,
+                                right_brcst_offsets, then_brcst_offsets, else_brcst_offsets, output_sizes, dst);
+        case Type_t::f32:
+            return Call<float>(stream, left_src, right_src, then_src, else_src, left_brcst_offsets,
+                               right_brcst_offsets, then_brcst_offsets, else_brcst_offsets, output_sizes, dst);
+        case Type_t::f64:
+            return Call<double>(stream, left_src, right_src, then_src, else_src, left_brcst_offsets,
+                                right_brcst_offsets, then_brcst_offsets, else_brcst_offsets, output_sizes, dst);
+        case Type_t::i8:
+            return Call<int8_t>(stream, left_src, right_src, then_src, else_src, left_brcst_offsets,
+                                right_brcst_offsets, then_brcst_offsets, else_brcst_offsets, output_sizes, dst);
+        case Type_t::i16:
+            return Call<int16_t>(stream, left_src, right_src, then_src, else_src, left_brcst_offsets,
+                                 right_brcst_offsets, then_brcst_offsets, else_brcst_offsets, output_sizes, dst);
+        case Type_t::i32:
+            return Call<int32_t>(stream, left_src, right_src, then_src, else_src, left_brcst_offsets,
+                                 right_brcst_offsets, then_brcst_offsets, else_brcst_offsets, output_sizes, dst);
+        case Type_t::i64:
+            return Call<int64_t>(stream, left_src, right_src, then_src, else_src, left_brcst_offsets,
+                                 right_brcst_offsets, then_brcst_offsets, else_brcst_offsets, output_sizes, dst);
+        case Type_t::u8:
+            return Call<uint8_t>(stream, left_src, right_src, then_src, else_src, left_brcst_offsets,
+                                 right_brcst_offsets, then_brcst_offsets, else_brcst_offsets, output_sizes, dst);
+        case Type_t::u16:
+            return Call<uint16_t>(stream, left_src, right_src, then_src, else_src, left_brcst_offsets,
+                                  right_brcst_offsets, then_brcst_offsets, else_brcst_offsets, output_sizes, dst);
+        case Type_t::u32:
+            return Call<uint32_t>(stream, left_src, right_src, then_src, else_src, left_brcst_offsets,
+                                  right_brcst_offsets, then_brcst_offsets, else_brcst_offsets, output_sizes, dst);
+        case Type_t::u64:
+            return Call<uint64_t>(stream, left_src, right_src, then_src, else_src, left_brcst_offsets,
+                                  right_brcst_offsets, then_brcst_offsets, else_brcst_offsets, output_sizes, dst);
+        default:
+            throwIEException(fmt::format("Element type = {} is not supported by CompareSelect operation.",
+                                         static_cast<Type_t>(element_type_)));
+    }
+}
+
+template <typename T>
+void CompareSelect::Call(const cudaStream_t stream,
+                         const void* left_src,
+                         const void* right_src,
+                         const void* then_src,
+                         const void* else_src,
+                         const BrcstOffsetType* left_brcst_offsets,
+                         const BrcstOffsetType* right_brcst_offsets,
+                         const BrcstOffsetType* then_brcst_offsets,
+                         const BrcstOffsetType* else_brcst_offsets,
+                         const BrcstOffsetType* output_sizes,
+                         void* dst) const {
+    switch (op_type_) {
+        case Op_t::GREATER:
+            return Call<T, Op_t::GREATER>(stream, left_src, right_src, then_src, else_src, left_brcst_offsets,
+                                          right_brcst_offsets, then_brcst_offsets, else_brcst_offsets, output_sizes,
+                                          dst);
+        case Op_t::LESS:
+            return Call<T, Op_t::LESS>(stream, left_src, right_src, then_src, else_src, left_brcst_offsets,
+                                       right_brcst_offsets, then_brcst_offsets, else_brcst_offsets, output_sizes, dst);
+        default:
+            throwIEException(fmt::format("Input operation = {} is not supported by CompareSelect operation !!",
+                                         static_cast<int>(op_type_)));
+    }
+}
+
+template <typename T, CompareSelect::Op_t OP>
+void CompareSelect::Call(const cudaStream_t stream,
+                         const void* left_src,
+                         const void* right_src,
+                         const void* then_src,
+                         const void* else_src,
+                         const BrcstOffsetType* left_brcst_offsets,
+                         const BrcstOffsetType* right_brcst_offsets,
+                         const BrcstOffsetType* then_brcst_offsets,
+                         const BrcstOffsetType* else_brcst_offsets,
+                         const BrcstOffsetType* output_sizes,
+                         void* dst) const {
+    compare_select<T, OpImpl<T, OP>><<<num_blocks_, threads_per_block_, 0, stream>>>(max_size_,
+                                                                                     static_cast<const T*>(left_src),
+                                                                                     static_cast<const T*>(right_src),
+                                                                                     static_cast<const T*>(then_src),
+                                                                                     static_cast<const T*>(else_src),
+                                                                                     left_brcst_offsets,
+                                                                                     right_brcst_offsets,
+                                                                                     then_brcst_offsets,
+                                                                                     else_brcst_offsets,
+                                                                                     output_sizes,
+                                                                                     static_cast<T*>(dst));
+}
+
+}  // namespace kernel
+}  // namespace nvidia_gpu
+}  // namespace ov
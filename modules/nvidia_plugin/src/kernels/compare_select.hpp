@@ -0,0 +1,82 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "cuda_type_traits.hpp"
+#include "error.hpp"
+
+namespace ov {
+namespace nvidia_gpu {
+namespace kernel {
+
+/**
+ * Fused comparison and selection: evaluates left OP right per output element
+ * and picks the then/else value in the same kernel, so the boolean mask the
+ * standalone Comparison/Select pair exchanges through global memory is never
+ * written. All four operands broadcast into the output through per-dimension
+ * offset tables the same way the Select kernel does.
+ */
+class CompareSelect {
+public:
+    enum class Op_t { GREATER, LESS };
+    using BrcstOffsetType = size_t;
+
+    CompareSelect(Op_t op,
+                  Type_t element_type,
+                  size_t max_size,
+                  size_t num_blocks,
+                  size_t threads_per_block);
+    CompareSelect(CompareSelect&&) = default;
+    CompareSelect& operator=(CompareSelect&&) = default;
+
+    void operator()(const cudaStream_t stream,
+                    const void* left_src,
+                    const void* right_src,
+                    const void* then_src,
+                    const void* else_src,
+                    const BrcstOffsetType* left_brcst_offsets,
+                    const BrcstOffsetType* right_brcst_offsets,
+                    const BrcstOffsetType* then_brcst_offsets,
+                    const BrcstOffsetType* else_brcst_offsets,
+                    const BrcstOffsetType* output_sizes,
+                    void* dst) const;
+
+private:
+    template <typename T>
+    void Call(const cudaStream_t stream,
+              const void* left_src,
+              const void* right_src,
+              const void* then_src,
+              const void* else_src,
+              const BrcstOffsetType* left_brcst_offsets,
+              const BrcstOffsetType* right_brcst_offsets,
+              const BrcstOffsetType* then_brcst_offsets,
+              const BrcstOffsetType* else_brcst_offsets,
+              const BrcstOffsetType* output_sizes,
+              void* dst) const;
+
+    template <typename T, Op_t OP>
+    void Call(const cudaStream_t stream,
+              const void* left_src,
+              const void* right_src,
+              const void* then_src,
+              const void* else_src,
+              const BrcstOffsetType* left_brcst_offsets,
+              const BrcstOffsetType* right_brcst_offsets,
+              const BrcstOffsetType* then_brcst_offsets,
+              const BrcstOffsetType* else_brcst_offsets,
+              const BrcstOffsetType* output_sizes,
+              void* dst) const;
+
+    Op_t op_type_;
+    Type_t element_type_;
+    size_t max_size_;
+    size_t num_blocks_;
+    size_t threads_per_block_;
+};
+
+}  // namespace kernel
+}  // namespace nvidia_gpu
+}  // namespace ov
@@ -45,6 +45,45 @@ static __global__ void comparison(size_t max_size,
     dst[idx] = OP::op(left_src[left_idx], right_src[right_idx]);
 }
 
+// Packed variant: each warp produces one 32-bit word holding the results of 32
+// consecutive output elements (bit i of word w is element w * 32 + i). Must be
+// launched with a whole number of warps per block so __ballot_sync sees the
+// full warp.
+template <typename T, typename OP>
+static __global__ void comparison_packed(size_t max_size,
+                                         const T* left_src,
+                                         const T* right_src,
+                                         const size_t* left_brcst_offsets,
+                                         const size_t* right_brcst_offsets,
+                                         const size_t* output_sizes,
+                                         uint32_t* dst) {
+    const unsigned idx = blockIdx.x * blockDim.x + threadIdx.x;
+    bool result = false;
+    if (idx < max_size) {
+        // calc N, C, D, H, W indexes
+        enum { N, C, D, H, W };
+        const unsigned n = idx / output_sizes[N];
+        const unsigned n_size = n * output_sizes[N];
+        const unsigned c = (idx - n_size) / output_sizes[C];
+        const unsigned c_size = c * output_sizes[C];
+        const unsigned d = (idx - n_size - c_size) / output_sizes[D];
+        const unsigned d_size = d * output_sizes[D];
+        const unsigned h = (idx - n_size - c_size - d_size) / output_sizes[H];
+        const unsigned h_size = h * output_sizes[H];
+        const unsigned w = (idx - n_size - c_size - d_size - h_size) / output_sizes[W];
+
+        const unsigned left_idx = left_brcst_offsets[N] * n + left_brcst_offsets[C] * c + left_brcst_offsets[D] * d +
+                                  left_brcst_offsets[H] * h + left_brcst_offsets[W] * w;
+        const unsigned right_idx = right_brcst_offsets[N] * n + right_brcst_offsets[C] * c +
+                                   right_brcst_offsets[D] * d + right_brcst_offsets[H] * h + right_brcst_offsets[W] * w;
+        result = OP::op(left_src[left_idx], right_src[right_idx]);
+    }
+    const uint32_t word = __ballot_sync(0xffffffffu, result);
+    if ((threadIdx.x & 31u) == 0 && idx < max_size) {
+        dst[idx / 32] = word;
+    }
+}
+
 template <typename T, Comparison::Op_t>
 struct OpImpl;
 template <typename T>
@@ -56,12 +95,18 @@ struct OpImpl<T, Comparison::Op_t::LESS> {
     __device__ static inline bool op(T left, T right) { return left < right; }
 };
 
-Comparison::Comparison(Op_t op_type, Type_t element_type, size_t max_size, size_t num_blocks, size_t threads_per_block)
+Comparison::Comparison(Op_t op_type,
+                       Type_t element_type,
+                       size_t max_size,
+                       size_t num_blocks,
+                       size_t threads_per_block,
+                       bool packed_output)
     : op_type_{op_type},
       element_type_{element_type},
       max_size_{max_size},
       num_blocks_{num_blocks},
-      threads_per_block_{threads_per_block} {}
+      threads_per_block_{threads_per_block},
+      packed_output_{packed_output} {}
 
 void Comparison::operator()(const cudaStream_t stream,
                             const void* left_src,
@@ -150,6 +195,17 @@ void Comparison::Call(const cudaStream_t stream,
                       const size_t* right_brcst_offsets,
                       const size_t* output_sizes,
                       void* dst) const {
+    if (packed_output_) {
+        comparison_packed<T, OpImpl<T, OP>>
+            <<<num_blocks_, threads_per_block_, 0, stream>>>(max_size_,
+                                                             static_cast<const T*>(left_src),
+                                                             static_cast<const T*>(right_src),
+                                                             left_brcst_offsets,
+                                                             right_brcst_offsets,
+                                                             output_sizes,
+                                                             static_cast<uint32_t*>(dst));
+        return;
+    }
     comparison<T, OpImpl<T, OP>><<<num_blocks_, threads_per_block_, 0, stream>>>(max_size_,
                                                                                  static_cast<const T*>(left_src),
                                                                                  static_cast<const T*>(right_src),
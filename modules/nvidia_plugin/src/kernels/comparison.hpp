@@ -15,7 +15,12 @@ class Comparison {
 public:
     enum class Op_t { GREATER, LESS };
 
-    Comparison(Op_t op, Type_t element_type, size_t max_size, size_t num_blocks, size_t threads_per_block);
+    Comparison(Op_t op,
+               Type_t element_type,
+               size_t max_size,
+               size_t num_blocks,
+               size_t threads_per_block,
+               bool packed_output);
     Comparison(Comparison&&) = default;
     Comparison& operator=(Comparison&&) = default;
 
@@ -51,6 +56,9 @@ private:
     size_t max_size_{};
     size_t num_blocks_{};
     size_t threads_per_block_{};
+    // Write 32 results per 32-bit word instead of one byte per element; requires
+    // every consumer to read the packed form (see ops/packed_bool_mask.hpp)
+    bool packed_output_{};
 };
 
 }  // namespace kernel
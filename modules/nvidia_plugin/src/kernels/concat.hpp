@@ -26,7 +26,8 @@ public:
            size_t chunkSize,
            size_t allChunkSize,
            size_t numBlocks,
-           size_t threadsPerBlock);
+           size_t threadsPerBlock,
+           unsigned device_arch);
     Concat(Concat&&) = default;
     Concat& operator=(Concat&&) = default;
 
@@ -39,6 +40,8 @@ public:
 private:
     template <typename T>
     void Call(cudaStream_t stream, const void* chunks, const void* const* src, void* dst) const;
+    void CallVectorized(
+        cudaStream_t stream, size_t element_size, const void* chunks, const void* const* src, void* dst) const;
 
     Type_t element_type_{};
     size_t num_inputs_{};
@@ -47,6 +50,10 @@ private:
     size_t all_chunk_size_{};
     size_t num_blocks_{};
     size_t threads_per_block_{};
+    // Ampere specialization selected once at LoadNetwork: chunks with a
+    // 16-divisible byte size are copied as uint4 vectors staged through
+    // shared memory with cp.async instead of one element per thread
+    bool async_vectorized_copy_{};
 };
 
 }  // namespace kernel
@@ -510,6 +510,133 @@ __global__ void detection_output_stage_1_caffe_nms(
     }
 }
 
+template <size_t NumPartitions, typename TDataType>
+__global__ void detection_output_stage_1_caffe_filter_sort(
+    const DetectionOutput::Attrs& attrs,
+    const CUDA::MDSpan<TDataType, CUDA::DExtents<3>> confPreds,
+    CUDA::MDVector<CUDA::Pair<TDataType, CUDA::Pair<int, int>>, 2> scorePerClassPrioIdxs) {
+    const auto image_idx = get_image_idx();
+    const auto class_idx = get_class_idx();
+    const auto workItemId = get_work_item_id();
+    const auto numWorkItems = get_work_group_size();
+    if (workItemId >= NumPartitions) {
+        __trap();
+    }
+
+    if (class_idx == attrs.background_label_id) {
+        return;
+    }
+
+    CUDA::Span<const TDataType> scores{&confPreds(image_idx, class_idx, 0), confPreds.extent(2)};
+    auto candidates = scorePerClassPrioIdxs(image_idx, class_idx);
+
+    // Every thread compacts its stripe of priors through a shared cursor;
+    // the slot order is arbitrary, the sort below restores it
+    __shared__ unsigned count;
+    if (workItemId == 0) {
+        count = 0;
+    }
+    __syncthreads();
+    for (int priorIdx = workItemId; priorIdx < scores.size(); priorIdx += numWorkItems) {
+        TDataType conf = scores[priorIdx];
+        if (conf > TDataType{attrs.confidence_threshold}) {
+            const unsigned slot = atomicAdd(&count, 1u);
+            candidates.begin()[slot] = CUDA::make_pair(conf, CUDA::make_pair(class_idx, priorIdx));
+        }
+    }
+    __syncthreads();
+    if (workItemId == 0) {
+        candidates.set_size(count);
+    }
+    __syncthreads();
+
+    SortScorePairDescend<TDataType, CUDA::Pair<int, int>> comparer{};
+    CUDA::algorithms::parallel::quick_sort_iterative<NumPartitions>(
+        candidates.begin(), candidates.end(), comparer, workItemId, numWorkItems);
+    __syncthreads();
+
+    if (workItemId == 0) {
+        if (-1 != attrs.top_k && candidates.size() > static_cast<size_t>(attrs.top_k)) {
+            candidates.resize(attrs.top_k);
+        }
+    }
+}
+
+template <typename TDataType>
+__global__ void detection_output_stage_1_caffe_bitmask_nms(
+    const DetectionOutput::Attrs& attrs,
+    const CUDA::MDSpan<NormalizedBBox<TDataType>, CUDA::DExtents<3>> decodeBboxes,
+    CUDA::MDVector<CUDA::Pair<TDataType, CUDA::Pair<int, int>>, 2> scorePerClassPrioIdxs,
+    CUDA::MDSpan<unsigned, CUDA::DExtents<3>> suppressionMasks,
+    CUDA::MDVector<int, 2> prioBoxIdxsByClass,
+    CUDA::Span<CUDA::DeviceAtomic<unsigned>> numDets) {
+    const auto image_idx = get_image_idx();
+    const auto class_idx = get_class_idx();
+    const auto workItemId = get_work_item_id();
+    const auto numWorkItems = get_work_group_size();
+
+    if (class_idx == attrs.background_label_id) {
+        return;
+    }
+
+    const int label = attrs.share_location ? 0 : class_idx;
+    CUDA::Span<const NormalizedBBox<TDataType>> bboxes{&decodeBboxes(image_idx, label, 0), decodeBboxes.extent(2)};
+    auto candidates = scorePerClassPrioIdxs(image_idx, class_idx);
+    const int num_candidates = candidates.size();
+    if (num_candidates == 0) {
+        return;
+    }
+
+    // One suppression bit per sorted candidate, packed into 32-bit words
+    CUDA::Span<unsigned> suppressed{&suppressionMasks(image_idx, class_idx, 0), suppressionMasks.extent(2)};
+    const int num_words = (num_candidates + 31) / 32;
+    for (int w = workItemId; w < num_words; w += numWorkItems) {
+        suppressed[w] = 0;
+    }
+    __syncthreads();
+
+    const int lane_idx = workItemId & 31;
+    const int warp_idx = workItemId / 32;
+    const int num_warps = numWorkItems / 32;
+    for (int i = 0; i < num_candidates; ++i) {
+        // All threads read the same word, so the skip is uniform across the block
+        if ((suppressed[i / 32] >> (i % 32)) & 1u) {
+            continue;
+        }
+        const NormalizedBBox<TDataType> kept_bbox = bboxes[candidates[i].second.second];
+        // Each warp votes on a 32-candidate word and publishes one mask update.
+        // Testing already suppressed candidates again is redundant but harmless:
+        // suppressed candidates never act as suppressors themselves
+        for (int w = (i + 1) / 32 + warp_idx; w < num_words; w += num_warps) {
+            const int j = w * 32 + lane_idx;
+            bool overlaps = false;
+            if (j > i && j < num_candidates && !((suppressed[w] >> lane_idx) & 1u)) {
+                overlaps = jaccard_overlap(kept_bbox, bboxes[candidates[j].second.second]) >
+                           TDataType{attrs.nms_threshold};
+            }
+            const unsigned vote = __ballot_sync(0xffffffffu, overlaps);
+            if (lane_idx == 0 && vote != 0) {
+                atomicOr(&suppressed[w], vote);
+            }
+        }
+        __syncthreads();
+    }
+
+    // Survivors keep their score order; the accepted list is short, so one
+    // thread serializes it
+    if (workItemId == 0) {
+        auto prioBoxIdxs = prioBoxIdxsByClass(image_idx, class_idx);
+        unsigned kept = 0;
+        for (int i = 0; i < num_candidates; ++i) {
+            if (!((suppressed[i / 32] >> (i % 32)) & 1u)) {
+                prioBoxIdxs.push_back(candidates[i].second.second);
+                ++kept;
+            }
+        }
+        numDets[image_idx] += kept;
+    }
+}
+
 template <typename TDataType>
 __global__ void detection_output_stage_1_mxnet_nms(
     const DetectionOutput::Attrs& attrs,
@@ -984,6 +1111,12 @@ DetectionOutput::DetectionOutput(const Type_t element_type,
       arm_location_size_{arm_location_size},
       result_size_{result_size} {}
 
+size_t DetectionOutput::numNmsMaskWords() const {
+    const size_t max_candidates =
+        (attrs_.top_k > -1) ? std::min(static_cast<size_t>(attrs_.top_k), attrs_.num_priors) : attrs_.num_priors;
+    return (max_candidates + 31) / 32;
+}
+
 template <typename TDataType>
 std::vector<size_t> DetectionOutput::getMutableWorkbufferSizes() const {
     const auto locationsSize = CUDA::MDSpan<NormalizedBBox<TDataType>, CUDA::DExtents<3>>::size_of(
@@ -1005,6 +1138,8 @@ std::vector<size_t> DetectionOutput::getMutableWorkbufferSizes() const {
         attrs_.num_classes * attrs_.num_priors, attrs_.num_images);
     const auto prioBoxIdxsByClassSize =
         CUDA::MDVector<int, 2>::size_of(attrs_.num_priors, attrs_.num_images, attrs_.num_classes);
+    const auto nmsBitmaskSize =
+        CUDA::MDSpan<unsigned, CUDA::DExtents<3>>::size_of(attrs_.num_images, attrs_.num_classes, numNmsMaskWords());
     const auto armLocationsSize = CUDA::MDSpan<NormalizedBBox<TDataType>, CUDA::DExtents<3>>::size_of(
         attrs_.num_images, attrs_.num_loc_classes, attrs_.num_priors);
 
@@ -1019,6 +1154,7 @@ std::vector<size_t> DetectionOutput::getMutableWorkbufferSizes() const {
     workbuffers.at(kTempScorePerClassPrioIdxs0WBIdx) = tempScorePerClassPrioIdxs0Size;
     workbuffers.at(kTempScorePerClassPrioIdxs1WBIdx) = tempScorePerClassPrioIdxs1Size;
     workbuffers.at(kPrioBoxIdxsByClassWBIdx) = prioBoxIdxsByClassSize;
+    workbuffers.at(kNmsBitmaskWBIdx) = nmsBitmaskSize;
     if (arm_location_size_ > 0) {
         workbuffers.at(kArmLocationsWBIdx) = armLocationsSize;
     }
@@ -1196,8 +1332,16 @@ void DetectionOutput::call(const CUDA::Stream& stream,
 #endif
 
     if (!attrs_.decrease_label_id) {
-        detection_output_stage_1_caffe_nms<<<dim3(attrs_.num_images, attrs_.num_classes, 1), 1, 0, stream.get()>>>(
-            dattrs, decodeBboxes, confPreds, tempScorePerClassPrioIdxs0, prioBoxIdxsByClass, numDets);
+        auto nmsMasks = CUDA::MDSpan<unsigned, CUDA::DExtents<3>>{
+            mutableWorkbuffers[kNmsBitmaskWBIdx].get(), attrs_.num_images, attrs_.num_classes, numNmsMaskWords()};
+        detection_output_stage_1_caffe_filter_sort<kNmsBlockSize>
+            <<<dim3(attrs_.num_images, attrs_.num_classes), kNmsBlockSize, 0, stream.get()>>>(
+                dattrs, confPreds, tempScorePerClassPrioIdxs0);
+        detection_output_stage_1_caffe_bitmask_nms<<<dim3(attrs_.num_images, attrs_.num_classes),
+                                                     kNmsBlockSize,
+                                                     0,
+                                                     stream.get()>>>(
+            dattrs, decodeBboxes, tempScorePerClassPrioIdxs0, nmsMasks, prioBoxIdxsByClass, numDets);
     } else {
         detection_output_stage_1_mxnet_nms<<<dim3(attrs_.num_images), 1, 0, stream.get()>>>(
             dattrs, decodeBboxes, confPreds, tempScorePerClassPrioIdxs1, prioBoxIdxsByClass, numDets);
@@ -74,12 +74,16 @@ public:
         kTempScorePerClassPrioIdxs0WBIdx,
         kTempScorePerClassPrioIdxs1WBIdx,
         kPrioBoxIdxsByClassWBIdx,
+        kNmsBitmaskWBIdx,
         kNumDetectionsWBIdx,
         kNumRequiredWB,
         kArmLocationsWBIdx = kNumRequiredWB,
         kNumOptionalWB,
     };
 
+    /// Threads per (image, class) block in the batched NMS stage
+    static constexpr size_t kNmsBlockSize = 256;
+
     DetectionOutput(Type_t element_type,
                     size_t max_threads_per_block,
                     size_t location_size,
@@ -116,6 +120,8 @@ protected:
               CUDA::DevicePointer<void*> result) const;
 
 private:
+    size_t numNmsMaskWords() const;
+
     Type_t element_type_{};
     Attrs attrs_;
     Attrs* dattrs_ptr_ = nullptr;
@@ -0,0 +1,120 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "cuda_type_traits.hpp"
+
+/*
+ * Build-time pruning of the element-type cross-product the kernel templates
+ * instantiate. By default every Type_t is compiled in; configuring CMake with
+ * CUDA_KERNEL_ELEMENT_TYPES (e.g. "f16;f32;i32" for an fp16-only deployment)
+ * defines CUDA_KERNEL_TYPE_PRUNING plus one CUDA_KERNEL_ENABLE_<TYPE> per
+ * selected type, and the type switches below compile the remaining types down
+ * to the same "type is not supported" error path a wrong type hits today -
+ * without instantiating their kernels.
+ */
+#ifdef CUDA_KERNEL_TYPE_PRUNING
+#ifndef CUDA_KERNEL_ENABLE_BOOLEAN
+#define CUDA_KERNEL_ENABLE_BOOLEAN 0
+#endif
+#ifndef CUDA_KERNEL_ENABLE_BF16
+#define CUDA_KERNEL_ENABLE_BF16 0
+#endif
+#ifndef CUDA_KERNEL_ENABLE_F16
+#define CUDA_KERNEL_ENABLE_F16 0
+#endif
+#ifndef CUDA_KERNEL_ENABLE_F32
+#define CUDA_KERNEL_ENABLE_F32 0
+#endif
+#ifndef CUDA_KERNEL_ENABLE_F64
+#define CUDA_KERNEL_ENABLE_F64 0
+#endif
+#ifndef CUDA_KERNEL_ENABLE_I8
+#define CUDA_KERNEL_ENABLE_I8 0
+#endif
+#ifndef CUDA_KERNEL_ENABLE_I16
+#define CUDA_KERNEL_ENABLE_I16 0
+#endif
+#ifndef CUDA_KERNEL_ENABLE_I32
+#define CUDA_KERNEL_ENABLE_I32 0
+#endif
+#ifndef CUDA_KERNEL_ENABLE_I64
+#define CUDA_KERNEL_ENABLE_I64 0
+#endif
+#ifndef CUDA_KERNEL_ENABLE_U8
+#define CUDA_KERNEL_ENABLE_U8 0
+#endif
+#ifndef CUDA_KERNEL_ENABLE_U16
+#define CUDA_KERNEL_ENABLE_U16 0
+#endif
+#ifndef CUDA_KERNEL_ENABLE_U32
+#define CUDA_KERNEL_ENABLE_U32 0
+#endif
+#ifndef CUDA_KERNEL_ENABLE_U64
+#define CUDA_KERNEL_ENABLE_U64 0
+#endif
+#else
+#define CUDA_KERNEL_ENABLE_BOOLEAN 1
+#define CUDA_KERNEL_ENABLE_BF16 1
+#define CUDA_KERNEL_ENABLE_F16 1
+#define CUDA_KERNEL_ENABLE_F32 1
+#define CUDA_KERNEL_ENABLE_F64 1
+#define CUDA_KERNEL_ENABLE_I8 1
+#define CUDA_KERNEL_ENABLE_I16 1
+#define CUDA_KERNEL_ENABLE_I32 1
+#define CUDA_KERNEL_ENABLE_I64 1
+#define CUDA_KERNEL_ENABLE_U8 1
+#define CUDA_KERNEL_ENABLE_U16 1
+#define CUDA_KERNEL_ENABLE_U32 1
+#define CUDA_KERNEL_ENABLE_U64 1
+#endif
+
+namespace ov {
+namespace nvidia_gpu {
+namespace kernel {
+
+constexpr bool isElementTypeEnabled(Type_t type) {
+    switch (type) {
+        case Type_t::boolean:
+            return CUDA_KERNEL_ENABLE_BOOLEAN;
+#ifdef CUDA_HAS_BF16_TYPE
+        case Type_t::bf16:
+            return CUDA_KERNEL_ENABLE_BF16;
+#endif
+        case Type_t::f16:
+            return CUDA_KERNEL_ENABLE_F16;
+        case Type_t::f32:
+            return CUDA_KERNEL_ENABLE_F32;
+        case Type_t::f64:
+            return CUDA_KERNEL_ENABLE_F64;
+        case Type_t::i8:
+            return CUDA_KERNEL_ENABLE_I8;
+        case Type_t::i16:
+            return CUDA_KERNEL_ENABLE_I16;
+        case Type_t::i32:
+            return CUDA_KERNEL_ENABLE_I32;
+        case Type_t::i64:
+            return CUDA_KERNEL_ENABLE_I64;
+        case Type_t::u8:
+            return CUDA_KERNEL_ENABLE_U8;
+        case Type_t::u16:
+            return CUDA_KERNEL_ENABLE_U16;
+        case Type_t::u32:
+            return CUDA_KERNEL_ENABLE_U32;
+        case Type_t::u64:
+            return CUDA_KERNEL_ENABLE_U64;
+        default:
+            // Sub-byte types are handled explicitly by the few ops that
+            // support them and are not part of the pruned cross-product
+            return true;
+    }
+}
+
+template <Type_t... Types>
+inline constexpr bool all_element_types_enabled = (isElementTypeEnabled(Types) && ...);
+
+}  // namespace kernel
+}  // namespace nvidia_gpu
+}  // namespace ov
@@ -7,6 +7,7 @@
 #include <cuda/float16.hpp>
 
 #include "cuda_type_traits.hpp"
+#include "element_type_pruning.hpp"
 #include "switch.hpp"
 
 namespace ov {
@@ -35,21 +36,51 @@ struct ElementTypesSwitch {
     }
 };
 
-using AllElementTypesSwitch = ElementTypesSwitch<Type_t::boolean,
-#ifdef CUDA_HAS_BF16_TYPE
-                                                 Type_t::bf16,
-#endif
-                                                 Type_t::f16,
-                                                 Type_t::f32,
-                                                 Type_t::f64,
-                                                 Type_t::i8,
-                                                 Type_t::i16,
-                                                 Type_t::i32,
-                                                 Type_t::i64,
-                                                 Type_t::u8,
-                                                 Type_t::u16,
-                                                 Type_t::u32,
-                                                 Type_t::u64>;
+// Types pruned from the build (see element_type_pruning.hpp) drop out of the
+// list, so switch_() routes them to the consumer's default_ - the same
+// "type is not supported" path a wrong type takes - without their kernels
+// ever being instantiated
+using AllElementTypesSwitch = ElementTypesSwitch<
+#if CUDA_KERNEL_ENABLE_BOOLEAN
+    Type_t::boolean,
+#endif
+#if defined(CUDA_HAS_BF16_TYPE) && CUDA_KERNEL_ENABLE_BF16
+    Type_t::bf16,
+#endif
+#if CUDA_KERNEL_ENABLE_F16
+    Type_t::f16,
+#endif
+#if CUDA_KERNEL_ENABLE_F64
+    Type_t::f64,
+#endif
+#if CUDA_KERNEL_ENABLE_I8
+    Type_t::i8,
+#endif
+#if CUDA_KERNEL_ENABLE_I16
+    Type_t::i16,
+#endif
+#if CUDA_KERNEL_ENABLE_I32
+    Type_t::i32,
+#endif
+#if CUDA_KERNEL_ENABLE_I64
+    Type_t::i64,
+#endif
+#if CUDA_KERNEL_ENABLE_U8
+    Type_t::u8,
+#endif
+#if CUDA_KERNEL_ENABLE_U16
+    Type_t::u16,
+#endif
+#if CUDA_KERNEL_ENABLE_U32
+    Type_t::u32,
+#endif
+#if CUDA_KERNEL_ENABLE_U64
+    Type_t::u64,
+#endif
+    // f32 always closes the list: it cannot be pruned since reference
+    // fallbacks and preprocessing rely on it, and a trailing fixed entry keeps
+    // the template argument list well-formed for any selection
+    Type_t::f32>;
 
 }  // namespace kernel
 }  // namespace nvidia_gpu
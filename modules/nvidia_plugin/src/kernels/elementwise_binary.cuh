@@ -7,12 +7,16 @@
 #include <fmt/format.h>
 
 #include <gsl/gsl_assert>
+#include <string>
 #include <tuple>
+#include <typeinfo>
 #include <utility>
 
 #include "cuda_type_traits.hpp"
 #include "elementtypeswitch.hpp"
+#include "elementwise_packet.cuh"
 #include "error.hpp"
+#include "launch_config.hpp"
 #include "numpy_broadcast_mapper.cuh"
 #include "tensor_helpers.hpp"
 
@@ -30,6 +34,32 @@ __global__ void elementwise_binary(const T* in0, const T* in1, T* out, size_t ou
     }
 }
 
+/**
+ * Vectorized variant processing one 128-bit packet per thread via grid-stride
+ * loops; the elements past the last whole packet are handled as scalars.
+ * Requires in0/in1/out to be aligned to kElementwisePacketBytes.
+ */
+template <typename T, typename OP, typename... Args>
+__global__ void elementwise_binary_vectorized(
+    const T* in0, const T* in1, T* out, size_t num_packets, size_t num_elements, Args... args) {
+    constexpr size_t lanes = packet_lanes<T>();
+    const size_t start = blockIdx.x * blockDim.x + threadIdx.x;
+    const size_t stride = static_cast<size_t>(blockDim.x) * gridDim.x;
+    for (size_t p = start; p < num_packets; p += stride) {
+        const ElementwisePacket<T> packet0 = reinterpret_cast<const ElementwisePacket<T>*>(in0)[p];
+        const ElementwisePacket<T> packet1 = reinterpret_cast<const ElementwisePacket<T>*>(in1)[p];
+        ElementwisePacket<T> result;
+#pragma unroll
+        for (size_t l = 0; l < lanes; ++l) {
+            result.lane[l] = OP::op(packet0.lane[l], packet1.lane[l], args...);
+        }
+        reinterpret_cast<ElementwisePacket<T>*>(out)[p] = result;
+    }
+    for (size_t i = num_packets * lanes + start; i < num_elements; i += stride) {
+        out[i] = OP::op(in0[i], in1[i], args...);
+    }
+}
+
 template <typename T, typename OP, typename... Args>
 __global__ void elementwise_binary_broadcasting(const T* in0,
                                                 NumpyBroadcastMapper in0_mapper,
@@ -46,14 +76,78 @@ __global__ void elementwise_binary_broadcasting(const T* in0,
     }
 }
 
+/**
+ * Broadcasting variant for the case when one operand is a small parameter
+ * tensor, e.g. the per-channel PRelu slopes. The whole parameter is staged
+ * into shared memory once per block, so every element reads it from shared
+ * memory instead of re-fetching the same few values from global memory.
+ * Launched with cache_num_elements * sizeof(T) bytes of dynamic shared memory.
+ */
+template <typename T, typename OP, typename... Args>
+__global__ void elementwise_binary_broadcasting_cached(const T* in0,
+                                                       NumpyBroadcastMapper in0_mapper,
+                                                       const T* in1,
+                                                       NumpyBroadcastMapper in1_mapper,
+                                                       bool cache_in0,
+                                                       size_t cache_num_elements,
+                                                       T* out,
+                                                       size_t out_num_elements,
+                                                       Args... args) {
+    extern __shared__ unsigned char cache_storage[];
+    T* cache = reinterpret_cast<T*>(cache_storage);
+    const T* cached_in = cache_in0 ? in0 : in1;
+    for (unsigned i = threadIdx.x; i < cache_num_elements; i += blockDim.x) {
+        cache[i] = cached_in[i];
+    }
+    __syncthreads();
+    const unsigned out_index = blockIdx.x * blockDim.x + threadIdx.x;
+    if (out_index < out_num_elements) {
+        const T* from0 = cache_in0 ? cache : in0;
+        const T* from1 = cache_in0 ? in1 : cache;
+        out[out_index] =
+            OP::op(from0[in0_mapper.srcIndex(out_index)], from1[in1_mapper.srcIndex(out_index)], args...);
+    }
+}
+
 #endif  // __CUDACC__
 
 template <typename ElementTypes, template <typename> typename OP>
 class ElementwiseBinary {
 public:
-    ElementwiseBinary(Type_t element_type, size_t out_num_elements, size_t max_threads_per_block)
+    // The whole parameter has to fit in shared memory without denting occupancy
+    static constexpr size_t kMaxCachedParamElements = 1024;
+
+    /**
+     * The operand element counts are optional: when a caller provides them and
+     * one operand is a small broadcast parameter, the broadcasting path stages
+     * that operand in shared memory (see elementwise_binary_broadcasting_cached)
+     */
+    ElementwiseBinary(Type_t element_type,
+                      size_t out_num_elements,
+                      size_t max_threads_per_block,
+                      size_t in0_num_elements = 0,
+                      size_t in1_num_elements = 0)
         : num_blocks_{}, threads_per_block_{}, element_type_{element_type}, out_num_elements_{out_num_elements} {
-        std::tie(num_blocks_, threads_per_block_) = calculateElementwiseGrid(out_num_elements, max_threads_per_block);
+        const size_t lanes = packetLanes(element_type);
+        if (lanes > 0 && out_num_elements_ >= lanes) {
+            num_packets_ = out_num_elements_ / lanes;
+        }
+        size_t scalar_block = max_threads_per_block;
+        size_t vec_block = max_threads_per_block;
+        ElementTypes::switch_(element_type, BlockSizeTuner{}, out_num_elements_, num_packets_, scalar_block, vec_block);
+        std::tie(num_blocks_, threads_per_block_) = calculateElementwiseGrid(out_num_elements_, scalar_block);
+        if (num_packets_ > 0) {
+            std::tie(vec_num_blocks_, vec_threads_per_block_) = calculateElementwiseGrid(num_packets_, vec_block);
+        }
+        const auto qualifies = [out_num_elements](size_t n) {
+            return n > 0 && n < out_num_elements && n <= kMaxCachedParamElements;
+        };
+        if (qualifies(in0_num_elements) && (!qualifies(in1_num_elements) || in0_num_elements <= in1_num_elements)) {
+            cache_in0_ = true;
+            cache_num_elements_ = in0_num_elements;
+        } else if (qualifies(in1_num_elements)) {
+            cache_num_elements_ = in1_num_elements;
+        }
     }
 
     template <typename... Args>
@@ -84,6 +178,41 @@ public:
 private:
     friend ElementTypes;
 
+    /**
+     * Resolves the block sizes through the launch-config provider once, at
+     * construction. The no-extra-argument kernel instantiation stands in for
+     * the launched one: trailing scalar arguments do not change the register
+     * footprint enough to move the occupancy optimum.
+     */
+    struct BlockSizeTuner {
+        template <typename T>
+        void case_(size_t num_elements, size_t num_packets, size_t& scalar_block, size_t& vec_block) const noexcept {
+#ifdef __CUDACC__
+            // The operation type is part of the tag: different functors have
+            // different register footprints and occupancy optima
+            const std::string tag = std::string{"elementwise_binary|"} + typeid(OP<T>).name();
+            scalar_block = LaunchConfigProvider::instance().blockSize(
+                reinterpret_cast<const void*>(&elementwise_binary<T, OP<T>>),
+                tag.c_str(),
+                num_elements,
+                scalar_block);
+            if constexpr (packet_lanes<T>() > 0) {
+                if (num_packets > 0) {
+                    const std::string vec_tag = std::string{"elementwise_binary_vectorized|"} + typeid(OP<T>).name();
+                    vec_block = LaunchConfigProvider::instance().blockSize(
+                        reinterpret_cast<const void*>(&elementwise_binary_vectorized<T, OP<T>>),
+                        vec_tag.c_str(),
+                        num_packets,
+                        vec_block);
+                }
+            }
+#endif  // __CUDACC__
+        }
+
+        template <typename T, typename... Args>
+        void default_(T, Args&&...) const noexcept {}
+    };
+
     template <typename T, typename... Args>
     constexpr void case_(cudaStream_t stream,
                          const void* in0,
@@ -93,6 +222,20 @@ private:
                          void* out,
                          Args&&... args) const noexcept {
 #ifdef __CUDACC__
+        if (cache_num_elements_ > 0) {
+            elementwise_binary_broadcasting_cached<T, OP<T>>
+                <<<num_blocks_, threads_per_block_, cache_num_elements_ * sizeof(T), stream>>>(
+                    static_cast<const T*>(in0),
+                    in0_mapper,
+                    static_cast<const T*>(in1),
+                    in1_mapper,
+                    cache_in0_,
+                    cache_num_elements_,
+                    static_cast<T*>(out),
+                    out_num_elements_,
+                    std::forward<Args>(args)...);
+            return;
+        }
         elementwise_binary_broadcasting<T, OP<T>>
             <<<num_blocks_, threads_per_block_, 0, stream>>>(static_cast<const T*>(in0),
                                                              in0_mapper,
@@ -120,6 +263,18 @@ private:
     constexpr void case_(
         cudaStream_t stream, const void* in0, const void* in1, void* out, Args&&... args) const noexcept {
 #ifdef __CUDACC__
+        if constexpr (packet_lanes<T>() > 0) {
+            if (num_packets_ > 0 && isPacketAligned(in0) && isPacketAligned(in1) && isPacketAligned(out)) {
+                elementwise_binary_vectorized<T, OP<T>>
+                    <<<vec_num_blocks_, vec_threads_per_block_, 0, stream>>>(static_cast<const T*>(in0),
+                                                                             static_cast<const T*>(in1),
+                                                                             static_cast<T*>(out),
+                                                                             num_packets_,
+                                                                             out_num_elements_,
+                                                                             std::forward<Args>(args)...);
+                return;
+            }
+        }
         elementwise_binary<T, OP<T>><<<num_blocks_, threads_per_block_, 0, stream>>>(static_cast<const T*>(in0),
                                                                                      static_cast<const T*>(in1),
                                                                                      static_cast<T*>(out),
@@ -138,6 +293,14 @@ private:
     size_t threads_per_block_;
     Type_t element_type_;
     size_t out_num_elements_;
+    // Grid of the vectorized kernel; num_packets_ == 0 when the tensor is too
+    // small or the element type cannot be packed
+    size_t num_packets_{};
+    size_t vec_num_blocks_{};
+    size_t vec_threads_per_block_{};
+    // Shared-memory staging of a small broadcast operand; 0 disables the cache
+    size_t cache_num_elements_{};
+    bool cache_in0_{};
 };
 
 }  // namespace kernel
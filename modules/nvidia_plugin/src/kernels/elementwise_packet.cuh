@@ -0,0 +1,74 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "cuda_type_traits.hpp"
+
+namespace ov {
+namespace nvidia_gpu {
+namespace kernel {
+
+/**
+ * Elementwise kernels are memory bound, so when the tensors are contiguous and
+ * suitably aligned they process 128-bit packets instead of single scalars,
+ * letting every thread issue full-width load/store transactions.
+ */
+constexpr size_t kElementwisePacketBytes = 16;
+
+/** Number of elements of T in one packet, or 0 if T cannot be packed. */
+template <typename T>
+constexpr size_t packet_lanes() {
+    return (sizeof(T) <= kElementwisePacketBytes && kElementwisePacketBytes % sizeof(T) == 0)
+               ? kElementwisePacketBytes / sizeof(T)
+               : 0;
+}
+
+/**
+ * 128-bit packet of elements of T. The alignment makes nvcc emit a single
+ * vectorized load/store per packet. Must only be instantiated for types with
+ * packet_lanes() > 0.
+ */
+template <typename T>
+struct alignas(kElementwisePacketBytes) ElementwisePacket {
+    T lane[packet_lanes<T>()];
+};
+
+inline bool isPacketAligned(const void* ptr) {
+    return reinterpret_cast<std::uintptr_t>(ptr) % kElementwisePacketBytes == 0;
+}
+
+/** Runtime counterpart of packet_lanes() for grid precomputation. */
+inline size_t packetLanes(Type_t element_type) {
+    switch (element_type) {
+        case Type_t::boolean:
+        case Type_t::i8:
+        case Type_t::u8:
+            return kElementwisePacketBytes;
+#ifdef CUDA_HAS_BF16_TYPE
+        case Type_t::bf16:
+#endif
+        case Type_t::f16:
+        case Type_t::i16:
+        case Type_t::u16:
+            return kElementwisePacketBytes / 2;
+        case Type_t::f32:
+        case Type_t::i32:
+        case Type_t::u32:
+            return kElementwisePacketBytes / 4;
+        case Type_t::f64:
+        case Type_t::i64:
+        case Type_t::u64:
+            return kElementwisePacketBytes / 8;
+        default:
+            return 0;
+    }
+}
+
+}  // namespace kernel
+}  // namespace nvidia_gpu
+}  // namespace ov
@@ -7,12 +7,16 @@
 #include <fmt/format.h>
 
 #include <gsl/gsl_assert>
+#include <string>
 #include <tuple>
+#include <typeinfo>
 #include <utility>
 
 #include "cuda_type_traits.hpp"
 #include "elementtypeswitch.hpp"
+#include "elementwise_packet.cuh"
 #include "error.hpp"
+#include "launch_config.hpp"
 #include "tensor_helpers.hpp"
 #ifdef __CUDACC__
 #include "cuda/math.cuh"
@@ -32,6 +36,29 @@ __global__ void elementwise_unary(const T* in, size_t num_elements, T* out, Args
     }
 }
 
+/**
+ * Vectorized variant processing one 128-bit packet per thread via grid-stride
+ * loops; the elements past the last whole packet are handled as scalars.
+ * Requires in/out to be aligned to kElementwisePacketBytes.
+ */
+template <typename T, typename OP, typename... Args>
+__global__ void elementwise_unary_vectorized(const T* in, size_t num_packets, size_t num_elements, T* out, Args... args) {
+    constexpr size_t lanes = packet_lanes<T>();
+    const size_t start = blockIdx.x * blockDim.x + threadIdx.x;
+    const size_t stride = static_cast<size_t>(blockDim.x) * gridDim.x;
+    for (size_t p = start; p < num_packets; p += stride) {
+        ElementwisePacket<T> packet = reinterpret_cast<const ElementwisePacket<T>*>(in)[p];
+#pragma unroll
+        for (size_t l = 0; l < lanes; ++l) {
+            packet.lane[l] = OP::op(packet.lane[l], args...);
+        }
+        reinterpret_cast<ElementwisePacket<T>*>(out)[p] = packet;
+    }
+    for (size_t i = num_packets * lanes + start; i < num_elements; i += stride) {
+        out[i] = OP::op(in[i], args...);
+    }
+}
+
 #endif  // __CUDACC__
 
 template <typename ElementTypes, template <typename> typename OP>
@@ -39,7 +66,17 @@ class ElementwiseUnary {
 public:
     ElementwiseUnary(Type_t element_type, size_t max_threads_per_block, size_t num_elements)
         : element_type_{element_type}, num_elements_{num_elements} {
-        std::tie(num_blocks_, threads_per_block_) = calculateElementwiseGrid(num_elements_, max_threads_per_block);
+        const size_t lanes = packetLanes(element_type);
+        if (lanes > 0 && num_elements_ >= lanes) {
+            num_packets_ = num_elements_ / lanes;
+        }
+        size_t scalar_block = max_threads_per_block;
+        size_t vec_block = max_threads_per_block;
+        ElementTypes::switch_(element_type, BlockSizeTuner{}, num_elements_, num_packets_, scalar_block, vec_block);
+        std::tie(num_blocks_, threads_per_block_) = calculateElementwiseGrid(num_elements_, scalar_block);
+        if (num_packets_ > 0) {
+            std::tie(vec_num_blocks_, vec_threads_per_block_) = calculateElementwiseGrid(num_packets_, vec_block);
+        }
     }
 
     /**
@@ -53,6 +90,17 @@ public:
     template <typename T, typename... Args>
     constexpr void callKernel(cudaStream_t stream, const void* in, void* out, Args&&... args) const noexcept {
 #ifdef __CUDACC__
+        if constexpr (packet_lanes<T>() > 0) {
+            if (num_packets_ > 0 && isPacketAligned(in) && isPacketAligned(out)) {
+                elementwise_unary_vectorized<T, OP<T>>
+                    <<<vec_num_blocks_, vec_threads_per_block_, 0, stream>>>(static_cast<const T*>(in),
+                                                                             num_packets_,
+                                                                             num_elements_,
+                                                                             static_cast<T*>(out),
+                                                                             std::forward<Args>(args)...);
+                return;
+            }
+        }
         elementwise_unary<T, OP<T>><<<num_blocks_, threads_per_block_, 0, stream>>>(
             static_cast<const T*>(in), num_elements_, static_cast<T*>(out), std::forward<Args>(args)...);
 #endif  // __CUDACC__
@@ -69,10 +117,50 @@ public:
     }
 
 private:
+    /**
+     * Resolves the block sizes through the launch-config provider once, at
+     * construction. The no-extra-argument kernel instantiation stands in for
+     * the launched one: trailing scalar arguments do not change the register
+     * footprint enough to move the occupancy optimum.
+     */
+    struct BlockSizeTuner {
+        template <typename T>
+        void case_(size_t num_elements, size_t num_packets, size_t& scalar_block, size_t& vec_block) const noexcept {
+#ifdef __CUDACC__
+            // The operation type is part of the tag: different functors have
+            // different register footprints and occupancy optima
+            const std::string tag = std::string{"elementwise_unary|"} + typeid(OP<T>).name();
+            scalar_block = LaunchConfigProvider::instance().blockSize(
+                reinterpret_cast<const void*>(&elementwise_unary<T, OP<T>>),
+                tag.c_str(),
+                num_elements,
+                scalar_block);
+            if constexpr (packet_lanes<T>() > 0) {
+                if (num_packets > 0) {
+                    const std::string vec_tag = std::string{"elementwise_unary_vectorized|"} + typeid(OP<T>).name();
+                    vec_block = LaunchConfigProvider::instance().blockSize(
+                        reinterpret_cast<const void*>(&elementwise_unary_vectorized<T, OP<T>>),
+                        vec_tag.c_str(),
+                        num_packets,
+                        vec_block);
+                }
+            }
+#endif  // __CUDACC__
+        }
+
+        template <typename T, typename... Args>
+        void default_(T, Args&&...) const noexcept {}
+    };
+
     Type_t element_type_;
     size_t num_elements_;
     size_t num_blocks_;
     size_t threads_per_block_;
+    // Grid of the vectorized kernel; num_packets_ == 0 when the tensor is too
+    // small or the element type cannot be packed
+    size_t num_packets_{};
+    size_t vec_num_blocks_{};
+    size_t vec_threads_per_block_{};
 };
 
 }  // namespace kernel
@@ -51,6 +51,29 @@ static __global__ void fake_quantize(size_t max_size,
     }
 }
 
+template <typename T>
+static __global__ void fake_quantize_lut(size_t max_size,
+                                         int levels_1,
+                                         const T* arg,
+                                         const float* lut,
+                                         const float* in_low,
+                                         const float* in_scale,
+                                         NumpyBroadcastMapper channel_mapper,
+                                         T* out) {
+    const unsigned idx = blockIdx.x * blockDim.x + threadIdx.x;
+    if (idx >= max_size) {
+        return;
+    }
+
+    const unsigned channel = channel_mapper.srcIndex(idx);
+    const float value = static_cast<float>(arg[idx]);
+
+    int level = static_cast<int>(CUDA::math::round((value - in_low[channel]) * in_scale[channel]));
+    level = level < 0 ? 0 : (level > levels_1 ? levels_1 : level);
+
+    out[idx] = static_cast<T>(lut[channel * (levels_1 + 1) + level]);
+}
+
 FakeQuantize::FakeQuantize(Type_t element_type, std::size_t max_size, std::size_t threads_per_block, std::size_t levels)
     : element_type_{element_type}, max_size_{max_size}, threads_per_block_{threads_per_block}, levels_{levels} {
     std::tie(num_blocks_, threads_per_block_) = calculateElementwiseGrid(max_size_, threads_per_block_);
@@ -156,6 +179,55 @@ void FakeQuantize::Call(const cudaStream_t stream,
                                                                              static_cast<T*>(out));
 }
 
+FakeQuantizeLut::FakeQuantizeLut(Type_t element_type,
+                                 std::size_t max_size,
+                                 std::size_t threads_per_block,
+                                 std::size_t levels)
+    : element_type_{element_type}, max_size_{max_size}, threads_per_block_{threads_per_block}, levels_{levels} {
+    std::tie(num_blocks_, threads_per_block_) = calculateElementwiseGrid(max_size_, threads_per_block_);
+}
+
+void FakeQuantizeLut::operator()(const cudaStream_t stream,
+                                 const void* arg,
+                                 const void* lut,
+                                 const void* in_low,
+                                 const void* in_scale,
+                                 const NumpyBroadcastMapper& channel_mapper,
+                                 void* out) const {
+    switch (element_type_) {
+#ifdef CUDA_HAS_BF16_TYPE
+        case Type_t::bf16:
+            return Call<__nv_bfloat16>(stream, arg, lut, in_low, in_scale, channel_mapper, out);
+#endif
+        case Type_t::f16:
+            return Call<__half>(stream, arg, lut, in_low, in_scale, channel_mapper, out);
+        case Type_t::f32:
+            return Call<float>(stream, arg, lut, in_low, in_scale, channel_mapper, out);
+        default:
+            throwIEException(
+                fmt::format("Input element type = {} is not supported by FakeQuantizeLut operation !!", element_type_));
+    }
+}
+
+template <typename T>
+void FakeQuantizeLut::Call(const cudaStream_t stream,
+                           const void* arg,
+                           const void* lut,
+                           const void* in_low,
+                           const void* in_scale,
+                           const NumpyBroadcastMapper& channel_mapper,
+                           void* out) const {
+    kernel::fake_quantize_lut<T>
+        <<<num_blocks_, threads_per_block_, 0, stream>>>(max_size_,
+                                                         static_cast<int>(levels_ - 1),
+                                                         static_cast<const T*>(arg),
+                                                         static_cast<const float*>(lut),
+                                                         static_cast<const float*>(in_low),
+                                                         static_cast<const float*>(in_scale),
+                                                         channel_mapper,
+                                                         static_cast<T*>(out));
+}
+
 }  // namespace kernel
 }  // namespace nvidia_gpu
 }  // namespace ov
@@ -53,6 +53,47 @@ private:
     std::size_t levels_{};
 };
 
+/**
+ * Table-driven FakeQuantize for small level counts.
+ *
+ * When all four range inputs are constants the output value is fully
+ * determined by the quantization level of the input, so the host
+ * precomputes a per-channel table of the at most 256 possible output
+ * values together with a per-channel scale/offset pair. The kernel then
+ * replaces the per-element divide/round/rescale chain with one fused
+ * multiply-add, a clamp and a single table gather.
+ */
+class FakeQuantizeLut {
+public:
+    FakeQuantizeLut(Type_t element_type, std::size_t max_size, std::size_t threads_per_block, std::size_t levels);
+    FakeQuantizeLut(FakeQuantizeLut&&) = default;
+    FakeQuantizeLut& operator=(FakeQuantizeLut&&) = default;
+
+    void operator()(const cudaStream_t stream,
+                    const void* arg,
+                    const void* lut,
+                    const void* in_low,
+                    const void* in_scale,
+                    const NumpyBroadcastMapper& channel_mapper,
+                    void* out) const;
+
+private:
+    template <typename T>
+    void Call(const cudaStream_t stream,
+              const void* arg,
+              const void* lut,
+              const void* in_low,
+              const void* in_scale,
+              const NumpyBroadcastMapper& channel_mapper,
+              void* out) const;
+
+    Type_t element_type_{};
+    std::size_t max_size_{};
+    std::size_t num_blocks_{};
+    std::size_t threads_per_block_{};
+    std::size_t levels_{};
+};
+
 }  // namespace kernel
 }  // namespace nvidia_gpu
 }  // namespace ov
@@ -0,0 +1,185 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <fmt/format.h>
+
+#include <cuda/float16.hpp>
+#include <cuda/math.cuh>
+#include <type_traits>
+
+#include "error.hpp"
+#include "fused_color_preprocess.hpp"
+#include "tensor_helpers.hpp"
+
+namespace ov {
+namespace nvidia_gpu {
+namespace kernel {
+
+template <typename TIn>
+static __device__ void sample_rgb(const FusedColorPreprocess::Params& params,
+                                  const TIn* y_plane,
+                                  const TIn* u_plane,
+                                  const TIn* v_plane,
+                                  const unsigned h,
+                                  const unsigned w,
+                                  float& r,
+                                  float& g,
+                                  float& b) {
+    const float y_val = static_cast<float>(y_plane[h * params.src_w + w]);
+    float u_val;
+    float v_val;
+    if (params.source_format == FusedColorPreprocess::SourceFormat::NV12) {
+        const size_t uv_index = (h / 2) * params.src_w + (w / 2) * 2;
+        u_val = static_cast<float>(u_plane[uv_index]);
+        v_val = static_cast<float>(u_plane[uv_index + 1]);
+    } else {
+        const size_t uv_index = (h / 2) * (params.src_w / 2) + (w / 2);
+        u_val = static_cast<float>(u_plane[uv_index]);
+        v_val = static_cast<float>(v_plane[uv_index]);
+    }
+    yuv_pixel_to_rgb(y_val, u_val, v_val, r, g, b);
+}
+
+template <typename TOut>
+static __device__ TOut cast_output(const float v) {
+    if (std::is_integral<TOut>::value) {
+        return static_cast<TOut>(CUDA::math::round(v));
+    }
+    return static_cast<TOut>(v);
+}
+
+template <typename TIn, typename TOut>
+static __global__ void fused_color_preprocess(const FusedColorPreprocess::Params params,
+                                              const TIn* arg_y,
+                                              const TIn* arg_u,
+                                              const TIn* arg_v,
+                                              TOut* out_ptr) {
+    const unsigned idx = blockIdx.x * blockDim.x + threadIdx.x;
+    if (idx >= params.batch_size * params.dst_h * params.dst_w) {
+        return;
+    }
+
+    const unsigned w = idx % params.dst_w;
+    const unsigned h = (idx / params.dst_w) % params.dst_h;
+    const unsigned batch = idx / (params.dst_w * params.dst_h);
+
+    const TIn* y_plane = arg_y + batch * params.stride_y;
+    const TIn* u_plane = arg_u + batch * params.stride_uv;
+    const TIn* v_plane = arg_v ? arg_v + batch * params.stride_uv : nullptr;
+
+    float r, g, b;
+    if (!params.resize) {
+        sample_rgb(params, y_plane, u_plane, v_plane, h, w, r, g, b);
+    } else {
+        // Half-pixel source coordinates; each neighbor is converted to clipped
+        // RGB before blending, like a resize running on the converted frame
+        const float in_h =
+            CUDA::math::max((h + 0.5f) * static_cast<float>(params.src_h) / params.dst_h - 0.5f, 0.0f);
+        const float in_w =
+            CUDA::math::max((w + 0.5f) * static_cast<float>(params.src_w) / params.dst_w - 0.5f, 0.0f);
+        const unsigned h0 = static_cast<unsigned>(in_h);
+        const unsigned w0 = static_cast<unsigned>(in_w);
+        const unsigned h1 = CUDA::math::min(h0 + 1, static_cast<unsigned>(params.src_h - 1));
+        const unsigned w1 = CUDA::math::min(w0 + 1, static_cast<unsigned>(params.src_w - 1));
+        const float dh = in_h - h0;
+        const float dw = in_w - w0;
+
+        float r00, g00, b00, r01, g01, b01, r10, g10, b10, r11, g11, b11;
+        sample_rgb(params, y_plane, u_plane, v_plane, h0, w0, r00, g00, b00);
+        sample_rgb(params, y_plane, u_plane, v_plane, h0, w1, r01, g01, b01);
+        sample_rgb(params, y_plane, u_plane, v_plane, h1, w0, r10, g10, b10);
+        sample_rgb(params, y_plane, u_plane, v_plane, h1, w1, r11, g11, b11);
+        r = (1.0f - dh) * ((1.0f - dw) * r00 + dw * r01) + dh * ((1.0f - dw) * r10 + dw * r11);
+        g = (1.0f - dh) * ((1.0f - dw) * g00 + dw * g01) + dh * ((1.0f - dw) * g10 + dw * g11);
+        b = (1.0f - dh) * ((1.0f - dw) * b00 + dw * b01) + dh * ((1.0f - dw) * b10 + dw * b11);
+    }
+
+    float channels[3];
+    if (params.conversion == ColorConversion::RGB) {
+        channels[0] = r;
+        channels[1] = g;
+        channels[2] = b;
+    } else {
+        channels[0] = b;
+        channels[1] = g;
+        channels[2] = r;
+    }
+
+    const size_t out_index = static_cast<size_t>(idx) * 3;
+    for (unsigned c = 0; c < 3; ++c) {
+        out_ptr[out_index + c] = cast_output<TOut>((channels[c] - params.mean[c]) * params.scale[c]);
+    }
+}
+
+FusedColorPreprocess::FusedColorPreprocess(Type_t in_type,
+                                           Type_t out_type,
+                                           const Params& params,
+                                           size_t max_threads_per_block)
+    : in_type_{in_type}, out_type_{out_type}, params_{params} {
+    std::tie(num_blocks_, threads_per_block_) =
+        calculateElementwiseGrid(params_.batch_size * params_.dst_h * params_.dst_w, max_threads_per_block);
+}
+
+void FusedColorPreprocess::operator()(cudaStream_t stream,
+                                      const void* in_y,
+                                      const void* in_u,
+                                      const void* in_v,
+                                      void* out) const {
+    switch (in_type_) {
+        case Type_t::u8:
+            return dispatchOutputType<uint8_t>(stream, in_y, in_u, in_v, out);
+        case Type_t::f16:
+            return dispatchOutputType<__half>(stream, in_y, in_u, in_v, out);
+#ifdef CUDA_HAS_BF16_TYPE
+        case Type_t::bf16:
+            return dispatchOutputType<__nv_bfloat16>(stream, in_y, in_u, in_v, out);
+#endif
+        case Type_t::f32:
+            return dispatchOutputType<float>(stream, in_y, in_u, in_v, out);
+        default:
+            throwIEException(fmt::format(
+                "Input element type = {} is not supported by FusedColorPreprocess operation.", in_type_));
+    }
+}
+
+template <typename TIn>
+void FusedColorPreprocess::dispatchOutputType(
+    cudaStream_t stream, const void* in_y, const void* in_u, const void* in_v, void* out) const {
+    switch (out_type_) {
+        case Type_t::u8:
+            return callKernel<TIn, uint8_t>(stream, in_y, in_u, in_v, out);
+        case Type_t::f16:
+            return callKernel<TIn, __half>(stream, in_y, in_u, in_v, out);
+#ifdef CUDA_HAS_BF16_TYPE
+        case Type_t::bf16:
+            return callKernel<TIn, __nv_bfloat16>(stream, in_y, in_u, in_v, out);
+#endif
+        case Type_t::f32:
+            return callKernel<TIn, float>(stream, in_y, in_u, in_v, out);
+        default:
+            throwIEException(fmt::format(
+                "Output element type = {} is not supported by FusedColorPreprocess operation.", out_type_));
+    }
+}
+
+template <typename TIn, typename TOut>
+void FusedColorPreprocess::callKernel(
+    cudaStream_t stream, const void* in_y, const void* in_u, const void* in_v, void* out) const {
+    const TIn* y = static_cast<const TIn*>(in_y);
+    const size_t y_size = params_.src_w * params_.src_h;
+    const TIn* u;
+    const TIn* v = nullptr;
+    if (params_.source_format == SourceFormat::NV12) {
+        u = in_u ? static_cast<const TIn*>(in_u) : y + y_size;
+    } else {
+        u = in_u ? static_cast<const TIn*>(in_u) : y + y_size;
+        v = in_v ? static_cast<const TIn*>(in_v) : y + y_size + y_size / 4;
+    }
+    fused_color_preprocess<TIn, TOut>
+        <<<num_blocks_, threads_per_block_, 0, stream>>>(params_, y, u, v, static_cast<TOut*>(out));
+}
+
+}  // namespace kernel
+}  // namespace nvidia_gpu
+}  // namespace ov
@@ -0,0 +1,73 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cuda_runtime.h>
+
+#include "convert_color.hpp"
+#include "cuda_type_traits.hpp"
+
+namespace ov {
+namespace nvidia_gpu {
+namespace kernel {
+
+/**
+ * Fused camera frame preprocessing: NV12/I420 color conversion, optional
+ * bilinear half-pixel resize, element type conversion and per-channel
+ * (x - mean) * scale normalization in a single pass.
+ *
+ * One thread produces one output pixel, so the intermediate RGB frame, the
+ * resized frame and the converted frame never touch global memory. The YUV
+ * planes are sampled at the source coordinates of the output pixel; each
+ * sampled pixel is converted to clipped RGB before blending, matching the
+ * results of the separate color-convert and resize kernels.
+ */
+class FusedColorPreprocess {
+public:
+    enum class SourceFormat { NV12, I420 };
+
+    struct Params {
+        SourceFormat source_format;
+        ColorConversion conversion;
+        bool resize;
+        size_t batch_size;
+        size_t src_h;
+        size_t src_w;
+        size_t dst_h;
+        size_t dst_w;
+        size_t stride_y;
+        size_t stride_uv;
+        float mean[3];
+        float scale[3];
+    };
+
+    FusedColorPreprocess(Type_t in_type, Type_t out_type, const Params& params, size_t max_threads_per_block);
+    FusedColorPreprocess(FusedColorPreprocess&&) = default;
+    FusedColorPreprocess& operator=(FusedColorPreprocess&&) = default;
+
+    /**
+     * @param in_u interleaved UV plane for NV12, U plane for I420
+     * @param in_v V plane for I420, ignored for NV12
+     * Both may be nullptr for single-plane input; the plane offsets are
+     * derived from @ref Params in that case.
+     */
+    void operator()(cudaStream_t stream, const void* in_y, const void* in_u, const void* in_v, void* out) const;
+
+private:
+    template <typename TIn>
+    void dispatchOutputType(cudaStream_t stream, const void* in_y, const void* in_u, const void* in_v, void* out) const;
+    template <typename TIn, typename TOut>
+    void callKernel(cudaStream_t stream, const void* in_y, const void* in_u, const void* in_v, void* out) const;
+
+    Type_t in_type_;
+    Type_t out_type_;
+    Params params_;
+    unsigned num_blocks_{};
+    unsigned threads_per_block_{};
+};
+
+}  // namespace kernel
+}  // namespace nvidia_gpu
+}  // namespace ov
@@ -0,0 +1,156 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <fmt/format.h>
+
+#include <cuda/float16.hpp>
+
+#include "fused_mha.hpp"
+
+namespace ov {
+namespace nvidia_gpu {
+namespace kernel {
+
+namespace {
+
+constexpr unsigned kWarpSize = 32;
+// Per-lane register slice of the query row and of the output accumulator
+constexpr unsigned kMaxLaneChunks = FusedMHA::kMaxHeadSize / kWarpSize;
+
+}  // namespace
+
+template <typename T>
+static __global__ void fused_mha(const T* q,
+                                 const T* k,
+                                 const T* v,
+                                 const T* mask,
+                                 T* out,
+                                 float scale,
+                                 size_t total_rows,
+                                 size_t num_heads,
+                                 size_t seq_q,
+                                 size_t seq_kv,
+                                 size_t head_size,
+                                 size_t mask_batch_stride) {
+    const unsigned lane = threadIdx.x % kWarpSize;
+    const unsigned warp = threadIdx.x / kWarpSize;
+    const size_t row = static_cast<size_t>(blockIdx.x) * (blockDim.x / kWarpSize) + warp;
+    if (row >= total_rows) {
+        return;
+    }
+    const size_t bh = row / seq_q;  // flattened (batch, head) index
+    const T* q_row = q + row * head_size;
+    const T* k_base = k + bh * seq_kv * head_size;
+    const T* v_base = v + bh * seq_kv * head_size;
+    const T* mask_row = mask ? mask + (bh / num_heads) * mask_batch_stride : nullptr;
+
+    const unsigned chunks = (head_size + kWarpSize - 1) / kWarpSize;
+    float q_slice[kMaxLaneChunks];
+    float acc[kMaxLaneChunks];
+    for (unsigned c = 0; c < chunks; ++c) {
+        const unsigned d = c * kWarpSize + lane;
+        q_slice[c] = d < head_size ? static_cast<float>(q_row[d]) : 0.0f;
+        acc[c] = 0.0f;
+    }
+
+    // Online softmax over the keys: running maximum and denominator, with the
+    // already accumulated output rescaled whenever the maximum moves
+    float running_max = -INFINITY;
+    float denominator = 0.0f;
+    for (size_t j = 0; j < seq_kv; ++j) {
+        const T* k_row = k_base + j * head_size;
+        float score = 0.0f;
+        for (unsigned c = 0; c < chunks; ++c) {
+            const unsigned d = c * kWarpSize + lane;
+            score += d < head_size ? q_slice[c] * static_cast<float>(k_row[d]) : 0.0f;
+        }
+        for (unsigned offset = kWarpSize / 2; offset > 0; offset /= 2) {
+            score += __shfl_down_sync(0xffffffffu, score, offset);
+        }
+        score = __shfl_sync(0xffffffffu, score, 0);
+        score = score * scale + (mask_row ? static_cast<float>(mask_row[j]) : 0.0f);
+
+        const float new_max = score > running_max ? score : running_max;
+        const float rescale = expf(running_max - new_max);  // 0 on the first key
+        const float weight = expf(score - new_max);
+        denominator = denominator * rescale + weight;
+        const T* v_row = v_base + j * head_size;
+        for (unsigned c = 0; c < chunks; ++c) {
+            const unsigned d = c * kWarpSize + lane;
+            const float value = d < head_size ? static_cast<float>(v_row[d]) : 0.0f;
+            acc[c] = acc[c] * rescale + weight * value;
+        }
+        running_max = new_max;
+    }
+
+    T* out_row = out + row * head_size;
+    const float normalizer = 1.0f / denominator;
+    for (unsigned c = 0; c < chunks; ++c) {
+        const unsigned d = c * kWarpSize + lane;
+        if (d < head_size) {
+            out_row[d] = static_cast<T>(acc[c] * normalizer);
+        }
+    }
+}
+
+FusedMHA::FusedMHA(Type_t element_type,
+                   size_t batch_heads,
+                   size_t num_heads,
+                   size_t seq_q,
+                   size_t seq_kv,
+                   size_t head_size,
+                   size_t mask_batch_stride,
+                   float scale,
+                   size_t max_threads_per_block)
+    : element_type_{element_type},
+      batch_heads_{batch_heads},
+      num_heads_{num_heads},
+      seq_q_{seq_q},
+      seq_kv_{seq_kv},
+      head_size_{head_size},
+      mask_batch_stride_{mask_batch_stride},
+      scale_{scale} {
+    if (head_size > kMaxHeadSize) {
+        throwIEException(
+            fmt::format("FusedMHA kernel supports head sizes up to {}, got {}", kMaxHeadSize, head_size));
+    }
+    threads_per_block_ = max_threads_per_block < 128 ? kWarpSize : 128;
+    const size_t warps_per_block = threads_per_block_ / kWarpSize;
+    const size_t total_rows = batch_heads_ * seq_q_;
+    num_blocks_ = (total_rows + warps_per_block - 1) / warps_per_block;
+}
+
+void FusedMHA::operator()(
+    const cudaStream_t stream, const void* q, const void* k, const void* v, const void* mask, void* out) const {
+    switch (element_type_) {
+        case Type_t::f16:
+            return Call<__half>(stream, q, k, v, mask, out);
+        case Type_t::f32:
+            return Call<float>(stream, q, k, v, mask, out);
+        default:
+            throwIEException(fmt::format("Element type = {} is not supported by FusedMHA operation.",
+                                         static_cast<Type_t>(element_type_)));
+    }
+}
+
+template <typename T>
+void FusedMHA::Call(
+    const cudaStream_t stream, const void* q, const void* k, const void* v, const void* mask, void* out) const {
+    fused_mha<T><<<num_blocks_, threads_per_block_, 0, stream>>>(static_cast<const T*>(q),
+                                                                 static_cast<const T*>(k),
+                                                                 static_cast<const T*>(v),
+                                                                 static_cast<const T*>(mask),
+                                                                 static_cast<T*>(out),
+                                                                 scale_,
+                                                                 batch_heads_ * seq_q_,
+                                                                 num_heads_,
+                                                                 seq_q_,
+                                                                 seq_kv_,
+                                                                 head_size_,
+                                                                 mask_batch_stride_);
+}
+
+}  // namespace kernel
+}  // namespace nvidia_gpu
+}  // namespace ov
@@ -0,0 +1,72 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "cuda_type_traits.hpp"
+#include "error.hpp"
+
+namespace ov {
+namespace nvidia_gpu {
+namespace kernel {
+
+/**
+ * Fused scaled dot-product attention: out = softmax(Q*K^T * scale + mask) * V.
+ *
+ * One warp owns one query row. The lanes keep their strided slice of the
+ * query row and of the output accumulator in registers and sweep the keys
+ * once, renormalizing the running softmax maximum and denominator online,
+ * so the Sq x Skv score matrix the standalone MatMul/Softmax/MatMul chain
+ * writes to the mutable blob never exists. The register layout caps the
+ * head size at kMaxHeadSize elements; the fusion pass enforces the cap.
+ */
+class FusedMHA {
+public:
+    static constexpr size_t kMaxHeadSize = 128;
+
+    /**
+     * @param batch_heads   Product of the batch and head dimensions
+     * @param mask_batch_stride Distance between per-batch mask rows in
+     *                      elements; 0 when one mask row serves every batch
+     */
+    FusedMHA(Type_t element_type,
+             size_t batch_heads,
+             size_t num_heads,
+             size_t seq_q,
+             size_t seq_kv,
+             size_t head_size,
+             size_t mask_batch_stride,
+             float scale,
+             size_t max_threads_per_block);
+    FusedMHA(FusedMHA&&) = default;
+    FusedMHA& operator=(FusedMHA&&) = default;
+
+    /** @param mask Additive mask row base or nullptr when the graph had none */
+    void operator()(const cudaStream_t stream,
+                    const void* q,
+                    const void* k,
+                    const void* v,
+                    const void* mask,
+                    void* out) const;
+
+private:
+    template <typename T>
+    void Call(const cudaStream_t stream, const void* q, const void* k, const void* v, const void* mask, void* out)
+        const;
+
+    Type_t element_type_;
+    size_t batch_heads_;
+    size_t num_heads_;
+    size_t seq_q_;
+    size_t seq_kv_;
+    size_t head_size_;
+    size_t mask_batch_stride_;
+    float scale_;
+    size_t num_blocks_;
+    size_t threads_per_block_;
+};
+
+}  // namespace kernel
+}  // namespace nvidia_gpu
+}  // namespace ov
@@ -7,6 +7,8 @@
 
 #include <cuda/float16.hpp>
 
+#include "arch_dispatch.hpp"
+#include "async_copy.cuh"
 #include "gather.hpp"
 
 namespace ov {
@@ -14,6 +16,8 @@ namespace nvidia_gpu {
 
 namespace kernel {
 
+constexpr unsigned kVectorizedRowsBlockSize = 128;
+
 template <bool IsBenchmarkMode, typename DataType, typename IndexType>
 static inline __device__ void gather(unsigned data_length,
                                      size_t index_range,
@@ -103,6 +107,77 @@ static __global__ void dicts_gather(unsigned num_dicts,
                             dst_data + batch * out_batch_stride);
 }
 
+// One warp cooperatively copies one gathered row using 128-bit (uint4) loads.
+// Rows must be contiguous in the dictionary (num_dicts == 1) and 16-byte
+// divisible; all strides are given in uint4 units. The bounds check can be
+// compiled out for trusted inputs. The UseAsyncCopy variant - registered for
+// Ampere via the arch dispatch table - stages the row through shared memory
+// with a double-buffered cp.async pipeline, so the loads of the next tile
+// bypass the register file and overlap the stores of the previous one; on
+// older architectures it compiles to the plain load-store loop.
+template <bool IsBenchmarkMode, bool BoundsCheck, bool UseAsyncCopy, typename IndexType>
+static __global__ void vectorized_rows_gather(unsigned row_vectors,
+                                              size_t index_range,
+                                              unsigned num_rows,
+                                              unsigned indices_size,
+                                              unsigned dicts_batch_stride_vectors,
+                                              unsigned indices_batch_stride,
+                                              unsigned out_batch_stride_vectors,
+                                              const uint4* src_dict,
+                                              const IndexType* src_index,
+                                              uint4* dst_data) {
+    const unsigned row = (blockIdx.x * blockDim.x + threadIdx.x) / warpSize;
+    if (row >= num_rows) {
+        return;
+    }
+    const unsigned lane = threadIdx.x % warpSize;
+    const unsigned indices_index = row % indices_size;
+    const unsigned batch = row / indices_size;
+    auto dict_index = src_index[batch * indices_batch_stride + indices_index];
+    if (IsBenchmarkMode) {
+        if (dict_index >= index_range) {
+            dict_index = 0;
+        }
+    } else if (BoundsCheck) {
+        if (dict_index >= index_range) {
+            // TODO: find a way to handle an error raised in a kernel (assertion or trap) properly
+            __trap();
+        }
+    }
+    const uint4* src = src_dict + batch * dicts_batch_stride_vectors + static_cast<size_t>(dict_index) * row_vectors;
+    uint4* dst = dst_data + batch * out_batch_stride_vectors + static_cast<size_t>(indices_index) * row_vectors;
+#if defined(__CUDA_ARCH__) && __CUDA_ARCH__ >= 800
+    if constexpr (UseAsyncCopy) {
+        // Each thread owns one shared slot per buffer; tiles are warpSize vectors
+        // wide, so a thread always waits only on the copy it issued itself
+        __shared__ uint4 stage[2][kVectorizedRowsBlockSize];
+        const unsigned tiles = (row_vectors + warpSize - 1) / warpSize;
+        unsigned buf = 0;
+        if (lane < row_vectors) {
+            cpAsync16(&stage[0][threadIdx.x], src + lane);
+        }
+        cpAsyncCommitGroup();
+        for (unsigned tile = 0; tile < tiles; ++tile) {
+            const unsigned next = (tile + 1) * warpSize + lane;
+            if (tile + 1 < tiles && next < row_vectors) {
+                cpAsync16(&stage[buf ^ 1][threadIdx.x], src + next);
+            }
+            cpAsyncCommitGroup();
+            cpAsyncWaitGroup<1>();
+            const unsigned v = tile * warpSize + lane;
+            if (v < row_vectors) {
+                dst[v] = stage[buf][threadIdx.x];
+            }
+            buf ^= 1;
+        }
+        return;
+    }
+#endif
+    for (unsigned v = lane; v < row_vectors; v += warpSize) {
+        dst[v] = src[v];
+    }
+}
+
 Gather::Gather(Type_t element_type,
                Type_t indices_type,
                unsigned num_dicts,
@@ -118,7 +193,10 @@ Gather::Gather(Type_t element_type,
                unsigned indices_batch_stride,
                unsigned out_batch_stride,
                unsigned els_per_thread_chunks,
-               unsigned els_per_thread_dicts)
+               unsigned els_per_thread_dicts,
+               bool vectorized_rows,
+               bool bounds_check,
+               unsigned device_arch)
     : element_type_(element_type),
       indices_type_(indices_type),
       num_dicts_(num_dicts),
@@ -134,7 +212,10 @@ Gather::Gather(Type_t element_type,
       indices_batch_stride_(indices_batch_stride),
       out_batch_stride_(out_batch_stride),
       els_per_thread_chunks_(els_per_thread_chunks),
-      els_per_thread_dicts_(els_per_thread_dicts) {}
+      els_per_thread_dicts_(els_per_thread_dicts),
+      vectorized_rows_(vectorized_rows),
+      bounds_check_(bounds_check),
+      async_row_copy_{selectArchVariant<bool>(device_arch, {{kArchAmpere, true}}, false)} {}
 
 void Gather::operator()(const cudaStream_t stream,
                         bool is_benchmark_mode,
@@ -199,6 +280,14 @@ void Gather::Call(const cudaStream_t stream,
                   const void* src_dict,
                   const void* src_index,
                   void* dst_data) const {
+    if (vectorized_rows_ && (static_cast<size_t>(data_length_) * sizeof(DataType)) % 16 == 0) {
+        if (async_row_copy_) {
+            return CallVectorizedRows<true, IndexType>(
+                stream, is_benchmark_mode, sizeof(DataType), src_dict, src_index, dst_data);
+        }
+        return CallVectorizedRows<false, IndexType>(
+            stream, is_benchmark_mode, sizeof(DataType), src_dict, src_index, dst_data);
+    }
     dim3 grid{grid_dim_x_, grid_dim_y_, blocks_per_grid_};
 
     const auto src_dict_typed = static_cast<const DataType*>(src_dict);
@@ -261,6 +350,69 @@ void Gather::Call(const cudaStream_t stream,
     }
 }
 
+template <bool UseAsyncCopy, typename IndexType>
+void Gather::CallVectorizedRows(const cudaStream_t stream,
+                                bool is_benchmark_mode,
+                                unsigned element_size,
+                                const void* src_dict,
+                                const void* src_index,
+                                void* dst_data) const {
+    constexpr unsigned kWarpSize = 32;
+    constexpr unsigned kThreadsPerBlock = kVectorizedRowsBlockSize;
+    const unsigned row_vectors = data_length_ * element_size / 16;
+    // grid_dim_x_ holds indices_size * batch_count, i.e. the total number of gathered rows
+    const unsigned num_rows = grid_dim_x_;
+    const unsigned num_blocks = (num_rows * kWarpSize + kThreadsPerBlock - 1) / kThreadsPerBlock;
+    const unsigned dicts_batch_stride_vectors =
+        static_cast<unsigned>(static_cast<size_t>(dicts_batch_stride_) * element_size / 16);
+    const unsigned out_batch_stride_vectors =
+        static_cast<unsigned>(static_cast<size_t>(out_batch_stride_) * element_size / 16);
+
+    const auto src_dict_typed = static_cast<const uint4*>(src_dict);
+    const auto src_index_typed = static_cast<const IndexType*>(src_index);
+    auto dst_data_typed = static_cast<uint4*>(dst_data);
+
+    if (is_benchmark_mode) {
+        kernel::vectorized_rows_gather<true, true, UseAsyncCopy><<<num_blocks, kThreadsPerBlock, 0, stream>>>(row_vectors,
+                                                                                                index_range_,
+                                                                                                num_rows,
+                                                                                                indices_size_,
+                                                                                                dicts_batch_stride_vectors,
+                                                                                                indices_batch_stride_,
+                                                                                                out_batch_stride_vectors,
+                                                                                                src_dict_typed,
+                                                                                                src_index_typed,
+                                                                                                dst_data_typed);
+    } else if (bounds_check_) {
+        kernel::vectorized_rows_gather<false, true, UseAsyncCopy><<<num_blocks, kThreadsPerBlock, 0, stream>>>(row_vectors,
+                                                                                                 index_range_,
+                                                                                                 num_rows,
+                                                                                                 indices_size_,
+                                                                                                 dicts_batch_stride_vectors,
+                                                                                                 indices_batch_stride_,
+                                                                                                 out_batch_stride_vectors,
+                                                                                                 src_dict_typed,
+                                                                                                 src_index_typed,
+                                                                                                 dst_data_typed);
+    } else {
+        kernel::vectorized_rows_gather<false, false, UseAsyncCopy><<<num_blocks, kThreadsPerBlock, 0, stream>>>(row_vectors,
+                                                                                                  index_range_,
+                                                                                                  num_rows,
+                                                                                                  indices_size_,
+                                                                                                  dicts_batch_stride_vectors,
+                                                                                                  indices_batch_stride_,
+                                                                                                  out_batch_stride_vectors,
+                                                                                                  src_dict_typed,
+                                                                                                  src_index_typed,
+                                                                                                  dst_data_typed);
+    }
+    // TODO: find a way to handle an error raised in a kernel (assertion or trap) properly in CUDA Plugin
+    cudaError_t err = cudaGetLastError();
+    if (err != cudaSuccess) {
+        throwIEException(cudaGetErrorString(err));
+    }
+}
+
 }  // namespace kernel
 }  // namespace nvidia_gpu
 }  // namespace ov
@@ -30,7 +30,10 @@ public:
            unsigned indices_batch_stride,
            unsigned out_batch_stride,
            unsigned els_per_thread_chunks,
-           unsigned els_per_thread_dicts);
+           unsigned els_per_thread_dicts,
+           bool vectorized_rows,
+           bool bounds_check,
+           unsigned device_arch);
 
     void operator()(const cudaStream_t stream,
                     bool is_benchmark_mode,
@@ -53,6 +56,14 @@ private:
               const void* src_index,
               void* dst_data) const;
 
+    template <bool UseAsyncCopy, typename IndexType>
+    void CallVectorizedRows(const cudaStream_t stream,
+                            bool is_benchmark_mode,
+                            unsigned element_size,
+                            const void* src_dict,
+                            const void* src_index,
+                            void* dst_data) const;
+
     Type_t element_type_;
     Type_t indices_type_;
     unsigned num_dicts_;
@@ -69,6 +80,15 @@ private:
     unsigned out_batch_stride_;
     unsigned els_per_thread_chunks_;
     unsigned els_per_thread_dicts_;
+    // One warp copies one gathered row with 128-bit loads; only viable when the
+    // rows are contiguous (num_dicts == 1) and their byte size is 16-divisible
+    bool vectorized_rows_;
+    // Per-row index range check; may be switched off for trusted inputs
+    bool bounds_check_;
+    // Ampere specialization of the vectorized-rows path selected once at
+    // LoadNetwork: rows are staged through shared memory with a double-buffered
+    // cp.async pipeline instead of plain 128-bit loads
+    bool async_row_copy_;
 };
 
 }  // namespace kernel
@@ -0,0 +1,126 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <fmt/format.h>
+
+#include <cuda/float16.hpp>
+
+#include "gather_concat.hpp"
+
+namespace ov {
+namespace nvidia_gpu {
+namespace kernel {
+
+// blockIdx.y selects the segment; the x dimension covers batch * row_length of
+// the widest segment, narrower ones simply retire their tail threads. Every
+// gathered element is written straight to its final position in the output,
+// so no intermediate slice tensor ever touches global memory.
+template <typename T, typename IndexType>
+static __global__ void gather_concat(size_t batch,
+                                     size_t out_row_stride,
+                                     const GatherConcat::Segment* segments,
+                                     const void* const* pointers,
+                                     T* dst) {
+    const GatherConcat::Segment segment = segments[blockIdx.y];
+    const unsigned idx = blockIdx.x * blockDim.x + threadIdx.x;
+    if (idx >= batch * segment.row_length) {
+        return;
+    }
+    const unsigned b = idx / segment.row_length;
+    const unsigned e = idx - b * segment.row_length;
+    const T* dict = static_cast<const T*>(pointers[2 * blockIdx.y]);
+    const IndexType* indices = static_cast<const IndexType*>(pointers[2 * blockIdx.y + 1]);
+    IndexType index = indices[b];
+    if (index < 0) {
+        index += static_cast<IndexType>(segment.index_range);
+    }
+    if (index < 0 || index >= static_cast<IndexType>(segment.index_range)) {
+        // Same contract as the standalone Gather kernels
+        __trap();
+    }
+    dst[b * out_row_stride + segment.out_offset + e] = dict[static_cast<unsigned>(index) * segment.row_length + e];
+}
+
+GatherConcat::GatherConcat(Type_t element_type,
+                           Type_t indices_type,
+                           std::vector<Segment>&& segments,
+                           size_t batch,
+                           size_t out_row_stride,
+                           size_t num_blocks,
+                           size_t threads_per_block)
+    : element_type_{element_type},
+      indices_type_{indices_type},
+      segments_{std::move(segments)},
+      batch_{batch},
+      out_row_stride_{out_row_stride},
+      num_blocks_{num_blocks},
+      threads_per_block_{threads_per_block} {}
+
+void GatherConcat::operator()(cudaStream_t stream,
+                              const void* segments,
+                              const void* const* pointers,
+                              void* dst) const {
+    switch (element_type_) {
+#ifdef CUDA_HAS_BF16_TYPE
+        case Type_t::bf16:
+            return CallByIndexType<__nv_bfloat16>(stream, segments, pointers, dst);
+#endif
+        case Type_t::f16:
+            return CallByIndexType<__half>(stream, segments, pointers, dst);
+        case Type_t::f32:
+            return CallByIndexType<float>(stream, segments, pointers, dst);
+        case Type_t::f64:
+            return CallByIndexType<double>(stream, segments, pointers, dst);
+        case Type_t::i8:
+            return CallByIndexType<int8_t>(stream, segments, pointers, dst);
+        case Type_t::i16:
+            return CallByIndexType<int16_t>(stream, segments, pointers, dst);
+        case Type_t::i32:
+            return CallByIndexType<int32_t>(stream, segments, pointers, dst);
+        case Type_t::i64:
+            return CallByIndexType<int64_t>(stream, segments, pointers, dst);
+        case Type_t::u8:
+            return CallByIndexType<uint8_t>(stream, segments, pointers, dst);
+        case Type_t::u16:
+            return CallByIndexType<uint16_t>(stream, segments, pointers, dst);
+        case Type_t::u32:
+            return CallByIndexType<uint32_t>(stream, segments, pointers, dst);
+        case Type_t::u64:
+            return CallByIndexType<uint64_t>(stream, segments, pointers, dst);
+        default:
+            throwIEException(fmt::format("Element type = {} is not supported by GatherConcat operation.",
+                                         static_cast<Type_t>(element_type_)));
+    }
+}
+
+template <typename T>
+void GatherConcat::CallByIndexType(cudaStream_t stream,
+                                   const void* segments,
+                                   const void* const* pointers,
+                                   void* dst) const {
+    switch (indices_type_) {
+        case Type_t::i32:
+            return Call<T, int32_t>(stream, segments, pointers, dst);
+        case Type_t::i64:
+            return Call<T, int64_t>(stream, segments, pointers, dst);
+        default:
+            throwIEException(fmt::format("Index type = {} is not supported by GatherConcat operation.",
+                                         static_cast<Type_t>(indices_type_)));
+    }
+}
+
+template <typename T, typename IndexType>
+void GatherConcat::Call(cudaStream_t stream, const void* segments, const void* const* pointers, void* dst) const {
+    const dim3 grid{static_cast<unsigned>(num_blocks_), static_cast<unsigned>(segments_.size())};
+    gather_concat<T, IndexType>
+        <<<grid, threads_per_block_, 0, stream>>>(batch_,
+                                                  out_row_stride_,
+                                                  static_cast<const Segment*>(segments),
+                                                  pointers,
+                                                  static_cast<T*>(dst));
+}
+
+}  // namespace kernel
+}  // namespace nvidia_gpu
+}  // namespace ov
@@ -0,0 +1,68 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <driver_types.h>
+
+#include <vector>
+
+#include "cuda_type_traits.hpp"
+#include "error.hpp"
+
+namespace ov {
+namespace nvidia_gpu {
+namespace kernel {
+
+/**
+ * Gathers N embedding slices directly into their final offsets inside one
+ * concatenated output row. Each slice is described by a Segment; the data and
+ * index tensors arrive as one device-side pointer array laid out in
+ * (dictionary, indices) pairs, segment by segment, exactly as the fused node
+ * orders its inputs. One launch replaces N gather kernels plus the concat that
+ * used to copy every gathered row a second time.
+ */
+class GatherConcat {
+public:
+    struct Segment {
+        unsigned out_offset;   // element offset of the slice inside one output row
+        unsigned row_length;   // elements in one gathered row of the slice
+        unsigned index_range;  // dictionary rows; indices outside trap like Gather does
+    };
+
+    GatherConcat(Type_t element_type,
+                 Type_t indices_type,
+                 std::vector<Segment>&& segments,
+                 size_t batch,
+                 size_t out_row_stride,
+                 size_t num_blocks,
+                 size_t threads_per_block);
+    GatherConcat(GatherConcat&&) = default;
+    GatherConcat& operator=(GatherConcat&&) = default;
+
+    void operator()(cudaStream_t stream, const void* segments, const void* const* pointers, void* dst) const;
+
+    [[nodiscard]] size_t immutableWbSize() const { return sizeof(Segment) * segments_.size(); }
+    [[nodiscard]] size_t mutableWbSize() const { return sizeof(float*) * 2 * segments_.size(); }
+    [[nodiscard]] const void* immutableWbData() const { return segments_.data(); }
+
+private:
+    template <typename T>
+    void CallByIndexType(cudaStream_t stream, const void* segments, const void* const* pointers, void* dst) const;
+
+    template <typename T, typename IndexType>
+    void Call(cudaStream_t stream, const void* segments, const void* const* pointers, void* dst) const;
+
+    Type_t element_type_;
+    Type_t indices_type_;
+    std::vector<Segment> segments_;
+    size_t batch_;
+    size_t out_row_stride_;
+    size_t num_blocks_;
+    size_t threads_per_block_;
+};
+
+}  // namespace kernel
+}  // namespace nvidia_gpu
+}  // namespace ov
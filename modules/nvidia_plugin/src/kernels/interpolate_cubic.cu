@@ -6,7 +6,6 @@
 
 #include <algorithm>
 #include <cmath>
-#include <cuda/math.cuh>
 #include <gsl/gsl_assert>
 
 #include "interpolate_cubic.hpp"
@@ -16,19 +15,12 @@ namespace ov {
 namespace nvidia_gpu {
 namespace kernel {
 
-template <typename CT>
-static inline __device__ void get_cubic_coeff(CT s, CT a, CT coeff[4]) {
-    CT abs_s = CUDA::math::abs(s);
-    const CT one{1.0f};
-    const CT two{2.0f};
-    const CT three{3.0f};
-    const CT four{4.0f};
-    const CT five{5.0f};
-    const CT eight{8.0f};
-    coeff[0] = ((a * (abs_s + one) - five * a) * (abs_s + one) + eight * a) * (abs_s + one) - four * a;
-    coeff[1] = ((a + two) * abs_s - (a + three)) * abs_s * abs_s + one;
-    coeff[2] = ((a + two) * (one - abs_s) - (a + three)) * (one - abs_s) * (one - abs_s) + one;
-    coeff[3] = ((a * (two - abs_s) - five * a) * (two - abs_s) + eight * a) * (two - abs_s) - four * a;
+static inline void get_cubic_coeff(float s, float a, float coeff[4]) {
+    const float abs_s = std::abs(s);
+    coeff[0] = ((a * (abs_s + 1.0f) - 5.0f * a) * (abs_s + 1.0f) + 8.0f * a) * (abs_s + 1.0f) - 4.0f * a;
+    coeff[1] = ((a + 2.0f) * abs_s - (a + 3.0f)) * abs_s * abs_s + 1.0f;
+    coeff[2] = ((a + 2.0f) * (1.0f - abs_s) - (a + 3.0f)) * (1.0f - abs_s) * (1.0f - abs_s) + 1.0f;
+    coeff[3] = ((a * (2.0f - abs_s) - 5.0f * a) * (2.0f - abs_s) + 8.0f * a) * (2.0f - abs_s) - 4.0f * a;
 }
 
 static inline __device__ unsigned clip_coord(const InterpolateCubic::Props* props, int coord, int axis) {
@@ -40,7 +32,8 @@ static __global__ void interpolate_cubic(const T* input,
                                          T* output,
                                          const InterpolateCubic::Props* props,
                                          const InterpolateCubic::Index* indices,
-                                         const unsigned num_of_indices) {
+                                         const unsigned num_of_indices,
+                                         const InterpolateCubic::CoeffTableEntry* coeff_table) {
     const unsigned output_idx = blockIdx.x * blockDim.x + threadIdx.x;
     if (output_idx >= shape_size(props->output_shape)) return;
 
@@ -54,18 +47,15 @@ static __global__ void interpolate_cubic(const T* input,
 
     IntShape input_coords;
     details::shape_copy(output_coords, input_coords);
-    const CT cube_coeff{props->cube_coeff};
     CT cubic_coeffs[InterpolateCubic::MAX_SHAPE_RANK][4]{};
     for (unsigned i = 0; i < props->num_of_axes; ++i) {
         const unsigned axis = props->axes[i];
-        const CT in_coord = details::get_original_coordinate<CT>(props->transform_mode,
-                                                                 output_coords[axis],
-                                                                 static_cast<CT>(props->scales[i]),
-                                                                 props->output_shape[axis],
-                                                                 props->input_shape[axis]);
-        const CT in_coord_int = CUDA::math::floor(in_coord);
-        input_coords[axis] = static_cast<int>(in_coord_int);
-        get_cubic_coeff(in_coord - in_coord_int, cube_coeff, cubic_coeffs[axis]);
+        const InterpolateCubic::CoeffTableEntry& entry =
+            coeff_table[props->coeff_table_offsets[i] + output_coords[axis]];
+        input_coords[axis] = entry.in_coord;
+        for (unsigned k = 0; k < 4; ++k) {
+            cubic_coeffs[axis][k] = CT{entry.coeffs[k]};
+        }
     }
 
     UIntShape coords_for_sum;
@@ -97,6 +87,7 @@ InterpolateCubic::InterpolateCubic(std::vector<size_t> in_shape,
                                    size_t max_threads_per_block)
     : props_device_ptr_{nullptr},
       indices_device_ptr_{nullptr},
+      coeff_table_device_ptr_{nullptr},
       num_blocks_{},
       threads_per_block_{},
       element_type_{element_type} {
@@ -113,6 +104,24 @@ InterpolateCubic::InterpolateCubic(std::vector<size_t> in_shape,
     props_.cube_coeff = cube_coeff;
     props_.transform_mode = transform_mode;
 
+    // The source coordinate and the four weights depend only on the output
+    // coordinate along each resized axis, so they are tabulated here once
+    unsigned offset = 0;
+    for (unsigned i = 0; i < props_.num_of_axes; ++i) {
+        const unsigned axis = props_.axes[i];
+        props_.coeff_table_offsets[i] = offset;
+        for (unsigned out_coord = 0; out_coord < props_.output_shape[axis]; ++out_coord) {
+            const float in_coord = details::get_original_coordinate(
+                transform_mode, out_coord, props_.scales[i], props_.output_shape[axis], props_.input_shape[axis]);
+            const float in_coord_int = std::floor(in_coord);
+            CoeffTableEntry entry{};
+            entry.in_coord = static_cast<int>(in_coord_int);
+            get_cubic_coeff(in_coord - in_coord_int, cube_coeff, entry.coeffs);
+            coeff_table_.push_back(entry);
+        }
+        offset += props_.output_shape[axis];
+    }
+
     std::vector<int> indices_shape(props_.num_of_axes, 4);
     details::ShapeIterator iter{indices_shape};
     while (!iter.end()) {
@@ -153,11 +162,12 @@ void InterpolateCubic::callKernel(const cudaStream_t stream, const void* input,
                                                          static_cast<T*>(output),
                                                          static_cast<const Props*>(props_device_ptr_),
                                                          static_cast<const Index*>(indices_device_ptr_),
-                                                         indices_.size());
+                                                         indices_.size(),
+                                                         static_cast<const CoeffTableEntry*>(coeff_table_device_ptr_));
 }
 
 std::vector<size_t> InterpolateCubic::immutableWorkbufferSizes() const {
-    return {sizeof(Props), sizeof(Index) * indices_.size()};
+    return {sizeof(Props), sizeof(Index) * indices_.size(), sizeof(CoeffTableEntry) * coeff_table_.size()};
 }
 
 void InterpolateCubic::initImmutableWorkbuffers(const std::vector<void*>& buffers) {
@@ -168,6 +178,12 @@ void InterpolateCubic::initImmutableWorkbuffers(const std::vector<void*>& buffer
     kernel::throwIfError(cudaMemcpyAsync(
         buffers[1], static_cast<const void*>(&indices_[0]), sizeof(Index) * indices_.size(), cudaMemcpyHostToDevice));
     indices_device_ptr_ = buffers[1];
+
+    kernel::throwIfError(cudaMemcpyAsync(buffers[2],
+                                         static_cast<const void*>(&coeff_table_[0]),
+                                         sizeof(CoeffTableEntry) * coeff_table_.size(),
+                                         cudaMemcpyHostToDevice));
+    coeff_table_device_ptr_ = buffers[2];
 }
 
 }  // namespace kernel
@@ -41,6 +41,20 @@ public:
 
         float cube_coeff{};
         CoordinateTransformMode transform_mode{};
+
+        // Start of each axis row in the coefficient table, indexed like axes
+        UIntShape coeff_table_offsets{};
+    };
+
+    /**
+     * Precomputed cubic convolution for one output coordinate along one
+     * resized axis: the leftmost source coordinate and the four weights.
+     * The tables depend only on shapes and scales, so they are built once
+     * at network load time instead of per output element on every inference
+     */
+    struct CoeffTableEntry {
+        int in_coord{};
+        float coeffs[4]{};
     };
 
 private:
@@ -52,6 +66,8 @@ private:
     const void* props_device_ptr_;
     std::vector<Index> indices_;
     const void* indices_device_ptr_;
+    std::vector<CoeffTableEntry> coeff_table_;
+    const void* coeff_table_device_ptr_;
 
     size_t num_blocks_;
     size_t threads_per_block_;
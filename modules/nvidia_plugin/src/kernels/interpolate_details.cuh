@@ -78,6 +78,45 @@ public:
         return input_coord;
     }
 
+    /**
+     * Host counterpart of get_original_coordinate used to precompute
+     * coefficient tables at network load time
+     */
+    static inline float get_original_coordinate(const CoordinateTransformMode mode,
+                                                const unsigned output_coordinate,
+                                                const float scale,
+                                                const unsigned output_dim,
+                                                const unsigned input_dim) {
+        float input_coord{};
+        switch (mode) {
+            case CoordinateTransformMode::half_pixel:
+                input_coord = ((static_cast<float>(output_coordinate) + 0.5f) / scale) - 0.5f;
+                break;
+            case CoordinateTransformMode::pytorch_half_pixel:
+                if (output_dim > 1)
+                    input_coord = ((static_cast<float>(output_coordinate) + 0.5f) / scale) - 0.5f;
+                else
+                    input_coord = 0.0f;
+                break;
+            case CoordinateTransformMode::asymmetric:
+                input_coord = static_cast<float>(output_coordinate) / scale;
+                break;
+            case CoordinateTransformMode::tf_half_pixel_for_nn:
+                input_coord = (static_cast<float>(output_coordinate) + 0.5f) / scale;
+                break;
+            case CoordinateTransformMode::align_corners:
+                if (output_dim == 1)
+                    input_coord = 0.0f;
+                else
+                    input_coord = static_cast<float>(output_coordinate) * static_cast<float>(input_dim - 1) /
+                                  static_cast<float>(output_dim - 1);
+                break;
+            default:
+                assert(false);
+        }
+        return input_coord;
+    }
+
     template <typename SRCT, typename DSTT, unsigned N>
     static inline __device__ void shape_copy(const Shape<SRCT, N>& src, Shape<DSTT, N>& dst) {
         for (int i = 0; i < N; ++i) dst[i] = cast<DSTT>(src[i]);
@@ -6,10 +6,8 @@
 
 #include <algorithm>
 #include <cmath>
-#include <cuda/math.cuh>
 #include <gsl/gsl_assert>
 
-#include "convert.cuh"
 #include "interpolate_details.cuh"
 #include "interpolate_linear.hpp"
 
@@ -17,17 +15,16 @@ namespace ov {
 namespace nvidia_gpu {
 namespace kernel {
 
-template <typename CT>
-static inline __device__ CT triangle_coeffs(CT dz) {
-    return CUDA::math::max(CT{}, CT{1.0f} - CUDA::math::abs(dz));
-}
+static inline float triangle_coeffs(float dz) { return std::max(0.0f, 1.0f - std::abs(dz)); }
 
 template <typename T, typename ComputeType>
 static __global__ void interpolate_linear(const T* input,
                                           T* output,
                                           const InterpolateLinear::Props* props,
                                           const InterpolateLinear::Index* indices,
-                                          const unsigned num_of_indices) {
+                                          const unsigned num_of_indices,
+                                          const int* coord_table,
+                                          const float* weight_table) {
     const unsigned output_idx = blockIdx.x * blockDim.x + threadIdx.x;
     if (output_idx >= shape_size(props->output_shape)) return;
 
@@ -35,28 +32,17 @@ static __global__ void interpolate_linear(const T* input,
     using details = InterpolateLinear::details;
     using IntShape = InterpolateLinear::IntShape;
     using UIntShape = InterpolateLinear::UIntShape;
-    using CTShape = Shape<CT, InterpolateLinear::MAX_SHAPE_RANK>;
 
     UIntShape output_coords{};
     shape_indices(props->output_shape, output_idx, output_coords);
 
-    CTShape input_coords;
-    details::shape_copy(output_coords, input_coords);
     IntShape input_coords_r;
     details::shape_copy(output_coords, input_coords_r);
     for (unsigned i = 0; i < props->num_of_axes; ++i) {
         const unsigned axis = props->axes[i];
-        const CT in_coord = details::get_original_coordinate<CT>(props->transform_mode,
-                                                                 output_coords[axis],
-                                                                 static_cast<CT>(props->scales[i]),
-                                                                 props->output_shape[axis],
-                                                                 props->input_shape[axis]);
-        input_coords[axis] = in_coord;
-        input_coords_r[axis] = static_cast<int>(CUDA::math::round(in_coord));
+        input_coords_r[axis] = coord_table[props->coord_table_offsets[i] + output_coords[axis]];
     }
 
-    CTShape a;
-    details::shape_copy(props->a, a);
     const CT prod_of_a{props->prod_of_a};
 
     CT summa = 0.0;
@@ -80,15 +66,12 @@ static __global__ void interpolate_linear(const T* input,
         const unsigned inner_index = flat_address_by_shape(props->input_shape, inner_coords);
         CT inner_value = static_cast<CT>(input[inner_index]);
 
-        CTShape dz{};
-        for (unsigned i = 0; i < props->num_of_axes; ++i) {
-            const unsigned axis = props->axes[i];
-            dz[i] = input_coords[axis] - cast<CT>(inner_coords[axis]);
-        }
-
         CT prod_of_triangle_coeffs = 1.0;
         for (unsigned i = 0; i < props->num_of_axes; ++i) {
-            prod_of_triangle_coeffs *= triangle_coeffs<CT>(a[i] * dz[i]);
+            const unsigned axis = props->axes[i];
+            const unsigned row =
+                props->weight_table_offsets[i] + output_coords[axis] * (2 * props->r[i] + 1);
+            prod_of_triangle_coeffs *= CT{weight_table[row + index[i] + props->r[i]]};
         }
 
         CT w = prod_of_a * prod_of_triangle_coeffs;
@@ -112,6 +95,8 @@ InterpolateLinear::InterpolateLinear(std::vector<size_t> in_shape,
                                      size_t max_threads_per_block)
     : props_device_ptr_{nullptr},
       indices_device_ptr_{nullptr},
+      coord_table_device_ptr_{nullptr},
+      weight_table_device_ptr_{nullptr},
       num_blocks_{},
       threads_per_block_{},
       element_type_{element_type} {
@@ -161,6 +146,28 @@ InterpolateLinear::InterpolateLinear(std::vector<size_t> in_shape,
 
     props_.transform_mode = transform_mode;
 
+    // The rounded source coordinate and the triangle weights of every support
+    // offset depend only on the output coordinate along each resized axis,
+    // so they are tabulated here once
+    unsigned coord_offset = 0;
+    unsigned weight_offset = 0;
+    for (unsigned i = 0; i < props_.num_of_axes; ++i) {
+        const unsigned axis = props_.axes[i];
+        props_.coord_table_offsets[i] = coord_offset;
+        props_.weight_table_offsets[i] = weight_offset;
+        for (unsigned out_coord = 0; out_coord < props_.output_shape[axis]; ++out_coord) {
+            const float in_coord = details::get_original_coordinate(
+                transform_mode, out_coord, props_.scales[i], props_.output_shape[axis], props_.input_shape[axis]);
+            const int in_coord_r = static_cast<int>(std::round(in_coord));
+            coord_table_.push_back(in_coord_r);
+            for (int k = -props_.r[i]; k <= props_.r[i]; ++k) {
+                weight_table_.push_back(triangle_coeffs(props_.a[i] * (in_coord - static_cast<float>(in_coord_r + k))));
+            }
+        }
+        coord_offset += props_.output_shape[axis];
+        weight_offset += props_.output_shape[axis] * (2 * props_.r[i] + 1);
+    }
+
     std::tie(num_blocks_, threads_per_block_) =
         calculateElementwiseGrid(shape_size(props_.output_shape), max_threads_per_block);
 }
@@ -192,11 +199,16 @@ void InterpolateLinear::callKernel(const cudaStream_t stream, const void* input,
                                                          static_cast<T*>(output),
                                                          static_cast<const Props*>(props_device_ptr_),
                                                          static_cast<const Index*>(indices_device_ptr_),
-                                                         indices_.size());
+                                                         indices_.size(),
+                                                         static_cast<const int*>(coord_table_device_ptr_),
+                                                         static_cast<const float*>(weight_table_device_ptr_));
 }
 
 std::vector<size_t> InterpolateLinear::immutableWorkbufferSizes() const {
-    return {sizeof(Props), sizeof(Index) * indices_.size()};
+    return {sizeof(Props),
+            sizeof(Index) * indices_.size(),
+            sizeof(int) * coord_table_.size(),
+            sizeof(float) * weight_table_.size()};
 }
 
 void InterpolateLinear::initImmutableWorkbuffers(const std::vector<void*>& buffers) {
@@ -207,6 +219,18 @@ void InterpolateLinear::initImmutableWorkbuffers(const std::vector<void*>& buffe
     kernel::throwIfError(cudaMemcpyAsync(
         buffers[1], static_cast<const void*>(&indices_[0]), sizeof(Index) * indices_.size(), cudaMemcpyHostToDevice));
     indices_device_ptr_ = buffers[1];
+
+    kernel::throwIfError(cudaMemcpyAsync(buffers[2],
+                                         static_cast<const void*>(&coord_table_[0]),
+                                         sizeof(int) * coord_table_.size(),
+                                         cudaMemcpyHostToDevice));
+    coord_table_device_ptr_ = buffers[2];
+
+    kernel::throwIfError(cudaMemcpyAsync(buffers[3],
+                                         static_cast<const void*>(&weight_table_[0]),
+                                         sizeof(float) * weight_table_.size(),
+                                         cudaMemcpyHostToDevice));
+    weight_table_device_ptr_ = buffers[3];
 }
 
 }  // namespace kernel
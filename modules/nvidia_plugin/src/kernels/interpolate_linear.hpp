@@ -43,6 +43,12 @@ public:
 
         float prod_of_a{};
         CoordinateTransformMode transform_mode{};
+
+        // Start of each axis row in the rounded source coordinate table and
+        // in the triangle weight table, indexed like axes. A weight row holds
+        // 2 * r + 1 entries per output coordinate, one per support offset
+        UIntShape coord_table_offsets{};
+        UIntShape weight_table_offsets{};
     };
 
 private:
@@ -54,6 +60,12 @@ private:
     const void* props_device_ptr_;
     std::vector<Index> indices_;
     const void* indices_device_ptr_;
+    // Tables depend only on shapes and scales, so they are precomputed once
+    // at network load time instead of per output element on every inference
+    std::vector<int> coord_table_;
+    const void* coord_table_device_ptr_;
+    std::vector<float> weight_table_;
+    const void* weight_table_device_ptr_;
 
     size_t num_blocks_;
     size_t threads_per_block_;
@@ -0,0 +1,113 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <fmt/format.h>
+
+#include <cuda/float16.hpp>
+
+#include "iota_gather.hpp"
+#include "tensor_helpers.hpp"
+
+namespace ov {
+namespace nvidia_gpu {
+namespace kernel {
+
+template <typename T>
+static __global__ void iota_gather(const size_t size,
+                                   const unsigned data_length,
+                                   const unsigned indices_size,
+                                   const unsigned index_range,
+                                   const long long start,
+                                   const long long step,
+                                   const T* src_dict,
+                                   T* dst_data) {
+    const size_t i = blockIdx.x * static_cast<size_t>(blockDim.x) + threadIdx.x;
+    if (i >= size) {
+        return;
+    }
+    const unsigned el = i % data_length;
+    const size_t rest = i / data_length;
+    const unsigned index = rest % indices_size;
+    const size_t dict = rest / indices_size;
+    // The index tensor is virtual: each thread computes its dictionary row
+    // from the output position it writes
+    const auto dict_index = static_cast<size_t>(start + static_cast<long long>(index) * step);
+    dst_data[i] = src_dict[(dict * index_range + dict_index) * data_length + el];
+}
+
+IotaGather::IotaGather(const Type_t element_type,
+                       const std::int64_t start,
+                       const std::int64_t step,
+                       const unsigned num_dicts,
+                       const unsigned index_range,
+                       const unsigned data_length,
+                       const unsigned indices_size,
+                       const unsigned max_threads_per_block)
+    : element_type_{element_type},
+      start_{start},
+      step_{step},
+      num_dicts_{num_dicts},
+      index_range_{index_range},
+      data_length_{data_length},
+      indices_size_{indices_size},
+      size_{static_cast<std::size_t>(num_dicts) * indices_size * data_length} {
+    std::tie(num_blocks_, threads_per_block_) = calculateElementwiseGrid(size_, max_threads_per_block);
+}
+
+void IotaGather::operator()(const cudaStream_t stream, const void* src, void* dst) const {
+    switch (element_type_) {
+        case Type_t::boolean:
+            return Call<bool>(stream, src, dst);
+#ifdef CUDA_HAS_BF16_TYPE
+        case Type_t::bf16:
+            return Call<__nv_bfloat16>(stream, src, dst);
+#endif
+        case Type_t::f16:
+            return Call<__half>(stream, src, dst);
+        case Type_t::f32:
+            return Call<float>(stream, src, dst);
+        case Type_t::f64:
+            return Call<double>(stream, src, dst);
+        case Type_t::i8:
+            return Call<int8_t>(stream, src, dst);
+        case Type_t::i16:
+            return Call<int16_t>(stream, src, dst);
+        case Type_t::i32:
+            return Call<int32_t>(stream, src, dst);
+        case Type_t::i64:
+            return Call<int64_t>(stream, src, dst);
+        case Type_t::u8:
+            return Call<uint8_t>(stream, src, dst);
+        case Type_t::u16:
+            return Call<uint16_t>(stream, src, dst);
+        case Type_t::u32:
+            return Call<uint32_t>(stream, src, dst);
+        case Type_t::u64:
+            return Call<uint64_t>(stream, src, dst);
+        default:
+            throwIEException(fmt::format("Input element type = {} is not supported by IotaGather operation !!",
+                                         static_cast<Type_t>(element_type_)));
+    }
+}
+
+template <typename T>
+void IotaGather::Call(const cudaStream_t stream, const void* src, void* dst) const {
+    iota_gather<T><<<num_blocks_, threads_per_block_, 0, stream>>>(size_,
+                                                                   data_length_,
+                                                                   indices_size_,
+                                                                   index_range_,
+                                                                   static_cast<long long>(start_),
+                                                                   static_cast<long long>(step_),
+                                                                   static_cast<const T*>(src),
+                                                                   static_cast<T*>(dst));
+    // TODO: find a way to handle an error raised in a kernel (assertion or trap) properly in CUDA Plugin
+    cudaError_t err = cudaGetLastError();
+    if (err != cudaSuccess) {
+        throwIEException(cudaGetErrorString(err));
+    }
+}
+
+}  // namespace kernel
+}  // namespace nvidia_gpu
+}  // namespace ov
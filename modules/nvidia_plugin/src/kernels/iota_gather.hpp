@@ -0,0 +1,56 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstdint>
+
+#include "cuda_type_traits.hpp"
+#include "error.hpp"
+
+namespace ov {
+namespace nvidia_gpu {
+namespace kernel {
+
+/**
+ * @brief Gather whose indices are a virtual arithmetic progression.
+ *
+ * Replaces a Range feeding a Gather: instead of reading a materialized index
+ * tensor, every thread derives its dictionary index as start + i * step from
+ * its output position, so neither the Range kernel nor the intermediate
+ * tensor exists. The fusion pass has already proven every generated index to
+ * be inside the dictionary, so the kernel runs without bounds checks.
+ */
+class IotaGather {
+public:
+    IotaGather(Type_t element_type,
+               std::int64_t start,
+               std::int64_t step,
+               unsigned num_dicts,
+               unsigned index_range,
+               unsigned data_length,
+               unsigned indices_size,
+               unsigned max_threads_per_block);
+
+    void operator()(cudaStream_t stream, const void* src, void* dst) const;
+
+private:
+    template <typename T>
+    void Call(cudaStream_t stream, const void* src, void* dst) const;
+
+    Type_t element_type_;
+    std::int64_t start_;
+    std::int64_t step_;
+    unsigned num_dicts_;
+    unsigned index_range_;
+    unsigned data_length_;
+    unsigned indices_size_;
+    std::size_t size_;
+    unsigned num_blocks_;
+    unsigned threads_per_block_;
+};
+
+}  // namespace kernel
+}  // namespace nvidia_gpu
+}  // namespace ov
@@ -0,0 +1,112 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "launch_config.hpp"
+
+#include <cuda_runtime_api.h>
+
+#include <algorithm>
+#include <array>
+#include <cuda/dnn_be_algo_cache.hpp>
+#include <sstream>
+
+namespace ov {
+namespace nvidia_gpu {
+namespace kernel {
+
+namespace {
+
+constexpr std::array<unsigned, 5> kBlockSizeCandidates{64, 128, 256, 512, 1024};
+
+/** Buckets payload sizes to powers of two so nearby shapes share one cache entry */
+unsigned sizeBucket(std::size_t size) {
+    unsigned bucket = 0;
+    while ((size >>= 1) != 0) {
+        ++bucket;
+    }
+    return bucket;
+}
+
+}  // namespace
+
+LaunchConfigProvider& LaunchConfigProvider::instance() {
+    static LaunchConfigProvider provider{};
+    return provider;
+}
+
+std::size_t LaunchConfigProvider::blockSize(const void* kernel_func,
+                                            const char* kernel_tag,
+                                            std::size_t payload_size,
+                                            std::size_t max_threads_per_block) {
+    if (kernel_func == nullptr || payload_size == 0 || max_threads_per_block == 0) {
+        return max_threads_per_block;
+    }
+    int device = 0;
+    if (::cudaGetDevice(&device) != cudaSuccess) {
+        return max_threads_per_block;
+    }
+
+    std::ostringstream tag;
+    tag << "launch|" << kernel_tag << "|b" << sizeBucket(payload_size) << "|dev" << device;
+    const std::string memo_key = tag.str();
+    {
+        std::lock_guard<std::mutex> lock{mutex_};
+        const auto found = block_sizes_.find(memo_key);
+        if (found != block_sizes_.end()) {
+            return std::min(found->second, max_threads_per_block);
+        }
+    }
+
+    auto& cache = CUDA::DnnBenchmarkCache::instance();
+    const std::string cache_key = cache.enabled() ? CUDA::DnnBenchmarkCache::makeKey(memo_key) : std::string{};
+    if (cache.enabled()) {
+        if (const auto cached = cache.find(cache_key)) {
+            std::lock_guard<std::mutex> lock{mutex_};
+            block_sizes_.emplace(memo_key, *cached);
+            return std::min(*cached, max_threads_per_block);
+        }
+    }
+
+    // Evaluate the candidates with the occupancy calculator. The score is the
+    // number of threads resident per multiprocessor, discounted by the
+    // utilization of the last wave so small payloads do not end up with a
+    // block size the launch cannot fill.
+    std::size_t best = max_threads_per_block;
+    double best_score = -1.0;
+    for (const unsigned candidate : kBlockSizeCandidates) {
+        if (candidate > max_threads_per_block) {
+            continue;
+        }
+        int active_blocks = 0;
+        if (::cudaOccupancyMaxActiveBlocksPerMultiprocessor(&active_blocks, kernel_func, candidate, 0) !=
+                cudaSuccess ||
+            active_blocks == 0) {
+            ::cudaGetLastError();  // NOTE: Reset the error state of a failed query
+            continue;
+        }
+        const std::size_t grid_blocks = (payload_size + candidate - 1) / candidate;
+        const double utilization = static_cast<double>(payload_size) / (grid_blocks * candidate);
+        const double score = static_cast<double>(active_blocks) * candidate * utilization;
+        if (score > best_score) {
+            best_score = score;
+            best = candidate;
+        }
+    }
+    if (best_score < 0.0) {
+        return max_threads_per_block;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock{mutex_};
+        block_sizes_.emplace(memo_key, best);
+    }
+    if (cache.enabled()) {
+        cache.store(cache_key, best);
+    }
+    return best;
+}
+
+}  // namespace kernel
+}  // namespace nvidia_gpu
+}  // namespace ov
@@ -0,0 +1,77 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+#include "tensor_helpers.hpp"
+
+namespace ov {
+namespace nvidia_gpu {
+namespace kernel {
+
+/**
+ * @brief Process-wide provider of kernel launch block sizes.
+ *
+ * Deriving the block size from maxThreadsPerBlock alone picks 1024-thread
+ * blocks on every device, which is rarely the occupancy optimum and differs
+ * between GPU generations. Given the kernel entry point the provider
+ * evaluates a small set of candidate block sizes with the CUDA occupancy
+ * calculator and picks the one that keeps the most threads resident per
+ * multiprocessor, discounted by the utilization of the last wave for shapes
+ * that do not fill the device. Winners are memoized per
+ * (kernel, size bucket, device) and persisted through
+ * CUDA::DnnBenchmarkCache, so the selection is computed once per kernel and
+ * survives across LoadNetwork calls when the cache directory is configured.
+ */
+class LaunchConfigProvider {
+public:
+    static LaunchConfigProvider& instance();
+
+    LaunchConfigProvider(const LaunchConfigProvider&) = delete;
+    LaunchConfigProvider& operator=(const LaunchConfigProvider&) = delete;
+
+    /**
+     * Provides the preferred number of threads per block for an elementwise
+     * kernel, never exceeding max_threads_per_block.
+     * @param kernel_func Kernel entry point; when nullptr the fixed
+     * max_threads_per_block heuristic is returned unchanged.
+     * @param kernel_tag Stable name identifying the kernel in the cache.
+     * @param payload_size Number of elements one kernel thread maps to.
+     * @param max_threads_per_block Device limit for the kernel.
+     */
+    std::size_t blockSize(const void* kernel_func,
+                          const char* kernel_tag,
+                          std::size_t payload_size,
+                          std::size_t max_threads_per_block);
+
+private:
+    LaunchConfigProvider() = default;
+
+    std::mutex mutex_;
+    std::unordered_map<std::string, std::size_t> block_sizes_;
+};
+
+/**
+ * Drop-in replacement for calculateElementwiseGrid() that takes the block
+ * size from the launch-config provider instead of the device limit.
+ */
+template <typename KernelFn>
+inline std::pair<unsigned, unsigned> tunedElementwiseGrid(KernelFn* kernel_func,
+                                                          const char* kernel_tag,
+                                                          std::size_t size,
+                                                          std::size_t max_threads_per_block) {
+    const auto block_size = LaunchConfigProvider::instance().blockSize(
+        reinterpret_cast<const void*>(kernel_func), kernel_tag, size, max_threads_per_block);
+    return calculateElementwiseGrid(size, block_size);
+}
+
+}  // namespace kernel
+}  // namespace nvidia_gpu
+}  // namespace ov
@@ -0,0 +1,227 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <fmt/format.h>
+
+#include <cuda/float16.hpp>
+#include <type_traits>
+
+#include "launch_config.hpp"
+#include "pooling.hpp"
+
+namespace ov {
+namespace nvidia_gpu {
+namespace kernel {
+
+namespace {
+constexpr unsigned kWarpSize = 32;
+
+template <typename T>
+struct Lowest;
+template <>
+struct Lowest<float> {
+    __device__ static float value() { return -__int_as_float(0x7f800000); }  // -inf
+};
+template <>
+struct Lowest<double> {
+    __device__ static double value() { return -__longlong_as_double(0x7ff0000000000000ll); }
+};
+template <>
+struct Lowest<__half> {
+    __device__ static __half value() { return __ushort_as_half(0xfc00u); }  // -inf
+};
+#ifdef CUDA_HAS_BF16_TYPE
+template <>
+struct Lowest<__nv_bfloat16> {
+    __device__ static __nv_bfloat16 value() { return __ushort_as_bfloat16(0xff80u); }
+};
+#endif
+}  // namespace
+
+// One block per (batch, channel) plane: threads accumulate a grid-stride
+// partial sum in fp32, warps fold their partials with shuffles and the first
+// warp folds the per-warp results, so the plane is read exactly once with
+// coalesced loads and no global atomics
+template <typename T>
+static __global__ void global_avg_pool(size_t plane_size, const T* src, T* dst) {
+    // Halves accumulate in fp32, doubles in fp64, so precision never drops
+    // below the element type across an arbitrarily large plane
+    using Acc = typename std::conditional<std::is_same<T, double>::value, double, float>::type;
+    const T* plane = src + static_cast<size_t>(blockIdx.x) * plane_size;
+    Acc sum = 0;
+    for (size_t i = threadIdx.x; i < plane_size; i += blockDim.x) {
+        sum += static_cast<Acc>(plane[i]);
+    }
+    for (unsigned offset = kWarpSize / 2; offset > 0; offset /= 2) {
+        sum += __shfl_down_sync(0xffffffffu, sum, offset);
+    }
+    __shared__ Acc warp_sums[kWarpSize];
+    const unsigned lane = threadIdx.x % kWarpSize;
+    const unsigned warp = threadIdx.x / kWarpSize;
+    if (lane == 0) {
+        warp_sums[warp] = sum;
+    }
+    __syncthreads();
+    if (warp == 0) {
+        const unsigned num_warps = (blockDim.x + kWarpSize - 1) / kWarpSize;
+        sum = lane < num_warps ? warp_sums[lane] : Acc{0};
+        for (unsigned offset = kWarpSize / 2; offset > 0; offset /= 2) {
+            sum += __shfl_down_sync(0xffffffffu, sum, offset);
+        }
+        if (lane == 0) {
+            dst[blockIdx.x] = static_cast<T>(sum / static_cast<Acc>(plane_size));
+        }
+    }
+}
+
+GlobalAvgPool::GlobalAvgPool(Type_t element_type, size_t num_planes, size_t plane_size, size_t threads_per_block)
+    : element_type_{element_type},
+      num_planes_{num_planes},
+      plane_size_{plane_size},
+      threads_per_block_{threads_per_block} {}
+
+void GlobalAvgPool::operator()(cudaStream_t stream, const void* src, void* dst) const {
+    switch (element_type_) {
+#ifdef CUDA_HAS_BF16_TYPE
+        case Type_t::bf16:
+            return Call<__nv_bfloat16>(stream, src, dst);
+#endif
+        case Type_t::f16:
+            return Call<__half>(stream, src, dst);
+        case Type_t::f32:
+            return Call<float>(stream, src, dst);
+        case Type_t::f64:
+            return Call<double>(stream, src, dst);
+        default:
+            throwIEException(fmt::format("Element type = {} is not supported by GlobalAvgPool operation.",
+                                         static_cast<Type_t>(element_type_)));
+    }
+}
+
+template <typename T>
+void GlobalAvgPool::Call(cudaStream_t stream, const void* src, void* dst) const {
+    global_avg_pool<T>
+        <<<num_planes_, threads_per_block_, 0, stream>>>(plane_size_, static_cast<const T*>(src), static_cast<T*>(dst));
+}
+
+// One thread per output element; KernelSize is a compile-time constant so the
+// window walk is fully unrolled and stays in registers. Taps outside the
+// plane contribute the type's lowest value, which makes padding free
+template <typename T, int KernelSize>
+static __global__ void max_pool_small(size_t output_size,
+                                      size_t in_height,
+                                      size_t in_width,
+                                      size_t out_height,
+                                      size_t out_width,
+                                      size_t stride_h,
+                                      size_t stride_w,
+                                      size_t pad_h,
+                                      size_t pad_w,
+                                      const T* src,
+                                      T* dst) {
+    const size_t idx = static_cast<size_t>(blockIdx.x) * blockDim.x + threadIdx.x;
+    if (idx >= output_size) {
+        return;
+    }
+    const size_t ox = idx % out_width;
+    const size_t oy = (idx / out_width) % out_height;
+    const size_t plane = idx / (out_width * out_height);
+    const T* in_plane = src + plane * in_height * in_width;
+    const ptrdiff_t start_y = static_cast<ptrdiff_t>(oy * stride_h) - static_cast<ptrdiff_t>(pad_h);
+    const ptrdiff_t start_x = static_cast<ptrdiff_t>(ox * stride_w) - static_cast<ptrdiff_t>(pad_w);
+    T result = Lowest<T>::value();
+#pragma unroll
+    for (int ky = 0; ky < KernelSize; ++ky) {
+        const ptrdiff_t y = start_y + ky;
+#pragma unroll
+        for (int kx = 0; kx < KernelSize; ++kx) {
+            const ptrdiff_t x = start_x + kx;
+            if (y >= 0 && y < static_cast<ptrdiff_t>(in_height) && x >= 0 && x < static_cast<ptrdiff_t>(in_width)) {
+                const T value = in_plane[y * in_width + x];
+                result = value > result ? value : result;
+            }
+        }
+    }
+    dst[idx] = result;
+}
+
+MaxPoolSmall::MaxPoolSmall(Type_t element_type,
+                           size_t num_planes,
+                           size_t in_height,
+                           size_t in_width,
+                           size_t out_height,
+                           size_t out_width,
+                           size_t kernel_size,
+                           size_t stride_h,
+                           size_t stride_w,
+                           size_t pad_h,
+                           size_t pad_w,
+                           size_t max_threads_per_block)
+    : element_type_{element_type},
+      num_planes_{num_planes},
+      in_height_{in_height},
+      in_width_{in_width},
+      out_height_{out_height},
+      out_width_{out_width},
+      kernel_size_{kernel_size},
+      stride_h_{stride_h},
+      stride_w_{stride_w},
+      pad_h_{pad_h},
+      pad_w_{pad_w},
+      output_size_{num_planes * out_height * out_width},
+      max_threads_per_block_{max_threads_per_block} {}
+
+void MaxPoolSmall::operator()(cudaStream_t stream, const void* src, void* dst) const {
+    switch (element_type_) {
+#ifdef CUDA_HAS_BF16_TYPE
+        case Type_t::bf16:
+            return CallByKernelSize<__nv_bfloat16>(stream, src, dst);
+#endif
+        case Type_t::f16:
+            return CallByKernelSize<__half>(stream, src, dst);
+        case Type_t::f32:
+            return CallByKernelSize<float>(stream, src, dst);
+        case Type_t::f64:
+            return CallByKernelSize<double>(stream, src, dst);
+        default:
+            throwIEException(fmt::format("Element type = {} is not supported by MaxPoolSmall operation.",
+                                         static_cast<Type_t>(element_type_)));
+    }
+}
+
+template <typename T>
+void MaxPoolSmall::CallByKernelSize(cudaStream_t stream, const void* src, void* dst) const {
+    switch (kernel_size_) {
+        case 2:
+            return Call<T, 2>(stream, src, dst);
+        case 3:
+            return Call<T, 3>(stream, src, dst);
+        default:
+            throwIEException(
+                fmt::format("Kernel size = {} is not supported by MaxPoolSmall operation.", kernel_size_));
+    }
+}
+
+template <typename T, int KernelSize>
+void MaxPoolSmall::Call(cudaStream_t stream, const void* src, void* dst) const {
+    const auto block_size = LaunchConfigProvider::instance().blockSize(
+        reinterpret_cast<const void*>(&max_pool_small<T, KernelSize>), "max_pool_small", output_size_,
+        max_threads_per_block_);
+    const auto num_blocks = (output_size_ + block_size - 1) / block_size;
+    max_pool_small<T, KernelSize><<<num_blocks, block_size, 0, stream>>>(output_size_,
+                                                                         in_height_,
+                                                                         in_width_,
+                                                                         out_height_,
+                                                                         out_width_,
+                                                                         stride_h_,
+                                                                         stride_w_,
+                                                                         pad_h_,
+                                                                         pad_w_,
+                                                                         static_cast<const T*>(src),
+                                                                         static_cast<T*>(dst));
+}
+
+}  // namespace kernel
+}  // namespace nvidia_gpu
+}  // namespace ov
@@ -0,0 +1,86 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <driver_types.h>
+
+#include "cuda_type_traits.hpp"
+#include "error.hpp"
+
+namespace ov {
+namespace nvidia_gpu {
+namespace kernel {
+
+/**
+ * Native global average pooling: one block reduces one (batch, channel) plane
+ * with warp shuffles, replacing the generic cuDNN window walker that runs well
+ * below speed-of-light when the window covers the whole plane (the classifier
+ * head case).
+ */
+class GlobalAvgPool {
+public:
+    GlobalAvgPool(Type_t element_type, size_t num_planes, size_t plane_size, size_t threads_per_block);
+
+    void operator()(cudaStream_t stream, const void* src, void* dst) const;
+
+private:
+    template <typename T>
+    void Call(cudaStream_t stream, const void* src, void* dst) const;
+
+    Type_t element_type_;
+    size_t num_planes_;
+    size_t plane_size_;
+    size_t threads_per_block_;
+};
+
+/**
+ * Native max pooling for the small windows that dominate classifiers. The
+ * kernel size (2 or 3) is a template parameter, so the window walk is fully
+ * unrolled and every output element costs one thread with the loads kept in
+ * registers; out-of-plane taps contribute the type's lowest value, which makes
+ * padding free.
+ */
+class MaxPoolSmall {
+public:
+    MaxPoolSmall(Type_t element_type,
+                 size_t num_planes,
+                 size_t in_height,
+                 size_t in_width,
+                 size_t out_height,
+                 size_t out_width,
+                 size_t kernel_size,
+                 size_t stride_h,
+                 size_t stride_w,
+                 size_t pad_h,
+                 size_t pad_w,
+                 size_t max_threads_per_block);
+
+    void operator()(cudaStream_t stream, const void* src, void* dst) const;
+
+private:
+    template <typename T>
+    void CallByKernelSize(cudaStream_t stream, const void* src, void* dst) const;
+
+    template <typename T, int KernelSize>
+    void Call(cudaStream_t stream, const void* src, void* dst) const;
+
+    Type_t element_type_;
+    size_t num_planes_;
+    size_t in_height_;
+    size_t in_width_;
+    size_t out_height_;
+    size_t out_width_;
+    size_t kernel_size_;
+    size_t stride_h_;
+    size_t stride_w_;
+    size_t pad_h_;
+    size_t pad_w_;
+    size_t output_size_;
+    size_t max_threads_per_block_;
+};
+
+}  // namespace kernel
+}  // namespace nvidia_gpu
+}  // namespace ov
@@ -0,0 +1,116 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <fmt/format.h>
+
+#include <gsl/gsl_assert>
+
+#include "port_copy_batch.hpp"
+#include "tensor_helpers.hpp"
+
+namespace ov {
+namespace nvidia_gpu {
+namespace kernel {
+
+static __global__ void port_copy_batch(const PortCopyBatch::DeviceTable *table,
+                                       const PortCopyBatch::Pointers pointers,
+                                       const bool is_slice,
+                                       const int64_t iter,
+                                       const size_t total) {
+    const unsigned i = blockIdx.x * blockDim.x + threadIdx.x;
+    if (i >= total) {
+        return;
+    }
+    // Find the port owning element i; the table never holds more than
+    // kMaxPortsPerLaunch entries, so the scan is trivially short
+    size_t p = 0;
+    while (i >= table->offsets[p + 1]) {
+        ++p;
+    }
+    const auto &props = table->ports[p];
+    const size_t local = i - table->offsets[p];
+
+    Shape<size_t, 5> partIndexes{};
+    shape_indices(props.part_shape, local, partIndexes);
+    Shape<size_t, 5> fullIndexes{};
+    memcpy(fullIndexes, partIndexes, sizeof(partIndexes));
+    fullIndexes[props.axe] = static_cast<size_t>(props.start + iter * props.stride) + partIndexes[props.axe];
+    const size_t full_flat = flat_address_by_shape(props.full_shape, fullIndexes);
+
+    const size_t src_off = is_slice ? full_flat : local;
+    const size_t dst_off = is_slice ? local : full_flat;
+    const void *src = pointers.src[p];
+    void *dst = pointers.dst[p];
+    switch (props.element_size) {
+        case 1:
+            static_cast<uint8_t *>(dst)[dst_off] = static_cast<const uint8_t *>(src)[src_off];
+            break;
+        case 2:
+            static_cast<uint16_t *>(dst)[dst_off] = static_cast<const uint16_t *>(src)[src_off];
+            break;
+        case 4:
+            static_cast<uint32_t *>(dst)[dst_off] = static_cast<const uint32_t *>(src)[src_off];
+            break;
+        case 8:
+            static_cast<uint64_t *>(dst)[dst_off] = static_cast<const uint64_t *>(src)[src_off];
+            break;
+        default:
+            for (size_t b = 0; b < props.element_size; ++b) {
+                static_cast<uint8_t *>(dst)[dst_off * props.element_size + b] =
+                    static_cast<const uint8_t *>(src)[src_off * props.element_size + b];
+            }
+            break;
+    }
+}
+
+PortCopyBatch::PortCopyBatch(const Direction direction,
+                             const std::vector<PortProps> &ports,
+                             const size_t max_threads_per_block)
+    : direction_{direction}, port_count_{ports.size()} {
+    tables_.resize((ports.size() + kMaxPortsPerLaunch - 1) / kMaxPortsPerLaunch);
+    grids_.resize(tables_.size());
+    for (size_t chunk = 0; chunk < tables_.size(); ++chunk) {
+        auto &table = tables_[chunk];
+        table.count = std::min(kMaxPortsPerLaunch, ports.size() - chunk * kMaxPortsPerLaunch);
+        table.offsets[0] = 0;
+        for (size_t p = 0; p < table.count; ++p) {
+            table.ports[p] = ports[chunk * kMaxPortsPerLaunch + p];
+            table.offsets[p + 1] = table.offsets[p] + shape_size(table.ports[p].part_shape);
+        }
+        // Shorten the owning-port scan: unused tail entries never match
+        for (size_t p = table.count; p < kMaxPortsPerLaunch; ++p) {
+            table.offsets[p + 1] = table.offsets[table.count];
+        }
+        const auto total = table.offsets[table.count];
+        Expects(total > 0);
+        std::tie(grids_[chunk].num_blocks, grids_[chunk].threads_per_block) =
+            calculateElementwiseGrid(total, max_threads_per_block);
+    }
+}
+
+void PortCopyBatch::operator()(const cudaStream_t stream,
+                               const void *const *src,
+                               void *const *dst,
+                               const int64_t iter) const {
+    Expects(tables_ptr_);
+    const bool is_slice = (direction_ == Direction::slice);
+    for (size_t chunk = 0; chunk < tables_.size(); ++chunk) {
+        const auto &table = tables_[chunk];
+        Pointers pointers{};
+        for (size_t p = 0; p < table.count; ++p) {
+            pointers.src[p] = src[chunk * kMaxPortsPerLaunch + p];
+            pointers.dst[p] = dst[chunk * kMaxPortsPerLaunch + p];
+        }
+        port_copy_batch<<<grids_[chunk].num_blocks, grids_[chunk].threads_per_block, 0, stream>>>(
+            static_cast<const DeviceTable *>(tables_ptr_) + chunk,
+            pointers,
+            is_slice,
+            iter,
+            table.offsets[table.count]);
+    }
+}
+
+}  // namespace kernel
+}  // namespace nvidia_gpu
+}  // namespace ov
@@ -0,0 +1,98 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <vector>
+
+#include "cuda_type_traits.hpp"
+#include "error.hpp"
+#include "tensor_helpers.hpp"
+
+namespace ov {
+namespace nvidia_gpu {
+namespace kernel {
+
+/**
+ * Performs the slice (or insert) copies of all TensorIterator ports for one
+ * iteration in a single kernel launch instead of one launch per port. The
+ * per-port shapes live in a device-side descriptor table stored in an
+ * immutable workbuffer; only the tensor pointers and the iteration number are
+ * passed as kernel arguments. Ports are addressed by element size rather than
+ * element type, so ports of different types share one launch.
+ */
+class PortCopyBatch {
+public:
+    /// Ports serviced by one launch; larger batches are split into several launches.
+    static constexpr size_t kMaxPortsPerLaunch = 8;
+
+    enum class Direction { slice, insert };
+
+    struct PortProps {
+        Shape<size_t, 5> full_shape{};  // shape of the iterated (un-sliced) tensor
+        Shape<size_t, 5> part_shape{};  // shape of the one-iteration slice
+        size_t axe{};
+        std::int64_t start{};   // first index along the axis, already normalized
+        std::int64_t stride{};  // advance along the axis per iteration
+        size_t element_size{};
+    };
+
+    /// Device-side descriptor table of one launch.
+    struct DeviceTable {
+        PortProps ports[kMaxPortsPerLaunch];
+        // Exclusive prefix sums of the slice element counts; offsets[count] is
+        // the total element count of the launch
+        size_t offsets[kMaxPortsPerLaunch + 1]{};
+        size_t count{};
+    };
+
+    /// Per-launch tensor pointers, passed by value as a kernel argument.
+    struct Pointers {
+        const void* src[kMaxPortsPerLaunch];
+        void* dst[kMaxPortsPerLaunch];
+    };
+
+    PortCopyBatch(Direction direction, const std::vector<PortProps>& ports, size_t max_threads_per_block);
+    PortCopyBatch(PortCopyBatch&&) = default;
+    PortCopyBatch& operator=(PortCopyBatch&&) = default;
+
+    size_t portCount() const { return port_count_; }
+
+    /**
+     * Launches the copies of one iteration. src/dst must hold portCount()
+     * pointers in the order the ports were given to the constructor: for
+     * slices src is the full tensor and dst the slice, for inserts the
+     * other way around.
+     */
+    void operator()(cudaStream_t stream, const void* const* src, void* const* dst, std::int64_t iter) const;
+
+    size_t getImmutableWorkbufferSize() const;
+    void setImmutableWorkbuffer(void* immutableBuffer);
+
+private:
+    struct Grid {
+        unsigned num_blocks{};
+        unsigned threads_per_block{};
+    };
+
+    Direction direction_{};
+    size_t port_count_{};
+    std::vector<DeviceTable> tables_{};
+    std::vector<Grid> grids_{};
+    void* tables_ptr_{};
+};
+
+inline size_t PortCopyBatch::getImmutableWorkbufferSize() const { return tables_.size() * sizeof(DeviceTable); }
+
+inline void PortCopyBatch::setImmutableWorkbuffer(void* immutableBuffer) {
+    kernel::throwIfError(cudaMemcpyAsync(immutableBuffer,
+                                         static_cast<const void*>(tables_.data()),
+                                         getImmutableWorkbufferSize(),
+                                         cudaMemcpyHostToDevice));
+    tables_ptr_ = immutableBuffer;
+}
+
+}  // namespace kernel
+}  // namespace nvidia_gpu
+}  // namespace ov
@@ -21,8 +21,68 @@ struct PowerOpImpl<__half> {
     }
 };
 
-Power::Power(Type_t element_type, size_t out_num_elements, size_t max_threads_per_block)
-    : impl_{element_type, out_num_elements, max_threads_per_block} {}
+// Specialized functors for the exponents that dominate real models; the
+// (broadcast scalar) exponent operand is still passed but ignored.
+template <typename T>
+struct PowerIdentityOpImpl {
+    __device__ static inline T op(T in0, T /*in1*/) { return in0; }
+};
+
+template <typename T>
+struct PowerSquareOpImpl {
+    __device__ static inline T op(T in0, T /*in1*/) { return in0 * in0; }
+};
+
+template <typename T>
+struct PowerSqrtOpImpl {
+    __device__ static inline T op(T in0, T /*in1*/) { return static_cast<T>(sqrt(static_cast<double>(in0))); }
+};
+
+template <>
+struct PowerSqrtOpImpl<float> {
+    __device__ static inline float op(float in0, float /*in1*/) { return sqrtf(in0); }
+};
+
+template <>
+struct PowerSqrtOpImpl<__half> {
+    __device__ static inline __half op(__half in0, __half /*in1*/) { return cast<__half>(sqrtf(cast<float>(in0))); }
+};
+
+#ifdef CUDA_HAS_BF16_TYPE
+template <>
+struct PowerSqrtOpImpl<__nv_bfloat16> {
+    __device__ static inline __nv_bfloat16 op(__nv_bfloat16 in0, __nv_bfloat16 /*in1*/) {
+        return cast<__nv_bfloat16>(sqrtf(cast<float>(in0)));
+    }
+};
+#endif
+
+template <typename T>
+struct PowerReciprocalOpImpl {
+    __device__ static inline T op(T in0, T /*in1*/) { return static_cast<T>(1) / in0; }
+};
+
+template <>
+struct PowerReciprocalOpImpl<__half> {
+    __device__ static inline __half op(__half in0, __half /*in1*/) { return cast<__half>(1.0f / cast<float>(in0)); }
+};
+
+#ifdef CUDA_HAS_BF16_TYPE
+template <>
+struct PowerReciprocalOpImpl<__nv_bfloat16> {
+    __device__ static inline __nv_bfloat16 op(__nv_bfloat16 in0, __nv_bfloat16 /*in1*/) {
+        return cast<__nv_bfloat16>(1.0f / cast<float>(in0));
+    }
+};
+#endif
+
+Power::Power(Type_t element_type, size_t out_num_elements, size_t max_threads_per_block, Mode mode)
+    : mode_{mode},
+      generic_impl_{element_type, out_num_elements, max_threads_per_block},
+      identity_impl_{element_type, out_num_elements, max_threads_per_block},
+      square_impl_{element_type, out_num_elements, max_threads_per_block},
+      sqrt_impl_{element_type, out_num_elements, max_threads_per_block},
+      reciprocal_impl_{element_type, out_num_elements, max_threads_per_block} {}
 
 void Power::operator()(cudaStream_t stream,
                        const void* in0,
@@ -30,7 +90,18 @@ void Power::operator()(cudaStream_t stream,
                        const void* in1,
                        const NumpyBroadcastMapper& in1_mapper,
                        void* out) const {
-    impl_(stream, in0, in0_mapper, in1, in1_mapper, out);
+    switch (mode_) {
+        case Mode::kIdentity:
+            return identity_impl_(stream, in0, in0_mapper, in1, in1_mapper, out);
+        case Mode::kSquare:
+            return square_impl_(stream, in0, in0_mapper, in1, in1_mapper, out);
+        case Mode::kSqrt:
+            return sqrt_impl_(stream, in0, in0_mapper, in1, in1_mapper, out);
+        case Mode::kReciprocal:
+            return reciprocal_impl_(stream, in0, in0_mapper, in1, in1_mapper, out);
+        default:
+            return generic_impl_(stream, in0, in0_mapper, in1, in1_mapper, out);
+    }
 }
 
 }  // namespace kernel
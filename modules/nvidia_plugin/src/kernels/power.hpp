@@ -12,13 +12,28 @@ namespace kernel {
 
 template <typename T>
 struct PowerOpImpl;
+template <typename T>
+struct PowerIdentityOpImpl;
+template <typename T>
+struct PowerSquareOpImpl;
+template <typename T>
+struct PowerSqrtOpImpl;
+template <typename T>
+struct PowerReciprocalOpImpl;
 
 /**
  * Elementwise power operation.
+ *
+ * Almost every Power node in real models raises to 1, 2, 0.5 or -1; for those
+ * exponents a dedicated functor (identity, multiply, sqrt, reciprocal) replaces
+ * the SFU-bound pow() call. The mode is chosen by constant-exponent inspection
+ * in ops/power.cpp at network load time; Mode::kGeneric keeps pow().
  */
 class Power {
 public:
-    Power(Type_t element_type, size_t out_num_elements, size_t max_threads_per_block);
+    enum class Mode { kGeneric, kIdentity, kSquare, kSqrt, kReciprocal };
+
+    Power(Type_t element_type, size_t out_num_elements, size_t max_threads_per_block, Mode mode = Mode::kGeneric);
 
     void operator()(cudaStream_t stream,
                     const void* in0,
@@ -44,7 +59,12 @@ private:
         Type_t::u32,
         Type_t::u64>;
 
-    ElementwiseBinary<SupportedElementTypes, PowerOpImpl> impl_;
+    Mode mode_;
+    ElementwiseBinary<SupportedElementTypes, PowerOpImpl> generic_impl_;
+    ElementwiseBinary<SupportedElementTypes, PowerIdentityOpImpl> identity_impl_;
+    ElementwiseBinary<SupportedElementTypes, PowerSquareOpImpl> square_impl_;
+    ElementwiseBinary<SupportedElementTypes, PowerSqrtOpImpl> sqrt_impl_;
+    ElementwiseBinary<SupportedElementTypes, PowerReciprocalOpImpl> reciprocal_impl_;
 };
 
 }  // namespace kernel
@@ -9,8 +9,12 @@ struct PReluOpImpl {
     __device__ static inline T op(T in0, T in1) { return in0 > T{} ? in0 : in0 * in1; }
 };
 
-PRelu::PRelu(Type_t element_type, size_t out_num_elements, size_t max_threads_per_block)
-    : impl_{element_type, out_num_elements, max_threads_per_block} {}
+PRelu::PRelu(Type_t element_type,
+             size_t out_num_elements,
+             size_t max_threads_per_block,
+             size_t in0_num_elements,
+             size_t in1_num_elements)
+    : impl_{element_type, out_num_elements, max_threads_per_block, in0_num_elements, in1_num_elements} {}
 
 void PRelu::operator()(cudaStream_t stream,
                        const void* in0,
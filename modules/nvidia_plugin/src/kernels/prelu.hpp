@@ -15,11 +15,16 @@ template <typename T>
 struct PReluOpImpl;
 
 /**
- * Elementwise PRelu operation.
+ * Elementwise PRelu operation. The operand element counts, when given, let the
+ * broadcasting path cache the per-channel slopes in shared memory.
  */
 class PRelu {
 public:
-    PRelu(Type_t element_type, size_t out_num_elements, size_t max_threads_per_block);
+    PRelu(Type_t element_type,
+          size_t out_num_elements,
+          size_t max_threads_per_block,
+          size_t in0_num_elements = 0,
+          size_t in1_num_elements = 0);
 
     void operator()(cudaStream_t stream,
                     const void* in0,
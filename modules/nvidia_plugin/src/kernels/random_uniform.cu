@@ -0,0 +1,182 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <fmt/format.h>
+
+#include <cuda/float16.hpp>
+
+#include "launch_config.hpp"
+#include "random_uniform.hpp"
+
+namespace ov {
+namespace nvidia_gpu {
+namespace kernel {
+
+namespace {
+
+constexpr std::uint32_t kPhiloxM0 = 0xD2511F53u;
+constexpr std::uint32_t kPhiloxM1 = 0xCD9E8D57u;
+constexpr std::uint32_t kPhiloxW0 = 0x9E3779B9u;
+constexpr std::uint32_t kPhiloxW1 = 0xBB67AE85u;
+constexpr int kPhiloxRounds = 10;
+
+__device__ void philox_round(std::uint32_t& c0,
+                             std::uint32_t& c1,
+                             std::uint32_t& c2,
+                             std::uint32_t& c3,
+                             std::uint32_t k0,
+                             std::uint32_t k1) {
+    const std::uint32_t lo0 = c0 * kPhiloxM0;
+    const std::uint32_t hi0 = __umulhi(c0, kPhiloxM0);
+    const std::uint32_t lo1 = c2 * kPhiloxM1;
+    const std::uint32_t hi1 = __umulhi(c2, kPhiloxM1);
+    c0 = hi1 ^ c1 ^ k0;
+    c1 = lo1;
+    c2 = hi0 ^ c3 ^ k1;
+    c3 = lo0;
+}
+
+// Maps one 128-bit Philox block to output elements: four for 32-bit-or-less
+// types, two for 64-bit types (which consume two words each)
+template <typename T>
+struct BitsToRange {
+    static constexpr int elements = 4;
+    __device__ static T make(const std::uint32_t* r, int i, T lo, T hi) {
+        const float flo = static_cast<float>(lo);
+        const float fhi = static_cast<float>(hi);
+        return static_cast<T>(flo + (fhi - flo) * static_cast<float>(r[i] >> 8) * (1.0f / 16777216.0f));
+    }
+};
+
+template <>
+struct BitsToRange<double> {
+    static constexpr int elements = 2;
+    __device__ static double make(const std::uint32_t* r, int i, double lo, double hi) {
+        const std::uint64_t bits = (static_cast<std::uint64_t>(r[2 * i]) << 32) | r[2 * i + 1];
+        return lo + (hi - lo) * static_cast<double>(bits >> 11) * (1.0 / 9007199254740992.0);
+    }
+};
+
+template <>
+struct BitsToRange<std::int32_t> {
+    static constexpr int elements = 4;
+    __device__ static std::int32_t make(const std::uint32_t* r, int i, std::int32_t lo, std::int32_t hi) {
+        const std::uint32_t range = static_cast<std::uint32_t>(hi - lo);
+        return range != 0 ? lo + static_cast<std::int32_t>(r[i] % range) : lo;
+    }
+};
+
+template <>
+struct BitsToRange<std::int64_t> {
+    static constexpr int elements = 2;
+    __device__ static std::int64_t make(const std::uint32_t* r, int i, std::int64_t lo, std::int64_t hi) {
+        const std::uint64_t bits = (static_cast<std::uint64_t>(r[2 * i]) << 32) | r[2 * i + 1];
+        const std::uint64_t range = static_cast<std::uint64_t>(hi - lo);
+        return range != 0 ? lo + static_cast<std::int64_t>(bits % range) : lo;
+    }
+};
+
+}  // namespace
+
+// One thread evaluates one Philox block: the counter is (block index,
+// sequence), so repeated executions with different sequence numbers and
+// concurrent requests never collide and nothing is read-modify-written
+template <typename T>
+static __global__ void random_uniform(size_t num_elements,
+                                      std::uint32_t key0,
+                                      std::uint32_t key1,
+                                      std::uint32_t seq_lo,
+                                      std::uint32_t seq_hi,
+                                      const T* min_value,
+                                      const T* max_value,
+                                      T* dst) {
+    using Conv = BitsToRange<T>;
+    const size_t block_index = static_cast<size_t>(blockIdx.x) * blockDim.x + threadIdx.x;
+    const size_t first = block_index * Conv::elements;
+    if (first >= num_elements) {
+        return;
+    }
+    std::uint32_t c0 = static_cast<std::uint32_t>(block_index);
+    std::uint32_t c1 = static_cast<std::uint32_t>(block_index >> 32);
+    std::uint32_t c2 = seq_lo;
+    std::uint32_t c3 = seq_hi;
+    std::uint32_t k0 = key0;
+    std::uint32_t k1 = key1;
+#pragma unroll
+    for (int round = 0; round < kPhiloxRounds; ++round) {
+        philox_round(c0, c1, c2, c3, k0, k1);
+        k0 += kPhiloxW0;
+        k1 += kPhiloxW1;
+    }
+    const std::uint32_t r[4] = {c0, c1, c2, c3};
+    const T lo = *min_value;
+    const T hi = *max_value;
+#pragma unroll
+    for (int i = 0; i < Conv::elements; ++i) {
+        if (first + i < num_elements) {
+            dst[first + i] = Conv::make(r, i, lo, hi);
+        }
+    }
+}
+
+RandomUniform::RandomUniform(Type_t element_type,
+                             size_t num_elements,
+                             size_t max_threads_per_block,
+                             std::uint64_t global_seed,
+                             std::uint64_t op_seed)
+    : element_type_{element_type},
+      num_elements_{num_elements},
+      max_threads_per_block_{max_threads_per_block},
+      key0_{static_cast<std::uint32_t>(global_seed ^ (global_seed >> 32))},
+      key1_{static_cast<std::uint32_t>(op_seed ^ (op_seed >> 32))} {}
+
+void RandomUniform::operator()(cudaStream_t stream,
+                               std::uint64_t sequence,
+                               const void* min_value,
+                               const void* max_value,
+                               void* dst) const {
+    switch (element_type_) {
+#ifdef CUDA_HAS_BF16_TYPE
+        case Type_t::bf16:
+            return Call<__nv_bfloat16>(stream, sequence, min_value, max_value, dst);
+#endif
+        case Type_t::f16:
+            return Call<__half>(stream, sequence, min_value, max_value, dst);
+        case Type_t::f32:
+            return Call<float>(stream, sequence, min_value, max_value, dst);
+        case Type_t::f64:
+            return Call<double>(stream, sequence, min_value, max_value, dst);
+        case Type_t::i32:
+            return Call<std::int32_t>(stream, sequence, min_value, max_value, dst);
+        case Type_t::i64:
+            return Call<std::int64_t>(stream, sequence, min_value, max_value, dst);
+        default:
+            throwIEException(fmt::format("Element type = {} is not supported by RandomUniform operation.",
+                                         static_cast<Type_t>(element_type_)));
+    }
+}
+
+template <typename T>
+void RandomUniform::Call(cudaStream_t stream,
+                         std::uint64_t sequence,
+                         const void* min_value,
+                         const void* max_value,
+                         void* dst) const {
+    const size_t philox_blocks = (num_elements_ + BitsToRange<T>::elements - 1) / BitsToRange<T>::elements;
+    const auto block_size = LaunchConfigProvider::instance().blockSize(
+        reinterpret_cast<const void*>(&random_uniform<T>), "random_uniform", philox_blocks, max_threads_per_block_);
+    const auto num_blocks = (philox_blocks + block_size - 1) / block_size;
+    random_uniform<T><<<num_blocks, block_size, 0, stream>>>(num_elements_,
+                                                             key0_,
+                                                             key1_,
+                                                             static_cast<std::uint32_t>(sequence),
+                                                             static_cast<std::uint32_t>(sequence >> 32),
+                                                             static_cast<const T*>(min_value),
+                                                             static_cast<const T*>(max_value),
+                                                             static_cast<T*>(dst));
+}
+
+}  // namespace kernel
+}  // namespace nvidia_gpu
+}  // namespace ov
@@ -0,0 +1,57 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstdint>
+
+#include <driver_types.h>
+
+#include "cuda_type_traits.hpp"
+#include "error.hpp"
+
+namespace ov {
+namespace nvidia_gpu {
+namespace kernel {
+
+/**
+ * Counter-based uniform random generation with Philox-4x32-10: every value is
+ * a pure function of (key, sequence, element index), so there is no generator
+ * state to serialize and concurrent infer requests draw independent streams
+ * by using distinct sequence numbers. The key is derived from the operation's
+ * seeds once at construction; the caller supplies a fresh sequence number per
+ * execution.
+ */
+class RandomUniform {
+public:
+    RandomUniform(Type_t element_type,
+                  size_t num_elements,
+                  size_t max_threads_per_block,
+                  std::uint64_t global_seed,
+                  std::uint64_t op_seed);
+
+    void operator()(cudaStream_t stream,
+                    std::uint64_t sequence,
+                    const void* min_value,
+                    const void* max_value,
+                    void* dst) const;
+
+private:
+    template <typename T>
+    void Call(cudaStream_t stream,
+              std::uint64_t sequence,
+              const void* min_value,
+              const void* max_value,
+              void* dst) const;
+
+    Type_t element_type_;
+    size_t num_elements_;
+    size_t max_threads_per_block_;
+    std::uint32_t key0_;
+    std::uint32_t key1_;
+};
+
+}  // namespace kernel
+}  // namespace nvidia_gpu
+}  // namespace ov
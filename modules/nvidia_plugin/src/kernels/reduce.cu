@@ -0,0 +1,160 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cub/device/device_segmented_reduce.cuh>
+#include <cub/iterator/counting_input_iterator.cuh>
+#include <cub/iterator/transform_input_iterator.cuh>
+
+#include <type_traits>
+
+#include "error.hpp"
+#include "reduce.hpp"
+
+namespace ov {
+namespace nvidia_gpu {
+namespace kernel {
+
+namespace {
+
+struct SegmentOffset {
+    int segment_size;
+    __host__ __device__ int operator()(int i) const { return i * segment_size; }
+};
+
+template <typename T>
+struct Square {
+    __host__ __device__ T operator()(T x) const { return x * x; }
+};
+
+template <typename T>
+struct Multiplies {
+    __host__ __device__ T operator()(T a, T b) const { return a * b; }
+};
+
+using CountingIterator = cub::CountingInputIterator<int>;
+using SegmentOffsetIterator = cub::TransformInputIterator<int, SegmentOffset, CountingIterator>;
+
+constexpr unsigned kPostprocessBlockSize = 256;
+
+/** Finishes Mean (scale by 1/segment_size) and L2 (square root) over the segment results */
+template <typename T>
+__global__ void segmented_reduce_postprocess(T* out, size_t num_segments, T scale, bool take_sqrt) {
+    const size_t i = blockIdx.x * blockDim.x + threadIdx.x;
+    if (i < num_segments) {
+        const T value = out[i] * scale;
+        if constexpr (std::is_floating_point<T>::value) {
+            out[i] = take_sqrt ? static_cast<T>(sqrt(static_cast<double>(value))) : value;
+        } else {
+            out[i] = value;
+        }
+    }
+}
+
+}  // namespace
+
+SegmentedReduce::SegmentedReduce(Type_t element_type, Mode mode, size_t num_segments, size_t segment_size)
+    : element_type_{element_type}, mode_{mode}, num_segments_{num_segments}, segment_size_{segment_size} {
+    if (!isSupportedElementType(element_type, mode)) {
+        throwIEException("SegmentedReduce: unsupported element type");
+    }
+    // A null workspace makes cub compute the scratch size without launching anything
+    dispatch(nullptr, nullptr, nullptr, nullptr, workspace_size_);
+}
+
+bool SegmentedReduce::isSupportedElementType(Type_t element_type, Mode mode) {
+    switch (element_type) {
+        case Type_t::f32:
+        case Type_t::f64:
+            return true;
+        case Type_t::i32:
+        case Type_t::i64:
+            // Integer Mean truncates and integer L2 needs a float accumulator;
+            // both stay on the cuDNN/elementwise fallbacks
+            return mode == Mode::Max || mode == Mode::Min || mode == Mode::Prod;
+        default:
+            return false;
+    }
+}
+
+template <typename T>
+void SegmentedReduce::run(cudaStream_t stream, const T* in, T* out, void* workspace, size_t& workspace_bytes) const {
+    const CountingIterator counting{0};
+    const SegmentOffset offset{static_cast<int>(segment_size_)};
+    const SegmentOffsetIterator begin_offsets{counting, offset};
+    const SegmentOffsetIterator end_offsets{CountingIterator{1}, offset};
+    const int num_segments = static_cast<int>(num_segments_);
+    switch (mode_) {
+        case Mode::Max:
+            throwIfError(cub::DeviceSegmentedReduce::Max(
+                workspace, workspace_bytes, in, out, num_segments, begin_offsets, end_offsets, stream));
+            break;
+        case Mode::Min:
+            throwIfError(cub::DeviceSegmentedReduce::Min(
+                workspace, workspace_bytes, in, out, num_segments, begin_offsets, end_offsets, stream));
+            break;
+        case Mode::Prod:
+            throwIfError(cub::DeviceSegmentedReduce::Reduce(workspace,
+                                                            workspace_bytes,
+                                                            in,
+                                                            out,
+                                                            num_segments,
+                                                            begin_offsets,
+                                                            end_offsets,
+                                                            Multiplies<T>{},
+                                                            T{1},
+                                                            stream));
+            break;
+        case Mode::Mean:
+            throwIfError(cub::DeviceSegmentedReduce::Sum(
+                workspace, workspace_bytes, in, out, num_segments, begin_offsets, end_offsets, stream));
+            if (workspace) {
+                const unsigned num_blocks = (num_segments_ + kPostprocessBlockSize - 1) / kPostprocessBlockSize;
+                segmented_reduce_postprocess<<<num_blocks, kPostprocessBlockSize, 0, stream>>>(
+                    out, num_segments_, static_cast<T>(T{1} / static_cast<T>(segment_size_)), false);
+            }
+            break;
+        case Mode::L2: {
+            const cub::TransformInputIterator<T, Square<T>, const T*> squared{in, Square<T>{}};
+            throwIfError(cub::DeviceSegmentedReduce::Sum(
+                workspace, workspace_bytes, squared, out, num_segments, begin_offsets, end_offsets, stream));
+            if (workspace) {
+                const unsigned num_blocks = (num_segments_ + kPostprocessBlockSize - 1) / kPostprocessBlockSize;
+                segmented_reduce_postprocess<<<num_blocks, kPostprocessBlockSize, 0, stream>>>(
+                    out, num_segments_, T{1}, true);
+            }
+            break;
+        }
+    }
+}
+
+void SegmentedReduce::dispatch(
+    cudaStream_t stream, const void* in, void* out, void* workspace, size_t& workspace_bytes) const {
+    switch (element_type_) {
+        case Type_t::f32:
+            run(stream, static_cast<const float*>(in), static_cast<float*>(out), workspace, workspace_bytes);
+            break;
+        case Type_t::f64:
+            run(stream, static_cast<const double*>(in), static_cast<double*>(out), workspace, workspace_bytes);
+            break;
+        case Type_t::i32:
+            run(stream, static_cast<const int32_t*>(in), static_cast<int32_t*>(out), workspace, workspace_bytes);
+            break;
+        case Type_t::i64:
+            run(stream, static_cast<const int64_t*>(in), static_cast<int64_t*>(out), workspace, workspace_bytes);
+            break;
+        default:
+            throwIEException("SegmentedReduce: unsupported element type");
+    }
+}
+
+void SegmentedReduce::operator()(cudaStream_t stream, const void* in, void* out, void* workspace) const {
+    size_t workspace_bytes = workspace_size_;
+    // cub treats a null workspace as a size query, so a zero-scratch reduction
+    // still needs a non-null pointer; the segment results buffer is never null
+    dispatch(stream, in, out, workspace ? workspace : out, workspace_bytes);
+}
+
+}  // namespace kernel
+}  // namespace nvidia_gpu
+}  // namespace ov
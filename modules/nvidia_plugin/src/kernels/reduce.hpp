@@ -0,0 +1,52 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+
+#include "cuda_type_traits.hpp"
+
+namespace ov {
+namespace nvidia_gpu {
+namespace kernel {
+
+/**
+ * Reduces every contiguous segment of the input to one output element with
+ * cub::DeviceSegmentedReduce. The caller (ReduceCubOp) collapses the reduced
+ * axes into the segment extent, so each segment is one run of consecutive
+ * elements; Mean and L2 finish with a small scale/sqrt pass over the segment
+ * results. A single segment degenerates to a plain device-wide reduction.
+ */
+class SegmentedReduce {
+public:
+    enum class Mode { Max, Min, Prod, Mean, L2 };
+
+    SegmentedReduce(Type_t element_type, Mode mode, size_t num_segments, size_t segment_size);
+    SegmentedReduce(SegmentedReduce&&) = default;
+    SegmentedReduce& operator=(SegmentedReduce&&) = default;
+
+    /** True when the CUB backend can reduce the given element type in the given mode */
+    static bool isSupportedElementType(Type_t element_type, Mode mode);
+
+    void operator()(cudaStream_t stream, const void* in, void* out, void* workspace) const;
+
+    /** Bytes of scratch memory cub needs for this reduction */
+    size_t workspaceSize() const { return workspace_size_; }
+
+private:
+    template <typename T>
+    void run(cudaStream_t stream, const T* in, T* out, void* workspace, size_t& workspace_bytes) const;
+    void dispatch(cudaStream_t stream, const void* in, void* out, void* workspace, size_t& workspace_bytes) const;
+
+    Type_t element_type_;
+    Mode mode_;
+    size_t num_segments_;
+    size_t segment_size_;
+    size_t workspace_size_{};
+};
+
+}  // namespace kernel
+}  // namespace nvidia_gpu
+}  // namespace ov
@@ -77,6 +77,21 @@ static inline __global__ void update_thread_per_chunk(const size_t indices_last_
                       output);
 }
 
+template <typename DataType>
+static inline __global__ void update_planned(const size_t num_of_update_elements,
+                                             const size_t* plan_offsets,
+                                             const size_t* plan_chunks,
+                                             const DataType* updates,
+                                             DataType* output) {
+    const auto update_element = blockIdx.y * blockDim.x + threadIdx.x;
+    const auto plan_entry = blockIdx.x;
+
+    if (update_element >= num_of_update_elements) return;
+
+    output[plan_offsets[plan_entry] + update_element] =
+        updates[plan_chunks[plan_entry] * num_of_update_elements + update_element];
+}
+
 ScatterNDUpdate::ScatterNDUpdate(Type_t data_type,
                                  Type_t indices_type,
                                  size_t indices_last_dim,
@@ -113,6 +128,63 @@ void ScatterNDUpdate::operator()(const cudaStream_t stream,
     }
 }
 
+void ScatterNDUpdate::operator()(const cudaStream_t stream,
+                                 const void* input,
+                                 const void* updates,
+                                 const size_t* plan_offsets,
+                                 const size_t* plan_chunks,
+                                 size_t plan_size,
+                                 size_t plan_blocks,
+                                 size_t plan_threads,
+                                 void* output) const {
+    switch (data_type_) {
+        case Type_t::boolean:
+            return CallPlanned<bool>(
+                stream, input, updates, plan_offsets, plan_chunks, plan_size, plan_blocks, plan_threads, output);
+#ifdef CUDA_HAS_BF16_TYPE
+        case Type_t::bf16:
+            return CallPlanned<__nv_bfloat16>(
+                stream, input, updates, plan_offsets, plan_chunks, plan_size, plan_blocks, plan_threads, output);
+#endif
+        case Type_t::f16:
+            return CallPlanned<__half>(
+                stream, input, updates, plan_offsets, plan_chunks, plan_size, plan_blocks, plan_threads, output);
+        case Type_t::f32:
+            return CallPlanned<float>(
+                stream, input, updates, plan_offsets, plan_chunks, plan_size, plan_blocks, plan_threads, output);
+        case Type_t::f64:
+            return CallPlanned<double>(
+                stream, input, updates, plan_offsets, plan_chunks, plan_size, plan_blocks, plan_threads, output);
+        case Type_t::i8:
+            return CallPlanned<int8_t>(
+                stream, input, updates, plan_offsets, plan_chunks, plan_size, plan_blocks, plan_threads, output);
+        case Type_t::i16:
+            return CallPlanned<int16_t>(
+                stream, input, updates, plan_offsets, plan_chunks, plan_size, plan_blocks, plan_threads, output);
+        case Type_t::i32:
+            return CallPlanned<int32_t>(
+                stream, input, updates, plan_offsets, plan_chunks, plan_size, plan_blocks, plan_threads, output);
+        case Type_t::i64:
+            return CallPlanned<int64_t>(
+                stream, input, updates, plan_offsets, plan_chunks, plan_size, plan_blocks, plan_threads, output);
+        case Type_t::u8:
+            return CallPlanned<uint8_t>(
+                stream, input, updates, plan_offsets, plan_chunks, plan_size, plan_blocks, plan_threads, output);
+        case Type_t::u16:
+            return CallPlanned<uint16_t>(
+                stream, input, updates, plan_offsets, plan_chunks, plan_size, plan_blocks, plan_threads, output);
+        case Type_t::u32:
+            return CallPlanned<uint32_t>(
+                stream, input, updates, plan_offsets, plan_chunks, plan_size, plan_blocks, plan_threads, output);
+        case Type_t::u64:
+            return CallPlanned<uint64_t>(
+                stream, input, updates, plan_offsets, plan_chunks, plan_size, plan_blocks, plan_threads, output);
+        default:
+            throwIEException(
+                fmt::format("Data element type = {} is not supported by ScatterNDUpdate operation !!", data_type_));
+    }
+}
+
 template <typename IndexType>
 void ScatterNDUpdate::CallByDataType(const cudaStream_t stream,
                                      const void* input,
@@ -189,6 +261,30 @@ void ScatterNDUpdate::Call(const cudaStream_t stream,
                                                                               output_typed);
     }
 }
+
+template <typename DataType>
+void ScatterNDUpdate::CallPlanned(const cudaStream_t stream,
+                                  const void* input,
+                                  const void* updates,
+                                  const size_t* plan_offsets,
+                                  const size_t* plan_chunks,
+                                  size_t plan_size,
+                                  size_t plan_blocks,
+                                  size_t plan_threads,
+                                  void* output) const {
+    // at the beginning we need the output to be the same as the input
+    throwIfError(
+        cudaMemcpyAsync(output, input, num_of_input_elements_ * sizeof(DataType), cudaMemcpyDeviceToDevice, stream));
+
+    if (plan_size == 0) return;
+
+    const auto updates_typed = static_cast<const DataType*>(updates);
+    auto output_typed = static_cast<DataType*>(output);
+
+    dim3 grid{static_cast<unsigned int>(plan_size), static_cast<unsigned int>(plan_blocks)};
+    kernel::update_planned<<<grid, plan_threads, 0, stream>>>(
+        num_of_update_elements_, plan_offsets, plan_chunks, updates_typed, output_typed);
+}
 }  // namespace kernel
 
 }  // namespace nvidia_gpu
@@ -32,6 +32,22 @@ public:
                     const size_t* input_data_dim_pading,
                     void* output) const;
 
+    /**
+     * Planned variant: the caller resolved index collisions on the host into a
+     * list of conflict-free writes (one surviving update chunk per distinct
+     * output offset, sorted by offset), so no two threads touch the same slot
+     * and the result is deterministic regardless of duplicate indices.
+     */
+    void operator()(const cudaStream_t stream,
+                    const void* input,
+                    const void* updates,
+                    const size_t* plan_offsets,
+                    const size_t* plan_chunks,
+                    size_t plan_size,
+                    size_t plan_blocks,
+                    size_t plan_threads,
+                    void* output) const;
+
     template <typename DataType, typename IndexType>
     void Call(const cudaStream_t stream,
               const void* input,
@@ -48,6 +64,17 @@ public:
                         const size_t* input_data_dim_pading,
                         void* output) const;
 
+    template <typename DataType>
+    void CallPlanned(const cudaStream_t stream,
+                     const void* input,
+                     const void* updates,
+                     const size_t* plan_offsets,
+                     const size_t* plan_chunks,
+                     size_t plan_size,
+                     size_t plan_blocks,
+                     size_t plan_threads,
+                     void* output) const;
+
 private:
     Type_t data_type_;
     Type_t indices_type_;
@@ -43,17 +43,54 @@ static __global__ void select(const bool* condition,
     buffer[idx] = condition[cond_idx] ? then_node[then_idx] : else_node[else_idx];
 }
 
+// Variant consuming the packed bitmask condition written by the comparison
+// kernels: bit i of word w is condition element w * 32 + i
+template <typename T>
+static __global__ void select_packed(const uint32_t* condition,
+                                     const T* then_node,
+                                     const T* else_node,
+                                     const SelectKernelOp::BrcstOffsetType* cond_brcst_offsets,
+                                     const SelectKernelOp::BrcstOffsetType* then_brcst_offsets,
+                                     const SelectKernelOp::BrcstOffsetType* else_brcst_offsets,
+                                     const SelectKernelOp::BrcstOffsetType* output_sizes,
+                                     const size_t max_size,
+                                     T* buffer) {
+    const unsigned idx = blockIdx.x * blockDim.x + threadIdx.x;
+    if (idx >= max_size) return;
+    // calc N, C, D, H, W indexes
+    enum { N, C, D, H, W };
+    const unsigned n = idx / output_sizes[N];
+    const unsigned n_size = n * output_sizes[N];
+    const unsigned c = (idx - n_size) / output_sizes[C];
+    const unsigned c_size = c * output_sizes[C];
+    const unsigned d = (idx - n_size - c_size) / output_sizes[D];
+    const unsigned d_size = d * output_sizes[D];
+    const unsigned h = (idx - n_size - c_size - d_size) / output_sizes[H];
+    const unsigned h_size = h * output_sizes[H];
+    const unsigned w = (idx - n_size - c_size - d_size - h_size) / output_sizes[W];
+    const unsigned cond_idx = cond_brcst_offsets[N] * n + cond_brcst_offsets[C] * c + cond_brcst_offsets[D] * d +
+                              cond_brcst_offsets[H] * h + cond_brcst_offsets[W] * w;
+    const unsigned then_idx = then_brcst_offsets[N] * n + then_brcst_offsets[C] * c + then_brcst_offsets[D] * d +
+                              then_brcst_offsets[H] * h + then_brcst_offsets[W] * w;
+    const unsigned else_idx = else_brcst_offsets[N] * n + else_brcst_offsets[C] * c + else_brcst_offsets[D] * d +
+                              else_brcst_offsets[H] * h + else_brcst_offsets[W] * w;
+    const bool cond = (condition[cond_idx / 32] >> (cond_idx % 32)) & 1u;
+    buffer[idx] = cond ? then_node[then_idx] : else_node[else_idx];
+}
+
 SelectKernelOp::SelectKernelOp(const size_t max_size,
                                const unsigned blocks_number,
                                const unsigned threads_per_block,
-                               const ov::element::Type_t operation_type)
+                               const ov::element::Type_t operation_type,
+                               const bool packed_condition)
     : max_size_{max_size},
       blocks_number_{blocks_number},
       threads_per_block_{threads_per_block},
-      operation_type_{operation_type} {}
+      operation_type_{operation_type},
+      packed_condition_{packed_condition} {}
 
 void SelectKernelOp::operator()(const cudaStream_t stream,
-                                const bool* condition,
+                                const void* condition,
                                 const void* then_node,
                                 const void* else_node,
                                 const BrcstOffsetType* cond_brcst_offsets,
@@ -110,7 +147,7 @@ void SelectKernelOp::operator()(const cudaStream_t stream,
 
 template <typename T>
 void SelectKernelOp::callKernel(const cudaStream_t stream,
-                                const bool* condition,
+                                const void* condition,
                                 const void* then_node,
                                 const void* else_node,
                                 const BrcstOffsetType* cond_brcst_offsets,
@@ -118,7 +155,20 @@ void SelectKernelOp::callKernel(const cudaStream_t stream,
                                 const BrcstOffsetType* else_brcst_offsets,
                                 const BrcstOffsetType* output_sizes,
                                 void* buffer) const {
-    kernel::select<T><<<blocks_number_, threads_per_block_, 0, stream>>>(condition,
+    if (packed_condition_) {
+        kernel::select_packed<T>
+            <<<blocks_number_, threads_per_block_, 0, stream>>>(static_cast<const uint32_t*>(condition),
+                                                                static_cast<const T*>(then_node),
+                                                                static_cast<const T*>(else_node),
+                                                                cond_brcst_offsets,
+                                                                then_brcst_offsets,
+                                                                else_brcst_offsets,
+                                                                output_sizes,
+                                                                max_size_,
+                                                                static_cast<T*>(buffer));
+        return;
+    }
+    kernel::select<T><<<blocks_number_, threads_per_block_, 0, stream>>>(static_cast<const bool*>(condition),
                                                                          static_cast<const T*>(then_node),
                                                                          static_cast<const T*>(else_node),
                                                                          cond_brcst_offsets,
@@ -21,10 +21,11 @@ public:
     SelectKernelOp(const size_t max_size,
                    const unsigned blocks_number,
                    const unsigned threads_per_block,
-                   const ov::element::Type_t operation_type);
+                   const ov::element::Type_t operation_type,
+                   const bool packed_condition);
 
     void operator()(const cudaStream_t stream,
-                    const bool* condition,
+                    const void* condition,
                     const void* then_node,
                     const void* else_node,
                     const BrcstOffsetType* cond_brcst_offsets,
@@ -36,7 +37,7 @@ public:
 private:
     template <typename T>
     void callKernel(const cudaStream_t stream,
-                    const bool* condition,
+                    const void* condition,
                     const void* then_node,
                     const void* else_node,
                     const BrcstOffsetType* cond_brcst_offsets,
@@ -50,6 +51,9 @@ private:
     unsigned blocks_number_;
     unsigned threads_per_block_;
     ov::element::Type_t operation_type_;
+    // The condition producer agreed to write the packed bitmask representation
+    // (see ops/packed_bool_mask.hpp) instead of one byte per element
+    bool packed_condition_;
 };
 
 }  // namespace kernel
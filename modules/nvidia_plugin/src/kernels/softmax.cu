@@ -0,0 +1,113 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <cuda/math.cuh>
+
+#include "softmax.hpp"
+
+namespace ov {
+namespace nvidia_gpu {
+namespace kernel {
+
+constexpr unsigned kWarpSize = 32;
+constexpr unsigned kWarpsPerBlock = 8;
+constexpr unsigned kFullMask = 0xffffffffu;
+
+template <typename CT>
+static __device__ CT warp_reduce_max(CT value) {
+    for (unsigned offset = kWarpSize / 2; offset > 0; offset >>= 1) {
+        const CT other = __shfl_down_sync(kFullMask, value, offset);
+        value = other > value ? other : value;
+    }
+    return __shfl_sync(kFullMask, value, 0);
+}
+
+template <typename CT>
+static __device__ CT warp_reduce_sum(CT value) {
+    for (unsigned offset = kWarpSize / 2; offset > 0; offset >>= 1) {
+        value += __shfl_down_sync(kFullMask, value, offset);
+    }
+    return __shfl_sync(kFullMask, value, 0);
+}
+
+template <typename T, typename CT, bool LogMode>
+static __global__ void warp_softmax(const T* in, T* out, const size_t num_rows, const size_t row_size) {
+    const unsigned lane = threadIdx.x % kWarpSize;
+    const size_t first_row = (static_cast<size_t>(blockIdx.x) * blockDim.x + threadIdx.x) / kWarpSize;
+    const size_t row_stride = static_cast<size_t>(gridDim.x) * blockDim.x / kWarpSize;
+
+    for (size_t row = first_row; row < num_rows; row += row_stride) {
+        const size_t row_offset = row * row_size;
+
+        CT row_max = -INFINITY;
+        for (size_t i = lane; i < row_size; i += kWarpSize) {
+            const CT x = static_cast<CT>(in[row_offset + i]);
+            row_max = x > row_max ? x : row_max;
+        }
+        row_max = warp_reduce_max(row_max);
+
+        CT exp_sum{};
+        for (size_t i = lane; i < row_size; i += kWarpSize) {
+            exp_sum += CUDA::math::exp(static_cast<CT>(in[row_offset + i]) - row_max);
+        }
+        exp_sum = warp_reduce_sum(exp_sum);
+
+        if (LogMode) {
+            const CT log_sum = ::log(exp_sum);
+            for (size_t i = lane; i < row_size; i += kWarpSize) {
+                out[row_offset + i] = static_cast<T>(static_cast<CT>(in[row_offset + i]) - row_max - log_sum);
+            }
+        } else {
+            const CT inv_sum = CT{1.0f} / exp_sum;
+            for (size_t i = lane; i < row_size; i += kWarpSize) {
+                out[row_offset + i] =
+                    static_cast<T>(CUDA::math::exp(static_cast<CT>(in[row_offset + i]) - row_max) * inv_sum);
+            }
+        }
+    }
+}
+
+Softmax::Softmax(Type_t element_type, bool log_mode, size_t num_rows, size_t row_size, size_t max_blocks)
+    : element_type_{element_type}, log_mode_{log_mode}, num_rows_{num_rows}, row_size_{row_size} {
+    // One warp per row; the grid stays device-sized and the grid-stride loop
+    // absorbs any surplus rows
+    const size_t blocks_for_rows = (num_rows + kWarpsPerBlock - 1) / kWarpsPerBlock;
+    num_blocks_ = std::max(size_t{1}, std::min(blocks_for_rows, max_blocks));
+}
+
+template <typename T, typename CT>
+void Softmax::callKernel(cudaStream_t stream, const void* in, void* out) const {
+    constexpr unsigned threads_per_block = kWarpsPerBlock * kWarpSize;
+    if (log_mode_) {
+        warp_softmax<T, CT, true><<<num_blocks_, threads_per_block, 0, stream>>>(
+            static_cast<const T*>(in), static_cast<T*>(out), num_rows_, row_size_);
+    } else {
+        warp_softmax<T, CT, false><<<num_blocks_, threads_per_block, 0, stream>>>(
+            static_cast<const T*>(in), static_cast<T*>(out), num_rows_, row_size_);
+    }
+}
+
+void Softmax::operator()(cudaStream_t stream, const void* in, void* out) const {
+    switch (element_type_) {
+        case Type_t::f16:
+            return callKernel<__half, float>(stream, in, out);
+#ifdef CUDA_HAS_BF16_TYPE
+        case Type_t::bf16:
+            return callKernel<__nv_bfloat16, float>(stream, in, out);
+#endif
+        case Type_t::f32:
+            return callKernel<float, float>(stream, in, out);
+        case Type_t::f64:
+            return callKernel<double, double>(stream, in, out);
+        default:
+            throwIEException(fmt::format("Element type = {} is not supported by Softmax operation.", element_type_));
+    }
+}
+
+}  // namespace kernel
+}  // namespace nvidia_gpu
+}  // namespace ov
@@ -0,0 +1,44 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "cuda_type_traits.hpp"
+#include "error.hpp"
+
+namespace ov {
+namespace nvidia_gpu {
+namespace kernel {
+
+/**
+ * Warp-per-row softmax over the innermost axis.
+ *
+ * cudnnSoftmaxForward schedules one grid per call, which underperforms on
+ * many-small-rows workloads such as attention scores (thousands of rows a
+ * few hundred elements wide). Here every warp owns one row - max, exp-sum
+ * and normalization are warp shuffle reductions with no shared memory or
+ * extra passes - and a grid-stride loop over rows keeps a fixed, device-
+ * sized grid resident for any batch count. Log-softmax is fused in as a
+ * mode instead of a separate elementwise pass over the result.
+ */
+class Softmax {
+public:
+    Softmax(Type_t element_type, bool log_mode, size_t num_rows, size_t row_size, size_t max_blocks);
+
+    void operator()(cudaStream_t stream, const void* in, void* out) const;
+
+private:
+    template <typename T, typename CT>
+    void callKernel(cudaStream_t stream, const void* in, void* out) const;
+
+    Type_t element_type_;
+    bool log_mode_;
+    size_t num_rows_;
+    size_t row_size_;
+    size_t num_blocks_;
+};
+
+}  // namespace kernel
+}  // namespace nvidia_gpu
+}  // namespace ov
@@ -2,9 +2,19 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <cuda.h>
+
 #include <cassert>
 #include <cstdio>
 #include <cuda/float16.hpp>
+#include <cuda/math.cuh>
+#include <type_traits>
+
+#if CUDA_VERSION >= 11000
+#include <cub/device/device_segmented_radix_sort.cuh>
+#include <cub/iterator/counting_input_iterator.cuh>
+#include <cub/iterator/transform_input_iterator.cuh>
+#endif
 
 #include "cuda/stl/algorithms/sort.cuh"
 #include "error.hpp"
@@ -18,6 +28,134 @@ namespace kernel {
 
 using TopKShape = Shape<size_t, TopK::kNumKernelParamDim>;
 
+namespace {
+
+constexpr size_t kWorkspaceAlignment = 256;
+constexpr size_t kWarpSize = 32;
+constexpr size_t kBitonicBlockSize = 128;
+
+size_t alignUp(const size_t value, const size_t alignment) {
+    return (value + alignment - 1) / alignment * alignment;
+}
+
+size_t nextPowerOfTwo(size_t value) {
+    size_t result = 1;
+    while (result < value) {
+        result <<= 1;
+    }
+    return result;
+}
+
+size_t elementSizeOf(const Type_t type) {
+    switch (type) {
+        case Type_t::boolean:
+        case Type_t::i8:
+        case Type_t::u8:
+            return 1;
+#ifdef CUDA_HAS_BF16_TYPE
+        case Type_t::bf16:
+#endif
+        case Type_t::f16:
+        case Type_t::i16:
+        case Type_t::u16:
+            return 2;
+        case Type_t::f32:
+        case Type_t::i32:
+        case Type_t::u32:
+            return 4;
+        case Type_t::f64:
+        case Type_t::i64:
+        case Type_t::u64:
+            return 8;
+        default:
+            throwIEException(
+                fmt::format("Element type = {} is not supported by TopK operation !!", static_cast<Type_t>(type)));
+    }
+}
+
+// Element types the CUB radix backend handles; must stay in sync with the
+// RadixSupported trait below
+bool isRadixSupportedType(const Type_t type) {
+#if CUDA_VERSION >= 11000
+    switch (type) {
+        case Type_t::boolean:
+        case Type_t::f16:
+        case Type_t::f32:
+        case Type_t::f64:
+        case Type_t::i8:
+        case Type_t::i16:
+        case Type_t::i32:
+        case Type_t::i64:
+        case Type_t::u8:
+        case Type_t::u16:
+        case Type_t::u32:
+        case Type_t::u64:
+            return true;
+        default:
+            return false;
+    }
+#else
+    return false;
+#endif
+}
+
+template <typename T>
+struct RadixSupported : std::true_type {};
+#ifdef CUDA_HAS_BF16_TYPE
+template <>
+struct RadixSupported<__nv_bfloat16> : std::false_type {};
+#endif
+
+// Padding values of the bitonic network: strictly worse than any real element
+// of the chunk, so they always sort to the tail
+template <typename T, typename Enable = void>
+struct SortLimits;
+
+template <typename T>
+struct SortLimits<T, std::enable_if_t<std::is_integral<T>::value>> {
+    static __device__ T lowest() { return CUDA::math::limit_min<T>(); }
+    static __device__ T highest() { return CUDA::math::limit_max<T>(); }
+};
+
+template <typename T>
+struct SortLimits<T, std::enable_if_t<std::is_floating_point<T>::value>> {
+    static __device__ T lowest() { return static_cast<T>(-HUGE_VAL); }
+    static __device__ T highest() { return static_cast<T>(HUGE_VAL); }
+};
+
+template <>
+struct SortLimits<__half> {
+    static __device__ __half lowest() { return __float2half(-HUGE_VALF); }
+    static __device__ __half highest() { return __float2half(HUGE_VALF); }
+};
+
+#ifdef CUDA_HAS_BF16_TYPE
+template <>
+struct SortLimits<__nv_bfloat16> {
+    static __device__ __nv_bfloat16 lowest() { return __float2bfloat16(-HUGE_VALF); }
+    static __device__ __nv_bfloat16 highest() { return __float2bfloat16(HUGE_VALF); }
+};
+#endif
+
+#if CUDA_VERSION >= 11000
+struct ChunkOffset {
+    int chunk_size;
+    __host__ __device__ int operator()(const int i) const { return i * chunk_size; }
+};
+
+struct ChunkTopOffset {
+    int chunk_size;
+    int k;
+    __host__ __device__ int operator()(const int i) const { return i * chunk_size + k; }
+};
+
+using CountingIterator = cub::CountingInputIterator<int>;
+using ChunkOffsetIterator = cub::TransformInputIterator<int, ChunkOffset, CountingIterator>;
+using ChunkTopOffsetIterator = cub::TransformInputIterator<int, ChunkTopOffset, CountingIterator>;
+#endif
+
+}  // namespace
+
 template <typename T, typename U>
 __device__ inline bool compare_min(const CUDA::Pair<T, U>& a, const CUDA::Pair<T, U>& b) {
     if (a.first < b.first) return true;
@@ -85,6 +223,115 @@ __global__ void topk_sort(CUDA::Pair<T, TIdx>* workspace,
     }
 }
 
+/**
+ * Sorts one chunk per warp through a bitonic network held in shared memory.
+ * The chunk is padded to a power of two with sentinel elements that sort to
+ * the tail, so the network never needs bounds handling.
+ */
+template <TopK::ComputeType Compute, TopK::SortType Sort, typename T, typename TIdx>
+__global__ void topk_bitonic(CUDA::Pair<T, TIdx>* workspace,
+                             const std::size_t workspace_chunks,
+                             const std::size_t workspace_chunk_size,
+                             const std::size_t padded_chunk_size,
+                             const std::size_t k) {
+    extern __shared__ unsigned char shared_storage[];
+    using PairType = CUDA::Pair<T, TIdx>;
+
+    const unsigned warp = threadIdx.x / kWarpSize;
+    const unsigned lane = threadIdx.x % kWarpSize;
+    const std::size_t chunk = blockIdx.x * (blockDim.x / kWarpSize) + warp;
+    if (chunk >= workspace_chunks) {
+        return;
+    }
+    PairType* tile = reinterpret_cast<PairType*>(shared_storage) + warp * padded_chunk_size;
+    PairType* src = &workspace[chunk * workspace_chunk_size];
+
+    for (std::size_t i = lane; i < padded_chunk_size; i += kWarpSize) {
+        if (i < workspace_chunk_size) {
+            tile[i] = src[i];
+        } else {
+            tile[i].first = (Compute == TopK::ComputeType::Max) ? SortLimits<T>::lowest() : SortLimits<T>::highest();
+            tile[i].second = CUDA::math::limit_max<TIdx>();
+        }
+    }
+    __syncwarp();
+
+    for (std::size_t size = 2; size <= padded_chunk_size; size <<= 1) {
+        for (std::size_t stride = size >> 1; stride > 0; stride >>= 1) {
+            for (std::size_t i = lane; i < padded_chunk_size; i += kWarpSize) {
+                const std::size_t j = i ^ stride;
+                if (j > i) {
+                    const bool forward = ((i & size) == 0);
+                    const bool before = (Compute == TopK::ComputeType::Max) ? compare_max(tile[j], tile[i])
+                                                                            : compare_min(tile[j], tile[i]);
+                    const bool reversed_before = (Compute == TopK::ComputeType::Max) ? compare_max(tile[i], tile[j])
+                                                                                     : compare_min(tile[i], tile[j]);
+                    if (forward ? before : reversed_before) {
+                        CUDA::algorithms::swap(tile[i], tile[j]);
+                    }
+                }
+            }
+            __syncwarp();
+        }
+    }
+
+    if (Sort == TopK::SortType::SortIndices) {
+        const std::size_t k_effective = (k < workspace_chunk_size) ? k : workspace_chunk_size;
+        if (lane == 0) {
+            CUDA::algorithms::quick_sort_iterative(tile, tile + k_effective, sort_indices_ascending<T, TIdx>);
+        }
+        __syncwarp();
+    }
+
+    for (std::size_t i = lane; i < workspace_chunk_size; i += kWarpSize) {
+        src[i] = tile[i];
+    }
+}
+
+/** Preprocess of the radix backend: splits values and indices into the flat key/value arrays CUB expects. */
+template <typename T, typename TIdx>
+__global__ void topk_radix_preprocess(const T* in,
+                                      T* keys,
+                                      TIdx* indices,
+                                      const std::size_t num_input_element,
+                                      const std::size_t workspace_chunk_size,
+                                      const TopK::KernelParam* kernel_param) {
+    const std::size_t i = blockIdx.x * blockDim.x + threadIdx.x;
+    if (i >= num_input_element) {
+        return;
+    }
+
+    TopKShape indexes{};
+    calculate_indexes_by_flat_address(indexes, i, kernel_param->input_shape_axis);
+    const size_t input_index = flat_address_by_strides(kernel_param->input_strides, indexes);
+
+    keys[i] = in[input_index];
+    indices[i] = i % workspace_chunk_size;
+}
+
+template <typename TValue, typename UIndex>
+__global__ void topk_radix_store(TValue* out_val,
+                                 UIndex* out_idx,
+                                 const TValue* keys,
+                                 const UIndex* indices,
+                                 const std::size_t k,
+                                 const std::size_t num_output_element,
+                                 const std::size_t workspace_chunk_size,
+                                 const TopK::KernelParam* kernel_param) {
+    const unsigned i = blockIdx.x * blockDim.x + threadIdx.x;
+    if (i >= num_output_element) {
+        return;
+    }
+
+    TopKShape indexes{};
+    calculate_indexes_by_flat_address(indexes, i, kernel_param->output_shape_axis);
+    const size_t output_index = flat_address_by_strides(kernel_param->output_strides, indexes);
+    const size_t workspace_index = (i / k) * workspace_chunk_size + (i % k);
+
+    out_val[output_index] = keys[workspace_index];
+    out_idx[output_index] = indices[workspace_index];
+}
+
 template <typename TValue, typename UIndex>
 __global__ void topk_store(TValue* out_val,
                            UIndex* out_idx,
@@ -130,11 +377,45 @@ TopK::TopK(const Type_t element_type,
     preprocess_.num_blocks_ = (num_input_element + max_threads_per_block - 1) / max_threads_per_block;
     preprocess_.threads_per_block_ = (preprocess_.num_blocks_ == 1) ? num_input_element : max_threads_per_block;
 
-    sort_.num_blocks_ = (workspace_chunks_ + max_threads_per_block - 1) / max_threads_per_block;
-    sort_.threads_per_block_ = (sort_.num_blocks_ == 1) ? workspace_chunks_ : max_threads_per_block;
-
     store_.num_blocks_ = (num_output_element + max_threads_per_block - 1) / max_threads_per_block;
     store_.threads_per_block_ = (store_.num_blocks_ == 1) ? num_output_element : max_threads_per_block;
+
+    if (workspace_chunk_size_ <= kBitonicChunkLimit) {
+        algo_ = Algo::Bitonic;
+        padded_chunk_size_ = nextPowerOfTwo(workspace_chunk_size_);
+        const size_t warps_per_block = kBitonicBlockSize / kWarpSize;
+        sort_.num_blocks_ = (workspace_chunks_ + warps_per_block - 1) / warps_per_block;
+        sort_.threads_per_block_ =
+            (sort_.num_blocks_ == 1) ? workspace_chunks_ * kWarpSize : kBitonicBlockSize;
+    } else if (isRadixSupportedType(element_type)) {
+        algo_ = Algo::Radix;
+        sort_ = {0, 0};  // the sort runs inside CUB, not in a plugin kernel
+    } else {
+        algo_ = Algo::Chunked;
+        sort_.num_blocks_ = (workspace_chunks_ + max_threads_per_block - 1) / max_threads_per_block;
+        sort_.threads_per_block_ = (sort_.num_blocks_ == 1) ? workspace_chunks_ : max_threads_per_block;
+    }
+
+    const size_t element_size = elementSizeOf(element_type);
+    const size_t index_size = elementSizeOf(index_element_type);
+    if (algo_ == Algo::Radix) {
+        size_t offset = alignUp(num_input_element_ * element_size, kWorkspaceAlignment);
+        ws_keys_alt_offset_ = offset;
+        offset += alignUp(num_input_element_ * element_size, kWorkspaceAlignment);
+        ws_indices_offset_ = offset;
+        offset += alignUp(num_input_element_ * index_size, kWorkspaceAlignment);
+        ws_indices_alt_offset_ = offset;
+        offset += alignUp(num_input_element_ * index_size, kWorkspaceAlignment);
+        ws_temp_offset_ = offset;
+        radix_temp_bytes_ = computeRadixTempBytes();
+        workspace_size_ = offset + radix_temp_bytes_;
+    } else {
+        // Size of CUDA::Pair<TElement, TIndex> including the padding dictated
+        // by the member alignments
+        const size_t pair_alignment = (element_size > index_size) ? element_size : index_size;
+        const size_t pair_size = alignUp(alignUp(element_size, index_size) + index_size, pair_alignment);
+        workspace_size_ = num_input_element_ * pair_size;
+    }
 }
 
 template <typename TElementType>
@@ -169,6 +450,10 @@ void TopK::callKernelByIndexElementType(cudaStream_t stream,
                                         void* out_index,
                                         void* workspace,
                                         const void* kernel_param) const {
+    if (algo_ == Algo::Radix) {
+        callRadix<TElementType, TIndexElementType>(stream, in, out_value, out_index, workspace, kernel_param);
+        return;
+    }
     switch (compute_type_) {
         case ComputeType::Min: {
             callKernelByComputeType<TElementType, TIndexElementType, ComputeType::Min>(
@@ -231,11 +516,23 @@ void TopK::callKernelBySortType(cudaStream_t stream,
         num_input_element_,
         workspace_chunk_size_,
         kernel_param_ptr);
-    topk_sort<ComputeType, SortType><<<sort_.num_blocks_, sort_.threads_per_block_, 0, stream>>>(
-        static_cast<CUDA::Pair<TElementType, TIndexElementType>*>(workspace),
-        workspace_chunks_,
-        workspace_chunk_size_,
-        k_);
+    if (algo_ == Algo::Bitonic) {
+        const size_t warps_per_block = (sort_.threads_per_block_ + kWarpSize - 1) / kWarpSize;
+        const size_t shared_bytes =
+            warps_per_block * padded_chunk_size_ * sizeof(CUDA::Pair<TElementType, TIndexElementType>);
+        topk_bitonic<ComputeType, SortType><<<sort_.num_blocks_, sort_.threads_per_block_, shared_bytes, stream>>>(
+            static_cast<CUDA::Pair<TElementType, TIndexElementType>*>(workspace),
+            workspace_chunks_,
+            workspace_chunk_size_,
+            padded_chunk_size_,
+            k_);
+    } else {
+        topk_sort<ComputeType, SortType><<<sort_.num_blocks_, sort_.threads_per_block_, 0, stream>>>(
+            static_cast<CUDA::Pair<TElementType, TIndexElementType>*>(workspace),
+            workspace_chunks_,
+            workspace_chunk_size_,
+            k_);
+    }
     topk_store<<<store_.num_blocks_, store_.threads_per_block_, 0, stream>>>(
         static_cast<TElementType*>(out_value),
         static_cast<TIndexElementType*>(out_index),
@@ -246,6 +543,191 @@ void TopK::callKernelBySortType(cudaStream_t stream,
         kernel_param_ptr);
 }
 
+template <typename TElementType, typename TIndexElementType>
+void TopK::callRadix(cudaStream_t stream,
+                     const void* in,
+                     void* out_value,
+                     void* out_index,
+                     void* workspace,
+                     const void* kernel_param) const {
+#if CUDA_VERSION >= 11000
+    if constexpr (RadixSupported<TElementType>::value) {
+        auto* const base = static_cast<uint8_t*>(workspace);
+        auto* const keys = reinterpret_cast<TElementType*>(base);
+        auto* const keys_alt = reinterpret_cast<TElementType*>(base + ws_keys_alt_offset_);
+        auto* const indices = reinterpret_cast<TIndexElementType*>(base + ws_indices_offset_);
+        auto* const indices_alt = reinterpret_cast<TIndexElementType*>(base + ws_indices_alt_offset_);
+        void* const temp = base + ws_temp_offset_;
+        const KernelParam* kernel_param_ptr = static_cast<const KernelParam*>(kernel_param);
+
+        topk_radix_preprocess<<<preprocess_.num_blocks_, preprocess_.threads_per_block_, 0, stream>>>(
+            static_cast<const TElementType*>(in),
+            keys,
+            indices,
+            num_input_element_,
+            workspace_chunk_size_,
+            kernel_param_ptr);
+
+        const CountingIterator counting{0};
+        const ChunkOffsetIterator begin_offsets{counting, ChunkOffset{static_cast<int>(workspace_chunk_size_)}};
+        const ChunkOffsetIterator end_offsets{CountingIterator{1},
+                                              ChunkOffset{static_cast<int>(workspace_chunk_size_)}};
+        size_t temp_bytes = radix_temp_bytes_;
+        // A stable sort of (value, index) pairs keeps equal values in ascending
+        // index order, matching the tie breaking of the comparison backends
+        if (compute_type_ == ComputeType::Max) {
+            throwIfError(cub::DeviceSegmentedRadixSort::SortPairsDescending(temp,
+                                                                            temp_bytes,
+                                                                            keys,
+                                                                            keys_alt,
+                                                                            indices,
+                                                                            indices_alt,
+                                                                            static_cast<int>(num_input_element_),
+                                                                            static_cast<int>(workspace_chunks_),
+                                                                            begin_offsets,
+                                                                            end_offsets,
+                                                                            0,
+                                                                            sizeof(TElementType) * 8,
+                                                                            stream));
+        } else {
+            throwIfError(cub::DeviceSegmentedRadixSort::SortPairs(temp,
+                                                                  temp_bytes,
+                                                                  keys,
+                                                                  keys_alt,
+                                                                  indices,
+                                                                  indices_alt,
+                                                                  static_cast<int>(num_input_element_),
+                                                                  static_cast<int>(workspace_chunks_),
+                                                                  begin_offsets,
+                                                                  end_offsets,
+                                                                  0,
+                                                                  sizeof(TElementType) * 8,
+                                                                  stream));
+        }
+
+        const TElementType* result_keys = keys_alt;
+        const TIndexElementType* result_indices = indices_alt;
+        if (sort_type_ == SortType::SortIndices) {
+            // Re-sort the top-k prefix of every chunk by index, keys ride along
+            const size_t k_effective = (k_ < workspace_chunk_size_) ? k_ : workspace_chunk_size_;
+            const ChunkTopOffsetIterator topk_end_offsets{
+                counting, ChunkTopOffset{static_cast<int>(workspace_chunk_size_), static_cast<int>(k_effective)}};
+            temp_bytes = radix_temp_bytes_;
+            throwIfError(cub::DeviceSegmentedRadixSort::SortPairs(temp,
+                                                                  temp_bytes,
+                                                                  indices_alt,
+                                                                  indices,
+                                                                  keys_alt,
+                                                                  keys,
+                                                                  static_cast<int>(num_input_element_),
+                                                                  static_cast<int>(workspace_chunks_),
+                                                                  begin_offsets,
+                                                                  topk_end_offsets,
+                                                                  0,
+                                                                  sizeof(TIndexElementType) * 8,
+                                                                  stream));
+            result_keys = keys;
+            result_indices = indices;
+        }
+
+        topk_radix_store<<<store_.num_blocks_, store_.threads_per_block_, 0, stream>>>(
+            static_cast<TElementType*>(out_value),
+            static_cast<TIndexElementType*>(out_index),
+            result_keys,
+            result_indices,
+            k_,
+            num_output_element_,
+            workspace_chunk_size_,
+            kernel_param_ptr);
+        return;
+    }
+#endif
+    throwIEException(fmt::format("TopK radix backend does not support element type = {} !!",
+                                 static_cast<Type_t>(element_type_)));
+}
+
+size_t TopK::computeRadixTempBytes() const {
+    switch (element_type_) {
+        case Type_t::boolean:
+            return radixTempBytesByIndexType<char>();
+        case Type_t::f16:
+            return radixTempBytesByIndexType<__half>();
+        case Type_t::f32:
+            return radixTempBytesByIndexType<float>();
+        case Type_t::f64:
+            return radixTempBytesByIndexType<double>();
+        case Type_t::i8:
+            return radixTempBytesByIndexType<std::int8_t>();
+        case Type_t::i16:
+            return radixTempBytesByIndexType<std::int16_t>();
+        case Type_t::i32:
+            return radixTempBytesByIndexType<std::int32_t>();
+        case Type_t::i64:
+            return radixTempBytesByIndexType<std::int64_t>();
+        case Type_t::u8:
+            return radixTempBytesByIndexType<std::uint8_t>();
+        case Type_t::u16:
+            return radixTempBytesByIndexType<std::uint16_t>();
+        case Type_t::u32:
+            return radixTempBytesByIndexType<std::uint32_t>();
+        case Type_t::u64:
+            return radixTempBytesByIndexType<std::uint64_t>();
+        default:
+            throwIEException(fmt::format("TopK radix backend does not support element type = {} !!",
+                                         static_cast<Type_t>(element_type_)));
+    }
+}
+
+template <typename TElementType>
+size_t TopK::radixTempBytesByIndexType() const {
+    switch (index_element_type_) {
+        case Type_t::i32:
+            return radixTempBytes<TElementType, std::int32_t>();
+        case Type_t::i64:
+            return radixTempBytes<TElementType, std::int64_t>();
+        default:
+            throwIEException(fmt::format("Index element type = {} is not supported by TopK operation !!",
+                                         static_cast<Type_t>(index_element_type_)));
+    }
+}
+
+template <typename TElementType, typename TIndexElementType>
+size_t TopK::radixTempBytes() const {
+#if CUDA_VERSION >= 11000
+    if constexpr (RadixSupported<TElementType>::value) {
+        const CountingIterator counting{0};
+        const ChunkOffsetIterator begin_offsets{counting, ChunkOffset{static_cast<int>(workspace_chunk_size_)}};
+        const ChunkOffsetIterator end_offsets{CountingIterator{1},
+                                              ChunkOffset{static_cast<int>(workspace_chunk_size_)}};
+        size_t temp_bytes = 0;
+        throwIfError(cub::DeviceSegmentedRadixSort::SortPairs(nullptr,
+                                                              temp_bytes,
+                                                              static_cast<const TElementType*>(nullptr),
+                                                              static_cast<TElementType*>(nullptr),
+                                                              static_cast<const TIndexElementType*>(nullptr),
+                                                              static_cast<TIndexElementType*>(nullptr),
+                                                              static_cast<int>(num_input_element_),
+                                                              static_cast<int>(workspace_chunks_),
+                                                              begin_offsets,
+                                                              end_offsets));
+        size_t index_temp_bytes = 0;
+        throwIfError(cub::DeviceSegmentedRadixSort::SortPairs(nullptr,
+                                                              index_temp_bytes,
+                                                              static_cast<const TIndexElementType*>(nullptr),
+                                                              static_cast<TIndexElementType*>(nullptr),
+                                                              static_cast<const TElementType*>(nullptr),
+                                                              static_cast<TElementType*>(nullptr),
+                                                              static_cast<int>(num_input_element_),
+                                                              static_cast<int>(workspace_chunks_),
+                                                              begin_offsets,
+                                                              end_offsets));
+        return alignUp((temp_bytes > index_temp_bytes) ? temp_bytes : index_temp_bytes, kWorkspaceAlignment);
+    }
+#endif
+    throwIEException(fmt::format("TopK radix backend does not support element type = {} !!",
+                                 static_cast<Type_t>(element_type_)));
+}
+
 void TopK::operator()(cudaStream_t stream,
                       const void* in,
                       void* out_value,
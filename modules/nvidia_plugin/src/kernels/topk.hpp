@@ -24,6 +24,21 @@ public:
         Max,
     };
 
+    /**
+     * Sorting backend, chosen once at network load time from the axis extent:
+     * - Bitonic: axis fits one warp-level shared-memory bitonic network
+     * - Radix: CUB segmented radix sort, profitable on long axes
+     * - Chunked: generic per-axis partial quicksort fallback
+     */
+    enum class Algo {
+        Chunked,
+        Bitonic,
+        Radix,
+    };
+
+    /// Largest axis extent handled by the bitonic backend
+    static constexpr size_t kBitonicChunkLimit = 256;
+
     static constexpr size_t kNumKernelParamDim = 5;
     struct KernelParam {
         size_t input_shape_axis[kNumKernelParamDim]{};
@@ -51,6 +66,10 @@ public:
                     void* workspace,
                     const void* kernel_param) const;
 
+    /// Workspace size of the selected backend, in bytes
+    size_t getWorkspaceSize() const { return workspace_size_; }
+    Algo algo() const { return algo_; }
+
 private:
     template <typename TElementType>
     void callKernelByElementType(cudaStream_t stream,
@@ -80,6 +99,18 @@ private:
                               void* out_index,
                               void* workspace,
                               const void* kernel_param) const;
+    template <typename TElementType, typename TIndexElementType>
+    void callRadix(cudaStream_t stream,
+                   const void* in,
+                   void* out_value,
+                   void* out_index,
+                   void* workspace,
+                   const void* kernel_param) const;
+    size_t computeRadixTempBytes() const;
+    template <typename TElementType>
+    size_t radixTempBytesByIndexType() const;
+    template <typename TElementType, typename TIndexElementType>
+    size_t radixTempBytes() const;
 
     struct KernelGridParam {
         size_t num_blocks_;
@@ -99,6 +130,18 @@ private:
     KernelGridParam preprocess_;
     KernelGridParam sort_;
     KernelGridParam store_;
+
+    Algo algo_{Algo::Chunked};
+    size_t workspace_size_{};
+    // Axis extent padded to the next power of two for the bitonic network
+    size_t padded_chunk_size_{};
+    // Byte offsets of the radix backend sections inside the workspace:
+    // [keys | keys_alt | indices | indices_alt | cub temp storage]
+    size_t ws_keys_alt_offset_{};
+    size_t ws_indices_offset_{};
+    size_t ws_indices_alt_offset_{};
+    size_t ws_temp_offset_{};
+    size_t radix_temp_bytes_{};
 };
 
 }  // namespace kernel
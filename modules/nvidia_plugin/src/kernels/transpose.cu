@@ -0,0 +1,228 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <gsl/gsl_assert>
+
+#include "transpose.hpp"
+
+namespace ov {
+namespace nvidia_gpu {
+namespace kernel {
+
+template <typename T>
+static __global__ void transpose_tiled(const T *in, T *out, size_t num_batches, size_t rows, size_t cols) {
+    // The extra column keeps the threads of one warp in distinct shared memory
+    // banks during the transposed read
+    __shared__ T tile[Transpose::kTileDim][Transpose::kTileDim + 1];
+    for (size_t batch = blockIdx.z; batch < num_batches; batch += gridDim.z) {
+        const T *src = in + batch * rows * cols;
+        T *dst = out + batch * rows * cols;
+
+        size_t col = blockIdx.x * Transpose::kTileDim + threadIdx.x;
+        size_t row = blockIdx.y * Transpose::kTileDim + threadIdx.y;
+        for (size_t j = 0; j < Transpose::kTileDim; j += Transpose::kBlockRows) {
+            if (col < cols && row + j < rows) {
+                tile[threadIdx.y + j][threadIdx.x] = src[(row + j) * cols + col];
+            }
+        }
+        __syncthreads();
+
+        col = blockIdx.y * Transpose::kTileDim + threadIdx.x;
+        row = blockIdx.x * Transpose::kTileDim + threadIdx.y;
+        for (size_t j = 0; j < Transpose::kTileDim; j += Transpose::kBlockRows) {
+            if (col < rows && row + j < cols) {
+                dst[(row + j) * rows + col] = tile[threadIdx.x][threadIdx.y + j];
+            }
+        }
+        __syncthreads();
+    }
+}
+
+template <typename T>
+static __global__ void transpose_generic(const T *in, T *out, Transpose::Props props, size_t num_elements) {
+    const size_t i = static_cast<size_t>(blockIdx.x) * blockDim.x + threadIdx.x;
+    if (i >= num_elements) {
+        return;
+    }
+    size_t remaining = i;
+    size_t src_index = 0;
+    for (size_t d = 0; d < props.rank; ++d) {
+        src_index += (remaining / props.out_strides[d]) * props.src_strides[d];
+        remaining %= props.out_strides[d];
+    }
+    out[i] = in[src_index];
+}
+
+Transpose::Transpose(const Type_t element_type,
+                     const std::vector<size_t> &in_shape,
+                     const std::vector<int> &permutation,
+                     const size_t max_threads_per_block) {
+    Expects(in_shape.size() == permutation.size());
+    Expects(in_shape.size() <= kMaxRank);
+    switch (element_type) {
+        case Type_t::boolean:
+        case Type_t::i8:
+        case Type_t::u8:
+            element_size_ = 1;
+            break;
+#ifdef CUDA_HAS_BF16_TYPE
+        case Type_t::bf16:
+#endif
+        case Type_t::f16:
+        case Type_t::i16:
+        case Type_t::u16:
+            element_size_ = 2;
+            break;
+        case Type_t::f32:
+        case Type_t::i32:
+        case Type_t::u32:
+            element_size_ = 4;
+            break;
+        case Type_t::f64:
+        case Type_t::i64:
+        case Type_t::u64:
+            element_size_ = 8;
+            break;
+        default:
+            throwIEException(fmt::format("Transpose: element type = {} is not supported.",
+                                         static_cast<int>(element_type)));
+    }
+    num_elements_ = 1;
+    for (const auto extent : in_shape) {
+        num_elements_ *= extent;
+    }
+
+    // Drop unit extents: they neither move data nor affect addressing
+    std::vector<size_t> shape;
+    std::vector<int> perm;
+    std::vector<int> remap(in_shape.size(), -1);
+    for (size_t d = 0; d < in_shape.size(); ++d) {
+        if (in_shape[d] != 1) {
+            remap[d] = static_cast<int>(shape.size());
+            shape.push_back(in_shape[d]);
+        }
+    }
+    for (const auto p : permutation) {
+        if (remap[p] >= 0) {
+            perm.push_back(remap[p]);
+        }
+    }
+
+    // Merge input dimensions that stay adjacent in the output; each run of
+    // consecutive input dimensions behaves as one larger dimension
+    std::vector<size_t> merged_extents;
+    std::vector<int> group_of_dim(shape.size());
+    std::vector<int> merged_perm;
+    std::vector<int> group_start;
+    for (size_t k = 0; k < perm.size(); ++k) {
+        if (k > 0 && perm[k] == perm[k - 1] + 1) {
+            group_of_dim[perm[k]] = group_of_dim[perm[k - 1]];
+        } else {
+            group_of_dim[perm[k]] = static_cast<int>(group_start.size());
+            group_start.push_back(perm[k]);
+        }
+    }
+    // Collapsed input order is the input order of the group leaders
+    std::vector<int> groups_in_input_order(group_start.size());
+    for (size_t g = 0; g < group_start.size(); ++g) {
+        groups_in_input_order[g] = static_cast<int>(g);
+    }
+    std::sort(groups_in_input_order.begin(), groups_in_input_order.end(), [&](int lhs, int rhs) {
+        return group_start[lhs] < group_start[rhs];
+    });
+    std::vector<int> group_position(group_start.size());
+    merged_extents.resize(group_start.size(), 1);
+    for (size_t pos = 0; pos < groups_in_input_order.size(); ++pos) {
+        group_position[groups_in_input_order[pos]] = static_cast<int>(pos);
+    }
+    for (size_t d = 0; d < shape.size(); ++d) {
+        merged_extents[group_position[group_of_dim[d]]] *= shape[d];
+    }
+    for (const auto start : group_start) {
+        merged_perm.push_back(group_position[group_of_dim[start]]);
+    }
+
+    if (merged_perm.size() <= 1) {
+        algo_ = Algo::copy;
+    } else if (merged_perm == std::vector<int>{1, 0}) {
+        algo_ = Algo::tiled;
+        num_batches_ = 1;
+        rows_ = merged_extents[0];
+        cols_ = merged_extents[1];
+    } else if (merged_perm == std::vector<int>{0, 2, 1}) {
+        algo_ = Algo::tiled;
+        num_batches_ = merged_extents[0];
+        rows_ = merged_extents[1];
+        cols_ = merged_extents[2];
+    } else {
+        algo_ = Algo::generic;
+        props_.rank = merged_perm.size();
+        std::vector<size_t> in_strides(merged_extents.size(), 1);
+        for (int d = static_cast<int>(merged_extents.size()) - 2; d >= 0; --d) {
+            in_strides[d] = in_strides[d + 1] * merged_extents[d + 1];
+        }
+        size_t out_stride = 1;
+        for (int d = static_cast<int>(merged_perm.size()) - 1; d >= 0; --d) {
+            props_.out_strides[d] = out_stride;
+            props_.src_strides[d] = in_strides[merged_perm[d]];
+            out_stride *= merged_extents[merged_perm[d]];
+        }
+        std::tie(num_blocks_, threads_per_block_) = calculateElementwiseGrid(num_elements_, max_threads_per_block);
+    }
+}
+
+template <typename T>
+void Transpose::callTiled(const cudaStream_t stream, const void *in, void *out) const {
+    const auto cdiv = [](size_t value, size_t divisor) { return (value + divisor - 1) / divisor; };
+    const dim3 grid{static_cast<unsigned>(cdiv(cols_, kTileDim)),
+                    static_cast<unsigned>(cdiv(rows_, kTileDim)),
+                    static_cast<unsigned>(std::min(num_batches_, static_cast<size_t>(65535)))};
+    const dim3 block{kTileDim, kBlockRows};
+    transpose_tiled<T>
+        <<<grid, block, 0, stream>>>(static_cast<const T *>(in), static_cast<T *>(out), num_batches_, rows_, cols_);
+}
+
+template <typename T>
+void Transpose::callGeneric(const cudaStream_t stream, const void *in, void *out) const {
+    transpose_generic<T><<<num_blocks_, threads_per_block_, 0, stream>>>(
+        static_cast<const T *>(in), static_cast<T *>(out), props_, num_elements_);
+}
+
+void Transpose::operator()(const cudaStream_t stream, const void *in, void *out) const {
+    if (algo_ == Algo::copy) {
+        throwIfError(cudaMemcpyAsync(out, in, num_elements_ * element_size_, cudaMemcpyDeviceToDevice, stream));
+        return;
+    }
+    const auto call = [&](auto dummy) {
+        using T = decltype(dummy);
+        if (algo_ == Algo::tiled) {
+            callTiled<T>(stream, in, out);
+        } else {
+            callGeneric<T>(stream, in, out);
+        }
+    };
+    switch (element_size_) {
+        case 1:
+            call(uint8_t{});
+            break;
+        case 2:
+            call(uint16_t{});
+            break;
+        case 4:
+            call(uint32_t{});
+            break;
+        case 8:
+            call(uint64_t{});
+            break;
+        default:
+            throwIEException(fmt::format("Transpose: element size = {} is not supported.", element_size_));
+    }
+}
+
+}  // namespace kernel
+}  // namespace nvidia_gpu
+}  // namespace ov
@@ -0,0 +1,74 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include "cuda_type_traits.hpp"
+#include "error.hpp"
+#include "tensor_helpers.hpp"
+
+namespace ov {
+namespace nvidia_gpu {
+namespace kernel {
+
+/**
+ * Native transpose kernel. Unlike the cuTENSOR-based path it has no library
+ * dependency, so it serves the deployments where cuTENSOR is absent and any
+ * permutation cuTENSOR does not cover.
+ *
+ * The permutation is first collapsed: unit extents are dropped and input
+ * dimensions that stay adjacent in the output are merged. When the collapsed
+ * form is a (batched) 2D transpose the copy runs through bank-conflict-free
+ * 32x32 shared-memory tiles, so both the loads and the stores are coalesced;
+ * otherwise a generic strided kernel moves one element per thread. An identity
+ * collapse degenerates into a plain device-to-device copy.
+ */
+class Transpose {
+public:
+    static constexpr size_t kMaxRank = 8;
+    static constexpr size_t kTileDim = 32;
+    static constexpr size_t kBlockRows = 8;
+
+    struct Props {
+        size_t out_strides[kMaxRank]{};
+        size_t src_strides[kMaxRank]{};
+        size_t rank{};
+    };
+
+    Transpose(Type_t element_type,
+              const std::vector<size_t>& in_shape,
+              const std::vector<int>& permutation,
+              size_t max_threads_per_block);
+
+    void operator()(cudaStream_t stream, const void* in, void* out) const;
+
+private:
+    enum class Algo { copy, tiled, generic };
+
+    template <typename T>
+    void callTiled(cudaStream_t stream, const void* in, void* out) const;
+    template <typename T>
+    void callGeneric(cudaStream_t stream, const void* in, void* out) const;
+
+    Algo algo_{Algo::copy};
+    size_t element_size_{};
+    size_t num_elements_{};
+
+    // Batched 2D transpose extents of the tiled algorithm
+    size_t num_batches_{};
+    size_t rows_{};
+    size_t cols_{};
+
+    // Addressing of the generic algorithm
+    Props props_{};
+    unsigned num_blocks_{};
+    unsigned threads_per_block_{};
+};
+
+}  // namespace kernel
+}  // namespace nvidia_gpu
+}  // namespace ov
@@ -6,6 +6,7 @@
 #include <array>
 
 #include "cuda_type_traits.hpp"
+#include "element_type_pruning.hpp"
 #include "error.hpp"
 #include "fmt/format.h"
 
@@ -55,6 +56,30 @@ enum Dimension : size_t { DIM_1D = 1, DIM_2D, DIM_3D };
 /// And the function pointer can be accessed like the next.
 ///    auto func_ptr = instance[ov::nvidia_gpu::kernel::Type_t::f32];
 // clang-format on
+/// Stand-in for combinations pruned out of the build (see
+/// element_type_pruning.hpp); keeps the functor matrix fully populated so the
+/// lookup stays a plain subscript while the pruned kernels are never
+/// instantiated
+template <typename TFunPtr>
+struct PrunedTypeEntry;
+template <typename R, typename... Args>
+struct PrunedTypeEntry<R (*)(Args...)> {
+    static R function(Args...) {
+        throwIEException(
+            "Operation was called with an element type pruned out of this build "
+            "(see the CUDA_KERNEL_ELEMENT_TYPES build option) !!");
+    }
+};
+
+template <template <typename... Types> class TFunctor, typename TFunPtr, Type_t... Types>
+constexpr TFunPtr typedFunctorEntry() {
+    if constexpr (all_element_types_enabled<Types...>) {
+        return &TFunctor<cuda_type_traits_t<Types>...>::function;
+    } else {
+        return &PrunedTypeEntry<TFunPtr>::function;
+    }
+}
+
 template <template <typename... Types> class TFunctor, typename TFunPtr, Dimension D>
 struct TypedFunctor : private std::array<TypedFunctor<TFunctor, TFunPtr, Dimension(D - 1)>, type_count> {
     constexpr TypedFunctor() : TypedFunctor(std::make_index_sequence<type_count>(), std::make_index_sequence<0>()) {}
@@ -102,8 +127,10 @@ private:
     template <size_t... I, size_t... Indx>
     constexpr TypedFunctor(std::index_sequence<I...>, std::index_sequence<Indx...>)
         : std::array<TFunPtr, type_count>{
-              &TFunctor<cuda_type_traits_t<static_cast<Type_t>(Indx + type_t_first_value)>...,
-                        cuda_type_traits_t<static_cast<Type_t>(I + type_t_first_value)>>::function...} {}
+              typedFunctorEntry<TFunctor,
+                                TFunPtr,
+                                static_cast<Type_t>(Indx + type_t_first_value)...,
+                                static_cast<Type_t>(I + type_t_first_value)>()...} {}
 };
 
 }  // namespace kernel
@@ -0,0 +1,141 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <fmt/format.h>
+
+#include <cuda/math.cuh>
+
+#include "welford_mvn.hpp"
+
+namespace ov {
+namespace nvidia_gpu {
+namespace kernel {
+
+template <typename CT>
+struct WelfordPartial {
+    CT count{};
+    CT mean{};
+    CT m2{};
+
+    __device__ void accumulate(CT x) {
+        count += CT{1.0f};
+        const CT delta = x - mean;
+        mean += delta / count;
+        m2 += delta * (x - mean);
+    }
+
+    // Chan's pairwise combination of two partial aggregates
+    __device__ void combine(const WelfordPartial& other) {
+        if (other.count == CT{}) {
+            return;
+        }
+        if (count == CT{}) {
+            *this = other;
+            return;
+        }
+        const CT total = count + other.count;
+        const CT delta = other.mean - mean;
+        mean += delta * other.count / total;
+        m2 += other.m2 + delta * delta * count * other.count / total;
+        count = total;
+    }
+};
+
+template <typename T, typename CT, bool NormalizeVariance, bool EpsilonInsideSqrt>
+static __global__ void welford_mvn(const T* in, T* out, const size_t row_size, const CT epsilon) {
+    extern __shared__ char shared_raw[];
+    WelfordPartial<CT>* partials = reinterpret_cast<WelfordPartial<CT>*>(shared_raw);
+
+    const size_t row_offset = static_cast<size_t>(blockIdx.x) * row_size;
+    const unsigned tid = threadIdx.x;
+
+    WelfordPartial<CT> partial{};
+    for (size_t i = tid; i < row_size; i += blockDim.x) {
+        partial.accumulate(static_cast<CT>(in[row_offset + i]));
+    }
+    partials[tid] = partial;
+    __syncthreads();
+
+    for (unsigned stride = blockDim.x / 2; stride > 0; stride >>= 1) {
+        if (tid < stride) {
+            partials[tid].combine(partials[tid + stride]);
+        }
+        __syncthreads();
+    }
+
+    const CT mean = partials[0].mean;
+    CT factor{};
+    if (NormalizeVariance) {
+        const CT variance = partials[0].m2 / partials[0].count;
+        if (EpsilonInsideSqrt) {
+            factor = CT{1.0f} / CUDA::math::sqrt(variance + epsilon);
+        } else {
+            factor = CT{1.0f} / (CUDA::math::sqrt(variance) + epsilon);
+        }
+    }
+
+    for (size_t i = tid; i < row_size; i += blockDim.x) {
+        const CT centered = static_cast<CT>(in[row_offset + i]) - mean;
+        out[row_offset + i] = static_cast<T>(NormalizeVariance ? centered * factor : centered);
+    }
+}
+
+WelfordMvn::WelfordMvn(Type_t element_type,
+                       size_t num_rows,
+                       size_t row_size,
+                       double epsilon,
+                       bool epsilon_inside_sqrt,
+                       bool normalize_variance,
+                       size_t max_threads_per_block)
+    : element_type_{element_type},
+      num_rows_{num_rows},
+      row_size_{row_size},
+      epsilon_{epsilon},
+      epsilon_inside_sqrt_{epsilon_inside_sqrt},
+      normalize_variance_{normalize_variance} {
+    // The tree reduction expects a power-of-two block
+    size_t threads = 1;
+    while (threads * 2 <= max_threads_per_block && threads * 2 <= 512 && threads < row_size) {
+        threads *= 2;
+    }
+    threads_per_block_ = threads;
+}
+
+template <typename T, typename CT>
+void WelfordMvn::callKernel(cudaStream_t stream, const void* in, void* out) const {
+    const auto shared_bytes = threads_per_block_ * sizeof(WelfordPartial<CT>);
+    if (normalize_variance_) {
+        if (epsilon_inside_sqrt_) {
+            welford_mvn<T, CT, true, true><<<num_rows_, threads_per_block_, shared_bytes, stream>>>(
+                static_cast<const T*>(in), static_cast<T*>(out), row_size_, static_cast<CT>(epsilon_));
+        } else {
+            welford_mvn<T, CT, true, false><<<num_rows_, threads_per_block_, shared_bytes, stream>>>(
+                static_cast<const T*>(in), static_cast<T*>(out), row_size_, static_cast<CT>(epsilon_));
+        }
+    } else {
+        welford_mvn<T, CT, false, false><<<num_rows_, threads_per_block_, shared_bytes, stream>>>(
+            static_cast<const T*>(in), static_cast<T*>(out), row_size_, static_cast<CT>(epsilon_));
+    }
+}
+
+void WelfordMvn::operator()(cudaStream_t stream, const void* in, void* out) const {
+    switch (element_type_) {
+        case Type_t::f16:
+            return callKernel<__half, float>(stream, in, out);
+#ifdef CUDA_HAS_BF16_TYPE
+        case Type_t::bf16:
+            return callKernel<__nv_bfloat16, float>(stream, in, out);
+#endif
+        case Type_t::f32:
+            return callKernel<float, float>(stream, in, out);
+        case Type_t::f64:
+            return callKernel<double, double>(stream, in, out);
+        default:
+            throwIEException(fmt::format("Element type = {} is not supported by WelfordMvn operation.", element_type_));
+    }
+}
+
+}  // namespace kernel
+}  // namespace nvidia_gpu
+}  // namespace ov
@@ -0,0 +1,51 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "cuda_type_traits.hpp"
+#include "error.hpp"
+
+namespace ov {
+namespace nvidia_gpu {
+namespace kernel {
+
+/**
+ * Single-pass mean/variance normalization over the trailing axes.
+ *
+ * Each block owns one row (the product of the non-reduced leading axes
+ * selects the row, the reduced trailing axes form it). Threads accumulate
+ * Welford partials over their stripe of the row, the block combines them
+ * with a shared-memory tree reduction and then normalizes the row in the
+ * same launch, instead of the mean/subtract/square/mean/scale ladder of
+ * separate full-tensor passes.
+ */
+class WelfordMvn {
+public:
+    WelfordMvn(Type_t element_type,
+               size_t num_rows,
+               size_t row_size,
+               double epsilon,
+               bool epsilon_inside_sqrt,
+               bool normalize_variance,
+               size_t max_threads_per_block);
+
+    void operator()(cudaStream_t stream, const void* in, void* out) const;
+
+private:
+    template <typename T, typename CT>
+    void callKernel(cudaStream_t stream, const void* in, void* out) const;
+
+    Type_t element_type_;
+    size_t num_rows_;
+    size_t row_size_;
+    double epsilon_;
+    bool epsilon_inside_sqrt_;
+    bool normalize_variance_;
+    size_t threads_per_block_;
+};
+
+}  // namespace kernel
+}  // namespace nvidia_gpu
+}  // namespace ov
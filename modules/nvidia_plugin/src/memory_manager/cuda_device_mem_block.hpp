@@ -6,6 +6,7 @@
 
 #include <cuda/runtime.hpp>
 #include <gsl/pointers>
+#include <memory>
 
 #include "memory_manager/model/cuda_memory_model.hpp"
 
@@ -16,6 +17,12 @@ namespace nvidia_gpu {
  * @brief Allocates and owns continuous memory blob on CUDA device.
  * Uses MemoryModel to determine a size of memory to allocate and
  * to map tensor offsets to device side pointers.
+ *
+ * When the model carries a pinned-host spill section (see ResidencyAdvisor)
+ * a second blob of mapped page-locked memory backs the spilled tensors; the
+ * device accesses it over PCIe through its mapped device address, so kernels
+ * consume the spilled tensors unchanged and a model larger than device memory
+ * still loads.
  */
 class DeviceMemBlock {
 public:
@@ -55,7 +62,11 @@ public:
 
 private:
     MemoryModel::Ptr model_;
-    CUDA::DefaultAllocation device_mem_ptr_ = CUDA::DefaultStream::stream().malloc(model_->deviceMemoryBlockSize());
+    CUDA::DefaultAllocation device_mem_ptr_;
+    // Mapped page-locked blob backing the spilled tensors and its device-side
+    // address; both null when the whole model is device resident
+    std::unique_ptr<void, void (*)(void*)> host_mem_ptr_{nullptr, nullptr};
+    void* host_mem_device_ptr_ = nullptr;
 };
 
 }  // namespace nvidia_gpu
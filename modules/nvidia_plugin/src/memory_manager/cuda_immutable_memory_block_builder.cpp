@@ -4,26 +4,213 @@
 
 #include "cuda_immutable_memory_block_builder.hpp"
 
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <cuda/event.hpp>
 #include <details/ie_exception.hpp>
+#include <functional>
+#include <string_view>
 
 namespace ov {
 namespace nvidia_gpu {
 
+namespace {
+
+// Size of one half of the pinned staging area. Two halves are used in rotation
+// so the host packs the next chunk while the previous one is still in flight.
+constexpr size_t kStagingChunkSize = 32 * 1024 * 1024;
+
+// Granularity of cudaHostRegister when streaming a large constant; a multiple
+// of kHostPageSize so consecutive chunks never pin the same page twice.
+constexpr size_t kRegisterChunkSize = 64 * 1024 * 1024;
+
+// Host page granularity used to align cudaHostRegister ranges.
+constexpr size_t kHostPageSize = 4096;
+
+// Page-locked staging area for coalesced uploads. The destructor synchronizes
+// the device before releasing the memory so no in-flight copy can still read
+// from it, including when an upload throws half-way through.
+struct PinnedStagingBuffer {
+    void* ptr = nullptr;
+    explicit PinnedStagingBuffer(size_t bsize) noexcept {
+        if (::cudaHostAlloc(&ptr, bsize, cudaHostAllocDefault) != cudaSuccess) {
+            ptr = nullptr;
+        }
+    }
+    PinnedStagingBuffer(const PinnedStagingBuffer&) = delete;
+    PinnedStagingBuffer& operator=(const PinnedStagingBuffer&) = delete;
+    ~PinnedStagingBuffer() {
+        if (ptr) {
+            logIfError(::cudaDeviceSynchronize());
+            logIfError(::cudaFreeHost(ptr));
+        }
+    }
+};
+
+/**
+ * Streams one constant that is too large for the staging buffer to the device.
+ * The source region is page-locked with cudaHostRegister one chunk at a time
+ * and uploaded asynchronously, registering the next chunk while the previous
+ * copy is in flight. When the weights are memory-mapped from disk this faults
+ * in and pins at most two chunks of them at any moment instead of the whole
+ * tensor, so host memory overhead stays bounded by the chunk size.
+ */
+void streamToDevice(const CUDA::Stream& stream, uint8_t* dst, const uint8_t* src, size_t bsize) {
+    auto* const aligned_begin =
+        reinterpret_cast<uint8_t*>(reinterpret_cast<uintptr_t>(src) & ~uintptr_t{kHostPageSize - 1});
+    const uint8_t* const src_end = src + bsize;
+    auto* const aligned_end = reinterpret_cast<uint8_t*>(
+        (reinterpret_cast<uintptr_t>(src_end) + kHostPageSize - 1) & ~uintptr_t{kHostPageSize - 1});
+
+    CUDA::Event copy_done[2]{};
+    uint8_t* registered[2]{nullptr, nullptr};
+    const auto unpinSlot = [&](size_t slot) {
+        if (registered[slot]) {
+            copy_done[slot].synchronize();
+            logIfError(::cudaHostUnregister(registered[slot]));
+            registered[slot] = nullptr;
+        }
+    };
+
+    try {
+        size_t slot = 0;
+        for (uint8_t* chunk = aligned_begin; chunk < aligned_end; chunk += kRegisterChunkSize, slot ^= 1) {
+            unpinSlot(slot);
+            const size_t register_bsize = std::min<size_t>(kRegisterChunkSize, aligned_end - chunk);
+            const uint8_t* const copy_begin = std::max<const uint8_t*>(chunk, src);
+            const uint8_t* const copy_end = std::min<const uint8_t*>(chunk + register_bsize, src_end);
+            if (::cudaHostRegister(chunk, register_bsize, cudaHostRegisterDefault) != cudaSuccess) {
+                // Registration can fail e.g. for exotic mappings; finish the
+                // remainder with one synchronous pageable copy.
+                unpinSlot(0);
+                unpinSlot(1);
+                throwIfError(::cudaMemcpy(dst + (copy_begin - src), copy_begin, src_end - copy_begin,
+                                          cudaMemcpyHostToDevice));
+                return;
+            }
+            registered[slot] = chunk;
+            stream.upload(CUDA::DevicePointer<void*>{dst + (copy_begin - src)}, copy_begin, copy_end - copy_begin);
+            copy_done[slot].record(stream);
+        }
+        unpinSlot(0);
+        unpinSlot(1);
+    } catch (...) {
+        logIfError(::cudaDeviceSynchronize());
+        for (auto* chunk : registered) {
+            if (chunk) {
+                logIfError(::cudaHostUnregister(chunk));
+            }
+        }
+        throw;
+    }
+}
+
+}  // namespace
+
 void ImmutableMemoryBlockBuilder::addAllocation(BufferID id, const void* data, size_t bsize) {
     IE_ASSERT(data != nullptr);
+    // A tensor that is byte-identical to an already added one shares its
+    // allocation instead of getting a new one, so identical weights (tied
+    // embeddings, constants repeated per branch) live on the device once
+    // and are uploaded once.
+    const size_t content_hash = std::hash<std::string_view>{}(std::string_view{static_cast<const char*>(data), bsize});
+    for (const size_t index : content_hashes_[content_hash]) {
+        const auto& peer = allocations_[index];
+        if (peer.bsize == bsize && (peer.data == data || std::memcmp(peer.data, data, bsize) == 0)) {
+            model_builder_.shareAllocation(id, peer.id);
+            return;
+        }
+    }
     model_builder_.addAllocation(id, bsize);
+    content_hashes_[content_hash].push_back(allocations_.size());
     allocations_.emplace_back(AllocRecord{id, data, bsize});
 }
 
 size_t ImmutableMemoryBlockBuilder::deviceMemoryBlockSize() const { return model_builder_.deviceMemoryBlockSize(); }
 
+bool ImmutableMemoryBlockBuilder::uploadCoalesced(const DeviceMemBlock& memory_block) const {
+    // A single constant that fits the staging area gains nothing over the
+    // plain synchronous copy; a single huge one still profits from streaming.
+    if (allocations_.empty() ||
+        (allocations_.size() == 1 && allocations_.front().bsize <= kStagingChunkSize)) {
+        return false;
+    }
+    PinnedStagingBuffer staging{2 * kStagingChunkSize};
+    if (staging.ptr == nullptr) {
+        return false;
+    }
+
+    // Packing several constants into one copy requires their device ranges to
+    // be contiguous, so order the records by device address first.
+    struct UploadRecord {
+        uint8_t* device_ptr;
+        const void* data;
+        size_t bsize;
+    };
+    std::vector<UploadRecord> records;
+    records.reserve(allocations_.size());
+    for (const auto& allocation : allocations_) {
+        void* device_ptr = memory_block.deviceBufferPtr(allocation.id);
+        IE_ASSERT(device_ptr != nullptr);
+        records.emplace_back(UploadRecord{static_cast<uint8_t*>(device_ptr), allocation.data, allocation.bsize});
+    }
+    std::sort(records.begin(), records.end(), [](const UploadRecord& lhs, const UploadRecord& rhs) {
+        return lhs.device_ptr < rhs.device_ptr;
+    });
+
+    CUDA::Stream stream{};
+    CUDA::Event chunk_ready[2]{};
+    bool chunk_in_flight[2]{false, false};
+    size_t chunk = 0;
+    size_t idx = 0;
+    while (idx < records.size()) {
+        uint8_t* const chunk_ptr = static_cast<uint8_t*>(staging.ptr) + chunk * kStagingChunkSize;
+        if (chunk_in_flight[chunk]) {
+            chunk_ready[chunk].synchronize();
+        }
+        // Pack as many consecutive constants as fit into the chunk. Alignment
+        // gaps between them are copied as-is: they map to padding on the device.
+        uint8_t* const range_begin = records[idx].device_ptr;
+        size_t filled = 0;
+        while (idx < records.size()) {
+            const auto& record = records[idx];
+            const size_t range_end = static_cast<size_t>(record.device_ptr - range_begin) + record.bsize;
+            if (range_end > kStagingChunkSize) {
+                break;
+            }
+            std::memcpy(chunk_ptr + (record.device_ptr - range_begin), record.data, record.bsize);
+            filled = range_end;
+            ++idx;
+        }
+        if (filled == 0) {
+            // A single constant larger than a staging chunk; stream it through
+            // page-locked registration of its own (possibly memory-mapped)
+            // host buffer instead of going through the staging area.
+            streamToDevice(stream, range_begin, static_cast<const uint8_t*>(records[idx].data), records[idx].bsize);
+            ++idx;
+            continue;
+        }
+        stream.upload(CUDA::DevicePointer<void*>{range_begin}, chunk_ptr, filled);
+        chunk_ready[chunk].record(stream);
+        chunk_in_flight[chunk] = true;
+        chunk ^= 1;
+    }
+    stream.synchronize();
+    return true;
+}
+
 std::pair<DeviceMemBlock::Ptr, MemoryModel::Ptr> ImmutableMemoryBlockBuilder::build() {
     auto memory_model = model_builder_.build();
     auto memory_block = std::make_shared<DeviceMemBlock>(memory_model);
-    for (const auto& allocation : allocations_) {
-        void* device_ptr = memory_block->deviceBufferPtr(allocation.id);
-        IE_ASSERT(device_ptr != nullptr);
-        throwIfError(::cudaMemcpy(device_ptr, allocation.data, allocation.bsize, cudaMemcpyHostToDevice));
+    if (!uploadCoalesced(*memory_block)) {
+        // Pinned staging is unavailable or not worth it: fall back to one
+        // synchronous copy per constant.
+        for (const auto& allocation : allocations_) {
+            void* device_ptr = memory_block->deviceBufferPtr(allocation.id);
+            IE_ASSERT(device_ptr != nullptr);
+            throwIfError(::cudaMemcpy(device_ptr, allocation.data, allocation.bsize, cudaMemcpyHostToDevice));
+        }
     }
     return {memory_block, memory_model};
 }
@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <unordered_map>
 #include <vector>
 
 #include "memory_manager/cuda_device_mem_block.hpp"
@@ -48,6 +49,16 @@ public:
     size_t deviceMemoryBlockSize() const;
 
 private:
+    /**
+     * Packs constant tensors into a page-locked staging buffer and uploads them
+     * with a few large asynchronous copies instead of one `cudaMemcpy` per
+     * tensor.
+     * @returns false if the coalesced path is not applicable (pinned memory
+     * unavailable or too few constants); the caller then falls back to
+     * per-tensor copies.
+     */
+    bool uploadCoalesced(const DeviceMemBlock& memory_block) const;
+
     ImmutableMemoryModelBuilder model_builder_;
     struct AllocRecord {
         BufferID id;
@@ -55,6 +66,8 @@ private:
         size_t bsize;
     };
     std::vector<AllocRecord> allocations_;
+    /** Content hash to allocation indices with that hash; used to deduplicate byte-identical tensors */
+    std::unordered_map<size_t, std::vector<size_t>> content_hashes_;
 };
 
 }  // namespace nvidia_gpu
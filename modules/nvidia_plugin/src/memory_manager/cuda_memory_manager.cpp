@@ -18,9 +18,63 @@ MemoryManager::MemoryManager(DeviceMemBlock::Ptr immutableTensors,
       mutable_tensors_model_{mutableMemoryModel},
       immutable_workbuffers_{immutableWorkbufferMemory} {}
 
+void MemoryManager::registerOperation(const OperationBase& operation) {
+    const auto& meta = static_cast<const IOperationMeta&>(operation);
+    TensorTable tensorTable;
+    for (auto id : meta.GetInputIds()) {
+        if (const void* ptr = immutable_tensors_->deviceTensorPtr(id)) {
+            tensorTable.inputs.push_back(TensorLocation{ptr, 0});
+        } else {
+            ptrdiff_t offset = 0;
+            const bool found = mutable_tensors_model_->offsetForBuffer(id.GetBuffer().GetId(), offset);
+            IE_ASSERT(found) << "Tensor not found. ID is " << id;
+            tensorTable.inputs.push_back(TensorLocation{nullptr, offset + static_cast<ptrdiff_t>(id.GetOffset())});
+        }
+    }
+    for (auto id : meta.GetOutputIds()) {
+        ptrdiff_t offset = 0;
+        const bool found = mutable_tensors_model_->offsetForBuffer(id.GetBuffer().GetId(), offset);
+        IE_ASSERT(found) << "Tensor not found. ID is " << id;
+        tensorTable.outputs.push_back(offset + static_cast<ptrdiff_t>(id.GetOffset()));
+    }
+    tensor_tables_.emplace(&meta, std::move(tensorTable));
+
+    const auto& exec = static_cast<const IOperationExec&>(operation);
+    WorkbufferTable workbufferTable;
+    const auto& indices = exec.GetWorkbufferIds();
+    for (const auto immutable_id : indices.immutableIds) {
+        void* ptr = immutable_workbuffers_->deviceBufferPtr(immutable_id);
+        IE_ASSERT(ptr != nullptr) << "Workbuffer not found. ID is " << immutable_id;
+        workbufferTable.immutable_ptrs.push_back(ptr);
+    }
+    for (const auto mutable_id : indices.mutableIds) {
+        ptrdiff_t offset = 0;
+        const bool found = mutable_tensors_model_->offsetForBuffer(mutable_id, offset);
+        IE_ASSERT(found) << "Workbuffer not found. ID is " << mutable_id;
+        workbufferTable.mutable_offsets.push_back(offset);
+    }
+    workbuffer_tables_.emplace(&exec, std::move(workbufferTable));
+}
+
 MemoryManager::InputTensors MemoryManager::inputTensorPointers(const IOperationMeta& operation,
                                                                CUDA::DevicePointer<void*> mutableBufferPtr) const {
     InputTensors result;
+    inputTensorPointers(operation, mutableBufferPtr, result);
+    return result;
+}
+
+void MemoryManager::inputTensorPointers(const IOperationMeta& operation,
+                                        CUDA::DevicePointer<void*> mutableBufferPtr,
+                                        InputTensors& result) const {
+    result.clear();
+    if (const auto table = tensor_tables_.find(&operation); table != tensor_tables_.end()) {
+        const auto base = mutableBufferPtr.cast<uint8_t*>().get();
+        for (const auto& location : table->second.inputs) {
+            result.emplace_back(location.immutable_ptr ? location.immutable_ptr : base + location.offset);
+        }
+        return;
+    }
+    // Slow path for operations which were not registered at load time
     for (auto id : operation.GetInputIds()) {
         const void* ptr = immutable_tensors_->deviceTensorPtr(id);
         if (ptr == nullptr) ptr = mutable_tensors_model_->deviceTensorPtr(mutableBufferPtr.cast<uint8_t*>(), id);
@@ -28,24 +82,58 @@ MemoryManager::InputTensors MemoryManager::inputTensorPointers(const IOperationM
         IE_ASSERT(ptr != nullptr) << "Tensor not found. ID is " << id;
         result.emplace_back(ptr);
     }
-    return result;
 }
 
 MemoryManager::OutputTensors MemoryManager::outputTensorPointers(const IOperationMeta& operation,
                                                                  CUDA::DevicePointer<void*> mutableBufferPtr) const {
     OutputTensors result;
+    outputTensorPointers(operation, mutableBufferPtr, result);
+    return result;
+}
+
+void MemoryManager::outputTensorPointers(const IOperationMeta& operation,
+                                         CUDA::DevicePointer<void*> mutableBufferPtr,
+                                         OutputTensors& result) const {
+    result.clear();
+    if (const auto table = tensor_tables_.find(&operation); table != tensor_tables_.end()) {
+        const auto base = mutableBufferPtr.cast<uint8_t*>().get();
+        for (const auto offset : table->second.outputs) {
+            result.emplace_back(base + offset);
+        }
+        return;
+    }
+    // Slow path for operations which were not registered at load time
     for (auto id : operation.GetOutputIds()) {
         void* ptr = mutable_tensors_model_->deviceTensorPtr(mutableBufferPtr.cast<uint8_t*>(), id);
 
         IE_ASSERT(ptr != nullptr) << "Tensor not found. ID is " << id;
         result.emplace_back(ptr);
     }
-    return result;
 }
 
 Workbuffers MemoryManager::workBuffers(const IOperationExec& operation,
                                        CUDA::DevicePointer<void*> mutableBufferPtr) const {
     Workbuffers result{};
+    workBuffers(operation, mutableBufferPtr, result);
+    return result;
+}
+
+void MemoryManager::workBuffers(const IOperationExec& operation,
+                                CUDA::DevicePointer<void*> mutableBufferPtr,
+                                Workbuffers& result) const {
+    result.immutable_buffers.clear();
+    result.mutable_buffers.clear();
+    if (const auto table = workbuffer_tables_.find(&operation); table != workbuffer_tables_.end()) {
+        const auto base = mutableBufferPtr.cast<uint8_t*>().get();
+        for (void* ptr : table->second.immutable_ptrs) {
+            result.immutable_buffers.emplace_back(ptr);
+        }
+        for (const auto offset : table->second.mutable_offsets) {
+            result.mutable_buffers.emplace_back(base + offset);
+        }
+        return;
+    }
+    // Slow path for operations which were not registered at load time
     const auto& indices = operation.GetWorkbufferIds();
     for (const auto immutable_id : indices.immutableIds) {
         void* ptr = immutable_workbuffers_->deviceBufferPtr(immutable_id);
@@ -57,7 +145,6 @@ Workbuffers MemoryManager::workBuffers(const IOperationExec& operation,
         IE_ASSERT(ptr != nullptr) << "Workbuffer not found. ID is " << mutable_id;
         result.mutable_buffers.emplace_back(ptr);
     }
-    return result;
 }
 
 }  // namespace nvidia_gpu
@@ -6,6 +6,7 @@
 
 #include <gsl/span>
 #include <memory>
+#include <unordered_map>
 #include <vector>
 
 #include "cuda/device_pointers.hpp"
@@ -19,6 +20,7 @@ namespace nvidia_gpu {
 class MemoryModel;
 class IOperationMeta;
 class IOperationExec;
+class OperationBase;
 
 /**
  * @brief MemoryManager provides device side tensor pointers by
@@ -45,6 +47,15 @@ public:
                   MemoryModel::Ptr mutableMemoryModel,
                   DeviceMemBlock::Ptr immutableWorkbufferMemory = nullptr);
 
+    /**
+     * Resolves tensor and workbuffer identifiers of an operation once, at network
+     * load time. Immutable tensors are stored as final device pointers and mutable
+     * ones as offsets, so per-inference mapping is just a base-pointer add instead
+     * of hash lookups. Must only be called while the network is being loaded;
+     * lookups at inference time are lock-free reads.
+     */
+    void registerOperation(const OperationBase& operation);
+
     /**
      * Maps input tensor identifiers into device side tensor pointers.
      * @param[in] operation An operation which defines input tensors.
@@ -55,6 +66,14 @@ public:
     InputTensors inputTensorPointers(const IOperationMeta& operation,
                                      CUDA::DevicePointer<void*> mutableBufferPtr) const;
 
+    /**
+     * Same as above, but fills a caller owned vector so its capacity is reused
+     * across operations and no allocation happens on the inference hot path.
+     */
+    void inputTensorPointers(const IOperationMeta& operation,
+                             CUDA::DevicePointer<void*> mutableBufferPtr,
+                             InputTensors& result) const;
+
     /**
      * Maps output tensor identifiers into device side tensor pointers.
      * @param[in] operation An operation which defines output tensors.
@@ -65,6 +84,13 @@ public:
     OutputTensors outputTensorPointers(const IOperationMeta& operation,
                                        CUDA::DevicePointer<void*> mutableBufferPtr) const;
 
+    /**
+     * Allocation-free variant of outputTensorPointers, see inputTensorPointers.
+     */
+    void outputTensorPointers(const IOperationMeta& operation,
+                              CUDA::DevicePointer<void*> mutableBufferPtr,
+                              OutputTensors& result) const;
+
     /**
      * Maps operation onto device side work work buffer pointers.
      * @param[in] operation An operation
@@ -74,12 +100,27 @@ public:
      */
     Workbuffers workBuffers(const IOperationExec& operation, CUDA::DevicePointer<void*> mutableBufferPtr) const;
 
+    /**
+     * Allocation-free variant of workBuffers, see inputTensorPointers.
+     */
+    void workBuffers(const IOperationExec& operation,
+                     CUDA::DevicePointer<void*> mutableBufferPtr,
+                     Workbuffers& result) const;
+
     /**
      * Returns immutable tensors
      * @return DeviceMemBlock
      */
     [[nodiscard]] const DeviceMemBlock& immutableTensors() const { return *immutable_tensors_; }
 
+    /**
+     * Returns shared ownership of the immutable tensors blob so another compiled
+     * graph of the same weights can reuse it instead of re-allocating and
+     * re-uploading the constants
+     * @return DeviceMemBlock::Ptr
+     */
+    [[nodiscard]] DeviceMemBlock::Ptr immutableTensorsPtr() const { return immutable_tensors_; }
+
     /**
      * Returns mutable tensors model
      * @return MemoryModel
@@ -93,9 +134,28 @@ public:
     [[nodiscard]] const DeviceMemBlock& immutableWorkbuffers() const { return *immutable_workbuffers_; }
 
 private:
+    /**
+     * Location of a single tensor resolved at load time: a final device pointer
+     * for immutable tensors, an offset into the mutable block otherwise
+     */
+    struct TensorLocation {
+        const void* immutable_ptr;
+        ptrdiff_t offset;
+    };
+    struct TensorTable {
+        std::vector<TensorLocation> inputs;
+        std::vector<ptrdiff_t> outputs;
+    };
+    struct WorkbufferTable {
+        std::vector<void*> immutable_ptrs;
+        std::vector<ptrdiff_t> mutable_offsets;
+    };
+
     DeviceMemBlock::Ptr immutable_tensors_;
     MemoryModel::Ptr mutable_tensors_model_;
     DeviceMemBlock::Ptr immutable_workbuffers_;
+    std::unordered_map<const IOperationMeta*, TensorTable> tensor_tables_;
+    std::unordered_map<const IOperationExec*, WorkbufferTable> workbuffer_tables_;
 };
 
 }  // namespace nvidia_gpu
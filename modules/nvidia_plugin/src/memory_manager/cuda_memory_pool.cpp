@@ -6,16 +6,40 @@
 
 #include <fmt/printf.h>
 
+#include <algorithm>
+#include <cstdlib>
+#include <utils/event_counters.hpp>
+
 #include "model/cuda_memory_model.hpp"
 
 namespace ov {
 namespace nvidia_gpu {
 
-MemoryPool::MemoryPool(const size_t num, std::shared_ptr<MemoryModel> memoryModel) {
+namespace {
+/** Blocks idle for longer than this are freed; override with the
+ * OPENVINO_NVIDIA_MEMORY_POOL_IDLE_SECONDS environment variable */
+constexpr std::chrono::seconds kDefaultIdleTimeout{30};
+/** Always keep at least this many blocks resident so the next request after an
+ * idle period doesn't pay the allocation latency */
+constexpr std::size_t kMinResidentBlocks = 1;
+
+std::chrono::seconds idleTimeoutFromEnv() {
+    if (const char* env = std::getenv("OPENVINO_NVIDIA_MEMORY_POOL_IDLE_SECONDS")) {
+        const auto seconds = std::atol(env);
+        if (seconds > 0) {
+            return std::chrono::seconds{seconds};
+        }
+    }
+    return kDefaultIdleTimeout;
+}
+}  // namespace
+
+MemoryPool::MemoryPool(const size_t num, std::shared_ptr<MemoryModel> memoryModel)
+    : memory_model_{std::move(memoryModel)}, idle_timeout_{idleTimeoutFromEnv()} {
     memory_blocks_.reserve(num);
     try {
         for (int i = 0; i < num; ++i) {
-            memory_blocks_.push_back(std::make_unique<DeviceMemBlock>(memoryModel));
+            memory_blocks_.push_back(IdleBlock{std::make_unique<DeviceMemBlock>(memory_model_), Clock::now()});
         }
     } catch (const std::exception& ex) {
         // TODO: Added log message when logging mechanism will be supported
@@ -27,38 +51,92 @@ MemoryPool::MemoryPool(const size_t num, std::shared_ptr<MemoryModel> memoryMode
             throw;
         }
     }
+    // What was allocatable now is the cap for later on-demand regrowth
+    capacity_ = memory_blocks_.size();
+    allocated_count_ = memory_blocks_.size();
 }
 
 void MemoryPool::Interrupt() { cond_var_.notify_all(); }
 
-MemoryPool::Proxy MemoryPool::WaitAndGet(CancellationToken& cancellationToken) {
+MemoryPool::Proxy MemoryPool::WaitAndGet(CancellationToken& cancellationToken, const RequestPriority& priority) {
     std::unique_lock<std::mutex> lock{mtx_};
-    cond_var_.wait(lock, [this, &cancellationToken] {
-        cancellationToken.Check();
-        return !memory_blocks_.empty();
-    });
-    Proxy memoryManagerProxy{shared_from_this(), move(memory_blocks_.back())};
+    if (memory_blocks_.empty() && allocated_count_ >= capacity_) {
+        // Every block is lent out and no spare capacity is left: this request
+        // is about to block on another request returning its block
+        utils::EventCounters::add(utils::EventCounters::instance().memory_pool_waits);
+    }
+    // Register in the priority-ordered waiter set; only the front waiter may
+    // take a block, so a freed block always goes to the most urgent request
+    const Waiter self{priority, waiter_seq_++};
+    waiters_.insert(self);
+    try {
+        cond_var_.wait(lock, [this, &cancellationToken, &self] {
+            cancellationToken.Check();
+            return (!memory_blocks_.empty() || allocated_count_ < capacity_) && waiters_.begin()->seq == self.seq;
+        });
+    } catch (...) {
+        waiters_.erase(self);
+        // Cancellation may have consumed the wakeup meant for the next waiter
+        cond_var_.notify_all();
+        throw;
+    }
+    waiters_.erase(self);
+    if (!waiters_.empty() && (memory_blocks_.size() > 1 || allocated_count_ + 1 < capacity_)) {
+        // More than the block this request takes is available: let the next
+        // waiter re-evaluate instead of sleeping until the next PushBack
+        cond_var_.notify_all();
+    }
+    if (memory_blocks_.empty()) {
+        // Every resident block is lent out, but idle reclamation left spare
+        // capacity: grow the pool back on demand
+        auto block = std::make_unique<DeviceMemBlock>(memory_model_);
+        ++allocated_count_;
+        return Proxy{shared_from_this(), std::move(block)};
+    }
+    // LIFO reuse keeps recently used blocks warm while the front of the list
+    // accumulates idle time until FreeExpiredBlocks() reclaims it
+    Proxy memoryManagerProxy{shared_from_this(), move(memory_blocks_.back().block)};
     memory_blocks_.pop_back();
     return memoryManagerProxy;
 }
 
-size_t MemoryPool::Size() const { return memory_blocks_.size(); }
+size_t MemoryPool::Size() const { return capacity_; }
 
 void MemoryPool::Resize(size_t count) {
-    const auto memoryManagersCount = memory_blocks_.size();
-    if (count > memoryManagersCount) {
-        throwIEException(
-            fmt::format("Cannot resize MemoryPool with {} value > than it was {}", count, memoryManagersCount));
+    std::lock_guard<std::mutex> lock{mtx_};
+    if (count > capacity_) {
+        throwIEException(fmt::format("Cannot resize MemoryPool with {} value > than it was {}", count, capacity_));
+    }
+    while (allocated_count_ > count && !memory_blocks_.empty()) {
+        memory_blocks_.pop_back();
+        --allocated_count_;
+    }
+    capacity_ = count;
+}
+
+void MemoryPool::SetIdleTimeout(std::chrono::seconds timeout) {
+    std::lock_guard<std::mutex> lock{mtx_};
+    idle_timeout_ = timeout;
+}
+
+void MemoryPool::FreeExpiredBlocks() {
+    const auto now = Clock::now();
+    while (memory_blocks_.size() > kMinResidentBlocks && allocated_count_ > kMinResidentBlocks &&
+           now - memory_blocks_.front().idle_since > idle_timeout_) {
+        memory_blocks_.erase(memory_blocks_.begin());
+        --allocated_count_;
     }
-    memory_blocks_.resize(count);
 }
 
 void MemoryPool::PushBack(std::unique_ptr<DeviceMemBlock> memManager) {
     {
         std::lock_guard<std::mutex> lock{mtx_};
-        memory_blocks_.push_back(std::move(memManager));
+        FreeExpiredBlocks();
+        memory_blocks_.push_back(IdleBlock{std::move(memManager), Clock::now()});
     }
-    cond_var_.notify_one();
+    // All waiters re-check and only the priority-ordered front proceeds, so a
+    // single notify could wake the wrong one and stall the freed block
+    cond_var_.notify_all();
 }
 
 }  // namespace nvidia_gpu
@@ -5,8 +5,12 @@
 #pragma once
 
 #include <cancellation_token.hpp>
+#include <chrono>
 #include <condition_variable>
+#include <cstdint>
+#include <cuda_request_priority.hpp>
 #include <mutex>
+#include <set>
 
 #include "memory_manager/cuda_memory_manager.hpp"
 #include "memory_manager/model/cuda_memory_model.hpp"
@@ -20,7 +24,12 @@ namespace nvidia_gpu {
  * @brief MemoryPool provides currently available DeviceMemBlock.
  *
  * This class is an owner of bunch of DeviceMemBlock-s and provides on request
- * WaitAndGet currently available DeviceMemBlock from pool
+ * WaitAndGet currently available DeviceMemBlock from pool.
+ *
+ * The pool is elastic: blocks that stay idle longer than the configured
+ * hysteresis period are released back to the driver (down to a small resident
+ * minimum) and re-allocated on demand when concurrency grows again, so device
+ * memory footprint follows the actual load instead of the worst case.
  */
 class MemoryPool : public std::enable_shared_from_this<MemoryPool> {
 public:
@@ -77,26 +86,69 @@ public:
      */
     void Interrupt();
     /**
-     * Wait and return Proxy object
+     * Wait and return Proxy object. When several requests wait for a block the
+     * highest @p priority is served first (equal levels earliest-deadline-first,
+     * ties in submission order), so interactive traffic is not starved behind a
+     * burst of batch requests sharing the ExecutableNetwork.
      * @return Proxy object through which we can access DeviceMemBlock
      */
-    Proxy WaitAndGet(CancellationToken& cancellationToken);
+    Proxy WaitAndGet(CancellationToken& cancellationToken, const RequestPriority& priority = {});
 
     size_t Size() const;
     void Resize(size_t count);
 
+    /**
+     * Sets how long a returned DeviceMemBlock may stay idle before its device
+     * memory is released. Released blocks are re-allocated on demand in
+     * WaitAndGet() up to the pool capacity.
+     */
+    void SetIdleTimeout(std::chrono::seconds timeout);
+
 private:
     friend class ::MemoryPoolTest;
 
+    using Clock = std::chrono::steady_clock;
+
+    /**
+     * A currently unused DeviceMemBlock together with the moment it was
+     * returned to the pool; used to apply the idle hysteresis
+     */
+    struct IdleBlock {
+        std::unique_ptr<DeviceMemBlock> block;
+        Clock::time_point idle_since;
+    };
+
+    /**
+     * One request blocked in WaitAndGet(); the set orders waiters by their
+     * scheduling priority so PushBack() hands the freed block to the most
+     * urgent one
+     */
+    struct Waiter {
+        RequestPriority priority;
+        std::uint64_t seq;
+        bool operator<(const Waiter& other) const { return priority.precedes(seq, other.priority, other.seq); }
+    };
+
     /**
      * Move DeviceMemBlock back to pool
      * @param memManager DeviceMemBlock
      */
     void PushBack(std::unique_ptr<DeviceMemBlock> memManager);
+    /**
+     * Frees blocks that exceeded the idle timeout, keeping the resident
+     * minimum. Requires @mtx_ to be held
+     */
+    void FreeExpiredBlocks();
 
+    std::shared_ptr<MemoryModel> memory_model_;
     std::mutex mtx_;
     std::condition_variable cond_var_;
-    std::vector<std::unique_ptr<DeviceMemBlock>> memory_blocks_;
+    std::vector<IdleBlock> memory_blocks_;
+    std::set<Waiter> waiters_;
+    std::uint64_t waiter_seq_ = 0;
+    std::size_t capacity_ = 0;
+    std::size_t allocated_count_ = 0;
+    std::chrono::seconds idle_timeout_;
 };
 
 }  // namespace nvidia_gpu
@@ -20,6 +20,13 @@ void ImmutableMemoryModelBuilder::addAllocation(BufferID id, size_t bsize) {
     end_offset_ += applyAllignment(bsize);
 }
 
+void ImmutableMemoryModelBuilder::shareAllocation(BufferID id, BufferID peer_id) {
+    auto peer = offsets_.find(peer_id);
+    IE_ASSERT(peer != offsets_.end());  // Verify that the shared allocation exists.
+    auto res = offsets_.emplace(id, peer->second);
+    IE_ASSERT(res.second);  // Verify that "id" is unique.
+}
+
 size_t ImmutableMemoryModelBuilder::deviceMemoryBlockSize() const { return end_offset_; }
 
 MemoryModel::Ptr ImmutableMemoryModelBuilder::build() const {
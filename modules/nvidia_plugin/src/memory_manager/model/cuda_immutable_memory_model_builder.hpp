@@ -28,6 +28,17 @@ public:
      */
     void addAllocation(BufferID id, size_t bsize);
 
+    /**
+     * Maps a tensor to the allocation of another, byte-identical tensor.
+     * Both identifiers resolve to the same offset in the memory block, so
+     * the data is stored on the device only once.
+     * @param [in] id Buffer identifier to add.
+     * @param [in] peer_id Identifier of an already added allocation to share.
+     * @throws InferenceEngineException if "peer_id" is unknown or "id" is
+     * already added.
+     */
+    void shareAllocation(BufferID id, BufferID peer_id);
+
     /**
      * @returns The size of memory block
      */
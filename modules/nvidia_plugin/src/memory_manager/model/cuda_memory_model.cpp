@@ -16,8 +16,23 @@ MemoryModel::MemoryModel(size_t bsize, const std::unordered_map<BufferID, ptrdif
     std::sort(buffer_ids_.begin(), buffer_ids_.end());
 }
 
+MemoryModel::MemoryModel(size_t bsize,
+                         const std::unordered_map<BufferID, ptrdiff_t>& offsets,
+                         size_t host_bsize,
+                         const std::unordered_map<BufferID, ptrdiff_t>& host_offsets)
+    : MemoryModel(bsize, offsets) {
+    host_bsize_ = host_bsize;
+    host_offsets_ = host_offsets;
+    std::transform(host_offsets.begin(), host_offsets.end(), std::back_inserter(buffer_ids_), [](const auto& b) {
+        return b.first;
+    });
+    std::sort(buffer_ids_.begin(), buffer_ids_.end());
+}
+
 size_t MemoryModel::deviceMemoryBlockSize() const { return bsize_; }
 
+size_t MemoryModel::hostMemoryBlockSize() const { return host_bsize_; }
+
 void* MemoryModel::deviceBufferPtr(CUDA::DevicePointer<uint8_t*> devPtr, const BufferID& id) {
     if (ptrdiff_t offset = 0; offsetForBuffer(id, offset)) return devPtr.get() + offset;
     return nullptr;
@@ -37,5 +52,12 @@ bool MemoryModel::offsetForBuffer(BufferID id, ptrdiff_t& offset) const {
     return true;
 }
 
+bool MemoryModel::offsetForHostBuffer(BufferID id, ptrdiff_t& offset) const {
+    auto it = host_offsets_.find(id);
+    if (it == host_offsets_.end()) return false;
+    offset = it->second;
+    return true;
+}
+
 }  // namespace nvidia_gpu
 }  // namespace ov
@@ -27,11 +27,30 @@ public:
      */
     MemoryModel(size_t bsize, const std::unordered_map<BufferID, ptrdiff_t>& offsets);
 
+    /**
+     * Model with an additional pinned-host section holding the tensors the
+     * ResidencyAdvisor spilled because the device section alone would not fit
+     * device memory.
+     * @param [in] host_bsize Pinned host section size in bytes.
+     * @param [in] host_offsets Maps spilled buffer identifiers to offsets
+     * within the host section.
+     */
+    MemoryModel(size_t bsize,
+                const std::unordered_map<BufferID, ptrdiff_t>& offsets,
+                size_t host_bsize,
+                const std::unordered_map<BufferID, ptrdiff_t>& host_offsets);
+
     /**
      * @returns The size of memory block
      */
     size_t deviceMemoryBlockSize() const;
 
+    /**
+     * @returns The size of the pinned-host spill section; 0 when every tensor
+     * is device resident
+     */
+    size_t hostMemoryBlockSize() const;
+
     void* deviceBufferPtr(CUDA::DevicePointer<uint8_t*> devPtr, const BufferID& id);
     void* deviceTensorPtr(CUDA::DevicePointer<uint8_t*> devPtr, const TensorID& id);
 
@@ -44,12 +63,23 @@ public:
      */
     bool offsetForBuffer(BufferID id, ptrdiff_t& offset) const;
 
+    /**
+     * Provides the offset of a spilled buffer inside the pinned-host section.
+     *
+     * @param [in] id Buffer identifier.
+     * @param [out] offset Offset with respect to the beginning of the host section.
+     * @returns false if the buffer is not host resident.
+     */
+    bool offsetForHostBuffer(BufferID id, ptrdiff_t& offset) const;
+
     const std::vector<BufferID>& bufferIds() const { return buffer_ids_; }
 
 private:
     size_t bsize_;
+    size_t host_bsize_ = 0;
     std::vector<BufferID> buffer_ids_;
     std::unordered_map<BufferID, ptrdiff_t> offsets_;
+    std::unordered_map<BufferID, ptrdiff_t> host_offsets_;
 };
 
 }  // namespace nvidia_gpu
@@ -6,6 +6,7 @@
 
 #include <details/ie_exception.hpp>
 
+#include "memory_manager/model/cuda_residency_advisor.hpp"
 #include "memory_manager/model/details/cuda_memory_utils.hpp"
 
 namespace ov {
@@ -27,5 +28,60 @@ MemoryModel::Ptr MemoryModelBuilder::build() {
     return std::make_shared<MemoryModel>(blob_size, offsets_);
 }
 
+MemoryModel::Ptr MemoryModelBuilder::build(size_t device_memory_budget) {
+    if (device_memory_budget == 0) {
+        return build();
+    }
+    {
+        MemorySolver solver{boxes_};
+        const size_t blob_size = solver.solve();
+        if (blob_size <= device_memory_budget) {
+            for (auto& pair : offsets_) pair.second = solver.getOffset(pair.first);
+            return std::make_shared<MemoryModel>(blob_size, offsets_);
+        }
+    }
+    // The advisor's estimate is conservative (removing a tensor shrinks the
+    // solved blob by at most its size), so grow the spill set and re-solve
+    // until the device section fits or no cold tensor is left
+    const ResidencyAdvisor advisor{boxes_};
+    std::unordered_set<BufferID> spills;
+    for (;;) {
+        std::vector<MemorySolver::Box> device_boxes;
+        std::vector<MemorySolver::Box> host_boxes;
+        for (const auto& box : boxes_) {
+            (spills.count(box.id) ? host_boxes : device_boxes).push_back(box);
+        }
+        MemorySolver device_solver{device_boxes};
+        const size_t device_blob_size = device_solver.solve();
+
+        bool progress = false;
+        if (device_blob_size > device_memory_budget) {
+            const auto more_spills = advisor.adviseSpills(device_blob_size, device_memory_budget, spills);
+            for (const auto id : more_spills) {
+                progress |= spills.insert(id).second;
+            }
+        }
+        if (progress) {
+            continue;
+        }
+        // Either the device section fits or only hot single-use activations
+        // remain over budget; return the best split found and let the block
+        // allocation decide
+        std::unordered_map<BufferID, ptrdiff_t> device_offsets;
+        for (const auto& box : device_boxes) {
+            device_offsets.emplace(box.id, device_solver.getOffset(box.id));
+        }
+        // The spilled tensors keep their lifetimes, so pinned host memory is
+        // reused across them the same way the device blob is
+        MemorySolver host_solver{host_boxes};
+        const size_t host_blob_size = host_boxes.empty() ? 0 : host_solver.solve();
+        std::unordered_map<BufferID, ptrdiff_t> host_offsets;
+        for (const auto& box : host_boxes) {
+            host_offsets.emplace(box.id, host_solver.getOffset(box.id));
+        }
+        return std::make_shared<MemoryModel>(device_blob_size, device_offsets, host_blob_size, host_offsets);
+    }
+}
+
 }  // namespace nvidia_gpu
 }  // namespace ov
@@ -36,6 +36,16 @@ public:
      */
     MemoryModel::Ptr build();
 
+    /**
+     * Like build(), but when the solved device blob exceeds
+     * @p device_memory_budget the ResidencyAdvisor moves cold tensors
+     * (long-idle skip connections rather than hot single-use activations) into
+     * a pinned-host spill section until the device section fits, so a model
+     * larger than device memory loads instead of failing. A budget of 0 keeps
+     * everything device resident.
+     */
+    MemoryModel::Ptr build(size_t device_memory_budget);
+
 private:
     std::vector<MemorySolver::Box> boxes_;
     std::unordered_map<BufferID, ptrdiff_t> offsets_;
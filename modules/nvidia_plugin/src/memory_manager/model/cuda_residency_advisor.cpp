@@ -0,0 +1,64 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "cuda_residency_advisor.hpp"
+
+#include <algorithm>
+
+namespace ov {
+namespace nvidia_gpu {
+
+namespace {
+/**
+ * A tensor consumed within this many execution steps of its producer is a hot
+ * single-use activation and never leaves the device: spilling it would put the
+ * PCIe round trip straight on the critical path of adjacent kernels
+ */
+constexpr int kHotSpanSteps = 2;
+}  // namespace
+
+ResidencyAdvisor::ResidencyAdvisor(const std::vector<MemorySolver::Box>& boxes) {
+    int last_step = 0;
+    for (const auto& box : boxes) {
+        last_step = std::max(last_step, std::max(box.start, box.finish));
+    }
+    for (const auto& box : boxes) {
+        // finish == -1 keeps the tensor alive to the very end of execution
+        const int finish = box.finish < 0 ? last_step : box.finish;
+        const int idle_span = finish - box.start;
+        if (idle_span <= kHotSpanSteps) {
+            continue;
+        }
+        candidates_.push_back(Candidate{static_cast<BufferID>(box.id), static_cast<size_t>(box.size), idle_span});
+    }
+    // Coldest first: rank by the device byte-steps a tensor holds hostage, so
+    // large long-idle skip connections are spilled before anything touched often
+    std::sort(candidates_.begin(), candidates_.end(), [](const Candidate& a, const Candidate& b) {
+        return a.size * static_cast<size_t>(a.idle_span) > b.size * static_cast<size_t>(b.idle_span);
+    });
+}
+
+std::unordered_set<BufferID> ResidencyAdvisor::adviseSpills(size_t solved_blob_size,
+                                                            size_t device_memory_budget,
+                                                            const std::unordered_set<BufferID>& already_spilled) const {
+    std::unordered_set<BufferID> spills;
+    if (solved_blob_size <= device_memory_budget) {
+        return spills;
+    }
+    size_t excess = solved_blob_size - device_memory_budget;
+    for (const auto& candidate : candidates_) {
+        if (already_spilled.count(candidate.id)) {
+            continue;
+        }
+        spills.insert(candidate.id);
+        if (candidate.size >= excess) {
+            break;
+        }
+        excess -= candidate.size;
+    }
+    return spills;
+}
+
+}  // namespace nvidia_gpu
+}  // namespace ov
@@ -0,0 +1,61 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <unordered_set>
+#include <vector>
+
+#include "memory_manager/model/cuda_memory_model.hpp"
+#include "memory_manager/model/details/cuda_memory_solver.hpp"
+
+namespace ov {
+namespace nvidia_gpu {
+
+/**
+ * @brief Advises which mutable tensors to spill to pinned host memory when the
+ * device blob does not fit the available device memory.
+ *
+ * The advisor classifies tensors by their access pattern, taken from the
+ * OperationBuffersExtractor lifetimes the MemoryModelBuilder already collects:
+ * a single-use activation is produced and consumed by adjacent execution steps
+ * and stays hot, while a skip connection or a tensor re-read much later sits
+ * idle for most of its lifespan. Cold tensors are ranked by the device bytes
+ * they hold hostage (size times idle span) and spilled coldest-first until the
+ * blob is expected to fit, so the PCIe-speed accesses land on the tensors
+ * touched least often per inference.
+ */
+class ResidencyAdvisor {
+public:
+    /**
+     * @param boxes The allocation boxes the MemoryModelBuilder feeds to the
+     * MemorySolver; box.id is the BufferID, start/finish the lifespan.
+     */
+    explicit ResidencyAdvisor(const std::vector<MemorySolver::Box>& boxes);
+
+    /**
+     * Selects buffers to move off the device so a blob of @p solved_blob_size
+     * is expected to fit @p device_memory_budget. The estimate is conservative
+     * (removing a box shrinks the solved blob by at most its size), so the
+     * caller re-solves and may ask again with the updated size; buffers in
+     * @p already_spilled are skipped on such follow-up rounds.
+     * @returns Additional buffer ids to host in pinned memory; empty if
+     * nothing eligible is left
+     */
+    std::unordered_set<BufferID> adviseSpills(size_t solved_blob_size,
+                                              size_t device_memory_budget,
+                                              const std::unordered_set<BufferID>& already_spilled = {}) const;
+
+private:
+    struct Candidate {
+        BufferID id;
+        size_t size;
+        int idle_span;
+    };
+
+    std::vector<Candidate> candidates_;  // spill-eligible, coldest first
+};
+
+}  // namespace nvidia_gpu
+}  // namespace ov
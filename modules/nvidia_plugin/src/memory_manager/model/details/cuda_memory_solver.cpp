@@ -65,16 +65,33 @@ inline bool popupTogetherWith(MemorySolver::Box &box_new, const MemorySolver::Bo
 
 int64_t MemorySolver::solve() {
     maxTopDepth();  // at first make sure that we no need more for boxes sorted by box.start
-    std::vector<std::vector<const Box *>> time_slots(_time_duration);
-    for (auto &slot : time_slots) slot.reserve(_top_depth);  // 2D array [_time_duration][_top_depth]
+
+    // The greedy placement is order sensitive: size-first packs models dominated by a few
+    // big activations best, while the chronological order of the constructor often wins
+    // when many same-sized buffers (activations plus workbuffers of the same layers)
+    // alternate. Both orders are cheap to try, so keep whichever packs tighter.
+    std::map<int64_t, int64_t> chronological_offsets;
+    std::vector<Box> chronological_boxes{_boxes};
+    const int64_t chronological_size = placeBoxes(chronological_boxes, chronological_offsets);
 
     // Sort be box size. First is biggest
-    // Comment this line to check other order of box putting
     std::sort(_boxes.begin(), _boxes.end(), [](const Box &l, const Box &r) { return l.size > r.size; });
+    const int64_t size_first_size = placeBoxes(_boxes, _offsets);
+
+    if (chronological_size < size_first_size) {
+        _offsets = std::move(chronological_offsets);
+        return chronological_size;
+    }
+    return size_first_size;
+}
+
+int64_t MemorySolver::placeBoxes(std::vector<Box> &boxes, std::map<int64_t, int64_t> &offsets) const {
+    std::vector<std::vector<const Box *>> time_slots(_time_duration);
+    for (auto &slot : time_slots) slot.reserve(_top_depth);  // 2D array [_time_duration][_top_depth]
 
     int64_t _min_required = 0;
 
-    for (Box &box : _boxes) {
+    for (Box &box : boxes) {
         // start from bottom and will lift it up if intersect with other present
         int64_t id = box.id;
         box.id = 0;  // id will be used as a temp offset storage
@@ -95,7 +112,7 @@ int64_t MemorySolver::solve() {
 
         // store the max top bound for each box
         _min_required = std::max(_min_required, box.id + box.size);
-        _offsets[id] = box.id;  // TODO: move to constructor (use .insert instead of [])
+        offsets[id] = box.id;  // TODO: move to constructor (use .insert instead of [])
     }
 
     return _min_required;
@@ -90,6 +90,12 @@ private:
     int _time_duration = -1;
 
     void calcDepth();
+    /**
+     * Greedily places @p boxes in the given order, writing the offset of every box
+     * into @p offsets, and returns the resulting blob size. Boxes are placed at the
+     * lowest offset not intersecting an already placed box alive at the same time.
+     */
+    int64_t placeBoxes(std::vector<Box>& boxes, std::map<int64_t, int64_t>& offsets) const;
 };
 
 }  // namespace nvidia_gpu
@@ -4,19 +4,69 @@
 
 #include "avgpool.hpp"
 
+#include <algorithm>
 #include <cuda_operation_registry.hpp>
 #include <gsl/gsl_assert>
 #include <openvino/op/avg_pool.hpp>
 
+#include "converters.hpp"
+
 namespace ov {
 namespace nvidia_gpu {
 
+namespace {
+
+/** The window covers the whole 2D spatial plane with no padding: the cuDNN
+ * window walker degenerates to a plain reduction the native kernel does at
+ * memory speed */
+bool isGlobalAvgPool(const ov::op::v1::AvgPool& node) {
+    const auto& input_shape = node.get_input_shape(0);
+    const auto& kernel = node.get_kernel();
+    if (input_shape.size() != 4 || kernel.size() != 2) {
+        return false;
+    }
+    if (kernel[0] != input_shape[2] || kernel[1] != input_shape[3]) {
+        return false;
+    }
+    const auto zero_pads = [](const ov::Shape& pads) {
+        return std::all_of(pads.begin(), pads.end(), [](size_t p) { return p == 0; });
+    };
+    if (!zero_pads(node.get_pads_begin()) || !zero_pads(node.get_pads_end())) {
+        return false;
+    }
+    switch (static_cast<ov::element::Type_t>(node.get_element_type())) {
+        case ov::element::Type_t::f16:
+        case ov::element::Type_t::f32:
+        case ov::element::Type_t::f64:
+            return true;
+        default:
+            return false;
+    }
+}
+
+}  // namespace
+
 AvgPoolOp::AvgPoolOp(const CreationContext& context,
                      const std::shared_ptr<ov::Node>& node,
                      IndexCollection&& inputIds,
                      IndexCollection&& outputIds)
-    : OperationCuDnn(context, node, std::move(inputIds), std::move(outputIds)),
-      impl_{dynamic_cast<const ov::op::v1::AvgPool&>(*node)} {}
+    : OperationCuDnn(context, node, std::move(inputIds), std::move(outputIds)) {
+    const auto& avg_pool = dynamic_cast<const ov::op::v1::AvgPool&>(*node);
+    if (isGlobalAvgPool(avg_pool)) {
+        const auto& input_shape = avg_pool.get_input_shape(0);
+        const size_t num_planes = input_shape[0] * input_shape[1];
+        const size_t plane_size = input_shape[2] * input_shape[3];
+        const auto max_block_size = static_cast<size_t>(context.device().props().maxThreadsPerBlock);
+        // Full warps only: the shuffle reduction synchronizes all 32 lanes
+        const size_t threads_per_block = std::min(max_block_size, (plane_size + 31) / 32 * 32);
+        global_avg_kernel_ = kernel::GlobalAvgPool{convertDataType<kernel::Type_t>(avg_pool.get_element_type()),
+                                                   num_planes,
+                                                   plane_size,
+                                                   threads_per_block};
+    } else {
+        impl_.emplace(avg_pool);
+    }
+}
 
 void AvgPoolOp::Execute(const InferenceRequestContext& context,
                         Inputs inputs,
@@ -25,9 +75,15 @@ void AvgPoolOp::Execute(const InferenceRequestContext& context,
     Expects(inputs.size() == 1);
     Expects(outputs.size() == 1);
 
-    impl_.Execute(context.getThreadContext().dnnHandle(),
-                  inputs[PoolingImpl::input_index].get(),
-                  outputs[PoolingImpl::output_index].get());
+    if (global_avg_kernel_) {
+        (*global_avg_kernel_)(context.getThreadContext().stream().get(),
+                              inputs[PoolingImpl::input_index].get(),
+                              outputs[PoolingImpl::output_index].get());
+        return;
+    }
+    impl_->Execute(context.getThreadContext().dnnHandle(),
+                   inputs[PoolingImpl::input_index].get(),
+                   outputs[PoolingImpl::output_index].get());
 }
 
 OPERATION_REGISTER(AvgPoolOp, AvgPool);
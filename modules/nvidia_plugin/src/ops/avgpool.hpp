@@ -5,7 +5,9 @@
 #pragma once
 
 #include <cuda_operation_base.hpp>
+#include <optional>
 
+#include "kernels/pooling.hpp"
 #include "pooling_impl.hpp"
 
 namespace ov {
@@ -23,7 +25,10 @@ public:
                  const Workbuffers& workbuffers) const override;
 
 private:
-    PoolingImpl impl_;
+    // Native warp-reduction kernel selected by shape for the global-average
+    // case; every other shape keeps the cuDNN path
+    std::optional<kernel::GlobalAvgPool> global_avg_kernel_;
+    std::optional<PoolingImpl> impl_;
 };
 
 }  // namespace nvidia_gpu
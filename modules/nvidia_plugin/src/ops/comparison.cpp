@@ -8,6 +8,7 @@
 #include <ngraph/type/element_type.hpp>
 
 #include "converters.hpp"
+#include "packed_bool_mask.hpp"
 
 namespace ov {
 namespace nvidia_gpu {
@@ -75,13 +76,22 @@ Comparison::Comparison(const CreationContext& context,
 
     const auto num_blocks =
         (output_size % max_block_size == 0) ? (output_size / max_block_size) : (output_size / max_block_size + 1);
-    const auto threads_per_block = (num_blocks == 1) ? output_size : max_block_size;
+    auto threads_per_block = (num_blocks == 1) ? output_size : max_block_size;
+
+    // When every consumer of the mask is a Select condition, write the packed
+    // bitmask form instead of one byte per element; the ballot in the packed
+    // kernel needs whole warps per block
+    const bool packed_output = packedBoolMaskAgreed(node);
+    if (packed_output) {
+        threads_per_block = (threads_per_block + 31) / 32 * 32;
+    }
 
     kernel_ = kernel::Comparison{operation_type,
                                  convertDataType<ov::nvidia_gpu::kernel::Type_t>(element_type),
                                  output_size,
                                  num_blocks,
-                                 threads_per_block};
+                                 threads_per_block,
+                                 packed_output};
 }
 
 void Comparison::Execute(const InferenceRequestContext& context,
@@ -8,6 +8,7 @@
 
 #include <cuda_operation_registry.hpp>
 #include <gsl/gsl_assert>
+#include <kernels/arch_dispatch.hpp>
 #include <utility>
 #include <vector>
 
@@ -55,7 +56,8 @@ ConcatOp::ConcatOp(const CreationContext& context,
     }
 
     const std::size_t allChunkSize = chunk_size * chunks.size();
-    const unsigned maxBlockSize = context.device().props().maxThreadsPerBlock;
+    const auto& device_props = context.device().props();
+    const unsigned maxBlockSize = device_props.maxThreadsPerBlock;
     const std::size_t numBlocks = (allChunkSize + maxBlockSize - 1) / maxBlockSize;
     const std::size_t threadsPerBlock = (numBlocks == 1) ? allChunkSize : maxBlockSize;
 
@@ -65,7 +67,8 @@ ConcatOp::ConcatOp(const CreationContext& context,
                                     chunk_size,
                                     allChunkSize,
                                     numBlocks,
-                                    threadsPerBlock};
+                                    threadsPerBlock,
+                                    kernel::computeCapability(device_props.major, device_props.minor)};
 }
 
 WorkbufferRequest ConcatOp::GetWorkBufferRequest() const { return {{immutableWbSize()}, {mutableWbSize()}}; }
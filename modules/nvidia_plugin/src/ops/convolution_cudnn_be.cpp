@@ -11,14 +11,49 @@
 #include <gsl/gsl_assert>
 #include <ops/converters.hpp>
 
+#include <sstream>
+
 #include "cuda/constant_factory.hpp"
 #include "cuda/dnn_be_algo.hpp"
+#include "cuda/dnn_be_algo_cache.hpp"
 
 namespace ov {
 namespace nvidia_gpu {
 
 constexpr int NON_SPATIAL_DIMS_NUMBER = 2;
 
+namespace {
+
+std::string makeBenchmarkCacheKey(const Convolution::Details::ConvolutionParams& params, const size_t workspace_limit) {
+    std::ostringstream key;
+    const auto appendShape = [&key](const auto& shape) {
+        key << '(';
+        for (const auto& dim : shape) {
+            key << dim << ',';
+        }
+        key << ')';
+    };
+    key << "ConvolutionCuDnnBE:t" << static_cast<int>(params.element_type_) << ":i";
+    appendShape(params.input_shape_);
+    key << ":f";
+    appendShape(params.filter_shape_);
+    key << ":o";
+    appendShape(params.output_shape_);
+    key << ":s";
+    appendShape(params.strides_);
+    key << ":d";
+    appendShape(params.dilations_);
+    key << ":pb";
+    appendShape(params.padding_before_);
+    key << ":pa";
+    appendShape(params.padding_after_);
+    key << ":g" << params.groups_;
+    key << ":w" << workspace_limit;
+    return CUDA::DnnBenchmarkCache::makeKey(key.str());
+}
+
+}  // namespace
+
 struct DnnTensorID {
     static constexpr int64_t input = 'x';
     static constexpr int64_t filter = 'w';
@@ -83,7 +118,22 @@ ConvolutionCuDnnBE::ConvolutionCuDnnBE(const CreationContext& context,
 
     std::shared_ptr<CUDA::DnnBEExecutionPlan> plan;
     if (context.opBenchOption()) {
-        plan = performBenchmarks(context.dnnHandle(), plans);
+        auto& algoCache = CUDA::DnnBenchmarkCache::instance();
+        std::string cacheKey;
+        std::optional<std::size_t> cached;
+        if (algoCache.enabled()) {
+            cacheKey = makeBenchmarkCacheKey(params_, context.dnnWorkspaceLimit());
+            cached = algoCache.find(cacheKey);
+        }
+        if (cached && *cached < plans.size()) {
+            plan = plans[*cached];
+        } else {
+            plan = performBenchmarks(context.dnnHandle(), plans, context.dnnWorkspaceLimit());
+            if (algoCache.enabled()) {
+                const auto found = std::find(plans.begin(), plans.end(), plan);
+                algoCache.store(cacheKey, static_cast<std::size_t>(std::distance(plans.begin(), found)));
+            }
+        }
     } else {
         plan = std::move(plans[0]);
     }
@@ -93,7 +143,9 @@ ConvolutionCuDnnBE::ConvolutionCuDnnBE(const CreationContext& context,
 }
 
 std::shared_ptr<CUDA::DnnBEExecutionPlan> ConvolutionCuDnnBE::performBenchmarks(
-    const CUDA::DnnHandle& dnnHandle, std::vector<std::shared_ptr<CUDA::DnnBEExecutionPlan>>& plans) {
+    const CUDA::DnnHandle& dnnHandle,
+    std::vector<std::shared_ptr<CUDA::DnnBEExecutionPlan>>& plans,
+    const size_t workspace_limit) {
     auto input = CUDA::DefaultStream::stream().malloc(ngraph::element::Type{params_.element_type_}.size() *
                                                       ngraph::shape_size(params_.input_shape_));
     auto filter = CUDA::DefaultStream::stream().malloc(ngraph::element::Type{params_.element_type_}.size() *
@@ -106,7 +158,7 @@ std::shared_ptr<CUDA::DnnBEExecutionPlan> ConvolutionCuDnnBE::performBenchmarks(
     variantPackBuilder.setTensorPointers(uids, data_ptrs);
 
     constexpr const size_t kNumBenchmarks = 100;
-    return CUDA::performBenchmarks<kNumBenchmarks>(dnnHandle, plans, variantPackBuilder);
+    return CUDA::performBenchmarks<kNumBenchmarks>(dnnHandle, plans, variantPackBuilder, workspace_limit);
 }
 
 WorkbufferRequest ConvolutionCuDnnBE::GetWorkBufferRequest() const {
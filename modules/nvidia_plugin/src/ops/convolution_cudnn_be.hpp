@@ -37,7 +37,9 @@ public:
 
 private:
     std::shared_ptr<CUDA::DnnBEExecutionPlan> performBenchmarks(
-        const CUDA::DnnHandle& dnnHandle, std::vector<std::shared_ptr<CUDA::DnnBEExecutionPlan>>& plans);
+        const CUDA::DnnHandle& dnnHandle,
+        std::vector<std::shared_ptr<CUDA::DnnBEExecutionPlan>>& plans,
+        size_t workspace_limit);
 
     static std::shared_ptr<CUDA::DnnBETensorDescriptor> MakeTensorDescriptor(int64_t id,
                                                                              cudnnDataType_t element_type,
@@ -5,6 +5,7 @@
 
 #include <fmt/ostream.h>
 
+#include <cuda/descriptor_utils.hpp>
 #include <cuda_operation_registry.hpp>
 #include <openvino/op/util/attr_types.hpp>
 
@@ -56,7 +57,8 @@ CUDA::DnnTensorDescriptor desc(const cudnnDataType_t type, ShapeArray& dims) {
     ShapeArray strides;
     strides.back() = 1;
     for (int i = dims.size() - 1; i > 0; i--) strides[i - 1] = strides[i] * dims[i];
-    return CUDA::DnnTensorDescriptor{}.set(type, static_cast<int>(dims.size()), dims.data(), strides.data());
+    return CUDA::internDnnTensorDescr(
+        type, {dims.begin(), dims.end()}, {strides.begin(), strides.end()});
 }
 }  // namespace
 
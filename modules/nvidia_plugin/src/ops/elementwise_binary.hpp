@@ -66,11 +66,13 @@ public:
 
     WorkbufferRequest GetWorkBufferRequest() const override { return {immutable_buffer_sizes_, {}}; }
 
-private:
+protected:
     std::vector<WorkbufferRequest::size_in_bytes_t> immutable_buffer_sizes_;
     std::unique_ptr<NumpyBroadcastParams> in0_broadcast_params_;
     std::unique_ptr<NumpyBroadcastParams> in1_broadcast_params_;
 
+    // Protected so derived operations can re-create the kernel with extra,
+    // operation-specific construction arguments
     std::optional<Kernel> kernel_;
 };
 
@@ -6,8 +6,10 @@
 
 #include <fenv.h>
 
+#include <cuda/runtime.hpp>
 #include <cuda_operation_registry.hpp>
 #include <ngraph/node.hpp>
+#include <openvino/op/constant.hpp>
 
 #include "converters.hpp"
 
@@ -16,6 +18,23 @@ namespace nvidia_gpu {
 
 enum InputIdx { ARG, INPUT_LOW, INPUT_HIGH, OUTPUT_LOW, OUTPUT_HIGH };
 
+namespace {
+
+// A 256-entry table covers the common u8-range quantization and still fits
+// comfortably into the read-only cache alongside the per-channel scales
+constexpr std::size_t kMaxLutLevels = 256;
+
+float rangeValueAt(const std::vector<float>& values, std::size_t channel) {
+    return values.size() == 1 ? values[0] : values[channel];
+}
+
+template <typename T>
+void uploadDataToWorkbuffer(CUDA::DevicePointer<void*> buffer, const std::vector<T>& v) {
+    CUDA::DefaultStream::stream().upload(buffer, v.data(), sizeof(T) * v.size());
+}
+
+}  // namespace
+
 FakeQuantizeOp::FakeQuantizeOp(const CreationContext &context,
                                const NodeOp &node,
                                IndexCollection &&inputIds,
@@ -34,25 +53,112 @@ FakeQuantizeOp::FakeQuantizeOp(const CreationContext &context,
     Expects(levels > 1U);
     Expects(node.get_input_shape(0).size() == node.get_output_shape(0).size());
 
+    const size_t output_size = ngraph::shape_size(node.get_output_shape(0));
+    const auto max_threads_per_block = static_cast<unsigned>(context.device().props().maxThreadsPerBlock);
+    const auto kernel_element_type = convertDataType<ov::nvidia_gpu::kernel::Type_t>(element_type);
+
+    if (tryInitLutPath(node, kernel_element_type, output_size, max_threads_per_block, levels)) {
+        return;
+    }
+
     in_low_broadcast_params_->addWorkbufferRequests(immutable_buffer_sizes_);
     in_high_broadcast_params_->addWorkbufferRequests(immutable_buffer_sizes_);
     out_low_broadcast_params_->addWorkbufferRequests(immutable_buffer_sizes_);
     out_high_broadcast_params_->addWorkbufferRequests(immutable_buffer_sizes_);
 
-    const size_t output_size = ngraph::shape_size(node.get_output_shape(0));
-    const auto max_threads_per_block = static_cast<unsigned>(context.device().props().maxThreadsPerBlock);
+    kernel_ = kernel::FakeQuantize{kernel_element_type, output_size, max_threads_per_block, levels};
+}
 
-    kernel_ = kernel::FakeQuantize{
-        convertDataType<ov::nvidia_gpu::kernel::Type_t>(element_type), output_size, max_threads_per_block, levels};
+bool FakeQuantizeOp::tryInitLutPath(const NodeOp &node,
+                                    kernel::Type_t element_type,
+                                    std::size_t output_size,
+                                    std::size_t max_threads_per_block,
+                                    std::size_t levels) {
+    if (levels > kMaxLutLevels) {
+        return false;
+    }
+    switch (element_type) {
+        case kernel::Type_t::f16:
+        case kernel::Type_t::bf16:
+        case kernel::Type_t::f32:
+            break;
+        default:
+            // The double-precision path keeps the exact arithmetic formula
+            return false;
+    }
+
+    std::vector<float> ranges[4];
+    ngraph::Shape channel_shape{};
+    for (std::size_t i = INPUT_LOW; i <= OUTPUT_HIGH; ++i) {
+        const auto *constant = dynamic_cast<const ov::op::v0::Constant *>(node.get_input_node_ptr(i));
+        if (!constant) {
+            return false;
+        }
+        const auto &shape = node.get_input_shape(i);
+        if (ngraph::shape_size(shape) > 1) {
+            if (ngraph::shape_size(channel_shape) > 1 && shape != channel_shape) {
+                return false;
+            }
+            channel_shape = shape;
+        }
+        ranges[i - INPUT_LOW] = constant->cast_vector<float>();
+    }
+
+    const auto &in_low = ranges[0];
+    const auto &in_high = ranges[1];
+    const auto &out_low = ranges[2];
+    const auto &out_high = ranges[3];
+
+    const std::size_t num_channels = ngraph::shape_size(channel_shape);
+    const float levels_1 = static_cast<float>(levels - 1);
+
+    in_low_host_.reserve(num_channels);
+    in_scale_host_.reserve(num_channels);
+    lut_host_.reserve(num_channels * levels);
+    for (std::size_t channel = 0; channel < num_channels; ++channel) {
+        const float il = rangeValueAt(in_low, channel);
+        const float ih = rangeValueAt(in_high, channel);
+        if (!(il < ih)) {
+            return false;
+        }
+        const float ol = rangeValueAt(out_low, channel);
+        const float oh = rangeValueAt(out_high, channel);
+        in_low_host_.push_back(il);
+        in_scale_host_.push_back(levels_1 / (ih - il));
+        for (std::size_t level = 0; level < levels; ++level) {
+            lut_host_.push_back(static_cast<float>(level) / levels_1 * (oh - ol) + ol);
+        }
+    }
+
+    channel_broadcast_params_ = NumpyBroadcastParams::create(channel_shape, node.get_output_shape(0));
+    channel_broadcast_params_->addWorkbufferRequests(immutable_buffer_sizes_);
+    ib_lut_.addRequest(immutable_buffer_sizes_, sizeof(float) * lut_host_.size());
+    ib_in_low_.addRequest(immutable_buffer_sizes_, sizeof(float) * in_low_host_.size());
+    ib_in_scale_.addRequest(immutable_buffer_sizes_, sizeof(float) * in_scale_host_.size());
+
+    lut_kernel_ = kernel::FakeQuantizeLut{element_type, output_size, max_threads_per_block, levels};
+    return true;
 }
 
 void FakeQuantizeOp::Execute(const InferenceRequestContext &context,
                              Inputs inputTensors,
                              Outputs outputTensors,
                              const Workbuffers &workbuffers) const {
-    Expects(kernel_);
     auto &stream = context.getThreadContext().stream();
 
+    if (lut_kernel_) {
+        (*lut_kernel_)(stream.get(),
+                       inputTensors[ARG].get(),
+                       ib_lut_.requiredPtr(workbuffers.immutable_buffers),
+                       ib_in_low_.requiredPtr(workbuffers.immutable_buffers),
+                       ib_in_scale_.requiredPtr(workbuffers.immutable_buffers),
+                       channel_broadcast_params_->mapper(workbuffers.immutable_buffers),
+                       outputTensors[0].get());
+        return;
+    }
+
+    Expects(kernel_);
+
     (*kernel_)(stream.get(),
                inputTensors[ARG].get(),
                inputTensors[INPUT_LOW].get(),
@@ -67,6 +173,14 @@ void FakeQuantizeOp::Execute(const InferenceRequestContext &context,
 }
 
 void FakeQuantizeOp::InitSharedImmutableWorkbuffers(const Buffers &buffers) {
+    if (lut_kernel_) {
+        channel_broadcast_params_->initWorkbuffers(buffers);
+        uploadDataToWorkbuffer(CUDA::DevicePointer<void *>{ib_lut_.requiredPtr(buffers)}, lut_host_);
+        uploadDataToWorkbuffer(CUDA::DevicePointer<void *>{ib_in_low_.requiredPtr(buffers)}, in_low_host_);
+        uploadDataToWorkbuffer(CUDA::DevicePointer<void *>{ib_in_scale_.requiredPtr(buffers)}, in_scale_host_);
+        return;
+    }
+
     in_low_broadcast_params_->initWorkbuffers(buffers);
     in_high_broadcast_params_->initWorkbuffers(buffers);
     out_low_broadcast_params_->initWorkbuffers(buffers);
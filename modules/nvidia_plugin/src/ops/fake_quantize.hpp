@@ -30,6 +30,12 @@ private:
     void InitSharedImmutableWorkbuffers(const Buffers& buffers) override final;
     WorkbufferRequest GetWorkBufferRequest() const override final;
 
+    bool tryInitLutPath(const NodeOp& node,
+                        kernel::Type_t element_type,
+                        std::size_t output_size,
+                        std::size_t max_threads_per_block,
+                        std::size_t levels);
+
 private:
     std::unique_ptr<NumpyBroadcastParams> in_low_broadcast_params_;
     std::unique_ptr<NumpyBroadcastParams> in_high_broadcast_params_;
@@ -38,6 +44,18 @@ private:
 
     std::vector<WorkbufferRequest::size_in_bytes_t> immutable_buffer_sizes_;
     std::optional<kernel::FakeQuantize> kernel_;
+
+    // Table-driven path taken when all four range inputs are constants and the
+    // level count is small (see kernel::FakeQuantizeLut). The host-built
+    // tables are uploaded into immutable workbuffers at network load time.
+    std::unique_ptr<NumpyBroadcastParams> channel_broadcast_params_;
+    std::vector<float> lut_host_;
+    std::vector<float> in_low_host_;
+    std::vector<float> in_scale_host_;
+    WorkbufferDesc ib_lut_;
+    WorkbufferDesc ib_in_low_;
+    WorkbufferDesc ib_in_scale_;
+    std::optional<kernel::FakeQuantizeLut> lut_kernel_;
 };
 
 }  // namespace nvidia_gpu
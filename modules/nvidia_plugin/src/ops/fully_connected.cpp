@@ -45,6 +45,10 @@ void FullyConnectedOp::Execute(const InferenceRequestContext& context,
                                const Workbuffers& workbuffers) const {
     Expects(inputs.size() == 3);
     Expects(outputs.size() == 1);
+    if (matmul_op_.HasBiasEpilogue()) {
+        matmul_op_.ExecuteWithBias(context, inputs, outputs, workbuffers);
+        return;
+    }
     auto& stream = context.getThreadContext().stream();
 
     auto bias = inputs[2];
@@ -26,6 +26,8 @@ public:
                  Outputs outputTensors,
                  const Workbuffers& workbuffers) const override;
 
+    WorkbufferRequest GetWorkBufferRequest() const override { return matmul_op_.GetWorkBufferRequest(); }
+
 private:
     MatMulOp matmul_op_;
     size_t bias_size_ = 0;
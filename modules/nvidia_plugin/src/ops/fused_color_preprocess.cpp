@@ -0,0 +1,83 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "fused_color_preprocess.hpp"
+
+#include <cuda_operation_registry.hpp>
+#include <gsl/gsl_assert>
+
+#include "converters.hpp"
+
+namespace ov {
+namespace nvidia_gpu {
+
+FusedColorPreprocessOp::FusedColorPreprocessOp(const CreationContext& context,
+                                               const NodeOp& node,
+                                               IndexCollection&& inputIds,
+                                               IndexCollection&& outputIds)
+    : OperationBase(context, node, std::move(inputIds), std::move(outputIds)) {
+    constexpr size_t N_DIM = 0;
+    constexpr size_t H_DIM = 1;
+    constexpr size_t W_DIM = 2;
+
+    const bool is_i420 = node.get_source_format() == NodeOp::SourceFormat::I420;
+    const bool single_plane = node.get_input_size() == 1;
+    Expects(node.get_input_size() == 1 || node.get_input_size() == (is_i420 ? 3u : 2u));
+    Expects(node.get_output_size() == 1);
+
+    const auto& in_tensor_shape = node.get_input_shape(0);
+    const size_t batch_size = in_tensor_shape[N_DIM];
+    const size_t image_w = in_tensor_shape[W_DIM];
+    // A fused single-plane input carries the chroma rows below the luma plane
+    const size_t image_h = single_plane ? in_tensor_shape[H_DIM] * 2 / 3 : in_tensor_shape[H_DIM];
+
+    kernel::FusedColorPreprocess::Params params{};
+    params.source_format = is_i420 ? kernel::FusedColorPreprocess::SourceFormat::I420
+                                   : kernel::FusedColorPreprocess::SourceFormat::NV12;
+    params.conversion = node.get_target_format() == NodeOp::TargetFormat::RGB ? kernel::ColorConversion::RGB
+                                                                              : kernel::ColorConversion::BGR;
+    params.batch_size = batch_size;
+    params.src_h = image_h;
+    params.src_w = image_w;
+    params.dst_h = node.get_out_h();
+    params.dst_w = node.get_out_w();
+    params.resize = params.dst_h != params.src_h || params.dst_w != params.src_w;
+    if (single_plane) {
+        params.stride_y = image_w * image_h * 3 / 2;
+        params.stride_uv = image_w * image_h * 3 / 2;
+    } else {
+        params.stride_y = image_w * image_h;
+        params.stride_uv = is_i420 ? image_w * image_h / 4 : image_w * image_h / 2;
+    }
+    std::copy(node.get_mean().begin(), node.get_mean().end(), params.mean);
+    std::copy(node.get_scale().begin(), node.get_scale().end(), params.scale);
+
+    const size_t max_threads_per_block = context.device().props().maxThreadsPerBlock;
+    kernel_ = kernel::FusedColorPreprocess{
+        convertDataType<ov::nvidia_gpu::kernel::Type_t>(node.get_input_element_type(0)),
+        convertDataType<ov::nvidia_gpu::kernel::Type_t>(node.get_output_element_type(0)),
+        params,
+        max_threads_per_block};
+}
+
+void FusedColorPreprocessOp::Execute(const InferenceRequestContext& context,
+                                     Inputs inputTensors,
+                                     Outputs outputTensors,
+                                     const Workbuffers& workbuffers) const {
+    Expects(kernel_);
+    Expects(inputTensors.size() >= 1 && inputTensors.size() <= 3);
+    Expects(outputTensors.size() == 1);
+    auto& stream = context.getThreadContext().stream();
+
+    (*kernel_)(stream.get(),
+               inputTensors[0].get(),
+               inputTensors.size() > 1 ? inputTensors[1].get() : nullptr,
+               inputTensors.size() > 2 ? inputTensors[2].get() : nullptr,
+               outputTensors[0].get());
+}
+
+OPERATION_REGISTER(FusedColorPreprocessOp, FusedColorPreprocess);
+
+}  // namespace nvidia_gpu
+}  // namespace ov
@@ -0,0 +1,33 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cuda_operation_base.hpp>
+#include <transformer/nodes/fused_color_preprocess.hpp>
+
+#include "kernels/fused_color_preprocess.hpp"
+
+namespace ov {
+namespace nvidia_gpu {
+
+class FusedColorPreprocessOp : public OperationBase {
+public:
+    using NodeOp = nodes::FusedColorPreprocess;
+    FusedColorPreprocessOp(const CreationContext& context,
+                           const NodeOp& node,
+                           IndexCollection&& inputIds,
+                           IndexCollection&& outputIds);
+
+    void Execute(const InferenceRequestContext& context,
+                 Inputs inputTensors,
+                 Outputs outputTensors,
+                 const Workbuffers& workbuffers) const override;
+
+private:
+    std::optional<kernel::FusedColorPreprocess> kernel_;
+};
+
+}  // namespace nvidia_gpu
+}  // namespace ov
@@ -0,0 +1,146 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "fused_compare_select.hpp"
+
+#include <cuda_operation_registry.hpp>
+#include <gsl/gsl_assert>
+#include <transformer/nodes/fused_compare_select.hpp>
+
+#include "converters.hpp"
+
+namespace ov {
+namespace nvidia_gpu {
+
+static constexpr auto OUTPUT = 0u;
+static constexpr auto kNumOfDim = 5u;
+static constexpr auto kOffsetBufferSize = kNumOfDim * sizeof(kernel::CompareSelect::BrcstOffsetType);
+
+namespace {
+
+void calcOutOffset(std::vector<size_t>& offset, const std::vector<size_t>& dims) {
+    offset.resize(kNumOfDim);
+    size_t k = 1;
+    auto i = dims.size();
+    while (i >= 1) {
+        auto j = i - 1;
+        offset[j] = k;
+        k *= dims[j];
+        --i;
+    }
+}
+
+void calcInOffset(std::vector<size_t>& offset, const std::vector<size_t>& inDims, const std::vector<size_t>& outDims) {
+    offset.resize(kNumOfDim);
+    size_t k = 1;
+    auto i = inDims.size();
+    while (i >= 1) {
+        auto j = i - 1;
+        offset[j] = (inDims[j] == outDims[j]) ? k : 0;
+        k *= inDims[j];
+        --i;
+    }
+}
+
+kernel::CompareSelect::Op_t convertCompareKind(nodes::CompareKind kind) {
+    switch (kind) {
+        case nodes::CompareKind::Greater:
+            return kernel::CompareSelect::Op_t::GREATER;
+        case nodes::CompareKind::Less:
+            return kernel::CompareSelect::Op_t::LESS;
+        default:
+            throwIEException("Unsupported comparison kind in FusedCompareSelect node");
+    }
+}
+
+}  // namespace
+
+FusedCompareSelectOp::FusedCompareSelectOp(const CreationContext& context,
+                                           const ov::Node& node,
+                                           IndexCollection&& inputIds,
+                                           IndexCollection&& outputIds)
+    : OperationBase(context, node, std::move(inputIds), std::move(outputIds)),
+      output_shape_{node.get_output_shape(OUTPUT)},
+      max_size_{ov::shape_size(output_shape_)} {
+    const auto& fused = dynamic_cast<const nodes::FusedCompareSelect&>(node);
+    Expects(node.get_input_size() == 4);
+    // The fusion pass guarantees the comparison operands share the element type
+    // of the selected values, so one type parameterizes the whole kernel
+    Expects(node.get_input_element_type(LEFT) == node.get_output_element_type(OUTPUT));
+
+    for (auto i = 0u; i < node.get_input_size(); ++i) {
+        input_shapes_.push_back(node.get_input_shape(i));
+    }
+    calculateOffsets();
+
+    Expects(output_offset_[0] > 0);
+    for (size_t idx = 0; idx < output_offset_.size(); ++idx) {
+        output_sizes_.push_back(output_offset_[idx] > 0 ? output_offset_[idx] : output_offset_[idx - 1]);
+    }
+
+    const auto max_block_size = static_cast<unsigned>(context.device().props().maxThreadsPerBlock);
+    const auto num_blocks = 1 + max_size_ / max_block_size;
+    const auto threads_per_block = (num_blocks == 1) ? max_size_ : max_block_size;
+
+    kernel_ = kernel::CompareSelect{convertCompareKind(fused.get_compare_kind()),
+                                    convertDataType<kernel::Type_t>(node.get_output_element_type(OUTPUT)),
+                                    max_size_,
+                                    num_blocks,
+                                    threads_per_block};
+}
+
+void FusedCompareSelectOp::Execute(const InferenceRequestContext& context,
+                                   Inputs inputs,
+                                   Outputs outputs,
+                                   const Workbuffers& workbuffers) const {
+    Expects(kernel_);
+    Expects(inputs.size() == 4);
+    Expects(outputs.size() == 1);
+    (*kernel_)(
+        context.getThreadContext().stream().get(),
+        inputs[LEFT].get(),
+        inputs[RIGHT].get(),
+        inputs[THEN].get(),
+        inputs[ELSE].get(),
+        static_cast<const kernel::CompareSelect::BrcstOffsetType*>(workbuffers.immutable_buffers[LEFT].get()),
+        static_cast<const kernel::CompareSelect::BrcstOffsetType*>(workbuffers.immutable_buffers[RIGHT].get()),
+        static_cast<const kernel::CompareSelect::BrcstOffsetType*>(workbuffers.immutable_buffers[THEN].get()),
+        static_cast<const kernel::CompareSelect::BrcstOffsetType*>(workbuffers.immutable_buffers[ELSE].get()),
+        static_cast<const kernel::CompareSelect::BrcstOffsetType*>(workbuffers.immutable_buffers[SIZES].get()),
+        outputs[OUTPUT].get());
+}
+
+WorkbufferRequest FusedCompareSelectOp::GetWorkBufferRequest() const {
+    return {std::vector<WorkbufferRequest::size_in_bytes_t>(SIZES + 1, kOffsetBufferSize), {}};
+}
+
+void FusedCompareSelectOp::InitSharedImmutableWorkbuffers(const Buffers& buffers) {
+    auto& stream = CUDA::DefaultStream::stream();
+    stream.upload(buffers[LEFT], input_offsets_[LEFT].data(), kOffsetBufferSize);
+    stream.upload(buffers[RIGHT], input_offsets_[RIGHT].data(), kOffsetBufferSize);
+    stream.upload(buffers[THEN], input_offsets_[THEN].data(), kOffsetBufferSize);
+    stream.upload(buffers[ELSE], input_offsets_[ELSE].data(), kOffsetBufferSize);
+    stream.upload(buffers[SIZES], output_sizes_.data(), kOffsetBufferSize);
+}
+
+void FusedCompareSelectOp::calculateOffsets() {
+    std::vector<size_t> result_dims(kNumOfDim, 1);
+    std::copy(std::begin(output_shape_),
+              std::end(output_shape_),
+              std::begin(result_dims) + (kNumOfDim - output_shape_.size()));
+    calcOutOffset(output_offset_, result_dims);
+    Expects(output_offset_.size() == kNumOfDim);
+
+    for (const auto& shape : input_shapes_) {
+        std::vector<size_t> result_shape(kNumOfDim, 1);
+        std::copy(std::begin(shape), std::end(shape), std::begin(result_shape) + (kNumOfDim - shape.size()));
+        calcInOffset(input_offsets_.emplace_back(), result_shape, result_dims);
+        Expects(input_offsets_.back().size() == kNumOfDim);
+    }
+}
+
+OPERATION_REGISTER(FusedCompareSelectOp, FusedCompareSelect);
+
+}  // namespace nvidia_gpu
+}  // namespace ov
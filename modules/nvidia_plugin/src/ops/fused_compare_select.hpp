@@ -0,0 +1,50 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cuda_operation_base.hpp>
+#include <optional>
+
+#include "kernels/compare_select.hpp"
+
+namespace ov {
+namespace nvidia_gpu {
+
+class FusedCompareSelectOp : public OperationBase {
+    enum InputIdx { LEFT, RIGHT, THEN, ELSE, SIZES };
+
+public:
+    FusedCompareSelectOp(const CreationContext& context,
+                         const ov::Node& node,
+                         IndexCollection&& inputIds,
+                         IndexCollection&& outputIds);
+
+    void Execute(const InferenceRequestContext& context,
+                 Inputs inputs,
+                 Outputs outputs,
+                 const Workbuffers& workbuffers) const override;
+
+    WorkbufferRequest GetWorkBufferRequest() const override;
+
+    void InitSharedImmutableWorkbuffers(const Buffers& buffers) override;
+
+private:
+    void calculateOffsets();
+
+private:
+    std::vector<size_t> output_shape_;
+    std::vector<kernel::CompareSelect::BrcstOffsetType> output_offset_;
+    size_t max_size_;
+    std::vector<kernel::CompareSelect::BrcstOffsetType> output_sizes_;
+
+    using Input = std::vector<kernel::CompareSelect::BrcstOffsetType>;
+    std::vector<Input> input_shapes_;
+    std::vector<Input> input_offsets_;
+
+    std::optional<kernel::CompareSelect> kernel_;
+};
+
+}  // namespace nvidia_gpu
+}  // namespace ov
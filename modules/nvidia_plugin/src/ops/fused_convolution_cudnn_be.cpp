@@ -12,7 +12,10 @@
 #include <gsl/gsl_assert>
 #include <ops/converters.hpp>
 
+#include <sstream>
+
 #include "cuda/dnn_be_algo.hpp"
+#include "cuda/dnn_be_algo_cache.hpp"
 #include "cuda/event.hpp"
 #include "memory_manager/model/details/cuda_memory_utils.hpp"
 
@@ -21,6 +24,45 @@ namespace nvidia_gpu {
 
 constexpr int NON_SPATIAL_DIMS_NUMBER = 2;
 
+namespace {
+
+std::string makeBenchmarkCacheKey(const Convolution::Details::FusedConvolutionParams& params, const size_t workspace_limit) {
+    std::ostringstream key;
+    const auto appendShape = [&key](const auto& shape) {
+        key << '(';
+        for (const auto& dim : shape) {
+            key << dim << ',';
+        }
+        key << ')';
+    };
+    key << "FusedConvolutionCuDnnBE:t" << static_cast<int>(params.conv_.element_type_) << ":i";
+    appendShape(params.conv_.input_shape_);
+    key << ":f";
+    appendShape(params.conv_.filter_shape_);
+    key << ":o";
+    appendShape(params.conv_.output_shape_);
+    key << ":s";
+    appendShape(params.conv_.strides_);
+    key << ":d";
+    appendShape(params.conv_.dilations_);
+    key << ":pb";
+    appendShape(params.conv_.padding_before_);
+    key << ":pa";
+    appendShape(params.conv_.padding_after_);
+    key << ":g" << params.conv_.groups_;
+    key << ":b";
+    appendShape(params.bias_shape_);
+    key << ":z";
+    if (params.add_shape_) {
+        appendShape(params.add_shape_.value());
+    }
+    key << ":a" << static_cast<int>(params.activation_);
+    key << ":w" << workspace_limit;
+    return CUDA::DnnBenchmarkCache::makeKey(key.str());
+}
+
+}  // namespace
+
 struct DnnTensorID {
     static constexpr int64_t input = 'x';
     static constexpr int64_t filter = 'w';
@@ -231,7 +273,22 @@ FusedConvolutionCuDnnBE::FusedConvolutionCuDnnBE(const CreationContext& context,
 
     std::shared_ptr<CUDA::DnnBEExecutionPlan> plan;
     if (context.opBenchOption()) {
-        plan = performBenchmarks(context.dnnHandle(), plans);
+        auto& algoCache = CUDA::DnnBenchmarkCache::instance();
+        std::string cacheKey;
+        std::optional<std::size_t> cached;
+        if (algoCache.enabled()) {
+            cacheKey = makeBenchmarkCacheKey(params_, context.dnnWorkspaceLimit());
+            cached = algoCache.find(cacheKey);
+        }
+        if (cached && *cached < plans.size()) {
+            plan = plans[*cached];
+        } else {
+            plan = performBenchmarks(context.dnnHandle(), plans, context.dnnWorkspaceLimit());
+            if (algoCache.enabled()) {
+                const auto found = std::find(plans.begin(), plans.end(), plan);
+                algoCache.store(cacheKey, static_cast<std::size_t>(std::distance(plans.begin(), found)));
+            }
+        }
     } else {
         plan = std::move(plans[0]);
     }
@@ -241,7 +298,9 @@ FusedConvolutionCuDnnBE::FusedConvolutionCuDnnBE(const CreationContext& context,
 }
 
 std::shared_ptr<CUDA::DnnBEExecutionPlan> FusedConvolutionCuDnnBE::performBenchmarks(
-    const CUDA::DnnHandle& dnnHandle, std::vector<std::shared_ptr<CUDA::DnnBEExecutionPlan>>& plans) {
+    const CUDA::DnnHandle& dnnHandle,
+    std::vector<std::shared_ptr<CUDA::DnnBEExecutionPlan>>& plans,
+    const size_t workspace_limit) {
     auto input = CUDA::DefaultStream::stream().malloc(ngraph::element::Type{params_.conv_.element_type_}.size() *
                                                       ngraph::shape_size(params_.conv_.input_shape_));
     auto filter = CUDA::DefaultStream::stream().malloc(ngraph::element::Type{params_.conv_.element_type_}.size() *
@@ -268,7 +327,7 @@ std::shared_ptr<CUDA::DnnBEExecutionPlan> FusedConvolutionCuDnnBE::performBenchm
     }
 
     constexpr const size_t kNumBenchmarks = 100;
-    return CUDA::performBenchmarks<kNumBenchmarks>(dnnHandle, plans, variantPackBuilder);
+    return CUDA::performBenchmarks<kNumBenchmarks>(dnnHandle, plans, variantPackBuilder, workspace_limit);
 }
 
 WorkbufferRequest FusedConvolutionCuDnnBE::GetWorkBufferRequest() const {
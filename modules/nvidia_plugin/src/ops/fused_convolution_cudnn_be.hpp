@@ -43,7 +43,9 @@ private:
                                                                              const cudnnTensorFormat_t format,
                                                                              bool isVirtual = false);
     std::shared_ptr<CUDA::DnnBEExecutionPlan> performBenchmarks(
-        const CUDA::DnnHandle& context, std::vector<std::shared_ptr<CUDA::DnnBEExecutionPlan>>& plans);
+        const CUDA::DnnHandle& context,
+        std::vector<std::shared_ptr<CUDA::DnnBEExecutionPlan>>& plans,
+        size_t workspace_limit);
 
     std::shared_ptr<CUDA::DnnBEEngineConfigDescriptor> engine_config_;
     int64_t workspace_size_ = 0;
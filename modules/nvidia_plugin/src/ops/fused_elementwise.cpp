@@ -0,0 +1,133 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "fused_elementwise.hpp"
+
+#include <fmt/format.h>
+
+#include <cuda_operation_registry.hpp>
+#include <gsl/gsl_assert>
+#include <sstream>
+#include <vector>
+
+#include "error.hpp"
+
+namespace ov {
+namespace nvidia_gpu {
+
+namespace {
+
+constexpr const char* kEntryName = "fused_eltwise";
+
+using nodes::EltwiseKind;
+using nodes::EltwiseStep;
+
+/**
+ * Generates the CUDA source of the fused kernel. Binary steps read their second
+ * operand from consecutive extra arguments; the running value stays in a
+ * register across the whole chain.
+ */
+std::string generateSource(const std::vector<EltwiseStep>& steps) {
+    std::ostringstream body;
+    std::size_t extraIndex = 0;
+    for (const auto& step : steps) {
+        switch (step.kind) {
+            case EltwiseKind::Add:
+                body << fmt::format("    v = v + arg{}[i];\n", extraIndex++);
+                break;
+            case EltwiseKind::Subtract:
+                body << fmt::format("    v = v - arg{}[i];\n", extraIndex++);
+                break;
+            case EltwiseKind::Multiply:
+                body << fmt::format("    v = v * arg{}[i];\n", extraIndex++);
+                break;
+            case EltwiseKind::Divide:
+                body << fmt::format("    v = v / arg{}[i];\n", extraIndex++);
+                break;
+            case EltwiseKind::Relu:
+                body << "    v = v > 0.0f ? v : 0.0f;\n";
+                break;
+            case EltwiseKind::Sigmoid:
+                body << "    v = 1.0f / (1.0f + expf(-v));\n";
+                break;
+            case EltwiseKind::Tanh:
+                body << "    v = tanhf(v);\n";
+                break;
+            case EltwiseKind::Clamp:
+                body << fmt::format("    v = fminf(fmaxf(v, {:.9e}f), {:.9e}f);\n", step.alpha, step.beta);
+                break;
+            case EltwiseKind::Swish:
+                body << "    v = v / (1.0f + expf(-v));\n";
+                break;
+            default:
+                throwIEException("FusedElementwiseOp: unsupported chain step");
+        }
+    }
+
+    std::ostringstream src;
+    src << "extern \"C\" __global__ void " << kEntryName << "(const float* __restrict__ in";
+    for (std::size_t i = 0; i < extraIndex; ++i) {
+        src << fmt::format(", const float* __restrict__ arg{}", i);
+    }
+    src << ", float* __restrict__ out, unsigned long long num_elements) {\n"
+        << "  const unsigned long long i = blockIdx.x * static_cast<unsigned long long>(blockDim.x) + threadIdx.x;\n"
+        << "  if (i < num_elements) {\n"
+        << "    float v = in[i];\n"
+        << body.str() << "    out[i] = v;\n"
+        << "  }\n"
+        << "}\n";
+    return src.str();
+}
+
+}  // namespace
+
+FusedElementwiseOp::FusedElementwiseOp(const CreationContext& context,
+                                       const NodeOp& node,
+                                       IndexCollection&& inputIds,
+                                       IndexCollection&& outputIds)
+    : OperationBase{context, node, move(inputIds), move(outputIds)}, num_inputs_{node.get_input_size()} {
+    Expects(node.get_output_size() == 1);
+    if (node.get_output_element_type(0) != ov::element::f32) {
+        throwIEException(fmt::format("FusedElementwiseOp: only f32 chains are supported, got {}",
+                                     node.get_output_element_type(0).get_type_name()));
+    }
+    num_elements_ = ov::shape_size(node.get_output_shape(0));
+
+    const auto maxThreadsPerBlock = static_cast<unsigned>(context.device().props().maxThreadsPerBlock);
+    block_dim_ = std::min(maxThreadsPerBlock, 256u);
+    grid_dim_ = static_cast<unsigned>((num_elements_ + block_dim_ - 1) / block_dim_);
+
+    kernel_.emplace(generateSource(node.get_steps()), kEntryName, context.device());
+}
+
+void FusedElementwiseOp::Execute(const InferenceRequestContext& context,
+                                 Inputs inputTensors,
+                                 Outputs outputTensors,
+                                 const Workbuffers&) const {
+    Expects(kernel_);
+    Expects(inputTensors.size() == num_inputs_);
+    Expects(outputTensors.size() == 1);
+
+    std::vector<const void*> pointers;
+    pointers.reserve(num_inputs_);
+    for (const auto& input : inputTensors) {
+        pointers.push_back(input.get());
+    }
+    void* out = outputTensors[0].get();
+    auto numElements = num_elements_;
+
+    std::vector<void*> args;
+    args.reserve(num_inputs_ + 2);
+    for (auto& pointer : pointers) {
+        args.push_back(&pointer);
+    }
+    args.push_back(&out);
+    args.push_back(&numElements);
+
+    kernel_->launch(context.getThreadContext().stream(), grid_dim_, block_dim_, args.data());
+}
+
+OPERATION_REGISTER(FusedElementwiseOp, FusedElementwise);
+}  // namespace nvidia_gpu
+}  // namespace ov
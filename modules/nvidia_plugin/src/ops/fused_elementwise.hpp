@@ -0,0 +1,45 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cuda/nvrtc.hpp>
+#include <cuda_operation_base.hpp>
+#include <optional>
+#include <transformer/nodes/fused_elementwise.hpp>
+
+namespace ov {
+namespace nvidia_gpu {
+
+/**
+ * @brief Executes a fused elementwise chain as one NVRTC-generated kernel.
+ *
+ * The kernel source is generated from the chain description of the
+ * nvidia_gpu::nodes::FusedElementwise node and compiled for the target device
+ * at network load time, so inference pays a single kernel launch per chain.
+ */
+class FusedElementwiseOp : public OperationBase {
+public:
+    using NodeOp = nodes::FusedElementwise;
+
+    FusedElementwiseOp(const CreationContext& context,
+                       const NodeOp& node,
+                       IndexCollection&& inputIds,
+                       IndexCollection&& outputIds);
+
+    void Execute(const InferenceRequestContext& context,
+                 Inputs inputTensors,
+                 Outputs outputTensors,
+                 const Workbuffers& workbuffers) const override;
+
+private:
+    std::optional<CUDA::JitKernel> kernel_;
+    std::size_t num_inputs_;
+    unsigned long long num_elements_;
+    unsigned grid_dim_;
+    unsigned block_dim_;
+};
+
+}  // namespace nvidia_gpu
+}  // namespace ov
@@ -0,0 +1,62 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "fused_mha.hpp"
+
+#include <cuda_operation_registry.hpp>
+#include <gsl/gsl_assert>
+#include <transformer/nodes/fused_mha.hpp>
+
+#include "converters.hpp"
+
+namespace ov {
+namespace nvidia_gpu {
+
+FusedMHAOp::FusedMHAOp(const CreationContext& context,
+                       const ov::Node& node,
+                       IndexCollection&& inputIds,
+                       IndexCollection&& outputIds)
+    : OperationBase(context, node, std::move(inputIds), std::move(outputIds)) {
+    const auto& fused = dynamic_cast<const nodes::FusedMHA&>(node);
+    has_mask_ = fused.has_mask();
+    Expects(node.get_input_size() == (has_mask_ ? 4 : 3));
+
+    // The fusion pass guarantees [B, H, S, E] layouts; see nodes::FusedMHA
+    const auto& q_shape = node.get_input_shape(QUERY);
+    const auto& k_shape = node.get_input_shape(KEY);
+    Expects(q_shape.size() == 4 && k_shape.size() == 4);
+    const auto seq_kv = k_shape[2];
+    // One mask row serves every batch when the mask batch dimension broadcasts
+    const auto mask_batch_stride = has_mask_ && node.get_input_shape(MASK)[0] != 1 ? seq_kv : 0;
+
+    kernel_ = kernel::FusedMHA{convertDataType<kernel::Type_t>(node.get_output_element_type(0)),
+                               q_shape[0] * q_shape[1],
+                               q_shape[1],
+                               q_shape[2],
+                               seq_kv,
+                               q_shape[3],
+                               mask_batch_stride,
+                               fused.get_scale(),
+                               static_cast<size_t>(context.device().props().maxThreadsPerBlock)};
+}
+
+void FusedMHAOp::Execute(const InferenceRequestContext& context,
+                         Inputs inputs,
+                         Outputs outputs,
+                         const Workbuffers& workbuffers) const {
+    Expects(kernel_);
+    Expects(inputs.size() == (has_mask_ ? 4 : 3));
+    Expects(outputs.size() == 1);
+    (*kernel_)(context.getThreadContext().stream().get(),
+               inputs[QUERY].get(),
+               inputs[KEY].get(),
+               inputs[VALUE].get(),
+               has_mask_ ? inputs[MASK].get() : nullptr,
+               outputs[0].get());
+}
+
+OPERATION_REGISTER(FusedMHAOp, FusedMHA);
+
+}  // namespace nvidia_gpu
+}  // namespace ov
@@ -0,0 +1,35 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cuda_operation_base.hpp>
+#include <optional>
+
+#include "kernels/fused_mha.hpp"
+
+namespace ov {
+namespace nvidia_gpu {
+
+class FusedMHAOp : public OperationBase {
+    enum InputIdx { QUERY, KEY, VALUE, MASK };
+
+public:
+    FusedMHAOp(const CreationContext& context,
+               const ov::Node& node,
+               IndexCollection&& inputIds,
+               IndexCollection&& outputIds);
+
+    void Execute(const InferenceRequestContext& context,
+                 Inputs inputs,
+                 Outputs outputs,
+                 const Workbuffers& workbuffers) const override;
+
+private:
+    bool has_mask_;
+    std::optional<kernel::FusedMHA> kernel_;
+};
+
+}  // namespace nvidia_gpu
+}  // namespace ov
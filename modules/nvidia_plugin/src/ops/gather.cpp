@@ -6,6 +6,7 @@
 
 #include <fmt/format.h>
 
+#include <cstdlib>
 #include <cuda_operation_registry.hpp>
 #include <error.hpp>
 #include <gsl/gsl_assert>
@@ -13,6 +14,8 @@
 #include <numeric>
 #include <openvino/op/gather.hpp>
 
+#include <kernels/arch_dispatch.hpp>
+
 #include "converters.hpp"
 
 namespace ov {
@@ -23,6 +26,16 @@ namespace {
 constexpr unsigned ELS_PER_THREAD_CHUNKS = 2;
 constexpr unsigned ELS_PER_THREAD_DICTS = 1;
 
+/**
+ * The in-kernel index range check traps on out-of-bounds indices. For trusted
+ * inputs it can be skipped by setting OPENVINO_NVIDIA_GATHER_SKIP_BOUNDS_CHECK
+ * to a non-zero value, removing the branch from the gather hot loop.
+ */
+bool gatherBoundsCheckEnabled() {
+    const char* env = std::getenv("OPENVINO_NVIDIA_GATHER_SKIP_BOUNDS_CHECK");
+    return !(env && env[0] != '\0' && env[0] != '0');
+}
+
 }  // namespace
 
 GatherOp::GatherOp(const CreationContext& context,
@@ -145,6 +158,13 @@ GatherOp::GatherOp(const CreationContext& context,
     Expects(grid_dim_y <= max_grid_size[1]);
     Expects(blocks_per_grid <= max_grid_size[2]);
 
+    // When every gathered row is contiguous (nothing between the batch and the
+    // gather axis) and a whole number of 128-bit vectors long, a warp can copy it
+    // with uint4 loads instead of one scalar element per thread, which matters
+    // for embedding-style lookups with wide rows
+    const std::size_t row_bytes = static_cast<std::size_t>(data_length) * node.get_input_element_type(0).size();
+    const bool vectorized_rows = num_dicts == 1 && row_bytes % 16 == 0;
+
     gather_kernel_ = kernel::Gather{convertDataType<ov::nvidia_gpu::kernel::Type_t>(element_type),
                                     convertDataType<ov::nvidia_gpu::kernel::Type_t>(indices_type),
                                     num_dicts,
@@ -160,7 +180,10 @@ GatherOp::GatherOp(const CreationContext& context,
                                     indices_batch_stride,
                                     out_batch_stride,
                                     ELS_PER_THREAD_CHUNKS,
-                                    ELS_PER_THREAD_DICTS};
+                                    ELS_PER_THREAD_DICTS,
+                                    vectorized_rows,
+                                    gatherBoundsCheckEnabled(),
+                                    kernel::computeCapability(device_props.major, device_props.minor)};
 }
 
 void GatherOp::Execute(const InferenceRequestContext& context,
@@ -0,0 +1,91 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "gather_concat.hpp"
+
+#include <cuda_operation_registry.hpp>
+#include <gsl/gsl_assert>
+#include <transformer/nodes/gather_concat.hpp>
+
+#include "converters.hpp"
+
+namespace ov {
+namespace nvidia_gpu {
+
+GatherConcatOp::GatherConcatOp(const CreationContext& context,
+                               const ov::Node& node,
+                               IndexCollection&& inputIds,
+                               IndexCollection&& outputIds)
+    : OperationBase(context, node, std::move(inputIds), std::move(outputIds)), num_inputs_{node.get_input_size()} {
+    const auto& fused = dynamic_cast<const nodes::GatherConcat&>(node);
+    Expects(node.get_output_size() == 1);
+    Expects(num_inputs_ == GetInputIds().size());
+    Expects(GetOutputIds().size() == 1);
+
+    const auto num_segments = fused.get_num_segments();
+    const auto& output_shape = node.get_output_shape(0);
+    const size_t batch = output_shape[0];
+    const size_t out_row_stride = output_shape[1];
+
+    // One thread per element of a slice; the x grid covers the widest slice,
+    // narrower segments retire their tail threads in the kernel
+    size_t max_segment_size = 0;
+    std::vector<kernel::GatherConcat::Segment> segments;
+    segments.reserve(num_segments);
+    size_t out_offset = 0;
+    for (size_t segment = 0; segment < num_segments; ++segment) {
+        const auto& dict_shape = node.get_input_shape(2 * segment);
+        const size_t row_length = dict_shape[1];
+        segments.emplace_back(kernel::GatherConcat::Segment{static_cast<unsigned>(out_offset),
+                                                            static_cast<unsigned>(row_length),
+                                                            static_cast<unsigned>(dict_shape[0])});
+        out_offset += row_length;
+        max_segment_size = std::max(max_segment_size, batch * row_length);
+    }
+    Expects(out_offset == out_row_stride);
+
+    const auto max_block_size = static_cast<size_t>(context.device().props().maxThreadsPerBlock);
+    const size_t num_blocks = (max_segment_size + max_block_size - 1) / max_block_size;
+    const size_t threads_per_block = (num_blocks == 1) ? max_segment_size : max_block_size;
+
+    kernel_ = kernel::GatherConcat{convertDataType<kernel::Type_t>(node.get_output_element_type(0)),
+                                   convertDataType<kernel::Type_t>(node.get_input_element_type(1)),
+                                   std::move(segments),
+                                   batch,
+                                   out_row_stride,
+                                   num_blocks,
+                                   threads_per_block};
+}
+
+void GatherConcatOp::Execute(const InferenceRequestContext& context,
+                             Inputs inputs,
+                             Outputs outputs,
+                             const Workbuffers& workbuffers) const {
+    Expects(kernel_);
+    Expects(inputs.size() == num_inputs_);
+    Expects(outputs.size() == 1);
+    Expects(workbuffers.immutable_buffers.size() == 1);
+    Expects(workbuffers.mutable_buffers.size() == 1);
+    auto& stream = context.getThreadContext().stream();
+
+    // The fused node orders its inputs in (dictionary, indices) pairs, so the
+    // uploaded pointer array is exactly the layout the kernel indexes
+    stream.upload(workbuffers.mutable_buffers[0], inputs.data(), mutableWbSize());
+    (*kernel_)(stream.get(),
+               workbuffers.immutable_buffers[0].get(),
+               reinterpret_cast<const void* const*>(workbuffers.mutable_buffers[0].get()),
+               outputs[0].get());
+}
+
+WorkbufferRequest GatherConcatOp::GetWorkBufferRequest() const { return {{immutableWbSize()}, {mutableWbSize()}}; }
+
+void GatherConcatOp::InitSharedImmutableWorkbuffers(const Buffers& buffers) {
+    Expects(buffers.size() == 1);
+    CUDA::DefaultStream::stream().upload(buffers[0], kernel_.value().immutableWbData(), immutableWbSize());
+}
+
+OPERATION_REGISTER(GatherConcatOp, GatherConcat);
+
+}  // namespace nvidia_gpu
+}  // namespace ov
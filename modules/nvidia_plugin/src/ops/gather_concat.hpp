@@ -0,0 +1,40 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cuda_operation_base.hpp>
+#include <optional>
+
+#include "kernels/gather_concat.hpp"
+
+namespace ov {
+namespace nvidia_gpu {
+
+class GatherConcatOp : public OperationBase {
+public:
+    GatherConcatOp(const CreationContext& context,
+                   const ov::Node& node,
+                   IndexCollection&& inputIds,
+                   IndexCollection&& outputIds);
+
+    void Execute(const InferenceRequestContext& context,
+                 Inputs inputs,
+                 Outputs outputs,
+                 const Workbuffers& workbuffers) const override;
+
+    WorkbufferRequest GetWorkBufferRequest() const override;
+
+    void InitSharedImmutableWorkbuffers(const Buffers& buffers) override;
+
+private:
+    size_t immutableWbSize() const { return kernel_.value().immutableWbSize(); }
+    size_t mutableWbSize() const { return kernel_.value().mutableWbSize(); }
+
+    size_t num_inputs_;
+    std::optional<kernel::GatherConcat> kernel_;
+};
+
+}  // namespace nvidia_gpu
+}  // namespace ov
@@ -23,6 +23,52 @@ GRUSequenceOp::GRUSequenceOp(const CreationContext& context,
     ib_weight_space_.addRequest(immut_sizes_, descs_.weightSpaceSize());
 
     mb_work_space_.addRequest(mut_sizes_, descs_.workSpaceSize());
+
+    setupLayoutAdapters();
+    if (hx_adapter) hx_adapter->requestWorkbuffer(mut_sizes_);
+    if (y_adapter) y_adapter->requestWorkbuffer(mut_sizes_);
+    if (hy_adapter) hy_adapter->requestWorkbuffer(mut_sizes_);
+}
+
+void GRUSequenceOp::setupLayoutAdapters() {
+    using InputAdapter = RNN::Details::TransposeInputTensorAdapter;
+    using OutputAdapter = RNN::Details::TransposeOutputTensorAdapter;
+
+    const int64_t batch_size = params_.batch_size_;
+    const int64_t num_directions = params_.numDirections();
+    const int64_t hidden_size = params_.hidden_size_;
+    const int64_t max_seq_length = params_.max_seq_length_;
+
+    // Determine whether it's necessary to transpose the state tensors to make OpenVINO
+    // state inputs/outputs binary compatible with cuDNN API.
+    const std::vector<int64_t> state_shape_openvino = {batch_size, num_directions, hidden_size};
+    const std::vector<int64_t> state_shape_cudnn = {num_directions, batch_size, hidden_size};
+    const bool transposeStates = (batch_size > 1) && (num_directions > 1);
+    if (transposeStates) {
+        hx_adapter = std::make_unique<InputAdapter>(params_.element_type_cuda_,
+                                                    params_.element_size_,
+                                                    state_shape_openvino,
+                                                    state_shape_cudnn,
+                                                    std::vector<int>{1, 0, 2});
+        hy_adapter = std::make_unique<OutputAdapter>(params_.element_type_cuda_,
+                                                     params_.element_size_,
+                                                     state_shape_cudnn,
+                                                     state_shape_openvino,
+                                                     std::vector<int>{1, 0, 2});
+    }
+
+    // Determine whether it's necessary to transpose output Y tensor to make cuDNN API
+    // output binary compatible with OpenVINO.
+    const std::vector<int64_t> y_shape_openvino = {batch_size, num_directions, max_seq_length, hidden_size};
+    const std::vector<int64_t> y_shape_cudnn = {batch_size, max_seq_length, num_directions, hidden_size};
+    const bool transposeY = (num_directions > 1) && (max_seq_length > 1);
+    if (transposeY) {
+        y_adapter = std::make_unique<OutputAdapter>(params_.element_type_cuda_,
+                                                    params_.element_size_,
+                                                    y_shape_cudnn,
+                                                    y_shape_openvino,
+                                                    std::vector<int>{0, 2, 1, 3});
+    }
 }
 
 GRUSequenceOp::Config GRUSequenceOp::config() {
@@ -42,11 +88,13 @@ void GRUSequenceOp::Execute(const InferenceRequestContext& context,
     const auto& ib = workbuffers.immutable_buffers;
     const auto& mb = workbuffers.mutable_buffers;
 
+    if (hx_adapter) hx_adapter->execute(context, inputs[ArgIndices::hidden_input], mb);
+
     const void* const api_x = inputs[ArgIndices::x].get();
-    const void* const api_hx = inputs[ArgIndices::hidden_input].get();
+    const void* const api_hx = hx_adapter ? hx_adapter->dnnApiPtr(mb) : inputs[ArgIndices::hidden_input].get();
 
-    void* const api_y = outputs[ArgIndices::y].get();
-    void* const api_hy = outputs[ArgIndices::hidden_output].get();
+    void* const api_y = y_adapter ? y_adapter->dnnApiPtr(mb) : outputs[ArgIndices::y].get();
+    void* const api_hy = hy_adapter ? hy_adapter->dnnApiPtr(mb) : outputs[ArgIndices::hidden_output].get();
 
     const auto& dnnHandle = context.getThreadContext().dnnHandle();
     dnnHandle.rnnForward(descs_.rnnDesc(),
@@ -68,6 +116,9 @@ void GRUSequenceOp::Execute(const InferenceRequestContext& context,
                          mb_work_space_.optionalPtr(mb),
                          0,
                          nullptr);
+
+    if (y_adapter) y_adapter->execute(context, mb, outputs[ArgIndices::y]);
+    if (hy_adapter) hy_adapter->execute(context, mb, outputs[ArgIndices::hidden_output]);
 }
 
 void GRUSequenceOp::InitSharedImmutableWorkbuffers(const IOperationExec::Buffers& buffers) {
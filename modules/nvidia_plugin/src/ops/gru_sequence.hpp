@@ -37,6 +37,7 @@ private:
     static Config config();
     void InitSharedImmutableWorkbuffers(const IOperationExec::Buffers&) override;
     WorkbufferRequest GetWorkBufferRequest() const override;
+    void setupLayoutAdapters();
 
 private:
     const RNN::Details::GRUSequenceParamsCuDnn params_;
@@ -48,6 +49,12 @@ private:
     WorkbufferDesc ib_seq_lengths_;
     WorkbufferDesc ib_weight_space_;
     WorkbufferDesc mb_work_space_;
+
+    // Transpose adapters bridging the OpenVINO and cuDNN tensor layouts; only
+    // instantiated for the bidirectional case where the layouts differ
+    std::unique_ptr<RNN::Details::TransposeInputTensorAdapter> hx_adapter;
+    std::unique_ptr<RNN::Details::TransposeOutputTensorAdapter> y_adapter;
+    std::unique_ptr<RNN::Details::TransposeOutputTensorAdapter> hy_adapter;
 };
 
 }  // namespace nvidia_gpu
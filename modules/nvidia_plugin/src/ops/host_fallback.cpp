@@ -0,0 +1,98 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "host_fallback.hpp"
+
+#include <fmt/format.h>
+
+#include <error.hpp>
+#include <gsl/gsl_assert>
+#include <ngraph/runtime/host_tensor.hpp>
+
+namespace ov {
+namespace nvidia_gpu {
+
+HostFallbackOp::HostFallbackOp(const CreationContext& context,
+                               const std::shared_ptr<ov::Node>& node,
+                               IndexCollection&& inputIds,
+                               IndexCollection&& outputIds)
+    : OperationBase(context, *node, std::move(inputIds), std::move(outputIds)), node_{node} {
+    if (!CanHandle(node)) {
+        throwIEException(fmt::format(
+            "Node: name = {}, description = {}; Has no reference evaluate() or dynamic shapes, "
+            "cannot run through the host fallback",
+            node->get_name(),
+            node->description()));
+    }
+    for (std::size_t i = 0; i < node->get_input_size(); ++i) {
+        input_types_.push_back(node->get_input_element_type(i));
+        input_shapes_.push_back(node->get_input_shape(i));
+    }
+    for (std::size_t i = 0; i < node->get_output_size(); ++i) {
+        output_types_.push_back(node->get_output_element_type(i));
+        output_shapes_.push_back(node->get_output_shape(i));
+    }
+}
+
+bool HostFallbackOp::CanHandle(const std::shared_ptr<ov::Node>& node) {
+    if (!node->has_evaluate()) {
+        return false;
+    }
+    for (std::size_t i = 0; i < node->get_input_size(); ++i) {
+        if (node->get_input_partial_shape(i).is_dynamic()) {
+            return false;
+        }
+    }
+    for (std::size_t i = 0; i < node->get_output_size(); ++i) {
+        if (node->get_output_partial_shape(i).is_dynamic()) {
+            return false;
+        }
+    }
+    return true;
+}
+
+const std::string_view& HostFallbackOp::GetCategory() const {
+    static constexpr std::string_view host{"HOST"};
+    return host;
+}
+
+void HostFallbackOp::Execute(const InferenceRequestContext& context,
+                             Inputs inputTensors,
+                             Outputs outputTensors,
+                             const Workbuffers&) const {
+    Expects(inputTensors.size() == input_types_.size());
+    Expects(outputTensors.size() == output_types_.size());
+    const auto& stream = context.getThreadContext().stream();
+
+    ngraph::HostTensorVector inputs;
+    inputs.reserve(inputTensors.size());
+    for (std::size_t i = 0; i < inputTensors.size(); ++i) {
+        auto tensor = std::make_shared<ngraph::HostTensor>(input_types_[i], input_shapes_[i]);
+        stream.download(tensor->get_data_ptr(), inputTensors[i], ov::shape_size(input_shapes_[i]) * input_types_[i].size());
+        inputs.push_back(std::move(tensor));
+    }
+    // The downloads are ordered after the producing device segment on the
+    // compute stream; the host evaluation needs them finished
+    stream.synchronize();
+
+    ngraph::HostTensorVector outputs;
+    outputs.reserve(outputTensors.size());
+    for (std::size_t i = 0; i < outputTensors.size(); ++i) {
+        outputs.push_back(std::make_shared<ngraph::HostTensor>(output_types_[i], output_shapes_[i]));
+    }
+    if (!node_->evaluate(outputs, inputs)) {
+        throwIEException(
+            fmt::format("Node: name = {}, description = {}; Reference evaluate() failed",
+                        node_->get_name(),
+                        node_->description()));
+    }
+    // The consuming device segment is enqueued on the same stream, so the
+    // uploads order naturally before it and no second synchronization is needed
+    for (std::size_t i = 0; i < outputTensors.size(); ++i) {
+        stream.upload(outputTensors[i], outputs[i]->get_data_ptr(), ov::shape_size(output_shapes_[i]) * output_types_[i].size());
+    }
+}
+
+}  // namespace nvidia_gpu
+}  // namespace ov
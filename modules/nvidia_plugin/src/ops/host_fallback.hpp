@@ -0,0 +1,56 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cuda_operation_base.hpp>
+#include <openvino/core/node.hpp>
+
+namespace ov {
+namespace nvidia_gpu {
+
+/**
+ * Executes one operation on the host inside a device execution sequence.
+ *
+ * This is the plugin's native hetero-style partitioning: instead of rejecting
+ * the whole model when a single node has no CUDA implementation, the node runs
+ * through its ngraph reference evaluate() between the device segments. Only
+ * the tensors crossing this operation's own boundary are transferred; every
+ * other intermediate stays device-resident in the mutable memory blob, so the
+ * GPU segments around the host segment are unaffected.
+ */
+class HostFallbackOp : public OperationBase {
+public:
+    HostFallbackOp(const CreationContext& context,
+                   const std::shared_ptr<ov::Node>& node,
+                   IndexCollection&& inputIds,
+                   IndexCollection&& outputIds);
+
+    void Execute(const InferenceRequestContext& context,
+                 Inputs inputTensors,
+                 Outputs outputTensors,
+                 const Workbuffers& workbuffers) const override;
+
+    bool IsCudaGraphCompatible() const override {
+        return false;  // Synchronizes the stream around the host evaluation
+    }
+
+    const std::string_view& GetCategory() const override;
+
+    /**
+     * Returns true if the node can run through the host fallback: it offers a
+     * reference evaluate() and all of its shapes are static
+     */
+    static bool CanHandle(const std::shared_ptr<ov::Node>& node);
+
+private:
+    std::shared_ptr<ov::Node> node_;
+    std::vector<ov::element::Type> input_types_;
+    std::vector<ov::Shape> input_shapes_;
+    std::vector<ov::element::Type> output_types_;
+    std::vector<ov::Shape> output_shapes_;
+};
+
+}  // namespace nvidia_gpu
+}  // namespace ov
@@ -0,0 +1,61 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "iota_gather.hpp"
+
+#include <cuda_operation_registry.hpp>
+#include <gsl/gsl_assert>
+#include <numeric>
+#include <transformer/nodes/iota_gather.hpp>
+
+#include "converters.hpp"
+
+namespace ov {
+namespace nvidia_gpu {
+
+IotaGatherOp::IotaGatherOp(const CreationContext& context,
+                           const ov::Node& node,
+                           IndexCollection&& inputIds,
+                           IndexCollection&& outputIds)
+    : OperationBase(context, node, std::move(inputIds), std::move(outputIds)) {
+    const auto& iota_gather = dynamic_cast<const nodes::IotaGather&>(node);
+    Expects(node.get_input_size() == 1);
+    Expects(node.get_output_size() == 1);
+
+    const auto& dict_shape = node.get_input_shape(0);
+    const auto axis = iota_gather.get_axis();
+    Expects(axis >= 0 && axis < dict_shape.size());
+
+    const unsigned num_dicts =
+        std::accumulate(dict_shape.cbegin(), dict_shape.cbegin() + axis, 1, std::multiplies<unsigned>());
+    const unsigned index_range = dict_shape[axis];
+    const unsigned data_length =
+        std::accumulate(dict_shape.cbegin() + axis + 1, dict_shape.cend(), 1, std::multiplies<unsigned>());
+    Expects(data_length != 0);
+
+    const auto max_threads_per_block = context.device().props().maxThreadsPerBlock;
+    kernel_ = kernel::IotaGather{convertDataType<kernel::Type_t>(node.get_input_element_type(0)),
+                                 iota_gather.get_start(),
+                                 iota_gather.get_step(),
+                                 num_dicts,
+                                 index_range,
+                                 data_length,
+                                 static_cast<unsigned>(iota_gather.get_indices_count()),
+                                 static_cast<unsigned>(max_threads_per_block)};
+}
+
+void IotaGatherOp::Execute(const InferenceRequestContext& context,
+                           Inputs inputs,
+                           Outputs outputs,
+                           const Workbuffers&) const {
+    Expects(kernel_);
+    Expects(inputs.size() == 1);
+    Expects(outputs.size() == 1);
+
+    (*kernel_)(context.getThreadContext().stream().get(), inputs[0].get(), outputs[0].get());
+}
+
+OPERATION_REGISTER(IotaGatherOp, IotaGather);
+}  // namespace nvidia_gpu
+}  // namespace ov
@@ -0,0 +1,38 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cuda_operation_base.hpp>
+#include <optional>
+
+#include "kernels/iota_gather.hpp"
+
+namespace ov {
+namespace nvidia_gpu {
+
+/**
+ * Gather over a virtual arithmetic index progression; created by the
+ * FuseRangeGather pass from Range->Gather chains and constant progressions.
+ * The kernel derives every index from the thread position, so no index
+ * tensor is read.
+ */
+class IotaGatherOp : public OperationBase {
+public:
+    IotaGatherOp(const CreationContext& context,
+                 const ov::Node& node,
+                 IndexCollection&& inputIds,
+                 IndexCollection&& outputIds);
+
+    void Execute(const InferenceRequestContext& context,
+                 Inputs inputs,
+                 Outputs outputs,
+                 const Workbuffers& workbuffers) const override;
+
+private:
+    std::optional<kernel::IotaGather> kernel_;
+};
+
+}  // namespace nvidia_gpu
+}  // namespace ov
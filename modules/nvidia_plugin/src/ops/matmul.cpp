@@ -20,6 +20,27 @@
 namespace ov {
 namespace nvidia_gpu {
 
+namespace {
+
+constexpr std::size_t kLtMaxWorkspaceSize = 4 * 1024 * 1024;
+
+std::optional<cublasComputeType_t> ltComputeType(cudaDataType_t computeType) {
+    switch (computeType) {
+        case CUDA_R_16F:
+            return CUBLAS_COMPUTE_16F;
+        case CUDA_R_32F:
+            return CUBLAS_COMPUTE_32F;
+        case CUDA_R_64F:
+            return CUBLAS_COMPUTE_64F;
+        case CUDA_R_32I:
+            return CUBLAS_COMPUTE_32I;
+        default:
+            return std::nullopt;
+    }
+}
+
+}  // namespace
+
 template <typename TOperation>
 MatMulOp::MatMulOp(const CreationContext& context,
                    const TOperation& op,
@@ -61,8 +82,14 @@ MatMulOp::MatMulOp(const CreationContext& context,
     cublas_transpose_b_ = transposeB ? CUBLAS_OP_T : CUBLAS_OP_N;
     if constexpr (std::is_same_v<TOperation, nodes::FullyConnected>) {
         beta_ = &CUDA::NumericConst<CUDA::constants::one>(compute_type_);
+        // Bias can only be fused into the cuBLASLt epilogue as a per output
+        // column vector; other bias shapes keep the classic prefill path
+        if (ov::shape_size(op.get_input_shape(2)) == static_cast<size_t>(n_)) {
+            setupLtPlan(true);
+        }
     } else {
         beta_ = &CUDA::NumericConst<CUDA::constants::zero>(compute_type_);
+        setupLtPlan(false);
     }
     Ensures(m_ != 0);
     Ensures(k_ != 0);
@@ -173,6 +200,122 @@ void MatMulOp::BroadcastShapes(
     *(matrixCShape.end() - 1) = *(matrixBShape.end() - transposeB - 1);
 }
 
+void MatMulOp::setupLtPlan(bool biasEpilogue) {
+    const auto computeType = ltComputeType(compute_type_);
+    if (!computeType) {
+        return;
+    }
+    try {
+        CUDA::CuBlasLtHandle handle;
+        lt_matmul_desc_.emplace(*computeType, compute_type_);
+        // The first cuBLASLt operand is our matrix B and the second is our
+        // matrix A: the same Ct = Bt x At trick as in Execute() below
+        lt_matmul_desc_->setAttribute(CUBLASLT_MATMUL_DESC_TRANSA, &cublas_transpose_b_, sizeof(cublas_transpose_b_));
+        lt_matmul_desc_->setAttribute(CUBLASLT_MATMUL_DESC_TRANSB, &cublas_transpose_a_, sizeof(cublas_transpose_a_));
+        if (biasEpilogue) {
+            const cublasLtEpilogue_t epilogue = CUBLASLT_EPILOGUE_BIAS;
+            lt_matmul_desc_->setAttribute(CUBLASLT_MATMUL_DESC_EPILOGUE, &epilogue, sizeof(epilogue));
+        }
+        const bool transA = cublas_transpose_a_ == CUBLAS_OP_T;
+        const bool transB = cublas_transpose_b_ == CUBLAS_OP_T;
+        lt_layout_b_.emplace(data_type_, transB ? k_ : n_, transB ? n_ : k_, ld_b_);
+        lt_layout_a_.emplace(data_type_, transA ? m_ : k_, transA ? k_ : m_, ld_a_);
+        lt_layout_c_.emplace(data_type_, n_, m_, ld_c_);
+        const int batchCount = batch_count_;
+        auto setBatch = [batchCount](CUDA::CuBlasLtMatrixLayout& layout, long long stride) {
+            layout.setAttribute(CUBLASLT_MATRIX_LAYOUT_BATCH_COUNT, &batchCount, sizeof(batchCount));
+            layout.setAttribute(CUBLASLT_MATRIX_LAYOUT_STRIDED_BATCH_OFFSET, &stride, sizeof(stride));
+        };
+        setBatch(*lt_layout_b_, stride_b_);
+        setBatch(*lt_layout_a_, stride_a_);
+        setBatch(*lt_layout_c_, stride_c_);
+
+        CUDA::CuBlasLtMatmulPreference preference;
+        preference.setAttribute(
+            CUBLASLT_MATMUL_PREF_MAX_WORKSPACE_BYTES, &kLtMaxWorkspaceSize, sizeof(kLtMaxWorkspaceSize));
+        cublasLtMatmulHeuristicResult_t result{};
+        int returnedResults = 0;
+        throwIfError(cublasLtMatmulAlgoGetHeuristic(handle.get(),
+                                                    lt_matmul_desc_->get(),
+                                                    lt_layout_b_->get(),
+                                                    lt_layout_a_->get(),
+                                                    lt_layout_c_->get(),
+                                                    lt_layout_c_->get(),
+                                                    preference.get(),
+                                                    1,
+                                                    &result,
+                                                    &returnedResults));
+        if (returnedResults == 0) {
+            throwIEException("cublasLtMatmulAlgoGetHeuristic returned no algorithms");
+        }
+        lt_algo_ = result.algo;
+        lt_workspace_size_ = result.workspaceSize;
+        lt_bias_epilogue_ = biasEpilogue;
+        lt_enabled_ = true;
+    } catch (...) {
+        // The classic cuBLAS path remains fully functional, so an unsupported
+        // cuBLASLt configuration is not an error
+        lt_matmul_desc_.reset();
+        lt_layout_a_.reset();
+        lt_layout_b_.reset();
+        lt_layout_c_.reset();
+        lt_workspace_size_ = 0;
+        lt_enabled_ = false;
+        lt_bias_epilogue_ = false;
+    }
+}
+
+void MatMulOp::executeLt(const InferenceRequestContext& context,
+                         const void* matrixA,
+                         const void* matrixB,
+                         void* matrixC,
+                         const void* bias,
+                         const Workbuffers& workbuffers) const {
+    Expects(lt_enabled_);
+    if (lt_bias_epilogue_ && bias != lt_bias_ptr_) {
+        lt_matmul_desc_->setAttribute(CUBLASLT_MATMUL_DESC_BIAS_POINTER, &bias, sizeof(bias));
+        lt_bias_ptr_ = bias;
+    }
+    void* workspace = nullptr;
+    if (lt_workspace_size_ != 0) {
+        workspace = workbuffers.mutable_buffers.at(0).get();
+    }
+    const auto& threadContext = context.getThreadContext();
+    throwIfError(cublasLtMatmul(threadContext.cuBlasLtHandle().get(),
+                                lt_matmul_desc_->get(),
+                                &CUDA::NumericConst<CUDA::constants::one>(compute_type_),
+                                matrixB,
+                                lt_layout_b_->get(),
+                                matrixA,
+                                lt_layout_a_->get(),
+                                &CUDA::NumericConst<CUDA::constants::zero>(compute_type_),
+                                matrixC,
+                                lt_layout_c_->get(),
+                                matrixC,
+                                lt_layout_c_->get(),
+                                &lt_algo_,
+                                workspace,
+                                lt_workspace_size_,
+                                threadContext.stream().get()));
+}
+
+void MatMulOp::ExecuteWithBias(const InferenceRequestContext& context,
+                               Inputs inputs,
+                               Outputs outputs,
+                               const Workbuffers& workbuffers) const {
+    Expects(lt_enabled_ && lt_bias_epilogue_);
+    Expects(inputs.size() == 3);
+    Expects(outputs.size() == 1);
+    executeLt(context, inputs[0].get(), inputs[1].get(), outputs[0].get(), inputs[2].get(), workbuffers);
+}
+
+WorkbufferRequest MatMulOp::GetWorkBufferRequest() const {
+    if (lt_workspace_size_ != 0) {
+        return {{}, {lt_workspace_size_}};
+    }
+    return {};
+}
+
 void MatMulOp::BroadcastToMatrix(ov::Shape& shape) {
     if (shape.size() < 2) {
         shape.insert(shape.begin(), 2 - shape.size(), 1);
@@ -184,9 +327,13 @@ void MatMulOp::BroadcastToMatrix(ov::Shape& shape) {
 void MatMulOp::Execute(const InferenceRequestContext& context,
                        Inputs inputs,
                        Outputs outputs,
-                       const Workbuffers&) const {
+                       const Workbuffers& workbuffers) const {
     Expects(inputs.size() == 2);
     Expects(outputs.size() == 1);
+    if (lt_enabled_ && !lt_bias_epilogue_) {
+        executeLt(context, inputs[0].get(), inputs[1].get(), outputs[0].get(), nullptr, workbuffers);
+        return;
+    }
     auto& cuBlasHandle = context.getThreadContext().cuBlasHandle();
     auto matrixA = inputs[0];
     auto matrixB = inputs[1];
@@ -4,9 +4,11 @@
 
 #pragma once
 
+#include <cuda/blas.hpp>
 #include <cuda/device_pointers.hpp>
 #include <cuda_operation_base.hpp>
 #include <ngraph/shape.hpp>
+#include <optional>
 #include <transformer/nodes/fully_connected.hpp>
 
 #include "cuda/constant_factory.hpp"
@@ -29,6 +31,24 @@ public:
 
     int GetBatchCount() const { return batch_count_; }
 
+    /**
+     * Returns true when the operation runs through cuBLASLt with the bias
+     * addition fused into the GEMM epilogue, so the caller must use
+     * ExecuteWithBias() instead of pre-filling the output with bias
+     */
+    bool HasBiasEpilogue() const { return lt_bias_epilogue_; }
+
+    /**
+     * Executes the cuBLASLt plan with the bias vector (inputs[2]) applied by
+     * the fused epilogue. Only valid when HasBiasEpilogue() returns true.
+     */
+    void ExecuteWithBias(const InferenceRequestContext& context,
+                         Inputs inputTensors,
+                         Outputs outputTensors,
+                         const Workbuffers& workbuffers) const;
+
+    WorkbufferRequest GetWorkBufferRequest() const override;
+
     /**
      * Get number of batches that equals to product between dimensions in range [matrixShape.begin(),
      * matrixShape.end()-2)
@@ -65,6 +85,19 @@ private:
     static void BroadcastShapes(
         ov::Shape& matrixAShape, bool& transposeA, ov::Shape& matrixBShape, bool& transposeB, ov::Shape& matrixCShape);
 
+    /**
+     * Builds the cuBLASLt descriptors and selects the best algorithm by
+     * heuristic search at load time. Falls back to the classic cuBLAS path
+     * when the shape/type combination is not supported by cuBLASLt.
+     */
+    void setupLtPlan(bool biasEpilogue);
+    void executeLt(const InferenceRequestContext& context,
+                   const void* matrixA,
+                   const void* matrixB,
+                   void* matrixC,
+                   const void* bias,
+                   const Workbuffers& workbuffers) const;
+
     cudaDataType_t data_type_ = cudaDataType_t::CUDA_R_32F;
     cudaDataType_t compute_type_ = cudaDataType_t::CUDA_R_32F;
     int m_ = 0;
@@ -80,6 +113,17 @@ private:
     const CUDA::constants::AnyNumeric* beta_ = nullptr;
     cublasOperation_t cublas_transpose_a_ = CUBLAS_OP_N;
     cublasOperation_t cublas_transpose_b_ = CUBLAS_OP_N;
+    // cuBLASLt plan; the descriptor is mutable because the bias pointer
+    // attribute is only known at execution time and cached between calls
+    mutable std::optional<CUDA::CuBlasLtMatmulDescriptor> lt_matmul_desc_;
+    std::optional<CUDA::CuBlasLtMatrixLayout> lt_layout_a_;
+    std::optional<CUDA::CuBlasLtMatrixLayout> lt_layout_b_;
+    std::optional<CUDA::CuBlasLtMatrixLayout> lt_layout_c_;
+    cublasLtMatmulAlgo_t lt_algo_{};
+    std::size_t lt_workspace_size_ = 0;
+    bool lt_enabled_ = false;
+    bool lt_bias_epilogue_ = false;
+    mutable const void* lt_bias_ptr_ = nullptr;
 };
 
 }  // namespace nvidia_gpu
@@ -8,15 +8,61 @@
 #include <gsl/gsl_assert>
 #include <openvino/op/max_pool.hpp>
 
+#include "converters.hpp"
+
 namespace ov {
 namespace nvidia_gpu {
 
+namespace {
+
+/** Square 2x2/3x3 windows over a 2D plane: the native kernel unrolls the
+ * window walk completely, which cuDNN's generic walker does not */
+bool isSmallWindowMaxPool(const ov::op::v1::MaxPool& node) {
+    const auto& input_shape = node.get_input_shape(0);
+    const auto& kernel = node.get_kernel();
+    if (input_shape.size() != 4 || kernel.size() != 2) {
+        return false;
+    }
+    if (kernel[0] != kernel[1] || (kernel[0] != 2 && kernel[0] != 3)) {
+        return false;
+    }
+    switch (static_cast<ov::element::Type_t>(node.get_element_type())) {
+        case ov::element::Type_t::f16:
+        case ov::element::Type_t::f32:
+        case ov::element::Type_t::f64:
+            return true;
+        default:
+            return false;
+    }
+}
+
+}  // namespace
+
 MaxPoolOp::MaxPoolOp(const CreationContext& context,
                      const std::shared_ptr<ov::Node>& node,
                      IndexCollection&& inputIds,
                      IndexCollection&& outputIds)
-    : OperationCuDnn(context, node, std::move(inputIds), std::move(outputIds)),
-      impl_{dynamic_cast<const ov::op::v1::MaxPool&>(*node)} {}
+    : OperationCuDnn(context, node, std::move(inputIds), std::move(outputIds)) {
+    const auto& max_pool = dynamic_cast<const ov::op::v1::MaxPool&>(*node);
+    if (isSmallWindowMaxPool(max_pool)) {
+        const auto& input_shape = max_pool.get_input_shape(0);
+        const auto& output_shape = max_pool.get_output_shape(0);
+        small_window_kernel_ = kernel::MaxPoolSmall{convertDataType<kernel::Type_t>(max_pool.get_element_type()),
+                                                    input_shape[0] * input_shape[1],
+                                                    input_shape[2],
+                                                    input_shape[3],
+                                                    output_shape[2],
+                                                    output_shape[3],
+                                                    max_pool.get_kernel()[0],
+                                                    max_pool.get_strides()[0],
+                                                    max_pool.get_strides()[1],
+                                                    max_pool.get_pads_begin()[0],
+                                                    max_pool.get_pads_begin()[1],
+                                                    static_cast<size_t>(context.device().props().maxThreadsPerBlock)};
+    } else {
+        impl_.emplace(max_pool);
+    }
+}
 
 void MaxPoolOp::Execute(const InferenceRequestContext& context,
                         Inputs inputs,
@@ -25,9 +71,15 @@ void MaxPoolOp::Execute(const InferenceRequestContext& context,
     Expects(inputs.size() == 1);
     Expects(outputs.size() == 1);
 
-    impl_.Execute(context.getThreadContext().dnnHandle(),
-                  inputs[PoolingImpl::input_index].get(),
-                  outputs[PoolingImpl::output_index].get());
+    if (small_window_kernel_) {
+        (*small_window_kernel_)(context.getThreadContext().stream().get(),
+                                inputs[PoolingImpl::input_index].get(),
+                                outputs[PoolingImpl::output_index].get());
+        return;
+    }
+    impl_->Execute(context.getThreadContext().dnnHandle(),
+                   inputs[PoolingImpl::input_index].get(),
+                   outputs[PoolingImpl::output_index].get());
 }
 
 OPERATION_REGISTER(MaxPoolOp, MaxPool);
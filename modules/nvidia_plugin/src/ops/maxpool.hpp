@@ -5,7 +5,9 @@
 #pragma once
 
 #include <cuda_operation_base.hpp>
+#include <optional>
 
+#include "kernels/pooling.hpp"
 #include "pooling_impl.hpp"
 
 namespace ov {
@@ -23,7 +25,10 @@ public:
                  const Workbuffers& workbuffers) const override;
 
 private:
-    PoolingImpl impl_;
+    // Native fully-unrolled kernel selected by shape for the 2x2/3x3 windows
+    // that dominate classifiers; every other shape keeps the cuDNN path
+    std::optional<kernel::MaxPoolSmall> small_window_kernel_;
+    std::optional<PoolingImpl> impl_;
 };
 
 }  // namespace nvidia_gpu
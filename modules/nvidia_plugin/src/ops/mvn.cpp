@@ -51,7 +51,39 @@ MvnOp::MvnOp(const CreationContext& context,
             size,
             convertDataType<ov::nvidia_gpu::kernel::Type_t>(node.get_input_element_type(0)),
             eps_mode_ == ov::op::MVNEpsMode::INSIDE_SQRT);
+
+        if (reducesOnlyTrailingAxes(shape_, reduced_shape_)) {
+            const size_t num_rows = shape_size(reduced_shape_);
+            const size_t row_size = shape_size(shape_) / num_rows;
+            if (row_size > 1) {
+                welford_mvn_kernel_ =
+                    kernel::WelfordMvn(convertDataType<ov::nvidia_gpu::kernel::Type_t>(node.get_input_element_type(0)),
+                                       num_rows,
+                                       row_size,
+                                       epsilon_,
+                                       eps_mode_ == ov::op::MVNEpsMode::INSIDE_SQRT,
+                                       normalize_variance_,
+                                       max_threads_per_block);
+            }
+        }
+    }
+}
+
+bool MvnOp::reducesOnlyTrailingAxes(const ngraph::Shape& shape, const ngraph::Shape& reduced_shape) {
+    // Axes of size 1 contribute nothing to either the row or the slice, so
+    // only non-trivial axes have to keep the non-reduced-then-reduced order
+    bool seen_reduced = false;
+    for (size_t i = 0; i < shape.size(); ++i) {
+        if (shape[i] == 1) {
+            continue;
+        }
+        if (reduced_shape[i] == 1) {
+            seen_reduced = true;
+        } else if (seen_reduced) {
+            return false;
+        }
     }
+    return true;
 }
 
 void MvnOp::Execute(const InferenceRequestContext& context,
@@ -65,6 +97,11 @@ void MvnOp::Execute(const InferenceRequestContext& context,
             {tensor_desc_, inputTensors[0]}, {tensor_desc_, inputTensors[0]}, {tensor_desc_, outputTensors[0]});
         return;
     }
+    if (welford_mvn_kernel_) {
+        (*welford_mvn_kernel_)(
+            context.getThreadContext().stream().get(), inputTensors[0].get(), outputTensors[0].get());
+        return;
+    }
     auto reducedTensor = getReducedTensorBuffer(workbuffers);
     opContext.reduceMean({tensor_desc_, inputTensors[0]}, {reduced_tensor_desc_, reducedTensor});
     opContext.subtract({tensor_desc_, inputTensors[0]},
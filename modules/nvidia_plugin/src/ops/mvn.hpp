@@ -8,6 +8,7 @@
 
 #include "converters.hpp"
 #include "kernels/variance_normalization_factor.hpp"
+#include "kernels/welford_mvn.hpp"
 #include "ngraph/op/mvn.hpp"
 #include "ngraph/shape.hpp"
 
@@ -54,6 +55,7 @@ private:
     };
 
     static MvnVersion validateAndGetVersion(const ov::Node& node);
+    static bool reducesOnlyTrailingAxes(const ngraph::Shape& shape, const ngraph::Shape& reduced_shape);
     size_t reduceWorkSpaceSizeCompute(const CreationContext& context);
     ngraph::Shape makeReducedShape(const ov::Node& node);
     CUDA::DnnTensorDescriptor makeReducedTensorDescriptor(const ov::Node& node);
@@ -85,12 +87,18 @@ private:
     CUDA::DnnTensorDescriptor reduced_tensor_desc_;
     size_t reduce_workspace_size_;
     std::optional<kernel::VarianceNormalizationFactor> variance_normalization_factor_kernel_;
+    // Single-pass path used when the reduction covers only trailing axes,
+    // so every reduced slice is contiguous in memory
+    std::optional<kernel::WelfordMvn> welford_mvn_kernel_;
     const void* dOne{&CUDA::NumericConst<CUDA::constants::one>(comp_type_)};
     const void* dMinusOne{&CUDA::NumericConst<CUDA::constants::minusOne>(comp_type_)};
     const void* dZero{&CUDA::NumericConst<CUDA::constants::zero>(comp_type_)};
 };
 
 inline WorkbufferRequest MvnOp::GetWorkBufferRequest() const {
+    if (welford_mvn_kernel_) {
+        return {};
+    }
     if (!reduced_shape_.empty()) {
         if (normalize_variance_) {
             return {{},
@@ -14,6 +14,7 @@ OPERATION_REGISTER(NopOp, Reshape);
 OPERATION_REGISTER(NopOp, Squeeze);
 OPERATION_REGISTER(NopOp, Unsqueeze);
 OPERATION_REGISTER(NopOp, ConcatOptimized);
+OPERATION_REGISTER(NopOp, SplitOptimized);
 
 }  // namespace nvidia_gpu
 }  // namespace ov
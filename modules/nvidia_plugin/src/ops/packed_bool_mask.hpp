@@ -0,0 +1,54 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ngraph/node.hpp>
+#include <openvino/op/greater.hpp>
+#include <openvino/op/less.hpp>
+#include <openvino/op/select.hpp>
+
+namespace ov {
+namespace nvidia_gpu {
+
+/// Boolean masks shorter than one word are not worth packing, and the packed
+/// form must fit into the byte-per-element buffer the memory model allocates
+inline constexpr std::size_t kMinPackedBoolMaskElements = 32;
+
+/**
+ * Producer/consumer handshake for the packed boolean mask representation:
+ * a comparison writes 32 results per 32-bit word (bit i of word w is element
+ * w * 32 + i) instead of one byte per element, and Select reads the bits back,
+ * cutting the mask traffic eightfold.
+ *
+ * Both the producing comparison operation and every consuming Select evaluate
+ * this predicate on the same ov graph, so they agree on the representation
+ * without any shared state. Packing is only legal when the mask never leaves
+ * the producer/consumer pair: every reader of the comparison output must be
+ * the condition input of a Select.
+ */
+inline bool packedBoolMaskAgreed(const ov::Node& producer) {
+    if (!ov::is_type<const ov::op::v1::Greater>(&producer) && !ov::is_type<const ov::op::v1::Less>(&producer)) {
+        return false;
+    }
+    if (producer.get_output_size() != 1 || producer.get_output_partial_shape(0).is_dynamic()) {
+        return false;
+    }
+    if (ov::shape_size(producer.get_output_shape(0)) < kMinPackedBoolMaskElements) {
+        return false;
+    }
+    const auto targets = producer.get_output_target_inputs(0);
+    if (targets.empty()) {
+        return false;
+    }
+    for (const auto& target : targets) {
+        if (!ov::is_type<const ov::op::v1::Select>(target.get_node()) || target.get_index() != 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+}  // namespace nvidia_gpu
+}  // namespace ov
@@ -6,6 +6,7 @@
 
 #include <cuda_runtime.h>
 
+#include <cuda/event.hpp>
 #include <cuda_operation_registry.hpp>
 #include <gsl/gsl_assert>
 #include <ngraph/node.hpp>
@@ -19,6 +20,22 @@ ParameterOp::ParameterOp(const CreationContext& context,
                          IndexCollection&& outputIds)
     : OperationBase(context, node, std::move(inputIds), std::move(outputIds)) {
     input_tensor_name_ = GetInputTensorName(node);
+    if (node.get_output_partial_shape(0).is_static()) {
+        const auto& shape = node.get_output_shape(0);
+        if (!shape.empty() && shape[0] > 0) {
+            batch_extent_ = shape[0];
+        }
+    }
+}
+
+std::size_t ParameterOp::transferSize(const InferenceRequestContext& context, std::size_t full_size) const noexcept {
+    const auto batch = context.getBatchSize();
+    // Only tensors whose leading dimension is the network batch are trimmed; the first
+    // batch samples form a contiguous prefix because the batch is the outermost dimension
+    if (batch != 0 && batch_extent_ == context.maxBatchSize() && batch < batch_extent_) {
+        return full_size / batch_extent_ * batch;
+    }
+    return full_size;
 }
 
 void ParameterOp::Execute(const InferenceRequestContext& context,
@@ -30,7 +47,26 @@ void ParameterOp::Execute(const InferenceRequestContext& context,
     Expects(context.HasInputBlob(input_tensor_name_));
     auto blob = context.GetInputBlob(input_tensor_name_);
     auto memory_ptr = std::static_pointer_cast<ngraph::HostTensor>(blob)->get_data_ptr();
-    context.getThreadContext().stream().upload(outputs[0], memory_ptr, blob->get_size_in_bytes());
+    const auto& threadContext = context.getThreadContext();
+    const auto& stream = threadContext.stream();
+    const auto transfer_bytes = transferSize(context, blob->get_size_in_bytes());
+    if (context.IsInputOnDevice(input_tensor_name_)) {
+        // The blob wraps a device pointer (remote blob): a device-to-device copy on the
+        // compute stream replaces the host upload
+        stream.transfer(outputs[0], CUDA::DevicePointer<const void*>{memory_ptr}, transfer_bytes);
+        return;
+    }
+    if (stream.isCapturing()) {
+        // Cross-stream events cannot be recorded into a CUDA graph capture; the full
+        // blob is uploaded because the captured graph replays with any runtime batch
+        stream.upload(outputs[0], memory_ptr, blob->get_size_in_bytes());
+        return;
+    }
+    // Upload on the dedicated transfer stream so the copy overlaps compute of other
+    // requests; the compute stream waits for the copy via an event dependency
+    const auto& uploadStream = threadContext.uploadStream();
+    uploadStream.upload(outputs[0], memory_ptr, transfer_bytes);
+    CUDA::Event{}.record(uploadStream).wait(stream);
 }
 
 std::string ParameterOp::GetInputTensorName(const ov::Node& node) { return node.get_friendly_name(); }
@@ -23,7 +23,13 @@ public:
     static std::string GetInputTensorName(const ov::Node& node);
 
 private:
+    /** Bytes to upload for the runtime batch of @p context; the full blob unless dynamic batch trims it */
+    std::size_t transferSize(const InferenceRequestContext& context, std::size_t full_size) const noexcept;
+
     std::string input_tensor_name_;
+    // Leading dimension of the parameter; 0 when there is no leading dimension
+    // to trim under dynamic batch
+    std::size_t batch_extent_{0};
 };
 
 }  // namespace nvidia_gpu
@@ -4,11 +4,61 @@
 
 #include "power.hpp"
 
+#include <algorithm>
 #include <cuda_operation_registry.hpp>
+#include <openvino/op/constant.hpp>
 
 namespace ov {
 namespace nvidia_gpu {
 
+namespace {
+
+/**
+ * Maps a constant exponent to the specialized kernel mode; any non-constant,
+ * non-uniform or uncommon exponent keeps the generic pow() path. sqrt and
+ * reciprocal are only selected for floating-point tensors, where they are
+ * exact; 1 and 2 are exact for every element type.
+ */
+kernel::Power::Mode powerMode(const ov::op::v1::Power& node) {
+    const auto* constant = dynamic_cast<const ov::op::v0::Constant*>(node.get_input_node_ptr(1));
+    if (!constant) {
+        return kernel::Power::Mode::kGeneric;
+    }
+    const auto exponents = constant->cast_vector<double>();
+    if (exponents.empty() ||
+        !std::all_of(exponents.begin(), exponents.end(), [&](double e) { return e == exponents.front(); })) {
+        return kernel::Power::Mode::kGeneric;
+    }
+    const double exponent = exponents.front();
+    const bool is_float = node.get_output_element_type(0).is_real();
+    if (exponent == 1.0) {
+        return kernel::Power::Mode::kIdentity;
+    } else if (exponent == 2.0) {
+        return kernel::Power::Mode::kSquare;
+    } else if (exponent == 0.5 && is_float) {
+        return kernel::Power::Mode::kSqrt;
+    } else if (exponent == -1.0 && is_float) {
+        return kernel::Power::Mode::kReciprocal;
+    }
+    return kernel::Power::Mode::kGeneric;
+}
+
+}  // namespace
+
+PowerOp::PowerOp(const CreationContext& context,
+                 const NodeOp& node,
+                 IndexCollection&& inputIds,
+                 IndexCollection&& outputIds)
+    : ElementwiseBinaryOp{context, node, std::move(inputIds), std::move(outputIds)} {
+    const auto mode = powerMode(node);
+    if (mode != kernel::Power::Mode::kGeneric) {
+        kernel_.emplace(convertDataType<ov::nvidia_gpu::kernel::Type_t>(node.get_output_element_type(0)),
+                        ngraph::shape_size(node.get_output_shape(0)),
+                        static_cast<size_t>(context.device().props().maxThreadsPerBlock),
+                        mode);
+    }
+}
+
 OPERATION_REGISTER(PowerOp, Power)
 
 }  // namespace nvidia_gpu
@@ -14,7 +14,10 @@ namespace nvidia_gpu {
 
 class PowerOp : public ElementwiseBinaryOp<ov::op::v1::Power, kernel::Power> {
 public:
-    using ElementwiseBinaryOp::ElementwiseBinaryOp;
+    PowerOp(const CreationContext& context,
+            const NodeOp& node,
+            IndexCollection&& inputIds,
+            IndexCollection&& outputIds);
 };
 
 }  // namespace nvidia_gpu
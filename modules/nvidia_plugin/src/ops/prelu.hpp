@@ -15,7 +15,19 @@ namespace nvidia_gpu {
 
 class PReluOp : public ElementwiseBinaryOp<ov::op::v0::PRelu, kernel::PRelu> {
 public:
-    using ElementwiseBinaryOp::ElementwiseBinaryOp;
+    PReluOp(const CreationContext& context,
+            const NodeOp& node,
+            IndexCollection&& inputIds,
+            IndexCollection&& outputIds)
+        : ElementwiseBinaryOp{context, node, move(inputIds), move(outputIds)} {
+        // Re-create the kernel with the operand sizes so the per-channel
+        // slopes qualify for the shared-memory parameter cache
+        kernel_ = kernel::PRelu{convertDataType<kernel::Type_t>(node.get_output_element_type(0)),
+                                ngraph::shape_size(node.get_output_shape(0)),
+                                static_cast<size_t>(context.device().props().maxThreadsPerBlock),
+                                ngraph::shape_size(node.get_input_shape(0)),
+                                ngraph::shape_size(node.get_input_shape(1))};
+    }
 };
 
 }  // namespace nvidia_gpu
@@ -0,0 +1,127 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "quantized_matmul.hpp"
+
+#include <cstdint>
+#include <cuda_operation_registry.hpp>
+#include <gsl/gsl_assert>
+#include <numeric>
+
+namespace ov {
+namespace nvidia_gpu {
+
+namespace {
+
+constexpr const char* kEntryName = "quantize_i8";
+
+// Symmetric fp32 -> int8 quantization with round-to-nearest and saturation
+constexpr const char* kQuantizeSource = R"(
+extern "C" __global__ void quantize_i8(const float* __restrict__ in,
+                                       signed char* __restrict__ out,
+                                       float inv_scale,
+                                       unsigned long long num_elements) {
+  const unsigned long long i = blockIdx.x * static_cast<unsigned long long>(blockDim.x) + threadIdx.x;
+  if (i < num_elements) {
+    const float v = fminf(fmaxf(rintf(in[i] * inv_scale), -127.0f), 127.0f);
+    out[i] = static_cast<signed char>(v);
+  }
+}
+)";
+
+}  // namespace
+
+QuantizedMatMulOp::QuantizedMatMulOp(const CreationContext& context,
+                                     const NodeOp& node,
+                                     IndexCollection&& inputIds,
+                                     IndexCollection&& outputIds)
+    : OperationCuBlas(context, node, std::move(inputIds), std::move(outputIds)) {
+    Expects(node.get_input_size() == 2);
+    Expects(node.get_output_size() == 1);
+    const auto aShape = node.get_input_shape(0);
+    const auto bShape = node.get_input_shape(1);
+    Expects(aShape.size() >= 2);
+    Expects(bShape.size() == 2);
+    const bool transposeB = node.get_transpose_b();
+    m_ = *(aShape.end() - 2);
+    k_ = aShape.back();
+    n_ = transposeB ? bShape[0] : bShape[1];
+    ld_a_ = aShape.back();
+    ld_b_ = bShape.back();
+    ld_c_ = n_;
+    batch_count_ = std::accumulate(aShape.begin(), aShape.end() - 2, 1, std::multiplies<size_t>());
+    stride_a_ = m_ * k_;
+    stride_c_ = m_ * n_;
+    cublas_transpose_b_ = transposeB ? CUBLAS_OP_T : CUBLAS_OP_N;
+    input_inv_scale_ = 1.0f / node.get_input_scale();
+    dequant_scale_ = node.get_dequant_scale();
+    num_a_elements_ = ov::shape_size(aShape);
+
+    const auto maxThreadsPerBlock = static_cast<unsigned>(context.device().props().maxThreadsPerBlock);
+    block_dim_ = std::min(maxThreadsPerBlock, 256u);
+    grid_dim_ = static_cast<unsigned>((num_a_elements_ + block_dim_ - 1) / block_dim_);
+
+    quantize_kernel_.emplace(kQuantizeSource, kEntryName, context.device());
+
+    Ensures(m_ != 0);
+    Ensures(k_ != 0);
+    Ensures(n_ != 0);
+    Ensures(batch_count_ != 0);
+}
+
+WorkbufferRequest QuantizedMatMulOp::GetWorkBufferRequest() const {
+    return {{}, {num_a_elements_ * sizeof(std::int8_t)}};
+}
+
+void QuantizedMatMulOp::Execute(const InferenceRequestContext& context,
+                                Inputs inputs,
+                                Outputs outputs,
+                                const Workbuffers& workbuffers) const {
+    Expects(quantize_kernel_);
+    Expects(inputs.size() == 2);
+    Expects(outputs.size() == 1);
+    Expects(workbuffers.mutable_buffers.size() == 1);
+
+    const auto& stream = context.getThreadContext().stream();
+    auto quantizedA = workbuffers.mutable_buffers.at(0);
+
+    const void* activation = inputs[0].get();
+    void* staging = quantizedA.get();
+    float invScale = input_inv_scale_;
+    auto numElements = num_a_elements_;
+    void* args[] = {&activation, &staging, &invScale, &numElements};
+    quantize_kernel_->launch(stream, grid_dim_, block_dim_, args);
+
+    // Same Ct = Bt x At trick as MatMulOp to get a row-major output; alpha
+    // carries the combined activation and weight dequantization scale
+    const float beta = 0.0f;
+    auto& cuBlasHandle = context.getThreadContext().cuBlasHandle();
+    throwIfError(cublasGemmStridedBatchedEx(cuBlasHandle.get(),
+                                            cublas_transpose_b_,
+                                            CUBLAS_OP_N,
+                                            n_,
+                                            m_,
+                                            k_,
+                                            &dequant_scale_,
+                                            inputs[1].get(),
+                                            CUDA_R_8I,
+                                            ld_b_,
+                                            0,
+                                            quantizedA.get(),
+                                            CUDA_R_8I,
+                                            ld_a_,
+                                            stride_a_,
+                                            &beta,
+                                            outputs[0].get(),
+                                            CUDA_R_32F,
+                                            ld_c_,
+                                            stride_c_,
+                                            batch_count_,
+                                            CUDA_R_32F,
+                                            CUBLAS_GEMM_DEFAULT));
+}
+
+OPERATION_REGISTER(QuantizedMatMulOp, QuantizedMatMul);
+}  // namespace nvidia_gpu
+}  // namespace ov
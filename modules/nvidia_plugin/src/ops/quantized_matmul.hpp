@@ -0,0 +1,60 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cuda/blas.hpp>
+#include <cuda/nvrtc.hpp>
+#include <cuda_operation_base.hpp>
+#include <optional>
+#include <transformer/nodes/quantized_matmul.hpp>
+
+namespace ov {
+namespace nvidia_gpu {
+
+/**
+ * @brief Runs a MatMul in int8 with fp32 inputs and outputs.
+ *
+ * The fp32 activation is quantized into an int8 staging workbuffer by a small
+ * NVRTC kernel, the GEMM itself multiplies int8 activation by the offline
+ * quantized int8 weight constant, and the combined dequantization scale is
+ * applied as the GEMM alpha, so no separate dequantization kernel is needed.
+ */
+class QuantizedMatMulOp : public OperationCuBlas {
+public:
+    using NodeOp = nodes::QuantizedMatMul;
+
+    QuantizedMatMulOp(const CreationContext& context,
+                      const NodeOp& node,
+                      IndexCollection&& inputIds,
+                      IndexCollection&& outputIds);
+
+    void Execute(const InferenceRequestContext& context,
+                 Inputs inputTensors,
+                 Outputs outputTensors,
+                 const Workbuffers& workbuffers) const override;
+
+    WorkbufferRequest GetWorkBufferRequest() const override;
+
+private:
+    std::optional<CUDA::JitKernel> quantize_kernel_;
+    unsigned long long num_a_elements_ = 0;
+    unsigned grid_dim_ = 0;
+    unsigned block_dim_ = 0;
+    float input_inv_scale_ = 1.0f;
+    float dequant_scale_ = 1.0f;
+    int m_ = 0;
+    int k_ = 0;
+    int n_ = 0;
+    int ld_a_ = 0;
+    int ld_b_ = 0;
+    int ld_c_ = 0;
+    long long stride_a_ = 0;
+    long long stride_c_ = 0;
+    int batch_count_ = 0;
+    cublasOperation_t cublas_transpose_b_ = CUBLAS_OP_N;
+};
+
+}  // namespace nvidia_gpu
+}  // namespace ov
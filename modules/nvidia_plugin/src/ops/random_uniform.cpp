@@ -0,0 +1,58 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "random_uniform.hpp"
+
+#include <cuda_operation_registry.hpp>
+#include <gsl/gsl_assert>
+#include <random>
+
+#include "converters.hpp"
+
+namespace ov {
+namespace nvidia_gpu {
+
+RandomUniformOp::RandomUniformOp(const CreationContext& context,
+                                 const NodeOp& node,
+                                 IndexCollection&& inputIds,
+                                 IndexCollection&& outputIds)
+    : OperationBase(context, node, std::move(inputIds), std::move(outputIds)) {
+    Expects(node.get_input_size() == 3);
+    Expects(node.get_output_size() == 1);
+    Expects(node.get_output_partial_shape(0).is_static());
+    auto global_seed = node.get_global_seed();
+    auto op_seed = node.get_op_seed();
+    if (global_seed == 0 && op_seed == 0) {
+        // Unseeded per the spec means nondeterministic: fix a key at load so
+        // the generator stays a pure counter function afterwards
+        std::random_device entropy;
+        global_seed = (static_cast<std::uint64_t>(entropy()) << 32) | entropy();
+        op_seed = (static_cast<std::uint64_t>(entropy()) << 32) | entropy();
+    }
+    kernel_ = kernel::RandomUniform{convertDataType<kernel::Type_t>(node.get_out_type()),
+                                    ov::shape_size(node.get_output_shape(0)),
+                                    static_cast<size_t>(context.device().props().maxThreadsPerBlock),
+                                    global_seed,
+                                    op_seed};
+}
+
+void RandomUniformOp::Execute(const InferenceRequestContext& context,
+                              Inputs inputs,
+                              Outputs outputs,
+                              const Workbuffers&) const {
+    Expects(inputs.size() == 3);
+    Expects(outputs.size() == 1);
+    // A fresh per-request sequence number per execution: concurrent requests
+    // and repeated stochastic passes each draw an independent Philox stream
+    (*kernel_)(context.getThreadContext().stream().get(),
+               context.nextRandomSequence(),
+               inputs[1].get(),
+               inputs[2].get(),
+               outputs[0].get());
+}
+
+OPERATION_REGISTER(RandomUniformOp, RandomUniform);
+
+}  // namespace nvidia_gpu
+}  // namespace ov
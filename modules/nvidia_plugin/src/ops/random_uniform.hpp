@@ -0,0 +1,33 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cuda_operation_base.hpp>
+#include <optional>
+#include <openvino/op/random_uniform.hpp>
+
+#include "kernels/random_uniform.hpp"
+
+namespace ov {
+namespace nvidia_gpu {
+
+class RandomUniformOp : public OperationBase {
+public:
+    using NodeOp = ov::op::v8::RandomUniform;
+    RandomUniformOp(const CreationContext& context,
+                    const NodeOp& node,
+                    IndexCollection&& inputIds,
+                    IndexCollection&& outputIds);
+    void Execute(const InferenceRequestContext& context,
+                 Inputs inputTensors,
+                 Outputs outputTensors,
+                 const Workbuffers& workbuffers) const override;
+
+private:
+    std::optional<kernel::RandomUniform> kernel_;
+};
+
+}  // namespace nvidia_gpu
+}  // namespace ov
@@ -0,0 +1,215 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "reduce.hpp"
+
+#include <fmt/format.h>
+
+#include <cuda/descriptor_utils.hpp>
+#include <cuda_operation_registry.hpp>
+#include <gsl/gsl_assert>
+#include <openvino/op/constant.hpp>
+#include <sstream>
+
+#include "converters.hpp"
+
+namespace ov {
+namespace nvidia_gpu {
+
+namespace {
+
+/**
+ * Checks whether every output element of the reduction covers a run of consecutive
+ * input elements, and if so computes the segment layout for the CUB backend.
+ * That is the case when every reduced axis of extent > 1 lies inner to every kept
+ * axis of extent > 1; axes of extent 1 never affect the memory layout.
+ */
+bool segmentedLayout(const ov::Node& node, size_t& num_segments, size_t& segment_size) {
+    if (node.get_input_partial_shape(0).is_dynamic()) {
+        return false;
+    }
+    const auto axes_constant = dynamic_cast<ov::op::v0::Constant*>(node.get_input_node_ptr(1));
+    if (!axes_constant) {
+        return false;
+    }
+    const auto& shape = node.get_input_shape(0);
+    const auto rank = static_cast<int64_t>(shape.size());
+    std::vector<bool> reduced(shape.size(), false);
+    for (auto axis : axes_constant->cast_vector<int64_t>()) {
+        if (axis < 0) {
+            axis += rank;
+        }
+        if (axis < 0 || axis >= rank) {
+            return false;
+        }
+        reduced.at(axis) = true;
+    }
+    bool seen_reduced = false;
+    segment_size = 1;
+    for (size_t dim = 0; dim < shape.size(); ++dim) {
+        if (reduced[dim]) {
+            segment_size *= shape[dim];
+            if (shape[dim] > 1) {
+                seen_reduced = true;
+            }
+        } else if (shape[dim] > 1 && seen_reduced) {
+            return false;
+        }
+    }
+    if (segment_size == 0) {
+        return false;
+    }
+    num_segments = ov::shape_size(shape) / segment_size;
+    return true;
+}
+
+bool isCubViable(const ov::Node& node, kernel::SegmentedReduce::Mode mode) {
+    size_t num_segments{};
+    size_t segment_size{};
+    return node.get_input_element_type(0) == node.get_output_element_type(0) &&
+           kernel::SegmentedReduce::isSupportedElementType(
+               convertDataType<ov::nvidia_gpu::kernel::Type_t>(node.get_input_element_type(0)), mode) &&
+           segmentedLayout(node, num_segments, segment_size);
+}
+
+template <typename TDnnDescriptor>
+OperationBase::Ptr reduceFactory(kernel::SegmentedReduce::Mode mode,
+                                 const CreationContext& context,
+                                 const std::shared_ptr<ov::Node>& node,
+                                 OperationBase::IndexCollection&& inputIds,
+                                 OperationBase::IndexCollection&& outputIds) {
+    using IndexCollection = OperationBase::IndexCollection;
+    std::stringstream exception_msg;
+    try {
+        if (isCubViable(*node, mode)) {
+            return std::make_shared<ReduceCubOp>(
+                context, *node, IndexCollection{inputIds}, IndexCollection{outputIds}, mode);
+        }
+        exception_msg << "\nReduceCubOp skipped: reduced axes are not innermost or the element type is unsupported";
+    } catch (const std::exception& e) {
+        exception_msg << "\nFailed to create ReduceCubOp impl: " << e.what();
+    }
+    try {
+        return std::make_shared<ReduceOp>(context,
+                                          *node,
+                                          IndexCollection{inputIds},
+                                          IndexCollection{outputIds},
+                                          TDnnDescriptor{reduceCompType(*node)});
+    } catch (const std::exception& e) {
+        exception_msg << "\nFailed to create ReduceOp impl: " << e.what();
+    }
+    throwIEException(fmt::format("{} node is not supported:{}", node->get_type_name(), exception_msg.str()));
+}
+
+}  // namespace
+
+ReduceOp::ReduceOp(const CreationContext& context,
+                   const ov::Node& node,
+                   IndexCollection&& inputIds,
+                   IndexCollection&& outputIds,
+                   CUDA::DnnReduceTensorDescriptor desc)
+    : OperationCuDnn{context, node, move(inputIds), move(outputIds)},
+      comp_type_{reduceCompType(node)},
+      desc_{std::move(desc)},
+      a_desc_{CUDA::makeInputDnnTensorDescr(node, 0)},
+      c_desc_{CUDA::makeOutputDnnTensorDescr(node, 0)},
+      workspace_size_{context.dnnHandle().getReductionWorkspaceSize(desc_, a_desc_, c_desc_)} {}
+
+void ReduceOp::Execute(const InferenceRequestContext& context,
+                       Inputs inputTensors,
+                       Outputs outputTensors,
+                       const Workbuffers& workbuffers) const {
+    context.getThreadContext().dnnHandle().reduceTensor(desc_,
+                                                        workbuffers.createMutableSpanFrom<0>(workspace_size_),
+                                                        CUDA::DnnScaleFactorOne{comp_type_},
+                                                        a_desc_,
+                                                        inputTensors[0],
+                                                        CUDA::DnnScaleFactorZero{comp_type_},
+                                                        c_desc_,
+                                                        outputTensors[0]);
+}
+
+ReduceCubOp::ReduceCubOp(const CreationContext& context,
+                         const ov::Node& node,
+                         IndexCollection&& inputIds,
+                         IndexCollection&& outputIds,
+                         kernel::SegmentedReduce::Mode mode)
+    : OperationBase{context, node, move(inputIds), move(outputIds)} {
+    size_t num_segments{};
+    size_t segment_size{};
+    Expects(segmentedLayout(node, num_segments, segment_size));
+    Expects(node.get_input_element_type(0) == node.get_output_element_type(0));
+    Expects(ov::shape_size(node.get_output_shape(0)) == num_segments);
+    kernel_.emplace(convertDataType<ov::nvidia_gpu::kernel::Type_t>(node.get_input_element_type(0)),
+                    mode,
+                    num_segments,
+                    segment_size);
+    workspace_size_ = kernel_->workspaceSize();
+}
+
+void ReduceCubOp::Execute(const InferenceRequestContext& context,
+                          Inputs inputTensors,
+                          Outputs outputTensors,
+                          const Workbuffers& workbuffers) const {
+    Expects(kernel_);
+    Expects(inputTensors.size() == 2);
+    Expects(outputTensors.size() == 1);
+    Expects(workbuffers.mutable_buffers.size() == 1);
+    auto& stream = context.getThreadContext().stream();
+    (*kernel_)(stream.get(),
+               static_cast<const void*>(inputTensors[0].get()),
+               static_cast<void*>(outputTensors[0].get()),
+               static_cast<void*>(workbuffers.mutable_buffers[0].get()));
+}
+
+WorkbufferRequest ReduceCubOp::GetWorkBufferRequest() const { return {{}, {workspace_size_}}; }
+
+static OperationBase::Ptr reduceMaxFactory(const CreationContext& context,
+                                           const std::shared_ptr<ov::Node>& node,
+                                           OperationBase::IndexCollection&& inputIds,
+                                           OperationBase::IndexCollection&& outputIds) {
+    return reduceFactory<CUDA::DnnReduceMaxDescriptor>(
+        kernel::SegmentedReduce::Mode::Max, context, node, move(inputIds), move(outputIds));
+}
+
+static OperationBase::Ptr reduceMinFactory(const CreationContext& context,
+                                           const std::shared_ptr<ov::Node>& node,
+                                           OperationBase::IndexCollection&& inputIds,
+                                           OperationBase::IndexCollection&& outputIds) {
+    return reduceFactory<CUDA::DnnReduceMinDescriptor>(
+        kernel::SegmentedReduce::Mode::Min, context, node, move(inputIds), move(outputIds));
+}
+
+static OperationBase::Ptr reduceMeanFactory(const CreationContext& context,
+                                            const std::shared_ptr<ov::Node>& node,
+                                            OperationBase::IndexCollection&& inputIds,
+                                            OperationBase::IndexCollection&& outputIds) {
+    return reduceFactory<CUDA::DnnReduceAvgDescriptor>(
+        kernel::SegmentedReduce::Mode::Mean, context, node, move(inputIds), move(outputIds));
+}
+
+static OperationBase::Ptr reduceProdFactory(const CreationContext& context,
+                                            const std::shared_ptr<ov::Node>& node,
+                                            OperationBase::IndexCollection&& inputIds,
+                                            OperationBase::IndexCollection&& outputIds) {
+    return reduceFactory<CUDA::DnnReduceMulDescriptor>(
+        kernel::SegmentedReduce::Mode::Prod, context, node, move(inputIds), move(outputIds));
+}
+
+static OperationBase::Ptr reduceL2Factory(const CreationContext& context,
+                                          const std::shared_ptr<ov::Node>& node,
+                                          OperationBase::IndexCollection&& inputIds,
+                                          OperationBase::IndexCollection&& outputIds) {
+    return reduceFactory<CUDA::DnnReduceNorm2Descriptor>(
+        kernel::SegmentedReduce::Mode::L2, context, node, move(inputIds), move(outputIds));
+}
+
+OPERATION_REGISTER_FACTORY(reduceMaxFactory, ReduceMax);
+OPERATION_REGISTER_FACTORY(reduceMinFactory, ReduceMin);
+OPERATION_REGISTER_FACTORY(reduceMeanFactory, ReduceMean);
+OPERATION_REGISTER_FACTORY(reduceProdFactory, ReduceProd);
+OPERATION_REGISTER_FACTORY(reduceL2Factory, ReduceL2);
+
+}  // namespace nvidia_gpu
+}  // namespace ov
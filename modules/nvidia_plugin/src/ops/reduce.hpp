@@ -0,0 +1,75 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cuda_operation_base.hpp>
+#include <kernels/reduce.hpp>
+#include <optional>
+
+namespace ov {
+namespace nvidia_gpu {
+
+/** Picks the cuDNN compute type for a reduction over the node's input; defined in reduce_sum.cpp */
+cudnnDataType_t reduceCompType(const ov::Node& node);
+
+/**
+ * Generic cuDNN reduction. The reduction kind is fixed by the descriptor the
+ * factory passes in, everything else matches ReduceSumOp.
+ */
+class ReduceOp : public OperationCuDnn {
+public:
+    ReduceOp(const CreationContext& context,
+             const ov::Node& node,
+             IndexCollection&& inputIds,
+             IndexCollection&& outputIds,
+             CUDA::DnnReduceTensorDescriptor desc);
+
+    void Execute(const InferenceRequestContext& context,
+                 Inputs inputTensors,
+                 Outputs outputTensors,
+                 const Workbuffers& workbuffers) const override;
+
+    WorkbufferRequest GetWorkBufferRequest() const override;
+
+private:
+    cudnnDataType_t comp_type_;
+    CUDA::DnnReduceTensorDescriptor desc_;
+    CUDA::DnnTensorDescriptor a_desc_;
+    CUDA::DnnTensorDescriptor c_desc_;
+    size_t workspace_size_;
+};
+
+inline WorkbufferRequest ReduceOp::GetWorkBufferRequest() const {
+    return {{}, {workspace_size_}};  // TODO: find a way to allocate buffers from constructor
+}
+
+/**
+ * CUB backend for reductions whose reduced axes form the innermost contiguous
+ * block of the (static) input shape, so every output element is a segmented
+ * reduction over consecutive input elements. The factory falls back to the
+ * cuDNN implementation for every other axis layout.
+ */
+class ReduceCubOp : public OperationBase {
+public:
+    ReduceCubOp(const CreationContext& context,
+                const ov::Node& node,
+                IndexCollection&& inputIds,
+                IndexCollection&& outputIds,
+                kernel::SegmentedReduce::Mode mode);
+
+    void Execute(const InferenceRequestContext& context,
+                 Inputs inputTensors,
+                 Outputs outputTensors,
+                 const Workbuffers& workbuffers) const override;
+
+    WorkbufferRequest GetWorkBufferRequest() const override;
+
+private:
+    std::optional<kernel::SegmentedReduce> kernel_;
+    size_t workspace_size_{};
+};
+
+}  // namespace nvidia_gpu
+}  // namespace ov
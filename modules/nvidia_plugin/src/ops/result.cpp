@@ -6,6 +6,7 @@
 
 #include <cuda_runtime.h>
 
+#include <algorithm>
 #include <cuda_operation_registry.hpp>
 #include <exec_graph_info.hpp>
 #include <gsl/gsl_assert>
@@ -14,6 +15,10 @@
 #include <transformer/cuda_rt_info.hpp>
 #include <utility>
 
+#include <kernels/convert.hpp>
+
+#include "converters.hpp"
+#include "cuda/event.hpp"
 #include "nop_op.hpp"
 #include "transformations/utils/utils.hpp"
 
@@ -26,24 +31,103 @@ ResultOp::ResultOp(const CreationContext& context,
                    IndexCollection&& outputIds)
     : OperationBase(context, node, std::move(inputIds), std::move(outputIds)) {
     output_tensor_names_ = GetOutputTensorName(node);
+    input_element_type_ = node.get_input_element_type(0);
+    if (node.get_input_partial_shape(0).is_static()) {
+        const auto& input_shape = node.get_input_shape(0);
+        if (!input_shape.empty() && input_shape[0] > 0) {
+            batch_extent_ = input_shape[0];
+        }
+        num_elements_ = ov::shape_size(node.get_input_shape(0));
+        input_size_bytes_ = num_elements_ * input_element_type_.size();
+        const auto max_block_size = static_cast<size_t>(context.device().props().maxThreadsPerBlock);
+        num_blocks_ =
+            (num_elements_ % max_block_size == 0) ? num_elements_ / max_block_size : num_elements_ / max_block_size + 1;
+        threads_per_block_ = (num_blocks_ == 1) ? num_elements_ : max_block_size;
+    }
 }
 
 void ResultOp::Execute(const InferenceRequestContext& context,
                        Inputs inputs,
                        Outputs outputs,
-                       const Workbuffers&) const {
+                       const Workbuffers& workbuffers) const {
     Expects(inputs.size() == 1);
     Expects(outputs.size() == 0);
     std::shared_ptr<ngraph::runtime::Tensor> blob;
+    std::string blobName;
     for (const auto& outputName : output_tensor_names_) {
         if (context.HasOutputBlob(outputName)) {
             blob = context.GetOutputBlob(outputName);
+            blobName = outputName;
             break;
         }
     }
     Expects(blob != nullptr);
     auto memory_ptr = std::static_pointer_cast<ngraph::HostTensor>(blob)->get_data_ptr();
-    context.getThreadContext().stream().download(memory_ptr, inputs[0], blob->get_size_in_bytes());
+    const auto& threadContext = context.getThreadContext();
+    const auto& stream = threadContext.stream();
+    const auto transfer_bytes = transferSize(context, blob->get_size_in_bytes());
+    if (std::any_of(output_tensor_names_.begin(), output_tensor_names_.end(), [&context](const auto& name) {
+            return context.IsOutputOnDevice(name);
+        })) {
+        // The blob wraps a device pointer (remote blob): a device-to-device copy on the
+        // compute stream replaces the host download
+        stream.transfer(CUDA::DevicePointer<void*>{memory_ptr}, inputs[0], transfer_bytes);
+        return;
+    }
+    auto download_src = inputs[0];
+    if (blob->get_element_type() != input_element_type_ && num_elements_ > 0) {
+        // The infer request wrapped the user blob, so convert to its precision on the
+        // compute stream and download the converted data. Only the target type varies
+        // per request, hence kernel::Convert is instantiated here
+        Expects(!workbuffers.mutable_buffers.empty());
+        const kernel::Convert convert{
+            convertDataType<ov::nvidia_gpu::kernel::Type_t>(blob->get_element_type()),
+            convertDataType<ov::nvidia_gpu::kernel::Type_t>(input_element_type_),
+            num_elements_,
+            num_blocks_,
+            threads_per_block_};
+        convert(stream.get(), workbuffers.mutable_buffers[0].get(), inputs[0].get());
+        download_src = CUDA::DevicePointer<const void*>{workbuffers.mutable_buffers[0].get()};
+    }
+    if (stream.isCapturing()) {
+        // Cross-stream events cannot be recorded into a CUDA graph capture; the full
+        // blob is downloaded because the captured graph replays with any runtime batch
+        stream.download(memory_ptr, download_src, blob->get_size_in_bytes());
+        return;
+    }
+    // An output ROI registered on the request trims the download to the leading
+    // slice the caller actually reads (e.g. top-1 scores); the slice is contiguous
+    // because it is a prefix of the row-major tensor
+    auto download_bytes = transfer_bytes;
+    const auto roi_elements = context.outputROIElements(blobName);
+    if (roi_elements != 0) {
+        download_bytes = std::min(download_bytes, roi_elements * blob->get_element_type().size());
+    }
+    // Download on the dedicated transfer stream once the producing compute work is done,
+    // freeing the compute stream for kernels of the next request
+    const auto& downloadStream = threadContext.downloadStream();
+    CUDA::Event{}.record(stream).wait(downloadStream);
+    downloadStream.download(memory_ptr, download_src, download_bytes);
+}
+
+std::size_t ResultOp::transferSize(const InferenceRequestContext& context, std::size_t full_size) const noexcept {
+    const auto batch = context.getBatchSize();
+    // Only tensors whose leading dimension is the network batch are trimmed; the first
+    // batch samples form a contiguous prefix because the batch is the outermost dimension
+    if (batch != 0 && batch_extent_ == context.maxBatchSize() && batch < batch_extent_) {
+        return full_size / batch_extent_ * batch;
+    }
+    return full_size;
+}
+
+WorkbufferRequest ResultOp::GetWorkBufferRequest() const {
+    if (input_size_bytes_ == 0) {
+        return {};
+    }
+    // Scratch for on-device precision conversion; the converted tensor is never
+    // larger than the network-precision one (only narrowing conversions are
+    // routed here by the infer request)
+    return {{}, {input_size_bytes_}};
 }
 
 std::optional<std::string> ResultOp::GetFusedOutputTensorName(const ov::Node::RTMap& rtInfo,
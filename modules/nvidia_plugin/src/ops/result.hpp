@@ -22,6 +22,7 @@ public:
                  Inputs inputTensors,
                  Outputs outputTensors,
                  const Workbuffers& workbuffers) const override;
+    WorkbufferRequest GetWorkBufferRequest() const override;
     static std::vector<std::string> GetOutputTensorName(const ov::op::v0::Result& node);
 
 private:
@@ -29,7 +30,22 @@ private:
     static std::optional<std::string> GetFusedOutputTensorName(const ov::Node::RTMap& rtInfo,
                                                                const std::string& resultName);
 
+    /** Bytes to download for the runtime batch of @p context; the full blob unless dynamic batch trims it */
+    std::size_t transferSize(const InferenceRequestContext& context, std::size_t full_size) const noexcept;
+
     std::vector<std::string> output_tensor_names_;
+    // Leading dimension of the result; 0 when there is no leading dimension
+    // to trim under dynamic batch
+    std::size_t batch_extent_{0};
+    // When the user blob precision differs from the network output type the
+    // infer request wraps the user blob directly (see inferPreprocess) and the
+    // conversion runs on the GPU into the scratch workbuffer, so the download
+    // moves the smaller user type
+    ov::element::Type input_element_type_;
+    size_t num_elements_{0};
+    size_t input_size_bytes_{0};
+    size_t num_blocks_{0};
+    size_t threads_per_block_{0};
 };
 
 }  // namespace nvidia_gpu
@@ -14,7 +14,8 @@ GRUSequenceParamsCuDnn::GRUSequenceParamsCuDnn(const GRUSequenceParams& params)
     : element_type_{convertDataType<cudnnDataType_t>(params.element_type_)},
       element_type_cuda_{convertDataType<cudaDataType_t>(params.element_type_)},
       element_size_{ov::nvidia_gpu::elementSize(element_type_)},
-      direction_{CUDNN_UNIDIRECTIONAL},
+      direction_{params.direction_ == ov::op::RecurrentSequenceDirection::BIDIRECTIONAL ? CUDNN_BIDIRECTIONAL
+                                                                                       : CUDNN_UNIDIRECTIONAL},
       linear_before_reset_{params.linear_before_reset_},
       batch_size_{static_cast<int32_t>(params.batch_size_)},
       max_seq_length_{static_cast<int32_t>(params.max_seq_length_)},
@@ -26,9 +27,6 @@ GRUSequenceParamsCuDnn::GRUSequenceParamsCuDnn(const GRUSequenceParams& params)
     if (params.direction_ == ov::op::RecurrentSequenceDirection::REVERSE) {
         throwIEException("Currently GRUSequence cuDNN implementation doesn't support REVERSE direction");
     }
-    if (params.direction_ == ov::op::RecurrentSequenceDirection::BIDIRECTIONAL) {
-        throwIEException("Currently GRUSequence cuDNN implementation doesn't support BIDIRECTIONAL direction");
-    }
 
     if (input_size_ == 1 && hidden_size_ == 1) {
         throwIEException(
@@ -157,39 +155,41 @@ void GRUSequenceDescriptorsCuDnn::initWeightSpace(DevPtr buffer) {
     const auto w_host_buffer_size = params_.w_host_buffers_.size_bytes() / dev_buffers_count;
     const auto r_host_buffer_size = params_.r_host_buffers_.size_bytes() / dev_buffers_count;
     const auto b1_host_layer_size = params_.hidden_size_ * params_.element_size_;
-
-    const uint8_t* w_host_addr = params_.w_host_buffers_.data();
-    const uint8_t* r_host_addr = params_.r_host_buffers_.data();
-    const uint8_t* b1_host_addr = params_.b_host_buffers_.data();
+    // Per-direction block of the bias tensor: [(linear_before_reset ? 4 : 3) * hidden_size]
+    const size_t b_host_dir_stride = (params_.linear_before_reset_ ? 4 : 3) * b1_host_layer_size;
 
     const auto& stream = CUDA::DefaultStream::stream();
 
     for (int i = 0; i < dev_buffers_count; ++i) {
+        const int dir = i / GRUSequenceParams::lin_layer_count;
+        const int gate = i % GRUSequenceParams::lin_layer_count;
+
         // OpenVINO: linear layer indices are ZRH gates (Z states for update, R for reset and H for output hidden)
         //      https://docs.openvino.ai/latest/openvino_docs_ops_sequence_GRUSequence_5.html?highlight=grusequence
         // In cuDNN they are RZH
         //      https://docs.nvidia.com/deeplearning/cudnn/api/index.html#cudnnGetRNNWeightParams
         //
-        // So we swap the corresponding buffers:
-        int j = i;
-        j = (j == 0) ? 1 : ((j == 1) ? 0 : j);
+        // So we swap the corresponding buffers within each direction (pseudo-layer):
+        const int swapped_gate = (gate == 0) ? 1 : ((gate == 1) ? 0 : gate);
+        const int j = dir * GRUSequenceParams::lin_layer_count + swapped_gate;
 
+        const uint8_t* const w_host_addr = params_.w_host_buffers_.data() + i * w_host_buffer_size;
         Expects(w_host_buffer_size == w_dev_buffers_[j].size_bytes());
         stream.upload(DevPtr{w_dev_buffers_[j].data()}, w_host_addr, w_host_buffer_size);
-        w_host_addr += w_host_buffer_size;
 
+        const uint8_t* const b1_host_addr =
+            params_.b_host_buffers_.data() + dir * b_host_dir_stride + gate * b1_host_layer_size;
         Expects(b1_host_layer_size == b1_dev_buffers_[j].size_bytes());
         stream.upload(DevPtr{b1_dev_buffers_[j].data()}, b1_host_addr, b1_host_layer_size);
-        b1_host_addr += b1_host_layer_size;
 
+        const uint8_t* const r_host_addr = params_.r_host_buffers_.data() + i * r_host_buffer_size;
         Expects(r_host_buffer_size == r_dev_buffers_[j].size_bytes());
         stream.upload(DevPtr{r_dev_buffers_[j].data()}, r_host_addr, r_host_buffer_size);
-        r_host_addr += r_host_buffer_size;
 
         if (i < b2_dev_buffers_.size()) {
-            if (params_.linear_before_reset_ && (j == 2)) {
-                // the tensor shape is [4 * hidden_size], get the fourth element from an array
-                const size_t offset = b1_host_layer_size * (j + 1);
+            if (params_.linear_before_reset_ && (gate == 2)) {
+                // the hidden gate recurrent bias is the fourth element of the direction block
+                const size_t offset = dir * b_host_dir_stride + 3 * b1_host_layer_size;
                 Ensures(offset + b1_host_layer_size <= params_.b_host_buffers_.size_bytes());
                 const uint8_t* b2_host_addr = params_.b_host_buffers_.data() + offset;
                 stream.upload(DevPtr{b2_dev_buffers_[j].data()}, b2_host_addr, b1_host_layer_size);
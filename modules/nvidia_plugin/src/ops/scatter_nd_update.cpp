@@ -6,8 +6,10 @@
 #include <fmt/format.h>
 
 #include <cuda_operation_registry.hpp>
+#include <map>
 #include <ngraph/shape.hpp>
 #include <ngraph/type/element_type.hpp>
+#include <openvino/op/constant.hpp>
 #include <openvino/op/scatter_nd_update.hpp>
 
 #include "converters.hpp"
@@ -85,6 +87,40 @@ ScatterNDUpdateOp::ScatterNDUpdateOp(const CreationContext& context,
         for (size_t i{input_shape.size() - 1}; i > 0; --i) padding[i - 1] = padding[i] * input_shape[i];
         return padding;
     }();
+
+    // When the indices come from a Constant their layout repeats across inferences, so
+    // write conflicts can be resolved once on the host: for every distinct output offset
+    // only the last colliding update chunk survives (deterministic last-wins), and the
+    // surviving writes are issued sorted by offset with no two threads sharing a slot.
+    if (const auto indices_constant = dynamic_cast<ov::op::v0::Constant*>(node.get_input_node_ptr(1))) {
+        const auto indices = indices_constant->cast_vector<int64_t>();
+        std::map<size_t, size_t> last_writer{};
+        for (size_t chunk{}; chunk < num_of_update_chunks; ++chunk) {
+            size_t offset{};
+            for (size_t k{}; k < indices_last_dim; ++k) {
+                const auto index = indices[chunk * indices_last_dim + k];
+                if (index < 0 || static_cast<size_t>(index) >= input_shape[k]) {
+                    throwIEException(fmt::format(
+                        "ScatterNDUpdate index {} is out of bounds for dimension {} of extent {}!",
+                        index,
+                        k,
+                        input_shape[k]));
+                }
+                offset += static_cast<size_t>(index) * input_data_dim_pading_[k];
+            }
+            last_writer[offset] = chunk;
+        }
+        plan_offsets_.reserve(last_writer.size());
+        plan_chunks_.reserve(last_writer.size());
+        for (const auto& [offset, chunk] : last_writer) {
+            plan_offsets_.push_back(offset);
+            plan_chunks_.push_back(chunk);
+        }
+        plan_blocks_ = num_of_update_elements % max_block_size == 0 ? num_of_update_elements / max_block_size
+                                                                    : num_of_update_elements / max_block_size + 1;
+        plan_threads_ = plan_blocks_ == 1 ? num_of_update_elements : max_block_size;
+        has_plan_ = !plan_offsets_.empty();
+    }
 }
 
 void ScatterNDUpdateOp::Execute(const InferenceRequestContext& context,
@@ -94,6 +130,19 @@ void ScatterNDUpdateOp::Execute(const InferenceRequestContext& context,
     Expects(inputs.size() == 3);
     Expects(outputs.size() == 1);
 
+    if (has_plan_) {
+        (*kernel_)(context.getThreadContext().stream().get(),
+                   inputs[0].get(),
+                   inputs[2].get(),
+                   static_cast<const size_t*>(workbuffers.immutable_buffers[1].get()),
+                   static_cast<const size_t*>(workbuffers.immutable_buffers[2].get()),
+                   plan_offsets_.size(),
+                   plan_blocks_,
+                   plan_threads_,
+                   outputs[0].get());
+        return;
+    }
+
     (*kernel_)(context.getThreadContext().stream().get(),
                inputs[0].get(),
                inputs[1].get(),
@@ -108,12 +157,20 @@ static auto size_in_bytes(const std::vector<T>& v) noexcept {
 }
 
 WorkbufferRequest ScatterNDUpdateOp::GetWorkBufferRequest() const {
+    if (has_plan_) {
+        return {{size_in_bytes(input_data_dim_pading_), size_in_bytes(plan_offsets_), size_in_bytes(plan_chunks_)},
+                {}};
+    }
     return {{size_in_bytes(input_data_dim_pading_)}, {}};
 }
 
 void ScatterNDUpdateOp::InitSharedImmutableWorkbuffers(const Buffers& buffers) {
     auto& stream = CUDA::DefaultStream::stream();
     stream.upload(buffers[0], input_data_dim_pading_.data(), size_in_bytes(input_data_dim_pading_));
+    if (has_plan_) {
+        stream.upload(buffers[1], plan_offsets_.data(), size_in_bytes(plan_offsets_));
+        stream.upload(buffers[2], plan_chunks_.data(), size_in_bytes(plan_chunks_));
+    }
 }
 
 OPERATION_REGISTER(ScatterNDUpdateOp, ScatterNDUpdate);
@@ -27,6 +27,12 @@ public:
 private:
     std::optional<kernel::ScatterNDUpdate> kernel_;
     std::vector<size_t> input_data_dim_pading_;
+    // Conflict-free write plan, precomputed on the host when the indices are constant
+    std::vector<size_t> plan_offsets_;
+    std::vector<size_t> plan_chunks_;
+    size_t plan_blocks_{};
+    size_t plan_threads_{};
+    bool has_plan_{false};
 };
 
 }  // namespace nvidia_gpu
@@ -10,6 +10,8 @@
 #include <openvino/op/constant.hpp>
 #include <openvino/op/select.hpp>
 
+#include "packed_bool_mask.hpp"
+
 namespace ov {
 namespace nvidia_gpu {
 
@@ -67,8 +69,11 @@ SelectOp::SelectOp(const CreationContext& context,
     blocks_number_ = 1 + max_size_ / max_threads_per_block_;
     threads_per_block_ = (blocks_number_ == 1) ? max_size_ : max_threads_per_block_;
 
-    kernel_op_ =
-        std::make_optional<kernel::SelectKernelOp>(max_size_, blocks_number_, threads_per_block_, operation_type_);
+    // Same handshake the condition producer evaluates: when it packs the mask
+    // into bits, read the packed form directly
+    const bool packed_condition = packedBoolMaskAgreed(*node.get_input_source_output(CONDITION).get_node());
+    kernel_op_ = std::make_optional<kernel::SelectKernelOp>(
+        max_size_, blocks_number_, threads_per_block_, operation_type_, packed_condition);
 }
 
 void SelectOp::Execute(const InferenceRequestContext& context,
@@ -78,7 +83,7 @@ void SelectOp::Execute(const InferenceRequestContext& context,
     assert(kernel_op_);
     (*kernel_op_)(
         context.getThreadContext().stream().get(),
-        static_cast<const bool*>(inputs[CONDITION].get()),
+        inputs[CONDITION].get(),
         inputs[THEN].get(),
         inputs[ELSE].get(),
         static_cast<const kernel::SelectKernelOp::BrcstOffsetType*>(workbuffers.immutable_buffers[CONDITION].get()),
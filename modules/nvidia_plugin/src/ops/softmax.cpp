@@ -147,6 +147,15 @@ void SoftmaxOp::mapRankAxis(const ov::Shape& shape, int axis) {
     }
 }
 
+bool SoftmaxOp::reducesInnermostAxis(const ov::Shape& shape, int axis) {
+    for (size_t i = axis + 1; i < shape.size(); ++i) {
+        if (shape[i] != 1) {
+            return false;
+        }
+    }
+    return true;
+}
+
 SoftmaxOp::SoftmaxOp(const CreationContext& context,
                      const NodeOp& node,
                      IndexCollection&& inputIds,
@@ -154,8 +163,33 @@ SoftmaxOp::SoftmaxOp(const CreationContext& context,
     : OperationCuDnn{context, node, move(inputIds), move(outputIds)},
       type_{convertDataType<cudnnDataType_t>(node.input(0).get_element_type())} {
     const int axis = node.get_axis();
-    mapRankAxis(node.input(0).get_shape(), axis);
+    const auto& shape = node.input(0).get_shape();
+    mapRankAxis(shape, axis);
     tensor_descriptor_.set(cudnnTensorFormat_t::CUDNN_TENSOR_NCHW, type_, 4, shape_.data());
+
+    // Many small rows - e.g. attention scores - lose more to cudnnSoftmaxForward
+    // launch and grid scheduling overhead than to the computation itself; a warp
+    // per row amortizes it, while wide rows keep the cuDNN path, which brings
+    // more threads to bear on a single row
+    constexpr size_t kMaxWarpRowSize = 1024;
+    constexpr size_t kMinWarpRows = 32;
+    const auto element_type = node.input(0).get_element_type();
+    const bool is_float = element_type == ov::element::f16 || element_type == ov::element::bf16 ||
+                          element_type == ov::element::f32 || element_type == ov::element::f64;
+    if (is_float && reducesInnermostAxis(shape, axis)) {
+        const size_t row_size = shape[axis];
+        const size_t num_rows = ngraph::shape_size(shape) / row_size;
+        if (row_size > 1 && row_size <= kMaxWarpRowSize && num_rows >= kMinWarpRows) {
+            // Enough blocks to fill the device; the grid-stride loop in the
+            // kernel covers any remaining rows
+            const size_t max_blocks = static_cast<size_t>(context.device().props().multiProcessorCount) * 8;
+            warp_softmax_kernel_ = kernel::Softmax{convertDataType<ov::nvidia_gpu::kernel::Type_t>(element_type),
+                                                   false,
+                                                   num_rows,
+                                                   row_size,
+                                                   max_blocks};
+        }
+    }
 }
 
 void SoftmaxOp::Execute(const InferenceRequestContext& context,
@@ -164,6 +198,10 @@ void SoftmaxOp::Execute(const InferenceRequestContext& context,
                         const Workbuffers&) const {
     Expects(inputs.size() == 1);
     Expects(outputs.size() == 1);
+    if (warp_softmax_kernel_) {
+        (*warp_softmax_kernel_)(context.getThreadContext().stream().get(), inputs[0].get(), outputs[0].get());
+        return;
+    }
     throwIfError(cudnnSoftmaxForward(context.getThreadContext().dnnHandle().get(),
                                      cudnnSoftmaxAlgorithm_t::CUDNN_SOFTMAX_ACCURATE,
                                      cudnnSoftmaxMode_t::CUDNN_SOFTMAX_MODE_CHANNEL,
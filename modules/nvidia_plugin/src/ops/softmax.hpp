@@ -11,6 +11,9 @@
 #include <ngraph/shape.hpp>
 #include <ngraph/type/element_type.hpp>
 #include <openvino/op/softmax.hpp>
+#include <optional>
+
+#include "kernels/softmax.hpp"
 
 namespace ov {
 namespace nvidia_gpu {
@@ -29,9 +32,11 @@ public:
 
 private:
     void mapRankAxis(const ov::Shape& shape, int axis);
+    static bool reducesInnermostAxis(const ov::Shape& shape, int axis);
     std::array<int, 4> shape_;
     cudnnDataType_t type_;
     CUDA::DnnTensorDescriptor tensor_descriptor_;
+    std::optional<kernel::Softmax> warp_softmax_kernel_;
 };
 
 }  // namespace nvidia_gpu
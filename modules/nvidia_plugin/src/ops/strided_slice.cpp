@@ -67,6 +67,12 @@ StridedSliceOp::StridedSliceOp(const CreationContext& context,
                                   convert_mask_to_axis_set(stridedSliceOp.get_new_axis_mask()),
                                   convert_mask_to_axis_set(stridedSliceOp.get_shrink_axis_mask()),
                                   convert_mask_to_axis_set(stridedSliceOp.get_ellipsis_mask()));
+    memcpy_plan_ = makeMemcpyPlan(
+        slice_plan_, stridedSliceOp.get_input_shape(0), ov::element::Type{element_type_}.size());
+    if (memcpy_plan_) {
+        return;
+    }
+
     src_matrix_sizes_ = std::vector<int64_t>(stridedSliceOp.get_input_shape(0).size(), 0);
     dst_matrix_sizes_ = std::vector<int64_t>(slice_plan_.reshape_in_shape.size(), 0);
     calcMatrixSizes(stridedSliceOp.get_input_shape(0), src_matrix_sizes_);
@@ -86,10 +92,93 @@ StridedSliceOp::StridedSliceOp(const CreationContext& context,
                                                                   element_type_);
 }
 
+std::optional<StridedSliceOp::MemcpyPlan> StridedSliceOp::makeMemcpyPlan(const ngraph::SlicePlan& plan,
+                                                                         const ov::Shape& in_shape,
+                                                                         size_t element_size) {
+    if (!plan.reverse_axes.empty()) {
+        return std::nullopt;
+    }
+    const size_t rank = in_shape.size();
+    if (rank == 0 || plan.begins.size() != rank || plan.ends.size() != rank || plan.strides.size() != rank) {
+        return std::nullopt;
+    }
+    std::vector<int64_t> out_dims(rank);
+    for (size_t d = 0; d < rank; ++d) {
+        if (plan.strides[d] != 1) {
+            return std::nullopt;
+        }
+        if (plan.begins[d] < 0 || plan.ends[d] > static_cast<int64_t>(in_shape[d]) ||
+            plan.begins[d] >= plan.ends[d]) {
+            return std::nullopt;
+        }
+        out_dims[d] = plan.ends[d] - plan.begins[d];
+    }
+
+    std::vector<size_t> src_strides(rank, 1);
+    for (size_t d = rank - 1; d > 0; --d) {
+        src_strides[d - 1] = src_strides[d] * in_shape[d];
+    }
+
+    // Trailing dimensions copied in full are contiguous in both tensors and
+    // collapse, together with the first partially copied one, into the row
+    size_t row_elems = 1;
+    size_t offset_elems = 0;
+    size_t d = rank;
+    while (d > 0 && out_dims[d - 1] == static_cast<int64_t>(in_shape[d - 1])) {
+        row_elems *= in_shape[d - 1];
+        --d;
+    }
+    if (d > 0) {
+        row_elems *= out_dims[d - 1];
+        offset_elems += plan.begins[d - 1] * src_strides[d - 1];
+        --d;
+    }
+
+    // The remaining outer dimensions may only shift the source offset,
+    // except for at most one that enumerates the rows of a pitched copy
+    size_t num_rows = 1;
+    size_t rows_stride = 0;
+    while (d > 0) {
+        --d;
+        offset_elems += plan.begins[d] * src_strides[d];
+        if (out_dims[d] > 1) {
+            if (num_rows > 1) {
+                return std::nullopt;
+            }
+            num_rows = out_dims[d];
+            rows_stride = src_strides[d];
+        }
+    }
+
+    MemcpyPlan memcpy_plan{};
+    memcpy_plan.src_offset_bytes = offset_elems * element_size;
+    memcpy_plan.row_bytes = row_elems * element_size;
+    memcpy_plan.num_rows = num_rows;
+    memcpy_plan.src_pitch_bytes = num_rows > 1 ? rows_stride * element_size : memcpy_plan.row_bytes;
+    return memcpy_plan;
+}
+
 void StridedSliceOp::Execute(const InferenceRequestContext& context,
                              Inputs inputs,
                              Outputs outputs,
                              const Workbuffers& workbuffers) const {
+    if (memcpy_plan_) {
+        const auto& stream = context.getThreadContext().stream();
+        const auto src = CUDA::DevicePointer<const void*>{
+            static_cast<const uint8_t*>(inputs[0].get()) + memcpy_plan_->src_offset_bytes};
+        if (memcpy_plan_->num_rows == 1) {
+            stream.transfer(outputs[0], src, memcpy_plan_->row_bytes);
+        } else {
+            stream.transfer2D(outputs[0],
+                              memcpy_plan_->row_bytes,
+                              src,
+                              memcpy_plan_->src_pitch_bytes,
+                              memcpy_plan_->row_bytes,
+                              memcpy_plan_->num_rows);
+        }
+        return;
+    }
+
     Expects(kernel_op_);
     (*kernel_op_)(context.getThreadContext().stream().get(),
                   static_cast<const int64_t*>(workbuffers.immutable_buffers[0].get()),
@@ -102,6 +191,9 @@ void StridedSliceOp::Execute(const InferenceRequestContext& context,
 }
 
 WorkbufferRequest StridedSliceOp::GetWorkBufferRequest() const {
+    if (memcpy_plan_) {
+        return {};
+    }
     return {{size_bytes(src_matrix_sizes_),
              size_bytes(dst_matrix_sizes_),
              size_bytes(slice_plan_.begins),
@@ -111,6 +203,9 @@ WorkbufferRequest StridedSliceOp::GetWorkBufferRequest() const {
 }
 
 void StridedSliceOp::InitSharedImmutableWorkbuffers(const Buffers& buffers) {
+    if (memcpy_plan_) {
+        return;
+    }
     uploadDataToWorkbuffer(buffers[0], src_matrix_sizes_);
     uploadDataToWorkbuffer(buffers[1], dst_matrix_sizes_);
 
@@ -50,6 +50,23 @@ private:
 
     std::vector<int64_t> getNodeConstantValues(const ov::Node* node) const;
 
+    /**
+     * Lowering of a unit-stride slice to a device-to-device copy. Trailing
+     * dimensions that are copied in full collapse, together with the first
+     * partially copied one, into a single contiguous row; at most one outer
+     * dimension may enumerate more than one row so that the whole slice is
+     * a single 1D or pitched 2D memcpy.
+     */
+    struct MemcpyPlan {
+        size_t src_offset_bytes{0};
+        size_t row_bytes{0};
+        size_t src_pitch_bytes{0};
+        size_t num_rows{1};
+    };
+    static std::optional<MemcpyPlan> makeMemcpyPlan(const ngraph::SlicePlan& plan,
+                                                    const ov::Shape& in_shape,
+                                                    size_t element_size);
+
 private:
     std::vector<int64_t> src_matrix_sizes_;
     std::vector<int64_t> dst_matrix_sizes_;
@@ -61,6 +78,7 @@ private:
     unsigned threads_per_block_{0};
     ov::element::Type_t element_type_;
 
+    std::optional<MemcpyPlan> memcpy_plan_;
     std::optional<kernel::StridedSliceKernelOp> kernel_op_;
 };
 
@@ -6,14 +6,26 @@
 
 #include <fmt/format.h>
 
+#include <cuda_runtime_api.h>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cuda/event.hpp>
 #include <cuda_op_buffers_extractor.hpp>
 #include <cuda_operation_registry.hpp>
 #include <cuda_profiler.hpp>
+#include <map>
+#include <mutex>
 #include <ngraph/function.hpp>
 #include <openvino/op/parameter.hpp>
+#include <set>
+#include <thread>
+#include <unordered_map>
 #include <openvino/op/result.hpp>
 #include <openvino/op/tensor_iterator.hpp>
 
+#include "host_fallback.hpp"
 #include "nop_op.hpp"
 #include "parameter.hpp"
 #include "result.hpp"
@@ -21,17 +33,125 @@
 namespace ov {
 namespace nvidia_gpu {
 
+namespace {
+
+/**
+ * Tracks which operation last wrote or read every byte range of the mutable
+ * memory block. Ranges are kept as disjoint segments; a write replaces the
+ * overlapped segments, a read is appended to their reader lists without
+ * splitting them, which over-approximates the read range and therefore can
+ * only add ordering constraints, never lose one.
+ */
+class MemoryAccessTracker {
+public:
+    /**
+     * Records an access of [begin, end) by operation op and collects the
+     * indices of earlier operations the access conflicts with: the last
+     * writer for a read, the last writer and the readers since then for a
+     * write.
+     */
+    void access(std::size_t begin, std::size_t end, int op, bool write, std::set<int>& conflicts) {
+        if (begin >= end) {
+            return;
+        }
+        auto first = segments_.upper_bound(begin);
+        if (first != segments_.begin() && std::prev(first)->second.end > begin) {
+            first = std::prev(first);
+        }
+        for (auto seg = first; seg != segments_.end() && seg->first < end; ++seg) {
+            if (seg->second.end <= begin) {
+                continue;
+            }
+            if (seg->second.writer >= 0 && seg->second.writer != op) {
+                conflicts.insert(seg->second.writer);
+            }
+            if (write) {
+                for (const int reader : seg->second.readers) {
+                    if (reader != op) {
+                        conflicts.insert(reader);
+                    }
+                }
+            }
+        }
+        if (write) {
+            // Carve out [begin, end): keep the non-overlapped parts of the
+            // boundary segments and make the range belong to the new writer
+            std::vector<std::pair<std::size_t, Segment>> pieces;
+            auto seg = first;
+            while (seg != segments_.end() && seg->first < end) {
+                if (seg->second.end <= begin) {
+                    ++seg;
+                    continue;
+                }
+                const std::size_t seg_begin = seg->first;
+                const Segment old = seg->second;
+                seg = segments_.erase(seg);
+                if (seg_begin < begin) {
+                    pieces.emplace_back(seg_begin, Segment{begin, old.writer, old.readers});
+                }
+                if (old.end > end) {
+                    pieces.emplace_back(end, Segment{old.end, old.writer, old.readers});
+                }
+            }
+            pieces.emplace_back(begin, Segment{end, op, {}});
+            for (auto& piece : pieces) {
+                segments_.emplace(piece.first, std::move(piece.second));
+            }
+        } else {
+            // Append the reader to the overlapped segments and cover the gaps
+            // of never-touched memory with reader-only segments
+            std::size_t cursor = begin;
+            std::vector<std::pair<std::size_t, Segment>> gaps;
+            for (auto seg = first; seg != segments_.end() && seg->first < end; ++seg) {
+                if (seg->second.end <= begin) {
+                    continue;
+                }
+                if (seg->first > cursor) {
+                    gaps.emplace_back(cursor, Segment{seg->first, -1, {op}});
+                }
+                if (seg->second.readers.empty() || seg->second.readers.back() != op) {
+                    seg->second.readers.push_back(op);
+                }
+                cursor = std::max(cursor, seg->second.end);
+            }
+            if (cursor < end) {
+                gaps.emplace_back(cursor, Segment{end, -1, {op}});
+            }
+            for (auto& gap : gaps) {
+                segments_.emplace(gap.first, std::move(gap.second));
+            }
+        }
+    }
+
+private:
+    struct Segment {
+        std::size_t end;
+        int writer;  // -1 when the range has only been read so far
+        std::vector<int> readers;
+    };
+    std::map<std::size_t, Segment> segments_;  // keyed by segment begin
+};
+
+}  // namespace
+
 SubGraph::SubGraph(const CreationContext& context,
                    const SubGraphOp& op,
                    IndexCollection&& inputIds,
                    IndexCollection&& outputIds)
-    : OperationBase(context, op, std::move(inputIds), std::move(outputIds)), function_{op.get_function()} {
+    : OperationBase(context, op, std::move(inputIds), std::move(outputIds)),
+      function_{op.get_function()},
+      cancellation_check_interval_{context.cancellationCheckInterval()} {
     const bool isStableParamsAndResultsNeeded = nullptr != dynamic_cast<const ov::op::v0::TensorIterator*>(&op);
     initExecuteSequence(context, isStableParamsAndResultsNeeded, isStableParamsAndResultsNeeded);
 }
 
-SubGraph::SubGraph(const CreationContext& context, const std::shared_ptr<const ngraph::Function>& function)
-    : OperationBase(context, nullptr), function_{function} {
+SubGraph::SubGraph(const CreationContext& context,
+                   const std::shared_ptr<const ngraph::Function>& function,
+                   DeviceMemBlock::Ptr constants_donor)
+    : OperationBase(context, nullptr),
+      constants_donor_{std::move(constants_donor)},
+      function_{function},
+      cancellation_check_interval_{context.cancellationCheckInterval()} {
     initExecuteSequence(context, false, false);
 }
 
@@ -41,7 +161,10 @@ void SubGraph::initExecuteSequence(const CreationContext& context, bool isStable
     if (!function_) {
         return;
     }
-    const auto& orderedNodes = function_->get_ordered_ops();
+    // Among the many valid execution orders pick one keeping tensors alive for
+    // as short as possible; the memory solver turns the shorter lifespans into
+    // a smaller mutable blob
+    const auto orderedNodes = OperationBuffersExtractor::scheduleForMinimalPeakMemory(function_->get_ordered_ops());
 
     std::vector<Ptr> init_sequence{};
     OperationBuffersExtractor opBuffersExtractor{orderedNodes, isStableParams, isStableResults};
@@ -51,21 +174,77 @@ void SubGraph::initExecuteSequence(const CreationContext& context, bool isStable
     const auto resultSize = function_->get_results().size();
     results_ = std::vector<OperationBase::Ptr>(resultSize);
     results_info_ = std::vector<OperationInfo>(resultSize);
+    // Operation construction - including cuDNN descriptor setup and algorithm
+    // selection - dominates LoadNetwork time and is independent per node, so it runs
+    // on a thread pool. Every worker uses its own CreationContext, keeping cuDNN and
+    // cuBLAS handles thread-local; all bookkeeping that mutates shared state
+    // (workbuffer requests, exec_sequence_) stays on the calling thread below.
+    std::vector<OperationBase::Ptr> operations(orderedNodes.size());
+    {
+        std::atomic<unsigned> next_node_idx{0};
+        std::atomic<bool> failed{false};
+        std::exception_ptr creation_error;
+        std::mutex error_mutex;
+        auto worker = [&] {
+            const CreationContext workerContext{context.device(),
+                                                context.opBenchOption(),
+                                                context.useCudaGraphOption(),
+                                                context.cancellationCheckInterval(),
+                                                context.dnnWorkspaceLimit(),
+                                                context.hostFallbackOption()};
+            for (auto node_idx = next_node_idx++; node_idx < orderedNodes.size() && !failed; node_idx = next_node_idx++) {
+                const auto& node = orderedNodes[node_idx];
+                try {
+                    auto inIds = opBuffersExtractor.inputTensorIds(*node);
+                    auto outIds = opBuffersExtractor.outputTensorIds(*node);
+                    if (OperationRegistry::getInstance().hasOperation(node)) {
+                        operations[node_idx] = OperationRegistry::getInstance().createOperation(
+                            workerContext, node, move(inIds), move(outIds));
+                    } else if (workerContext.hostFallbackOption() && HostFallbackOp::CanHandle(node)) {
+                        // Hetero-style partitioning: the node runs on the host through its
+                        // reference evaluate() between the device segments, keeping every
+                        // other intermediate tensor device-resident
+                        operations[node_idx] =
+                            std::make_shared<HostFallbackOp>(workerContext, node, move(inIds), move(outIds));
+                    } else {
+                        throwIEException(
+                            fmt::format("Node: name = {}, description = {}; Is not found in OperationRegistry",
+                                        node->get_name(),
+                                        node->description()));
+                    }
+                } catch (...) {
+                    std::lock_guard<std::mutex> lock{error_mutex};
+                    if (!creation_error) {
+                        creation_error = std::current_exception();
+                    }
+                    failed = true;
+                }
+            }
+        };
+        const auto workerCount = std::max(
+            1u, std::min(std::thread::hardware_concurrency(), static_cast<unsigned>(orderedNodes.size())));
+        if (workerCount > 1) {
+            std::vector<std::thread> workers;
+            workers.reserve(workerCount);
+            for (unsigned i = 0; i < workerCount; ++i) {
+                workers.emplace_back(worker);
+            }
+            for (auto& thread : workers) {
+                thread.join();
+            }
+        } else {
+            worker();
+        }
+        if (creation_error) {
+            std::rethrow_exception(creation_error);
+        }
+    }
     for (unsigned node_idx = 0; node_idx < orderedNodes.size(); node_idx++) {
         const auto& node = orderedNodes[node_idx];
-        if (!OperationRegistry::getInstance().hasOperation(node)) {
-            throwIEException(fmt::format("Node: name = {}, description = {}; Is not found in OperationRegistry",
-                                         node->get_name(),
-                                         node->description()));
-        }
-        auto inIds = opBuffersExtractor.inputTensorIds(*node);
-        auto outIds = opBuffersExtractor.outputTensorIds(*node);
-        auto operation = OperationRegistry::getInstance().createOperation(context, node, move(inIds), move(outIds));
+        auto& operation = operations[node_idx];
         if (dynamic_cast<NopOp*>(operation.get())) {
             continue;
         }
-        operation->SetWorkbufferIds(
-            opBuffersExtractor.processWorkbufferRequest(node_idx, operation->GetWorkBufferRequest()));
         if (InitNeeded == operation->SetWorkbufferIds(opBuffersExtractor.processWorkbufferRequest(
                               node_idx, operation->GetWorkBufferRequest()))) {
             init_sequence.push_back(operation);
@@ -88,17 +267,185 @@ void SubGraph::initExecuteSequence(const CreationContext& context, bool isStable
     }
     memory_manager_ = createMemoryManager(opBuffersExtractor);
     initSharedImmutableWorkbuffers(init_sequence);
+    // Resolve tensor locations once so the inference hot path only adds offsets
+    // to the memory block base pointer
+    for (const auto& op : exec_sequence_) {
+        memory_manager_->registerOperation(*op);
+    }
+    is_cuda_graph_compatible_ = std::all_of(
+        exec_sequence_.begin(), exec_sequence_.end(), [](const auto& op) { return op->IsCudaGraphCompatible(); });
+    buildStreamAssignment(orderedNodes, operations, opBuffersExtractor);
+}
+
+void SubGraph::buildStreamAssignment(gsl::span<const std::shared_ptr<ov::Node>> orderedNodes,
+                                     const std::vector<OperationBase::Ptr>& operations,
+                                     const OperationBuffersExtractor& opBuffersExtractor) {
+    constexpr unsigned kNumLanes = ThreadContext::kNumStreamLanes;
+    const int num_ops = static_cast<int>(exec_sequence_.size());
+    stream_assignment_ = {};
+    stream_assignment_.ops.assign(num_ops, {});
+    if (num_ops == 0) {
+        return;
+    }
+    const auto memory_model = memory_manager_->mutableTensorsMemoryModel();
+
+    std::unordered_map<const OperationBase*, int> exec_index;
+    for (int i = 0; i < num_ops; ++i) {
+        exec_index.emplace(exec_sequence_[i].get(), i);
+    }
+
+    // Conflict analysis: two operations conflict when they touch overlapping
+    // bytes of the mutable block and at least one of them writes. This covers
+    // the data dependencies and, crucially, the buffer aliasing introduced by
+    // the memory solver, whose reuse decisions assume the serial order.
+    MemoryAccessTracker tracker;
+    std::vector<std::set<int>> preds(num_ops);
+    for (std::size_t node_idx = 0; node_idx < orderedNodes.size(); ++node_idx) {
+        const auto& operation = operations[node_idx];
+        const auto found = operation ? exec_index.find(operation.get()) : exec_index.end();
+        if (found == exec_index.end()) {
+            continue;  // NopOp
+        }
+        const int op_idx = found->second;
+        auto& conflicts = preds[op_idx];
+        const auto& node = orderedNodes[node_idx];
+        const auto addAccess = [&](const TensorID& tensor, std::size_t bsize, bool write) {
+            ptrdiff_t offset{};
+            if (!memory_model->offsetForBuffer(tensor.GetBuffer().GetId(), offset)) {
+                return;  // constants and immutable workbuffers are read only
+            }
+            const std::size_t begin = static_cast<std::size_t>(offset) + tensor.GetOffset();
+            tracker.access(begin, begin + bsize, op_idx, write, conflicts);
+        };
+        const auto input_ids = opBuffersExtractor.inputTensorIds(*node);
+        for (std::size_t i = 0; i < input_ids.size(); ++i) {
+            addAccess(input_ids[i], OperationBuffersExtractor::GetTensorByteSize(node->input(i)), false);
+        }
+        const auto output_ids = opBuffersExtractor.outputTensorIds(*node);
+        for (std::size_t i = 0; i < output_ids.size(); ++i) {
+            addAccess(output_ids[i], OperationBuffersExtractor::GetTensorByteSize(node->output(i)), true);
+        }
+        for (const auto id : operation->GetWorkbufferIds().mutableIds) {
+            addAccess(TensorID{id}, opBuffersExtractor.mutableBufferSize(id), true);
+        }
+    }
+
+    // Lane coloring in topological order: an operation continues the lane it
+    // is the next link of, a fork takes a free lane, a merge or a fully
+    // occupied fork falls back to the lane of its latest predecessor.
+    std::array<int, kNumLanes> lane_tail;
+    lane_tail.fill(-1);
+    std::vector<unsigned> lanes(num_ops, 0);
+    for (int i = 0; i < num_ops; ++i) {
+        unsigned lane = 0;
+        if (preds[i].empty()) {
+            for (unsigned l = 0; l < kNumLanes; ++l) {
+                if (lane_tail[l] < 0) {
+                    lane = l;
+                    break;
+                }
+            }
+        } else {
+            int chain_pred = -1;
+            for (const int p : preds[i]) {
+                if (lane_tail[lanes[p]] == p && p > chain_pred) {
+                    chain_pred = p;
+                    lane = lanes[p];
+                }
+            }
+            if (chain_pred < 0) {
+                lane = lanes[*preds[i].rbegin()];
+                for (unsigned l = 0; l < kNumLanes; ++l) {
+                    if (lane_tail[l] < 0) {
+                        lane = l;
+                        break;
+                    }
+                }
+            }
+        }
+        lanes[i] = lane;
+        lane_tail[lane] = i;
+        stream_assignment_.ops[i].lane = lane;
+        stream_assignment_.parallel = stream_assignment_.parallel || lane != 0;
+    }
+
+    // Event edges: before an operation runs, its lane waits for the latest
+    // predecessor on every other lane; stream order covers the earlier ones.
+    std::vector<std::optional<unsigned>> record(num_ops);
+    const auto eventAfter = [&](int p) {
+        if (!record[p]) {
+            record[p] = stream_assignment_.num_events++;
+            stream_assignment_.ops[p].record_event = *record[p];
+        }
+        return *record[p];
+    };
+    for (int i = 0; i < num_ops; ++i) {
+        std::array<int, kNumLanes> latest_on_lane;
+        latest_on_lane.fill(-1);
+        for (const int p : preds[i]) {
+            latest_on_lane[lanes[p]] = std::max(latest_on_lane[lanes[p]], p);
+        }
+        for (unsigned l = 0; l < kNumLanes; ++l) {
+            if (l != lanes[i] && latest_on_lane[l] >= 0) {
+                stream_assignment_.ops[i].wait_events.push_back(eventAfter(latest_on_lane[l]));
+            }
+        }
+    }
+    // All lanes join back into lane 0 so the caller observes one stream
+    for (unsigned l = 1; l < kNumLanes; ++l) {
+        if (lane_tail[l] >= 0) {
+            stream_assignment_.join_events.push_back(eventAfter(lane_tail[l]));
+        }
+    }
+}
+
+bool SubGraph::IsCudaGraphCompatible() const { return is_cuda_graph_compatible_; }
+
+bool SubGraph::donorMatchesConstantsModel(const DeviceMemBlock& donor, const MemoryModel& constants_model) {
+    const auto donor_model = donor.memoryModel();
+    if (donor_model->deviceMemoryBlockSize() != constants_model.deviceMemoryBlockSize() ||
+        donor_model->bufferIds() != constants_model.bufferIds()) {
+        return false;
+    }
+    for (const auto id : constants_model.bufferIds()) {
+        ptrdiff_t offset{};
+        ptrdiff_t donor_offset{};
+        if (!constants_model.offsetForBuffer(id, offset) || !donor_model->offsetForBuffer(id, donor_offset) ||
+            offset != donor_offset) {
+            return false;
+        }
+    }
+    return true;
 }
 
 std::unique_ptr<MemoryManager> SubGraph::createMemoryManager(const OperationBuffersExtractor& opBuffersExtractor) {
-    // Build memory model for mutable memory block
+    // Build memory model for mutable memory block. The budget below bounds one
+    // block of the model to what the device can still hold; over budget the
+    // ResidencyAdvisor spills cold tensors to pinned host memory instead of
+    // letting the block allocation fail outright
+    size_t free_device_bytes = 0;
+    size_t total_device_bytes = 0;
+    size_t device_memory_budget = 0;
+    if (::cudaMemGetInfo(&free_device_bytes, &total_device_bytes) == cudaSuccess) {
+        // Leave headroom for the constants blob, workbuffers and the driver
+        constexpr size_t kDeviceHeadroomBytes = 256ull << 20;
+        device_memory_budget = free_device_bytes > kDeviceHeadroomBytes ? free_device_bytes - kDeviceHeadroomBytes : 0;
+    }
     auto constants_model = opBuffersExtractor.createConstantMemoryModel();
-    auto memory_model = opBuffersExtractor.createMutableMemoryModel();
+    auto memory_model = opBuffersExtractor.createMutableMemoryModel(device_memory_budget);
     auto immutable_workbuffer_model = opBuffersExtractor.createImmutableMemoryModel();
 
-    // Build shared constants memory block
-    auto shared_constants_blob = std::make_shared<DeviceMemBlock>(constants_model);
-    opBuffersExtractor.initConstantMemory(shared_constants_blob);
+    // Build shared constants memory block, reusing the donor blob when it holds
+    // exactly the same buffers so recompiling the model at another shape skips
+    // the constants allocation and upload
+    DeviceMemBlock::Ptr shared_constants_blob;
+    if (constants_donor_ && donorMatchesConstantsModel(*constants_donor_, *constants_model)) {
+        shared_constants_blob = constants_donor_;
+    } else {
+        shared_constants_blob = std::make_shared<DeviceMemBlock>(constants_model);
+        opBuffersExtractor.initConstantMemory(shared_constants_blob);
+    }
+    constants_donor_.reset();
 
     auto immutable_workbuffers = std::make_shared<DeviceMemBlock>(immutable_workbuffer_model);
     // Later on, for each infer request
@@ -129,20 +476,70 @@ WorkbufferRequest SubGraph::GetWorkBufferRequest() const {
 }
 
 void SubGraph::Execute(const InferenceRequestContext& context, Inputs, Outputs, const Workbuffers& workbuffers) const {
-    const auto& stream = context.getThreadContext().stream();
-    const auto& memoryManager = *memory_manager_;
     auto& mutableBuffer = workbuffers.mutable_buffers.at(0);
+    auto& profiler = context.getProfiler();
+    const auto& threadContext = context.getThreadContext();
+    // Reused across operations so their capacity is allocated only once
+    MemoryManager::InputTensors inputTensors;
+    MemoryManager::OutputTensors outputTensors;
+    Workbuffers workBuffers;
+    if (profiler.PerfCount()) {
+        profiler.SetStream(threadContext.stream());
+        executeSequence(
+            profiler.CreateExecSequence(this), context, mutableBuffer, inputTensors, outputTensors, workBuffers);
+    } else if (stream_assignment_.parallel && threadContext.defaultLaneActive() &&
+               !threadContext.stream().isCapturing()) {
+        // Per-operation timing, CUDA graph capture and nested subgraphs (which
+        // already run on a non-default lane) keep the serial single-stream path
+        executeMultiStream(context, mutableBuffer);
+    } else {
+        executeSequence(getExecSequence(), context, mutableBuffer, inputTensors, outputTensors, workBuffers);
+    }
+}
 
+void SubGraph::executeMultiStream(const InferenceRequestContext& context,
+                                  const DevicePointer<void*>& mutableBuffer) const {
+    const auto& threadContext = context.getThreadContext();
+    const auto& memoryManager = *memory_manager_;
     auto& cancellationToken = context.getCancellationToken();
-    auto& profiler = context.getProfiler();
-    profiler.SetStream(stream);
-    for (auto& op : profiler.CreateExecSequence(this)) {
-        cancellationToken.Check();
-        auto inputTensors = memoryManager.inputTensorPointers(*op, mutableBuffer);
-        auto outputTensors = memoryManager.outputTensorPointers(*op, mutableBuffer);
-        auto workBuffers = memoryManager.workBuffers(*op, mutableBuffer);
-        op->Execute(context, inputTensors, outputTensors, workBuffers);
+    std::vector<CUDA::Event> events(stream_assignment_.num_events);
+    MemoryManager::InputTensors inputTensors;
+    MemoryManager::OutputTensors outputTensors;
+    Workbuffers workBuffers;
+    const unsigned checkInterval = cancellation_check_interval_;
+    unsigned opsSinceCheck = 0;
+    try {
+        for (std::size_t i = 0; i < exec_sequence_.size(); ++i) {
+            if (checkInterval != 0 && ++opsSinceCheck >= checkInterval) {
+                opsSinceCheck = 0;
+                cancellationToken.Check();
+            }
+            const auto& schedule = stream_assignment_.ops[i];
+            threadContext.setActiveLane(schedule.lane);
+            const auto& lane_stream = threadContext.laneStream(schedule.lane);
+            for (const auto event_idx : schedule.wait_events) {
+                events[event_idx].wait(lane_stream);
+            }
+            const auto& op = exec_sequence_[i];
+            itt::ScopedNvtxRange nvtx_range{op->GetName()};
+            memoryManager.inputTensorPointers(*op, mutableBuffer, inputTensors);
+            memoryManager.outputTensorPointers(*op, mutableBuffer, outputTensors);
+            memoryManager.workBuffers(*op, mutableBuffer, workBuffers);
+            op->Execute(context, inputTensors, outputTensors, workBuffers);
+            if (schedule.record_event) {
+                events[*schedule.record_event].record(lane_stream);
+            }
+        }
+        // The caller continues on the default stream: make it wait for the
+        // tails of the other lanes
+        for (const auto event_idx : stream_assignment_.join_events) {
+            events[event_idx].wait(threadContext.laneStream(0));
+        }
+    } catch (...) {
+        threadContext.setActiveLane(0);
+        throw;
     }
+    threadContext.setActiveLane(0);
 }
 
 }  // namespace nvidia_gpu
@@ -4,11 +4,13 @@
 
 #pragma once
 
+#include <cuda_itt.hpp>
 #include <cuda_op_buffers_extractor.hpp>
 #include <cuda_operation_base.hpp>
 #include <memory_manager/cuda_memory_manager.hpp>
 #include <memory_manager/cuda_memory_pool.hpp>
 #include <ngraph/op/util/sub_graph_base.hpp>
+#include <optional>
 
 class ExecNetworkTest;
 
@@ -25,6 +27,7 @@ public:
                  Inputs inputTensors,
                  Outputs outputTensors,
                  const Workbuffers& workbuffers) const override;
+    bool IsCudaGraphCompatible() const override;
     const MemoryManager& memoryManager() const { return *memory_manager_; }
 
     const std::vector<OperationBase::Ptr>& getParams() const;
@@ -34,7 +37,28 @@ public:
 private:
     void initSharedImmutableWorkbuffers(const std::vector<OperationBase::Ptr>& init_sequence);
     void initExecuteSequence(const CreationContext& context, bool isStableParams, bool isStableResults);
-    static std::unique_ptr<MemoryManager> createMemoryManager(const OperationBuffersExtractor& opBuffersExtractor);
+
+    /**
+     * Colors independent branches of the execution sequence with stream lanes
+     * and derives the event edges needed at branch merge points. Any two
+     * operations touching overlapping device memory - tensor reads and writes
+     * as well as mutable workbuffers, including ranges aliased by the memory
+     * solver - end up either on one lane or ordered by an event, so the
+     * schedule is safe for the buffer reuse the serial order allowed.
+     */
+    void buildStreamAssignment(gsl::span<const std::shared_ptr<ov::Node>> orderedNodes,
+                               const std::vector<OperationBase::Ptr>& operations,
+                               const OperationBuffersExtractor& opBuffersExtractor);
+
+    /** Enqueues the execution sequence across the lane streams of the schedule */
+    void executeMultiStream(const InferenceRequestContext& context, const DevicePointer<void*>& mutableBuffer) const;
+    std::unique_ptr<MemoryManager> createMemoryManager(const OperationBuffersExtractor& opBuffersExtractor);
+    /**
+     * Whether the donor constants blob holds exactly the buffers the freshly
+     * solved constants model asks for, so it can be shared instead of
+     * re-allocated and re-uploaded
+     */
+    static bool donorMatchesConstantsModel(const DeviceMemBlock& donor, const MemoryModel& constants_model);
     std::vector<DevicePointer<void*>> getSharedWorkbuffers(const IOperationExec& operation);
 
 protected:
@@ -44,10 +68,52 @@ protected:
              const SubGraphOp& node,
              IndexCollection&& inputIds,
              IndexCollection&& outputIds);
-    SubGraph(const CreationContext& context, const std::shared_ptr<const ngraph::Function>& function);
+    /**
+     * @param constants_donor Optional constants blob of an already compiled graph
+     * of the same weights; it is shared instead of allocating and uploading a new
+     * one when its layout matches the freshly solved constants model
+     */
+    SubGraph(const CreationContext& context,
+             const std::shared_ptr<const ngraph::Function>& function,
+             DeviceMemBlock::Ptr constants_donor = nullptr);
 
     WorkbufferRequest GetWorkBufferRequest() const override;
 
+    /**
+     * Runs every operation of the sequence once. Instantiated both for the profiled
+     * sequence (Profiler::ProfilerSequence) and for the raw execution sequence, so
+     * with performance counters disabled the loop compiles down to plain virtual
+     * calls without any per-operation instrumentation.
+     */
+    template <typename TExecSequence>
+    void executeSequence(const TExecSequence& sequence,
+                         const InferenceRequestContext& context,
+                         const DevicePointer<void*>& mutableBuffer,
+                         MemoryManager::InputTensors& inputTensors,
+                         MemoryManager::OutputTensors& outputTensors,
+                         Workbuffers& workBuffers) const {
+        const auto& memoryManager = *memory_manager_;
+        auto& cancellationToken = context.getCancellationToken();
+        // Batched polling: the atomic load runs once per interval; interval 0
+        // hoists the whole check out and leaves cancellation to the pipeline
+        // stage boundaries and to iterating operations like TensorIterator
+        const unsigned checkInterval = cancellation_check_interval_;
+        unsigned opsSinceCheck = 0;
+        for (auto&& op : sequence) {
+            if (checkInterval != 0 && ++opsSinceCheck >= checkInterval) {
+                opsSinceCheck = 0;
+                cancellationToken.Check();
+            }
+            // Names the host-side enqueueing of this operation on the Nsight timeline
+            const OperationBase& op_meta = *op;
+            itt::ScopedNvtxRange nvtx_range{op_meta.GetName()};
+            memoryManager.inputTensorPointers(*op, mutableBuffer, inputTensors);
+            memoryManager.outputTensorPointers(*op, mutableBuffer, outputTensors);
+            memoryManager.workBuffers(*op, mutableBuffer, workBuffers);
+            op->Execute(context, inputTensors, outputTensors, workBuffers);
+        }
+    }
+
     template <typename TNode>
     std::size_t getTensorByteSize(const TNode& node) {
         return node.get_element_type().size() * shape_size(node.get_shape());
@@ -62,13 +128,35 @@ protected:
         ov::Shape shape_{};
     };
 
+    /** Lane and event edges of one operation of the execution sequence */
+    struct OpStreamSchedule {
+        unsigned lane{0};
+        std::vector<unsigned> wait_events;
+        std::optional<unsigned> record_event;
+    };
+
+    /** Multi-stream schedule of the whole execution sequence */
+    struct StreamAssignment {
+        std::vector<OpStreamSchedule> ops;  // aligned with exec_sequence_
+        std::vector<unsigned> join_events;  // waited on lane 0 after the last operation
+        unsigned num_events{0};
+        bool parallel{false};  // false when every operation landed on lane 0
+    };
+
     std::unique_ptr<MemoryManager> memory_manager_;
+    // Constants blob offered for reuse; consumed by createMemoryManager()
+    DeviceMemBlock::Ptr constants_donor_;
     std::vector<OperationBase::Ptr> params_;
     std::vector<OperationInfo> params_info_;
     std::vector<OperationBase::Ptr> exec_sequence_;
     std::vector<OperationBase::Ptr> results_;
     std::vector<OperationInfo> results_info_;
     std::shared_ptr<const ngraph::Function> function_;
+    StreamAssignment stream_assignment_;
+    bool is_cuda_graph_compatible_ = false;
+    // Operations between cancellation checkpoints of the execution loops;
+    // 0 checks only at pipeline stage boundaries (see CreationContext)
+    unsigned cancellation_check_interval_ = 1;
 };
 
 inline SubGraph::~SubGraph() {}
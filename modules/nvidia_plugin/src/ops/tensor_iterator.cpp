@@ -7,11 +7,11 @@
 #include <cpp/ie_cnn_network.h>
 
 #include <cstdint>
+#include <cuda/event.hpp>
 #include <cuda_op_buffers_extractor.hpp>
 #include <cuda_profiler.hpp>
 #include <kernels/cuda_type_traits.hpp>
 #include <kernels/insert.hpp>
-#include <kernels/slice.hpp>
 #include <kernels/tensor_helpers.hpp>
 
 #include "converters.hpp"
@@ -108,19 +108,6 @@ TensorIteratorOp::TensorIteratorOp(const CreationContext& context,
     }
     max_threads_per_block_ = context.device().props().maxThreadsPerBlock;
 
-    for (const auto& [inputIdx, portMap] : portmap_inputs_) {
-        const auto inputShape = inputs_info_[inputIdx].shape_;
-        const auto inputType = inputs_info_[inputIdx].type_;
-
-        kernel::Type_t element_type = convertDataType<ov::nvidia_gpu::kernel::Type_t>(inputType);
-        kernel::Slice::Props props;
-        std::copy(inputShape.begin(), inputShape.end(), props.old_shape);
-        std::copy(inputShape.begin(), inputShape.end(), props.new_shape);
-        props.axe = portMap.axis;
-        props.new_shape[props.axe] = portMap.part_size;
-        kernelmap_inputs_.emplace(inputIdx, kernel::Slice(element_type, props, max_threads_per_block_));
-    }
-
     for (const auto& [resultIdx, outputIdx] : results_outputs_map_) {
         if (portmap_outputs_.count(outputIdx) > 0) {
             const auto& resultShape = results_info_[resultIdx].shape_;
@@ -136,6 +123,57 @@ TensorIteratorOp::TensorIteratorOp(const CreationContext& context,
             kernelmap_outputs_.emplace(outputIdx, kernel::Insert(element_type, props, max_threads_per_block_));
         }
     }
+
+    // Reserve a double-buffered staging workbuffer per sliced input so the slices of
+    // the next iteration can be produced while the body of the current one runs, and
+    // describe all sliced inputs for the batched slice kernel
+    const auto base_mutable_count = SubGraph::GetWorkBufferRequest().mutable_sizes.size();
+    staged_slice_inputs_.reserve(portmap_inputs_.size());
+    std::vector<kernel::PortCopyBatch::PortProps> slice_ports;
+    slice_ports.reserve(portmap_inputs_.size());
+    for (const auto& [inputIdx, portMap] : portmap_inputs_) {
+        const auto paramIdx = inputs_parameters_map_.at(inputIdx);
+        staged_slice_inputs_.push_back(StagedSliceInput{
+            inputIdx, paramIdx, params_info_[paramIdx].size_, base_mutable_count + staged_slice_inputs_.size()});
+
+        const auto& inputShape = inputs_info_[inputIdx].shape_;
+        kernel::PortCopyBatch::PortProps props;
+        std::copy(inputShape.begin(), inputShape.end(), props.full_shape);
+        std::copy(inputShape.begin(), inputShape.end(), props.part_shape);
+        props.axe = portMap.axis;
+        props.part_shape[props.axe] = portMap.part_size;
+        props.start = (portMap.start < 0) ? inputShape[portMap.axis] + portMap.start : portMap.start;
+        props.stride = portMap.stride;
+        props.element_size = inputs_info_[inputIdx].type_.size();
+        slice_ports.push_back(props);
+    }
+    if (!slice_ports.empty()) {
+        slice_batch_.emplace(kernel::PortCopyBatch::Direction::slice, slice_ports, max_threads_per_block_);
+    }
+
+    // Describe the concatenated outputs for the batched insert kernel
+    std::vector<kernel::PortCopyBatch::PortProps> insert_port_props;
+    for (const auto& [resultIdx, outputIdx] : results_outputs_map_) {
+        if (portmap_outputs_.count(outputIdx) == 0) {
+            continue;
+        }
+        insert_ports_.emplace_back(resultIdx, outputIdx);
+
+        const auto& portMap = portmap_outputs_.at(outputIdx);
+        const auto& resultShape = results_info_[resultIdx].shape_;
+        const auto& outputShape = outputs_info_[outputIdx].shape_;
+        kernel::PortCopyBatch::PortProps props;
+        std::copy(outputShape.begin(), outputShape.end(), props.full_shape);
+        std::copy(resultShape.begin(), resultShape.end(), props.part_shape);
+        props.axe = portMap.axis;
+        props.start = (portMap.start < 0) ? outputShape[portMap.axis] + portMap.start : portMap.start;
+        props.stride = portMap.stride;
+        props.element_size = outputs_info_[outputIdx].type_.size();
+        insert_port_props.push_back(props);
+    }
+    if (!insert_port_props.empty()) {
+        insert_batch_.emplace(kernel::PortCopyBatch::Direction::insert, insert_port_props, max_threads_per_block_);
+    }
 }
 
 void TensorIteratorOp::Execute(const InferenceRequestContext& context,
@@ -143,41 +181,79 @@ void TensorIteratorOp::Execute(const InferenceRequestContext& context,
                                Outputs outputTensors,
                                const Workbuffers& workbuffers) const {
     const auto& stream = context.getThreadContext().stream();
-    const auto& memoryManager = *memory_manager_;
     auto& mutableBuffer = workbuffers.mutable_buffers.at(0);
-    auto& cancellationToken = context.getCancellationToken();
     auto& profiler = context.getProfiler();
-    profiler.SetStream(stream);
 
     // First iteration
     for (const auto inputIdx : invariant_inputs_) {
         const auto paramIdx = inputs_parameters_map_.at(inputIdx);
-        copyParam(stream, mutableBuffer, inputTensors, 0, inputIdx, paramIdx);
+        copyParam(stream, mutableBuffer, inputTensors, inputIdx, paramIdx);
     }
     for (const auto& [inputIdx, paramIdx] : inputs_parameters_map_) {
         if (portmap_inputs_.count(inputIdx) == 0) {
-            copyParam(stream, mutableBuffer, inputTensors, 0, inputIdx, paramIdx);
+            copyParam(stream, mutableBuffer, inputTensors, inputIdx, paramIdx);
         }
     }
 
-    const auto& execSequence = profiler.CreateExecSequence(this);
+    if (profiler.PerfCount()) {
+        profiler.SetStream(stream);
+        executeIterations(profiler.CreateExecSequence(this), context, inputTensors, outputTensors, workbuffers);
+    } else {
+        executeIterations(getExecSequence(), context, inputTensors, outputTensors, workbuffers);
+    }
+}
+
+template <typename TExecSequence>
+void TensorIteratorOp::executeIterations(const TExecSequence& execSequence,
+                                         const InferenceRequestContext& context,
+                                         Inputs inputTensors,
+                                         Outputs outputTensors,
+                                         const Workbuffers& workbuffers) const {
+    const auto& threadContext = context.getThreadContext();
+    const auto& stream = threadContext.stream();
+    auto& cancellationToken = context.getCancellationToken();
+    auto& mutableBuffer = workbuffers.mutable_buffers.at(0);
+    // Pre-staging the slices of iteration i+1 on the transfer stream hides their
+    // latency behind the body of iteration i; cross-stream events cannot be
+    // recorded while a CUDA graph is being captured, so fall back to inline
+    // slicing in that case
+    const bool pipeline_slices = !staged_slice_inputs_.empty() && num_iterations_ > 1 && !stream.isCapturing();
+    const auto& sliceStream = threadContext.uploadStream();
+    CUDA::Event slices_ready[2]{};
+    CUDA::Event slot_free[2]{};
+    if (pipeline_slices) {
+        stageSlices(sliceStream, workbuffers, inputTensors, 0);
+        slices_ready[0].record(sliceStream);
+    }
+    // Reused across iterations and operations so their capacity is allocated only once
+    MemoryManager::InputTensors inTensors;
+    MemoryManager::OutputTensors outTensors;
+    Workbuffers workBuffers;
     for (int64_t iter = 0; iter < num_iterations_; ++iter) {
         cancellationToken.Check();
 
         // Input mapping of ports
-        for (auto& it : portmap_inputs_) {
-            const auto& inputIdx = it.first;
-            const auto& paramIdx = inputs_parameters_map_.at(inputIdx);
-            copyParam(stream, mutableBuffer, inputTensors, iter, inputIdx, paramIdx);
+        if (pipeline_slices) {
+            const auto slot = iter & 1;
+            slices_ready[slot].wait(stream);
+            copyStagedSlices(stream, workbuffers, mutableBuffer, iter);
+            // The slot may be overwritten with the slices of iteration iter + 2
+            // once the copies above are done
+            slot_free[slot].record(stream);
+            if (iter + 1 < num_iterations_) {
+                const auto next_slot = (iter + 1) & 1;
+                if (iter > 0) {
+                    slot_free[next_slot].wait(sliceStream);
+                }
+                stageSlices(sliceStream, workbuffers, inputTensors, iter + 1);
+                slices_ready[next_slot].record(sliceStream);
+            }
+        } else if (slice_batch_) {
+            sliceToParams(stream, mutableBuffer, inputTensors, iter);
         }
 
         // Inner loop
-        for (const auto& op : execSequence) {
-            auto inTensors = memoryManager.inputTensorPointers(*op, mutableBuffer);
-            auto outTensors = memoryManager.outputTensorPointers(*op, mutableBuffer);
-            auto workBuffers = memoryManager.workBuffers(*op, mutableBuffer);
-            op->Execute(context, inTensors, outTensors, workBuffers);
-        }
+        executeSequence(execSequence, context, mutableBuffer, inTensors, outTensors, workBuffers);
 
         // Back-edge mapping
         for (auto& [resultIdx, paramIdx] : results_parameters_map_) {
@@ -185,10 +261,8 @@ void TensorIteratorOp::Execute(const InferenceRequestContext& context,
         }
 
         // Output mapping of ports
-        for (const auto& [resultIdx, outputIdx] : results_outputs_map_) {
-            if (portmap_outputs_.count(outputIdx) > 0) {
-                copyResult(stream, mutableBuffer, outputTensors, iter, resultIdx, outputIdx);
-            }
+        if (insert_batch_) {
+            insertResults(stream, mutableBuffer, outputTensors, iter);
         }
 
         // Copy data to output
@@ -201,63 +275,120 @@ void TensorIteratorOp::Execute(const InferenceRequestContext& context,
     }
 }
 
+void TensorIteratorOp::stageSlices(const CUDA::Stream& stream,
+                                   const Workbuffers& workbuffers,
+                                   const IOperationExec::Inputs& inputTensors,
+                                   const std::int64_t iter) const {
+    std::vector<const void*> srcs;
+    std::vector<void*> dsts;
+    srcs.reserve(staged_slice_inputs_.size());
+    dsts.reserve(staged_slice_inputs_.size());
+    for (const auto& staged : staged_slice_inputs_) {
+        srcs.push_back(inputTensors[staged.input_idx].get());
+        dsts.push_back(static_cast<uint8_t*>(workbuffers.mutable_buffers.at(staged.mutable_buffer_idx).get()) +
+                       (iter & 1) * staged.slice_size);
+    }
+    (*slice_batch_)(stream.get(), srcs.data(), dsts.data(), iter);
+}
+
+void TensorIteratorOp::sliceToParams(const CUDA::Stream& stream,
+                                     CUDA::DevicePointer<void*> mutableBuffer,
+                                     const IOperationExec::Inputs& inputTensors,
+                                     const std::int64_t iter) const {
+    auto& memoryManager = *memory_manager_;
+    std::vector<const void*> srcs;
+    std::vector<void*> dsts;
+    srcs.reserve(staged_slice_inputs_.size());
+    dsts.reserve(staged_slice_inputs_.size());
+    for (const auto& staged : staged_slice_inputs_) {
+        srcs.push_back(inputTensors[staged.input_idx].get());
+        dsts.push_back(memoryManager.outputTensorPointers(*params_[staged.param_idx], mutableBuffer)[0].get());
+    }
+    (*slice_batch_)(stream.get(), srcs.data(), dsts.data(), iter);
+}
+
+void TensorIteratorOp::insertResults(const CUDA::Stream& stream,
+                                     CUDA::DevicePointer<void*> mutableBuffer,
+                                     const IOperationExec::Outputs& outputTensors,
+                                     const std::int64_t iter) const {
+    auto& memoryManager = *memory_manager_;
+    std::vector<const void*> srcs;
+    std::vector<void*> dsts;
+    srcs.reserve(insert_ports_.size());
+    dsts.reserve(insert_ports_.size());
+    for (const auto& [resultIdx, outputIdx] : insert_ports_) {
+        srcs.push_back(memoryManager.inputTensorPointers(*results_[resultIdx], mutableBuffer)[0].get());
+        dsts.push_back(outputTensors[outputIdx].get());
+    }
+    (*insert_batch_)(stream.get(), srcs.data(), dsts.data(), iter);
+}
+
+void TensorIteratorOp::copyStagedSlices(const CUDA::Stream& stream,
+                                        const Workbuffers& workbuffers,
+                                        CUDA::DevicePointer<void*> mutableBuffer,
+                                        const std::int64_t iter) const {
+    auto& memoryManager = *memory_manager_;
+    for (const auto& staged : staged_slice_inputs_) {
+        const auto& param = params_[staged.param_idx];
+        auto paramTensors = memoryManager.outputTensorPointers(*param, mutableBuffer);
+        const auto* const staging =
+            static_cast<const uint8_t*>(workbuffers.mutable_buffers.at(staged.mutable_buffer_idx).get()) +
+            (iter & 1) * staged.slice_size;
+        stream.transfer(paramTensors[0], CUDA::DevicePointer<const void*>{staging}, staged.slice_size);
+    }
+}
+
 WorkbufferRequest TensorIteratorOp::GetWorkBufferRequest() const {
     std::vector<WorkbufferRequest::size_in_bytes_t> immutable_sizes;
-    immutable_sizes.reserve(kernelmap_inputs_.size() + kernelmap_outputs_.size());
-    for (const auto& kernel_map : kernelmap_inputs_) {
-        immutable_sizes.push_back(kernel_map.second.getImmutableWorkbufferSize());
-    }
+    immutable_sizes.reserve(kernelmap_outputs_.size() + 2);
     for (const auto& kernel_map : kernelmap_outputs_) {
         immutable_sizes.push_back(kernel_map.second.getImmutableWorkbufferSize());
     }
-    return {immutable_sizes, SubGraph::GetWorkBufferRequest().mutable_sizes};
+    if (slice_batch_) {
+        immutable_sizes.push_back(slice_batch_->getImmutableWorkbufferSize());
+    }
+    if (insert_batch_) {
+        immutable_sizes.push_back(insert_batch_->getImmutableWorkbufferSize());
+    }
+    auto mutable_sizes = SubGraph::GetWorkBufferRequest().mutable_sizes;
+    mutable_sizes.reserve(mutable_sizes.size() + staged_slice_inputs_.size());
+    for (const auto& staged : staged_slice_inputs_) {
+        mutable_sizes.push_back(2 * staged.slice_size);
+    }
+    return {immutable_sizes, mutable_sizes};
 }
 
 void TensorIteratorOp::InitSharedImmutableWorkbuffers(const Buffers& buffers) {
-    Expects(buffers.size() == kernelmap_inputs_.size() + kernelmap_outputs_.size());
+    Expects(buffers.size() ==
+            kernelmap_outputs_.size() + (slice_batch_ ? 1 : 0) + (insert_batch_ ? 1 : 0));
     unsigned nextBufferIdx = 0;
-    for (auto& kernel_map : kernelmap_inputs_) {
-        auto& slice = kernel_map.second;
-        slice.setImmutableWorkbuffer(buffers[nextBufferIdx++].get());
-    }
     for (auto& kernel_map : kernelmap_outputs_) {
         auto& insert = kernel_map.second;
         insert.setImmutableWorkbuffer(buffers[nextBufferIdx++].get());
     }
+    if (slice_batch_) {
+        slice_batch_->setImmutableWorkbuffer(buffers[nextBufferIdx++].get());
+    }
+    if (insert_batch_) {
+        insert_batch_->setImmutableWorkbuffer(buffers[nextBufferIdx++].get());
+    }
 }
 
 void TensorIteratorOp::copyParam(const CUDA::Stream& stream,
                                  const CUDA::DevicePointer<void*> mutableBuffer,
                                  const IOperationExec::Inputs& inputTensors,
-                                 const std::int64_t iter,
                                  const uint64_t inputIdx,
                                  const uint64_t paramIdx) const {
     auto& memoryManager = *memory_manager_;
     const std::size_t inputSize = inputs_info_[inputIdx].size_;
     const std::size_t paramSize = params_info_[paramIdx].size_;
-    if (portmap_inputs_.count(inputIdx) == 0) {
-        auto& input = inputTensors[inputIdx];
-        const auto& param = params_[paramIdx];
-        auto outputTensors = memoryManager.outputTensorPointers(*param, mutableBuffer);
-        Expects(inputSize == paramSize);
-        stream.transfer(outputTensors[0], input, inputSize);
-    } else {
-        const auto& portMap = portmap_inputs_.at(inputIdx);
-        const auto& param = params_[paramIdx];
-        auto outputTensors = memoryManager.outputTensorPointers(*param, mutableBuffer);
-        const auto inputShape = inputs_info_[inputIdx].shape_;
-
-        const auto& slice = kernelmap_inputs_.at(inputIdx);
-        std::size_t start;
-        if (portMap.start < 0) {
-            start = inputShape[portMap.axis] + portMap.start;
-        } else {
-            start = portMap.start;
-        }
-        start += iter * portMap.stride;
-        auto input = inputTensors[inputIdx];
-        slice(stream.get(), input.get(), outputTensors[0].get(), start);
-    }
+    // Sliced inputs are handled by the batched slice kernel
+    Expects(portmap_inputs_.count(inputIdx) == 0);
+    auto& input = inputTensors[inputIdx];
+    const auto& param = params_[paramIdx];
+    auto outputTensors = memoryManager.outputTensorPointers(*param, mutableBuffer);
+    Expects(inputSize == paramSize);
+    stream.transfer(outputTensors[0], input, inputSize);
 }
 
 void TensorIteratorOp::copyBackEdge(const CUDA::Stream& stream,
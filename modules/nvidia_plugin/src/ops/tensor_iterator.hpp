@@ -7,8 +7,9 @@
 #include <cstdint>
 #include <cuda_operation_base.hpp>
 #include <kernels/insert.hpp>
-#include <kernels/slice.hpp>
+#include <kernels/port_copy_batch.hpp>
 #include <openvino/op/tensor_iterator.hpp>
+#include <optional>
 
 #include "subgraph.hpp"
 
@@ -39,10 +40,58 @@ private:
     WorkbufferRequest GetWorkBufferRequest() const override;
     void InitSharedImmutableWorkbuffers(const Buffers& buffers) override;
 
+    /**
+     * Runs all body iterations over the given execution sequence. Instantiated for
+     * the profiled sequence and for the raw one, so inference without performance
+     * counters is free of per-operation instrumentation.
+     */
+    template <typename TExecSequence>
+    void executeIterations(const TExecSequence& execSequence,
+                           const InferenceRequestContext& context,
+                           Inputs inputTensors,
+                           Outputs outputTensors,
+                           const Workbuffers& workbuffers) const;
+
+    /**
+     * Runs the batched slice kernel of the given iteration on the transfer
+     * stream, producing into one half of the per-input staging workbuffers.
+     */
+    void stageSlices(const CUDA::Stream& stream,
+                     const Workbuffers& workbuffers,
+                     const IOperationExec::Inputs& inputTensors,
+                     std::int64_t iter) const;
+
+    /**
+     * Runs the batched slice kernel of the given iteration on the compute
+     * stream, producing directly into the body parameter tensors. Used when
+     * slice pre-staging is not applicable.
+     */
+    void sliceToParams(const CUDA::Stream& stream,
+                       CUDA::DevicePointer<void*> mutableBuffer,
+                       const IOperationExec::Inputs& inputTensors,
+                       std::int64_t iter) const;
+
+    /**
+     * Runs the batched insert kernel scattering the body results of the given
+     * iteration into the concatenated output tensors.
+     */
+    void insertResults(const CUDA::Stream& stream,
+                       CUDA::DevicePointer<void*> mutableBuffer,
+                       const IOperationExec::Outputs& outputTensors,
+                       std::int64_t iter) const;
+
+    /**
+     * Copies pre-staged slices of the given iteration from the staging
+     * workbuffers into the body parameter tensors on the compute stream.
+     */
+    void copyStagedSlices(const CUDA::Stream& stream,
+                          const Workbuffers& workbuffers,
+                          CUDA::DevicePointer<void*> mutableBuffer,
+                          std::int64_t iter) const;
+
     void copyParam(const CUDA::Stream& stream,
                    CUDA::DevicePointer<void*> mutableBuffer,
                    const IOperationExec::Inputs& inputTensors,
-                   std::int64_t iter,
                    uint64_t inputIdx,
                    uint64_t paramIdx) const;
     void copyBackEdge(const CUDA::Stream& stream,
@@ -63,12 +112,31 @@ private:
     std::unordered_map<uint64_t, uint64_t> inputs_parameters_map_;
     std::vector<uint64_t> invariant_inputs_;
     std::unordered_map<uint64_t, PortMap> portmap_inputs_;
-    std::unordered_map<uint64_t, kernel::Slice> kernelmap_inputs_;
     std::unordered_map<uint64_t, uint64_t> results_outputs_map_;
     std::unordered_map<uint64_t, std::vector<uint64_t>> iterations_results_map_;
     std::unordered_map<uint64_t, PortMap> portmap_outputs_;
     std::unordered_map<uint64_t, kernel::Insert> kernelmap_outputs_;
     std::unordered_map<uint64_t, uint64_t> results_parameters_map_;
+
+    /**
+     * Double-buffered staging area of one sliced input: iteration i+1's slice
+     * is produced on the transfer stream into one half of the staging
+     * workbuffer while the body of iteration i runs on the compute stream.
+     */
+    struct StagedSliceInput {
+        uint64_t input_idx;
+        uint64_t param_idx;
+        std::size_t slice_size;
+        std::size_t mutable_buffer_idx;
+    };
+    std::vector<StagedSliceInput> staged_slice_inputs_;
+
+    // Batched kernels performing all port slices (or inserts) of one iteration
+    // in a single launch; empty when the loop has no such ports
+    std::optional<kernel::PortCopyBatch> slice_batch_;
+    std::optional<kernel::PortCopyBatch> insert_batch_;
+    // (result, output) index pairs in the order the insert batch was built
+    std::vector<std::pair<uint64_t, uint64_t>> insert_ports_;
 };
 
 }  // namespace nvidia_gpu
@@ -92,7 +92,6 @@ TopKOp::TopKOp(const CreationContext& context,
     const uint64_t axis = topKOp.get_axis();
     const size_t num_input_element = ngraph::shape_size(input_shape);
     const size_t num_output_element = ngraph::shape_size(output_shape);
-    workspace_size_ = num_input_element * (element_type.size() + index_element_type.size());
 
     Expects(axis >= 0 && axis < input_shape.size());
     Expects(axis >= 0 && axis < output_shape.size());
@@ -142,6 +141,9 @@ TopKOp::TopKOp(const CreationContext& context,
                            k,
                            workspace_chunk_size,
                            max_threads_per_block};
+    // The workspace layout depends on the sorting backend the kernel selected
+    // for this shape, so its size is owned by the kernel
+    workspace_size_ = kernel_->getWorkspaceSize();
 }
 
 void TopKOp::Execute(const InferenceRequestContext& context,
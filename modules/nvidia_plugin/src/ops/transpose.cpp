@@ -35,7 +35,13 @@ TransposeOp::TransposeOp(const CreationContext& context,
       extents_{extractExtents(inputExtents_)},
       inputElementsType_{convertDataType<cudaDataType_t>(node->input(0).get_element_type())},
       permutationElementsType_{extractPermutationElementsType(*node)} {
-    inputExtents_.size();
+    if (outputMode_.has_value() && dimsNumber_ <= kernel::Transpose::kMaxRank) {
+        const auto inputShape = node->input(0).get_shape();
+        native_kernel_.emplace(convertDataType<kernel::Type_t>(node->input(0).get_element_type()),
+                               std::vector<size_t>{inputShape.begin(), inputShape.end()},
+                               outputMode_.value(),
+                               static_cast<size_t>(context.device().props().maxThreadsPerBlock));
+    }
 }
 
 void TransposeOp::Execute(const InferenceRequestContext& context,
@@ -45,33 +51,41 @@ void TransposeOp::Execute(const InferenceRequestContext& context,
     Expects(inputTensors.size() == 1 || inputTensors.size() == 2);
     Expects(outputTensors.size() == 1);
 
-    cutensorTensorDescriptor_t inputDesc{}, outputDesc{};
+    if (native_kernel_) {
+        (*native_kernel_)(context.getThreadContext().stream().get(), inputTensors[0].get(), outputTensors[0].get());
+        return;
+    }
+
     const std::vector<int> outputMode = permutation(context, inputTensors);
     auto& threadContext = context.getThreadContext();
 
-    cutensorInitTensorDescriptor(&threadContext.cuTensorHandle().get(),
-                                 &inputDesc,
-                                 dimsNumber_,
-                                 inputExtents_.data(),
-                                 inputStrides_.data(),
-                                 inputElementsType_,
-                                 CUTENSOR_OP_IDENTITY);
-
-    cutensorInitTensorDescriptor(&threadContext.cuTensorHandle().get(),
-                                 &outputDesc,
-                                 dimsNumber_,
-                                 outputExtents_.data(),
-                                 outputStrides_.data(),
-                                 inputElementsType_,
-                                 CUTENSOR_OP_IDENTITY);
+    // The descriptors describe the fixed tensor geometry, not the permutation, so one
+    // initialization serves every launch; the handle is only used for validation
+    std::call_once(desc_init_flag_, [&] {
+        cutensorInitTensorDescriptor(&threadContext.cuTensorHandle().get(),
+                                     &input_desc_,
+                                     dimsNumber_,
+                                     inputExtents_.data(),
+                                     inputStrides_.data(),
+                                     inputElementsType_,
+                                     CUTENSOR_OP_IDENTITY);
+
+        cutensorInitTensorDescriptor(&threadContext.cuTensorHandle().get(),
+                                     &output_desc_,
+                                     dimsNumber_,
+                                     outputExtents_.data(),
+                                     outputStrides_.data(),
+                                     inputElementsType_,
+                                     CUTENSOR_OP_IDENTITY);
+    });
 
     throwIfError(cutensorPermutation(&threadContext.cuTensorHandle().get(),
                                      &CUDA::NumericConst<CUDA::constants::one>(inputElementsType_),
                                      inputTensors[0].get(),
-                                     &inputDesc,
+                                     &input_desc_,
                                      inputMode_.data(),
                                      outputTensors[0].get(),
-                                     &outputDesc,
+                                     &output_desc_,
                                      outputMode.data(),
                                      inputElementsType_,
                                      context.getThreadContext().stream().get()));
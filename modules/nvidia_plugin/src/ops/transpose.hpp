@@ -4,7 +4,10 @@
 
 #pragma once
 
+#include <cuda/tensor.hpp>
 #include <cuda_operation_base.hpp>
+#include <kernels/transpose.hpp>
+#include <mutex>
 #include <ngraph/node.hpp>
 #include <optional>
 #include <unordered_map>
@@ -24,6 +27,10 @@ public:
                  Outputs outputTensors,
                  const Workbuffers& workbuffers) const override;
 
+    // With a dynamic permutation Execute() downloads the permutation tensor
+    // and synchronizes the stream; the native kernel path has no such issue
+    bool IsCudaGraphCompatible() const override { return native_kernel_.has_value(); }
+
 private:
     using ExtentsMap = std::unordered_map<int, std::int64_t>;
 
@@ -63,6 +70,15 @@ private:
     ExtentsMap extents_;
     cudaDataType_t inputElementsType_;
     ov::element::Type_t permutationElementsType_;
+    // cuTENSOR descriptors depend only on the static extents/strides/type, so they are
+    // initialized once on first Execute (the library handle is not available at
+    // construction time) instead of being rebuilt in every launch
+    mutable std::once_flag desc_init_flag_;
+    mutable cutensorTensorDescriptor_t input_desc_{};
+    mutable cutensorTensorDescriptor_t output_desc_{};
+    // Library-free transpose used whenever the permutation is known statically;
+    // cuTENSOR stays only for the dynamic permutation input
+    std::optional<kernel::Transpose> native_kernel_;
 };
 
 }  // namespace nvidia_gpu
@@ -102,7 +102,6 @@ VariadicSplitOp::VariadicSplitOp(const CreationContext& context,
     const std::vector<int64_t> split_lengths = getSplitLengths(split_lengths_node);
 
     buildAxisHelpers(split_lengths, orig_axis_size);
-    buildSplitIndexHelper(split_lengths, orig_axis_size);
 
     const size_t axis_split_step_size =
         std::accumulate(data_shape.begin() + axis + 1, data_shape.end(), 1, std::multiplies<size_t>());
@@ -111,6 +110,15 @@ VariadicSplitOp::VariadicSplitOp(const CreationContext& context,
         std::accumulate(data_shape.begin(), data_shape.end(), 1, std::multiplies<size_t>());
     const size_t num_all_chunks = num_split_elements / axis_split_step_size;
     Ensures(num_all_chunks != 0);
+
+    const size_t num_outer_rows =
+        std::accumulate(data_shape.begin(), data_shape.begin() + axis, 1, std::multiplies<size_t>());
+    buildCopyPlan(context, num_outer_rows, axis_split_step_size, orig_axis_size, element_type.size());
+    if (copy_plan_) {
+        return;
+    }
+
+    buildSplitIndexHelper(split_lengths, orig_axis_size);
     const unsigned max_block_size = context.device().props().maxThreadsPerBlock;
     const unsigned num_blocks = (num_split_elements % max_block_size == 0) ? (num_split_elements / max_block_size)
                                                                            : (num_split_elements / max_block_size + 1);
@@ -124,6 +132,27 @@ VariadicSplitOp::VariadicSplitOp(const CreationContext& context,
                                                    threads_per_block};
 }
 
+void VariadicSplitOp::buildCopyPlan(const CreationContext& context,
+                                    const size_t num_rows,
+                                    const size_t inner_size,
+                                    const size_t orig_axis_size,
+                                    const size_t element_size) {
+    CopyPlan plan{};
+    plan.src_pitch_bytes = orig_axis_size * inner_size * element_size;
+    plan.num_rows = num_rows;
+    // cudaMemcpy2DAsync limits both pitches to the device memPitch; wider
+    // splits keep the generic kernel
+    if (num_rows > 1 && plan.src_pitch_bytes > static_cast<size_t>(context.device().props().memPitch)) {
+        return;
+    }
+    plan.outputs.reserve(axis_sizes_.size());
+    for (size_t i = 0; i < axis_sizes_.size(); ++i) {
+        plan.outputs.push_back({axis_offset_sizes_[i] * inner_size * element_size,
+                                axis_sizes_[i] * inner_size * element_size});
+    }
+    copy_plan_.emplace(std::move(plan));
+}
+
 void VariadicSplitOp::buildAxisHelpers(const std::vector<int64_t>& split_lengths, const size_t orig_axis_size) {
     const auto num_of_remain_parts = std::count(split_lengths.begin(), split_lengths.end(), -1);
     Expects(num_of_remain_parts <= 1);
@@ -157,6 +186,9 @@ void VariadicSplitOp::buildSplitIndexHelper(const std::vector<int64_t>& split_le
 }
 
 WorkbufferRequest VariadicSplitOp::GetWorkBufferRequest() const {
+    if (copy_plan_) {
+        return {};
+    }
     std::vector<size_t> immutable_buffer_sizes(kNumberOfIWIdx);
     immutable_buffer_sizes.at(kSplitIdxIWBIdx) = sizeof(*split_idx_.data()) * split_idx_.size();
     immutable_buffer_sizes.at(kAxisSizesIWBIdx) = sizeof(*axis_sizes_.data()) * axis_sizes_.size();
@@ -165,6 +197,9 @@ WorkbufferRequest VariadicSplitOp::GetWorkBufferRequest() const {
 }
 
 void VariadicSplitOp::InitSharedImmutableWorkbuffers(const IOperationExec::Buffers& buffers) {
+    if (copy_plan_) {
+        return;
+    }
     Expects(buffers.size() == 3);
     CUDA::DefaultStream::stream().upload(
         buffers.at(kSplitIdxIWBIdx), split_idx_.data(), sizeof(*split_idx_.data()) * split_idx_.size());
@@ -179,9 +214,27 @@ void VariadicSplitOp::Execute(const InferenceRequestContext& context,
                               Inputs inputs,
                               Outputs outputs,
                               const Workbuffers& buffers) const {
-    Expects(variadic_split_kernel_);
     Expects(inputs.size() == 3);
     Expects(outputs.size() == axis_sizes_.size());
+    if (copy_plan_) {
+        const auto& stream = context.getThreadContext().stream();
+        for (size_t i = 0; i < copy_plan_->outputs.size(); ++i) {
+            const auto& copy = copy_plan_->outputs[i];
+            if (copy.row_bytes == 0) {
+                continue;
+            }
+            const auto src = CUDA::DevicePointer<const void*>{static_cast<const uint8_t*>(inputs[0].get()) +
+                                                              copy.src_offset_bytes};
+            if (copy_plan_->num_rows == 1) {
+                stream.transfer(outputs[i], src, copy.row_bytes);
+            } else {
+                stream.transfer2D(
+                    outputs[i], copy.row_bytes, src, copy_plan_->src_pitch_bytes, copy.row_bytes, copy_plan_->num_rows);
+            }
+        }
+        return;
+    }
+    Expects(variadic_split_kernel_);
     Expects(buffers.mutable_buffers.size() == 1);
     Expects(buffers.immutable_buffers.size() == 3);
     auto& stream = context.getThreadContext().stream();
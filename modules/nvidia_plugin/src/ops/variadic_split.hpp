@@ -33,6 +33,24 @@ private:
     enum { kOutputPtrsMWBIdx = 0, kNumberOfMWBIdx };
     enum { kSplitIdxIWBIdx = 0, kAxisSizesIWBIdx, kAxisOffsetSizesIWBIdx, kNumberOfIWIdx };
 
+    /**
+     * Each output of a split is a strided row block of the input: a batch of
+     * memcpy descriptors covering every output, all sharing the source pitch.
+     * Outputs cut along the outermost axis degenerate to a single contiguous
+     * row each.
+     */
+    struct CopyPlan {
+        struct OutputCopy {
+            size_t src_offset_bytes;
+            size_t row_bytes;
+        };
+        std::vector<OutputCopy> outputs;
+        size_t src_pitch_bytes;
+        size_t num_rows;
+    };
+
+    void buildCopyPlan(
+        const CreationContext& context, size_t num_rows, size_t inner_size, size_t orig_axis_size, size_t element_size);
     void buildAxisHelpers(const std::vector<int64_t>& split_lengths, size_t orig_axis_size);
     void buildSplitIndexHelper(const std::vector<int64_t>& split_lengths, size_t orig_axis_size);
 
@@ -48,6 +66,7 @@ private:
     std::vector<size_t> split_idx_;
     std::vector<size_t> axis_sizes_;
     std::vector<size_t> axis_offset_sizes_;
+    std::optional<CopyPlan> copy_plan_;
     std::optional<kernel::VariadicSplit> variadic_split_kernel_;
 };
 
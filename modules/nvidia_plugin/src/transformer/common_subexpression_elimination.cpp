@@ -0,0 +1,143 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "openvino/cc/ngraph/itt.hpp"
+#include "common_subexpression_elimination.hpp"
+
+#include <ios>
+#include <ngraph/rt_info.hpp>
+#include <openvino/core/attribute_visitor.hpp>
+#include <openvino/core/partial_shape.hpp>
+#include <openvino/op/constant.hpp>
+#include <openvino/op/parameter.hpp>
+#include <openvino/op/random_uniform.hpp>
+#include <openvino/op/result.hpp>
+#include <openvino/op/sink.hpp>
+#include <openvino/op/util/read_value_base.hpp>
+#include <sstream>
+#include <unordered_map>
+
+namespace ov::nvidia_gpu::pass {
+
+namespace {
+
+/**
+ * Serializes the visited attributes into a string so that two nodes with
+ * equal attribute sets produce equal strings. Every adapter is routed
+ * through the ValueAccessor<void> overload (the typed overloads forward to
+ * it by default) and dispatched by its dynamic type; an adapter the visitor
+ * does not recognize — e.g. the body of a TensorIterator — marks the node
+ * as not comparable so it is never merged on incomplete evidence.
+ */
+class AttributeKeyVisitor : public ov::AttributeVisitor {
+public:
+    void on_adapter(const std::string& name, ov::ValueAccessor<void>& adapter) override {
+        if (tryScalar<std::string>(name, adapter) || tryScalar<bool>(name, adapter) ||
+            tryScalar<int8_t>(name, adapter) || tryScalar<int16_t>(name, adapter) ||
+            tryScalar<int32_t>(name, adapter) || tryScalar<int64_t>(name, adapter) ||
+            tryScalar<uint8_t>(name, adapter) || tryScalar<uint16_t>(name, adapter) ||
+            tryScalar<uint32_t>(name, adapter) || tryScalar<uint64_t>(name, adapter) ||
+            tryScalar<float>(name, adapter) || tryScalar<double>(name, adapter) ||
+            tryVector<std::string>(name, adapter) || tryVector<int8_t>(name, adapter) ||
+            tryVector<int16_t>(name, adapter) || tryVector<int32_t>(name, adapter) ||
+            tryVector<int64_t>(name, adapter) || tryVector<uint8_t>(name, adapter) ||
+            tryVector<uint16_t>(name, adapter) || tryVector<uint32_t>(name, adapter) ||
+            tryVector<uint64_t>(name, adapter) || tryVector<float>(name, adapter) ||
+            tryVector<double>(name, adapter) || tryScalar<ov::PartialShape>(name, adapter)) {
+            return;
+        }
+        comparable_ = false;
+    }
+
+    bool comparable() const { return comparable_; }
+    std::string str() const { return key_.str(); }
+
+private:
+    template <typename T>
+    bool tryScalar(const std::string& name, ov::ValueAccessor<void>& adapter) {
+        if (auto* accessor = dynamic_cast<ov::ValueAccessor<T>*>(&adapter)) {
+            append(name) << accessor->get();
+            return true;
+        }
+        return false;
+    }
+
+    template <typename T>
+    bool tryVector(const std::string& name, ov::ValueAccessor<void>& adapter) {
+        if (auto* accessor = dynamic_cast<ov::ValueAccessor<std::vector<T>>*>(&adapter)) {
+            auto& out = append(name);
+            for (const auto& value : accessor->get()) {
+                out << value << ',';
+            }
+            return true;
+        }
+        return false;
+    }
+
+    std::ostream& append(const std::string& name) {
+        key_ << name << '=';
+        return key_;
+    }
+
+    std::ostringstream key_{makeStream()};
+    bool comparable_ = true;
+
+    static std::ostringstream makeStream() {
+        std::ostringstream stream;
+        // Floating point attributes must compare exactly, not up to the
+        // default six printed digits
+        stream << std::hexfloat;
+        return stream;
+    }
+};
+
+bool isBarrier(const std::shared_ptr<ov::Node>& node) {
+    return ov::is_type<ov::op::v0::Parameter>(node) || ov::is_type<ov::op::v0::Constant>(node) ||
+           ov::is_type<ov::op::v0::Result>(node) || ov::is_type<ov::op::Sink>(node) ||
+           ov::is_type<ov::op::util::ReadValueBase>(node) || ov::is_type<ov::op::v8::RandomUniform>(node);
+}
+
+}  // namespace
+
+bool CommonSubexpressionElimination::run_on_model(const std::shared_ptr<ov::Model>& f) {
+    RUN_ON_MODEL_SCOPE(CommonSubexpressionElimination);
+    bool changed = false;
+    std::unordered_map<std::string, std::shared_ptr<ov::Node>> seen;
+    for (const auto& node : f->get_ordered_ops()) {
+        if (isBarrier(node) || !node->get_control_dependencies().empty()) {
+            continue;
+        }
+
+        AttributeKeyVisitor visitor;
+        if (!node->visit_attributes(visitor) || !visitor.comparable()) {
+            continue;
+        }
+
+        // Inputs are identified by the producing Output; duplicates already
+        // merged earlier in the topological sweep present the surviving
+        // producer here, which makes subtree merging transitive.
+        std::ostringstream key;
+        key << node->get_type_info().name << '|'
+            << (node->get_type_info().version_id ? node->get_type_info().version_id : "") << '|';
+        for (const auto& input : node->input_values()) {
+            key << input.get_node() << ':' << input.get_index() << '|';
+        }
+        key << visitor.str();
+
+        const auto [it, inserted] = seen.emplace(key.str(), node);
+        if (inserted) {
+            continue;
+        }
+        const auto& survivor = it->second;
+        if (survivor->get_output_size() != node->get_output_size()) {
+            continue;
+        }
+        ngraph::copy_runtime_info({node, survivor}, survivor);
+        ov::replace_node(node, survivor);
+        changed = true;
+    }
+    return changed;
+}
+
+}  // namespace ov::nvidia_gpu::pass
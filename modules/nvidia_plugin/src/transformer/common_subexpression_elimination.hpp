@@ -0,0 +1,33 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "openvino/pass/graph_rewrite.hpp"
+
+namespace ov::nvidia_gpu::pass {
+
+/**
+ * @brief Merges equivalent subgraphs into one.
+ *
+ * Exported graphs frequently contain identical Reshape/Transpose/arithmetic
+ * subtrees repeated per branch; each copy would otherwise become its own
+ * kernel launch with its own mutable buffer. The pass walks the model in
+ * topological order, keys every node on its type, attributes and input
+ * sources, and replaces a node whose key was already seen with the earlier
+ * equivalent. Because children are merged before their consumers are
+ * visited, whole duplicated subtrees collapse in a single sweep.
+ *
+ * Nodes whose equivalence cannot be established safely are left alone:
+ * Parameters, Constants, Results, stateful and random operations, nodes
+ * with control dependencies and nodes with attributes the comparison
+ * visitor does not understand (e.g. subgraph bodies).
+ */
+class CommonSubexpressionElimination : public ov::pass::ModelPass {
+public:
+    OPENVINO_RTTI("CommonSubexpressionElimination", "0");
+    bool run_on_model(const std::shared_ptr<ov::Model>& f) override;
+};
+
+}  // namespace ov::nvidia_gpu::pass
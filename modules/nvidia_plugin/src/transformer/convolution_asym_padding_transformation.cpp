@@ -27,6 +27,25 @@ ov::CoordinateDiff add_two_zero_pads(const ov::CoordinateDiff &pad) {
     return result;
 }
 
+#ifdef ENABLE_CUDNN_BACKEND_API
+/**
+ * The cuDNN backend API convolution executes asymmetric padding natively, so
+ * materializing a zero-padded copy of the activation tensor only wastes a full
+ * write/read pass. The Pad rewrite is kept for the cases the backend engines
+ * do not reliably cover - non-2D spatial shapes and non-float types - where
+ * ConvolutionCuDnnBE creation may fail and the legacy descriptors, which only
+ * accept symmetric padding, are the fallback.
+ */
+bool convolvesAsymmetricPaddingNatively(const ov::Node &convolution) {
+    const auto &element_type = convolution.get_input_element_type(0);
+    if (element_type != ov::element::f16 && element_type != ov::element::f32) {
+        return false;
+    }
+    const auto &rank = convolution.get_input_partial_shape(0).rank();
+    return rank.is_static() && rank.get_length() == 4;
+}
+#endif  // ENABLE_CUDNN_BACKEND_API
+
 template <typename TBaseConvolution>
 bool convolution_with_padding(Matcher &m) {
     static_assert(std::is_same_v<TBaseConvolution, ov::op::v1::Convolution> ||
@@ -46,6 +65,14 @@ bool convolution_with_padding(Matcher &m) {
     }
     Expects(pads_begin.size() == pads_end.size());
 
+#ifdef ENABLE_CUDNN_BACKEND_API
+    if constexpr (std::is_same_v<TBaseConvolution, ov::op::v1::Convolution>) {
+        if (convolvesAsymmetricPaddingNatively(*convolution)) {
+            return false;
+        }
+    }
+#endif  // ENABLE_CUDNN_BACKEND_API
+
     const ov::Output<ov::Node> &data = convolution->input(0).get_source_output();
     const ov::Output<ov::Node> &filters = convolution->input(1).get_source_output();
 
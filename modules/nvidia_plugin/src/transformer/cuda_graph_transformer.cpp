@@ -8,6 +8,7 @@
 #include <fmt/format.h>
 
 #include "openvino/pass/manager.hpp"
+#include "openvino/pass/validate.hpp"
 #include "transformations/common_optimizations/common_optimizations.hpp"
 #include "transformations/disable_decompression_convert_constant_folding.hpp"
 #include "transformations/common_optimizations/nop_elimination.hpp"
@@ -22,13 +23,26 @@
 #include "transformer/preprocessing/preprocessing.hpp"
 
 #include "bidirectional_lstm_sequence_composition.hpp"
+#include "common_subexpression_elimination.hpp"
 #include "concat_transformation.hpp"
 #include "cuda_fullyconnected_transformation.hpp"
+#include "fuse_color_preprocessing.hpp"
+#include "fuse_compare_select.hpp"
+#include "fuse_eltwise_chains.hpp"
+#include "fold_static_shapeof.hpp"
+#include "fuse_gather_concat.hpp"
+#include "fuse_range_gather.hpp"
+#include "fuse_mha.hpp"
+#include "gpu_constant_folding.hpp"
+#include "keep_fp32_sensitive_ops.hpp"
 #include "matmul_transformations.hpp"
 #include "noop_broadcast_transformation.hpp"
 #include "nvidia/nvidia_config.hpp"
+#include "pad_fusion_transformation.hpp"
+#include "quantize_matmul_transformation.hpp"
 #include "remove_duplicated_results_transformation.hpp"
 #include "remove_redundant_convert_transformation.hpp"
+#include "split_transformation.hpp"
 #include "transformations/common_optimizations/convert_compression_only_to_legacy.hpp"
 #include "transformations/op_conversions/convert_divide.hpp"
 #include "transformations/op_conversions/convert_interpolate1_to_interpolate4.hpp"
@@ -46,6 +60,11 @@ void GraphTransformer::common_transform(const CUDA::Device& device,
                                         const Configuration& config) const {
     auto passConfig = std::make_shared<ov::pass::PassConfig>();
     ov::pass::Manager manager{passConfig};
+    // Whole-function revalidation between every pass re-infers shapes over the
+    // entire graph and dominates LoadNetwork allocation churn on large models;
+    // nodes already validate themselves on construction, so validate explicitly
+    // only after the type-changing group and once at the end of the pipeline
+    manager.set_per_pass_validation(false);
 
     passConfig->enable<ov::pass::ConvertInterpolate1ToInterpolate4>();
     passConfig->disable<ov::pass::MVN6Decomposition>();
@@ -70,9 +89,26 @@ void GraphTransformer::common_transform(const CUDA::Device& device,
 
     manager.register_pass<ov::pass::InitNodeInfo>();
     manager.register_pass<ov::nvidia_gpu::pass::AddPreprocessing>(inputInfoMap);
+    // Fold the big weight converts/transposes on the device before the common
+    // constant folding grinds through them on a single host thread
+    manager.register_pass<ov::nvidia_gpu::pass::GpuConstantFolding>(device);
+    // Materializing static shapes lets the constant folding inside
+    // CommonOptimizations evaluate the inference-invariant subgraphs hanging
+    // off ShapeOf (anchor generation, position encodings) once at load
+    manager.register_pass<ov::nvidia_gpu::pass::FoldStaticShapeOf>();
     manager.register_pass<ov::pass::CommonOptimizations>();
     manager.register_pass<ov::pass::ReshapePRelu>();
+    // Merging duplicated producers may leave several Results on one output;
+    // the pass right after removes them
+    manager.register_pass<ov::nvidia_gpu::pass::CommonSubexpressionElimination>();
     manager.register_pass<ov::nvidia_gpu::pass::RemoveDuplicatedResultsTransformation>();
+    if (isHalfSupported(device) && config.inference_precision == NVIDIA_CONFIG_VALUE(FP16)) {
+        // Whole-graph fp16 execution: convolutions and GEMMs pick tensor-core math
+        // for half data automatically; precision sensitive operations are wrapped
+        // back into fp32 by the follow-up pass
+        manager.register_pass<ov::pass::ConvertPrecision>(precisions_array{{ov::element::f32, ov::element::f16}});
+        manager.register_pass<ov::nvidia_gpu::pass::KeepFp32SensitiveOps>(config.fp32SensitiveOps());
+    }
     if (!isHalfSupported(device)) {
         manager.register_pass<ov::pass::ConvertPrecision>(ov::element::f16, ov::element::f32);
     }
@@ -80,6 +116,9 @@ void GraphTransformer::common_transform(const CUDA::Device& device,
         manager.register_pass<ov::pass::ConvertPrecision>(
             ov::element::i8, isHalfSupported(device) ? ov::element::f16 : ov::element::f32);
     }
+    // The passes below match on element types, so re-infer them once after the
+    // precision conversions instead of after every pass
+    manager.register_pass<ov::pass::Validate>();
     manager.register_pass<ov::nvidia_gpu::pass::RemoveRedundantConvertTransformation>();
     manager.register_pass<ov::nvidia_gpu::pass::BidirectionalSequenceComposition>(passConfig);
     manager.register_pass<ov::pass::ConvertSequenceToTensorIterator>();
@@ -92,8 +131,7 @@ void GraphTransformer::common_transform(const CUDA::Device& device,
             return (gru_seq->get_clip() == 0.0f &&
                     gru_seq->get_activations() == std::vector<std::string>{"sigmoid", "tanh"} &&
                     (gru_seq->get_input_size() != 1 || gru_seq->get_hidden_size() != 1) &&
-                    (gru_seq->get_direction() != ov::op::RecurrentSequenceDirection::REVERSE) &&
-                    (gru_seq->get_direction() != ov::op::RecurrentSequenceDirection::BIDIRECTIONAL));
+                    (gru_seq->get_direction() != ov::op::RecurrentSequenceDirection::REVERSE));
         } else if (const auto &lstm_seq = std::dynamic_pointer_cast<const ngraph::opset10::LSTMSequence>(node)) {
             return (lstm_seq->get_clip() == 0.0f &&
                     lstm_seq->get_activations() == std::vector<std::string>{"sigmoid", "tanh", "tanh"} &&
@@ -112,6 +150,7 @@ void GraphTransformer::common_transform(const CUDA::Device& device,
                 return is_sequence_primitive_supported(node);
             });
 
+    manager.register_pass<ov::pass::Validate>();
     manager.run_passes(model);
 
     [[maybe_unused]] const auto& transformedOps = model->get_ordered_ops();
@@ -158,18 +197,41 @@ void GraphTransformer::cuda_transform(const CUDA::Device& device,
                                       const std::shared_ptr<ov::Model>& model,
                                       const Configuration& config) const {
     ov::pass::Manager manager;
+    // Structural rewrites only; one validation at the end replaces the per-pass
+    // whole-function re-inference
+    manager.set_per_pass_validation(false);
 
+    manager.register_pass<ov::nvidia_gpu::pass::PadFusionTransformation>();
     manager.register_pass<ov::nvidia_gpu::pass::ConvolutionAsymPaddingTransformation>();
     manager.register_pass<ov::nvidia_gpu::pass::GroupConvolutionAsymPaddingTransformation>();
     manager.register_pass<ov::nvidia_gpu::pass::CudaConvolutionFusion>();
     manager.register_pass<ov::nvidia_gpu::pass::ConvolutionBackpropDataAsymPaddingTransformation>();
     manager.register_pass<ov::nvidia_gpu::pass::GroupConvolutionBackpropDataAsymPaddingTransformation>();
     manager.register_pass<ov::nvidia_gpu::pass::FusedConvBackpropDataAsymPaddingTransformation>();
+    if (isInt8Supported(device)) {
+        manager.register_pass<ov::nvidia_gpu::pass::QuantizeMatMulTransformation>();
+    }
     manager.register_pass<ov::nvidia_gpu::pass::TransposeMatMulTransformation>();
+    manager.register_pass<ov::nvidia_gpu::pass::MatMulTransposeTransformation>();
+    // After the transpose foldings so the Q*K^T MatMul carries its transpose
+    // flag, and before the MatMuls of the chain are rewritten any further
+    manager.register_pass<ov::nvidia_gpu::pass::FuseMHA>();
     manager.register_pass<ov::nvidia_gpu::pass::FullyConnectedTransformation>();
     manager.register_pass<ov::nvidia_gpu::pass::ConcatTransformation>();
+    manager.register_pass<ov::nvidia_gpu::pass::SplitTransformation>();
     manager.register_pass<ov::nvidia_gpu::pass::NoopBroadcastTransformation>();
-
+    manager.register_pass<ov::nvidia_gpu::pass::FuseColorPreprocessing>();
+    manager.register_pass<ov::nvidia_gpu::pass::FuseCompareSelect>();
+    manager.register_pass<ov::nvidia_gpu::pass::FuseEltwiseChains>();
+    manager.register_pass<ov::nvidia_gpu::pass::FuseRangeGather>();
+    // After FuseRangeGather so only Gathers with real index tensors are left
+    // for the embedding-assembly fusion
+    manager.register_pass<ov::nvidia_gpu::pass::FuseGatherConcat>();
+    // The CUDA-specific rewrites above introduce fresh constant subgraphs
+    // (e.g. weight transposes); fold them on the device as well
+    manager.register_pass<ov::nvidia_gpu::pass::GpuConstantFolding>(device);
+
+    manager.register_pass<ov::pass::Validate>();
     manager.run_passes(model);
 
     [[maybe_unused]] const auto& transformedOps = model->get_ordered_ops();
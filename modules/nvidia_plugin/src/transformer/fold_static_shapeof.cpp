@@ -0,0 +1,53 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "fold_static_shapeof.hpp"
+
+#include <ngraph/rt_info.hpp>
+#include <openvino/op/constant.hpp>
+#include <openvino/op/shape_of.hpp>
+
+#include "openvino/cc/ngraph/itt.hpp"
+#include "openvino/pass/pattern/op/wrap_type.hpp"
+
+using namespace ov::pass::pattern;
+
+namespace ov::nvidia_gpu::pass {
+
+namespace {
+
+bool fold_static_shapeof(Matcher &m) {
+    auto shape_of = m.get_match_root();
+    const auto& input_shape = shape_of->get_input_partial_shape(0);
+    if (input_shape.is_dynamic()) {
+        return false;
+    }
+    const auto& shape = input_shape.get_shape();
+    const auto out_type = shape_of->get_output_element_type(0);
+    std::shared_ptr<ov::op::v0::Constant> constant;
+    if (out_type == ov::element::i32) {
+        constant = ov::op::v0::Constant::create(
+            out_type, {shape.size()}, std::vector<std::int32_t>{shape.begin(), shape.end()});
+    } else {
+        constant = ov::op::v0::Constant::create(
+            out_type, {shape.size()}, std::vector<std::int64_t>{shape.begin(), shape.end()});
+    }
+    constant->set_friendly_name(shape_of->get_friendly_name());
+    ov::copy_runtime_info(shape_of, constant);
+    ov::replace_node(shape_of, constant);
+    return true;
+}
+
+}  // namespace
+
+FoldStaticShapeOf::FoldStaticShapeOf() {
+    MATCHER_SCOPE(FoldStaticShapeOf);
+    auto shape_of = wrap_type<ov::op::v0::ShapeOf, ov::op::v3::ShapeOf>();
+    matcher_pass_callback callback = [](Matcher &m) { return fold_static_shapeof(m); };
+
+    auto m = std::make_shared<Matcher>(shape_of, matcher_name);
+    register_matcher(m, callback);
+}
+
+}  // namespace ov::nvidia_gpu::pass
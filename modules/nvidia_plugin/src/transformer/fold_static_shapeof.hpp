@@ -0,0 +1,28 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "openvino/pass/graph_rewrite.hpp"
+
+namespace ov::nvidia_gpu::pass {
+
+/**
+ * @brief Replaces ShapeOf over a statically shaped tensor with a Constant.
+ *
+ * Inference-invariant subgraphs — position-encoding computation, the anchor
+ * generation feeding DetectionOutput — depend only on weights and on shapes,
+ * but the ShapeOf at their root keeps the common constant folding from seeing
+ * them as constant, so they re-execute on every inference. Once the shape is
+ * materialized the foldings that follow evaluate the whole subgraph here at
+ * load time, and its result reaches the device as an ordinary Constant in the
+ * immutable blob.
+ */
+class FoldStaticShapeOf : public ov::pass::MatcherPass {
+public:
+    OPENVINO_RTTI("FoldStaticShapeOf", "0");
+    FoldStaticShapeOf();
+};
+
+}  // namespace ov::nvidia_gpu::pass
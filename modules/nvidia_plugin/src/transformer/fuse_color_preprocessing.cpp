@@ -0,0 +1,204 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "openvino/cc/ngraph/itt.hpp"
+#include "fuse_color_preprocessing.hpp"
+
+#include <algorithm>
+#include <array>
+#include <ngraph/rt_info.hpp>
+#include <openvino/op/add.hpp>
+#include <openvino/op/constant.hpp>
+#include <openvino/op/convert.hpp>
+#include <openvino/op/divide.hpp>
+#include <openvino/op/i420_to_bgr.hpp>
+#include <openvino/op/i420_to_rgb.hpp>
+#include <openvino/op/interpolate.hpp>
+#include <openvino/op/multiply.hpp>
+#include <openvino/op/nv12_to_bgr.hpp>
+#include <openvino/op/nv12_to_rgb.hpp>
+#include <openvino/op/subtract.hpp>
+#include <optional>
+
+#include "nodes/fused_color_preprocess.hpp"
+
+namespace ov::nvidia_gpu::pass {
+
+namespace {
+
+using nodes::FusedColorPreprocess;
+
+bool isSupportedType(const ov::element::Type& type) {
+    return type == ov::element::u8 || type == ov::element::f16 || type == ov::element::bf16 ||
+           type == ov::element::f32;
+}
+
+/**
+ * Extracts the per-channel values of a constant that broadcasts over the
+ * channel (last) axis of the NHWC frame: either a scalar or three values
+ * along the last axis.
+ */
+std::optional<std::array<float, 3>> perChannelConstant(const ov::Node* node) {
+    const auto* constant = dynamic_cast<const ov::op::v0::Constant*>(node);
+    if (!constant) {
+        return std::nullopt;
+    }
+    const auto& shape = constant->get_shape();
+    const size_t size = ov::shape_size(shape);
+    if (size != 1 && (size != 3 || shape.empty() || shape.back() != 3)) {
+        return std::nullopt;
+    }
+    const auto values = constant->cast_vector<float>();
+    std::array<float, 3> result;
+    if (size == 1) {
+        result.fill(values[0]);
+    } else {
+        std::copy(values.begin(), values.end(), result.begin());
+    }
+    return result;
+}
+
+bool isFusibleResize(const std::shared_ptr<ov::op::v4::Interpolate>& interpolate) {
+    using IMode = ov::op::v4::Interpolate::InterpolateMode;
+    using CMode = ov::op::v4::Interpolate::CoordinateTransformMode;
+    const auto& attrs = interpolate->get_attrs();
+    if ((attrs.mode != IMode::LINEAR && attrs.mode != IMode::LINEAR_ONNX) ||
+        attrs.coordinate_transformation_mode != CMode::HALF_PIXEL || attrs.antialias) {
+        return false;
+    }
+    const auto allZero = [](const std::vector<size_t>& v) {
+        return std::all_of(v.begin(), v.end(), [](size_t p) { return p == 0; });
+    };
+    if (!allZero(attrs.pads_begin) || !allZero(attrs.pads_end)) {
+        return false;
+    }
+    if (interpolate->get_output_partial_shape(0).is_dynamic()) {
+        return false;
+    }
+    const auto& in_shape = interpolate->get_input_shape(0);
+    const auto& out_shape = interpolate->get_output_shape(0);
+    // Only the spatial axes of the NHWC frame may change
+    return out_shape.size() == 4 && out_shape[0] == in_shape[0] && out_shape[3] == in_shape[3];
+}
+
+}  // namespace
+
+bool FuseColorPreprocessing::run_on_model(const std::shared_ptr<ov::Model>& f) {
+    RUN_ON_MODEL_SCOPE(FuseColorPreprocessing);
+    bool changed = false;
+    for (const auto& node : f->get_ordered_ops()) {
+        FusedColorPreprocess::SourceFormat source_format;
+        FusedColorPreprocess::TargetFormat target_format;
+        if (ov::is_type<ov::op::v8::NV12toRGB>(node)) {
+            source_format = FusedColorPreprocess::SourceFormat::NV12;
+            target_format = FusedColorPreprocess::TargetFormat::RGB;
+        } else if (ov::is_type<ov::op::v8::NV12toBGR>(node)) {
+            source_format = FusedColorPreprocess::SourceFormat::NV12;
+            target_format = FusedColorPreprocess::TargetFormat::BGR;
+        } else if (ov::is_type<ov::op::v8::I420toRGB>(node)) {
+            source_format = FusedColorPreprocess::SourceFormat::I420;
+            target_format = FusedColorPreprocess::TargetFormat::RGB;
+        } else if (ov::is_type<ov::op::v8::I420toBGR>(node)) {
+            source_format = FusedColorPreprocess::SourceFormat::I420;
+            target_format = FusedColorPreprocess::TargetFormat::BGR;
+        } else {
+            continue;
+        }
+        if (node->get_output_partial_shape(0).is_dynamic() || !isSupportedType(node->get_input_element_type(0)) ||
+            !isSupportedType(node->get_output_element_type(0))) {
+            continue;
+        }
+
+        // Grow the chain while the current node has exactly one consumer that
+        // is a fusible preprocessing stage. The per-channel normalization of
+        // the whole chain folds into one (x - mean) * scale pair because both
+        // the resize and the arithmetic steps are affine per channel.
+        ov::NodeVector chain{node};
+        auto current = node;
+        auto out_type = node->get_output_element_type(0);
+        size_t out_h = node->get_output_shape(0)[1];
+        size_t out_w = node->get_output_shape(0)[2];
+        std::array<float, 3> mean{0.0f, 0.0f, 0.0f};
+        std::array<float, 3> scale{1.0f, 1.0f, 1.0f};
+        bool resized = false;
+        for (;;) {
+            const auto& targets = current->output(0).get_target_inputs();
+            if (targets.size() != 1) {
+                break;
+            }
+            const auto next = targets.begin()->get_node()->shared_from_this();
+            if (const auto convert = ov::as_type_ptr<ov::op::v0::Convert>(next)) {
+                if (!isSupportedType(convert->get_output_element_type(0))) {
+                    break;
+                }
+                out_type = convert->get_output_element_type(0);
+            } else if (const auto interpolate = ov::as_type_ptr<ov::op::v4::Interpolate>(next)) {
+                if (resized || !isFusibleResize(interpolate)) {
+                    break;
+                }
+                out_h = interpolate->get_output_shape(0)[1];
+                out_w = interpolate->get_output_shape(0)[2];
+                resized = true;
+            } else if (ov::is_type<ov::op::v1::Add>(next) || ov::is_type<ov::op::v1::Subtract>(next) ||
+                       ov::is_type<ov::op::v1::Multiply>(next) || ov::is_type<ov::op::v1::Divide>(next)) {
+                // The fused kernel normalizes in float and rounds once at the
+                // end, which only matches integer arithmetic step by step if
+                // there is none: require a floating point running type
+                if (!out_type.is_real()) {
+                    break;
+                }
+                const size_t data_index = targets.begin()->get_index();
+                const bool commutative = ov::is_type<ov::op::v1::Add>(next) || ov::is_type<ov::op::v1::Multiply>(next);
+                // The frame must be the left operand of non-commutative steps
+                if (data_index != 0 && !commutative) {
+                    break;
+                }
+                if (next->get_output_partial_shape(0) != current->get_output_partial_shape(0)) {
+                    break;
+                }
+                const auto values = perChannelConstant(next->get_input_node_ptr(1 - data_index));
+                if (!values) {
+                    break;
+                }
+                if (ov::is_type<ov::op::v1::Subtract>(next)) {
+                    for (size_t c = 0; c < 3; ++c) {
+                        mean[c] += (*values)[c] / scale[c];
+                    }
+                } else if (ov::is_type<ov::op::v1::Add>(next)) {
+                    for (size_t c = 0; c < 3; ++c) {
+                        mean[c] -= (*values)[c] / scale[c];
+                    }
+                } else {
+                    if (std::any_of(values->begin(), values->end(), [](float v) { return v == 0.0f; })) {
+                        break;
+                    }
+                    for (size_t c = 0; c < 3; ++c) {
+                        if (ov::is_type<ov::op::v1::Multiply>(next)) {
+                            scale[c] *= (*values)[c];
+                        } else {
+                            scale[c] /= (*values)[c];
+                        }
+                    }
+                }
+            } else {
+                break;
+            }
+            chain.push_back(next);
+            current = next;
+        }
+        if (chain.size() < 2) {
+            continue;
+        }
+
+        auto fused = std::make_shared<FusedColorPreprocess>(
+            node->input_values(), source_format, target_format, out_h, out_w, out_type, mean, scale);
+        fused->set_friendly_name(chain.back()->get_friendly_name());
+        ngraph::copy_runtime_info(chain, fused);
+        ov::replace_node(chain.back(), fused);
+        changed = true;
+    }
+    return changed;
+}
+
+}  // namespace ov::nvidia_gpu::pass
@@ -0,0 +1,28 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "openvino/pass/graph_rewrite.hpp"
+
+namespace ov::nvidia_gpu::pass {
+
+/**
+ * @brief Collapses NV12/I420 camera preprocessing chains into single
+ * nvidia_gpu::nodes::FusedColorPreprocess nodes.
+ *
+ * A chain starts at a NV12toRGB/NV12toBGR/I420toRGB/I420toBGR node and
+ * greedily absorbs the single-consumer operations that follow it: bilinear
+ * half-pixel Interpolate over the spatial axes, Convert, and per-channel
+ * Add/Subtract/Multiply/Divide with constants. The fused node executes the
+ * whole chain in one kernel, so the intermediate frames of each stage never
+ * make a global memory round trip.
+ */
+class FuseColorPreprocessing : public ov::pass::ModelPass {
+public:
+    OPENVINO_RTTI("FuseColorPreprocessing", "0");
+    bool run_on_model(const std::shared_ptr<ov::Model>& f) override;
+};
+
+}  // namespace ov::nvidia_gpu::pass
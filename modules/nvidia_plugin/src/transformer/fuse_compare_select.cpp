@@ -0,0 +1,90 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "fuse_compare_select.hpp"
+
+#include <exec_graph_info.hpp>
+#include <ngraph/rt_info.hpp>
+#include <openvino/op/greater.hpp>
+#include <openvino/op/less.hpp>
+#include <openvino/op/select.hpp>
+
+#include "nodes/fused_compare_select.hpp"
+#include "openvino/cc/ngraph/itt.hpp"
+#include "openvino/pass/pattern/op/wrap_type.hpp"
+
+using namespace ov::pass::pattern;
+
+namespace ov::nvidia_gpu::pass {
+
+namespace {
+
+constexpr auto kMaxFusedRank = 5;  // the offset tables of the kernel cover N, C, D, H, W
+
+bool fuse_compare_select(Matcher &m) {
+    auto select = std::dynamic_pointer_cast<ov::op::v1::Select>(m.get_match_root());
+    if (!select) {
+        return false;
+    }
+    const auto comparison = select->input(0).get_source_output().get_node_shared_ptr();
+    nodes::CompareKind kind;
+    if (ov::is_type<ov::op::v1::Greater>(comparison)) {
+        kind = nodes::CompareKind::Greater;
+    } else if (ov::is_type<ov::op::v1::Less>(comparison)) {
+        kind = nodes::CompareKind::Less;
+    } else {
+        return false;
+    }
+    // A mask with several consumers stays materialized: recomputing the
+    // comparison per Select would cost more than the shared packed mask
+    if (comparison->get_output_target_inputs(0).size() != 1) {
+        return false;
+    }
+    for (const auto &node : {std::static_pointer_cast<ov::Node>(select), comparison}) {
+        if (node->get_output_partial_shape(0).is_dynamic() ||
+            node->get_output_partial_shape(0).rank().get_length() > kMaxFusedRank) {
+            return false;
+        }
+        for (const auto &input : node->inputs()) {
+            if (input.get_partial_shape().is_dynamic()) {
+                return false;
+            }
+        }
+    }
+    // One element type parameterizes the fused kernel
+    if (comparison->get_input_element_type(0) != select->get_output_element_type(0)) {
+        return false;
+    }
+
+    auto fused = std::make_shared<nodes::FusedCompareSelect>(
+        ov::OutputVector{comparison->input(0).get_source_output(),
+                         comparison->input(1).get_source_output(),
+                         select->input(1).get_source_output(),
+                         select->input(2).get_source_output()},
+        kind);
+
+    fused->set_friendly_name(select->get_friendly_name());
+
+    ov::copy_runtime_info({comparison, select}, fused);
+
+    const std::string originalLayers = comparison->get_friendly_name() + "," + select->get_friendly_name();
+    fused->get_rt_info()[ExecGraphInfoSerialization::ORIGINAL_NAMES] = originalLayers;
+
+    ov::replace_node(select, fused);
+
+    return true;
+}
+
+}  // namespace
+
+FuseCompareSelect::FuseCompareSelect() {
+    MATCHER_SCOPE(FuseCompareSelect);
+    auto select = wrap_type<ov::op::v1::Select>({any_input(), any_input(), any_input()});
+    matcher_pass_callback callback = [](Matcher &m) { return fuse_compare_select(m); };
+
+    auto m = std::make_shared<Matcher>(select, matcher_name);
+    register_matcher(m, callback);
+}
+
+}  // namespace ov::nvidia_gpu::pass
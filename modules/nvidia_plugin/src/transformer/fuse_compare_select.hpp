@@ -0,0 +1,27 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "openvino/pass/graph_rewrite.hpp"
+
+namespace ov::nvidia_gpu::pass {
+
+/**
+ * @brief Collapses a Greater/Less comparison feeding exactly one Select
+ * condition into a single nvidia_gpu::nodes::FusedCompareSelect node.
+ *
+ * The standalone pair writes a full boolean tensor between the two kernels;
+ * the fused operation evaluates the predicate in registers, removing both the
+ * mask traffic and one kernel launch. Masks with several Select consumers are
+ * left to the packed-bitmask handshake (ops/packed_bool_mask.hpp), where
+ * sharing the materialized mask is cheaper than recomputing the comparison.
+ */
+class FuseCompareSelect : public ov::pass::MatcherPass {
+public:
+    OPENVINO_RTTI("FuseCompareSelect", "0");
+    FuseCompareSelect();
+};
+
+}  // namespace ov::nvidia_gpu::pass
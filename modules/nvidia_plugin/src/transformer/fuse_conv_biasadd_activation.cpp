@@ -105,6 +105,77 @@ struct FusedConvCallbacks {
         return true;
     }
 
+    static bool fuse_convolution_with_residual_add(Matcher &m) {
+        auto add = std::dynamic_pointer_cast<ov::op::v1::Add>(m.get_match_root());
+        if (!add) {
+            return false;
+        }
+
+        auto input0 = add->input(0).get_source_output().get_node_shared_ptr();
+        auto input1 = add->input(1).get_source_output().get_node_shared_ptr();
+        // dynamic_pointer_cast to the base convolution also matches already fused nodes
+        // (TFusedConvolution derives from it), which have their own residual handling
+        auto as_plain_conv = [](const std::shared_ptr<ov::Node>& node) {
+            auto conv = std::dynamic_pointer_cast<typename TFusedConvolution::BaseConvolution>(node);
+            if (!conv || std::dynamic_pointer_cast<TFusedConvolution>(node) || conv->inputs().size() != 2 ||
+                conv->output(0).get_target_inputs().size() != 1) {
+                return std::shared_ptr<typename TFusedConvolution::BaseConvolution>{};
+            }
+            return conv;
+        };
+        auto conv0 = as_plain_conv(input0);
+        auto conv1 = as_plain_conv(input1);
+
+        std::shared_ptr<typename TFusedConvolution::BaseConvolution> m_conv;
+        std::shared_ptr<ov::Node> residual;
+        if (conv0 && conv1) {
+            // Both inputs are fusable convolutions: absorb the later one, mirroring the
+            // node-order heuristic of sink_add_to_fused_convolution
+            const bool first = get_node_id(conv0) > get_node_id(conv1);
+            m_conv = first ? conv0 : conv1;
+            residual = first ? input1 : input0;
+        } else if (conv0) {
+            m_conv = conv0;
+            residual = input1;
+        } else if (conv1) {
+            m_conv = conv1;
+            residual = input0;
+        } else {
+            return false;
+        }
+
+        const ov::Output<ov::Node> &data = m_conv->input(0).get_source_output();
+        const ov::Output<ov::Node> &filters = m_conv->input(1).get_source_output();
+        // The cuDNN fused pattern always applies a bias term, so a bias-less convolution
+        // gets an all-zero per-channel constant; it is shared between blocks by the
+        // constant deduplication in OperationBuffersExtractor
+        const auto& conv_shape = m_conv->get_output_shape(0);
+        ov::Shape bias_shape(conv_shape.size(), 1);
+        bias_shape.at(1) = conv_shape.at(1);
+        const auto bias = ov::op::v0::Constant::create(m_conv->get_output_element_type(0), bias_shape, {0});
+
+        auto fused_conv = std::make_shared<TFusedConvolution>(data,
+                                                              filters,
+                                                              bias,
+                                                              residual,
+                                                              m_conv->get_strides(),
+                                                              m_conv->get_pads_begin(),
+                                                              m_conv->get_pads_end(),
+                                                              m_conv->get_dilations(),
+                                                              m_conv->get_auto_pad(),
+                                                              ActivationMode::NO_ACTIVATION);
+
+        fused_conv->set_friendly_name(add->get_friendly_name());
+        ov::copy_runtime_info({m_conv, add}, fused_conv);
+        set_node_id(fused_conv, get_node_id(add));
+
+        const std::string originalLayers = add->get_friendly_name() + "," + m_conv->get_friendly_name();
+        fused_conv->get_rt_info()[ExecGraphInfoSerialization::ORIGINAL_NAMES] = originalLayers;
+
+        ov::replace_node(m.get_match_root(), fused_conv);
+        return true;
+    }
+
     static std::pair<std::shared_ptr<TFusedConvolution>, std::shared_ptr<ov::Node>> parse_fusedconv_inputs(
         std::shared_ptr<ov::Node> add) {
         std::shared_ptr<TFusedConvolution> fused_conv = nullptr;
@@ -433,6 +504,21 @@ ov::nvidia_gpu::pass::FuseGroupConvolutionWithBiasAddAdd::FuseGroupConvolutionWi
     register_matcher(m, callback);
 }
 
+ov::nvidia_gpu::pass::FuseConvolutionWithResidualAdd::FuseConvolutionWithResidualAdd() {
+    MATCHER_SCOPE(FuseConvolutionWithResidualAdd);
+    auto conv = wrap_type<ov::op::v1::Convolution>(consumers_count(1));
+    auto add1 = wrap_type<ov::op::v1::Add>({conv, any_input()}, is_add_to_be_fused);
+    auto add2 = wrap_type<ov::op::v1::Add>({any_input(), conv}, is_add_to_be_fused);
+    auto add = std::make_shared<::op::Or>(ov::OutputVector{ add1, add2 });
+
+    matcher_pass_callback callback = [](Matcher &m) {
+        return FusedConvCallbacks<FusedConvolution>::fuse_convolution_with_residual_add(m);
+    };
+
+    auto m = std::make_shared<Matcher>(add, matcher_name);
+    register_matcher(m, callback);
+}
+
 ov::nvidia_gpu::pass::SinkActivationToFusedConvolution::SinkActivationToFusedConvolution() {
     MATCHER_SCOPE(SinkActivationToFusedConvolution);
     auto fused_convolution = wrap_type<FusedConvolution>(consumers_count(1));
@@ -457,6 +543,7 @@ bool ov::nvidia_gpu::pass::CudaConvolutionFusion::run_on_model(const std::shared
     auto fuse_conv_bias_add_activation = manager.register_pass<ov::pass::GraphRewrite>();
     ADD_MATCHER(fuse_conv_bias_add_activation, FuseConvolutionWithBiasAdd)
     ADD_MATCHER(fuse_conv_bias_add_activation, FuseConvolutionWithBiasAddAdd)
+    ADD_MATCHER(fuse_conv_bias_add_activation, FuseConvolutionWithResidualAdd)
     ADD_MATCHER(fuse_conv_bias_add_activation, SinkActivationToFusedConvolution)
     fuse_conv_bias_add_activation->set_name("ov::nvidia_gpu::pass::fuse_conv_bias_add_activation");
 
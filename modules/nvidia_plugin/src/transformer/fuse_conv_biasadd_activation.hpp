@@ -39,6 +39,17 @@ public:
     FuseConvolutionWithBiasAddAdd();
 };
 
+/**
+ * Fuses a bias-less Convolution followed by a residual Add (skip connection) into
+ * FusedConvolution with a zero bias constant, so ResNet-style Conv->Add->ReLU blocks
+ * run as a single cuDNN conv+add+bias+act graph instead of three operations.
+ */
+class FuseConvolutionWithResidualAdd : public ov::pass::MatcherPass {
+public:
+    OPENVINO_RTTI("FuseConvolutionWithResidualAdd", "0");
+    FuseConvolutionWithResidualAdd();
+};
+
 class FuseGroupConvolutionWithBiasAddAdd : public ov::pass::MatcherPass {
 public:
     OPENVINO_RTTI("FuseGroupConvolutionWithBiasAddAdd", "0");
@@ -0,0 +1,147 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "openvino/cc/ngraph/itt.hpp"
+#include "fuse_eltwise_chains.hpp"
+
+#include <ngraph/rt_info.hpp>
+#include <openvino/op/add.hpp>
+#include <openvino/op/clamp.hpp>
+#include <openvino/op/divide.hpp>
+#include <openvino/op/multiply.hpp>
+#include <openvino/op/relu.hpp>
+#include <openvino/op/sigmoid.hpp>
+#include <openvino/op/subtract.hpp>
+#include <openvino/op/swish.hpp>
+#include <openvino/op/tanh.hpp>
+#include <optional>
+#include <unordered_set>
+
+#include "nodes/fused_elementwise.hpp"
+
+namespace ov::nvidia_gpu::pass {
+
+namespace {
+
+using nodes::EltwiseKind;
+using nodes::EltwiseStep;
+using nodes::FusedElementwise;
+
+bool isBinary(EltwiseKind kind) {
+    return kind == EltwiseKind::Add || kind == EltwiseKind::Subtract || kind == EltwiseKind::Multiply ||
+           kind == EltwiseKind::Divide;
+}
+
+bool isCommutative(EltwiseKind kind) { return kind == EltwiseKind::Add || kind == EltwiseKind::Multiply; }
+
+/**
+ * Describes the node as a chain step if it is a supported elementwise operation
+ * over a single static fp32 shape without broadcasting.
+ */
+std::optional<EltwiseStep> asEltwiseStep(const std::shared_ptr<ov::Node>& node) {
+    if (node->get_output_size() != 1 || node->get_output_element_type(0) != ov::element::f32 ||
+        node->get_output_partial_shape(0).is_dynamic()) {
+        return std::nullopt;
+    }
+    for (std::size_t i = 0; i < node->get_input_size(); ++i) {
+        if (node->get_input_partial_shape(i) != node->get_output_partial_shape(0)) {
+            return std::nullopt;
+        }
+    }
+    if (ov::is_type<ov::op::v1::Add>(node)) return EltwiseStep{EltwiseKind::Add};
+    if (ov::is_type<ov::op::v1::Subtract>(node)) return EltwiseStep{EltwiseKind::Subtract};
+    if (ov::is_type<ov::op::v1::Multiply>(node)) return EltwiseStep{EltwiseKind::Multiply};
+    if (ov::is_type<ov::op::v1::Divide>(node)) return EltwiseStep{EltwiseKind::Divide};
+    if (ov::is_type<ov::op::v0::Relu>(node)) return EltwiseStep{EltwiseKind::Relu};
+    if (ov::is_type<ov::op::v0::Sigmoid>(node)) return EltwiseStep{EltwiseKind::Sigmoid};
+    if (ov::is_type<ov::op::v0::Tanh>(node)) return EltwiseStep{EltwiseKind::Tanh};
+    if (const auto clamp = ov::as_type_ptr<ov::op::v0::Clamp>(node)) {
+        return EltwiseStep{EltwiseKind::Clamp, static_cast<float>(clamp->get_min()), static_cast<float>(clamp->get_max())};
+    }
+    if (const auto swish = ov::as_type_ptr<ov::op::v4::Swish>(node)) {
+        // Swish with an explicit beta input is not representable as a fixed step
+        if (swish->get_input_size() == 1) return EltwiseStep{EltwiseKind::Swish};
+    }
+    return std::nullopt;
+}
+
+}  // namespace
+
+bool FuseEltwiseChains::run_on_model(const std::shared_ptr<ov::Model>& f) {
+    RUN_ON_MODEL_SCOPE(FuseEltwiseChains);
+    bool changed = false;
+    std::unordered_set<ov::Node*> consumed;
+    for (const auto& node : f->get_ordered_ops()) {
+        if (consumed.count(node.get()) > 0) {
+            continue;
+        }
+        const auto headStep = asEltwiseStep(node);
+        if (!headStep) {
+            continue;
+        }
+
+        // Grow the chain while the current node has exactly one consumer which is
+        // itself a fusible elementwise operation over the same tensor shape
+        ov::NodeVector chain{node};
+        std::unordered_set<ov::Node*> inChain{node.get()};
+        auto current = node;
+        for (;;) {
+            const auto& targets = current->output(0).get_target_inputs();
+            if (targets.size() != 1) {
+                break;
+            }
+            const auto next = targets.begin()->get_node()->shared_from_this();
+            const auto step = asEltwiseStep(next);
+            if (!step || next->get_output_partial_shape(0) != node->get_output_partial_shape(0)) {
+                break;
+            }
+            if (isBinary(step->kind)) {
+                const std::size_t prevIndex = targets.begin()->get_index();
+                // The running value must be the left operand of non-commutative steps
+                if (prevIndex != 0 && !isCommutative(step->kind)) {
+                    break;
+                }
+                const auto extraProducer = next->get_input_node_ptr(1 - prevIndex);
+                // The second operand may not come from inside the chain itself
+                if (inChain.count(extraProducer) > 0) {
+                    break;
+                }
+            }
+            chain.push_back(next);
+            inChain.insert(next.get());
+            current = next;
+        }
+        if (chain.size() < 2) {
+            continue;
+        }
+
+        // The primary input is the tensor the head starts from; binary steps
+        // contribute their second operand as an extra input, in chain order
+        std::vector<EltwiseStep> steps;
+        ov::OutputVector inputs{chain.front()->input_value(0)};
+        if (isBinary(headStep->kind)) {
+            inputs.push_back(chain.front()->input_value(1));
+        }
+        steps.push_back(*headStep);
+        for (std::size_t i = 1; i < chain.size(); ++i) {
+            const auto step = asEltwiseStep(chain[i]);
+            steps.push_back(*step);
+            if (isBinary(step->kind)) {
+                const auto& chainInput0 = chain[i]->get_input_node_ptr(0);
+                const std::size_t extraIndex = inChain.count(chainInput0) > 0 ? 1 : 0;
+                inputs.push_back(chain[i]->input_value(extraIndex));
+            }
+        }
+
+        auto fused = std::make_shared<FusedElementwise>(inputs, std::move(steps));
+        fused->set_friendly_name(chain.back()->get_friendly_name());
+        ngraph::copy_runtime_info(chain, fused);
+        ov::replace_node(chain.back(), fused);
+        consumed.insert(inChain.begin(), inChain.end());
+        changed = true;
+    }
+    return changed;
+}
+
+}  // namespace ov::nvidia_gpu::pass
@@ -0,0 +1,25 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "openvino/pass/graph_rewrite.hpp"
+
+namespace ov::nvidia_gpu::pass {
+
+/**
+ * @brief Collapses maximal chains of elementwise operations into single
+ * nvidia_gpu::nodes::FusedElementwise nodes.
+ *
+ * Each fused chain is compiled into one NVRTC-generated kernel at network load
+ * time, replacing a kernel launch and a global memory round trip per operation
+ * with a single launch over registers.
+ */
+class FuseEltwiseChains : public ov::pass::ModelPass {
+public:
+    OPENVINO_RTTI("FuseEltwiseChains", "0");
+    bool run_on_model(const std::shared_ptr<ov::Model>& f) override;
+};
+
+}  // namespace ov::nvidia_gpu::pass
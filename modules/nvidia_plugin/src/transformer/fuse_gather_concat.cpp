@@ -0,0 +1,106 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "fuse_gather_concat.hpp"
+
+#include <exec_graph_info.hpp>
+#include <ngraph/rt_info.hpp>
+#include <openvino/op/concat.hpp>
+#include <openvino/op/util/gather_base.hpp>
+
+#include "nodes/gather_concat.hpp"
+#include "openvino/cc/ngraph/itt.hpp"
+#include "openvino/pass/pattern/op/wrap_type.hpp"
+
+using namespace ov::pass::pattern;
+
+namespace ov::nvidia_gpu::pass {
+
+namespace {
+
+bool is_fusible_gather(const std::shared_ptr<ov::Node>& node) {
+    const auto gather = std::dynamic_pointer_cast<ov::op::util::GatherBase>(node);
+    if (!gather || gather->get_output_target_inputs(0).size() != 1) {
+        return false;
+    }
+    if (gather->get_input_partial_shape(0).is_dynamic() || gather->get_input_partial_shape(1).is_dynamic()) {
+        return false;
+    }
+    // The fused kernel addresses one 2D table per slice by row; anything else
+    // keeps the tuned standalone Gather paths
+    if (gather->get_input_shape(0).size() != 2 || gather->get_input_shape(1).size() != 1) {
+        return false;
+    }
+    const auto indices_type = gather->get_input_element_type(1);
+    if (indices_type != ov::element::i32 && indices_type != ov::element::i64) {
+        return false;
+    }
+    return gather->get_axis() == 0;
+}
+
+bool fuse_gather_concat(Matcher &m) {
+    auto concat = std::dynamic_pointer_cast<ov::op::v0::Concat>(m.get_match_root());
+    if (!concat || concat->get_input_size() < 2 || concat->get_output_partial_shape(0).is_dynamic()) {
+        return false;
+    }
+    // Gathers of 2D tables along axis 0 produce [batch, row]; the assembly
+    // concatenates the rows, i.e. the last axis
+    int64_t axis = concat->get_axis();
+    if (axis < 0) {
+        axis += 2;
+    }
+    if (axis != 1) {
+        return false;
+    }
+    ov::NodeVector gathers;
+    ov::OutputVector fused_inputs;
+    for (const auto &input : concat->inputs()) {
+        const auto gather = input.get_source_output().get_node_shared_ptr();
+        if (!is_fusible_gather(gather)) {
+            return false;
+        }
+        // One element type and one index type parameterize the fused kernel,
+        // and all slices share the batch length
+        if (!gathers.empty() && (gather->get_input_element_type(0) != gathers.front()->get_input_element_type(0) ||
+                                 gather->get_input_element_type(1) != gathers.front()->get_input_element_type(1) ||
+                                 gather->get_input_shape(1) != gathers.front()->get_input_shape(1))) {
+            return false;
+        }
+        gathers.push_back(gather);
+        fused_inputs.push_back(gather->input(0).get_source_output());
+        fused_inputs.push_back(gather->input(1).get_source_output());
+    }
+
+    auto fused = std::make_shared<nodes::GatherConcat>(fused_inputs);
+    fused->set_friendly_name(concat->get_friendly_name());
+
+    std::string originalLayers;
+    ov::NodeVector replaced{gathers};
+    replaced.push_back(concat);
+    for (const auto &node : replaced) {
+        if (!originalLayers.empty()) {
+            originalLayers += ",";
+        }
+        originalLayers += node->get_friendly_name();
+    }
+    ov::copy_runtime_info(replaced, fused);
+    fused->get_rt_info()[ExecGraphInfoSerialization::ORIGINAL_NAMES] = originalLayers;
+
+    ov::replace_node(concat, fused);
+
+    return true;
+}
+
+}  // namespace
+
+FuseGatherConcat::FuseGatherConcat() {
+    MATCHER_SCOPE(FuseGatherConcat);
+    auto concat = wrap_type<ov::op::v0::Concat>();
+    matcher_pass_callback callback = [](Matcher &m) { return fuse_gather_concat(m); };
+
+    auto m = std::make_shared<Matcher>(concat, matcher_name);
+    register_matcher(m, callback);
+}
+
+}  // namespace ov::nvidia_gpu::pass
@@ -0,0 +1,29 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "openvino/pass/graph_rewrite.hpp"
+
+namespace ov::nvidia_gpu::pass {
+
+/**
+ * @brief Collapses a Concat fed exclusively by embedding Gathers into one
+ * nvidia_gpu::nodes::GatherConcat node.
+ *
+ * Recommendation models assemble their feature vector by gathering dozens of
+ * embedding slices and concatenating them: N gather launches, one concat
+ * launch, and every gathered element written to global memory twice. When
+ * every Concat input is a single-consumer Gather of a 2D table along axis 0
+ * with 1D indices of the shared batch length, the fused kernel gathers each
+ * slice directly into its final offset of the concat output, halving the
+ * memory traffic and collapsing N+1 launches into one.
+ */
+class FuseGatherConcat : public ov::pass::MatcherPass {
+public:
+    OPENVINO_RTTI("FuseGatherConcat", "0");
+    FuseGatherConcat();
+};
+
+}  // namespace ov::nvidia_gpu::pass
@@ -0,0 +1,180 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "fuse_mha.hpp"
+
+#include <exec_graph_info.hpp>
+#include <ngraph/rt_info.hpp>
+#include <openvino/op/add.hpp>
+#include <openvino/op/constant.hpp>
+#include <openvino/op/divide.hpp>
+#include <openvino/op/matmul.hpp>
+#include <openvino/op/multiply.hpp>
+#include <openvino/op/softmax.hpp>
+
+#include "kernels/fused_mha.hpp"
+#include "nodes/fused_mha.hpp"
+#include "openvino/cc/ngraph/itt.hpp"
+#include "openvino/pass/pattern/op/wrap_type.hpp"
+
+using namespace ov::pass::pattern;
+
+namespace ov::nvidia_gpu::pass {
+
+namespace {
+
+bool suitableNode(const std::shared_ptr<ov::Node>& node) {
+    const auto& shape = node->get_output_partial_shape(0);
+    return shape.is_static() && shape.rank() == 4 && node->get_output_target_inputs(0).size() == 1 &&
+           (node->get_output_element_type(0) == ov::element::f32 ||
+            node->get_output_element_type(0) == ov::element::f16);
+}
+
+/** Softmax axis normalized to the rank, or -1 for node types the pass does not handle */
+int64_t softmaxAxis(const std::shared_ptr<ov::Node>& node) {
+    if (const auto softmax = std::dynamic_pointer_cast<ov::op::v1::Softmax>(node)) {
+        return static_cast<int64_t>(softmax->get_axis());
+    }
+    if (const auto softmax = std::dynamic_pointer_cast<ov::op::v8::Softmax>(node)) {
+        const auto axis = softmax->get_axis();
+        return axis < 0 ? axis + 4 : axis;
+    }
+    return -1;
+}
+
+/** The scalar of a Multiply/Divide-by-constant score scaling, if the node is one */
+bool scalarScale(const std::shared_ptr<ov::Node>& node, float& scale, ov::Output<ov::Node>& scores) {
+    const bool divide = ov::is_type<ov::op::v1::Divide>(node);
+    if (!divide && !ov::is_type<ov::op::v1::Multiply>(node)) {
+        return false;
+    }
+    for (size_t i = 0; i < 2; ++i) {
+        const auto constant =
+            std::dynamic_pointer_cast<ov::op::v0::Constant>(node->input_value(i).get_node_shared_ptr());
+        if (constant && ov::shape_size(constant->get_shape()) == 1 && (!divide || i == 1)) {
+            const auto value = constant->cast_vector<float>()[0];
+            if (divide && value == 0.0f) {
+                return false;
+            }
+            scale = divide ? 1.0f / value : value;
+            scores = node->input_value(1 - i);
+            return true;
+        }
+    }
+    return false;
+}
+
+/** The additive mask operand of an Add over the scores, if the node is one */
+bool additiveMask(const std::shared_ptr<ov::Node>& node,
+                  const ov::Shape& score_shape,
+                  ov::Output<ov::Node>& mask,
+                  ov::Output<ov::Node>& scores) {
+    if (!ov::is_type<ov::op::v1::Add>(node)) {
+        return false;
+    }
+    for (size_t i = 0; i < 2; ++i) {
+        const auto& candidate = node->input_value(i).get_partial_shape();
+        if (!candidate.is_static() || candidate.rank() != 4) {
+            return false;
+        }
+        const auto shape = candidate.to_shape();
+        if (shape != score_shape && (shape[0] == score_shape[0] || shape[0] == 1) && shape[1] == 1 && shape[2] == 1 &&
+            shape[3] == score_shape[3]) {
+            mask = node->input_value(i);
+            scores = node->input_value(1 - i);
+            return true;
+        }
+    }
+    return false;
+}
+
+bool fuse_mha(Matcher& m) {
+    const auto root = std::dynamic_pointer_cast<ov::op::v0::MatMul>(m.get_match_root());
+    if (!root || root->get_transpose_a() || root->get_transpose_b()) {
+        return false;
+    }
+    const auto softmax = root->input_value(0).get_node_shared_ptr();
+    if (softmaxAxis(softmax) != 3 || !suitableNode(softmax)) {
+        return false;
+    }
+    const auto score_shape = softmax->get_output_shape(0);
+    std::vector<std::shared_ptr<ov::Node>> fused_chain{root, softmax};
+
+    // Walk the optional mask addition and score scaling, in either order
+    auto scores = softmax->input_value(0);
+    ov::Output<ov::Node> mask;
+    float scale = 1.0f;
+    for (int steps = 0; steps < 2; ++steps) {
+        const auto node = scores.get_node_shared_ptr();
+        if (!suitableNode(node)) {
+            return false;
+        }
+        float step_scale = 1.0f;
+        if (!mask.get_node() && additiveMask(node, score_shape, mask, scores)) {
+            fused_chain.push_back(node);
+        } else if (scalarScale(node, step_scale, scores)) {
+            scale *= step_scale;
+            fused_chain.push_back(node);
+        } else {
+            break;
+        }
+    }
+
+    const auto qk = std::dynamic_pointer_cast<ov::op::v0::MatMul>(scores.get_node_shared_ptr());
+    if (!qk || qk->get_transpose_a() || !qk->get_transpose_b() || !suitableNode(qk)) {
+        return false;
+    }
+    fused_chain.push_back(qk);
+
+    const auto& q = qk->input_value(0);
+    const auto& k = qk->input_value(1);
+    const auto& v = root->input_value(1);
+    for (const auto& input : {q, k, v}) {
+        if (input.get_partial_shape().is_dynamic() || input.get_partial_shape().rank() != 4 ||
+            input.get_element_type() != root->get_output_element_type(0)) {
+            return false;
+        }
+    }
+    const auto q_shape = q.get_shape();
+    const auto k_shape = k.get_shape();
+    if (k_shape != v.get_shape() || q_shape[0] != k_shape[0] || q_shape[1] != k_shape[1] ||
+        q_shape[3] != k_shape[3] || q_shape[3] > kernel::FusedMHA::kMaxHeadSize) {
+        return false;
+    }
+    if (mask.get_node() && mask.get_element_type() != root->get_output_element_type(0)) {
+        return false;
+    }
+
+    ov::OutputVector inputs{q, k, v};
+    if (mask.get_node()) {
+        inputs.push_back(mask);
+    }
+    const auto fused = std::make_shared<nodes::FusedMHA>(inputs, scale);
+    fused->set_friendly_name(root->get_friendly_name());
+
+    ov::copy_runtime_info(fused_chain, fused);
+    std::string originalLayers;
+    for (auto it = fused_chain.rbegin(); it != fused_chain.rend(); ++it) {
+        originalLayers += (originalLayers.empty() ? "" : ",") + (*it)->get_friendly_name();
+    }
+    fused->get_rt_info()[ExecGraphInfoSerialization::ORIGINAL_NAMES] = originalLayers;
+
+    ov::replace_node(root, fused);
+
+    return true;
+}
+
+}  // namespace
+
+FuseMHA::FuseMHA() {
+    MATCHER_SCOPE(FuseMHA);
+    auto softmax = wrap_type<ov::op::v1::Softmax, ov::op::v8::Softmax>();
+    auto matmul = wrap_type<ov::op::v0::MatMul>({softmax, any_input()});
+    matcher_pass_callback callback = [](Matcher& m) { return fuse_mha(m); };
+
+    auto m = std::make_shared<Matcher>(matmul, matcher_name);
+    register_matcher(m, callback);
+}
+
+}  // namespace ov::nvidia_gpu::pass
@@ -0,0 +1,29 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "openvino/pass/graph_rewrite.hpp"
+
+namespace ov::nvidia_gpu::pass {
+
+/**
+ * @brief Collapses the transformer attention subgraph
+ * MatMul(Q, K^T) -> [Multiply/Divide(scale)] -> [Add(mask)] -> Softmax ->
+ * MatMul(scores, V) into a single nvidia_gpu::nodes::FusedMHA node.
+ *
+ * The standalone chain writes the B x H x Sq x Skv score matrix to the
+ * mutable blob twice (raw scores and softmax output) and launches up to five
+ * kernels per attention layer; the fused kernel normalizes the scores online
+ * per query row, so both the score traffic and the score allocation vanish.
+ * The fusion only fires for static 4D f16/f32 graphs in the canonical
+ * [B, H, S, E] layout with head sizes the register-resident kernel covers.
+ */
+class FuseMHA : public ov::pass::MatcherPass {
+public:
+    OPENVINO_RTTI("FuseMHA", "0");
+    FuseMHA();
+};
+
+}  // namespace ov::nvidia_gpu::pass
@@ -0,0 +1,133 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "fuse_range_gather.hpp"
+
+#include <exec_graph_info.hpp>
+#include <ngraph/rt_info.hpp>
+#include <openvino/op/constant.hpp>
+#include <openvino/op/gather.hpp>
+#include <openvino/op/range.hpp>
+#include <openvino/op/util/gather_base.hpp>
+#include <optional>
+
+#include "nodes/iota_gather.hpp"
+#include "openvino/cc/ngraph/itt.hpp"
+#include "openvino/pass/pattern/op/wrap_type.hpp"
+
+using namespace ov::pass::pattern;
+
+namespace ov::nvidia_gpu::pass {
+
+namespace {
+
+struct IotaDescription {
+    std::int64_t start;
+    std::int64_t step;
+    std::size_t count;
+};
+
+std::optional<std::int64_t> scalar_constant_value(const ov::Output<ov::Node>& output) {
+    const auto constant = std::dynamic_pointer_cast<ov::op::v0::Constant>(output.get_node_shared_ptr());
+    if (!constant || ov::shape_size(constant->get_shape()) != 1 || !constant->get_element_type().is_integral_number()) {
+        return std::nullopt;
+    }
+    return constant->cast_vector<std::int64_t>().front();
+}
+
+/**
+ * Recognizes an index source generating an arithmetic progression: a Range
+ * with constant integral inputs, or the 1-D integral constant such a Range
+ * folds into. Returns its start/step/length when it is one.
+ */
+std::optional<IotaDescription> describe_iota(const ov::Output<ov::Node>& indices) {
+    const auto& shape = indices.get_partial_shape();
+    if (shape.is_dynamic() || shape.rank().get_length() != 1) {
+        return std::nullopt;
+    }
+    if (!indices.get_element_type().is_integral_number()) {
+        return std::nullopt;
+    }
+    const auto count = static_cast<std::size_t>(shape[0].get_length());
+    if (count == 0) {
+        return std::nullopt;
+    }
+    const auto node = indices.get_node_shared_ptr();
+    if (ov::is_type<ov::op::v0::Range>(node) || ov::is_type<ov::op::v4::Range>(node)) {
+        const auto start = scalar_constant_value(node->input_value(0));
+        const auto step = scalar_constant_value(node->input_value(2));
+        if (!start || !step) {
+            return std::nullopt;
+        }
+        return IotaDescription{*start, *step, count};
+    }
+    if (const auto constant = std::dynamic_pointer_cast<ov::op::v0::Constant>(node)) {
+        const auto values = constant->cast_vector<std::int64_t>();
+        const std::int64_t start = values.front();
+        const std::int64_t step = count > 1 ? values[1] - values[0] : 1;
+        for (std::size_t i = 1; i < count; ++i) {
+            if (values[i] != start + static_cast<std::int64_t>(i) * step) {
+                return std::nullopt;
+            }
+        }
+        return IotaDescription{start, step, count};
+    }
+    return std::nullopt;
+}
+
+bool fuse_range_gather(Matcher& m) {
+    const auto gather = std::dynamic_pointer_cast<ov::op::util::GatherBase>(m.get_match_root());
+    if (!gather) {
+        return false;
+    }
+    if (const auto gather_v7 = std::dynamic_pointer_cast<ov::op::v7::Gather>(gather);
+        gather_v7 && gather_v7->get_batch_dims() != 0) {
+        return false;
+    }
+    const auto& data_shape = gather->get_input_partial_shape(0);
+    if (data_shape.is_dynamic()) {
+        return false;
+    }
+    const auto iota = describe_iota(gather->input_value(1));
+    if (!iota) {
+        return false;
+    }
+    const std::int64_t axis = gather->get_axis();
+    if (axis < 0 || axis >= data_shape.rank().get_length()) {
+        return false;
+    }
+    // The progression is affine, so checking both endpoints proves every
+    // generated index valid and the fused kernel runs without bounds checks
+    const std::int64_t index_range = data_shape[axis].get_length();
+    const std::int64_t last = iota->start + static_cast<std::int64_t>(iota->count - 1) * iota->step;
+    if (iota->start < 0 || iota->start >= index_range || last < 0 || last >= index_range) {
+        return false;
+    }
+
+    auto fused = std::make_shared<nodes::IotaGather>(
+        gather->input_value(0), axis, iota->start, iota->step, iota->count);
+    fused->set_friendly_name(gather->get_friendly_name());
+
+    const auto indices_node = gather->input_value(1).get_node_shared_ptr();
+    ov::copy_runtime_info({indices_node, gather}, fused);
+    const std::string originalLayers = indices_node->get_friendly_name() + "," + gather->get_friendly_name();
+    fused->get_rt_info()[ExecGraphInfoSerialization::ORIGINAL_NAMES] = originalLayers;
+
+    ov::replace_node(gather, fused);
+
+    return true;
+}
+
+}  // namespace
+
+FuseRangeGather::FuseRangeGather() {
+    MATCHER_SCOPE(FuseRangeGather);
+    auto gather = wrap_type<ov::op::v1::Gather, ov::op::v7::Gather>();
+    matcher_pass_callback callback = [](Matcher& m) { return fuse_range_gather(m); };
+
+    auto m = std::make_shared<Matcher>(gather, matcher_name);
+    register_matcher(m, callback);
+}
+
+}  // namespace ov::nvidia_gpu::pass
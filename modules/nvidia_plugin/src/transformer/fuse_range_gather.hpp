@@ -0,0 +1,29 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "openvino/pass/graph_rewrite.hpp"
+
+namespace ov::nvidia_gpu::pass {
+
+/**
+ * @brief Replaces a Gather indexed by an arithmetic progression with an
+ * nvidia_gpu::nodes::IotaGather that generates the indices on the fly.
+ *
+ * Exporters emit Range->Gather chains where the Range materializes a large
+ * index tensor consumed exactly once; after constant folding the same pattern
+ * appears as a constant index tensor that is a progression. In both forms the
+ * fused kernel computes each index as start + i * step from the thread
+ * position, eliminating the Range kernel (or the stored constant) and the
+ * intermediate tensor. The pass proves every generated index to be inside the
+ * gathered dimension, so the fused kernel needs no bounds checks.
+ */
+class FuseRangeGather : public ov::pass::MatcherPass {
+public:
+    OPENVINO_RTTI("FuseRangeGather", "0");
+    FuseRangeGather();
+};
+
+}  // namespace ov::nvidia_gpu::pass
@@ -0,0 +1,187 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "gpu_constant_folding.hpp"
+
+#include <kernels/convert.hpp>
+#include <kernels/multiply.hpp>
+#include <kernels/transpose.hpp>
+#include <ngraph/rt_info.hpp>
+#include <openvino/op/constant.hpp>
+#include <openvino/op/convert.hpp>
+#include <openvino/op/multiply.hpp>
+#include <openvino/op/transpose.hpp>
+#include <vector>
+
+#include "ops/converters.hpp"
+
+namespace ov::nvidia_gpu::pass {
+
+namespace {
+
+// Below this the PCIe round trip costs more than folding on the host
+constexpr std::size_t kMinElementsToFold = 1u << 16;
+
+bool foldableType(const ov::element::Type& type) {
+    using ov::element::Type_t;
+    const auto raw = static_cast<Type_t>(type);
+    // Sub-byte types have no device kernels
+    if (raw == Type_t::i4 || raw == Type_t::u1 || raw == Type_t::u4) {
+        return false;
+    }
+    return raw >= Type_t::boolean && raw <= Type_t::u64;
+}
+
+std::shared_ptr<ov::op::v0::Constant> getConstant(const ov::Output<ov::Node>& output) {
+    return std::dynamic_pointer_cast<ov::op::v0::Constant>(output.get_node_shared_ptr());
+}
+
+std::shared_ptr<ov::op::v0::Constant> makeFoldedConstant(const CUDA::Stream& stream,
+                                                         const CUDA::Allocation& result,
+                                                         const ov::element::Type& type,
+                                                         const ov::Shape& shape) {
+    std::vector<std::uint8_t> host(ov::shape_size(shape) * type.size());
+    stream.download(host.data(), result, host.size());
+    stream.synchronize();
+    return std::make_shared<ov::op::v0::Constant>(type, shape, host.data());
+}
+
+std::shared_ptr<ov::op::v0::Constant> foldConvert(const CUDA::Stream& stream,
+                                                  unsigned maxThreadsPerBlock,
+                                                  const std::shared_ptr<ov::op::v0::Convert>& convert) {
+    const auto constant = getConstant(convert->input_value(0));
+    if (!constant || !foldableType(convert->get_input_element_type(0)) ||
+        !foldableType(convert->get_output_element_type(0))) {
+        return nullptr;
+    }
+    const auto& shape = convert->get_input_shape(0);
+    const std::size_t size = ov::shape_size(shape);
+    if (size < kMinElementsToFold) {
+        return nullptr;
+    }
+    const std::size_t num_blocks = (size % maxThreadsPerBlock == 0) ? (size / maxThreadsPerBlock)
+                                                                    : (size / maxThreadsPerBlock + 1);
+    const std::size_t threads_per_block = (num_blocks == 1) ? size : maxThreadsPerBlock;
+    const kernel::Convert kernel{convertDataType<kernel::Type_t>(convert->get_output_element_type(0)),
+                                 convertDataType<kernel::Type_t>(convert->get_input_element_type(0)),
+                                 size,
+                                 num_blocks,
+                                 threads_per_block};
+    const auto src = stream.malloc(size * convert->get_input_element_type(0).size());
+    const auto dst = stream.malloc(size * convert->get_output_element_type(0).size());
+    stream.upload(src, constant->get_data_ptr(), size * convert->get_input_element_type(0).size());
+    kernel(stream.get(), dst.get(), src.get());
+    return makeFoldedConstant(stream, dst, convert->get_output_element_type(0), shape);
+}
+
+std::shared_ptr<ov::op::v0::Constant> foldTranspose(const CUDA::Stream& stream,
+                                                    unsigned maxThreadsPerBlock,
+                                                    const std::shared_ptr<ov::op::v1::Transpose>& transpose) {
+    const auto constant = getConstant(transpose->input_value(0));
+    const auto permutation = getConstant(transpose->input_value(1));
+    const auto& type = transpose->get_input_element_type(0);
+    if (!constant || !permutation || !foldableType(type)) {
+        return nullptr;
+    }
+    const auto& in_shape = transpose->get_input_shape(0);
+    if (in_shape.size() > kernel::Transpose::kMaxRank) {
+        return nullptr;
+    }
+    const std::size_t size = ov::shape_size(in_shape);
+    if (size < kMinElementsToFold) {
+        return nullptr;
+    }
+    const kernel::Transpose kernel{convertDataType<kernel::Type_t>(type),
+                                   std::vector<std::size_t>{in_shape.begin(), in_shape.end()},
+                                   permutation->cast_vector<int>(),
+                                   maxThreadsPerBlock};
+    const std::size_t bytes = size * type.size();
+    const auto src = stream.malloc(bytes);
+    const auto dst = stream.malloc(bytes);
+    stream.upload(src, constant->get_data_ptr(), bytes);
+    kernel(stream.get(), src.get(), dst.get());
+    return makeFoldedConstant(stream, dst, type, transpose->get_output_shape(0));
+}
+
+std::shared_ptr<ov::op::v0::Constant> foldScale(const CUDA::Stream& stream,
+                                                unsigned maxThreadsPerBlock,
+                                                const std::shared_ptr<ov::op::v1::Multiply>& multiply) {
+    auto tensor = getConstant(multiply->input_value(0));
+    auto scale = getConstant(multiply->input_value(1));
+    const auto& type = multiply->get_output_element_type(0);
+    if (!tensor || !scale || !foldableType(type) || multiply->get_input_element_type(0) != type ||
+        multiply->get_input_element_type(1) != type) {
+        return nullptr;
+    }
+    if (ov::shape_size(tensor->get_shape()) == 1) {
+        std::swap(tensor, scale);
+    }
+    const auto& shape = multiply->get_output_shape(0);
+    // Only the pure scale form: one-element multiplier, no broadcast growth
+    if (ov::shape_size(scale->get_shape()) != 1 || shape != tensor->get_shape() || shape.empty()) {
+        return nullptr;
+    }
+    const std::size_t size = ov::shape_size(shape);
+    if (size < kMinElementsToFold) {
+        return nullptr;
+    }
+    // The scalar operand addresses element 0 for every output: zero source
+    // strides and all dimensions marked broadcasted
+    const std::size_t rank = shape.size();
+    std::vector<std::size_t> tables(2 * rank, 0);
+    for (std::size_t r = 0; r < rank; ++r) {
+        std::size_t stride = 1;
+        for (std::size_t d = r + 1; d < rank; ++d) {
+            stride *= shape[d];
+        }
+        tables[r] = stride;
+    }
+    const auto mapper_tables = stream.malloc(tables.size() * sizeof(std::size_t));
+    stream.upload(mapper_tables, tables.data(), tables.size() * sizeof(std::size_t));
+    const auto* dst_strides = static_cast<const std::size_t*>(mapper_tables.get());
+    const auto* zeros = dst_strides + rank;
+    const kernel::NumpyBroadcastMapper scale_mapper{zeros, dst_strides, zeros, rank};
+
+    const kernel::Multiply kernel{convertDataType<kernel::Type_t>(type), size, maxThreadsPerBlock};
+    const std::size_t bytes = size * type.size();
+    const auto src = stream.malloc(bytes);
+    const auto scale_src = stream.malloc(type.size());
+    const auto dst = stream.malloc(bytes);
+    stream.upload(src, tensor->get_data_ptr(), bytes);
+    stream.upload(scale_src, scale->get_data_ptr(), type.size());
+    kernel(stream.get(), src.get(), kernel::NumpyBroadcastMapper{}, scale_src.get(), scale_mapper, dst.get());
+    return makeFoldedConstant(stream, dst, type, shape);
+}
+
+}  // namespace
+
+bool GpuConstantFolding::run_on_model(const std::shared_ptr<ov::Model>& model) {
+    device_.setCurrent();
+    const CUDA::Stream stream{};
+    const auto maxThreadsPerBlock = static_cast<unsigned>(device_.props().maxThreadsPerBlock);
+
+    bool rewritten = false;
+    // Topological order folds chains in one sweep: once Transpose(Constant)
+    // becomes a Constant, a Convert above it folds in the same pass
+    for (const auto& node : model->get_ordered_ops()) {
+        std::shared_ptr<ov::op::v0::Constant> folded;
+        if (const auto convert = std::dynamic_pointer_cast<ov::op::v0::Convert>(node)) {
+            folded = foldConvert(stream, maxThreadsPerBlock, convert);
+        } else if (const auto transpose = std::dynamic_pointer_cast<ov::op::v1::Transpose>(node)) {
+            folded = foldTranspose(stream, maxThreadsPerBlock, transpose);
+        } else if (const auto multiply = std::dynamic_pointer_cast<ov::op::v1::Multiply>(node)) {
+            folded = foldScale(stream, maxThreadsPerBlock, multiply);
+        }
+        if (!folded) {
+            continue;
+        }
+        folded->set_friendly_name(node->get_friendly_name());
+        ov::copy_runtime_info(node, folded);
+        ov::replace_node(node, folded);
+        rewritten = true;
+    }
+    return rewritten;
+}
+
+}  // namespace ov::nvidia_gpu::pass
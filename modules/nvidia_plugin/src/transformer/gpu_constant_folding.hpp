@@ -0,0 +1,40 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cuda/runtime.hpp>
+
+#include "openvino/pass/pass.hpp"
+
+namespace ov::nvidia_gpu::pass {
+
+/**
+ * @brief Folds large constant subgraphs on the GPU at network load time.
+ *
+ * The generic constant folding runs element loops on a single host thread,
+ * which dominates LoadNetwork for big checkpoints (fp16 weight decompression,
+ * weight layout transposes of the plugin transformations, scale folding). This
+ * pass executes the same computations with the existing device kernels
+ * instead: the constant is uploaded once, the convert/transpose/multiply
+ * kernel produces the folded data, and the result becomes an ordinary
+ * Constant that the immutable-blob builder uploads like any other weight.
+ *
+ * Only Convert of a Constant, Transpose of a Constant by a constant
+ * permutation and Multiply of a Constant by a one-element Constant are
+ * folded, and only above a size threshold: below it the PCIe round trip
+ * costs more than folding on the host, which is left to the common
+ * constant folding.
+ */
+class GpuConstantFolding : public ov::pass::ModelPass {
+public:
+    OPENVINO_RTTI("GpuConstantFolding", "0");
+    explicit GpuConstantFolding(const CUDA::Device& device) : device_{device} {}
+    bool run_on_model(const std::shared_ptr<ov::Model>& model) override;
+
+private:
+    CUDA::Device device_;
+};
+
+}  // namespace ov::nvidia_gpu::pass
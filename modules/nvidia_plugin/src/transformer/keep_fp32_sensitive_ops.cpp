@@ -0,0 +1,55 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "openvino/cc/ngraph/itt.hpp"
+#include "keep_fp32_sensitive_ops.hpp"
+
+#include <ngraph/rt_info.hpp>
+#include <openvino/op/convert.hpp>
+
+namespace ov::nvidia_gpu::pass {
+
+KeepFp32SensitiveOps::KeepFp32SensitiveOps(std::unordered_set<std::string> opTypeNames)
+    : op_type_names_{std::move(opTypeNames)} {}
+
+bool KeepFp32SensitiveOps::run_on_model(const std::shared_ptr<ov::Model>& f) {
+    RUN_ON_MODEL_SCOPE(KeepFp32SensitiveOps);
+    bool changed = false;
+    for (const auto& node : f->get_ordered_ops()) {
+        if (op_type_names_.count(node->get_type_info().name) == 0) {
+            continue;
+        }
+
+        ov::OutputVector newInputs;
+        bool hasHalfInput = false;
+        for (std::size_t i = 0; i < node->get_input_size(); ++i) {
+            const auto input = node->input_value(i);
+            if (input.get_element_type() == ov::element::f16) {
+                newInputs.push_back(std::make_shared<ov::op::v0::Convert>(input, ov::element::f32));
+                hasHalfInput = true;
+            } else {
+                newInputs.push_back(input);
+            }
+        }
+        if (!hasHalfInput) {
+            continue;
+        }
+
+        auto fp32Node = node->clone_with_new_inputs(newInputs);
+        fp32Node->set_friendly_name(node->get_friendly_name());
+        ngraph::copy_runtime_info(node, fp32Node);
+        for (std::size_t i = 0; i < node->get_output_size(); ++i) {
+            if (node->get_output_element_type(i) == ov::element::f16) {
+                auto convertBack = std::make_shared<ov::op::v0::Convert>(fp32Node->output(i), ov::element::f16);
+                node->output(i).replace(convertBack->output(0));
+            } else {
+                node->output(i).replace(fp32Node->output(i));
+            }
+        }
+        changed = true;
+    }
+    return changed;
+}
+
+}  // namespace ov::nvidia_gpu::pass
@@ -0,0 +1,33 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <string>
+#include <unordered_set>
+
+#include "openvino/pass/graph_rewrite.hpp"
+
+namespace ov::nvidia_gpu::pass {
+
+/**
+ * @brief Keeps precision sensitive operations in fp32 after the model has been
+ * converted to fp16.
+ *
+ * Operations whose type name is in the exclusion list are re-wrapped in
+ * fp16->fp32 converts on their inputs and fp32->fp16 converts on their outputs,
+ * so reductions and normalizations keep fp32 accumulation range while the rest
+ * of the graph runs on tensor cores.
+ */
+class KeepFp32SensitiveOps : public ov::pass::ModelPass {
+public:
+    OPENVINO_RTTI("KeepFp32SensitiveOps", "0");
+    explicit KeepFp32SensitiveOps(std::unordered_set<std::string> opTypeNames);
+    bool run_on_model(const std::shared_ptr<ov::Model>& f) override;
+
+private:
+    std::unordered_set<std::string> op_type_names_;
+};
+
+}  // namespace ov::nvidia_gpu::pass
@@ -122,6 +122,47 @@ bool fuse_transpose_with_matmul(Matcher &m) {
     return true;
 }
 
+bool fuse_matmul_with_output_transpose(Matcher &m) {
+    auto transpose = std::dynamic_pointer_cast<ov::op::v1::Transpose>(m.get_match_root());
+    if (!transpose) {
+        return false;
+    }
+    auto matmul =
+        std::dynamic_pointer_cast<ov::op::v0::MatMul>(transpose->input(0).get_source_output().get_node_shared_ptr());
+    if (!matmul || matmul->output(0).get_target_inputs().size() != 1) {
+        return false;
+    }
+    auto permConstant =
+        std::dynamic_pointer_cast<ov::op::v0::Constant>(transpose->input(1).get_source_output().get_node_shared_ptr());
+    if (!verify_permutation(permConstant)) {
+        return false;
+    }
+    // MatMul extends rank-1 operands implicitly; swapping such operands would
+    // change the implied extension, so only matrix operands are folded
+    const auto a = matmul->input(0).get_source_output();
+    const auto b = matmul->input(1).get_source_output();
+    if (a.get_partial_shape().rank().is_dynamic() || a.get_partial_shape().rank().get_length() < 2 ||
+        b.get_partial_shape().rank().is_dynamic() || b.get_partial_shape().rank().get_length() < 2) {
+        return false;
+    }
+
+    // transpose(op_a(A) x op_b(B)) == op_b(B)^T x op_a(A)^T, with the batch
+    // dimensions untouched by the verified permutation
+    auto newMatMul =
+        std::make_shared<ov::op::v0::MatMul>(b, a, !matmul->get_transpose_b(), !matmul->get_transpose_a());
+
+    newMatMul->set_friendly_name(transpose->get_friendly_name());
+
+    ov::copy_runtime_info({matmul, transpose}, newMatMul);
+
+    const std::string originalLayers = matmul->get_friendly_name() + "," + transpose->get_friendly_name();
+    newMatMul->get_rt_info()[ExecGraphInfoSerialization::ORIGINAL_NAMES] = originalLayers;
+
+    ov::replace_node(transpose, newMatMul);
+
+    return true;
+}
+
 TransposeMatMulTransformation::TransposeMatMulTransformation() {
     MATCHER_SCOPE(TransposeMatMulTransformation);
     auto matmul = wrap_type<ov::op::v0::MatMul>({any_input(), any_input()});
@@ -131,4 +172,14 @@ TransposeMatMulTransformation::TransposeMatMulTransformation() {
     register_matcher(m, callback);
 }
 
+MatMulTransposeTransformation::MatMulTransposeTransformation() {
+    MATCHER_SCOPE(MatMulTransposeTransformation);
+    auto transpose =
+        wrap_type<ov::op::v1::Transpose>({wrap_type<ov::op::v0::MatMul>(), wrap_type<ov::op::v0::Constant>()});
+    matcher_pass_callback callback = [](Matcher &m) { return fuse_matmul_with_output_transpose(m); };
+
+    auto m = std::make_shared<Matcher>(transpose, matcher_name);
+    register_matcher(m, callback);
+}
+
 }  // namespace ov::nvidia_gpu::pass
@@ -14,4 +14,15 @@ public:
     TransposeMatMulTransformation();
 };
 
+/**
+ * Folds a Transpose swapping the two innermost dimensions of a MatMul result
+ * into the MatMul itself using (AB)^T == B^T A^T, so the permutation is served
+ * by the cuBLAS transpose flags instead of an explicit tensor copy.
+ */
+class MatMulTransposeTransformation : public ov::pass::MatcherPass {
+public:
+    OPENVINO_RTTI("MatMulTransposeTransformation", "0");
+    MatMulTransposeTransformation();
+};
+
 }  // namespace ov::nvidia_gpu::pass
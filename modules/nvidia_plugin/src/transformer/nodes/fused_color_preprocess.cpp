@@ -0,0 +1,53 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "fused_color_preprocess.hpp"
+
+namespace ov::nvidia_gpu::nodes {
+
+FusedColorPreprocess::FusedColorPreprocess(const ov::OutputVector& planes,
+                                           SourceFormat source_format,
+                                           TargetFormat target_format,
+                                           size_t out_h,
+                                           size_t out_w,
+                                           ov::element::Type out_type,
+                                           const std::array<float, 3>& mean,
+                                           const std::array<float, 3>& scale)
+    : ov::op::Op(planes),
+      source_format_{source_format},
+      target_format_{target_format},
+      out_h_{out_h},
+      out_w_{out_w},
+      out_type_{out_type},
+      mean_{mean},
+      scale_{scale} {
+    constructor_validate_and_infer_types();
+}
+
+bool FusedColorPreprocess::visit_attributes(ov::AttributeVisitor& visitor) {
+    // The attributes are plugin internal and the node never goes through common
+    // serialization: the chain is recreated by the fusion pass on each load
+    return true;
+}
+
+std::shared_ptr<ov::Node> FusedColorPreprocess::clone_with_new_inputs(const ov::OutputVector& new_args) const {
+    check_new_args_count(this, new_args);
+    return std::make_shared<FusedColorPreprocess>(
+        new_args, source_format_, target_format_, out_h_, out_w_, out_type_, mean_, scale_);
+}
+
+void FusedColorPreprocess::validate_and_infer_types() {
+    const size_t max_planes = source_format_ == SourceFormat::I420 ? 3 : 2;
+    NODE_VALIDATION_CHECK(this,
+                          get_input_size() >= 1 && get_input_size() <= max_planes,
+                          "FusedColorPreprocess expects one fused plane or one input per plane");
+    NODE_VALIDATION_CHECK(this, out_h_ > 0 && out_w_ > 0, "FusedColorPreprocess expects a static output size");
+    const auto& y_shape = get_input_partial_shape(0);
+    NODE_VALIDATION_CHECK(
+        this, y_shape.rank().is_static() && y_shape.rank().get_length() == 4, "Plane inputs must be 4D");
+    ov::PartialShape out_shape{y_shape[0], ov::Dimension(out_h_), ov::Dimension(out_w_), ov::Dimension(3)};
+    set_output_type(0, out_type_, out_shape);
+}
+
+}  // namespace ov::nvidia_gpu::nodes
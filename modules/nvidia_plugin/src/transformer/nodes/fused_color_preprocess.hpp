@@ -0,0 +1,62 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <array>
+#include <openvino/op/op.hpp>
+
+namespace ov::nvidia_gpu::nodes {
+
+/**
+ * @brief A camera preprocessing chain collapsed into one node.
+ *
+ * Covers YUV color conversion of NV12/I420 frames plus the operations that
+ * typically follow it on every frame: bilinear half-pixel resize, element
+ * type conversion and per-channel (x - mean) * scale normalization. The
+ * inputs are the planes of the original color conversion node (one fused
+ * plane, or two for NV12 / three for I420); the output is NHWC with three
+ * channels, in the final element type of the chain.
+ */
+class FusedColorPreprocess : public ov::op::Op {
+public:
+    OPENVINO_OP("FusedColorPreprocess", "nvidia_gpu");
+
+    enum class SourceFormat { NV12, I420 };
+    enum class TargetFormat { RGB, BGR };
+
+    FusedColorPreprocess() = default;
+    FusedColorPreprocess(const ov::OutputVector& planes,
+                         SourceFormat source_format,
+                         TargetFormat target_format,
+                         size_t out_h,
+                         size_t out_w,
+                         ov::element::Type out_type,
+                         const std::array<float, 3>& mean,
+                         const std::array<float, 3>& scale);
+
+    bool visit_attributes(ov::AttributeVisitor& visitor) override;
+
+    std::shared_ptr<ov::Node> clone_with_new_inputs(const ov::OutputVector& new_args) const override;
+
+    void validate_and_infer_types() override;
+
+    SourceFormat get_source_format() const { return source_format_; }
+    TargetFormat get_target_format() const { return target_format_; }
+    size_t get_out_h() const { return out_h_; }
+    size_t get_out_w() const { return out_w_; }
+    const std::array<float, 3>& get_mean() const { return mean_; }
+    const std::array<float, 3>& get_scale() const { return scale_; }
+
+private:
+    SourceFormat source_format_{SourceFormat::NV12};
+    TargetFormat target_format_{TargetFormat::RGB};
+    size_t out_h_{0};
+    size_t out_w_{0};
+    ov::element::Type out_type_;
+    std::array<float, 3> mean_{0.0f, 0.0f, 0.0f};
+    std::array<float, 3> scale_{1.0f, 1.0f, 1.0f};
+};
+
+}  // namespace ov::nvidia_gpu::nodes
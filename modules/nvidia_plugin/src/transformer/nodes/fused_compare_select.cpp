@@ -0,0 +1,50 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "fused_compare_select.hpp"
+
+namespace ov::nvidia_gpu::nodes {
+
+FusedCompareSelect::FusedCompareSelect(const ov::OutputVector& inputs, CompareKind compare_kind)
+    : ov::op::Op(inputs), compare_kind_{compare_kind} {
+    constructor_validate_and_infer_types();
+}
+
+bool FusedCompareSelect::visit_attributes(ov::AttributeVisitor& visitor) {
+    // CompareKind is plugin internal and the node never goes through common
+    // serialization: the pair is recreated by the fusion pass on each load
+    return true;
+}
+
+std::shared_ptr<ov::Node> FusedCompareSelect::clone_with_new_inputs(const ov::OutputVector& new_args) const {
+    check_new_args_count(this, new_args);
+    return std::make_shared<FusedCompareSelect>(new_args, compare_kind_);
+}
+
+void FusedCompareSelect::validate_and_infer_types() {
+    NODE_VALIDATION_CHECK(
+        this, get_input_size() == 4, "FusedCompareSelect expects the comparison operands and the then/else branches");
+    NODE_VALIDATION_CHECK(this,
+                          get_input_element_type(0) == get_input_element_type(1),
+                          "FusedCompareSelect comparison operands must share the element type");
+    NODE_VALIDATION_CHECK(this,
+                          get_input_element_type(2) == get_input_element_type(3),
+                          "FusedCompareSelect then/else branches must share the element type");
+    auto mask_shape = get_input_partial_shape(0);
+    NODE_VALIDATION_CHECK(
+        this,
+        ov::PartialShape::broadcast_merge_into(mask_shape, get_input_partial_shape(1), ov::op::AutoBroadcastType::NUMPY),
+        "FusedCompareSelect comparison operands are not broadcastable");
+    auto result_shape = get_input_partial_shape(2);
+    NODE_VALIDATION_CHECK(
+        this,
+        ov::PartialShape::broadcast_merge_into(result_shape, get_input_partial_shape(3), ov::op::AutoBroadcastType::NUMPY),
+        "FusedCompareSelect then/else branches are not broadcastable");
+    NODE_VALIDATION_CHECK(this,
+                          ov::PartialShape::broadcast_merge_into(result_shape, mask_shape, ov::op::AutoBroadcastType::NUMPY),
+                          "FusedCompareSelect mask is not broadcastable into the result");
+    set_output_type(0, get_input_element_type(2), result_shape);
+}
+
+}  // namespace ov::nvidia_gpu::nodes
@@ -0,0 +1,43 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <openvino/op/op.hpp>
+
+namespace ov::nvidia_gpu::nodes {
+
+/**
+ * @brief Comparison kinds a FusedCompareSelect node can start from.
+ */
+enum class CompareKind { Greater, Less };
+
+/**
+ * @brief A comparison and the Select consuming its mask collapsed into one node.
+ *
+ * Inputs 0 and 1 are the comparison operands, inputs 2 and 3 the then/else
+ * branches of the Select. The boolean mask is never materialized: the fused
+ * kernel evaluates the predicate in registers. All four inputs broadcast into
+ * the output the same numpy way the original pair did.
+ */
+class FusedCompareSelect : public ov::op::Op {
+public:
+    OPENVINO_OP("FusedCompareSelect", "nvidia_gpu");
+
+    FusedCompareSelect() = default;
+    FusedCompareSelect(const ov::OutputVector& inputs, CompareKind compare_kind);
+
+    bool visit_attributes(ov::AttributeVisitor& visitor) override;
+
+    std::shared_ptr<ov::Node> clone_with_new_inputs(const ov::OutputVector& new_args) const override;
+
+    void validate_and_infer_types() override;
+
+    CompareKind get_compare_kind() const { return compare_kind_; }
+
+private:
+    CompareKind compare_kind_ = CompareKind::Greater;
+};
+
+}  // namespace ov::nvidia_gpu::nodes
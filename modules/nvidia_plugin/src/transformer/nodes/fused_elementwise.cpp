@@ -0,0 +1,48 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "fused_elementwise.hpp"
+
+#include <algorithm>
+
+namespace ov::nvidia_gpu::nodes {
+
+FusedElementwise::FusedElementwise(const ov::OutputVector& inputs, std::vector<EltwiseStep> steps)
+    : ov::op::Op(inputs), steps_{std::move(steps)} {
+    constructor_validate_and_infer_types();
+}
+
+bool FusedElementwise::visit_attributes(ov::AttributeVisitor& visitor) {
+    // EltwiseStep is plugin internal and the node never goes through common
+    // serialization: the chain is recreated by the fusion pass on each load
+    return true;
+}
+
+std::shared_ptr<ov::Node> FusedElementwise::clone_with_new_inputs(const ov::OutputVector& new_args) const {
+    check_new_args_count(this, new_args);
+    return std::make_shared<FusedElementwise>(new_args, steps_);
+}
+
+void FusedElementwise::validate_and_infer_types() {
+    NODE_VALIDATION_CHECK(this, get_input_size() >= 1, "FusedElementwise expects at least the primary input");
+    NODE_VALIDATION_CHECK(this, !steps_.empty(), "FusedElementwise expects a non-empty chain");
+    const auto& element_type = get_input_element_type(0);
+    const auto& shape = get_input_partial_shape(0);
+    for (std::size_t i = 1; i < get_input_size(); ++i) {
+        NODE_VALIDATION_CHECK(
+            this, get_input_element_type(i) == element_type, "FusedElementwise inputs must share the element type");
+        NODE_VALIDATION_CHECK(
+            this, get_input_partial_shape(i) == shape, "FusedElementwise inputs must share the shape");
+    }
+    const auto numBinarySteps = std::count_if(steps_.begin(), steps_.end(), [](const EltwiseStep& step) {
+        return step.kind == EltwiseKind::Add || step.kind == EltwiseKind::Subtract ||
+               step.kind == EltwiseKind::Multiply || step.kind == EltwiseKind::Divide;
+    });
+    NODE_VALIDATION_CHECK(this,
+                          static_cast<std::size_t>(numBinarySteps) + 1 == get_input_size(),
+                          "FusedElementwise expects one extra input per binary step");
+    set_output_type(0, element_type, shape);
+}
+
+}  // namespace ov::nvidia_gpu::nodes
@@ -0,0 +1,56 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <openvino/op/op.hpp>
+#include <vector>
+
+namespace ov::nvidia_gpu::nodes {
+
+/**
+ * @brief Elementwise operations which can be part of a fused chain.
+ */
+enum class EltwiseKind { Add, Subtract, Multiply, Divide, Relu, Sigmoid, Tanh, Clamp, Swish };
+
+/**
+ * @brief One step of a fused elementwise chain.
+ *
+ * Binary steps consume the next extra input of the FusedElementwise node;
+ * @alpha/@beta carry Clamp min/max and are unused otherwise.
+ */
+struct EltwiseStep {
+    EltwiseKind kind;
+    float alpha = 0.0f;
+    float beta = 0.0f;
+};
+
+/**
+ * @brief A maximal chain of elementwise operations collapsed into one node.
+ *
+ * Input 0 is the primary tensor the chain starts from; inputs 1..N are the
+ * second operands of the binary steps, in chain order. All inputs and the
+ * output share the same static shape and element type, so the whole chain is
+ * executable as a single generated kernel.
+ */
+class FusedElementwise : public ov::op::Op {
+public:
+    OPENVINO_OP("FusedElementwise", "nvidia_gpu");
+
+    FusedElementwise() = default;
+    FusedElementwise(const ov::OutputVector& inputs, std::vector<EltwiseStep> steps);
+
+    bool visit_attributes(ov::AttributeVisitor& visitor) override;
+
+    std::shared_ptr<ov::Node> clone_with_new_inputs(const ov::OutputVector& new_args) const override;
+
+    void validate_and_infer_types() override;
+
+    const std::vector<EltwiseStep>& get_steps() const { return steps_; }
+
+private:
+    std::vector<EltwiseStep> steps_;
+};
+
+}  // namespace ov::nvidia_gpu::nodes
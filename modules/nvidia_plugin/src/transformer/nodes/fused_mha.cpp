@@ -0,0 +1,49 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "fused_mha.hpp"
+
+namespace ov::nvidia_gpu::nodes {
+
+FusedMHA::FusedMHA(const ov::OutputVector& inputs, float scale) : ov::op::Op(inputs), scale_{scale} {
+    constructor_validate_and_infer_types();
+}
+
+bool FusedMHA::visit_attributes(ov::AttributeVisitor& visitor) {
+    visitor.on_attribute("scale", scale_);
+    return true;
+}
+
+std::shared_ptr<ov::Node> FusedMHA::clone_with_new_inputs(const ov::OutputVector& new_args) const {
+    check_new_args_count(this, new_args);
+    return std::make_shared<FusedMHA>(new_args, scale_);
+}
+
+void FusedMHA::validate_and_infer_types() {
+    NODE_VALIDATION_CHECK(
+        this, get_input_size() == 3 || get_input_size() == 4, "FusedMHA expects Q, K, V and an optional mask");
+    const auto& element_type = get_input_element_type(0);
+    for (std::size_t i = 0; i < get_input_size(); ++i) {
+        NODE_VALIDATION_CHECK(
+            this, get_input_element_type(i) == element_type, "FusedMHA inputs must share the element type");
+        NODE_VALIDATION_CHECK(this,
+                              get_input_partial_shape(i).is_static() && get_input_partial_shape(i).rank() == 4,
+                              "FusedMHA inputs must have static 4D shapes");
+    }
+    const auto& q = get_input_shape(0);
+    const auto& k = get_input_shape(1);
+    const auto& v = get_input_shape(2);
+    NODE_VALIDATION_CHECK(this,
+                          k == v && q[0] == k[0] && q[1] == k[1] && q[3] == k[3],
+                          "FusedMHA expects Q [B, H, Sq, E] and matching K/V [B, H, Skv, E]");
+    if (has_mask()) {
+        const auto& mask = get_input_shape(3);
+        NODE_VALIDATION_CHECK(this,
+                              (mask[0] == q[0] || mask[0] == 1) && mask[1] == 1 && mask[2] == 1 && mask[3] == k[2],
+                              "FusedMHA expects an additive mask of shape [B|1, 1, 1, Skv]");
+    }
+    set_output_type(0, element_type, q);
+}
+
+}  // namespace ov::nvidia_gpu::nodes
@@ -0,0 +1,42 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <openvino/op/op.hpp>
+
+namespace ov::nvidia_gpu::nodes {
+
+/**
+ * @brief Scaled dot-product attention collapsed into one node.
+ *
+ * Stands for the MatMul(Q, K^T) -> [Multiply(scale)] -> [Add(mask)] ->
+ * Softmax -> MatMul(scores, V) subgraph of transformer models. Inputs are
+ * Q [B, H, Sq, E], K [B, H, Skv, E], V [B, H, Skv, E] and an optional
+ * additive mask [B|1, 1, 1, Skv]; the scale factor is kept as an attribute.
+ * The fused kernel normalizes the scores online per query row, so the
+ * B x H x Sq x Skv score tensor the standalone chain exchanges through the
+ * mutable blob is never materialized.
+ */
+class FusedMHA : public ov::op::Op {
+public:
+    OPENVINO_OP("FusedMHA", "nvidia_gpu");
+
+    FusedMHA() = default;
+    FusedMHA(const ov::OutputVector& inputs, float scale);
+
+    bool visit_attributes(ov::AttributeVisitor& visitor) override;
+
+    std::shared_ptr<ov::Node> clone_with_new_inputs(const ov::OutputVector& new_args) const override;
+
+    void validate_and_infer_types() override;
+
+    float get_scale() const { return scale_; }
+    bool has_mask() const { return get_input_size() == 4; }
+
+private:
+    float scale_ = 1.0f;
+};
+
+}  // namespace ov::nvidia_gpu::nodes
@@ -0,0 +1,54 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "gather_concat.hpp"
+
+namespace ov::nvidia_gpu::nodes {
+
+GatherConcat::GatherConcat(const ov::OutputVector& inputs) : ov::op::Op(inputs) {
+    constructor_validate_and_infer_types();
+}
+
+bool GatherConcat::visit_attributes(ov::AttributeVisitor& visitor) {
+    // Plugin internal: the node never goes through common serialization and is
+    // recreated by the fusion pass on each load
+    return true;
+}
+
+std::shared_ptr<ov::Node> GatherConcat::clone_with_new_inputs(const ov::OutputVector& new_args) const {
+    check_new_args_count(this, new_args);
+    return std::make_shared<GatherConcat>(new_args);
+}
+
+void GatherConcat::validate_and_infer_types() {
+    NODE_VALIDATION_CHECK(this,
+                          get_input_size() >= 4 && get_input_size() % 2 == 0,
+                          "GatherConcat expects at least two (dictionary, indices) input pairs");
+    const auto num_segments = get_input_size() / 2;
+    const auto element_type = get_input_element_type(0);
+    const auto indices_type = get_input_element_type(1);
+    const auto batch_shape = get_input_partial_shape(1);
+    ov::Dimension row_sum{0};
+    for (size_t segment = 0; segment < num_segments; ++segment) {
+        const auto& dict_shape = get_input_partial_shape(2 * segment);
+        const auto& indices_shape = get_input_partial_shape(2 * segment + 1);
+        NODE_VALIDATION_CHECK(this,
+                              get_input_element_type(2 * segment) == element_type,
+                              "GatherConcat dictionaries must share the element type");
+        NODE_VALIDATION_CHECK(this,
+                              get_input_element_type(2 * segment + 1) == indices_type,
+                              "GatherConcat index tensors must share the element type");
+        NODE_VALIDATION_CHECK(this,
+                              dict_shape.rank().is_static() && dict_shape.rank().get_length() == 2,
+                              "GatherConcat dictionaries must be 2D");
+        NODE_VALIDATION_CHECK(this,
+                              indices_shape.rank().is_static() && indices_shape.rank().get_length() == 1 &&
+                                  indices_shape[0].compatible(batch_shape[0]),
+                              "GatherConcat index tensors must be 1D with a shared batch length");
+        row_sum += dict_shape[1];
+    }
+    set_output_type(0, element_type, ov::PartialShape{batch_shape[0], row_sum});
+}
+
+}  // namespace ov::nvidia_gpu::nodes
@@ -0,0 +1,38 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <openvino/op/op.hpp>
+
+namespace ov::nvidia_gpu::nodes {
+
+/**
+ * @brief N embedding Gathers and the Concat assembling their slices collapsed
+ * into one node.
+ *
+ * Inputs come in (dictionary, indices) pairs, one pair per fused Gather, in
+ * the order the slices appear along the concatenation axis. Every dictionary
+ * is 2D gathered along axis 0, every index tensor is 1D with the shared batch
+ * length, and the output is the [batch, sum-of-row-lengths] tensor the
+ * original Concat produced. The intermediate gather outputs are never
+ * materialized: the fused kernel writes each row into its final offset.
+ */
+class GatherConcat : public ov::op::Op {
+public:
+    OPENVINO_OP("GatherConcat", "nvidia_gpu");
+
+    GatherConcat() = default;
+    explicit GatherConcat(const ov::OutputVector& inputs);
+
+    bool visit_attributes(ov::AttributeVisitor& visitor) override;
+
+    std::shared_ptr<ov::Node> clone_with_new_inputs(const ov::OutputVector& new_args) const override;
+
+    void validate_and_infer_types() override;
+
+    size_t get_num_segments() const { return get_input_size() / 2; }
+};
+
+}  // namespace ov::nvidia_gpu::nodes
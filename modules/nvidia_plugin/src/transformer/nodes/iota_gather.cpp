@@ -0,0 +1,41 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "iota_gather.hpp"
+
+namespace ov::nvidia_gpu::nodes {
+
+IotaGather::IotaGather(const ov::Output<ov::Node>& data,
+                       const std::int64_t axis,
+                       const std::int64_t start,
+                       const std::int64_t step,
+                       const std::size_t indices_count)
+    : ov::op::Op({data}), axis_{axis}, start_{start}, step_{step}, indices_count_{indices_count} {
+    constructor_validate_and_infer_types();
+}
+
+bool IotaGather::visit_attributes(ov::AttributeVisitor& visitor) {
+    // The node is plugin internal and never goes through common serialization:
+    // the fusion pass recreates it from the original pattern on each load
+    return true;
+}
+
+std::shared_ptr<ov::Node> IotaGather::clone_with_new_inputs(const ov::OutputVector& new_args) const {
+    check_new_args_count(this, new_args);
+    return std::make_shared<IotaGather>(new_args.at(0), axis_, start_, step_, indices_count_);
+}
+
+void IotaGather::validate_and_infer_types() {
+    NODE_VALIDATION_CHECK(this, get_input_size() == 1, "IotaGather expects the gathered data as its only input");
+    const auto& data_shape = get_input_partial_shape(0);
+    NODE_VALIDATION_CHECK(this, data_shape.rank().is_static(), "IotaGather requires a static data rank");
+    NODE_VALIDATION_CHECK(this,
+                          axis_ >= 0 && axis_ < data_shape.rank().get_length(),
+                          "IotaGather axis is out of the data rank");
+    auto output_shape = data_shape;
+    output_shape[axis_] = static_cast<ov::Dimension::value_type>(indices_count_);
+    set_output_type(0, get_input_element_type(0), output_shape);
+}
+
+}  // namespace ov::nvidia_gpu::nodes
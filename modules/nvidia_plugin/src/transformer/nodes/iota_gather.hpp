@@ -0,0 +1,50 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstdint>
+#include <openvino/op/op.hpp>
+
+namespace ov::nvidia_gpu::nodes {
+
+/**
+ * @brief A Gather whose index tensor is a virtual arithmetic progression.
+ *
+ * Created by the FuseRangeGather pass from Gather nodes whose indices come
+ * from a Range (or a constant that is one): the single data input is gathered
+ * along @axis with the implicit indices start, start + step, ... of
+ * @indices_count elements. The fusion pass has verified every index to lie
+ * inside the gathered dimension.
+ */
+class IotaGather : public ov::op::Op {
+public:
+    OPENVINO_OP("IotaGather", "nvidia_gpu");
+
+    IotaGather() = default;
+    IotaGather(const ov::Output<ov::Node>& data,
+               std::int64_t axis,
+               std::int64_t start,
+               std::int64_t step,
+               std::size_t indices_count);
+
+    bool visit_attributes(ov::AttributeVisitor& visitor) override;
+
+    std::shared_ptr<ov::Node> clone_with_new_inputs(const ov::OutputVector& new_args) const override;
+
+    void validate_and_infer_types() override;
+
+    std::int64_t get_axis() const { return axis_; }
+    std::int64_t get_start() const { return start_; }
+    std::int64_t get_step() const { return step_; }
+    std::size_t get_indices_count() const { return indices_count_; }
+
+private:
+    std::int64_t axis_ = 0;
+    std::int64_t start_ = 0;
+    std::int64_t step_ = 1;
+    std::size_t indices_count_ = 0;
+};
+
+}  // namespace ov::nvidia_gpu::nodes
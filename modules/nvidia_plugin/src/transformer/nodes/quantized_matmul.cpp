@@ -0,0 +1,51 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "quantized_matmul.hpp"
+
+namespace ov::nvidia_gpu::nodes {
+
+QuantizedMatMul::QuantizedMatMul(
+    const ov::Output<Node>& A, const ov::Output<Node>& B, float input_scale, float dequant_scale, bool transpose_b)
+    : ov::op::Op(ov::OutputVector{A, B}),
+      input_scale_{input_scale},
+      dequant_scale_{dequant_scale},
+      transpose_b_{transpose_b} {
+    constructor_validate_and_infer_types();
+}
+
+bool QuantizedMatMul::visit_attributes(ov::AttributeVisitor& visitor) {
+    visitor.on_attribute("input_scale", input_scale_);
+    visitor.on_attribute("dequant_scale", dequant_scale_);
+    visitor.on_attribute("transpose_b", transpose_b_);
+    return true;
+}
+
+std::shared_ptr<ov::Node> QuantizedMatMul::clone_with_new_inputs(const ov::OutputVector& new_args) const {
+    check_new_args_count(this, new_args);
+    return std::make_shared<QuantizedMatMul>(
+        new_args.at(0), new_args.at(1), input_scale_, dequant_scale_, transpose_b_);
+}
+
+void QuantizedMatMul::validate_and_infer_types() {
+    NODE_VALIDATION_CHECK(this, get_input_size() == 2, "QuantizedMatMul expects an activation and a weight input");
+    NODE_VALIDATION_CHECK(
+        this, get_input_element_type(0) == ov::element::f32, "QuantizedMatMul activation must be f32");
+    NODE_VALIDATION_CHECK(this, get_input_element_type(1) == ov::element::i8, "QuantizedMatMul weights must be i8");
+    const auto& aShape = get_input_partial_shape(0);
+    const auto& bShape = get_input_partial_shape(1);
+    NODE_VALIDATION_CHECK(this, aShape.is_static() && bShape.is_static(), "QuantizedMatMul expects static shapes");
+    const auto a = aShape.to_shape();
+    const auto b = bShape.to_shape();
+    NODE_VALIDATION_CHECK(this, a.size() >= 2 && b.size() == 2, "QuantizedMatMul expects [..., M, K] x 2D weights");
+    const auto k = a.back();
+    const auto bK = transpose_b_ ? b[1] : b[0];
+    const auto bN = transpose_b_ ? b[0] : b[1];
+    NODE_VALIDATION_CHECK(this, k == bK, "QuantizedMatMul reduction dimensions must match");
+    auto outputShape = a;
+    outputShape.back() = bN;
+    set_output_type(0, ov::element::f32, outputShape);
+}
+
+}  // namespace ov::nvidia_gpu::nodes
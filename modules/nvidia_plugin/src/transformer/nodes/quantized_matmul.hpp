@@ -0,0 +1,46 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <openvino/op/op.hpp>
+
+namespace ov::nvidia_gpu::nodes {
+
+/**
+ * @brief MatMul lowered to int8 execution.
+ *
+ * Input 0 is the fp32 activation which the operation quantizes on the fly with
+ * @input_scale; input 1 is the offline-quantized int8 weight matrix. The int32
+ * accumulator is dequantized back to fp32 by @dequant_scale fused into the GEMM
+ * epilogue, so the node consumes and produces plain fp32 tensors.
+ */
+class QuantizedMatMul : public ov::op::Op {
+public:
+    OPENVINO_OP("QuantizedMatMul", "nvidia_gpu");
+
+    QuantizedMatMul() = default;
+    QuantizedMatMul(const ov::Output<Node>& A,
+                    const ov::Output<Node>& B,
+                    float input_scale,
+                    float dequant_scale,
+                    bool transpose_b);
+
+    bool visit_attributes(ov::AttributeVisitor& visitor) override;
+
+    std::shared_ptr<ov::Node> clone_with_new_inputs(const ov::OutputVector& new_args) const override;
+
+    void validate_and_infer_types() override;
+
+    float get_input_scale() const { return input_scale_; }
+    float get_dequant_scale() const { return dequant_scale_; }
+    bool get_transpose_b() const { return transpose_b_; }
+
+private:
+    float input_scale_ = 1.0f;
+    float dequant_scale_ = 1.0f;
+    bool transpose_b_ = false;
+};
+
+}  // namespace ov::nvidia_gpu::nodes
@@ -0,0 +1,21 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <openvino/op/split.hpp>
+
+namespace ov::nvidia_gpu::nodes {
+
+class SplitOptimized : public ov::op::v1::Split {
+public:
+    using ov::op::v1::Split::Split;
+
+    OPENVINO_OP("SplitOptimized", "nvidia_gpu", ov::op::v1::Split);
+
+    std::shared_ptr<Node> clone_with_new_inputs(const ov::OutputVector& new_args) const override {
+        return std::make_shared<SplitOptimized>(new_args.at(0), new_args.at(1), get_num_splits());
+    }
+};
+}  // namespace ov::nvidia_gpu::nodes
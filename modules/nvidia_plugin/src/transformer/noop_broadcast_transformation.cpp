@@ -8,6 +8,8 @@
 #include <gsl/gsl_assert>
 #include "openvino/pass/pattern/op/wrap_type.hpp"
 #include <openvino/op/broadcast.hpp>
+#include <openvino/op/prelu.hpp>
+#include <openvino/op/util/binary_elementwise_arithmetic.hpp>
 
 using namespace ov::pass::pattern;
 
@@ -27,6 +29,52 @@ bool eliminate_noop_broadcast(Matcher &m) {
     return ov::replace_output_update_name(node->output(0), node->input_value(0));
 }
 
+/**
+ * Eliminates a numpy-style Broadcast all of whose consumers are elementwise
+ * binary operations. Those operations already broadcast each input to the
+ * output shape in-register through NumpyBroadcastMapper, so materializing the
+ * broadcasted tensor only wastes memory and bandwidth. The broadcast is kept
+ * whenever removing it would shrink any consumer's output shape.
+ */
+bool eliminate_broadcast_before_elementwise(Matcher &m) {
+    auto node = std::dynamic_pointer_cast<ov::op::v3::Broadcast>(m.get_match_root());
+    Expects(node);
+
+    const auto broadcast_type = node->get_broadcast_spec().m_type;
+    if (broadcast_type != ov::op::BroadcastType::NUMPY && broadcast_type != ov::op::BroadcastType::BIDIRECTIONAL) {
+        return false;
+    }
+
+    const ov::PartialShape in_shape{node->get_input_shape(0)};
+    for (const auto &target : node->output(0).get_target_inputs()) {
+        const auto *consumer = target.get_node();
+        if (const auto *arithmetic = dynamic_cast<const ov::op::util::BinaryElementwiseArithmetic *>(consumer)) {
+            if (arithmetic->get_autob().m_type != ov::op::AutoBroadcastType::NUMPY) {
+                return false;
+            }
+        } else if (!dynamic_cast<const ov::op::v0::PRelu *>(consumer)) {
+            return false;
+        }
+        if (consumer->get_input_size() != 2) {
+            return false;
+        }
+
+        // The consumer keeps its output shape only if the un-broadcasted input
+        // still numpy-broadcasts with the other input to the very same shape
+        const auto &other = consumer->input_value(1 - target.get_index());
+        const auto other_shape = (other == node->output(0)) ? in_shape : other.get_partial_shape();
+        auto merged_shape = in_shape;
+        if (!ov::PartialShape::broadcast_merge_into(merged_shape, other_shape, ov::op::AutoBroadcastType::NUMPY)) {
+            return false;
+        }
+        if (merged_shape != consumer->get_output_partial_shape(0)) {
+            return false;
+        }
+    }
+
+    return ov::replace_output_update_name(node->output(0), node->input_value(0));
+}
+
 }  // namespace
 
 NoopBroadcastTransformation::NoopBroadcastTransformation() {
@@ -34,7 +82,9 @@ NoopBroadcastTransformation::NoopBroadcastTransformation() {
     const auto op = wrap_type<ov::op::v3::Broadcast>();
     const auto m = std::make_shared<Matcher>(op, matcher_name);
 
-    matcher_pass_callback callback = [](Matcher &m) { return eliminate_noop_broadcast(m); };
+    matcher_pass_callback callback = [](Matcher &m) {
+        return eliminate_noop_broadcast(m) || eliminate_broadcast_before_elementwise(m);
+    };
 
     register_matcher(m, callback);
 }
@@ -0,0 +1,168 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "pad_fusion_transformation.hpp"
+
+#include <exec_graph_info.hpp>
+#include <ngraph/rt_info.hpp>
+#include <openvino/op/avg_pool.hpp>
+#include <openvino/op/constant.hpp>
+#include <openvino/op/convolution.hpp>
+#include <openvino/op/pad.hpp>
+
+#include "openvino/cc/ngraph/itt.hpp"
+#include "openvino/pass/pattern/op/wrap_type.hpp"
+
+using namespace ov::pass::pattern;
+
+namespace ov::nvidia_gpu::pass {
+
+namespace {
+
+bool zero_pad_value(const std::shared_ptr<ov::op::v1::Pad> &pad) {
+    if (pad->get_input_size() < 4) {
+        return true;
+    }
+    const auto value =
+        std::dynamic_pointer_cast<ov::op::v0::Constant>(pad->input(3).get_source_output().get_node_shared_ptr());
+    if (!value) {
+        return false;
+    }
+    const auto data = value->cast_vector<double>();
+    return data.size() == 1 && data.front() == 0.0;
+}
+
+/** Extracts constant non-negative pads touching only the spatial dimensions */
+bool spatial_pads(const std::shared_ptr<ov::op::v1::Pad> &pad,
+                  std::vector<int64_t> &begin,
+                  std::vector<int64_t> &end) {
+    const auto begin_const =
+        std::dynamic_pointer_cast<ov::op::v0::Constant>(pad->input(1).get_source_output().get_node_shared_ptr());
+    const auto end_const =
+        std::dynamic_pointer_cast<ov::op::v0::Constant>(pad->input(2).get_source_output().get_node_shared_ptr());
+    if (!begin_const || !end_const) {
+        return false;
+    }
+    begin = begin_const->cast_vector<int64_t>();
+    end = end_const->cast_vector<int64_t>();
+    if (begin.size() != end.size() || begin.size() < 3) {
+        return false;
+    }
+    const auto negative = [](int64_t value) { return value < 0; };
+    if (std::any_of(begin.begin(), begin.end(), negative) || std::any_of(end.begin(), end.end(), negative)) {
+        return false;
+    }
+    return begin[0] == 0 && begin[1] == 0 && end[0] == 0 && end[1] == 0;
+}
+
+bool fuse_pad_into_consumer(Matcher &m) {
+    auto pad = std::dynamic_pointer_cast<ov::op::v1::Pad>(m.get_match_root());
+    if (!pad || pad->get_pad_mode() != ov::op::PadMode::CONSTANT ||
+        pad->get_output_partial_shape(0).is_dynamic() || !zero_pad_value(pad)) {
+        return false;
+    }
+    std::vector<int64_t> begin;
+    std::vector<int64_t> end;
+    if (!spatial_pads(pad, begin, end)) {
+        return false;
+    }
+    const auto targets = pad->get_output_target_inputs(0);
+    if (targets.size() != 1 || targets.begin()->get_index() != 0) {
+        return false;
+    }
+    const auto consumer = targets.begin()->get_node()->shared_from_this();
+    const auto data = pad->input(0).get_source_output();
+
+    std::shared_ptr<ov::Node> replacement;
+    if (const auto conv = std::dynamic_pointer_cast<ov::op::v1::Convolution>(consumer)) {
+        auto pads_begin = conv->get_pads_begin();
+        auto pads_end = conv->get_pads_end();
+        if (pads_begin.size() + 2 != begin.size() || pads_end.size() + 2 != end.size()) {
+            return false;
+        }
+        for (std::size_t i = 0; i < pads_begin.size(); ++i) {
+            pads_begin[i] += begin[i + 2];
+            pads_end[i] += end[i + 2];
+        }
+#ifdef ENABLE_CUDNN_BACKEND_API
+        // Mirrors the native asymmetric padding criteria of
+        // convolution_asym_padding_transformation.cpp: the backend API runs
+        // asymmetric pads directly for plain 2D float convolutions
+        const bool asymmetric_supported =
+            begin.size() == 4 &&
+            (data.get_element_type() == ov::element::f16 || data.get_element_type() == ov::element::f32);
+#else
+        const bool asymmetric_supported = false;
+#endif
+        if (pads_begin != pads_end && !asymmetric_supported) {
+            return false;
+        }
+        replacement = std::make_shared<ov::op::v1::Convolution>(data,
+                                                                conv->input(1).get_source_output(),
+                                                                conv->get_strides(),
+                                                                pads_begin,
+                                                                pads_end,
+                                                                conv->get_dilations(),
+                                                                ov::op::PadType::EXPLICIT);
+    } else if (const auto avg_pool = std::dynamic_pointer_cast<ov::op::v1::AvgPool>(consumer)) {
+        // Averaging the materialized zeros equals counting padding in the
+        // denominator; exclude_pad pools would change their result
+        if (avg_pool->get_exclude_pad()) {
+            return false;
+        }
+        auto pads_begin = avg_pool->get_pads_begin();
+        auto pads_end = avg_pool->get_pads_end();
+        if (pads_begin.size() + 2 != begin.size() || pads_end.size() + 2 != end.size()) {
+            return false;
+        }
+        for (std::size_t i = 0; i < pads_begin.size(); ++i) {
+            pads_begin[i] += static_cast<std::size_t>(begin[i + 2]);
+            pads_end[i] += static_cast<std::size_t>(end[i + 2]);
+        }
+        // The cuDNN pooling descriptor only expresses symmetric padding
+        if (pads_begin != pads_end) {
+            return false;
+        }
+        replacement = std::make_shared<ov::op::v1::AvgPool>(data,
+                                                            avg_pool->get_strides(),
+                                                            pads_begin,
+                                                            pads_end,
+                                                            avg_pool->get_kernel(),
+                                                            avg_pool->get_exclude_pad(),
+                                                            avg_pool->get_rounding_type(),
+                                                            ov::op::PadType::EXPLICIT);
+    } else {
+        return false;
+    }
+
+    // The pads must reproduce the consumer's output exactly, otherwise the
+    // window placement differed from plain zero padding
+    if (replacement->get_output_partial_shape(0) != consumer->get_output_partial_shape(0)) {
+        return false;
+    }
+
+    replacement->set_friendly_name(consumer->get_friendly_name());
+
+    ov::copy_runtime_info({std::static_pointer_cast<ov::Node>(pad), consumer}, replacement);
+
+    const std::string originalLayers = pad->get_friendly_name() + "," + consumer->get_friendly_name();
+    replacement->get_rt_info()[ExecGraphInfoSerialization::ORIGINAL_NAMES] = originalLayers;
+
+    ov::replace_node(consumer, replacement);
+
+    return true;
+}
+
+}  // namespace
+
+PadFusionTransformation::PadFusionTransformation() {
+    MATCHER_SCOPE(PadFusionTransformation);
+    auto pad = wrap_type<ov::op::v1::Pad>();
+    matcher_pass_callback callback = [](Matcher &m) { return fuse_pad_into_consumer(m); };
+
+    auto m = std::make_shared<Matcher>(pad, matcher_name);
+    register_matcher(m, callback);
+}
+
+}  // namespace ov::nvidia_gpu::pass
@@ -0,0 +1,28 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "openvino/pass/graph_rewrite.hpp"
+
+namespace ov::nvidia_gpu::pass {
+
+/**
+ * @brief Folds an explicit zero Pad into the padding attributes of its single
+ * Convolution or AvgPool consumer.
+ *
+ * The Pad kernel writes a full padded tensor only for the consumer to read it
+ * once; cuDNN handles the same zero boundary implicitly through the descriptor
+ * padding, so folding skips the materialization entirely. MaxPool is excluded
+ * because cuDNN treats its padding as -infinity while a real zero Pad
+ * contributes zeros, and AvgPool is folded only when it already counts padding
+ * in the denominator, matching what averaging the materialized zeros computes.
+ */
+class PadFusionTransformation : public ov::pass::MatcherPass {
+public:
+    OPENVINO_RTTI("PadFusionTransformation", "0");
+    PadFusionTransformation();
+};
+
+}  // namespace ov::nvidia_gpu::pass
@@ -0,0 +1,174 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "openvino/cc/ngraph/itt.hpp"
+#include "quantize_matmul_transformation.hpp"
+
+#include <cmath>
+#include <cstdint>
+#include <ngraph/rt_info.hpp>
+#include <openvino/op/constant.hpp>
+#include <openvino/op/fake_quantize.hpp>
+#include <openvino/op/matmul.hpp>
+#include <optional>
+#include <vector>
+
+#include "nodes/quantized_matmul.hpp"
+#include "openvino/pass/pattern/op/wrap_type.hpp"
+
+using namespace ov::pass::pattern;
+
+namespace ov::nvidia_gpu::pass {
+
+namespace {
+
+/**
+ * Returns the value of a scalar f32 constant output, or nullopt if the output
+ * is not such a constant.
+ */
+std::optional<float> scalar_value(const ov::Output<ov::Node>& output) {
+    auto constant = std::dynamic_pointer_cast<ov::op::v0::Constant>(output.get_node_shared_ptr());
+    if (!constant || ov::shape_size(constant->get_shape()) != 1 ||
+        constant->get_element_type() != ov::element::f32) {
+        return std::nullopt;
+    }
+    return constant->cast_vector<float>().at(0);
+}
+
+/**
+ * Extracts a symmetric per-tensor quantization scale from a FakeQuantize whose
+ * input and output ranges coincide. Returns nullopt for asymmetric or
+ * per-channel ranges, which the int8 GEMM epilogue cannot express.
+ */
+std::optional<float> symmetric_scale(const std::shared_ptr<ov::op::v0::FakeQuantize>& fq) {
+    if (fq->get_levels() != 256) {
+        return std::nullopt;
+    }
+    const auto inLow = scalar_value(fq->input_value(1));
+    const auto inHigh = scalar_value(fq->input_value(2));
+    const auto outLow = scalar_value(fq->input_value(3));
+    const auto outHigh = scalar_value(fq->input_value(4));
+    if (!inLow || !inHigh || !outLow || !outHigh) {
+        return std::nullopt;
+    }
+    if (!(*inLow < 0.0f) || !(*inHigh > 0.0f)) {
+        return std::nullopt;
+    }
+    const auto tolerance = 1e-3f * *inHigh;
+    if (std::fabs(*inLow - *outLow) > tolerance || std::fabs(*inHigh - *outHigh) > tolerance) {
+        return std::nullopt;
+    }
+    // Accept both [-h, h] and the typical [-128*s, 127*s] layout
+    if (std::fabs(*inLow + *inHigh) > tolerance &&
+        std::fabs(*inLow * 127.0f + *inHigh * 128.0f) > 128.0f * tolerance) {
+        return std::nullopt;
+    }
+    return *inHigh / 127.0f;
+}
+
+std::int8_t quantize(float value, float scale) {
+    const auto quantized = std::nearbyint(value / scale);
+    return static_cast<std::int8_t>(std::fmin(std::fmax(quantized, -127.0f), 127.0f));
+}
+
+bool lower_matmul_to_int8(Matcher& m) {
+    auto matmul = std::dynamic_pointer_cast<ov::op::v0::MatMul>(m.get_match_root());
+    if (!matmul || matmul->get_transpose_a()) {
+        return false;
+    }
+    if (matmul->get_output_element_type(0) != ov::element::f32 ||
+        !matmul->get_output_partial_shape(0).is_static()) {
+        return false;
+    }
+
+    auto activationFq = std::dynamic_pointer_cast<ov::op::v0::FakeQuantize>(
+        matmul->input_value(0).get_node_shared_ptr());
+    if (!activationFq) {
+        return false;
+    }
+    const auto activationScale = symmetric_scale(activationFq);
+    if (!activationScale) {
+        return false;
+    }
+
+    // Weights are either a plain constant or a constant behind its own FakeQuantize
+    auto weightsSource = matmul->input_value(1);
+    auto weightsFq = std::dynamic_pointer_cast<ov::op::v0::FakeQuantize>(weightsSource.get_node_shared_ptr());
+    std::optional<float> weightScale;
+    if (weightsFq) {
+        weightScale = symmetric_scale(weightsFq);
+        if (!weightScale) {
+            return false;
+        }
+        weightsSource = weightsFq->input_value(0);
+    }
+    auto weights = std::dynamic_pointer_cast<ov::op::v0::Constant>(weightsSource.get_node_shared_ptr());
+    if (!weights || weights->get_element_type() != ov::element::f32 || weights->get_shape().size() != 2) {
+        return false;
+    }
+
+    const auto& activationShape = activationFq->get_input_partial_shape(0);
+    if (activationShape.is_dynamic() || activationShape.size() < 2) {
+        return false;
+    }
+    const auto aShape = activationShape.to_shape();
+    const auto& bShape = weights->get_shape();
+    const auto k = aShape.back();
+    if (k != (matmul->get_transpose_b() ? bShape[1] : bShape[0])) {
+        return false;
+    }
+    // cuBLAS int8 GEMM requires leading dimensions to be multiples of four
+    if (k % 4 != 0 || bShape.back() % 4 != 0) {
+        return false;
+    }
+
+    const auto weightValues = weights->cast_vector<float>();
+    if (!weightScale) {
+        float maxAbs = 0.0f;
+        for (const auto value : weightValues) {
+            maxAbs = std::fmax(maxAbs, std::fabs(value));
+        }
+        if (maxAbs == 0.0f) {
+            return false;
+        }
+        weightScale = maxAbs / 127.0f;
+    }
+    std::vector<std::int8_t> quantizedValues;
+    quantizedValues.reserve(weightValues.size());
+    for (const auto value : weightValues) {
+        quantizedValues.push_back(quantize(value, *weightScale));
+    }
+
+    auto quantizedWeights = std::make_shared<ov::op::v0::Constant>(ov::element::i8, bShape, quantizedValues);
+    quantizedWeights->set_friendly_name(weights->get_friendly_name() + "/quantized");
+
+    auto quantizedMatMul = std::make_shared<nodes::QuantizedMatMul>(activationFq->input_value(0),
+                                                                    quantizedWeights,
+                                                                    *activationScale,
+                                                                    *activationScale * *weightScale,
+                                                                    matmul->get_transpose_b());
+    quantizedMatMul->set_friendly_name(matmul->get_friendly_name());
+
+    ov::NodeVector fusedNodes{activationFq, matmul, weights};
+    if (weightsFq) {
+        fusedNodes.push_back(weightsFq);
+    }
+    ov::copy_runtime_info(fusedNodes, {quantizedMatMul, quantizedWeights});
+    ov::replace_node(matmul, quantizedMatMul);
+
+    return true;
+}
+
+}  // namespace
+
+QuantizeMatMulTransformation::QuantizeMatMulTransformation() {
+    MATCHER_SCOPE(QuantizeMatMulTransformation);
+    auto matmul = wrap_type<ov::op::v0::MatMul>({wrap_type<ov::op::v0::FakeQuantize>(), any_input()});
+    matcher_pass_callback callback = [](Matcher& m) { return lower_matmul_to_int8(m); };
+
+    auto m = std::make_shared<Matcher>(matmul, matcher_name);
+    register_matcher(m, callback);
+}
+
+}  // namespace ov::nvidia_gpu::pass
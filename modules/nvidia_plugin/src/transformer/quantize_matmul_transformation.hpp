@@ -0,0 +1,26 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "openvino/pass/graph_rewrite.hpp"
+
+namespace ov::nvidia_gpu::pass {
+
+/**
+ * @brief Lowers FakeQuantize driven MatMuls to int8 execution.
+ *
+ * Matches MatMul whose activation comes from a symmetric per-tensor
+ * FakeQuantize (256 levels) and whose weights are constant (optionally behind
+ * their own FakeQuantize). The weight constant is quantized to int8 offline
+ * and the pair is replaced by a nvidia_gpu::nodes::QuantizedMatMul node which
+ * runs the GEMM in int8 with dequantization fused into the epilogue.
+ */
+class QuantizeMatMulTransformation : public ov::pass::MatcherPass {
+public:
+    OPENVINO_RTTI("QuantizeMatMulTransformation", "0");
+    QuantizeMatMulTransformation();
+};
+
+}  // namespace ov::nvidia_gpu::pass
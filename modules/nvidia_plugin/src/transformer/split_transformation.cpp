@@ -0,0 +1,90 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "openvino/cc/ngraph/itt.hpp"
+#include "split_transformation.hpp"
+
+#include <numeric>
+#include "openvino/pass/pattern/op/wrap_type.hpp"
+#include <ngraph/rt_info.hpp>
+#include <openvino/op/concat.hpp>
+#include <openvino/op/constant.hpp>
+#include <openvino/op/result.hpp>
+#include <openvino/op/split.hpp>
+
+#include "nodes/split_optimized.hpp"
+
+using namespace ov::pass::pattern;
+
+namespace ov::nvidia_gpu::pass {
+namespace {
+bool change_split_to_split_optimized(Matcher& m) {
+    using ov::nvidia_gpu::nodes::SplitOptimized;
+
+    auto split = std::dynamic_pointer_cast<ov::op::v1::Split>(m.get_match_root());
+    if (!split || split->get_input_partial_shape(0).is_dynamic()) {
+        return false;
+    }
+    auto axisConstant =
+        std::dynamic_pointer_cast<ov::op::v0::Constant>(split->input_value(1).get_node_shared_ptr());
+    if (!axisConstant) {
+        return false;
+    }
+    const auto& inputShape = split->get_input_shape(0);
+    int64_t axis = axisConstant->cast_vector<int64_t>().at(0);
+    if (axis < 0) {
+        axis += inputShape.size();
+    }
+    if (axis < 0 || axis >= static_cast<int64_t>(inputShape.size())) {
+        return false;
+    }
+    // Each chunk is a contiguous region of the input only when all dimensions
+    // above the split axis are 1
+    const auto sizeAboveAxis =
+        std::accumulate(inputShape.begin(), inputShape.begin() + axis, size_t{1}, std::multiplies<size_t>());
+    if (sizeAboveAxis != 1) {
+        return false;
+    }
+
+    const auto source = split->input_value(0);
+    if (dynamic_cast<ov::op::v0::Constant*>(source.get_node())) {
+        return false;
+    }
+    // The buffers extractor re-parents ConcatOptimized inputs, so a tensor
+    // cannot be both a concat member and a split view; keep such splits as is
+    for (const auto& consumer : source.get_target_inputs()) {
+        if (dynamic_cast<ov::op::v0::Concat*>(consumer.get_node())) {
+            return false;
+        }
+    }
+    for (const auto& output : split->outputs()) {
+        for (const auto& consumer : output.get_target_inputs()) {
+            if (dynamic_cast<ov::op::v0::Concat*>(consumer.get_node()) ||
+                dynamic_cast<ov::op::v0::Result*>(consumer.get_node())) {
+                return false;
+            }
+        }
+    }
+
+    auto split_optimized =
+        std::make_shared<SplitOptimized>(source, split->input_value(1), split->get_num_splits());
+    split_optimized->set_friendly_name(split->get_friendly_name());
+    ov::copy_runtime_info(split, split_optimized);
+    ov::replace_node(split, split_optimized);
+
+    return true;
+}
+}  // namespace
+
+SplitTransformation::SplitTransformation() {
+    MATCHER_SCOPE(SplitTransformation);
+    auto split = wrap_type<ov::op::v1::Split>();
+
+    matcher_pass_callback callback = [](Matcher& m) { return change_split_to_split_optimized(m); };
+
+    auto m = std::make_shared<Matcher>(split, matcher_name);
+    register_matcher(m, callback);
+}
+
+}  // namespace ov::nvidia_gpu::pass
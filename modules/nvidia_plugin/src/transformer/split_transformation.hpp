@@ -0,0 +1,23 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "openvino/pass/graph_rewrite.hpp"
+
+namespace ov::nvidia_gpu::pass {
+
+/**
+ * Replaces Split nodes whose chunks are contiguous regions of the input
+ * tensor with SplitOptimized. The buffers extractor represents the outputs of
+ * such nodes as offset views into the input buffer, so the split executes as
+ * a no-op instead of launching copy kernels.
+ */
+class SplitTransformation : public ov::pass::MatcherPass {
+public:
+    OPENVINO_RTTI("SplitTransformation", "0");
+    SplitTransformation();
+};
+
+}  // namespace ov::nvidia_gpu::pass
@@ -0,0 +1,116 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "cupti_device_timer.hpp"
+
+#include <cstdlib>
+#include <error.hpp>
+
+namespace ov::nvidia_gpu::utils {
+
+namespace {
+
+constexpr size_t kActivityBufferSize = 1024 * 1024;
+
+std::string cuptiErrorString(CUptiResult err) {
+    const char* str = nullptr;
+    cuptiGetResultString(err, &str);
+    return str != nullptr ? str : "unknown CUPTI error";
+}
+
+void throwIfError(CUptiResult err) {
+    if (err != CUPTI_SUCCESS) {
+        ov::nvidia_gpu::throwIEException(cuptiErrorString(err));
+    }
+}
+
+void logIfError(CUptiResult err) {
+    if (err != CUPTI_SUCCESS) {
+        ov::nvidia_gpu::logError(cuptiErrorString(err));
+    }
+}
+
+}  // namespace
+
+CuptiDeviceTimer& CuptiDeviceTimer::instance() {
+    static CuptiDeviceTimer timer;
+    return timer;
+}
+
+void CuptiDeviceTimer::enable() {
+    std::lock_guard<std::mutex> lock{mutex_};
+    if (enabled_) {
+        return;
+    }
+    throwIfError(cuptiActivityRegisterCallbacks(bufferRequested, bufferCompleted));
+    throwIfError(cuptiActivityEnable(CUPTI_ACTIVITY_KIND_EXTERNAL_CORRELATION));
+    throwIfError(cuptiActivityEnable(CUPTI_ACTIVITY_KIND_CONCURRENT_KERNEL));
+    enabled_ = true;
+}
+
+void CuptiDeviceTimer::pushRange(std::uint64_t id) {
+    logIfError(cuptiActivityPushExternalCorrelationId(CUPTI_EXTERNAL_CORRELATION_KIND_CUSTOM0, id));
+}
+
+void CuptiDeviceTimer::popRange() {
+    std::uint64_t id = 0;
+    logIfError(cuptiActivityPopExternalCorrelationId(CUPTI_EXTERNAL_CORRELATION_KIND_CUSTOM0, &id));
+}
+
+std::map<std::uint64_t, float> CuptiDeviceTimer::collectDeviceTimes() {
+    logIfError(cuptiActivityFlushAll(0));
+
+    std::lock_guard<std::mutex> lock{mutex_};
+    for (auto kernel = kernel_time_ns_.begin(); kernel != kernel_time_ns_.end();) {
+        const auto range = correlation_to_range_.find(kernel->first);
+        if (range != correlation_to_range_.end()) {
+            range_time_ns_[range->second] += kernel->second;
+            kernel = kernel_time_ns_.erase(kernel);
+        } else {
+            ++kernel;
+        }
+    }
+    std::map<std::uint64_t, float> result;
+    constexpr float ns2ms = 1.0e-6f;
+    for (const auto& range : range_time_ns_) {
+        result.emplace(range.first, range.second * ns2ms);
+    }
+    return result;
+}
+
+void CUPTIAPI CuptiDeviceTimer::bufferRequested(uint8_t** buffer, size_t* size, size_t* maxNumRecords) {
+    *size = kActivityBufferSize;
+    *buffer = static_cast<uint8_t*>(std::malloc(kActivityBufferSize));
+    *maxNumRecords = 0;
+}
+
+void CUPTIAPI
+CuptiDeviceTimer::bufferCompleted(CUcontext, uint32_t, uint8_t* buffer, size_t, size_t validSize) {
+    CUpti_Activity* record = nullptr;
+    while (cuptiActivityGetNextRecord(buffer, validSize, &record) == CUPTI_SUCCESS) {
+        instance().processRecord(record);
+    }
+    std::free(buffer);
+}
+
+void CuptiDeviceTimer::processRecord(const CUpti_Activity* record) {
+    std::lock_guard<std::mutex> lock{mutex_};
+    switch (record->kind) {
+        case CUPTI_ACTIVITY_KIND_EXTERNAL_CORRELATION: {
+            const auto* correlation = reinterpret_cast<const CUpti_ActivityExternalCorrelation*>(record);
+            correlation_to_range_[correlation->correlationId] = correlation->externalId;
+            break;
+        }
+        case CUPTI_ACTIVITY_KIND_KERNEL:
+        case CUPTI_ACTIVITY_KIND_CONCURRENT_KERNEL: {
+            const auto* kernel = reinterpret_cast<const CUpti_ActivityKernel4*>(record);
+            kernel_time_ns_[kernel->correlationId] += kernel->end - kernel->start;
+            break;
+        }
+        default:
+            break;
+    }
+}
+
+}  // namespace ov::nvidia_gpu::utils
@@ -0,0 +1,59 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cupti.h>
+
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <unordered_map>
+
+namespace ov::nvidia_gpu::utils {
+
+/**
+ * @brief Process-wide CUPTI activity collector attributing device-side kernel
+ * execution time to operations.
+ *
+ * Operations mark their Execute() calls with pushRange()/popRange() using a
+ * unique range id. The collector joins CUPTI external correlation records
+ * with kernel activity records, so the accumulated numbers reflect real
+ * device execution time instead of host-side launch overhead.
+ */
+class CuptiDeviceTimer {
+public:
+    static CuptiDeviceTimer& instance();
+
+    CuptiDeviceTimer(const CuptiDeviceTimer&) = delete;
+    CuptiDeviceTimer& operator=(const CuptiDeviceTimer&) = delete;
+
+    /** Registers the CUPTI activity callbacks; idempotent */
+    void enable();
+
+    void pushRange(std::uint64_t id);
+    void popRange();
+
+    /**
+     * Flushes pending activity buffers and returns the device time
+     * accumulated so far per range id, in milliseconds
+     */
+    std::map<std::uint64_t, float> collectDeviceTimes();
+
+private:
+    CuptiDeviceTimer() = default;
+
+    static void CUPTIAPI bufferRequested(uint8_t** buffer, size_t* size, size_t* maxNumRecords);
+    static void CUPTIAPI
+    bufferCompleted(CUcontext context, uint32_t streamId, uint8_t* buffer, size_t size, size_t validSize);
+    void processRecord(const CUpti_Activity* record);
+
+    std::mutex mutex_;
+    bool enabled_ = false;
+    std::unordered_map<std::uint32_t, std::uint64_t> correlation_to_range_;
+    std::unordered_map<std::uint32_t, std::uint64_t> kernel_time_ns_;
+    std::unordered_map<std::uint64_t, std::uint64_t> range_time_ns_;
+};
+
+}  // namespace ov::nvidia_gpu::utils
@@ -0,0 +1,31 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "event_counters.hpp"
+
+namespace ov {
+namespace nvidia_gpu {
+namespace utils {
+
+EventCounters& EventCounters::instance() {
+    static EventCounters counters;
+    return counters;
+}
+
+std::map<std::string, std::uint64_t> EventCounters::snapshot() const {
+    return {
+        {"infer_requests_started", infer_requests_started.load(std::memory_order_relaxed)},
+        {"infer_requests_completed", infer_requests_completed.load(std::memory_order_relaxed)},
+        {"thread_pool_queue_depth", thread_pool_queue_depth.load(std::memory_order_relaxed)},
+        {"memory_pool_waits", memory_pool_waits.load(std::memory_order_relaxed)},
+        {"preprocess_us", preprocess_us.load(std::memory_order_relaxed)},
+        {"postprocess_us", postprocess_us.load(std::memory_order_relaxed)},
+        {"start_pipeline_us", start_pipeline_us.load(std::memory_order_relaxed)},
+        {"wait_pipeline_us", wait_pipeline_us.load(std::memory_order_relaxed)},
+    };
+}
+
+}  // namespace utils
+}  // namespace nvidia_gpu
+}  // namespace ov
@@ -0,0 +1,79 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <map>
+#include <string>
+
+namespace ov {
+namespace nvidia_gpu {
+namespace utils {
+
+/**
+ * Always-on hot-path event counters.
+ *
+ * Unlike the performance counters these need no profiling mode: updates are
+ * relaxed atomic adds guarded by one predictable branch, cheap enough for
+ * production, and a snapshot is scraped through the EVENT_COUNTERS metric.
+ * The counters are process-wide so they aggregate over every compiled model
+ * and infer request of the plugin.
+ */
+class EventCounters {
+public:
+    using Counter = std::atomic<std::uint64_t>;
+
+    static EventCounters& instance();
+
+    /**
+     * Adds @p value to @p counter; with counting disabled the cost is the
+     * enabled check only
+     */
+    static void add(Counter& counter, std::uint64_t value = 1) {
+        if (instance().enabled_.load(std::memory_order_relaxed)) {
+            counter.fetch_add(value, std::memory_order_relaxed);
+        }
+    }
+
+    /**
+     * Subtracts @p value from @p counter; used by the gauges
+     */
+    static void sub(Counter& counter, std::uint64_t value = 1) {
+        if (instance().enabled_.load(std::memory_order_relaxed)) {
+            counter.fetch_sub(value, std::memory_order_relaxed);
+        }
+    }
+
+    void setEnabled(bool enabled) noexcept { enabled_.store(enabled, std::memory_order_relaxed); }
+
+    /**
+     * Returns the current counter values keyed by name
+     */
+    std::map<std::string, std::uint64_t> snapshot() const;
+
+    // Inferences an infer request started preprocessing
+    Counter infer_requests_started{0};
+    // Inferences that completed postprocessing
+    Counter infer_requests_completed{0};
+    // Tasks currently queued in the CudaThreadPool ring (gauge)
+    Counter thread_pool_queue_depth{0};
+    // WaitAndGet calls that blocked because every memory block was lent out
+    Counter memory_pool_waits{0};
+    // Cumulative pipeline stage times in microseconds
+    Counter preprocess_us{0};
+    Counter postprocess_us{0};
+    Counter start_pipeline_us{0};
+    Counter wait_pipeline_us{0};
+
+private:
+    EventCounters() = default;
+
+    std::atomic<bool> enabled_{true};
+};
+
+}  // namespace utils
+}  // namespace nvidia_gpu
+}  // namespace ov
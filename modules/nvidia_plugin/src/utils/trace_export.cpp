@@ -0,0 +1,79 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "trace_export.hpp"
+
+#include <thread>
+
+namespace ov {
+namespace nvidia_gpu {
+namespace utils {
+
+namespace {
+
+std::string escape(const std::string& value) {
+    std::string result;
+    result.reserve(value.size());
+    for (const char c : value) {
+        if (c == '"' || c == '\\') {
+            result += '\\';
+        }
+        result += c;
+    }
+    return result;
+}
+
+std::uint64_t currentThreadTrack() {
+    return std::hash<std::thread::id>{}(std::this_thread::get_id()) & 0xFFFFFF;
+}
+
+}  // namespace
+
+TraceExport& TraceExport::instance() {
+    static TraceExport trace_export;
+    return trace_export;
+}
+
+std::uint64_t TraceExport::nowUs() {
+    static const auto epoch = std::chrono::steady_clock::now();
+    return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - epoch).count();
+}
+
+void TraceExport::enable(const std::string& path) {
+    std::lock_guard<std::mutex> lock{mutex_};
+    if (enabled_ || path.empty()) {
+        return;
+    }
+    file_.open(path, std::ios::trunc);
+    if (file_.is_open()) {
+        file_ << "[\n";
+        enabled_ = true;
+    }
+}
+
+void TraceExport::completeEvent(const std::string& name, const std::string& category, std::uint64_t beginUs) {
+    const auto endUs = nowUs();
+    const auto track = currentThreadTrack();
+    std::lock_guard<std::mutex> lock{mutex_};
+    if (!enabled_) {
+        return;
+    }
+    file_ << (first_event_ ? "" : ",\n") << "{\"name\": \"" << escape(name) << "\", \"cat\": \"" << escape(category)
+          << "\", \"ph\": \"X\", \"ts\": " << beginUs << ", \"dur\": " << (endUs - beginUs)
+          << ", \"pid\": 1, \"tid\": " << track << "}";
+    first_event_ = false;
+}
+
+TraceExport::~TraceExport() {
+    std::lock_guard<std::mutex> lock{mutex_};
+    if (enabled_) {
+        file_ << "\n]\n";
+        file_.close();
+        enabled_ = false;
+    }
+}
+
+}  // namespace utils
+}  // namespace nvidia_gpu
+}  // namespace ov
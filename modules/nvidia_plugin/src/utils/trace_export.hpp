@@ -0,0 +1,69 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <fstream>
+#include <mutex>
+#include <string>
+
+namespace ov {
+namespace nvidia_gpu {
+namespace utils {
+
+/**
+ * Streams execution spans into a chrome://tracing (Perfetto) JSON file.
+ *
+ * Performance counters average the per-operation times over the inference
+ * count and lose ordering and concurrency; the trace keeps every span with
+ * its timestamp and submitting thread, so pipeline bubbles and the overlap
+ * of concurrent infer requests are visible in the timeline viewer without
+ * attaching vendor profilers. Events are appended to the file as they
+ * complete, so a truncated trace of a long run still loads.
+ */
+class TraceExport {
+public:
+    static TraceExport& instance();
+
+    /**
+     * Opens the trace file; the first non-empty path wins, later calls with
+     * the same or another path keep appending to the already opened trace
+     */
+    void enable(const std::string& path);
+
+    /**
+     * Returns true if a trace file is open
+     */
+    [[nodiscard]] bool enabled() const noexcept { return enabled_; }
+
+    /**
+     * Microseconds since the trace epoch; taken on the timeline all spans share
+     */
+    static std::uint64_t nowUs();
+
+    /**
+     * Appends one complete span lasting from @p beginUs until now on the
+     * calling thread's track
+     * @param name Span name shown in the timeline
+     * @param category Span category used for filtering
+     * @param beginUs Start of the span as returned by nowUs()
+     */
+    void completeEvent(const std::string& name, const std::string& category, std::uint64_t beginUs);
+
+    ~TraceExport();
+
+private:
+    TraceExport() = default;
+
+    std::mutex mutex_;
+    std::ofstream file_;
+    bool enabled_ = false;
+    bool first_event_ = true;
+};
+
+}  // namespace utils
+}  // namespace nvidia_gpu
+}  // namespace ov
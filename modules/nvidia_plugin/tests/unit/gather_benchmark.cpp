@@ -0,0 +1,101 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cuda_config.hpp>
+#include <cuda_operation_registry.hpp>
+#include <cuda_profiler.hpp>
+#include <iomanip>
+#include <ngraph/node.hpp>
+#include <openvino/op/constant.hpp>
+#include <openvino/op/gather.hpp>
+#include <openvino/op/parameter.hpp>
+#include <ops/parameter.hpp>
+#include <random>
+
+namespace {
+
+using devptr_t = CUDA::DevicePointer<void*>;
+using cdevptr_t = CUDA::DevicePointer<const void*>;
+
+struct GatherBenchmark : testing::Test {
+    using ElementType = float;
+    using IndexType = int64_t;
+
+    const ov::Shape dictTensorShape{100000, 256};
+    const size_t dictBufferSize = ov::shape_size(dictTensorShape) * sizeof(ElementType);
+
+    const ov::Shape indicesTensorShape{4096};
+    const int numIndices = ov::shape_size(indicesTensorShape);
+    const size_t indicesBufferSize = numIndices * sizeof(IndexType);
+
+    const ov::Shape outputTensorShape{4096, 256};
+    const size_t outputBufferSize = ov::shape_size(outputTensorShape) * sizeof(ElementType);
+
+    ov::nvidia_gpu::ThreadContext threadContext{{}};
+    CUDA::Allocation dictAlloc = threadContext.stream().malloc(dictBufferSize);
+    CUDA::Allocation indicesAlloc = threadContext.stream().malloc(indicesBufferSize);
+    CUDA::Allocation axisAlloc = threadContext.stream().malloc(sizeof(IndexType));
+    CUDA::Allocation outAlloc = threadContext.stream().malloc(outputBufferSize);
+    std::vector<cdevptr_t> inputs{dictAlloc, indicesAlloc, axisAlloc};
+    std::vector<devptr_t> outputs{outAlloc};
+    std::vector<std::shared_ptr<ngraph::runtime::Tensor>> emptyTensor;
+    std::map<std::string, std::size_t> emptyMapping;
+    ov::nvidia_gpu::OperationBase::Ptr operation = [this] {
+        const bool optimizeOption = false;
+        auto dict_param = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::PartialShape{dictTensorShape});
+        auto indices_param =
+            std::make_shared<ov::op::v0::Parameter>(ov::element::i64, ov::PartialShape{indicesTensorShape});
+        auto axis_constant =
+            std::make_shared<ov::op::v0::Constant>(ov::element::i64, ov::Shape{}, std::vector<int64_t>{0});
+        auto node = std::make_shared<ov::op::v1::Gather>(
+            dict_param->output(0), indices_param->output(0), axis_constant->output(0));
+        auto& registry = ov::nvidia_gpu::OperationRegistry::getInstance();
+        return registry.createOperation(ov::nvidia_gpu::CreationContext{threadContext.device(), optimizeOption},
+                                        node,
+                                        std::vector<ov::nvidia_gpu::TensorID>{ov::nvidia_gpu::TensorID{0u}},
+                                        std::vector<ov::nvidia_gpu::TensorID>{ov::nvidia_gpu::TensorID{0u}});
+    }();
+};
+
+TEST_F(GatherBenchmark, DISABLED_benchmark) {
+    using microseconds = std::chrono::duration<double, std::micro>;
+    constexpr int kNumAttempts = 2000;
+    ov::nvidia_gpu::CancellationToken token{};
+    ov::nvidia_gpu::CudaGraph graph{ov::nvidia_gpu::CreationContext{CUDA::Device{}, false}, {}};
+    ov::nvidia_gpu::Profiler profiler{false, graph};
+    ov::nvidia_gpu::InferenceRequestContext context{
+        emptyTensor, emptyMapping, emptyTensor, emptyMapping, threadContext, token, profiler};
+    auto& stream = context.getThreadContext().stream();
+    std::vector<ElementType> dict(ov::shape_size(dictTensorShape));
+    std::vector<IndexType> indices(numIndices);
+    std::random_device r_device;
+    std::mt19937 mersenne_engine{r_device()};
+    std::uniform_int_distribution<int> dist{std::numeric_limits<int>::min(), std::numeric_limits<int>::max()};
+    auto gen = [&dist, &mersenne_engine]() { return 10.f * dist(mersenne_engine) / std::numeric_limits<int>::max(); };
+    std::generate(dict.begin(), dict.end(), gen);
+    std::uniform_int_distribution<IndexType> index_dist{0, static_cast<IndexType>(dictTensorShape[0]) - 1};
+    auto index_gen = [&index_dist, &mersenne_engine]() { return index_dist(mersenne_engine); };
+    std::generate(indices.begin(), indices.end(), index_gen);
+    stream.upload(dictAlloc, dict.data(), dictBufferSize);
+    stream.upload(indicesAlloc, indices.data(), indicesBufferSize);
+    stream.synchronize();
+    ov::nvidia_gpu::Workbuffers workbuffers{};
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < kNumAttempts; i++) {
+        operation->Execute(context, inputs, outputs, workbuffers);
+        stream.synchronize();
+    }
+    auto end = std::chrono::steady_clock::now();
+    microseconds average_exec_time = (end - start) / kNumAttempts;
+    // Every gathered row is read once and written once; the indices are read once.
+    const double bytes_moved = 2.0 * outputBufferSize + indicesBufferSize;
+    const double gigabytes_per_second = bytes_moved / (average_exec_time.count() * 1e-6) / 1e9;
+    std::cout << std::fixed << std::setfill('0') << "Gather execution time: " << average_exec_time.count()
+              << " microseconds (" << std::setprecision(2) << gigabytes_per_second << " GB/s)\n";
+}
+
+}  // namespace
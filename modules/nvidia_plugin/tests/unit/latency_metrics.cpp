@@ -0,0 +1,69 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <cuda_latency_metrics.hpp>
+#include <thread>
+
+using namespace ov::nvidia_gpu;
+
+TEST(LatencyMetrics, EmptyAggregates) {
+    LatencyMetrics metrics;
+    const auto aggregates = metrics.Aggregate(2);
+    EXPECT_EQ(aggregates.at("sample_count"), 0.0f);
+    EXPECT_EQ(aggregates.at("p50_latency_us"), 0.0f);
+    EXPECT_EQ(aggregates.at("p99_latency_us"), 0.0f);
+    EXPECT_EQ(aggregates.at("avg_queue_wait_us"), 0.0f);
+    EXPECT_EQ(aggregates.at("stream_occupancy"), 0.0f);
+}
+
+TEST(LatencyMetrics, PercentilesAndQueueWait) {
+    LatencyMetrics metrics;
+    for (int i = 1; i <= 100; i++) {
+        metrics.RecordInference(static_cast<float>(i * 100), 10.0f, static_cast<float>(i * 50));
+    }
+    const auto aggregates = metrics.Aggregate(1);
+    EXPECT_EQ(aggregates.at("sample_count"), 100.0f);
+    EXPECT_NEAR(aggregates.at("p50_latency_us"), 5000.0f, 100.0f);
+    EXPECT_NEAR(aggregates.at("p95_latency_us"), 9500.0f, 100.0f);
+    EXPECT_NEAR(aggregates.at("p99_latency_us"), 9900.0f, 100.0f);
+    EXPECT_EQ(aggregates.at("max_latency_us"), 10000.0f);
+    EXPECT_NEAR(aggregates.at("avg_queue_wait_us"), 10.0f, 0.01f);
+    const auto occupancy = aggregates.at("stream_occupancy");
+    EXPECT_GE(occupancy, 0.0f);
+    EXPECT_LE(occupancy, 1.0f);
+}
+
+TEST(LatencyMetrics, RingKeepsOnlyRecentSamples) {
+    LatencyMetrics metrics;
+    // More samples than the ring holds; the old constant-latency samples must be
+    // fully overwritten by the later ones
+    for (int i = 0; i < 2000; i++) {
+        metrics.RecordInference(1.0f, 0.0f, 0.0f);
+    }
+    for (int i = 0; i < 2000; i++) {
+        metrics.RecordInference(2.0f, 0.0f, 0.0f);
+    }
+    const auto aggregates = metrics.Aggregate(1);
+    EXPECT_EQ(aggregates.at("p50_latency_us"), 2.0f);
+    EXPECT_EQ(aggregates.at("max_latency_us"), 2.0f);
+}
+
+TEST(LatencyMetrics, ConcurrentRecordingDoesNotCrash) {
+    LatencyMetrics metrics;
+    std::vector<std::thread> writers;
+    for (int t = 0; t < 4; t++) {
+        writers.emplace_back([&metrics] {
+            for (int i = 0; i < 10000; i++) {
+                metrics.RecordInference(1.0f, 1.0f, 1.0f);
+            }
+        });
+    }
+    for (auto& writer : writers) {
+        writer.join();
+    }
+    const auto aggregates = metrics.Aggregate(4);
+    EXPECT_GT(aggregates.at("sample_count"), 0.0f);
+}
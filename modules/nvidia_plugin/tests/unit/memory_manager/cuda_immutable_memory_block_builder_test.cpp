@@ -52,6 +52,40 @@ TEST(ImmutableMemoryBlockBuilder, Build) {
     verify_device_data(memory_block->deviceTensorPtr(TensorID{t2_id}), t2_data);
 }
 
+TEST(ImmutableMemoryBlockBuilder, DeduplicateEqualContent) {
+    using namespace ov::nvidia_gpu;
+
+    const BufferID t0_id = 1;
+    const std::vector<uint8_t> t0_data(512, 0xA5);
+    const BufferID t1_id = 3;
+    const std::vector<uint8_t> t1_data(t0_data);  // same bytes at another address
+    const BufferID t2_id = 5;
+    const std::vector<uint8_t> t2_data(512, 0x5A);
+
+    std::shared_ptr<DeviceMemBlock> memory_block;
+    MemoryModel::Ptr memory_model;
+    {
+        ImmutableMemoryBlockBuilder builder;
+        builder.addAllocation(t0_id, &t0_data[0], t0_data.size());
+        builder.addAllocation(t1_id, &t1_data[0], t1_data.size());
+        builder.addAllocation(t2_id, &t2_data[0], t2_data.size());
+        ASSERT_NO_THROW({ std::tie(memory_block, memory_model) = builder.build(); });
+    }
+
+    // Byte-identical tensors share one allocation; a tensor with different
+    // content gets its own
+    ASSERT_EQ(memory_block->deviceTensorPtr(TensorID{t0_id}), memory_block->deviceTensorPtr(TensorID{t1_id}));
+    ASSERT_NE(memory_block->deviceTensorPtr(TensorID{t0_id}), memory_block->deviceTensorPtr(TensorID{t2_id}));
+
+    std::vector<uint8_t> data_from_device(t0_data.size(), 0);
+    auto err = ::cudaMemcpy(&data_from_device[0],
+                            memory_block->deviceTensorPtr(TensorID{t1_id}),
+                            t1_data.size(),
+                            cudaMemcpyDeviceToHost);
+    ASSERT_EQ(err, cudaSuccess);
+    ASSERT_EQ(data_from_device, t1_data);
+}
+
 TEST(ImmutableMemoryBlockBuilder, HandleDuplicateAllocation) {
     using namespace ov::nvidia_gpu;
 
@@ -56,6 +56,48 @@ TEST(ImmutableMemoryModelBuilder, Build) {
     ASSERT_EQ(model->deviceMemoryBlockSize(), offset4 + applyAllignment(size4));
 }
 
+TEST(ImmutableMemoryModelBuilder, ShareAllocation) {
+    using namespace ov::nvidia_gpu;
+
+    BufferID id1 = 0;
+    size_t size1 = 256;
+    BufferID id2 = 3;
+    size_t size2 = 784;
+    BufferID shared_id = 7;
+
+    ImmutableMemoryModelBuilder builder;
+    builder.addAllocation(id1, size1);
+    builder.addAllocation(id2, size2);
+    builder.shareAllocation(shared_id, id2);
+    MemoryModel::Ptr model = builder.build();
+
+    // The shared tensor maps to the offset of its peer and doesn't
+    // contribute to the memory block size
+    ptrdiff_t offset2 = -1;
+    ASSERT_TRUE(model->offsetForBuffer(id2, offset2));
+    ptrdiff_t shared_offset = -1;
+    ASSERT_TRUE(model->offsetForBuffer(shared_id, shared_offset));
+    ASSERT_EQ(shared_offset, offset2);
+    ASSERT_EQ(model->deviceMemoryBlockSize(), applyAllignment(size1) + applyAllignment(size2));
+}
+
+TEST(ImmutableMemoryModelBuilder, HandleUnknownSharedAllocation) {
+    using namespace ov::nvidia_gpu;
+
+    ImmutableMemoryModelBuilder builder;
+
+    BufferID buffer_id = 1;
+    BufferID unknown_peer_id = 2;
+
+#ifdef NDEBUG
+    ASSERT_THROW(builder.shareAllocation(buffer_id, unknown_peer_id),
+                 InferenceEngine::details::InferenceEngineException);
+#else
+    testing::FLAGS_gtest_death_test_style = "threadsafe";
+    ASSERT_DEATH(builder.shareAllocation(buffer_id, unknown_peer_id), "Assertion");
+#endif
+}
+
 TEST(ImmutableMemoryModelBuilder, HandleDuplicateAllocation) {
     using namespace ov::nvidia_gpu;
 
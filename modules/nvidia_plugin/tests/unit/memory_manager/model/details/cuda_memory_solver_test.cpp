@@ -119,7 +119,7 @@ TEST(MemSolverTest, LinearWithEmptyExecIndexes) {
     EXPECT_EQ(ms.maxTopDepth(), 2);
 }
 
-TEST(MemSolverTest, DISABLED_Unefficiency) {
+TEST(MemSolverTest, Unefficiency) {
     std::vector<Box> boxes{
         //  |            __________
         {6, 7, 3},  //  |   ____    |_3________|
@@ -129,7 +129,7 @@ TEST(MemSolverTest, DISABLED_Unefficiency) {
     };
 
     ov::nvidia_gpu::MemorySolver ms(boxes);
-    EXPECT_EQ(ms.solve(), 5);  // currently we have answer 6
+    EXPECT_EQ(ms.solve(), 5);  // the chronological placement order reaches the bottom score here
     EXPECT_EQ(ms.maxDepth(), 5);
     EXPECT_EQ(ms.maxTopDepth(), 2);
 }
@@ -244,9 +244,7 @@ TEST(MemSolverTest, NoOverlapping) {
     };
 
     ov::nvidia_gpu::MemorySolver ms(boxes);
-    ms.solve();
-    // TODO: Current algorithm doesn't solve that case. Uncomment check to see inefficiency
-    // EXPECT_EQ(ms.solve(), 5);
+    EXPECT_EQ(ms.solve(), 5);
 
     auto no_overlap = [&](Box box1, Box box2) -> bool {
         int off1 = ms.getOffset(box1.id);
@@ -0,0 +1,110 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cuda_config.hpp>
+#include <cuda_operation_registry.hpp>
+#include <cuda_profiler.hpp>
+#include <iomanip>
+#include <ngraph/node.hpp>
+#include <openvino/op/constant.hpp>
+#include <openvino/op/pad.hpp>
+#include <openvino/op/parameter.hpp>
+#include <ops/parameter.hpp>
+#include <random>
+
+namespace {
+
+using devptr_t = CUDA::DevicePointer<void*>;
+using cdevptr_t = CUDA::DevicePointer<const void*>;
+
+struct PadBenchmark : testing::Test {
+    using ElementType = float;
+
+    const ov::Shape inputTensorShape{1, 64, 224, 224};
+    const int inputBufferLength = ov::shape_size(inputTensorShape);
+    const size_t inputBufferSize = inputBufferLength * sizeof(ElementType);
+
+    const std::vector<int64_t> padsBegin{0, 0, 1, 1};
+    const std::vector<int64_t> padsEnd{0, 0, 1, 1};
+    const size_t padsBufferSize = padsBegin.size() * sizeof(int64_t);
+
+    const ov::Shape outputTensorShape{1, 64, 226, 226};
+    const size_t outputBufferSize = ov::shape_size(outputTensorShape) * sizeof(ElementType);
+
+    ov::nvidia_gpu::ThreadContext threadContext{{}};
+    CUDA::Allocation inAlloc = threadContext.stream().malloc(inputBufferSize);
+    CUDA::Allocation padsBeginAlloc = threadContext.stream().malloc(padsBufferSize);
+    CUDA::Allocation padsEndAlloc = threadContext.stream().malloc(padsBufferSize);
+    CUDA::Allocation padValueAlloc = threadContext.stream().malloc(sizeof(ElementType));
+    CUDA::Allocation outAlloc = threadContext.stream().malloc(outputBufferSize);
+    std::vector<cdevptr_t> inputs{inAlloc, padsBeginAlloc, padsEndAlloc, padValueAlloc};
+    std::vector<devptr_t> outputs{outAlloc};
+    std::vector<std::shared_ptr<ngraph::runtime::Tensor>> emptyTensor;
+    std::map<std::string, std::size_t> emptyMapping;
+    ov::nvidia_gpu::OperationBase::Ptr operation = [this] {
+        const bool optimizeOption = false;
+        auto param = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::PartialShape{inputTensorShape});
+        auto pads_begin = std::make_shared<ov::op::v0::Constant>(ov::element::i64, ov::Shape{4}, padsBegin);
+        auto pads_end = std::make_shared<ov::op::v0::Constant>(ov::element::i64, ov::Shape{4}, padsEnd);
+        auto pad_value =
+            std::make_shared<ov::op::v0::Constant>(ov::element::f32, ov::Shape{}, std::vector<ElementType>{0.0f});
+        auto node = std::make_shared<ov::op::v1::Pad>(param->output(0),
+                                                      pads_begin->output(0),
+                                                      pads_end->output(0),
+                                                      pad_value->output(0),
+                                                      ov::op::PadMode::CONSTANT);
+        auto& registry = ov::nvidia_gpu::OperationRegistry::getInstance();
+        return registry.createOperation(ov::nvidia_gpu::CreationContext{threadContext.device(), optimizeOption},
+                                        node,
+                                        std::vector<ov::nvidia_gpu::TensorID>{ov::nvidia_gpu::TensorID{0u}},
+                                        std::vector<ov::nvidia_gpu::TensorID>{ov::nvidia_gpu::TensorID{0u}});
+    }();
+};
+
+TEST_F(PadBenchmark, DISABLED_benchmark) {
+    using microseconds = std::chrono::duration<double, std::micro>;
+    constexpr int kNumAttempts = 2000;
+    ov::nvidia_gpu::CancellationToken token{};
+    ov::nvidia_gpu::CudaGraph graph{ov::nvidia_gpu::CreationContext{CUDA::Device{}, false}, {}};
+    ov::nvidia_gpu::Profiler profiler{false, graph};
+    ov::nvidia_gpu::InferenceRequestContext context{
+        emptyTensor, emptyMapping, emptyTensor, emptyMapping, threadContext, token, profiler};
+    auto& stream = context.getThreadContext().stream();
+    std::vector<ElementType> in(inputBufferLength);
+    std::random_device r_device;
+    std::mt19937 mersenne_engine{r_device()};
+    std::uniform_int_distribution<int> dist{std::numeric_limits<int>::min(), std::numeric_limits<int>::max()};
+    auto gen = [&dist, &mersenne_engine]() { return 10.f * dist(mersenne_engine) / std::numeric_limits<int>::max(); };
+    std::generate(in.begin(), in.end(), gen);
+    const ElementType pad_value = 0.0f;
+    stream.upload(inAlloc, in.data(), inputBufferSize);
+    stream.upload(padsBeginAlloc, padsBegin.data(), padsBufferSize);
+    stream.upload(padsEndAlloc, padsEnd.data(), padsBufferSize);
+    stream.upload(padValueAlloc, &pad_value, sizeof(ElementType));
+    auto wb_request = operation->GetWorkBufferRequest();
+    ASSERT_EQ(wb_request.immutable_sizes.size(), 2);
+    CUDA::Allocation srcShapeAlloc = stream.malloc(wb_request.immutable_sizes[0]);
+    CUDA::Allocation dstShapeAlloc = stream.malloc(wb_request.immutable_sizes[1]);
+    operation->InitSharedImmutableWorkbuffers({srcShapeAlloc, dstShapeAlloc});
+    ov::nvidia_gpu::Workbuffers workbuffers{};
+    workbuffers.immutable_buffers = {srcShapeAlloc, dstShapeAlloc};
+    stream.synchronize();
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < kNumAttempts; i++) {
+        operation->Execute(context, inputs, outputs, workbuffers);
+        stream.synchronize();
+    }
+    auto end = std::chrono::steady_clock::now();
+    microseconds average_exec_time = (end - start) / kNumAttempts;
+    // The whole input is read once and the padded output is written once.
+    const double bytes_moved = static_cast<double>(inputBufferSize) + outputBufferSize;
+    const double gigabytes_per_second = bytes_moved / (average_exec_time.count() * 1e-6) / 1e9;
+    std::cout << std::fixed << std::setfill('0') << "Pad execution time: " << average_exec_time.count()
+              << " microseconds (" << std::setprecision(2) << gigabytes_per_second << " GB/s)\n";
+}
+
+}  // namespace
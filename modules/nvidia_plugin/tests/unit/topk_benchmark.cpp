@@ -0,0 +1,102 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cuda_config.hpp>
+#include <cuda_operation_registry.hpp>
+#include <cuda_profiler.hpp>
+#include <iomanip>
+#include <ngraph/node.hpp>
+#include <openvino/op/constant.hpp>
+#include <openvino/op/parameter.hpp>
+#include <openvino/op/topk.hpp>
+#include <ops/parameter.hpp>
+#include <random>
+
+namespace {
+
+using devptr_t = CUDA::DevicePointer<void*>;
+using cdevptr_t = CUDA::DevicePointer<const void*>;
+
+struct TopKBenchmark : testing::Test {
+    using ElementType = float;
+
+    const ov::Shape inputTensorShape{16, 65536};
+    const int inputBufferLength = ov::shape_size(inputTensorShape);
+    const size_t inputBufferSize = inputBufferLength * sizeof(ElementType);
+
+    static constexpr int64_t k = 32;
+    const ov::Shape outputTensorShape{16, k};
+    const size_t outputValuesSize = ov::shape_size(outputTensorShape) * sizeof(ElementType);
+    const size_t outputIndicesSize = ov::shape_size(outputTensorShape) * sizeof(int32_t);
+
+    ov::nvidia_gpu::ThreadContext threadContext{{}};
+    CUDA::Allocation inAlloc = threadContext.stream().malloc(inputBufferSize);
+    CUDA::Allocation kAlloc = threadContext.stream().malloc(sizeof(int64_t));
+    CUDA::Allocation outValuesAlloc = threadContext.stream().malloc(outputValuesSize);
+    CUDA::Allocation outIndicesAlloc = threadContext.stream().malloc(outputIndicesSize);
+    std::vector<cdevptr_t> inputs{inAlloc, kAlloc};
+    std::vector<devptr_t> outputs{outValuesAlloc, outIndicesAlloc};
+    std::vector<std::shared_ptr<ngraph::runtime::Tensor>> emptyTensor;
+    std::map<std::string, std::size_t> emptyMapping;
+    ov::nvidia_gpu::OperationBase::Ptr operation = [this] {
+        const bool optimizeOption = false;
+        auto param = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::PartialShape{inputTensorShape});
+        auto k_constant = std::make_shared<ov::op::v0::Constant>(ov::element::i64, ov::Shape{}, std::vector<int64_t>{k});
+        auto node = std::make_shared<ov::op::v1::TopK>(param->output(0),
+                                                       k_constant->output(0),
+                                                       1,
+                                                       ov::op::v1::TopK::Mode::MAX,
+                                                       ov::op::v1::TopK::SortType::SORT_VALUES);
+        auto& registry = ov::nvidia_gpu::OperationRegistry::getInstance();
+        return registry.createOperation(ov::nvidia_gpu::CreationContext{threadContext.device(), optimizeOption},
+                                        node,
+                                        std::vector<ov::nvidia_gpu::TensorID>{ov::nvidia_gpu::TensorID{0u}},
+                                        std::vector<ov::nvidia_gpu::TensorID>{ov::nvidia_gpu::TensorID{0u}});
+    }();
+};
+
+TEST_F(TopKBenchmark, DISABLED_benchmark) {
+    using microseconds = std::chrono::duration<double, std::micro>;
+    constexpr int kNumAttempts = 2000;
+    ov::nvidia_gpu::CancellationToken token{};
+    ov::nvidia_gpu::CudaGraph graph{ov::nvidia_gpu::CreationContext{CUDA::Device{}, false}, {}};
+    ov::nvidia_gpu::Profiler profiler{false, graph};
+    ov::nvidia_gpu::InferenceRequestContext context{
+        emptyTensor, emptyMapping, emptyTensor, emptyMapping, threadContext, token, profiler};
+    auto& stream = context.getThreadContext().stream();
+    std::vector<ElementType> in(inputBufferLength);
+    std::random_device r_device;
+    std::mt19937 mersenne_engine{r_device()};
+    std::uniform_int_distribution<int> dist{std::numeric_limits<int>::min(), std::numeric_limits<int>::max()};
+    auto gen = [&dist, &mersenne_engine]() { return 10.f * dist(mersenne_engine) / std::numeric_limits<int>::max(); };
+    std::generate(in.begin(), in.end(), gen);
+    stream.upload(inAlloc, in.data(), inputBufferSize);
+    auto wb_request = operation->GetWorkBufferRequest();
+    ASSERT_EQ(wb_request.immutable_sizes.size(), 1);
+    ASSERT_EQ(wb_request.mutable_sizes.size(), 1);
+    CUDA::Allocation paramAlloc = stream.malloc(wb_request.immutable_sizes[0]);
+    CUDA::Allocation workspaceAlloc = stream.malloc(wb_request.mutable_sizes[0]);
+    operation->InitSharedImmutableWorkbuffers({paramAlloc});
+    ov::nvidia_gpu::Workbuffers workbuffers{};
+    workbuffers.immutable_buffers = {paramAlloc};
+    workbuffers.mutable_buffers = {workspaceAlloc};
+    stream.synchronize();
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < kNumAttempts; i++) {
+        operation->Execute(context, inputs, outputs, workbuffers);
+        stream.synchronize();
+    }
+    auto end = std::chrono::steady_clock::now();
+    microseconds average_exec_time = (end - start) / kNumAttempts;
+    // TopK is dominated by reading the whole input; the outputs are tiny in comparison.
+    const double bytes_moved = static_cast<double>(inputBufferSize) + outputValuesSize + outputIndicesSize;
+    const double gigabytes_per_second = bytes_moved / (average_exec_time.count() * 1e-6) / 1e9;
+    std::cout << std::fixed << std::setfill('0') << "TopK execution time: " << average_exec_time.count()
+              << " microseconds (" << std::setprecision(2) << gigabytes_per_second << " GB/s)\n";
+}
+
+}  // namespace
@@ -0,0 +1,173 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+// Throughput benchmark harness for the NVIDIA plugin.
+//
+// Loads a model, sweeps the NVIDIA_THROUGHPUT_STREAMS / infer request counts and
+// reports the achieved throughput together with the per-stage latency breakdown
+// (preprocessing, device transfers, execution, postprocessing) that the plugin
+// collects through its Profiler when PERF_COUNT is enabled.
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <inference_engine.hpp>
+#include <iomanip>
+#include <iostream>
+#include <nvidia/nvidia_config.hpp>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace {
+
+struct Options {
+    std::string model_path;
+    std::string device = "NVIDIA";
+    std::vector<int> stream_counts{1, 2, 4};
+    int num_requests = 0;  // 0 selects OPTIMAL_NUMBER_OF_INFER_REQUESTS per configuration
+    int num_iterations = 1000;
+};
+
+void printUsage(const char* name) {
+    std::cout << "Usage: " << name << " -m <model.xml> [-d <device>] [-streams <n[,n...]>]"
+              << " [-nireq <n>] [-niter <n>]\n"
+              << "  -m       path to an IR model\n"
+              << "  -d       target device (default: NVIDIA)\n"
+              << "  -streams comma-separated list of stream counts to sweep (default: 1,2,4)\n"
+              << "  -nireq   infer requests per configuration (default: optimal number reported by the device)\n"
+              << "  -niter   total inferences per configuration (default: 1000)\n";
+}
+
+std::vector<int> parseStreamList(const std::string& value) {
+    std::vector<int> result;
+    std::stringstream ss{value};
+    std::string token;
+    while (std::getline(ss, token, ',')) {
+        result.push_back(std::stoi(token));
+    }
+    return result;
+}
+
+bool parseOptions(int argc, char** argv, Options& options) {
+    for (int i = 1; i < argc; i++) {
+        const std::string arg = argv[i];
+        const bool has_value = i + 1 < argc;
+        if (arg == "-m" && has_value) {
+            options.model_path = argv[++i];
+        } else if (arg == "-d" && has_value) {
+            options.device = argv[++i];
+        } else if (arg == "-streams" && has_value) {
+            options.stream_counts = parseStreamList(argv[++i]);
+        } else if (arg == "-nireq" && has_value) {
+            options.num_requests = std::stoi(argv[++i]);
+        } else if (arg == "-niter" && has_value) {
+            options.num_iterations = std::stoi(argv[++i]);
+        } else {
+            return false;
+        }
+    }
+    return !options.model_path.empty() && !options.stream_counts.empty() && options.num_iterations > 0;
+}
+
+void fillRandom(InferenceEngine::InferRequest& request, const InferenceEngine::InputsDataMap& inputs) {
+    std::mt19937 engine{42};
+    std::uniform_int_distribution<int> dist{0, 255};
+    for (const auto& input : inputs) {
+        auto blob = request.GetBlob(input.first);
+        auto memory_blob = InferenceEngine::as<InferenceEngine::MemoryBlob>(blob);
+        if (!memory_blob) continue;
+        auto mapped = memory_blob->wmap();
+        auto* data = mapped.as<uint8_t*>();
+        const size_t byte_size = blob->byteSize();
+        for (size_t i = 0; i < byte_size; i++) {
+            data[i] = static_cast<uint8_t>(dist(engine));
+        }
+    }
+}
+
+void printStageBreakdown(const std::map<std::string, InferenceEngine::InferenceEngineProfileInfo>& counters) {
+    // The plugin publishes the per-stage summary as numbered entries ("1. input
+    // preprocessing" ... "5. output postprocessing"); layer-level counters keep
+    // their layer names and are skipped here.
+    for (const auto& counter : counters) {
+        if (counter.first.empty() || !std::isdigit(static_cast<unsigned char>(counter.first.front()))) continue;
+        std::cout << "    " << std::left << std::setw(36) << counter.first << std::right << std::setw(12)
+                  << std::fixed << std::setprecision(1) << static_cast<double>(counter.second.realTime_uSec)
+                  << " us (device) " << std::setw(12) << static_cast<double>(counter.second.cpu_uSec)
+                  << " us (host)\n";
+    }
+}
+
+void runConfiguration(InferenceEngine::Core& core, const Options& options, int num_streams) {
+    const std::map<std::string, std::string> config{
+        {CONFIG_KEY(PERF_COUNT), CONFIG_VALUE(YES)},
+        {NVIDIA_CONFIG_KEY(THROUGHPUT_STREAMS), std::to_string(num_streams)},
+    };
+    auto network = core.ReadNetwork(options.model_path);
+    auto executable_network = core.LoadNetwork(network, options.device, config);
+
+    int num_requests = options.num_requests;
+    if (num_requests == 0) {
+        num_requests = executable_network.GetMetric(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)).as<unsigned>();
+    }
+    const auto inputs = network.getInputsInfo();
+    std::vector<InferenceEngine::InferRequest> requests;
+    for (int i = 0; i < num_requests; i++) {
+        requests.push_back(executable_network.CreateInferRequest());
+        fillRandom(requests.back(), inputs);
+    }
+
+    // One synchronous warm-up per request keeps lazy initialization out of the
+    // measured interval.
+    for (auto& request : requests) {
+        request.Infer();
+    }
+
+    const int num_iterations = std::max<int>(options.num_iterations, num_requests);
+    int started = 0;
+    int completed = 0;
+    const auto start = std::chrono::steady_clock::now();
+    for (auto& request : requests) {
+        request.StartAsync();
+        started++;
+    }
+    size_t next = 0;
+    while (completed < num_iterations) {
+        requests[next].Wait(InferenceEngine::InferRequest::WaitMode::RESULT_READY);
+        completed++;
+        if (started < num_iterations) {
+            requests[next].StartAsync();
+            started++;
+        }
+        next = (next + 1) % requests.size();
+    }
+    const auto end = std::chrono::steady_clock::now();
+    const double seconds = std::chrono::duration<double>(end - start).count();
+
+    std::cout << "streams=" << num_streams << " nireq=" << num_requests << ": " << std::fixed << std::setprecision(2)
+              << completed / seconds << " fps (" << completed << " inferences in " << seconds << " s)\n";
+    printStageBreakdown(requests.front().GetPerformanceCounts());
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    Options options;
+    if (!parseOptions(argc, argv, options)) {
+        printUsage(argv[0]);
+        return EXIT_FAILURE;
+    }
+    try {
+        InferenceEngine::Core core;
+        for (const int num_streams : options.stream_counts) {
+            runConfiguration(core, options, num_streams);
+        }
+    } catch (const std::exception& e) {
+        std::cerr << "Benchmark failed: " << e.what() << "\n";
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
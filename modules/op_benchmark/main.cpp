@@ -0,0 +1,339 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+// Per-operation benchmark harness shared by the plugins in this repository.
+//
+// Instantiates single-op models over a shape corpus, runs them on the
+// requested device (NVIDIA, CPU, ...) and emits one machine-readable JSON
+// record per (op, shape, dtype) with the measured ns/iter and effective GB/s,
+// so per-op performance compares directly across the CUDA kernels and the
+// ACL/reference ARM paths.
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <map>
+#include <openvino/openvino.hpp>
+#include <openvino/opsets/opset8.hpp>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace {
+
+namespace opset = ov::opset8;
+
+struct Options {
+    std::string device = "CPU";
+    std::vector<std::string> ops;            // empty selects every registered op
+    std::vector<ov::Shape> shapes;           // empty selects the default corpus
+    ov::element::Type type = ov::element::f32;
+    int num_iterations = 100;
+    int num_warmup = 10;
+    std::string output_path;                 // empty writes to stdout
+};
+
+using ModelBuilder = std::function<std::shared_ptr<ov::Model>(const ov::Shape&, ov::element::Type)>;
+
+std::shared_ptr<ov::Model> makeUnary(const ov::Shape& shape,
+                                     ov::element::Type type,
+                                     const std::function<std::shared_ptr<ov::Node>(const ov::Output<ov::Node>&)>& op) {
+    auto param = std::make_shared<opset::Parameter>(type, shape);
+    return std::make_shared<ov::Model>(ov::OutputVector{op(param)}, ov::ParameterVector{param});
+}
+
+std::shared_ptr<ov::Model> makeBinary(const ov::Shape& shape,
+                                      ov::element::Type type,
+                                      const std::function<std::shared_ptr<ov::Node>(const ov::Output<ov::Node>&,
+                                                                                    const ov::Output<ov::Node>&)>& op) {
+    auto lhs = std::make_shared<opset::Parameter>(type, shape);
+    auto rhs = std::make_shared<opset::Parameter>(type, shape);
+    return std::make_shared<ov::Model>(ov::OutputVector{op(lhs, rhs)}, ov::ParameterVector{lhs, rhs});
+}
+
+// Every builder takes the corpus shape as its data input shape; ops with
+// weights derive them from that shape, so one corpus drives every op
+const std::map<std::string, ModelBuilder>& builders() {
+    static const std::map<std::string, ModelBuilder> registry = {
+        {"Add", [](const ov::Shape& shape, ov::element::Type type) {
+            return makeBinary(shape, type, [](const ov::Output<ov::Node>& a, const ov::Output<ov::Node>& b) {
+                return std::make_shared<opset::Add>(a, b);
+            });
+        }},
+        {"Multiply", [](const ov::Shape& shape, ov::element::Type type) {
+            return makeBinary(shape, type, [](const ov::Output<ov::Node>& a, const ov::Output<ov::Node>& b) {
+                return std::make_shared<opset::Multiply>(a, b);
+            });
+        }},
+        {"Relu", [](const ov::Shape& shape, ov::element::Type type) {
+            return makeUnary(shape, type, [](const ov::Output<ov::Node>& a) {
+                return std::make_shared<opset::Relu>(a);
+            });
+        }},
+        {"Sigmoid", [](const ov::Shape& shape, ov::element::Type type) {
+            return makeUnary(shape, type, [](const ov::Output<ov::Node>& a) {
+                return std::make_shared<opset::Sigmoid>(a);
+            });
+        }},
+        {"Softmax", [](const ov::Shape& shape, ov::element::Type type) {
+            return makeUnary(shape, type, [&shape](const ov::Output<ov::Node>& a) {
+                return std::make_shared<opset::Softmax>(a, shape.size() - 1);
+            });
+        }},
+        {"ReduceSum", [](const ov::Shape& shape, ov::element::Type type) {
+            return makeUnary(shape, type, [&shape](const ov::Output<ov::Node>& a) {
+                auto axis = opset::Constant::create(ov::element::i64, {}, {static_cast<std::int64_t>(shape.size() - 1)});
+                return std::make_shared<opset::ReduceSum>(a, axis, false);
+            });
+        }},
+        {"Transpose", [](const ov::Shape& shape, ov::element::Type type) {
+            return makeUnary(shape, type, [&shape](const ov::Output<ov::Node>& a) {
+                std::vector<std::int64_t> order(shape.size());
+                for (std::size_t d = 0; d < order.size(); ++d) {
+                    order[d] = static_cast<std::int64_t>(order.size() - 1 - d);
+                }
+                auto orderNode = opset::Constant::create(ov::element::i64, {order.size()}, order);
+                return std::make_shared<opset::Transpose>(a, orderNode);
+            });
+        }},
+        {"MatMul", [](const ov::Shape& shape, ov::element::Type type) {
+            // [.., M, K] x constant [K, K]
+            auto k = shape.back();
+            return makeUnary(shape, type, [&](const ov::Output<ov::Node>& a) {
+                auto weights = opset::Constant::create(type, ov::Shape{k, k}, std::vector<float>(k * k, 0.5f));
+                return std::make_shared<opset::MatMul>(a, weights);
+            });
+        }},
+        {"Convolution", [](const ov::Shape& shape, ov::element::Type type) {
+            // NCHW input, 3x3 same-padding convolution keeping the channel count
+            if (shape.size() != 4) {
+                return std::shared_ptr<ov::Model>{};
+            }
+            auto channels = shape[1];
+            return makeUnary(shape, type, [&](const ov::Output<ov::Node>& a) {
+                auto weights = opset::Constant::create(type,
+                                                       ov::Shape{channels, channels, 3, 3},
+                                                       std::vector<float>(channels * channels * 9, 0.01f));
+                return std::make_shared<opset::Convolution>(a,
+                                                            weights,
+                                                            ov::Strides{1, 1},
+                                                            ov::CoordinateDiff{1, 1},
+                                                            ov::CoordinateDiff{1, 1},
+                                                            ov::Strides{1, 1});
+            });
+        }},
+    };
+    return registry;
+}
+
+std::vector<ov::Shape> defaultShapes() {
+    return {
+        {1, 16, 56, 56},
+        {1, 64, 56, 56},
+        {1, 256, 28, 28},
+        {1, 512, 7, 7},
+        {8, 1024},
+        {32, 4096},
+        {1, 16, 1024},
+    };
+}
+
+void printUsage(const char* name) {
+    std::cout << "Usage: " << name << " [-d <device>] [-ops <op[,op...]>] [-shapes <dims[;dims...]>]"
+              << " [-dtype <f32|f16>] [-niter <n>] [-warmup <n>] [-o <report.json>]\n"
+              << "  -d      target device (default: CPU)\n"
+              << "  -ops    comma-separated op subset (default: all registered ops)\n"
+              << "  -shapes semicolon-separated shapes, dims joined by 'x' (default corpus otherwise)\n"
+              << "  -dtype  element type of the benchmarked tensors (default: f32)\n"
+              << "  -niter  measured iterations per case (default: 100)\n"
+              << "  -warmup warmup iterations per case (default: 10)\n"
+              << "  -o      write the JSON report to a file instead of stdout\n";
+}
+
+std::vector<std::string> splitString(const std::string& value, char separator) {
+    std::vector<std::string> result;
+    std::stringstream ss{value};
+    std::string token;
+    while (std::getline(ss, token, separator)) {
+        if (!token.empty()) {
+            result.push_back(token);
+        }
+    }
+    return result;
+}
+
+std::vector<ov::Shape> parseShapes(const std::string& value) {
+    std::vector<ov::Shape> shapes;
+    for (const auto& dims : splitString(value, ';')) {
+        ov::Shape shape;
+        for (const auto& dim : splitString(dims, 'x')) {
+            shape.push_back(std::stoul(dim));
+        }
+        shapes.push_back(shape);
+    }
+    return shapes;
+}
+
+bool parseOptions(int argc, char** argv, Options& options) {
+    for (int i = 1; i < argc; i++) {
+        const std::string arg = argv[i];
+        const bool has_value = i + 1 < argc;
+        if (arg == "-d" && has_value) {
+            options.device = argv[++i];
+        } else if (arg == "-ops" && has_value) {
+            options.ops = splitString(argv[++i], ',');
+        } else if (arg == "-shapes" && has_value) {
+            options.shapes = parseShapes(argv[++i]);
+        } else if (arg == "-dtype" && has_value) {
+            const std::string type = argv[++i];
+            if (type == "f32") {
+                options.type = ov::element::f32;
+            } else if (type == "f16") {
+                options.type = ov::element::f16;
+            } else {
+                return false;
+            }
+        } else if (arg == "-niter" && has_value) {
+            options.num_iterations = std::stoi(argv[++i]);
+        } else if (arg == "-warmup" && has_value) {
+            options.num_warmup = std::stoi(argv[++i]);
+        } else if (arg == "-o" && has_value) {
+            options.output_path = argv[++i];
+        } else {
+            return false;
+        }
+    }
+    return options.num_iterations > 0 && options.num_warmup >= 0;
+}
+
+void fillRandom(ov::Tensor& tensor) {
+    std::mt19937 engine{42};
+    std::uniform_real_distribution<float> dist{-1.f, 1.f};
+    if (tensor.get_element_type() == ov::element::f32) {
+        auto* data = tensor.data<float>();
+        for (std::size_t i = 0; i < tensor.get_size(); ++i) {
+            data[i] = dist(engine);
+        }
+    } else {
+        auto* data = static_cast<std::uint8_t*>(tensor.data());
+        for (std::size_t i = 0; i < tensor.get_byte_size(); ++i) {
+            data[i] = static_cast<std::uint8_t>(engine());
+        }
+    }
+}
+
+struct Record {
+    std::string op;
+    ov::Shape shape;
+    std::string dtype;
+    double ns_per_iter;
+    double gb_per_s;
+};
+
+void writeReport(std::ostream& out, const std::string& device, const std::vector<Record>& records) {
+    out << "[\n";
+    for (std::size_t r = 0; r < records.size(); ++r) {
+        const auto& record = records[r];
+        out << "  {\"op\": \"" << record.op << "\", \"shape\": [";
+        for (std::size_t d = 0; d < record.shape.size(); ++d) {
+            out << (d ? ", " : "") << record.shape[d];
+        }
+        out << "], \"dtype\": \"" << record.dtype << "\", \"device\": \"" << device << "\""
+            << ", \"ns_per_iter\": " << record.ns_per_iter
+            << ", \"gb_per_s\": " << record.gb_per_s << "}"
+            << (r + 1 < records.size() ? "," : "") << "\n";
+    }
+    out << "]\n";
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    Options options;
+    if (!parseOptions(argc, argv, options)) {
+        printUsage(argv[0]);
+        return 1;
+    }
+    if (options.ops.empty()) {
+        for (const auto& entry : builders()) {
+            options.ops.push_back(entry.first);
+        }
+    }
+    if (options.shapes.empty()) {
+        options.shapes = defaultShapes();
+    }
+
+    try {
+        ov::Core core;
+        std::vector<Record> records;
+
+        for (const auto& op : options.ops) {
+            auto builder = builders().find(op);
+            if (builder == builders().end()) {
+                std::cerr << "Unknown op: " << op << ", skipping" << std::endl;
+                continue;
+            }
+            for (const auto& shape : options.shapes) {
+                auto model = builder->second(shape, options.type);
+                if (!model) {
+                    continue;  // shape does not fit the op (e.g. non-4D convolution)
+                }
+                ov::CompiledModel compiled;
+                try {
+                    compiled = core.compile_model(model, options.device);
+                } catch (const std::exception& e) {
+                    std::cerr << op << " " << ov::Shape(shape) << " not supported on "
+                              << options.device << ": " << e.what() << std::endl;
+                    continue;
+                }
+                auto request = compiled.create_infer_request();
+
+                std::size_t bytes = 0;
+                for (const auto& input : compiled.inputs()) {
+                    auto tensor = request.get_tensor(input);
+                    fillRandom(tensor);
+                    bytes += tensor.get_byte_size();
+                }
+                for (const auto& output : compiled.outputs()) {
+                    bytes += request.get_tensor(output).get_byte_size();
+                }
+
+                for (int i = 0; i < options.num_warmup; ++i) {
+                    request.infer();
+                }
+                std::vector<double> samples;
+                samples.reserve(options.num_iterations);
+                for (int i = 0; i < options.num_iterations; ++i) {
+                    const auto start = std::chrono::steady_clock::now();
+                    request.infer();
+                    const auto stop = std::chrono::steady_clock::now();
+                    samples.push_back(std::chrono::duration<double, std::nano>(stop - start).count());
+                }
+                std::nth_element(samples.begin(), samples.begin() + samples.size() / 2, samples.end());
+                const double median_ns = samples[samples.size() / 2];
+
+                records.push_back({op,
+                                   shape,
+                                   options.type.get_type_name(),
+                                   median_ns,
+                                   median_ns > 0 ? bytes / median_ns : 0.0});
+            }
+        }
+
+        if (options.output_path.empty()) {
+            writeReport(std::cout, options.device, records);
+        } else {
+            std::ofstream out{options.output_path};
+            writeReport(out, options.device, records);
+        }
+    } catch (const std::exception& e) {
+        std::cerr << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,295 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+// End-to-end performance regression suite for the plugins in this repository.
+//
+// Runs a configurable list of local IR models through the full pipeline
+// (read_model + compile_model + N inferences) on the requested device and
+// records startup time, p50/p99 latency, throughput and the peak-memory
+// increase attributable to each model. Results gate against a stored baseline
+// with a relative tolerance, so a regression fails the run instead of
+// surfacing on a production dashboard weeks later.
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <openvino/openvino.hpp>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace {
+
+struct Options {
+    std::string device = "CPU";
+    std::vector<std::string> models;   // paths to IR .xml files
+    std::string baseline_path;         // empty disables the gate
+    bool update_baseline = false;      // rewrite the baseline from this run
+    double tolerance = 0.1;            // allowed relative slowdown
+    int num_iterations = 200;
+    int num_warmup = 20;
+    std::string output_path;           // empty writes to stdout
+};
+
+struct Measurement {
+    double startup_ms = 0;             // read_model + compile_model
+    double p50_ms = 0;
+    double p99_ms = 0;
+    double fps = 0;
+    double peak_memory_mb = 0;         // process high-water-mark increase
+};
+
+// Metrics where larger is better gate against the lower bound
+const std::map<std::string, bool>& metricIsHigherBetter() {
+    static const std::map<std::string, bool> metrics = {
+        {"startup_ms", false},
+        {"p50_ms", false},
+        {"p99_ms", false},
+        {"fps", true},
+        {"peak_memory_mb", false},
+    };
+    return metrics;
+}
+
+double metricValue(const Measurement& m, const std::string& metric) {
+    if (metric == "startup_ms") return m.startup_ms;
+    if (metric == "p50_ms") return m.p50_ms;
+    if (metric == "p99_ms") return m.p99_ms;
+    if (metric == "fps") return m.fps;
+    return m.peak_memory_mb;
+}
+
+std::string modelName(const std::string& path) {
+    auto begin = path.find_last_of("/\\");
+    begin = begin == std::string::npos ? 0 : begin + 1;
+    auto end = path.rfind('.');
+    end = end == std::string::npos || end < begin ? path.size() : end;
+    return path.substr(begin, end - begin);
+}
+
+// Process resident high-water mark. The mutable-blob and pool sizes the
+// plugins plan internally are not observable through the public API, so the
+// suite tracks the VmHWM increase around each model instead, which bounds
+// them from above together with the runtime's own overhead.
+double peakMemoryMb() {
+    std::ifstream status{"/proc/self/status"};
+    std::string line;
+    while (std::getline(status, line)) {
+        if (line.compare(0, 6, "VmHWM:") == 0) {
+            std::stringstream ss{line.substr(6)};
+            double kb = 0;
+            ss >> kb;
+            return kb / 1024.0;
+        }
+    }
+    return 0;
+}
+
+void fillRandom(ov::Tensor& tensor) {
+    std::mt19937 engine{42};
+    auto* data = static_cast<std::uint8_t*>(tensor.data());
+    for (std::size_t i = 0; i < tensor.get_byte_size(); ++i) {
+        data[i] = static_cast<std::uint8_t>(engine());
+    }
+}
+
+void printUsage(const char* name) {
+    std::cout << "Usage: " << name << " -models_list <file> [-d <device>] [-baseline <file>]"
+              << " [-update_baseline] [-tolerance <ratio>] [-niter <n>] [-warmup <n>] [-o <report.json>]\n"
+              << "  -models_list     file with one IR .xml path per line ('#' starts a comment)\n"
+              << "  -d               target device (default: CPU)\n"
+              << "  -baseline        baseline file to gate against\n"
+              << "  -update_baseline rewrite the baseline from this run instead of gating\n"
+              << "  -tolerance       allowed relative slowdown before failing (default: 0.1)\n"
+              << "  -niter           measured inferences per model (default: 200)\n"
+              << "  -warmup          warmup inferences per model (default: 20)\n"
+              << "  -o               write the JSON report to a file instead of stdout\n";
+}
+
+bool parseOptions(int argc, char** argv, Options& options) {
+    for (int i = 1; i < argc; i++) {
+        const std::string arg = argv[i];
+        const bool has_value = i + 1 < argc;
+        if (arg == "-models_list" && has_value) {
+            std::ifstream list{argv[++i]};
+            std::string line;
+            while (std::getline(list, line)) {
+                const auto comment = line.find('#');
+                if (comment != std::string::npos) {
+                    line.resize(comment);
+                }
+                line.erase(0, line.find_first_not_of(" \t"));
+                line.erase(line.find_last_not_of(" \t\r") + 1);
+                if (!line.empty()) {
+                    options.models.push_back(line);
+                }
+            }
+        } else if (arg == "-d" && has_value) {
+            options.device = argv[++i];
+        } else if (arg == "-baseline" && has_value) {
+            options.baseline_path = argv[++i];
+        } else if (arg == "-update_baseline") {
+            options.update_baseline = true;
+        } else if (arg == "-tolerance" && has_value) {
+            options.tolerance = std::stod(argv[++i]);
+        } else if (arg == "-niter" && has_value) {
+            options.num_iterations = std::stoi(argv[++i]);
+        } else if (arg == "-warmup" && has_value) {
+            options.num_warmup = std::stoi(argv[++i]);
+        } else if (arg == "-o" && has_value) {
+            options.output_path = argv[++i];
+        } else {
+            return false;
+        }
+    }
+    return !options.models.empty() && options.num_iterations > 0 && options.tolerance >= 0;
+}
+
+Measurement runModel(ov::Core& core, const std::string& path, const Options& options) {
+    Measurement result;
+    const double memory_before = peakMemoryMb();
+
+    const auto startup_begin = std::chrono::steady_clock::now();
+    auto model = core.read_model(path);
+    auto compiled = core.compile_model(model, options.device);
+    const auto startup_end = std::chrono::steady_clock::now();
+    result.startup_ms = std::chrono::duration<double, std::milli>(startup_end - startup_begin).count();
+
+    auto request = compiled.create_infer_request();
+    for (const auto& input : compiled.inputs()) {
+        auto tensor = request.get_tensor(input);
+        fillRandom(tensor);
+    }
+
+    for (int i = 0; i < options.num_warmup; ++i) {
+        request.infer();
+    }
+    std::vector<double> samples;
+    samples.reserve(options.num_iterations);
+    const auto run_begin = std::chrono::steady_clock::now();
+    for (int i = 0; i < options.num_iterations; ++i) {
+        const auto start = std::chrono::steady_clock::now();
+        request.infer();
+        const auto stop = std::chrono::steady_clock::now();
+        samples.push_back(std::chrono::duration<double, std::milli>(stop - start).count());
+    }
+    const auto run_end = std::chrono::steady_clock::now();
+
+    std::sort(samples.begin(), samples.end());
+    result.p50_ms = samples[samples.size() / 2];
+    result.p99_ms = samples[std::min(samples.size() - 1, samples.size() * 99 / 100)];
+    const double total_s = std::chrono::duration<double>(run_end - run_begin).count();
+    result.fps = total_s > 0 ? options.num_iterations / total_s : 0;
+    result.peak_memory_mb = peakMemoryMb() - memory_before;
+    return result;
+}
+
+// The baseline is a plain text file with one "<model> <metric> <value>" line
+// per entry, so diffs of baseline updates review like any other change
+std::map<std::string, std::map<std::string, double>> readBaseline(const std::string& path) {
+    std::map<std::string, std::map<std::string, double>> baseline;
+    std::ifstream in{path};
+    std::string model, metric;
+    double value;
+    while (in >> model >> metric >> value) {
+        baseline[model][metric] = value;
+    }
+    return baseline;
+}
+
+void writeBaseline(const std::string& path, const std::map<std::string, Measurement>& results) {
+    std::ofstream out{path};
+    for (const auto& entry : results) {
+        for (const auto& metric : metricIsHigherBetter()) {
+            out << entry.first << " " << metric.first << " " << metricValue(entry.second, metric.first) << "\n";
+        }
+    }
+}
+
+bool gateAgainstBaseline(const std::map<std::string, Measurement>& results,
+                         const std::map<std::string, std::map<std::string, double>>& baseline,
+                         double tolerance) {
+    bool passed = true;
+    for (const auto& entry : results) {
+        const auto reference = baseline.find(entry.first);
+        if (reference == baseline.end()) {
+            std::cerr << entry.first << ": no baseline entry, skipping the gate" << std::endl;
+            continue;
+        }
+        for (const auto& metric : metricIsHigherBetter()) {
+            const auto ref_value = reference->second.find(metric.first);
+            if (ref_value == reference->second.end()) {
+                continue;
+            }
+            const double measured = metricValue(entry.second, metric.first);
+            const bool regressed = metric.second
+                ? measured < ref_value->second * (1 - tolerance)
+                : measured > ref_value->second * (1 + tolerance);
+            if (regressed) {
+                std::cerr << "REGRESSION " << entry.first << " " << metric.first << ": "
+                          << measured << " vs baseline " << ref_value->second
+                          << " (tolerance " << tolerance * 100 << "%)" << std::endl;
+                passed = false;
+            }
+        }
+    }
+    return passed;
+}
+
+void writeReport(std::ostream& out, const std::string& device, const std::map<std::string, Measurement>& results) {
+    out << "[\n";
+    std::size_t r = 0;
+    for (const auto& entry : results) {
+        const auto& m = entry.second;
+        out << "  {\"model\": \"" << entry.first << "\", \"device\": \"" << device << "\""
+            << ", \"startup_ms\": " << m.startup_ms
+            << ", \"p50_ms\": " << m.p50_ms
+            << ", \"p99_ms\": " << m.p99_ms
+            << ", \"fps\": " << m.fps
+            << ", \"peak_memory_mb\": " << m.peak_memory_mb << "}"
+            << (++r < results.size() ? "," : "") << "\n";
+    }
+    out << "]\n";
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    Options options;
+    if (!parseOptions(argc, argv, options)) {
+        printUsage(argv[0]);
+        return 1;
+    }
+
+    try {
+        ov::Core core;
+        std::map<std::string, Measurement> results;
+        for (const auto& path : options.models) {
+            results[modelName(path)] = runModel(core, path, options);
+        }
+
+        if (options.output_path.empty()) {
+            writeReport(std::cout, options.device, results);
+        } else {
+            std::ofstream out{options.output_path};
+            writeReport(out, options.device, results);
+        }
+
+        if (!options.baseline_path.empty()) {
+            if (options.update_baseline) {
+                writeBaseline(options.baseline_path, results);
+            } else if (!gateAgainstBaseline(results, readBaseline(options.baseline_path), options.tolerance)) {
+                return 2;
+            }
+        }
+    } catch (const std::exception& e) {
+        std::cerr << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}